@@ -5,14 +5,25 @@
 // ============ Feature Flags ============
 #define ENABLE_WIFI         0   // WiFi disabled - conflicts with MIPI-DSI
 #define ENABLE_ETHERNET     0
-#define ENABLE_MQTT         0
+#define ENABLE_MQTT         0   // Publish the dashboard topics (see MQTT_* below)
 #define ENABLE_DEMO_MODE    1   // Enable demo profiles
 #define ENABLE_ONBOARDING   1   // Show one-time setup page before main screens
+#define ENABLE_PERF_LOG     0   // Print inference/engine timing to Serial
+#define ENABLE_TS_STORE     1   // Persist sensor history to the FAT partition
+#define ENABLE_CAPTURE      0   // Record the active demo's stream (see CAPTURE_* below)
+#define ENABLE_REPLAY       0   // Replay REPLAY_FILE at boot instead of simulating
+#define ENABLE_MODBUS       0   // Poll field registers into the sensor values (see MODBUS_* below)
+#define ENABLE_WEB          0   // Serve the dashboard and live state on WEB_PORT (needs a network)
+#define ENABLE_OTA          0   // Real updates from OTA_URL behind the OTA card (needs a network)
+#define ENABLE_VISION       0   // Read lamps by camera into VISION_MACHINE (ROIs in src/vision/vision_rois.h)
 
 // Remote dashboard URL used by QR codes (ESP Remote View + AI screen)
 // Update this when you publish index.html (for example, GitHub Pages URL).
 #define REMOTE_DASHBOARD_URL "https://YOUR_GITHUB_USERNAME.github.io/signaltap_arduino/"
 
+// Device identity: QR codes and the MQTT topics (<root>/<DEVICE_ID>/...)
+#define DEVICE_ID           "STAP-001-A7F3"
+
 // ============ Display Configuration ============
 #define DISPLAY_WIDTH       1024
 #define DISPLAY_HEIGHT      600
@@ -26,6 +37,57 @@
 // ============ Timing ============
 #define SPLASH_DURATION_MS  2500
 #define SENSOR_UPDATE_MS    1000
+#define SIM_SPEED           1   // Simulated seconds per wall second (fast-forward)
 #define LVGL_TICK_MS        5
+#define PERF_LOG_INTERVAL_MS 30000
+
+// ============ LVGL Heap (src/ui/ui_mem; lv_conf.h hands LVGL's malloc to it) ============
+#define UI_MEM_BACKEND      1   // 0 = system heap (counted), 1 = TLSF pool + PSRAM arena
+#define UI_MEM_POOL_SIZE    (192 * 1024)    // Internal SRAM: objects, styles, text, draw tasks
+#define UI_MEM_ARENA_SIZE   (512 * 1024)    // PSRAM: layer buffers; 0 = pool only
+#define UI_MEM_LARGE_MIN    4096            // Requests this size and up go to the arena
+#define UI_MEM_DEBUG        0   // Log every steady refresh that still allocated (needs ENABLE_PERF_LOG)
+
+// ============ Capture / Replay ============
+#define CAPTURE_FILE        "/capture.bin"
+#define CAPTURE_TO_SERIAL   0   // Stream the capture over Serial (keep ENABLE_PERF_LOG off)
+#define REPLAY_FILE         "/replay.bin"
+
+// ============ Modbus (tag map in src/fieldbus/modbus_tags.h) ============
+#define MODBUS_USE_RTU      0   // 0 = Modbus TCP (needs ENABLE_ETHERNET), 1 = RTU on Serial1
+#define MODBUS_TCP_HOST     "192.168.1.10"
+#define MODBUS_TCP_PORT     502
+#define MODBUS_TCP_INFLIGHT 4   // Outstanding transactions on the connection (1..8)
+#define MODBUS_RTU_BAUD     19200
+#define MODBUS_RTU_PARITY   'E'
+#define MODBUS_RTU_RX_PIN   -1  // RS-485 transceiver wiring; -1 = core default pin
+#define MODBUS_RTU_TX_PIN   -1
+#define MODBUS_RTU_DE_PIN   -1  // Driver enable, -1 for auto-direction transceivers
+
+// ============ MQTT (topic contract in index.html) ============
+#define MQTT_BROKER_HOST    "192.168.1.20"
+#define MQTT_BROKER_PORT    1883
+#define MQTT_USER           ""  // Empty for an anonymous broker
+#define MQTT_PASS           ""
+#define MQTT_TOPIC_ROOT     "signaltap"
+#define MQTT_BINARY         0   // Sensors + vision as binary frames (src/net/telemetry_codec.h)
+#define MQTT_SPOOL          1   // Keep sensors messages on flash through broker outages
+#define MQTT_SPOOL_FILE     "/spool.dat"
+
+// ============ Web Server (page packed by tools/web_pack.py) ============
+#define WEB_PORT            80
+
+// ============ OTA (patches made by tools/ota_bench.cpp make) ============
+#define OTA_URL             "http://192.168.1.20:8000/signaltap.patch"
+
+// ============ Vision (MIPI-CSI camera through the esp_video component) ============
+#define VISION_MACHINE      0   // Demo whose stack light / LEDs / IO the camera reads
+#define CAMERA_WIDTH        1280
+#define CAMERA_HEIGHT       720
+#define CAMERA_SCCB_PORT    1   // Sensor control bus: its own I2C port, not the touch one
+#define CAMERA_SCCB_SDA     -1  // Set to the camera connector's pins
+#define CAMERA_SCCB_SCL     -1
+#define CAMERA_RESET_PIN    -1
+#define CAMERA_PWDN_PIN     -1
 
 #endif // CONFIG_H
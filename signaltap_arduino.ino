@@ -13,9 +13,37 @@
 #include <lvgl.h>
 #include "config.h"
 #include "src/ui/ui_manager.h"
+#include "src/ui/ui_format.h"
+#include "src/ui/ui_mem.h"
 #include "src/data/demo_profiles.h"
 #include "src/data/simulation_engine.h"
 #include "lvgl_port_v9.h"
+#if ENABLE_MODBUS
+#include "src/fieldbus/modbus_master.h"
+#include "src/fieldbus/modbus_tags.h"
+#endif
+#if ENABLE_MQTT
+#include "src/net/mqtt_client.h"
+#include "src/net/telemetry.h"
+#include "src/storage/telemetry_spool.h"
+#endif
+#if ENABLE_WEB
+#include "src/net/live_state.h"
+#include "src/net/web_server.h"
+#endif
+#if ENABLE_OTA
+#include "src/ota/ota_update.h"
+#endif
+#if ENABLE_VISION
+#include "src/vision/camera.h"
+#include "src/vision/cam_preview.h"
+#include "src/vision/roi_engine.h"
+#include "src/vision/seg_ocr.h"
+#include "src/vision/vision_rois.h"
+#endif
+#if ENABLE_ETHERNET
+#include <ETH.h>
+#endif
 
 // External function from lvgl_sw_rotation.c
 extern "C" void lvgl_sw_rotation_main(void);
@@ -24,6 +52,85 @@ extern "C" void lvgl_sw_rotation_main(void);
 static unsigned long lastSensorUpdate = 0;
 static unsigned long startTime = 0;
 static bool splashDone = false;
+#if ENABLE_PERF_LOG
+static unsigned long lastPerfLog = 0;
+#endif
+#if ENABLE_CAPTURE && !CAPTURE_TO_SERIAL
+static CaptureFlashSink_t captureSink;
+#endif
+#if ENABLE_REPLAY
+static CaptureFile_t replayFile;
+#endif
+#if ENABLE_MODBUS
+static MbLink_t mbLink;
+static MbMaster_t mbMaster;
+
+// Polled register -> the machine's sensor value
+static void on_field_value(uint16_t tag, const MbTagDef_t* def, float value, void* ctx) {
+    sim_set_field_value(def->machine, def->sensor, value);
+}
+#endif
+#if ENABLE_MQTT
+static MqttClient_t mqtt;
+static Telemetry_t telem;
+#if MQTT_SPOOL
+static Spool_t spool;
+#endif
+#endif
+#if ENABLE_WEB
+static LiveState_t live;
+static WebServer_t web;
+#endif
+#if ENABLE_OTA
+static OtaUpdate_t ota;     // Stages run in their own tasks once started
+#endif
+#if ENABLE_VISION
+static Camera_t camera;
+static RoiEngine_t vision;  // Fed by its own task, frame by frame
+static SegOcr_t segOcr;     // Same task, same frames
+static CamPreview_t preview;
+
+// Each frame in the vision task, still in the camera's buffer
+static void on_frame(void* ctx, const uint8_t* frame, uint32_t nowMs) {
+    seg_ocr_process(&segOcr, frame, nowMs);
+    preview_push(&preview, frame, camera.width, camera.height, camera.stride, nowMs);
+}
+
+// Camera-read lamps and displays over the machine's simulated ones while
+// frames come in (ctx: the machine)
+static void apply_vision(void* ctx, Vision_t* v) {
+    uint8_t machine = (uint8_t)(uintptr_t)ctx;
+    if (machine == VISION_MACHINE) vision_apply(&vision, v, millis());
+    seg_ocr_apply(&segOcr, machine, v, millis());
+}
+#endif
+
+#if ENABLE_PERF_LOG
+// Value label formatting against snprintf on the target, once at boot
+static void perf_format_once(void) {
+    const int rounds = 2000;
+    char buf[32];
+    volatile int sink = 0;
+    uint32_t t = micros();
+    for (int i = 0; i < rounds; i++) sink += fmt_value_unit(buf, sizeof(buf), 20.0f + i * 0.37f, 1, "kPa");
+    uint32_t fmtUs = micros() - t;
+    t = micros();
+    for (int i = 0; i < rounds; i++) sink += snprintf(buf, sizeof(buf), "%.*f %s", 1, 20.0f + i * 0.37f, "kPa");
+    uint32_t printfUs = micros() - t;
+    Serial.printf("[perf] ui format: %.2f us/label, snprintf %.2f us/label (%.1fx)\n",
+                  (float)fmtUs / rounds, (float)printfUs / rounds,
+                  fmtUs ? (float)printfUs / fmtUs : 0.0f);
+}
+#endif
+
+#if ENABLE_PERF_LOG && UI_MEM_DEBUG
+// Screen and demo unchanged, yet the refresh allocated like a rebuild
+static void on_steady_alloc(const UiMemTick_t* t, void* ctx) {
+    Serial.printf("[mem] refresh %lu: %lu allocs, %lu B requested (largest %lu B), net %ld B\n",
+                  (unsigned long)t->tick, (unsigned long)t->allocs, (unsigned long)t->bytes,
+                  (unsigned long)t->largestRequest, (long)t->netBytes);
+}
+#endif
 
 void setup() {
     Serial.begin(115200);
@@ -38,8 +145,97 @@ void setup() {
     // Initialize display, touch, and LVGL
     lvgl_sw_rotation_main();
 
+#if ENABLE_PERF_LOG && UI_MEM_DEBUG
+    ui_mem_set_steady_hook(on_steady_alloc, NULL);
+#endif
+
     // Initialize simulation engine
     sim_init();
+    // CNC spindle synthesis and FFTs off the loop
+    sim_start_vibration_task();
+    // History store file writes and FAT syncs off the loop
+    sim_start_store_task();
+
+#if ENABLE_REPLAY
+    // Field capture drives sensors, vision and alarms; AI and UI run as usual
+    if (capture_file_open(&replayFile, REPLAY_FILE) &&
+        sim_replay_start(replayFile.data, replayFile.len)) {
+        Serial.println("Replaying " REPLAY_FILE);
+    }
+#endif
+#if ENABLE_CAPTURE
+#if CAPTURE_TO_SERIAL
+    sim_capture_start(capture_sink_serial, NULL);
+#else
+    if (capture_flash_sink_open(&captureSink, CAPTURE_FILE)) {
+        sim_capture_start(capture_sink_flash, &captureSink);
+    }
+#endif
+#endif
+#if ENABLE_ETHERNET
+    ETH.begin();
+#endif
+#if ENABLE_MODBUS
+#if MODBUS_USE_RTU
+    mb_link_rtu(&mbLink, NULL, MODBUS_RTU_BAUD, MODBUS_RTU_PARITY);
+#else
+    // No connection yet is fine: the master keeps retrying
+    mb_link_tcp(&mbLink, MODBUS_TCP_HOST, MODBUS_TCP_PORT);
+#endif
+    mb_master_init(&mbMaster, &mbLink, modbusTags, MODBUS_TAG_COUNT, on_field_value, NULL);
+    mbMaster.maxInflight = MODBUS_TCP_INFLIGHT;
+#endif
+#if ENABLE_MQTT
+    // Connects at the first poll, and again whenever the broker goes away
+    mqtt_init(&mqtt, MQTT_BROKER_HOST, MQTT_BROKER_PORT, DEVICE_ID, MQTT_USER, MQTT_PASS);
+    telem_init(&telem, &mqtt, MQTT_TOPIC_ROOT, DEVICE_ID);
+    telem_set_binary(&telem, MQTT_BINARY);
+#if MQTT_SPOOL
+    // Flash writes happen in the spool's own task, never in loop()
+    if (spool_open(&spool, MQTT_SPOOL_FILE) && spool_start_task(&spool)) {
+        telem_set_spool(&telem, &spool);
+    }
+#endif
+#endif
+#if ENABLE_WEB
+    live_init(&live);
+    if (!web_begin(&web, WEB_PORT, &live, DEVICE_ID)) {
+        Serial.println("Web server: listen failed");
+    }
+#endif
+#if ENABLE_OTA
+    ota_init(&ota, NULL, NULL);
+    ui_set_ota(&ota);
+#endif
+#if ENABLE_VISION
+#if VISION_MACHINE == 3
+    vision_init(&vision, visionRoisPlc, VISION_ROI_COUNT_PLC);
+#else
+    vision_init(&vision, visionRoisCnc, VISION_ROI_COUNT_CNC);
+#endif
+    bool cameraUp = camera_open(&camera, NULL, CAMERA_WIDTH, CAMERA_HEIGHT, VISION_FPS);
+    // Display sample points are for the frame size the driver settled on
+    if (cameraUp) {
+        seg_ocr_init(&segOcr, segDisplays, SEG_DISPLAY_COUNT, camera.width, camera.height,
+                     camera.stride, VISION_FPS);
+    }
+    if (cameraUp && preview_init(&preview, PREVIEW_WIDTH, PREVIEW_HEIGHT, PREVIEW_FPS) &&
+        lvgl_port_lock(-1)) {
+        ui_set_preview(&preview);
+        lvgl_port_unlock();
+    }
+    if (cameraUp && vision_start_task(&vision, &camera, on_frame, NULL)) {
+        for (uint8_t m = 0; m < DEMO_COUNT; m++) {
+            sim_set_vision_source(m, apply_vision, (void*)(uintptr_t)m);
+        }
+    } else {
+        Serial.println("Vision: no camera");
+    }
+#endif
+
+#if ENABLE_PERF_LOG
+    perf_format_once();
+#endif
 
     startTime = millis();
 
@@ -65,22 +261,181 @@ void loop() {
         }
     }
 
-    // Update simulation every second (only after splash)
-    if (splashDone && (now - lastSensorUpdate >= SENSOR_UPDATE_MS)) {
+#if ENABLE_MODBUS
+    // Field polling runs every pass; sensor values land at the next tick
+    mb_master_poll(&mbMaster, micros());
+#endif
+#if ENABLE_MQTT
+    // Drains queued publishes as the socket takes them, keeps the session alive
+    mqtt_poll(&mqtt, now);
+    // Spooled backlog fills whatever room the live messages leave
+    telem_drain(&telem);
+#endif
+#if ENABLE_WEB
+    // Requests, and the latest snapshot out to the sockets
+    web_poll(&web, now);
+#endif
+
+    // Update simulation every second (only after splash). sim_update() runs
+    // as many ticks as the wall time since the last call is worth, so a
+    // slow loop pass or a missed display lock never loses simulated time.
+    if (!splashDone) {
+        sim_hold();
+    } else if (now - lastSensorUpdate >= SENSOR_UPDATE_MS) {
         lastSensorUpdate = now;
 
         UIState_t* state = ui_get_state();
-        if (state && state->systemRunning) {
+        bool running = state && state->systemRunning;
+        if (running) {
             // Run the simulation engine (handles all physics, alarms, AI)
-            sim_update();
+            uint32_t ticks = sim_update();
 
             // Refresh display with lock
-            if (lvgl_port_lock(100)) {
+            if (ticks > 0 && lvgl_port_lock(100)) {
                 ui_refresh();
                 lvgl_port_unlock();
             }
+        } else {
+            sim_hold();
+        }
+#if ENABLE_MQTT
+        // Also while stopped, so the dashboard sees the run state change
+        telem_tick(&telem, running, now);
+#endif
+#if ENABLE_WEB
+        live_publish(&live, running);
+#endif
+    }
+
+#if ENABLE_PERF_LOG
+    if (now - lastPerfLog >= PERF_LOG_INTERVAL_MS) {
+        lastPerfLog = now;
+        const NnStats_t* nn = anomaly_get_stats();
+        Serial.printf("[perf] anomaly model: %lu windows, last %lu us, avg %.1f us (%.0f inf/s)\n",
+                      (unsigned long)nn->inferences, (unsigned long)nn->lastUs,
+                      nn->avgUs, nn->inferencesPerSec);
+        const VibStats_t* vib = sim_get_vibration_stats();
+        Serial.printf("[perf] vibration: %lu samples, %lu frames, spectrum %lu us (%s), "
+                      "load %.1f%%, headroom %.1f%%\n",
+                      (unsigned long)vib->samples, (unsigned long)vib->frames,
+                      (unsigned long)vib->spectrumUs, vib_fft_kernel(), vib->loadPct, vib->headroomPct);
+        const RuleStats_t* rules = sim_get_rule_stats();
+        Serial.printf("[perf] alarm rules: %lu rules, last pass %lu us, %lu transitions\n",
+                      (unsigned long)rules->rules, (unsigned long)rules->lastUs,
+                      (unsigned long)rules->transitions);
+        const SimTimeStats_t* st = sim_get_time_stats();
+        Serial.printf("[perf] sim time: %lu s simulated, %lu ticks (%.0f us/tick), "
+                      "x%u, %lu catch-up ticks, %lu ms dropped\n",
+                      (unsigned long)sim_get_clock(), (unsigned long)st->ticks, st->usPerTick,
+                      sim_get_speed(), (unsigned long)st->catchUpTicks,
+                      (unsigned long)st->droppedMs);
+#if ENABLE_MODBUS
+        const MbStats_t* mb = mb_master_stats(&mbMaster);
+        Serial.printf("[perf] modbus: %lu requests, %lu tags read (%.1f per request), "
+                      "latency %.0f us, %u in flight max, %lu timeouts, %lu exceptions, %lu bad\n",
+                      (unsigned long)mb->requests, (unsigned long)mb->tagReads,
+                      mb->responses ? (float)mb->tagReads / mb->responses : 0.0f,
+                      mb->avgLatencyUs, mb->maxInflight, (unsigned long)mb->timeouts,
+                      (unsigned long)mb->exceptions, (unsigned long)mb->badFrames);
+#endif
+#if ENABLE_MQTT
+        const MqttStats_t* mq = mqtt_get_stats(&mqtt);
+        const TelemStats_t* tm = telem_get_stats(&telem);
+        Serial.printf("[perf] mqtt: %s, %lu published, %lu unchanged, %lu refused, "
+                      "%.1f msgs/write, tick %.0f us, queue high %lu B, %lu reconnects\n",
+                      mqtt_connected(&mqtt) ? "up" : "down", (unsigned long)tm->published,
+                      (unsigned long)tm->unchanged, (unsigned long)tm->failed,
+                      mq->writes ? (float)mq->published / mq->writes : 0.0f, tm->avgTickUs,
+                      (unsigned long)mq->queueHigh, (unsigned long)mq->disconnects);
+#if MQTT_SPOOL
+        const SpoolStats_t* sp = spool_get_stats(&spool);
+        Serial.printf("[perf] spool: %lu pages waiting, %lu records spooled, %lu dropped, "
+                      "%lu drained, %lu pages lost (%lu records), write max %lu us\n",
+                      (unsigned long)spool_pending(&spool), (unsigned long)sp->pushed,
+                      (unsigned long)sp->dropped, (unsigned long)sp->drainedRecords,
+                      (unsigned long)sp->pagesLost, (unsigned long)sp->recordsLost,
+                      (unsigned long)sp->maxWriteUs);
+#endif
+#endif
+#if ENABLE_OTA
+        if (ota_state(&ota) != OTA_IDLE) {
+            const OtaStats_t* os = ota_get_stats(&ota);
+            Serial.printf("[perf] ota: %s (%s), %lu B patch -> %lu B image, %lu ms, "
+                          "fetch %lu ms, decode %lu ms, write %lu ms\n",
+                          ota_busy(&ota) ? "running" : ota_state(&ota) == OTA_DONE ? "done" : "failed",
+                          ota_error_text(ota_error(&ota)), (unsigned long)os->patchBytes,
+                          (unsigned long)os->imageBytes, (unsigned long)os->totalMs,
+                          (unsigned long)(os->fetchUs / 1000), (unsigned long)(os->decodeUs / 1000),
+                          (unsigned long)(os->writeUs / 1000));
+        }
+#endif
+#if ENABLE_VISION
+        const VisionStats_t* vs = vision_get_stats(&vision);
+        const CameraStats_t* cs = camera_get_stats(&camera);
+        Serial.printf("[perf] vision: %lu frames, %lu dropped, %lu ROI px/frame, "
+                      "%.0f us/frame (max %lu), load %.2f%%, headroom %.2f%%, %lu lamp changes\n",
+                      (unsigned long)vs->frames, (unsigned long)cs->dropped,
+                      (unsigned long)vs->pixels, vs->avgUs, (unsigned long)vs->maxUs,
+                      vs->loadPct, vs->headroomPct, (unsigned long)vs->changes);
+        const SegStats_t* so = seg_ocr_get_stats(&segOcr);
+        Serial.printf("[perf] seven-segment: %u displays, %lu readings, %lu frames rejected, "
+                      "%.0f us/frame (max %lu), load %.2f%%\n",
+                      segOcr.count, (unsigned long)so->readings, (unsigned long)so->rejected,
+                      so->avgUs, (unsigned long)so->maxUs, so->loadPct);
+        const PreviewStats_t* ps = preview_get_stats(&preview);
+        Serial.printf("[perf] preview: %lu frames, %lu shown, %lu skipped (UI busy or away), "
+                      "%.0f us/frame (max %lu), load %.2f%%\n",
+                      (unsigned long)ps->frames, (unsigned long)ps->shown, (unsigned long)ps->skipped,
+                      ps->avgUs, (unsigned long)ps->maxUs, ps->loadPct);
+#endif
+#if ENABLE_WEB
+        const WebStats_t* ws = web_get_stats(&web);
+        Serial.printf("[perf] web: %u sockets, %lu requests, %lu messages (build %.1f us), "
+                      "%lu skipped, pool high %u/%u, %lu refused, %lu exports (%lu samples)\n",
+                      web_sockets(&web), (unsigned long)ws->requests, (unsigned long)ws->messages,
+                      ws->avgBuildUs, (unsigned long)ws->skipped, ws->poolHigh, WEB_POOL_BUFFERS,
+                      (unsigned long)ws->refused, (unsigned long)ws->exports,
+                      (unsigned long)ws->exportSamples);
+#endif
+        if (lvgl_port_lock(100)) {
+            UiMemStats_t um = *ui_mem_get_stats();
+            lvgl_port_unlock();
+            Serial.printf("[perf] lvgl heap: %s, pool %u/%u KB (peak %u), largest free %u B, frag %u%%, "
+                          "arena %u/%u KB; %.0f allocs/refresh (max %lu), %lu/%lu steady refreshes "
+                          "over budget, %lu spills, %lu failed\n",
+                          um.backend == UI_MEM_TLSF ? "tlsf" : "clib",
+                          (unsigned)(um.pool.used / 1024), (unsigned)(um.pool.size / 1024),
+                          (unsigned)(um.pool.usedMax / 1024), (unsigned)um.pool.largest, um.pool.fragPct,
+                          (unsigned)(um.arena.used / 1024), (unsigned)(um.arena.size / 1024),
+                          um.avgTickAllocs, (unsigned long)um.maxTickAllocs,
+                          (unsigned long)um.steadyOverTicks, (unsigned long)um.steadyTicks,
+                          (unsigned long)um.spills, (unsigned long)um.failures);
+        }
+        const FmtStats_t* fs = fmt_get_stats();
+        Serial.printf("[perf] ui text: %lu label updates, %lu unchanged (%.1f%% skipped)\n",
+                      (unsigned long)fs->updates, (unsigned long)fs->unchanged,
+                      fs->updates ? fs->unchanged * 100.0f / fs->updates : 0.0f);
+        const HBlockStats_t* hb = hblock_get_stats(sim_get_history_block());
+        Serial.printf("[perf] history block: %lu samples over %lu s, %.2f B/sample (%.1fx), "
+                      "decode %.0f samples/s\n",
+                      (unsigned long)hb->samples, (unsigned long)hb->spanS,
+                      hb->bytesPerSample, hb->compressionRatio, hb->decodeSamplesPerSec);
+        const TsStats_t* ts = sim_get_store_stats();
+        if (ts) {
+            Serial.printf("[perf] ts store: %lu samples (%lu dropped), %.1f B/sample, %.0f samples/s, "
+                          "query %lu us (%lu samples, %u segs skipped), wear %lu..%lu\n",
+                          (unsigned long)ts->samples, (unsigned long)ts->dropped,
+                          ts->bytesPerSample, ts->samplesPerSec,
+                          (unsigned long)ts->lastQueryUs, (unsigned long)ts->lastQuerySamples,
+                          ts->lastQuerySkipped, (unsigned long)ts->minWrites,
+                          (unsigned long)ts->maxWrites);
+            Serial.printf("[perf] ts writer: %lu writes, avg %lu us, max %lu us, %lu errors\n",
+                          (unsigned long)ts->jobsWritten,
+                          (unsigned long)(ts->jobsWritten ? ts->writeUs / ts->jobsWritten : 0),
+                          (unsigned long)ts->maxWriteUs, (unsigned long)ts->writeErrors);
         }
     }
+#endif
 
     delay(10);  // Small delay to yield to other tasks
 }
@@ -0,0 +1,50 @@
+// SIGNALTAP Anomaly Detector Implementation
+#include "anomaly_detector.h"
+#include "default_autoencoder.h"
+#include <string.h>
+
+static NnModel_t model;
+static NnStats_t stats;
+
+// ============ Public API ============
+bool anomaly_init(void) {
+    memset(&stats, 0, sizeof(stats));
+    return anomaly_load_model(defaultAutoencoderBlob, sizeof(defaultAutoencoderBlob));
+}
+
+bool anomaly_load_model(const uint8_t* blob, size_t len) {
+    NnModel_t candidate;
+    if (!nn_load(&candidate, blob, len)) return false;
+    if (candidate.hdr->inLength != ANOMALY_WINDOW ||
+        candidate.hdr->inChannels != ANOMALY_CHANNELS) return false;
+    if (!(candidate.hdr->errThreshold > 0.0f)) return false;
+
+    model = candidate;
+    memset(&stats, 0, sizeof(stats));
+    return true;
+}
+
+bool anomaly_ready(void) {
+    return model.loaded;
+}
+
+bool anomaly_score(const float* window, AnomalyResult_t* out) {
+    if (!model.loaded || !window || !out) return false;
+
+    float thr = model.hdr->errThreshold;
+    out->mse = nn_reconstruction_error(&model, window, out->channelErr, &stats);
+
+    // Squash the worst channel so the threshold maps to 50
+    float worst = 0.0f;
+    out->channelsOver = 0;
+    for (int c = 0; c < ANOMALY_CHANNELS; c++) {
+        if (out->channelErr[c] > worst) worst = out->channelErr[c];
+        if (out->channelErr[c] > thr) out->channelsOver++;
+    }
+    out->score = 100.0f * worst / (worst + thr);
+    return true;
+}
+
+const NnStats_t* anomaly_get_stats(void) {
+    return &stats;
+}
@@ -0,0 +1,38 @@
+// SIGNALTAP Anomaly Detector
+// Sliding-window autoencoder over the three sensor histories; the int8
+// reconstruction error becomes the AI screen's anomaly score. The same
+// portable kernels run on the device and the host (see nn_dot_s8).
+#ifndef ANOMALY_DETECTOR_H
+#define ANOMALY_DETECTOR_H
+
+#include <Arduino.h>
+#include "nn_int8.h"
+
+// ============ Window Shape ============
+#define ANOMALY_WINDOW      16   // Samples per channel (1 Hz -> 16 s)
+#define ANOMALY_CHANNELS    3    // One channel per demo sensor
+
+typedef struct {
+    float score;                        // 0-100, 50 = error at the model threshold
+    float mse;                          // Whole-window reconstruction MSE
+    float channelErr[ANOMALY_CHANNELS]; // Per-channel MSE
+    uint8_t channelsOver;               // Channels above the model threshold
+} AnomalyResult_t;
+
+// ============ Public API ============
+
+// Load the built-in model from flash
+bool anomaly_init(void);
+
+// Swap in another model blob (same window shape); keeps the old one on failure
+bool anomaly_load_model(const uint8_t* blob, size_t len);
+
+bool anomaly_ready(void);
+
+// window: [ANOMALY_WINDOW][ANOMALY_CHANNELS], oldest first, each value in 0..1
+bool anomaly_score(const float* window, AnomalyResult_t* out);
+
+// Inference throughput and per-window latency
+const NnStats_t* anomaly_get_stats(void);
+
+#endif // ANOMALY_DETECTOR_H
@@ -0,0 +1,133 @@
+// SIGNALTAP default anomaly model (generated by tools/nn_export.py - do not edit)
+// Dense 16x3 -> 12 (ReLU) -> 48 PCA autoencoder, channel MSE threshold 0.000071
+#ifndef DEFAULT_AUTOENCODER_H
+#define DEFAULT_AUTOENCODER_H
+
+#include <Arduino.h>
+
+alignas(4) static const uint8_t defaultAutoencoderBlob[1948] = {
+    0x53, 0x54, 0x4e, 0x4e, 0x01, 0x00, 0x02, 0x00, 0x10, 0x00, 0x03, 0x00, 0x81, 0x80, 0x80, 0x3b,
+    0x80, 0xff, 0xff, 0xff, 0xae, 0x0e, 0x94, 0x38, 0x9c, 0x07, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x00,
+    0x30, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x33, 0x94, 0x3b, 0x80, 0xff, 0xff, 0xff,
+    0xd0, 0x02, 0x00, 0x00, 0x81, 0xa2, 0xc9, 0x81, 0xa2, 0xc9, 0x81, 0xa2, 0xc9, 0x81, 0xa2, 0xc9,
+    0x81, 0xa2, 0xc9, 0x81, 0xa2, 0xc9, 0x81, 0xa2, 0xc9, 0x81, 0xa2, 0xc9, 0x81, 0xa2, 0xc9, 0x81,
+    0xa2, 0xc9, 0x81, 0xa2, 0xc9, 0x81, 0xa2, 0xc9, 0x81, 0xa2, 0xc9, 0x81, 0xa2, 0xc9, 0x81, 0xa2,
+    0xc9, 0x81, 0xa2, 0xc9, 0x7e, 0x83, 0xb2, 0x7e, 0x83, 0xb2, 0x7e, 0x83, 0xb2, 0x7f, 0x83, 0xb2,
+    0x7e, 0x83, 0xb2, 0x7f, 0x83, 0xb1, 0x7f, 0x83, 0xb1, 0x7e, 0x83, 0xb1, 0x7e, 0x83, 0xb1, 0x7f,
+    0x83, 0xb1, 0x7f, 0x83, 0xb1, 0x7f, 0x83, 0xb1, 0x7f, 0x83, 0xb1, 0x7f, 0x83, 0xb1, 0x7f, 0x83,
+    0xb1, 0x7f, 0x83, 0xb2, 0x00, 0xb4, 0x7d, 0x00, 0xb2, 0x7d, 0x01, 0xb3, 0x7e, 0x03, 0xb3, 0x7d,
+    0x02, 0xb3, 0x7d, 0x03, 0xb3, 0x7e, 0x02, 0xb3, 0x7e, 0x02, 0xb3, 0x7e, 0x02, 0xb2, 0x7e, 0x03,
+    0xb3, 0x7f, 0x03, 0xb3, 0x7e, 0x04, 0xb3, 0x7e, 0x03, 0xb4, 0x7e, 0x02, 0xb3, 0x7f, 0x03, 0xb3,
+    0x7e, 0x03, 0xb4, 0x7e, 0x97, 0xf9, 0xe1, 0x89, 0xf5, 0xdc, 0x81, 0xf3, 0xda, 0x8f, 0xf1, 0xdd,
+    0x9e, 0xf7, 0xe3, 0xb3, 0xf8, 0xeb, 0xcb, 0xf9, 0xf6, 0xe7, 0x02, 0xfe, 0x0a, 0x02, 0x06, 0x29,
+    0x08, 0x10, 0x4e, 0x08, 0x17, 0x6a, 0x0b, 0x1d, 0x7a, 0x11, 0x21, 0x7a, 0x0f, 0x1f, 0x7f, 0x08,
+    0x20, 0x6e, 0x06, 0x1a, 0xe4, 0x7a, 0x33, 0xf3, 0x7f, 0x33, 0xee, 0x7f, 0x34, 0xe8, 0x72, 0x35,
+    0xed, 0x52, 0x32, 0xf0, 0x37, 0x36, 0xed, 0x1a, 0x30, 0xef, 0x05, 0x15, 0xf5, 0xe9, 0x06, 0xee,
+    0xca, 0xf4, 0xf9, 0xb0, 0xe0, 0x05, 0xa2, 0xcd, 0x1f, 0x99, 0xbb, 0x2b, 0x99, 0xb6, 0x36, 0x99,
+    0xb6, 0x3a, 0x9f, 0xb7, 0x2c, 0x4e, 0x81, 0x24, 0x4c, 0x81, 0x26, 0x48, 0x83, 0x1a, 0x42, 0x93,
+    0x0b, 0x3a, 0xa7, 0x03, 0x2b, 0xbd, 0xf8, 0x12, 0xdb, 0xfc, 0xff, 0xfc, 0xfc, 0xe7, 0x20, 0xf0,
+    0xd5, 0x33, 0xe6, 0xca, 0x4d, 0xe1, 0xc5, 0x61, 0xe9, 0xc3, 0x6b, 0xf0, 0xc4, 0x70, 0xed, 0xc5,
+    0x6c, 0xf6, 0xcf, 0x63, 0x7f, 0x5e, 0x37, 0x7f, 0x5e, 0x37, 0x7f, 0x5e, 0x37, 0x7f, 0x5e, 0x37,
+    0x7f, 0x5e, 0x37, 0x7f, 0x5e, 0x37, 0x7f, 0x5e, 0x37, 0x7f, 0x5e, 0x37, 0x7f, 0x5e, 0x37, 0x7f,
+    0x5e, 0x37, 0x7f, 0x5e, 0x37, 0x7f, 0x5e, 0x37, 0x7f, 0x5e, 0x37, 0x7f, 0x5e, 0x37, 0x7f, 0x5e,
+    0x37, 0x7f, 0x5e, 0x37, 0x82, 0x7d, 0x4e, 0x82, 0x7d, 0x4e, 0x82, 0x7d, 0x4e, 0x81, 0x7d, 0x4e,
+    0x82, 0x7d, 0x4e, 0x81, 0x7d, 0x4f, 0x81, 0x7d, 0x4f, 0x82, 0x7d, 0x4f, 0x82, 0x7d, 0x4f, 0x81,
+    0x7d, 0x4f, 0x81, 0x7d, 0x4f, 0x81, 0x7d, 0x4f, 0x81, 0x7d, 0x4f, 0x81, 0x7d, 0x4f, 0x81, 0x7d,
+    0x4f, 0x81, 0x7d, 0x4e, 0x00, 0x4c, 0x83, 0x00, 0x4e, 0x83, 0xff, 0x4d, 0x82, 0xfd, 0x4d, 0x83,
+    0xfe, 0x4d, 0x83, 0xfd, 0x4d, 0x82, 0xfe, 0x4d, 0x82, 0xfe, 0x4d, 0x82, 0xfe, 0x4e, 0x82, 0xfd,
+    0x4d, 0x81, 0xfd, 0x4d, 0x82, 0xfc, 0x4d, 0x82, 0xfd, 0x4c, 0x82, 0xfe, 0x4d, 0x81, 0xfd, 0x4d,
+    0x82, 0xfd, 0x4c, 0x82, 0x69, 0x07, 0x1f, 0x77, 0x0b, 0x24, 0x7f, 0x0d, 0x26, 0x71, 0x0f, 0x23,
+    0x62, 0x09, 0x1d, 0x4d, 0x08, 0x15, 0x35, 0x07, 0x0a, 0x19, 0xfe, 0x02, 0xf6, 0xfe, 0xfa, 0xd7,
+    0xf8, 0xf0, 0xb2, 0xf8, 0xe9, 0x96, 0xf5, 0xe3, 0x86, 0xef, 0xdf, 0x86, 0xf1, 0xe1, 0x81, 0xf8,
+    0xe0, 0x92, 0xfa, 0xe6, 0x1c, 0x86, 0xcd, 0x0d, 0x81, 0xcd, 0x12, 0x81, 0xcc, 0x18, 0x8e, 0xcb,
+    0x13, 0xae, 0xce, 0x10, 0xc9, 0xca, 0x13, 0xe6, 0xd0, 0x11, 0xfb, 0xeb, 0x0b, 0x17, 0xfa, 0x12,
+    0x36, 0x0c, 0x07, 0x50, 0x20, 0xfb, 0x5e, 0x33, 0xe1, 0x67, 0x45, 0xd5, 0x67, 0x4a, 0xca, 0x67,
+    0x4a, 0xc6, 0x61, 0x49, 0xd4, 0xb2, 0x7f, 0xdc, 0xb4, 0x7f, 0xda, 0xb8, 0x7d, 0xe6, 0xbe, 0x6d,
+    0xf5, 0xc6, 0x59, 0xfd, 0xd5, 0x43, 0x08, 0xee, 0x25, 0x04, 0x01, 0x04, 0x04, 0x19, 0xe0, 0x10,
+    0x2b, 0xcd, 0x1a, 0x36, 0xb3, 0x1f, 0x3b, 0x9f, 0x17, 0x3d, 0x95, 0x10, 0x3c, 0x90, 0x13, 0x3b,
+    0x94, 0x0a, 0x31, 0x9d, 0x18, 0x41, 0x00, 0x00, 0x89, 0xed, 0xff, 0xff, 0x77, 0x15, 0x00, 0x00,
+    0xe7, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xe8, 0xbe, 0xff, 0xff,
+    0x77, 0x12, 0x00, 0x00, 0x89, 0xea, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xcc, 0xfe, 0xff, 0xff,
+    0xe8, 0xff, 0xff, 0xff, 0xdc, 0x13, 0x0a, 0x55, 0x3c, 0xf0, 0x07, 0x49, 0xc7, 0x66, 0x34, 0x60,
+    0xb7, 0xf7, 0x52, 0x46, 0x3f, 0x45, 0xb1, 0x41, 0x25, 0xb9, 0x3f, 0x40, 0xdc, 0x13, 0x0a, 0x55,
+    0x3c, 0xf0, 0x07, 0x49, 0xc7, 0x66, 0x34, 0x60, 0xb7, 0xf7, 0x52, 0x46, 0x3f, 0x45, 0xb1, 0x41,
+    0x25, 0xb9, 0x3f, 0x40, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0x00, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x81, 0x80, 0x80, 0x3b, 0x80, 0xff, 0xff, 0xff, 0x80, 0x04, 0x00, 0x00, 0xa3, 0x4f, 0x00, 0x81,
+    0xe0, 0x30, 0x5d, 0xb1, 0x00, 0x7f, 0x20, 0xd0, 0xc1, 0xb7, 0xc6, 0xf9, 0x7f, 0x50, 0x3f, 0x49,
+    0x3a, 0x07, 0x81, 0xb0, 0xdb, 0xd3, 0x5e, 0xde, 0x35, 0x81, 0x25, 0x2d, 0xa2, 0x22, 0xcb, 0x7f,
+    0xae, 0x46, 0x00, 0x81, 0xf3, 0x23, 0x52, 0xba, 0x00, 0x7f, 0x0d, 0xdd, 0xc3, 0xba, 0xc7, 0xf4,
+    0x7f, 0x4a, 0x3d, 0x46, 0x39, 0x0c, 0x81, 0xb6, 0xdb, 0xd4, 0x5e, 0xd8, 0x34, 0x81, 0x25, 0x2c,
+    0xa2, 0x28, 0xcc, 0x7f, 0xb3, 0x42, 0x01, 0x81, 0xef, 0x23, 0x4d, 0xbe, 0xff, 0x7f, 0x11, 0xdd,
+    0xc3, 0xba, 0xc7, 0xf2, 0x7f, 0x47, 0x3d, 0x46, 0x39, 0x0e, 0x81, 0xb9, 0xdb, 0xd3, 0x60, 0xd6,
+    0x36, 0x81, 0x25, 0x2d, 0xa0, 0x2a, 0xca, 0x7f, 0xaa, 0x4a, 0x02, 0x81, 0xe7, 0x1a, 0x56, 0xb6,
+    0xfe, 0x7f, 0x19, 0xe6, 0xbc, 0xb2, 0xc1, 0xee, 0x7f, 0x48, 0x44, 0x4e, 0x3f, 0x12, 0x81, 0xb8,
+    0xd6, 0xcc, 0x6d, 0xd3, 0x3f, 0x81, 0x2a, 0x34, 0x93, 0x2d, 0xc1, 0x7f, 0x9c, 0x55, 0x02, 0x81,
+    0xe9, 0x0d, 0x64, 0xab, 0xfe, 0x7f, 0x17, 0xf3, 0xa1, 0x94, 0xa8, 0xf0, 0x7f, 0x59, 0x5f, 0x6c,
+    0x58, 0x10, 0x81, 0xa7, 0xcf, 0xc4, 0x7f, 0xd6, 0x46, 0x87, 0x31, 0x3c, 0x81, 0x2a, 0xba, 0x79,
+    0x82, 0x6c, 0x03, 0x81, 0xe7, 0x04, 0x7e, 0x94, 0xfd, 0x7f, 0x19, 0xfc, 0x91, 0x81, 0x99, 0xef,
+    0x65, 0x4d, 0x6f, 0x7f, 0x67, 0x11, 0x9b, 0xb3, 0xcf, 0xc4, 0x7f, 0xe2, 0x4b, 0xa6, 0x31, 0x3c,
+    0x81, 0x1e, 0xb5, 0x5a, 0x81, 0x6d, 0x03, 0xa8, 0xe2, 0xf5, 0x7f, 0x93, 0xfd, 0x58, 0x1e, 0x0b,
+    0x91, 0x81, 0x99, 0xf2, 0x30, 0x20, 0x6f, 0x7f, 0x67, 0x0e, 0xd0, 0xe0, 0xcf, 0xc4, 0x7f, 0xf1,
+    0x41, 0xce, 0x31, 0x3c, 0x81, 0x0f, 0xbf, 0x32, 0x81, 0x6d, 0x02, 0xd7, 0xe6, 0xfa, 0x7f, 0x93,
+    0xfe, 0x29, 0x1a, 0x06, 0x91, 0x81, 0x99, 0x03, 0x09, 0xfe, 0x6f, 0x7f, 0x67, 0xfd, 0xf7, 0x02,
+    0xcf, 0xc4, 0x7f, 0xfd, 0x1d, 0xfb, 0x31, 0x3c, 0x81, 0x03, 0xe3, 0x05, 0x81, 0x6d, 0x02, 0x11,
+    0xee, 0xf9, 0x7f, 0x93, 0xfe, 0xef, 0x12, 0x07, 0x91, 0x81, 0x98, 0x04, 0xd5, 0xd4, 0x6f, 0x7f,
+    0x68, 0xfc, 0x2b, 0x2c, 0xcf, 0xc4, 0x7f, 0x09, 0x09, 0x2b, 0x31, 0x3c, 0x81, 0xf7, 0xf7, 0xd5,
+    0x81, 0x6d, 0x04, 0x44, 0xe4, 0xe8, 0x7f, 0x93, 0xfc, 0xbc, 0x1c, 0x18, 0x91, 0x81, 0x99, 0x0f,
+    0x9d, 0xb2, 0x6f, 0x7f, 0x67, 0xf1, 0x63, 0x4e, 0xcf, 0xc4, 0x7f, 0x17, 0xf0, 0x45, 0x31, 0x3c,
+    0x81, 0xe9, 0x10, 0xbb, 0x83, 0x6b, 0x03, 0x7f, 0xf6, 0xda, 0x7d, 0x95, 0xfd, 0x81, 0x0a, 0x26,
+    0xa0, 0x92, 0xa7, 0x0e, 0x81, 0xac, 0x60, 0x6e, 0x59, 0xf2, 0x7f, 0x54, 0xcf, 0xc4, 0x7f, 0x22,
+    0xd4, 0x68, 0x31, 0x3c, 0x81, 0xde, 0x2c, 0x98, 0xa4, 0x4f, 0x03, 0x7f, 0x05, 0xde, 0x5c, 0xb1,
+    0xfd, 0x81, 0xfb, 0x22, 0xae, 0xa2, 0xb4, 0x10, 0x81, 0xb2, 0x52, 0x5e, 0x4c, 0xf0, 0x7f, 0x4e,
+    0xd0, 0xc5, 0x7c, 0x2a, 0xbb, 0x7f, 0x30, 0x3b, 0x84, 0xd6, 0x45, 0x81, 0xb0, 0x45, 0x02, 0x7f,
+    0x1e, 0xea, 0x50, 0xbb, 0xfe, 0x81, 0xe2, 0x16, 0xb6, 0xab, 0xbc, 0x17, 0x81, 0xb7, 0x4a, 0x55,
+    0x44, 0xe9, 0x7f, 0x49, 0xd5, 0xcb, 0x71, 0x2b, 0xad, 0x7f, 0x2b, 0x35, 0x8f, 0xd5, 0x53, 0x81,
+    0xb0, 0x45, 0x01, 0x7f, 0x2a, 0xf1, 0x50, 0xbb, 0xff, 0x81, 0xd6, 0x0f, 0xb5, 0xaa, 0xba, 0x14,
+    0x81, 0xb7, 0x4b, 0x56, 0x46, 0xec, 0x7f, 0x49, 0xd7, 0xcd, 0x6c, 0x26, 0xaa, 0x7f, 0x29, 0x33,
+    0x94, 0xda, 0x56, 0x81, 0xb3, 0x42, 0x02, 0x7f, 0x32, 0xef, 0x4d, 0xbe, 0xfe, 0x81, 0xce, 0x11,
+    0xb5, 0xaa, 0xba, 0x0b, 0x81, 0xb9, 0x4b, 0x56, 0x46, 0xf5, 0x7f, 0x47, 0xd5, 0xcc, 0x6f, 0x29,
+    0xa7, 0x7f, 0x2b, 0x34, 0x91, 0xd7, 0x59, 0x81, 0xa7, 0x4c, 0x02, 0x7f, 0x3f, 0xf6, 0x59, 0xb4,
+    0xfe, 0x81, 0xc1, 0x0a, 0xb1, 0xa5, 0xb7, 0x08, 0x81, 0xc1, 0x4f, 0x5b, 0x49, 0xf8, 0x7f, 0x3f,
+    0xd1, 0xc7, 0x79, 0x24, 0xa0, 0x7f, 0x2f, 0x39, 0x87, 0xdc, 0x60, 0x81, 0xde, 0xdd, 0x00, 0x00,
+    0xe8, 0xc9, 0x00, 0x00, 0x3a, 0xbf, 0x00, 0x00, 0xcc, 0xc3, 0x00, 0x00, 0x73, 0xc1, 0x00, 0x00,
+    0xe9, 0xbe, 0x00, 0x00, 0x6f, 0xb7, 0x00, 0x00, 0x50, 0xc1, 0x00, 0x00, 0x8a, 0xc2, 0x00, 0x00,
+    0x55, 0xce, 0x00, 0x00, 0xf9, 0xd7, 0x00, 0x00, 0x2d, 0xde, 0x00, 0x00, 0x59, 0xee, 0x00, 0x00,
+    0xeb, 0x2c, 0x01, 0x00, 0x51, 0x02, 0x01, 0x00, 0x60, 0x2c, 0x01, 0x00, 0x5d, 0x61, 0x01, 0x00,
+    0xe7, 0x00, 0x01, 0x00, 0x79, 0x2f, 0x01, 0x00, 0x12, 0x61, 0x01, 0x00, 0x28, 0x01, 0x01, 0x00,
+    0x43, 0x2f, 0x01, 0x00, 0x4b, 0x61, 0x01, 0x00, 0x12, 0x01, 0x01, 0x00, 0x4c, 0x2f, 0x01, 0x00,
+    0x4b, 0x61, 0x01, 0x00, 0xa4, 0x00, 0x01, 0x00, 0x43, 0x2f, 0x01, 0x00, 0x1e, 0x62, 0x01, 0x00,
+    0x0b, 0xff, 0x00, 0x00, 0xce, 0x29, 0x01, 0x00, 0x6f, 0x32, 0x01, 0x00, 0x15, 0x00, 0x01, 0x00,
+    0x82, 0xdb, 0x00, 0x00, 0x9a, 0x04, 0x01, 0x00, 0x0f, 0xfb, 0x00, 0x00, 0xf5, 0xbe, 0x00, 0x00,
+    0x46, 0xed, 0x00, 0x00, 0xf9, 0xe2, 0x00, 0x00, 0x6b, 0xbf, 0x00, 0x00, 0xcc, 0xee, 0x00, 0x00,
+    0xe8, 0xd8, 0x00, 0x00, 0x39, 0xb7, 0x00, 0x00, 0x60, 0xee, 0x00, 0x00, 0x12, 0xe0, 0x00, 0x00,
+    0xe1, 0xd3, 0x00, 0x00, 0x8c, 0xfc, 0x00, 0x00, 0x4b, 0xf5, 0x00, 0x00, 0x02, 0x37, 0x3f, 0x4d,
+    0xaf, 0x3c, 0xad, 0x53, 0xc6, 0xa4, 0x55, 0x55, 0xd3, 0x5d, 0x89, 0x57, 0x9d, 0xa8, 0x53, 0x57,
+    0xff, 0x98, 0x75, 0x55, 0x38, 0x3a, 0x6b, 0x5d, 0xae, 0x24, 0x61, 0x57, 0x1b, 0x17, 0xe0, 0x53,
+    0x41, 0x62, 0x08, 0x53, 0xa5, 0x36, 0x36, 0x4e, 0x42, 0x64, 0x6f, 0x49, 0xbb, 0x02, 0xde, 0x47,
+    0xa6, 0x61, 0x44, 0x70, 0x03, 0xe5, 0x53, 0x7e, 0x17, 0x43, 0x16, 0x72, 0x35, 0x9c, 0x99, 0x5f,
+    0xec, 0x4c, 0x05, 0x7f, 0xa7, 0x06, 0xf2, 0x70, 0x92, 0x30, 0xad, 0x5f, 0x64, 0xf1, 0xe1, 0x7e,
+    0x84, 0x5c, 0x0c, 0x71, 0x37, 0xde, 0x98, 0x5f, 0x9c, 0xc7, 0xe9, 0x7e, 0x8a, 0xfe, 0x08, 0x71,
+    0xef, 0x28, 0x98, 0x5f, 0x8b, 0xa3, 0x20, 0x7f, 0xa2, 0xdb, 0x0a, 0x71, 0x75, 0x02, 0x5c, 0x5f,
+    0x00, 0xf5, 0xea, 0x7f, 0x51, 0x68, 0x1e, 0x73, 0x7a, 0xfc, 0x34, 0x6e, 0x30, 0x16, 0x62, 0x7f,
+    0xbf, 0x8d, 0x18, 0x4e, 0x8a, 0xb1, 0xcf, 0x40, 0xeb, 0x98, 0xf7, 0x40, 0x66, 0x19, 0xc0, 0x59,
+    0xbf, 0xf8, 0x30, 0x47, 0x5e, 0x27, 0xdf, 0x47, 0x8c, 0xae, 0x83, 0x59, 0x71, 0x72, 0xbb, 0x46,
+    0x27, 0x3c, 0x36, 0x4b, 0x12, 0x46, 0x8a, 0x5d, 0x19, 0xbd, 0xd8, 0x46, 0x05, 0x81, 0xd0, 0x48,
+    0xea, 0x72, 0xe7, 0x50, 0x9a, 0x1b, 0xdc, 0x42, 0xf1, 0x10, 0x84, 0x42, 0xf8, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+};
+
+#endif // DEFAULT_AUTOENCODER_H
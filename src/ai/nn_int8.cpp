@@ -0,0 +1,254 @@
+// SIGNALTAP Int8 Inference Runtime Implementation
+// Requantization follows the TFLite reference arithmetic so results are
+// bit-exact between the device and a host build, and exporters can reuse
+// TFLite per-channel parameters unchanged.
+#include "nn_int8.h"
+#include <string.h>
+#include <math.h>
+
+static int8_t arena[2][NN_ARENA_BYTES / 2];
+
+// ============ Fixed-Point Helpers ============
+static int32_t sat_round_doubling_high_mul(int32_t a, int32_t b) {
+    if (a == b && a == INT32_MIN) return INT32_MAX;
+    int64_t ab = (int64_t)a * (int64_t)b;
+    int32_t nudge = (ab >= 0) ? (1 << 30) : (1 - (1 << 30));
+    return (int32_t)((ab + nudge) / (1LL << 31));
+}
+
+static int32_t rounding_divide_by_pot(int32_t x, int exponent) {
+    int32_t mask = (int32_t)((1LL << exponent) - 1);
+    int32_t remainder = x & mask;
+    int32_t threshold = (mask >> 1) + ((x < 0) ? 1 : 0);
+    return (x >> exponent) + ((remainder > threshold) ? 1 : 0);
+}
+
+static int32_t requantize(int32_t acc, int32_t mult, int32_t shift) {
+    int left = shift > 0 ? shift : 0;
+    int right = shift > 0 ? 0 : -shift;
+    return rounding_divide_by_pot(sat_round_doubling_high_mul(acc * (1 << left), mult), right);
+}
+
+static int8_t clamp_s8(int32_t v) {
+    if (v < -128) return -128;
+    if (v > 127) return 127;
+    return (int8_t)v;
+}
+
+// ============ Dot-Product Kernel ============
+// Single entry point for every layer so a target-specific SIMD version can
+// replace it. Integer accumulation is order independent, so any lane split
+// stays bit-exact with this reference (tools/nn_bench holds it to the
+// exporter's Python forward).
+//
+// No ESP32-P4 PIE version: out of scope for this runtime. The built-in model is 1152 MACs a
+// window (48 -> 12 -> 48), one window per simulated second: about 2.5 us
+// on a host core, and even ten times that on the P4 is a few thousandths
+// of a percent of each second. PIE works on 16-byte vectors loaded from
+// 16-byte-aligned addresses; blob rows are only 4-aligned in flash and the
+// decoder's are 12 bytes, so a vector path would add aligned copies and a
+// scalar tail per row, and trade the bit-exact host twin for a kernel no
+// host build can check. Worth revisiting for wider models (rows of 64+).
+static int32_t nn_dot_s8(const int8_t* a, const int8_t* b, int n) {
+    int32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        s0 += (int32_t)a[i] * b[i];
+        s1 += (int32_t)a[i + 1] * b[i + 1];
+        s2 += (int32_t)a[i + 2] * b[i + 2];
+        s3 += (int32_t)a[i + 3] * b[i + 3];
+    }
+    for (; i < n; i++) s0 += (int32_t)a[i] * b[i];
+    return s0 + s1 + s2 + s3;
+}
+
+static int32_t nn_sum_s8(const int8_t* w, int n) {
+    int32_t s = 0;
+    for (int i = 0; i < n; i++) s += w[i];
+    return s;
+}
+
+// ============ Layers ============
+static void run_dense(const NnLayer_t* L, const int8_t* in, int8_t* out) {
+    const NnLayerHeader_t* h = L->hdr;
+    int n = L->inLen * L->inCh;
+    int32_t lo = (h->flags & NN_FLAG_FUSED_RELU) ? h->outZero : -128;
+    for (int oc = 0; oc < L->outCh; oc++) {
+        int32_t acc = L->bias[oc] + nn_dot_s8(in, L->weights + oc * n, n);
+        int32_t q = h->outZero + requantize(acc, L->mult[oc], L->shift[oc]);
+        out[oc] = clamp_s8(q < lo ? lo : q);
+    }
+}
+
+static void run_conv1d(const NnLayer_t* L, const int8_t* in, int8_t* out) {
+    const NnLayerHeader_t* h = L->hdr;
+    int k = h->kernel;
+    int ic = L->inCh;
+    int32_t lo = (h->flags & NN_FLAG_FUSED_RELU) ? h->outZero : -128;
+
+    for (int t = 0; t < L->outLen; t++) {
+        int start = t * h->stride - h->padding;
+        bool interior = start >= 0 && start + k <= L->inLen;
+        for (int oc = 0; oc < L->outCh; oc++) {
+            const int8_t* w = L->weights + oc * k * ic;
+            int32_t acc = L->bias[oc];
+            if (interior) {
+                // [len][ch] layout makes the whole receptive field contiguous
+                acc += nn_dot_s8(in + start * ic, w, k * ic);
+            } else {
+                for (int j = 0; j < k; j++) {
+                    int pos = start + j;
+                    if (pos >= 0 && pos < L->inLen) {
+                        acc += nn_dot_s8(in + pos * ic, w + j * ic, ic);
+                    } else {
+                        // Padded tap holds the input zero point (bias is pre-folded)
+                        acc += L->inZero * nn_sum_s8(w + j * ic, ic);
+                    }
+                }
+            }
+            int32_t q = h->outZero + requantize(acc, L->mult[oc], L->shift[oc]);
+            out[t * L->outCh + oc] = clamp_s8(q < lo ? lo : q);
+        }
+    }
+}
+
+static void run_relu(const NnLayer_t* L, const int8_t* in, int8_t* out) {
+    int n = L->inLen * L->inCh;
+    int8_t zero = clamp_s8(L->inZero);
+    for (int i = 0; i < n; i++) out[i] = in[i] < zero ? zero : in[i];
+}
+
+// ============ Public API ============
+bool nn_load(NnModel_t* model, const uint8_t* blob, size_t len) {
+    memset(model, 0, sizeof(*model));
+    if (!blob || len < sizeof(NnModelHeader_t) || ((uintptr_t)blob & 3)) return false;
+
+    const NnModelHeader_t* hdr = (const NnModelHeader_t*)blob;
+    if (hdr->magic != NN_MAGIC || hdr->version != NN_VERSION) return false;
+    if (hdr->totalBytes != len || hdr->layerCount == 0 || hdr->layerCount > NN_MAX_LAYERS) return false;
+
+    size_t off = sizeof(NnModelHeader_t);
+    uint16_t len_ = hdr->inLength, ch = hdr->inChannels;
+    int32_t zero = hdr->inZero;
+    if ((size_t)len_ * ch > sizeof(arena[0])) return false;
+
+    for (int i = 0; i < hdr->layerCount; i++) {
+        if (off + sizeof(NnLayerHeader_t) > len) return false;
+        const NnLayerHeader_t* lh = (const NnLayerHeader_t*)(blob + off);
+        off += sizeof(NnLayerHeader_t);
+        if (off + lh->payloadBytes > len) return false;
+
+        NnLayer_t* L = &model->layers[i];
+        L->hdr = lh;
+        L->inLen = len_;
+        L->inCh = ch;
+        L->inZero = zero;
+
+        size_t wBytes = 0;
+        switch (lh->type) {
+            case NN_LAYER_DENSE:
+                if (lh->inChannels != len_ * ch) return false;
+                wBytes = (size_t)lh->outChannels * lh->inChannels;
+                L->outLen = 1;
+                L->outCh = lh->outChannels;
+                break;
+            case NN_LAYER_CONV1D:
+                if (lh->inChannels != ch || lh->kernel == 0 || lh->stride == 0) return false;
+                if (len_ + 2 * lh->padding < lh->kernel) return false;
+                wBytes = (size_t)lh->outChannels * lh->kernel * ch;
+                L->outLen = (len_ + 2 * lh->padding - lh->kernel) / lh->stride + 1;
+                L->outCh = lh->outChannels;
+                break;
+            case NN_LAYER_RELU:
+                L->outLen = len_;
+                L->outCh = ch;
+                break;
+            default:
+                return false;
+        }
+
+        if (lh->type != NN_LAYER_RELU) {
+            size_t wPadded = (wBytes + 3) & ~(size_t)3;
+            if (lh->payloadBytes != wPadded + 3 * 4 * (size_t)lh->outChannels) return false;
+            const uint8_t* p = blob + off;
+            L->weights = (const int8_t*)p;
+            L->bias = (const int32_t*)(p + wPadded);
+            L->mult = L->bias + lh->outChannels;
+            L->shift = L->mult + lh->outChannels;
+            zero = lh->outZero;
+        }
+        off += lh->payloadBytes;
+
+        len_ = L->outLen;
+        ch = L->outCh;
+        if ((size_t)len_ * ch > sizeof(arena[0])) return false;
+    }
+
+    // Autoencoder contract: output has the same number of values as the input
+    if ((size_t)len_ * ch != (size_t)hdr->inLength * hdr->inChannels) return false;
+
+    model->hdr = hdr;
+    model->layerCount = hdr->layerCount;
+    model->outSize = len_ * ch;
+    model->loaded = true;
+    return true;
+}
+
+bool nn_run(const NnModel_t* model, const int8_t* input, int8_t* output) {
+    if (!model || !model->loaded) return false;
+
+    const int8_t* src = input;
+    for (int i = 0; i < model->layerCount; i++) {
+        const NnLayer_t* L = &model->layers[i];
+        int8_t* dst = (i == model->layerCount - 1) ? output : arena[i & 1];
+        switch (L->hdr->type) {
+            case NN_LAYER_DENSE:  run_dense(L, src, dst); break;
+            case NN_LAYER_CONV1D: run_conv1d(L, src, dst); break;
+            case NN_LAYER_RELU:   run_relu(L, src, dst); break;
+        }
+        src = dst;
+    }
+    return true;
+}
+
+float nn_reconstruction_error(const NnModel_t* model, const float* input,
+                              float* perChannel, NnStats_t* stats) {
+    if (!model || !model->loaded) return 0.0f;
+
+    const NnModelHeader_t* hdr = model->hdr;
+    const NnLayerHeader_t* last = model->layers[model->layerCount - 1].hdr;
+    int n = hdr->inLength * hdr->inChannels;
+    static int8_t qin[NN_ARENA_BYTES / 2];
+    static int8_t qout[NN_ARENA_BYTES / 2];
+
+    unsigned long t0 = micros();
+
+    float invScale = 1.0f / hdr->inScale;
+    for (int i = 0; i < n; i++) {
+        qin[i] = clamp_s8((int32_t)lroundf(input[i] * invScale) + hdr->inZero);
+    }
+    nn_run(model, qin, qout);
+
+    if (perChannel) {
+        for (int c = 0; c < hdr->inChannels; c++) perChannel[c] = 0.0f;
+    }
+    float total = 0.0f;
+    for (int i = 0; i < n; i++) {
+        float recon = last->outScale * (float)(qout[i] - last->outZero);
+        float d = recon - input[i];
+        total += d * d;
+        if (perChannel) perChannel[i % hdr->inChannels] += d * d;
+    }
+    if (perChannel) {
+        for (int c = 0; c < hdr->inChannels; c++) perChannel[c] /= hdr->inLength;
+    }
+
+    if (stats) {
+        uint32_t us = (uint32_t)(micros() - t0);
+        stats->lastUs = us;
+        stats->avgUs = (stats->inferences == 0) ? (float)us : 0.9f * stats->avgUs + 0.1f * (float)us;
+        stats->inferencesPerSec = (stats->avgUs > 0.0f) ? 1.0e6f / stats->avgUs : 0.0f;
+        stats->inferences++;
+    }
+    return total / n;
+}
@@ -0,0 +1,92 @@
+// SIGNALTAP Int8 Inference Runtime
+// Minimal quantized runtime for small dense / 1-D conv autoencoders.
+// Models are flat blobs (see tools/nn_export.py) parsed in place, so a
+// const array in flash is used directly without copying to RAM.
+#ifndef NN_INT8_H
+#define NN_INT8_H
+
+#include <Arduino.h>
+
+// ============ Limits ============
+#define NN_MAGIC          0x4E4E5453u   // "STNN"
+#define NN_VERSION        1
+#define NN_MAX_LAYERS     8
+#define NN_ARENA_BYTES    2048          // Two ping-pong activation buffers
+
+// ============ Blob Format (little-endian, 4-byte aligned) ============
+typedef enum {
+    NN_LAYER_DENSE = 0,     // Flattened input -> outChannels
+    NN_LAYER_CONV1D,        // [len][inCh] -> [outLen][outCh]
+    NN_LAYER_RELU           // Elementwise max(x, zero point)
+} NnLayerType_t;
+
+#define NN_FLAG_FUSED_RELU  0x01
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t layerCount;
+    uint16_t inLength;      // Time steps
+    uint16_t inChannels;    // Values per time step
+    float inScale;          // Input quantization: real = scale * (q - zero)
+    int32_t inZero;
+    float errThreshold;     // Per-channel MSE considered anomalous
+    uint32_t totalBytes;
+} NnModelHeader_t;
+
+typedef struct {
+    uint8_t type;           // NnLayerType_t
+    uint8_t flags;
+    uint16_t outChannels;
+    uint16_t inChannels;    // Dense: flattened input size
+    uint16_t kernel;
+    uint16_t stride;
+    uint16_t padding;       // Conv1d: zero padding on each side
+    float outScale;
+    int32_t outZero;
+    uint32_t payloadBytes;  // int8 weights[oc][k][ic] (4-aligned), int32 bias/mult/shift[oc]
+} NnLayerHeader_t;
+
+// ============ Runtime Types ============
+typedef struct {
+    const NnLayerHeader_t* hdr;
+    const int8_t* weights;
+    const int32_t* bias;    // Pre-folded with -inZero * sum(weights)
+    const int32_t* mult;    // Per-channel Q31 requantization multiplier
+    const int32_t* shift;   // Per-channel exponent (>0 left, <0 right)
+    uint16_t inLen;         // Resolved input shape
+    uint16_t inCh;
+    uint16_t outLen;        // Resolved output shape
+    uint16_t outCh;
+    int32_t inZero;
+} NnLayer_t;
+
+typedef struct {
+    const NnModelHeader_t* hdr;
+    NnLayer_t layers[NN_MAX_LAYERS];
+    uint8_t layerCount;
+    uint16_t outSize;
+    bool loaded;
+} NnModel_t;
+
+typedef struct {
+    uint32_t inferences;
+    uint32_t lastUs;            // Latency of the most recent window
+    float avgUs;                // EWMA latency per window
+    float inferencesPerSec;     // 1e6 / avgUs
+} NnStats_t;
+
+// ============ Public API ============
+
+// Validate and index a model blob in place; blob must outlive the model
+bool nn_load(NnModel_t* model, const uint8_t* blob, size_t len);
+
+// Run one window; input has inLength*inChannels values, output outSize values
+bool nn_run(const NnModel_t* model, const int8_t* input, int8_t* output);
+
+// Quantize a float window, run the model and return the reconstruction MSE.
+// perChannel (optional, inChannels entries) receives the MSE per channel.
+float nn_reconstruction_error(const NnModel_t* model, const float* input,
+                              float* perChannel, NnStats_t* stats);
+
+#endif // NN_INT8_H
@@ -0,0 +1,167 @@
+// SIGNALTAP Remaining-Useful-Life Estimator Implementation
+// Linear and exponential degradation models fitted with exponentially
+// weighted RLS. Each update is a handful of multiply-adds per model.
+#include "rul_estimator.h"
+#include <math.h>
+#include <string.h>
+#include <stdio.h>
+
+// ============ Helper: Standard normal CDF ============
+static float normal_cdf(float x) {
+    return 0.5f * (1.0f + erff(x * 0.70710678f));
+}
+
+// ============ RLS Core ============
+static void rls_reset(RulRls_t* r, float z0) {
+    r->theta[0] = z0;
+    r->theta[1] = 0.0f;
+    r->P[0][0] = RUL_P_INIT; r->P[0][1] = 0.0f;
+    r->P[1][0] = 0.0f;       r->P[1][1] = RUL_P_INIT;
+    r->errVar = 0.0f;
+    r->selErr = 0.0f;
+}
+
+// Returns the a-priori residual (before the update)
+static float rls_update(RulRls_t* r, float tau, float z) {
+    const float lambda = RUL_FORGETTING;
+
+    // P*x with x = [1, tau]
+    float px0 = r->P[0][0] + r->P[0][1] * tau;
+    float px1 = r->P[1][0] + r->P[1][1] * tau;
+    float denom = lambda + px0 + px1 * tau;
+    float k0 = px0 / denom;
+    float k1 = px1 / denom;
+
+    float err = z - (r->theta[0] + r->theta[1] * tau);
+    r->theta[0] += k0 * err;
+    r->theta[1] += k1 * err;
+
+    // P = (P - k*x'P) / lambda; skip the division if covariance is winding up
+    float p00 = r->P[0][0] - k0 * px0;
+    float p01 = r->P[0][1] - k0 * px1;
+    float p11 = r->P[1][1] - k1 * px1;
+    float inv = (p00 + p11 < 1.0e6f) ? (1.0f / lambda) : 1.0f;
+    r->P[0][0] = p00 * inv;
+    r->P[0][1] = p01 * inv;
+    r->P[1][0] = p01 * inv;
+    r->P[1][1] = p11 * inv;
+
+    r->errVar = lambda * r->errVar + (1.0f - lambda) * err * err;
+    return err;
+}
+
+// Move tau origin forward by s seconds without changing the fitted line
+static void rls_shift(RulRls_t* r, float s) {
+    r->theta[0] += r->theta[1] * s;
+    float p00 = r->P[0][0] + 2.0f * s * r->P[0][1] + s * s * r->P[1][1];
+    float p01 = r->P[0][1] + s * r->P[1][1];
+    r->P[0][0] = p00;
+    r->P[0][1] = p01;
+    r->P[1][0] = p01;
+}
+
+static float exp_space(float degradation) {
+    return logf(degradation > 1.0f ? degradation : 1.0f);
+}
+
+// ============ Public API ============
+void rul_init(RulEstimator_t* est, float threshold) {
+    memset(est, 0, sizeof(*est));
+    est->threshold = threshold;
+    rls_reset(&est->linear, 0.0f);
+    rls_reset(&est->expo, 0.0f);
+}
+
+void rul_update(RulEstimator_t* est, float t, float degradation) {
+    if (est->samples == 0) {
+        est->origin = t;
+        rls_reset(&est->linear, degradation);
+        rls_reset(&est->expo, exp_space(degradation));
+    } else if (t - est->origin > RUL_RECENTER_S) {
+        float s = t - est->origin;
+        rls_shift(&est->linear, s);
+        rls_shift(&est->expo, s);
+        est->origin = t;
+    }
+
+    float tau = t - est->origin;
+    const float lambda = RUL_FORGETTING;
+
+    // Model selection error is tracked in degradation units for both models
+    float eLin = rls_update(&est->linear, tau, degradation);
+    est->linear.selErr = lambda * est->linear.selErr + (1.0f - lambda) * eLin * eLin;
+
+    float expPred = expf(est->expo.theta[0] + est->expo.theta[1] * tau);
+    float eExp = degradation - expPred;
+    rls_update(&est->expo, tau, exp_space(degradation));
+    est->expo.selErr = lambda * est->expo.selErr + (1.0f - lambda) * eExp * eExp;
+
+    est->lastTime = t;
+    est->lastValue = degradation;
+    est->samples++;
+}
+
+bool rul_predict(const RulEstimator_t* est, float horizonS, RulPrediction_t* out) {
+    if (!est || !out || est->samples < RUL_MIN_SAMPLES) return false;
+
+    bool useExp = est->expo.selErr < est->linear.selErr;
+    const RulRls_t* r = useExp ? &est->expo : &est->linear;
+    out->model = useExp ? RUL_MODEL_EXPONENTIAL : RUL_MODEL_LINEAR;
+
+    float tau = est->lastTime - est->origin;
+    float zThr = useExp ? exp_space(est->threshold) : est->threshold;
+    float zNow = r->theta[0] + r->theta[1] * tau;
+    float slope = r->theta[1];
+    float slopeVar = r->errVar * r->P[1][1];
+    float slopeSd = sqrtf(slopeVar > 1.0e-12f ? slopeVar : 1.0e-12f);
+
+    if (zNow >= zThr || est->lastValue >= est->threshold) {
+        out->degrading = true;
+        out->ttt = out->tttLow = out->tttHigh = 0.0f;
+        out->failureProb = 100.0f;
+        out->confidence = 99;
+        return true;
+    }
+
+    float gap = zThr - zNow;
+    float slopeHi = slope + RUL_Z_CONFIDENCE * slopeSd;
+    float slopeLo = slope - RUL_Z_CONFIDENCE * slopeSd;
+
+    out->degrading = slope > 0.0f;
+    out->ttt = out->degrading ? gap / slope : INFINITY;
+    out->tttLow = (slopeHi > 0.0f) ? gap / slopeHi : INFINITY;
+    out->tttHigh = (slopeLo > 0.0f) ? gap / slopeLo : INFINITY;
+
+    // P(true slope is steep enough to reach the threshold within the horizon)
+    float slopeReq = gap / (horizonS > 1.0f ? horizonS : 1.0f);
+    out->failureProb = 100.0f * normal_cdf((slope - slopeReq) / slopeSd);
+
+    float conf;
+    if (out->degrading) {
+        float spread = isinf(out->tttHigh) ? 1.0f : (out->tttHigh - out->tttLow) / out->ttt;
+        if (spread > 1.0f) spread = 1.0f;
+        conf = 99.0f - 59.0f * spread;
+    } else {
+        conf = 100.0f - out->failureProb;
+    }
+    if (conf < 40.0f) conf = 40.0f;
+    if (conf > 99.0f) conf = 99.0f;
+    out->confidence = (uint8_t)conf;
+    return true;
+}
+
+void rul_format_duration(float seconds, char* buf, size_t len) {
+    if (isinf(seconds) || isnan(seconds)) {
+        snprintf(buf, len, "stable");
+    } else if (seconds < 1.0f) {
+        snprintf(buf, len, "immediate");
+    } else if (seconds < 90.0f) {
+        snprintf(buf, len, "%d s", (int)seconds);
+    } else if (seconds < 90.0f * 60.0f) {
+        snprintf(buf, len, "%d min", (int)(seconds / 60.0f + 0.5f));
+    } else if (seconds < 36.0f * 3600.0f) {
+        snprintf(buf, len, "%d hours", (int)(seconds / 3600.0f + 0.5f));
+    } else {
+        snprintf(buf, len, "%d days", (int)(seconds / 86400.0f + 0.5f));
+    }
+}
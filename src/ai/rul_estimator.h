@@ -0,0 +1,64 @@
+// SIGNALTAP Remaining-Useful-Life Estimator
+// Online degradation-trend tracking with recursive least squares (RLS)
+#ifndef RUL_ESTIMATOR_H
+#define RUL_ESTIMATOR_H
+
+#include <Arduino.h>
+
+// ============ Tuning ============
+#define RUL_FORGETTING        0.95f   // RLS forgetting factor (~20 sample memory)
+#define RUL_MIN_SAMPLES       8       // Samples before predictions are trusted
+#define RUL_RECENTER_S        600.0f  // Shift time origin after this many seconds
+#define RUL_P_INIT            1000.0f // Initial covariance diagonal
+#define RUL_Z_CONFIDENCE      1.645f  // One-sided 95% bound on the slope
+
+// ============ Model Types ============
+typedef enum {
+    RUL_MODEL_LINEAR = 0,   // D(t) = a + b*t
+    RUL_MODEL_EXPONENTIAL   // D(t) = exp(a + b*t)
+} RulModel_t;
+
+// Two-parameter RLS fit of z = a + b*tau
+typedef struct {
+    float theta[2];   // [intercept, slope per second]
+    float P[2][2];    // Inverse information matrix
+    float errVar;     // EWMA of a-priori residual^2 in model space
+    float selErr;     // EWMA of a-priori residual^2 in degradation units
+} RulRls_t;
+
+// Per-machine estimator state (fixed size, no allocation)
+typedef struct {
+    RulRls_t linear;
+    RulRls_t expo;
+    float threshold;  // Degradation level that counts as failure
+    float origin;     // Time origin for tau (seconds)
+    float lastTime;   // Time of the most recent sample
+    float lastValue;  // Most recent degradation sample
+    uint32_t samples;
+} RulEstimator_t;
+
+typedef struct {
+    RulModel_t model;     // Model with the lower recent prediction error
+    bool degrading;       // Trend is heading toward the threshold
+    float ttt;            // Predicted time-to-threshold (s), INFINITY if not degrading
+    float tttLow;         // Early bound (s)
+    float tttHigh;        // Late bound (s), INFINITY if unbounded
+    float failureProb;    // 0-100% chance of crossing within the horizon
+    uint8_t confidence;   // 0-100% confidence in the prediction
+} RulPrediction_t;
+
+// ============ Public API ============
+
+// threshold: degradation value at which the machine is considered failed
+void rul_init(RulEstimator_t* est, float threshold);
+
+// O(1) update with one degradation sample (higher = worse) at time t (seconds)
+void rul_update(RulEstimator_t* est, float t, float degradation);
+
+// Evaluate both models at the latest sample; returns false during warm-up
+bool rul_predict(const RulEstimator_t* est, float horizonS, RulPrediction_t* out);
+
+// Human-readable duration for insight timeframes ("45 s", "12 min", "3 days")
+void rul_format_duration(float seconds, char* buf, size_t len);
+
+#endif // RUL_ESTIMATOR_H
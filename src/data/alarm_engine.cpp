@@ -0,0 +1,326 @@
+// SIGNALTAP Alarm Engine Implementation
+#include "alarm_engine.h"
+#include <stdio.h>
+#include <string.h>
+
+// ============ Message Table ============
+typedef struct {
+    uint8_t severity;       // AlarmSeverity_t
+    const char* message;
+} AlarmDef_t;
+
+static const AlarmDef_t alarmDefs[ALARM_CODE_COUNT] = {
+    {ALARM_SEV_INFO,    ""},
+
+    {ALARM_SEV_INFO,    "Spindle load trending upward"},
+    {ALARM_SEV_WARNING, "Coolant flow below optimal range"},
+    {ALARM_SEV_WARNING, "Spindle load above 80% threshold"},
+    {ALARM_SEV_ERROR,   "Coolant level critically low"},
+    {ALARM_SEV_ERROR,   "FAULT: Spindle overload protection tripped"},
+    {ALARM_SEV_INFO,    "System recovery in progress"},
+
+    {ALARM_SEV_WARNING, "Supply temperature rising above setpoint"},
+    {ALARM_SEV_WARNING, "Compressor power consumption elevated"},
+    {ALARM_SEV_WARNING, "High discharge pressure detected"},
+    {ALARM_SEV_ERROR,   "E07: High discharge pressure - compressor tripped"},
+    {ALARM_SEV_INFO,    "Chiller recovery - compressor restarting"},
+
+    {ALARM_SEV_WARNING, "Oil temperature trending above normal"},
+    {ALARM_SEV_INFO,    "Tank pressure below optimal - check for leaks"},
+    {ALARM_SEV_WARNING, "Oil temp approaching high limit (100C)"},
+    {ALARM_SEV_ERROR,   "Tank pressure critically low"},
+    {ALARM_SEV_ERROR,   "THERMAL SHUTDOWN: Oil temperature exceeded limit"},
+    {ALARM_SEV_INFO,    "Compressor cooling down - restart in progress"},
+
+    {ALARM_SEV_WARNING, "Chamber temperature drifting above setpoint"},
+    {ALARM_SEV_WARNING, "Chamber temp approaching safety limit"},
+    {ALARM_SEV_ERROR,   "Pressure spike detected - process deviation"},
+    {ALARM_SEV_ERROR,   "SAFETY SHUTDOWN: Chamber overtemperature"},
+    {ALARM_SEV_INFO,    "Process restarting - chamber cooling"},
+
+    {ALARM_SEV_INFO,    "Firmware update started - downloading v1.1.0"},
+    {ALARM_SEV_INFO,    "Firmware update completed successfully (v1.1.0)"},
+    {ALARM_SEV_WARNING, "Fieldbus values stale - sensors are simulated"},
+};
+
+const char* alarm_message(AlarmCode_t code) {
+    return code < ALARM_CODE_COUNT ? alarmDefs[code].message : "";
+}
+
+AlarmSeverity_t alarm_severity(AlarmCode_t code) {
+    return code < ALARM_CODE_COUNT ? (AlarmSeverity_t)alarmDefs[code].severity : ALARM_SEV_INFO;
+}
+
+const char* alarm_severity_name(AlarmSeverity_t sev) {
+    switch (sev) {
+        case ALARM_SEV_ERROR:   return "error";
+        case ALARM_SEV_WARNING: return "warning";
+        default:                return "info";
+    }
+}
+
+void alarm_format_time(uint32_t s, char* buf, size_t len) {
+    snprintf(buf, len, "%02u:%02u:%02u",
+             (unsigned)((s / 3600) % 24), (unsigned)((s / 60) % 60), (unsigned)(s % 60));
+}
+
+// ============ Helper: Eviction priority ============
+// Lower sorts first: acked before unacked, then by severity, then oldest
+static uint32_t evict_rank(const AlarmEntry_t* e) {
+    uint32_t unacked = (e->flags & ALARM_FLAG_ACKED) ? 0 : 1;
+    return (unacked << 2) | alarmDefs[e->code].severity;
+}
+
+// ============ Helper: Log record of a sequence number ============
+static AlarmRecord_t* log_record(const AlarmTable_t* t, uint32_t seq) {
+    if (!t->log || seq >= t->logWritten || t->logWritten - seq > t->logLen) return NULL;
+    return &t->log[seq % t->logLen];
+}
+
+// ============ Helper: Remove entry, keeping the array dense ============
+static void remove_at(AlarmTable_t* t, uint8_t index, uint32_t now) {
+    AlarmRecord_t* rec = log_record(t, t->entries[index].logSeq);
+    if (rec) {
+        rec->flags |= ALARM_REC_CLEARED;
+        rec->clearedAt = now;
+    }
+    t->slotOf[t->entries[index].code] = ALARM_NO_SLOT;
+    for (uint8_t i = index + 1; i < t->count; i++) {
+        t->entries[i - 1] = t->entries[i];
+        t->slotOf[t->entries[i - 1].code] = i - 1;
+    }
+    t->count--;
+    t->revision++;
+}
+
+// ============ Helper: Insert a new entry ============
+static bool insert_entry(AlarmTable_t* t, AlarmCode_t code, uint8_t flags, uint32_t now) {
+    if (t->count == ALARM_MAX_ACTIVE) {
+        // Entries are oldest first, so the first minimum is also the oldest
+        uint8_t victim = 0;
+        uint32_t rank = evict_rank(&t->entries[0]);
+        for (uint8_t i = 1; i < t->count; i++) {
+            uint32_t r = evict_rank(&t->entries[i]);
+            if (r < rank) {
+                rank = r;
+                victim = i;
+            }
+        }
+        // A new alarm never displaces a more severe unacknowledged one
+        if (rank > ((1u << 2) | alarmDefs[code].severity)) {
+            t->stats.dropped++;
+            return false;
+        }
+        t->codes[t->entries[victim].code].flags &= ~ALARM_CODE_CLEAR_PENDING;
+        remove_at(t, victim, now);
+        t->stats.evicted++;
+    }
+
+    AlarmEntry_t* e = &t->entries[t->count];
+    e->code = (uint8_t)code;
+    e->flags = flags;
+    e->reserved = 0;
+    e->raisedAt = now;
+    e->logSeq = t->logWritten;
+    if (t->log) {
+        AlarmRecord_t* rec = &t->log[t->logWritten % t->logLen];
+        rec->code = (uint8_t)code;
+        rec->flags = (flags & ALARM_FLAG_CHATTER) ? ALARM_REC_CHATTER : 0;
+        rec->reserved = 0;
+        rec->raisedAt = now;
+        rec->clearedAt = 0;
+        t->logWritten++;
+    }
+    t->slotOf[code] = t->count;
+    t->count++;
+    t->stats.raised++;
+    t->revision++;
+    return true;
+}
+
+// ============ Helper: Flood window ============
+static void flood_roll(AlarmTable_t* t, uint32_t now) {
+    if (now - t->floodWindowStart < ALARM_FLOOD_WINDOW_S) return;
+    // The flood lasts until a full window stays under the threshold
+    bool flood = t->floodAttempts >= ALARM_FLOOD_THRESHOLD;
+    if (flood != t->flood || flood) {
+        // Also refresh the held count once per window while flooding
+        t->flood = flood;
+        if (!flood) t->floodSuppressed = 0;
+        t->revision++;
+    }
+    t->floodAttempts = 0;
+    t->floodWindowStart = now;
+}
+
+// ============ Public API ============
+void alarm_table_init(AlarmTable_t* t, AlarmRecord_t* log, uint32_t logLen) {
+    memset(t, 0, sizeof(*t));
+    memset(t->slotOf, ALARM_NO_SLOT, sizeof(t->slotOf));
+    t->log = logLen ? log : NULL;
+    t->logLen = t->log ? logLen : 0;
+}
+
+void alarm_raise(AlarmTable_t* t, AlarmCode_t code, uint32_t now) {
+    if (code == ALARM_NONE || code >= ALARM_CODE_COUNT) return;
+    AlarmCodeState_t* cs = &t->codes[code];
+    cs->lastRequestAt = now;
+
+    if (t->slotOf[code] != ALARM_NO_SLOT) {
+        // Already active; a latched chattering alarm just cancels its clear
+        if (cs->flags & ALARM_CODE_CLEAR_PENDING) {
+            cs->flags &= ~ALARM_CODE_CLEAR_PENDING;
+            t->stats.chatterHeld++;
+        }
+        return;
+    }
+
+    if (cs->flags & ALARM_CODE_SHELVED) {
+        t->stats.shelvedHeld++;
+        return;
+    }
+    if ((cs->flags & ALARM_CODE_RAISED) && now - cs->lastRaisedAt < ALARM_RATE_LIMIT_S) {
+        t->stats.rateLimited++;
+        return;
+    }
+
+    flood_roll(t, now);
+    t->floodAttempts++;
+    if (!t->flood && t->floodAttempts >= ALARM_FLOOD_THRESHOLD) {
+        t->flood = true;
+        t->revision++;
+    }
+    if (t->flood && alarmDefs[code].severity < ALARM_SEV_ERROR) {
+        t->floodSuppressed++;
+        t->stats.floodHeld++;
+        return;
+    }
+
+    // Chatter: too many raises of one code inside the window
+    if (now - cs->chatterWindowStart >= ALARM_CHATTER_WINDOW_S) {
+        cs->chatterWindowStart = now;
+        cs->chatterCount = 0;
+    }
+    if (cs->chatterCount < 0xFF) cs->chatterCount++;
+    if (cs->chatterCount >= ALARM_CHATTER_COUNT) cs->flags |= ALARM_CODE_CHATTERING;
+
+    if (insert_entry(t, code, (cs->flags & ALARM_CODE_CHATTERING) ? ALARM_FLAG_CHATTER : 0, now)) {
+        cs->lastRaisedAt = now;
+        cs->flags |= ALARM_CODE_RAISED;
+    }
+}
+
+void alarm_clear(AlarmTable_t* t, AlarmCode_t code, uint32_t now) {
+    if (code >= ALARM_CODE_COUNT || t->slotOf[code] == ALARM_NO_SLOT) return;
+    AlarmCodeState_t* cs = &t->codes[code];
+    if (cs->flags & ALARM_CODE_CHATTERING) {
+        // Off-delay: stays latched until clear for ALARM_CHATTER_HOLD_S
+        if (!(cs->flags & ALARM_CODE_CLEAR_PENDING)) {
+            cs->flags |= ALARM_CODE_CLEAR_PENDING;
+            cs->clearRequestedAt = now;
+        }
+        return;
+    }
+    remove_at(t, t->slotOf[code], now);
+}
+
+void alarm_clear_severity(AlarmTable_t* t, AlarmSeverity_t sev, bool unackedOnly, uint32_t now) {
+    uint8_t i = 0;
+    while (i < t->count) {
+        const AlarmEntry_t* e = &t->entries[i];
+        uint8_t before = t->count;
+        if (alarmDefs[e->code].severity == sev &&
+            !(unackedOnly && (e->flags & ALARM_FLAG_ACKED))) {
+            alarm_clear(t, (AlarmCode_t)e->code, now);
+        }
+        if (t->count == before) i++;
+    }
+}
+
+void alarm_tick(AlarmTable_t* t, uint32_t now) {
+    flood_roll(t, now);
+
+    for (uint8_t c = 1; c < ALARM_CODE_COUNT; c++) {
+        AlarmCodeState_t* cs = &t->codes[c];
+        if ((cs->flags & ALARM_CODE_SHELVED) && (int32_t)(now - cs->shelvedUntil) >= 0) {
+            cs->flags &= ~ALARM_CODE_SHELVED;
+            t->revision++;
+        }
+        if (!(cs->flags & ALARM_CODE_CHATTERING)) continue;
+
+        if (cs->flags & ALARM_CODE_CLEAR_PENDING) {
+            if (now - cs->clearRequestedAt >= ALARM_CHATTER_HOLD_S) {
+                cs->flags &= ~(ALARM_CODE_CLEAR_PENDING | ALARM_CODE_CHATTERING);
+                cs->chatterCount = 0;
+                if (t->slotOf[c] != ALARM_NO_SLOT) remove_at(t, t->slotOf[c], now);
+            }
+        } else if (t->slotOf[c] == ALARM_NO_SLOT && now - cs->lastRequestAt >= ALARM_CHATTER_HOLD_S) {
+            // Evicted or shelved while chattering and quiet since
+            cs->flags &= ~ALARM_CODE_CHATTERING;
+            cs->chatterCount = 0;
+        }
+    }
+}
+
+void alarm_shelve(AlarmTable_t* t, AlarmCode_t code, uint32_t now, uint32_t durationS) {
+    if (code == ALARM_NONE || code >= ALARM_CODE_COUNT) return;
+    AlarmCodeState_t* cs = &t->codes[code];
+    cs->flags |= ALARM_CODE_SHELVED;
+    cs->flags &= ~ALARM_CODE_CLEAR_PENDING;
+    cs->shelvedUntil = now + durationS;
+    if (t->slotOf[code] != ALARM_NO_SLOT) remove_at(t, t->slotOf[code], now);
+    else t->revision++;
+}
+
+void alarm_unshelve(AlarmTable_t* t, AlarmCode_t code) {
+    if (code >= ALARM_CODE_COUNT || !(t->codes[code].flags & ALARM_CODE_SHELVED)) return;
+    t->codes[code].flags &= ~ALARM_CODE_SHELVED;
+    t->revision++;
+}
+
+uint8_t alarm_shelved_count(const AlarmTable_t* t) {
+    uint8_t n = 0;
+    for (uint8_t c = 1; c < ALARM_CODE_COUNT; c++) {
+        if (t->codes[c].flags & ALARM_CODE_SHELVED) n++;
+    }
+    return n;
+}
+
+bool alarm_is_active(const AlarmTable_t* t, AlarmCode_t code) {
+    return code < ALARM_CODE_COUNT && t->slotOf[code] != ALARM_NO_SLOT;
+}
+
+void alarm_ack(AlarmTable_t* t, AlarmCode_t code) {
+    if (code >= ALARM_CODE_COUNT || t->slotOf[code] == ALARM_NO_SLOT) return;
+    AlarmEntry_t* e = &t->entries[t->slotOf[code]];
+    if (e->flags & ALARM_FLAG_ACKED) return;
+    e->flags |= ALARM_FLAG_ACKED;
+    AlarmRecord_t* rec = log_record(t, e->logSeq);
+    if (rec) {
+        rec->flags |= ALARM_REC_ACKED;
+        t->logAcks++;
+    }
+    t->revision++;
+}
+
+// ============ Alarm Log ============
+uint32_t alarm_log_first_seq(const AlarmTable_t* t) {
+    return t->logWritten > t->logLen ? t->logWritten - t->logLen : 0;
+}
+
+const AlarmRecord_t* alarm_log_get(const AlarmTable_t* t, uint32_t seq) {
+    return log_record(t, seq);
+}
+
+void alarm_log_ack(AlarmTable_t* t, uint32_t seq) {
+    AlarmRecord_t* rec = log_record(t, seq);
+    if (!rec || (rec->flags & ALARM_REC_ACKED)) return;
+    if (!(rec->flags & ALARM_REC_CLEARED)) {
+        // Still active: ack the table entry too
+        alarm_ack(t, (AlarmCode_t)rec->code);
+        return;
+    }
+    rec->flags |= ALARM_REC_ACKED;
+    t->logAcks++;
+    t->revision++;
+}
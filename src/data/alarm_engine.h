@@ -0,0 +1,202 @@
+// SIGNALTAP Alarm Engine
+// Fixed-size active-alarm table keyed by numeric alarm codes. Messages and
+// severities live in a static table; raising, clearing and checking an
+// alarm are O(1) via a code->slot map, and the active alarms are kept as a
+// dense array (oldest first) so the UI can index them directly.
+//
+// Flood handling follows ISA-18.2: per-code re-raise rate limit, chatter
+// detection with an off-delay (a chattering alarm stays latched until it
+// has been clear for ALARM_CHATTER_HOLD_S), operator shelving, and a flood
+// mode that holds back non-error alarms into a summary count. A revision
+// counter lets the UI skip rebuilds when nothing visible changed.
+#ifndef ALARM_ENGINE_H
+#define ALARM_ENGINE_H
+
+#include <Arduino.h>
+
+// ============ Severities ============
+typedef enum {
+    ALARM_SEV_INFO = 0,
+    ALARM_SEV_WARNING,
+    ALARM_SEV_ERROR
+} AlarmSeverity_t;
+
+// ============ Alarm Codes ============
+typedef enum {
+    ALARM_NONE = 0,
+
+    // CNC Machine Shop
+    ALARM_CNC_SPINDLE_TREND,
+    ALARM_CNC_COOLANT_FLOW_LOW,
+    ALARM_CNC_SPINDLE_LOAD_HIGH,
+    ALARM_CNC_COOLANT_LEVEL_CRIT,
+    ALARM_CNC_SPINDLE_OVERLOAD,
+    ALARM_CNC_RECOVERY,
+
+    // Cold Storage Chiller
+    ALARM_CHL_SUPPLY_TEMP_RISING,
+    ALARM_CHL_POWER_ELEVATED,
+    ALARM_CHL_DISCHARGE_HIGH,
+    ALARM_CHL_COMPRESSOR_TRIP,
+    ALARM_CHL_RECOVERY,
+
+    // Compressed Air System
+    ALARM_CMP_OIL_TEMP_TREND,
+    ALARM_CMP_TANK_PRESSURE_LOW,
+    ALARM_CMP_OIL_TEMP_HIGH,
+    ALARM_CMP_TANK_PRESSURE_CRIT,
+    ALARM_CMP_THERMAL_SHUTDOWN,
+    ALARM_CMP_RECOVERY,
+
+    // Custom PLC Setup
+    ALARM_PLC_CHAMBER_TEMP_DRIFT,
+    ALARM_PLC_CHAMBER_TEMP_HIGH,
+    ALARM_PLC_PRESSURE_SPIKE,
+    ALARM_PLC_SAFETY_SHUTDOWN,
+    ALARM_PLC_RECOVERY,
+
+    // System
+    ALARM_SYS_OTA_STARTED,
+    ALARM_SYS_OTA_DONE,
+    ALARM_SYS_FIELDBUS_LOST,
+
+    ALARM_CODE_COUNT
+} AlarmCode_t;
+
+// ============ Active Alarm Table ============
+#define ALARM_MAX_ACTIVE    8
+#define ALARM_NO_SLOT       0xFF
+
+#define ALARM_FLAG_ACKED    0x01
+#define ALARM_FLAG_CHATTER  0x02    // Latched by the chatter filter
+
+// ============ Flood Handling ============
+// Demo scenarios run in compressed time, so the windows are shorter than
+// the 10 alarms / 10 min operator guideline they are modelled on.
+#define ALARM_RATE_LIMIT_S      10      // Min seconds between raises of one code
+#define ALARM_CHATTER_WINDOW_S  60
+#define ALARM_CHATTER_COUNT     3       // Raises per window that mark a code chattering
+#define ALARM_CHATTER_HOLD_S    30      // Clear time required to release a chattering code
+#define ALARM_FLOOD_WINDOW_S    60
+#define ALARM_FLOOD_THRESHOLD   10      // Raise attempts per window that start a flood
+#define ALARM_SHELVE_DEFAULT_S  600
+
+// Per-code filter state
+#define ALARM_CODE_RAISED       0x01    // lastRaisedAt is valid
+#define ALARM_CODE_CHATTERING   0x02
+#define ALARM_CODE_CLEAR_PENDING 0x04   // Clear requested while chattering
+#define ALARM_CODE_SHELVED      0x08
+
+typedef struct {
+    uint32_t lastRaisedAt;
+    uint32_t lastRequestAt;
+    uint32_t chatterWindowStart;
+    uint32_t clearRequestedAt;
+    uint32_t shelvedUntil;
+    uint8_t chatterCount;
+    uint8_t flags;              // ALARM_CODE_*
+} AlarmCodeState_t;
+
+typedef struct {
+    uint32_t raised;            // New alarms accepted
+    uint32_t evicted;           // Older/lower-priority alarms pushed out
+    uint32_t dropped;           // New alarms refused (table full of higher priority)
+    uint32_t rateLimited;
+    uint32_t chatterHeld;       // Raises absorbed by a latched chattering alarm
+    uint32_t shelvedHeld;
+    uint32_t floodHeld;
+} AlarmStats_t;
+
+typedef struct {
+    uint8_t code;           // AlarmCode_t
+    uint8_t flags;          // ALARM_FLAG_*
+    uint16_t reserved;
+    uint32_t raisedAt;      // Seconds since boot
+    uint32_t logSeq;        // This occurrence in the alarm log
+} AlarmEntry_t;
+
+// ============ Alarm Log ============
+// Every occurrence, newest overwriting oldest; records are addressed by a
+// monotonic sequence number so holders can tell when one has been recycled.
+#define ALARM_LOG_LEN       10240   // ~120 KB per machine (PSRAM)
+
+#define ALARM_REC_ACKED     0x01
+#define ALARM_REC_CLEARED   0x02
+#define ALARM_REC_CHATTER   0x04
+
+typedef struct {
+    uint8_t code;           // AlarmCode_t
+    uint8_t flags;          // ALARM_REC_*
+    uint16_t reserved;
+    uint32_t raisedAt;
+    uint32_t clearedAt;     // Valid with ALARM_REC_CLEARED
+} AlarmRecord_t;
+
+typedef struct {
+    AlarmEntry_t entries[ALARM_MAX_ACTIVE];     // Dense, oldest first
+    uint8_t slotOf[ALARM_CODE_COUNT];           // Code -> entry index (dedupe)
+    uint8_t count;
+    AlarmCodeState_t codes[ALARM_CODE_COUNT];
+
+    // Flood state
+    bool flood;
+    uint32_t floodWindowStart;
+    uint16_t floodAttempts;     // Raise attempts of new alarms this window
+    uint32_t floodSuppressed;   // Held back during the current flood
+
+    // Occurrence log (caller-provided storage, may be NULL)
+    AlarmRecord_t* log;
+    uint32_t logLen;
+    uint32_t logWritten;        // Next sequence number
+    uint32_t logAcks;           // Log records acked (records are only ever
+                                // added, acked or cleared; cleared ones are
+                                // exactly those no longer in entries[])
+
+    uint32_t revision;          // Bumped on every visible change
+    AlarmStats_t stats;
+} AlarmTable_t;
+
+// ============ Public API ============
+
+// log/logLen: storage for the occurrence log (NULL/0 to run without one)
+void alarm_table_init(AlarmTable_t* t, AlarmRecord_t* log, uint32_t logLen);
+
+// Raise (no-op if already active); may evict the lowest-priority oldest entry
+void alarm_raise(AlarmTable_t* t, AlarmCode_t code, uint32_t now);
+void alarm_clear(AlarmTable_t* t, AlarmCode_t code, uint32_t now);
+
+// Clear every entry of a severity, optionally only the unacknowledged ones
+void alarm_clear_severity(AlarmTable_t* t, AlarmSeverity_t sev, bool unackedOnly, uint32_t now);
+
+// Once per second: shelve expiry, chatter release, flood window roll
+void alarm_tick(AlarmTable_t* t, uint32_t now);
+
+// Hide an alarm (and hold its raises) for durationS
+void alarm_shelve(AlarmTable_t* t, AlarmCode_t code, uint32_t now, uint32_t durationS);
+void alarm_unshelve(AlarmTable_t* t, AlarmCode_t code);
+uint8_t alarm_shelved_count(const AlarmTable_t* t);
+
+bool alarm_is_active(const AlarmTable_t* t, AlarmCode_t code);
+void alarm_ack(AlarmTable_t* t, AlarmCode_t code);
+
+// Dense access: index 0 is the oldest active alarm
+static inline uint8_t alarm_count(const AlarmTable_t* t) { return t->count; }
+static inline const AlarmEntry_t* alarm_get(const AlarmTable_t* t, uint8_t index) {
+    return index < t->count ? &t->entries[index] : NULL;
+}
+
+// Static message table lookups
+const char* alarm_message(AlarmCode_t code);
+AlarmSeverity_t alarm_severity(AlarmCode_t code);
+const char* alarm_severity_name(AlarmSeverity_t sev);   // "error", "warning", "info"
+
+// Log access by sequence number; records older than logLen are gone (NULL)
+uint32_t alarm_log_first_seq(const AlarmTable_t* t);
+static inline uint32_t alarm_log_end_seq(const AlarmTable_t* t) { return t->logWritten; }
+const AlarmRecord_t* alarm_log_get(const AlarmTable_t* t, uint32_t seq);
+void alarm_log_ack(AlarmTable_t* t, uint32_t seq);
+
+// "HH:MM:SS" of a seconds-since-boot timestamp
+void alarm_format_time(uint32_t seconds, char* buf, size_t len);
+
+#endif // ALARM_ENGINE_H
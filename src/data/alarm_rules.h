@@ -0,0 +1,41 @@
+// SIGNALTAP Alarm Rules
+// Threshold rules for the four demo machines, compiled by rule_engine at
+// startup. Limits sit between the scenario phases each alarm belongs to,
+// so the alarms follow the sensor values rather than the scenario clock.
+#ifndef ALARM_RULES_H
+#define ALARM_RULES_H
+
+#include "rule_engine.h"
+
+//  machine, sensor, comparator, limit, hysteresis, on delay, off delay, code
+static const RuleDef_t alarmRules[] = {
+    // CNC Machine Shop: 0 spindle load %, 1 coolant L/min, 2 spindle RPM
+    {0, 0, RULE_ABOVE, 68.0f,  3.0f, 3, 5, ALARM_CNC_SPINDLE_TREND},
+    {0, 1, RULE_BELOW, 10.5f,  0.5f, 3, 5, ALARM_CNC_COOLANT_FLOW_LOW},
+    {0, 0, RULE_ABOVE, 81.0f,  3.0f, 2, 5, ALARM_CNC_SPINDLE_LOAD_HIGH},
+    {0, 1, RULE_BELOW,  7.5f,  0.5f, 2, 5, ALARM_CNC_COOLANT_LEVEL_CRIT},
+    {0, 0, RULE_ABOVE, 92.5f,  2.5f, 2, 3, ALARM_CNC_SPINDLE_OVERLOAD},
+
+    // Cold Storage Chiller: 0 compressor kW, 1 supply C, 2 return C
+    {1, 1, RULE_ABOVE,  3.3f,  0.5f, 3, 5, ALARM_CHL_SUPPLY_TEMP_RISING},
+    {1, 0, RULE_ABOVE, 33.0f,  2.0f, 3, 5, ALARM_CHL_POWER_ELEVATED},
+    {1, 0, RULE_ABOVE, 37.5f,  2.0f, 2, 5, ALARM_CHL_DISCHARGE_HIGH},
+    {1, 0, RULE_BELOW, 22.0f,  2.0f, 1, 3, ALARM_CHL_COMPRESSOR_TRIP},
+
+    // Compressed Air System: 0 tank bar, 1 oil C, 2 motor A
+    {2, 1, RULE_ABOVE, 84.0f,  3.0f, 3, 5, ALARM_CMP_OIL_TEMP_TREND},
+    {2, 0, RULE_BELOW,  7.0f,  0.3f, 3, 5, ALARM_CMP_TANK_PRESSURE_LOW},
+    {2, 1, RULE_ABOVE, 95.0f,  5.0f, 2, 5, ALARM_CMP_OIL_TEMP_HIGH},
+    {2, 0, RULE_BELOW,  5.8f,  0.3f, 2, 5, ALARM_CMP_TANK_PRESSURE_CRIT},
+    {2, 0, RULE_BELOW,  4.0f,  1.0f, 1, 3, ALARM_CMP_THERMAL_SHUTDOWN},
+
+    // Custom PLC Setup: 0 chamber C, 1 chamber mbar, 2 air bar
+    {3, 0, RULE_ABOVE, 100.0f, 5.0f, 3, 5, ALARM_PLC_CHAMBER_TEMP_DRIFT},
+    {3, 0, RULE_ABOVE, 118.0f, 5.0f, 2, 5, ALARM_PLC_CHAMBER_TEMP_HIGH},
+    {3, 1, RULE_ABOVE, 780.0f, 30.0f, 2, 5, ALARM_PLC_PRESSURE_SPIKE},
+    {3, 2, RULE_BELOW,  2.7f,  0.5f, 1, 3, ALARM_PLC_SAFETY_SHUTDOWN},
+};
+
+#define ALARM_RULE_COUNT (sizeof(alarmRules) / sizeof(alarmRules[0]))
+
+#endif // ALARM_RULES_H
@@ -30,6 +30,7 @@ typedef struct {
 typedef struct {
     uint8_t healthScore;        // 0-100 overall machine health
     uint8_t anomalyCount;       // Current anomalies detected
+    float anomalyScore;         // 0-100 autoencoder reconstruction score
     float failureProbability;   // 0-100% chance of failure in next 24h
     const char* nextMaintenance; // Predicted maintenance date
     const char* modelStatus;    // "Learning", "Ready", "Updating"
@@ -152,6 +153,7 @@ static DemoProfile_t demoProfiles[DEMO_COUNT] = {
         .ai = {
             .healthScore = 87,
             .anomalyCount = 1,
+            .anomalyScore = 0.0f,
             .failureProbability = 12.5f,
             .nextMaintenance = "Feb 18",
             .modelStatus = "Ready",
@@ -189,7 +191,7 @@ static DemoProfile_t demoProfiles[DEMO_COUNT] = {
             .type = VISION_CHILLER,
             .partCount = 0,
             .stackLight = "",
-            .leds = {false},
+            .leds = {false, false, false, false, false, false, false, false},
             .errorCode = "---",
             .pressure = 0,
             .oilTemp = 0,
@@ -201,6 +203,7 @@ static DemoProfile_t demoProfiles[DEMO_COUNT] = {
         .ai = {
             .healthScore = 72,
             .anomalyCount = 2,
+            .anomalyScore = 0.0f,
             .failureProbability = 28.3f,
             .nextMaintenance = "Feb 15",
             .modelStatus = "Ready",
@@ -238,7 +241,7 @@ static DemoProfile_t demoProfiles[DEMO_COUNT] = {
             .type = VISION_COMPRESSOR,
             .partCount = 0,
             .stackLight = "",
-            .leds = {false},
+            .leds = {false, false, false, false, false, false, false, false},
             .errorCode = "",
             .pressure = 8.2f,
             .oilTemp = 78.0f,
@@ -250,6 +253,7 @@ static DemoProfile_t demoProfiles[DEMO_COUNT] = {
         .ai = {
             .healthScore = 94,
             .anomalyCount = 0,
+            .anomalyScore = 0.0f,
             .failureProbability = 3.2f,
             .nextMaintenance = "Mar 05",
             .modelStatus = "Ready",
@@ -287,7 +291,7 @@ static DemoProfile_t demoProfiles[DEMO_COUNT] = {
             .type = VISION_CUSTOM,
             .partCount = 0,
             .stackLight = "",
-            .leds = {false},
+            .leds = {false, false, false, false, false, false, false, false},
             .errorCode = "",
             .pressure = 0,
             .oilTemp = 0,
@@ -299,6 +303,7 @@ static DemoProfile_t demoProfiles[DEMO_COUNT] = {
         .ai = {
             .healthScore = 91,
             .anomalyCount = 1,
+            .anomalyScore = 0.0f,
             .failureProbability = 8.7f,
             .nextMaintenance = "Feb 22",
             .modelStatus = "Learning",
@@ -0,0 +1,153 @@
+// SIGNALTAP Trend Downsampling Implementation
+#include "downsample.h"
+#include <math.h>
+
+// ============ Helper: Sample access ============
+static inline float ds_at(const DsSeries_t* s, uint32_t i) {
+    uint32_t idx = s->start + i;
+    if (idx >= s->cap) idx -= s->cap;
+    return s->data[idx];
+}
+
+void ds_series_array(DsSeries_t* s, const float* data, uint32_t len) {
+    s->data = data;
+    s->cap = len;
+    s->start = 0;
+    s->len = len;
+}
+
+void ds_series_ring(DsSeries_t* s, const float* data, uint32_t cap,
+                    uint32_t head, uint32_t count) {
+    if (count > cap) count = cap;
+    s->data = data;
+    s->cap = cap;
+    s->start = (head + cap - count) % (cap ? cap : 1);
+    s->len = count;
+}
+
+// ============ Largest-Triangle-Three-Buckets ============
+uint32_t ds_lttb(const DsSeries_t* s, DsPoint_t* out, uint32_t maxOut) {
+    uint32_t n = s->len;
+    if (n == 0 || maxOut == 0) return 0;
+
+    if (n <= maxOut || maxOut < 3) {
+        // Nothing to reduce (or too few slots for a middle bucket): first/last only
+        if (n <= maxOut) {
+            for (uint32_t i = 0; i < n; i++) {
+                out[i].x = (float)i;
+                out[i].y = ds_at(s, i);
+            }
+            return n;
+        }
+        out[0].x = 0;
+        out[0].y = ds_at(s, 0);
+        if (maxOut == 1) return 1;
+        out[1].x = (float)(n - 1);
+        out[1].y = ds_at(s, n - 1);
+        return 2;
+    }
+
+    // First and last points are fixed; n - 2 samples go into maxOut - 2 buckets
+    double every = (double)(n - 2) / (double)(maxOut - 2);
+    uint32_t a = 0;
+    float ay = ds_at(s, 0);
+    uint32_t outCount = 0;
+    out[outCount].x = 0;
+    out[outCount].y = ay;
+    outCount++;
+
+    uint32_t rangeStart = 1;
+    for (uint32_t b = 0; b < maxOut - 2; b++) {
+        uint32_t rangeEnd = (uint32_t)((b + 1) * every) + 1;
+        if (rangeEnd > n - 1) rangeEnd = n - 1;
+
+        // Average of the next bucket (or the last point) is the third vertex
+        uint32_t nextStart = rangeEnd;
+        uint32_t nextEnd = (uint32_t)((b + 2) * every) + 1;
+        if (nextEnd > n) nextEnd = n;
+        if (nextStart >= nextEnd) nextStart = nextEnd - 1;
+        float sumY = 0;
+        for (uint32_t j = nextStart; j < nextEnd; j++) sumY += ds_at(s, j);
+        float avgX = 0.5f * (float)(nextStart + nextEnd - 1);
+        float avgY = sumY / (float)(nextEnd - nextStart);
+
+        // Point in this bucket forming the largest triangle with a and the average
+        float ax = (float)a;
+        float bestArea = -1.0f;
+        uint32_t best = rangeStart;
+        float bestY = ds_at(s, rangeStart);
+        for (uint32_t j = rangeStart; j < rangeEnd; j++) {
+            float y = ds_at(s, j);
+            float area = fabsf((ax - avgX) * (y - ay) - (ax - (float)j) * (avgY - ay));
+            if (area > bestArea) {
+                bestArea = area;
+                best = j;
+                bestY = y;
+            }
+        }
+
+        out[outCount].x = (float)best;
+        out[outCount].y = bestY;
+        outCount++;
+        a = best;
+        ay = bestY;
+        rangeStart = rangeEnd;
+    }
+
+    out[outCount].x = (float)(n - 1);
+    out[outCount].y = ds_at(s, n - 1);
+    return outCount + 1;
+}
+
+// ============ Per-Column Min/Max Envelope ============
+uint16_t ds_minmax(const DsSeries_t* s, DsColumn_t* out, uint16_t columns) {
+    uint32_t n = s->len;
+    if (n == 0 || columns == 0) return 0;
+    if (columns > n) columns = (uint16_t)n;
+
+    uint32_t idx = s->start;
+    uint32_t i = 0;
+    for (uint16_t c = 0; c < columns; c++) {
+        uint32_t end = (uint32_t)(((uint64_t)(c + 1) * n) / columns);
+        float v = s->data[idx];
+        DsColumn_t col = {v, v, i, i};
+        for (; i < end; i++) {
+            v = s->data[idx];
+            if (v < col.min) { col.min = v; col.minIndex = i; }
+            if (v > col.max) { col.max = v; col.maxIndex = i; }
+            if (++idx == s->cap) idx = 0;
+        }
+        out[c] = col;
+    }
+    return columns;
+}
+
+uint32_t ds_minmax_points(const DsSeries_t* s, DsPoint_t* out, DsColumn_t* cols,
+                          uint16_t columns, float width) {
+    uint32_t n = s->len;
+    if (n == 0 || columns == 0) return 0;
+    if (columns > n) columns = (uint16_t)n;
+
+    columns = ds_minmax(s, cols, columns);
+
+    float xScale = n > 1 ? width / (float)(n - 1) : 0.0f;
+    uint32_t count = 0;
+    for (uint16_t c = 0; c < columns; c++) {
+        const DsColumn_t& col = cols[c];
+        uint32_t first = col.minIndex, last = col.maxIndex;
+        float firstY = col.min, lastY = col.max;
+        if (first > last) {
+            first = col.maxIndex; firstY = col.max;
+            last = col.minIndex;  lastY = col.min;
+        }
+        out[count].x = first * xScale;
+        out[count].y = firstY;
+        count++;
+        if (last != first) {
+            out[count].x = last * xScale;
+            out[count].y = lastY;
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,53 @@
+// SIGNALTAP Trend Downsampling
+// Reduces a sample series to what a chart widget can actually show, so
+// render cost follows pixel width instead of history length.
+//  - LTTB (Largest-Triangle-Three-Buckets) keeps the visual line shape
+//  - Per-column min/max envelope keeps every spike visible
+#ifndef DOWNSAMPLE_H
+#define DOWNSAMPLE_H
+
+#include <Arduino.h>
+
+// ============ Input Series ============
+// Contiguous array or ring buffer: sample i is data[(start + i) % cap]
+typedef struct {
+    const float* data;
+    uint32_t cap;
+    uint32_t start;
+    uint32_t len;
+} DsSeries_t;
+
+typedef struct {
+    float x;        // Sample index in the input series
+    float y;
+} DsPoint_t;
+
+typedef struct {
+    float min;
+    float max;
+    uint32_t minIndex;
+    uint32_t maxIndex;
+} DsColumn_t;
+
+// ============ Public API ============
+
+// Describe a flat array / a ring buffer holding count samples ending before head
+void ds_series_array(DsSeries_t* s, const float* data, uint32_t len);
+void ds_series_ring(DsSeries_t* s, const float* data, uint32_t cap,
+                    uint32_t head, uint32_t count);
+
+// Pick at most maxOut representative points (first and last always kept).
+// Inputs that already fit are copied through. Returns the point count.
+uint32_t ds_lttb(const DsSeries_t* s, DsPoint_t* out, uint32_t maxOut);
+
+// Min/max of each of `columns` equal slices of the series.
+// Returns the number of columns filled (<= len).
+uint16_t ds_minmax(const DsSeries_t* s, DsColumn_t* out, uint16_t columns);
+
+// Envelope as a polyline for line widgets: per column, its min and max in
+// time order, x spread over [0, width]. Needs room for 2 * columns points
+// in out, and `columns` columns of scratch in cols.
+uint32_t ds_minmax_points(const DsSeries_t* s, DsPoint_t* out, DsColumn_t* cols,
+                          uint16_t columns, float width);
+
+#endif // DOWNSAMPLE_H
@@ -0,0 +1,194 @@
+// SIGNALTAP Compressed History Block Implementation
+#include "history_block.h"
+#include <string.h>
+
+// ============ Helper: Chunk addressing ============
+static inline uint16_t slot_of(const HistoryBlock_t* b, uint16_t logical) {
+    uint32_t slot = (uint32_t)b->head + logical;
+    if (slot >= HBLOCK_CHUNKS) slot -= HBLOCK_CHUNKS;
+    return (uint16_t)slot;
+}
+
+static inline uint8_t* chunk_data(const HistoryBlock_t* b, uint16_t slot) {
+    return b->data + (uint32_t)slot * HBLOCK_CHUNK_BYTES;
+}
+
+// ============ Helper: Start a new chunk (restart point) ============
+static void open_chunk(HistoryBlock_t* b) {
+    if (b->count == HBLOCK_CHUNKS) {
+        // Recycle the oldest chunk
+        b->samples -= b->index[b->head].count;
+        b->head = slot_of(b, 1);
+        b->count--;
+    }
+    uint16_t slot = slot_of(b, b->count);
+    b->count++;
+    memset(&b->index[slot], 0, sizeof(HBlockChunk_t));
+    gorilla_reset(&b->codec, HBLOCK_SERIES);
+    bitw_init(&b->writer, chunk_data(b, slot), HBLOCK_CHUNK_BYTES);
+}
+
+// ============ Init ============
+bool hblock_init(HistoryBlock_t* b) {
+    memset(b, 0, sizeof(*b));
+    b->data = (uint8_t*)ps_malloc((size_t)HBLOCK_CHUNKS * HBLOCK_CHUNK_BYTES);
+    b->index = (HBlockChunk_t*)ps_malloc(HBLOCK_CHUNKS * sizeof(HBlockChunk_t));
+    if (!b->data || !b->index) {
+        free(b->data);
+        free(b->index);
+        b->data = NULL;
+        b->index = NULL;
+        return false;
+    }
+    b->ready = true;
+    return true;
+}
+
+void hblock_clear(HistoryBlock_t* b) {
+    b->head = 0;
+    b->count = 0;
+    b->samples = 0;
+    b->decodeUs = 0;
+    memset(&b->stats, 0, sizeof(b->stats));
+}
+
+// ============ Append ============
+void hblock_append(HistoryBlock_t* b, uint32_t t, const float* values) {
+    if (!b->ready) return;
+    if (b->count == 0) open_chunk(b);
+
+    uint16_t slot = slot_of(b, b->count - 1);
+    if (b->index[slot].count > 0 && t < b->index[slot].endTime) return;  // Out of order
+
+    if (!gorilla_encode(&b->codec, &b->writer, t, values)) {
+        open_chunk(b);
+        slot = slot_of(b, b->count - 1);
+        gorilla_encode(&b->codec, &b->writer, t, values);
+    }
+
+    HBlockChunk_t* c = &b->index[slot];
+    if (c->count == 0) c->startTime = t;
+    c->endTime = t;
+    c->count++;
+    c->bytes = (uint16_t)bitw_bytes(&b->writer);
+    b->samples++;
+}
+
+// ============ Readers ============
+bool hblock_time_range(const HistoryBlock_t* b, uint32_t* oldest, uint32_t* newest) {
+    if (!b->ready || b->samples == 0) return false;
+    *oldest = b->index[b->head].startTime;
+    *newest = b->index[slot_of(b, b->count - 1)].endTime;
+    return true;
+}
+
+static void iter_load(HBlockIter_t* it) {
+    const HistoryBlock_t* b = it->block;
+    uint16_t slot = slot_of(b, it->chunk);
+    gorilla_reset(&it->codec, HBLOCK_SERIES);
+    bitr_init(&it->reader, chunk_data(b, slot), b->index[slot].bytes);
+    it->left = b->index[slot].count;
+}
+
+bool hblock_seek_time(const HistoryBlock_t* b, HBlockIter_t* it, uint32_t t0) {
+    memset(it, 0, sizeof(*it));
+    it->block = b;
+    if (!b->ready || b->count == 0) return false;
+
+    // First chunk whose newest sample is >= t0
+    uint16_t lo = 0, hi = b->count;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (b->index[slot_of(b, mid)].endTime < t0) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo == b->count) return false;
+    it->chunk = lo;
+    it->t0 = t0;
+    iter_load(it);
+    return true;
+}
+
+bool hblock_seek_last(const HistoryBlock_t* b, HBlockIter_t* it, uint32_t n) {
+    memset(it, 0, sizeof(*it));
+    it->block = b;
+    if (!b->ready || b->count == 0 || n == 0) return false;
+
+    // Walk back from the newest chunk until n samples are covered
+    uint32_t covered = 0;
+    int32_t c = b->count - 1;
+    for (; c >= 0; c--) {
+        covered += b->index[slot_of(b, (uint16_t)c)].count;
+        if (covered >= n) break;
+    }
+    if (c < 0) c = 0;
+    it->chunk = (uint16_t)c;
+    it->skip = covered > n ? covered - n : 0;
+    iter_load(it);
+    return true;
+}
+
+bool hblock_next(HBlockIter_t* it, uint32_t* t, float* values) {
+    const HistoryBlock_t* b = it->block;
+    while (true) {
+        while (it->left == 0) {
+            if (it->chunk + 1 >= b->count) return false;
+            it->chunk++;
+            iter_load(it);
+        }
+        if (!gorilla_decode(&it->codec, &it->reader, t, values)) return false;
+        it->left--;
+        if (it->skip > 0) {
+            it->skip--;
+            continue;
+        }
+        if (*t < it->t0) continue;
+        return true;
+    }
+}
+
+uint32_t hblock_read(HistoryBlock_t* b, uint32_t t0, uint32_t t1,
+                     HBlockSampleFn fn, void* ctx) {
+    HBlockIter_t it;
+    if (!hblock_seek_time(b, &it, t0)) return 0;
+
+    unsigned long start = micros();
+    uint32_t t, n = 0;
+    float values[HBLOCK_SERIES];
+    while (hblock_next(&it, &t, values) && t <= t1) {
+        fn(t, values, ctx);
+        n++;
+    }
+    b->decodeUs += micros() - start;
+    b->stats.decodedSamples += n;
+    return n;
+}
+
+uint32_t hblock_read_last(HistoryBlock_t* b, uint32_t n, float* out) {
+    HBlockIter_t it;
+    if (!hblock_seek_last(b, &it, n)) return 0;
+
+    unsigned long start = micros();
+    uint32_t t, got = 0;
+    while (got < n && hblock_next(&it, &t, &out[got * HBLOCK_SERIES])) got++;
+    b->decodeUs += micros() - start;
+    b->stats.decodedSamples += got;
+    return got;
+}
+
+// ============ Stats ============
+const HBlockStats_t* hblock_get_stats(HistoryBlock_t* b) {
+    HBlockStats_t* s = &b->stats;
+    s->samples = b->samples;
+    s->bytesUsed = 0;
+    s->spanS = 0;
+    if (b->ready && b->count > 0) {
+        for (uint16_t c = 0; c < b->count; c++) s->bytesUsed += b->index[slot_of(b, c)].bytes;
+        s->spanS = b->index[slot_of(b, b->count - 1)].endTime - b->index[b->head].startTime;
+    }
+    s->bytesPerSample = b->samples ? (float)s->bytesUsed / b->samples : 0.0f;
+    s->compressionRatio = s->bytesUsed ?
+        (float)b->samples * (4 + 4 * HBLOCK_SERIES) / s->bytesUsed : 0.0f;
+    s->decodeSamplesPerSec = b->decodeUs ? s->decodedSamples * 1e6f / b->decodeUs : 0.0f;
+    return s;
+}
@@ -0,0 +1,88 @@
+// SIGNALTAP Compressed History Block
+// Long, full-rate sensor history kept in PSRAM as Gorilla-coded chunks.
+// Every chunk restarts the codec, so a reader seeks through the chunk
+// index and decodes from the nearest restart point instead of from the
+// start of the block. The oldest chunk is recycled once the block is full.
+#ifndef HISTORY_BLOCK_H
+#define HISTORY_BLOCK_H
+
+#include <Arduino.h>
+#include "../storage/gorilla.h"
+
+// ============ Layout ============
+#define HBLOCK_SERIES       3
+#define HBLOCK_CHUNK_BYTES  1024    // Restart interval (~100 samples of 3 sensors)
+#define HBLOCK_CHUNKS       1280    // 1.25 MB per machine: > 24 h at 1 Hz
+
+typedef struct {
+    uint32_t startTime;
+    uint32_t endTime;
+    uint16_t count;         // Samples in the chunk
+    uint16_t bytes;         // Coded bytes used
+} HBlockChunk_t;
+
+typedef struct {
+    uint32_t samples;               // Samples currently held
+    uint32_t spanS;                 // Time covered, oldest to newest
+    uint32_t bytesUsed;
+    float bytesPerSample;
+    float compressionRatio;         // Raw (u32 time + float per series) / coded
+    uint32_t decodedSamples;        // Read back through hblock_read
+    float decodeSamplesPerSec;
+} HBlockStats_t;
+
+typedef struct {
+    uint8_t* data;                  // HBLOCK_CHUNKS x HBLOCK_CHUNK_BYTES (PSRAM)
+    HBlockChunk_t* index;           // One entry per chunk slot (PSRAM)
+    uint16_t head;                  // Slot of the oldest chunk
+    uint16_t count;                 // Chunks in use, newest one is open
+    GorillaState_t codec;
+    BitWriter_t writer;
+    uint32_t samples;
+    uint32_t decodeUs;
+    HBlockStats_t stats;
+    bool ready;
+} HistoryBlock_t;
+
+// Forward reader positioned inside the block
+typedef struct {
+    const HistoryBlock_t* block;
+    uint16_t chunk;                 // Logical chunk (0 = oldest)
+    uint16_t left;                  // Samples left in the current chunk
+    uint32_t skip;                  // Samples still to drop after seeking
+    uint32_t t0;                    // Drop samples older than this
+    GorillaState_t codec;
+    BitReader_t reader;
+} HBlockIter_t;
+
+typedef void (*HBlockSampleFn)(uint32_t t, const float* values, void* ctx);
+
+// ============ Public API ============
+
+// Allocate from PSRAM; false (and the block stays unusable) if that fails
+bool hblock_init(HistoryBlock_t* b);
+void hblock_clear(HistoryBlock_t* b);
+
+// Append one sample (t non-decreasing)
+void hblock_append(HistoryBlock_t* b, uint32_t t, const float* values);
+
+// Times of the oldest and newest samples held; false if there are none
+bool hblock_time_range(const HistoryBlock_t* b, uint32_t* oldest, uint32_t* newest);
+
+// Position a reader at the first sample with time >= t0, or n samples
+// before the newest. Only the chunk containing the start is decoded.
+bool hblock_seek_time(const HistoryBlock_t* b, HBlockIter_t* it, uint32_t t0);
+bool hblock_seek_last(const HistoryBlock_t* b, HBlockIter_t* it, uint32_t n);
+bool hblock_next(HBlockIter_t* it, uint32_t* t, float* values);
+
+// Deliver samples with t0 <= t <= t1; returns the count (timed for stats)
+uint32_t hblock_read(HistoryBlock_t* b, uint32_t t0, uint32_t t1,
+                     HBlockSampleFn fn, void* ctx);
+
+// Copy the newest n samples into out[n][HBLOCK_SERIES], oldest first
+uint32_t hblock_read_last(HistoryBlock_t* b, uint32_t n, float* out);
+
+// Refreshes the derived figures (walks the chunk index)
+const HBlockStats_t* hblock_get_stats(HistoryBlock_t* b);
+
+#endif // HISTORY_BLOCK_H
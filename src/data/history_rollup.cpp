@@ -0,0 +1,121 @@
+// SIGNALTAP History Rollups Implementation
+#include "history_rollup.h"
+#include <string.h>
+
+static const uint32_t tierPeriod[ROLLUP_TIERS] = {
+    ROLLUP_T0_PERIOD_S, ROLLUP_T1_PERIOD_S, ROLLUP_T2_PERIOD_S, ROLLUP_T3_PERIOD_S
+};
+static const uint16_t tierLen[ROLLUP_TIERS] = {
+    ROLLUP_T0_LEN, ROLLUP_T1_LEN, ROLLUP_T2_LEN, ROLLUP_T3_LEN
+};
+static const uint16_t tierOffset[ROLLUP_TIERS] = {
+    0, ROLLUP_T0_LEN, ROLLUP_T0_LEN + ROLLUP_T1_LEN, ROLLUP_T0_LEN + ROLLUP_T1_LEN + ROLLUP_T2_LEN
+};
+
+// ============ Helper: Merge two summaries ============
+static void bucket_merge(RollupBucket_t* dst, const RollupBucket_t* src) {
+    if (src->count == 0) return;
+    if (dst->count == 0) {
+        *dst = *src;
+        return;
+    }
+    uint32_t n = (uint32_t)dst->count + src->count;
+    if (n > 0xFFFF) n = 0xFFFF;
+    if (src->min < dst->min) dst->min = src->min;
+    if (src->max > dst->max) dst->max = src->max;
+    dst->mean += (src->mean - dst->mean) * ((float)src->count / (float)((uint32_t)dst->count + src->count));
+    dst->count = (uint16_t)n;
+}
+
+static void ring_append(HistoryRollup_t* r, uint8_t tier, const RollupBucket_t* b) {
+    RollupBucket_t* ring = &r->buckets[tierOffset[tier]];
+    ring[r->head[tier]] = *b;
+    r->head[tier] = (r->head[tier] + 1) % tierLen[tier];
+    if (r->count[tier] < tierLen[tier]) r->count[tier]++;
+}
+
+static void tier_feed(HistoryRollup_t* r, uint8_t tier, uint32_t t, const RollupBucket_t* b);
+
+// ============ Helper: Close a tier's open bucket ============
+static void tier_commit(HistoryRollup_t* r, uint8_t tier) {
+    uint32_t idx = r->openIndex[tier];
+
+    // Periods with no samples become empty buckets so ring slots stay time-aligned
+    if (r->count[tier] > 0 && idx > r->lastIndex[tier] + 1) {
+        uint32_t gap = idx - r->lastIndex[tier] - 1;
+        if (gap > tierLen[tier]) gap = tierLen[tier];
+        RollupBucket_t empty;
+        memset(&empty, 0, sizeof(empty));
+        for (uint32_t i = 0; i < gap; i++) ring_append(r, tier, &empty);
+    }
+    ring_append(r, tier, &r->open[tier]);
+    r->lastIndex[tier] = idx;
+
+    if (tier + 1 < ROLLUP_TIERS) {
+        tier_feed(r, tier + 1, idx * tierPeriod[tier], &r->open[tier]);
+    }
+    memset(&r->open[tier], 0, sizeof(RollupBucket_t));
+}
+
+static void tier_feed(HistoryRollup_t* r, uint8_t tier, uint32_t t, const RollupBucket_t* b) {
+    uint32_t idx = t / tierPeriod[tier];
+    if (r->open[tier].count > 0 && idx != r->openIndex[tier]) {
+        tier_commit(r, tier);
+    }
+    r->openIndex[tier] = idx;
+    bucket_merge(&r->open[tier], b);
+}
+
+// ============ Public API ============
+void rollup_init(HistoryRollup_t* r) {
+    memset(r, 0, sizeof(*r));
+}
+
+void rollup_push(HistoryRollup_t* r, uint32_t t, float value) {
+    RollupBucket_t b;
+    b.min = value;
+    b.max = value;
+    b.mean = value;
+    b.count = 1;
+    b.reserved = 0;
+    tier_feed(r, 0, t, &b);
+}
+
+uint32_t rollup_tier_period(uint8_t tier) {
+    return (tier < ROLLUP_TIERS) ? tierPeriod[tier] : 0;
+}
+
+uint16_t rollup_tier_len(uint8_t tier) {
+    return (tier < ROLLUP_TIERS) ? tierLen[tier] : 0;
+}
+
+uint8_t rollup_best_tier(uint32_t spanS) {
+    for (uint8_t t = 0; t < ROLLUP_TIERS; t++) {
+        if ((uint32_t)tierLen[t] * tierPeriod[t] >= spanS) return t;
+    }
+    return ROLLUP_TIERS - 1;
+}
+
+uint16_t rollup_query(const HistoryRollup_t* r, uint32_t spanS,
+                      RollupBucket_t* out, uint16_t maxOut, uint32_t* periodS) {
+    uint8_t tier = rollup_best_tier(spanS);
+    uint32_t period = tierPeriod[tier];
+    if (periodS) *periodS = period;
+    if (!out || maxOut == 0) return 0;
+
+    bool hasOpen = r->open[tier].count > 0;
+    uint32_t want = (spanS + period - 1) / period;
+    if (want == 0) want = 1;
+    uint32_t closed = hasOpen ? want - 1 : want;
+    if (closed > r->count[tier]) closed = r->count[tier];
+    if (closed + (hasOpen ? 1 : 0) > maxOut) closed = maxOut - (hasOpen ? 1 : 0);
+
+    const RollupBucket_t* ring = &r->buckets[tierOffset[tier]];
+    uint16_t len = tierLen[tier];
+    uint16_t n = 0;
+    for (uint32_t i = 0; i < closed; i++) {
+        out[n++] = ring[(r->head[tier] + len - closed + i) % len];
+    }
+    if (hasOpen) out[n++] = r->open[tier];
+    return n;
+}
@@ -0,0 +1,61 @@
+// SIGNALTAP History Rollups
+// Tiered min/max/mean ring buffers (seconds -> week) in fixed memory.
+// One push cascades upward: a tier's bucket is merged into the next tier
+// only when it closes, so the amortized cost per sample is O(1).
+#ifndef HISTORY_ROLLUP_H
+#define HISTORY_ROLLUP_H
+
+#include <Arduino.h>
+
+// ============ Tier Layout ============
+#define ROLLUP_TIERS            4
+#define ROLLUP_T0_PERIOD_S      1       // 1 s  x 120 = 2 min
+#define ROLLUP_T0_LEN           120
+#define ROLLUP_T1_PERIOD_S      60      // 1 min x 120 = 2 h
+#define ROLLUP_T1_LEN           120
+#define ROLLUP_T2_PERIOD_S      900     // 15 min x 96 = 1 day
+#define ROLLUP_T2_LEN           96
+#define ROLLUP_T3_PERIOD_S      3600    // 1 h x 168 = 1 week
+#define ROLLUP_T3_LEN           168
+#define ROLLUP_TOTAL_BUCKETS    (ROLLUP_T0_LEN + ROLLUP_T1_LEN + ROLLUP_T2_LEN + ROLLUP_T3_LEN)
+
+typedef struct {
+    float min;
+    float max;
+    float mean;
+    uint16_t count;     // Samples merged (0 = gap)
+    uint16_t reserved;
+} RollupBucket_t;
+
+typedef struct {
+    RollupBucket_t buckets[ROLLUP_TOTAL_BUCKETS];  // All tier rings, back to back
+    RollupBucket_t open[ROLLUP_TIERS];             // Bucket currently accumulating
+    uint32_t openIndex[ROLLUP_TIERS];              // Period index (t / period) of open
+    uint32_t lastIndex[ROLLUP_TIERS];              // Period index of newest committed
+    uint16_t head[ROLLUP_TIERS];
+    uint16_t count[ROLLUP_TIERS];
+} HistoryRollup_t;
+
+// Fixed RAM per rolled-up sensor, known at compile time
+#define ROLLUP_BYTES_PER_SENSOR  sizeof(HistoryRollup_t)
+
+// ============ Public API ============
+
+void rollup_init(HistoryRollup_t* r);
+
+// Add one sample at time t (seconds, non-decreasing)
+void rollup_push(HistoryRollup_t* r, uint32_t t, float value);
+
+uint32_t rollup_tier_period(uint8_t tier);
+uint16_t rollup_tier_len(uint8_t tier);
+
+// Finest tier whose ring spans at least spanS (coarsest if none does)
+uint8_t rollup_best_tier(uint32_t spanS);
+
+// Copy the buckets covering the last spanS seconds from the best tier,
+// oldest first, ending with the partially filled open bucket.
+// Returns the number written; periodS receives the bucket width.
+uint16_t rollup_query(const HistoryRollup_t* r, uint32_t spanS,
+                      RollupBucket_t* out, uint16_t maxOut, uint32_t* periodS);
+
+#endif // HISTORY_ROLLUP_H
@@ -0,0 +1,126 @@
+// SIGNALTAP Rule Engine Implementation
+#include "rule_engine.h"
+#include <string.h>
+
+// ============ Compile ============
+bool rule_compile(RuleSet_t* set, const RuleDef_t* defs, uint32_t count, uint8_t machines) {
+    memset(set, 0, sizeof(*set));
+    if (count == 0 || machines == 0) return false;
+
+    for (uint32_t i = 0; i < count; i++) {
+        const RuleDef_t* d = &defs[i];
+        if (d->machine >= machines || d->sensor >= RULE_SENSORS_PER_MACHINE ||
+            d->code <= ALARM_NONE || d->code >= ALARM_CODE_COUNT ||
+            d->hysteresis < 0.0f) {
+            return false;
+        }
+    }
+
+    // Widest fields first so every array stays aligned
+    size_t bytes = count * (5 * sizeof(float) + sizeof(uint32_t) +
+                            5 * sizeof(uint16_t) + 3 * sizeof(uint8_t));
+    uint8_t* mem = (uint8_t*)malloc(bytes);
+    if (!mem) mem = (uint8_t*)ps_malloc(bytes);
+    if (!mem) return false;
+    memset(mem, 0, bytes);
+
+    uint8_t* p = mem;
+    set->sign = (float*)p;          p += count * sizeof(float);
+    set->onLevel = (float*)p;       p += count * sizeof(float);
+    set->offLevel = (float*)p;      p += count * sizeof(float);
+    set->dir = (float*)p;           p += count * sizeof(float);
+    set->level = (float*)p;         p += count * sizeof(float);
+    set->fired = (uint32_t*)p;      p += count * sizeof(uint32_t);
+    set->input = (uint16_t*)p;      p += count * sizeof(uint16_t);
+    set->onDelay = (uint16_t*)p;    p += count * sizeof(uint16_t);
+    set->offDelay = (uint16_t*)p;   p += count * sizeof(uint16_t);
+    set->delay = (uint16_t*)p;      p += count * sizeof(uint16_t);
+    set->timer = (uint16_t*)p;      p += count * sizeof(uint16_t);
+    set->active = p;                p += count;
+    set->machine = p;               p += count;
+    set->code = p;
+
+    for (uint32_t i = 0; i < count; i++) {
+        const RuleDef_t* d = &defs[i];
+        float sign = (d->cmp == RULE_BELOW) ? -1.0f : 1.0f;
+        set->input[i] = (uint16_t)(d->machine * RULE_SENSORS_PER_MACHINE + d->sensor);
+        set->sign[i] = sign;
+        set->onLevel[i] = sign * d->limit;
+        set->offLevel[i] = sign * d->limit - d->hysteresis;
+        set->onDelay[i] = d->onDelayS;
+        set->offDelay[i] = d->offDelayS;
+        set->machine[i] = d->machine;
+        set->code[i] = (uint8_t)d->code;
+    }
+
+    set->count = count;
+    set->mem = mem;
+    set->stats.rules = count;
+    rule_reset(set);
+    return true;
+}
+
+void rule_free(RuleSet_t* set) {
+    free(set->mem);
+    memset(set, 0, sizeof(*set));
+}
+
+// ============ Helper: Load the test for leaving the current state ============
+static inline void arm_rule(RuleSet_t* set, uint32_t i) {
+    if (set->active[i]) {
+        // x * sign < offLevel  <=>  x * -sign > -offLevel
+        set->dir[i] = -set->sign[i];
+        set->level[i] = -set->offLevel[i];
+        set->delay[i] = set->offDelay[i];
+    } else {
+        set->dir[i] = set->sign[i];
+        set->level[i] = set->onLevel[i];
+        set->delay[i] = set->onDelay[i];
+    }
+    set->timer[i] = 0;
+}
+
+void rule_reset(RuleSet_t* set) {
+    if (!set->mem) return;
+    memset(set->active, 0, set->count);
+    for (uint32_t i = 0; i < set->count; i++) arm_rule(set, i);
+}
+
+// ============ Evaluate ============
+uint32_t rule_eval(RuleSet_t* set, const float* values, RuleEventFn fn, void* ctx) {
+    if (!set->mem) return 0;
+    uint32_t startUs = micros();
+
+    // Pass 1: every rule, same arithmetic for each. Fired rules are
+    // appended unconditionally; the write index only advances for the
+    // ones whose test holds and has held for delay ticks (a delay of 0
+    // or 1 fires on the first).
+    const uint32_t n = set->count;
+    const uint16_t* input = set->input;
+    const float* dir = set->dir;
+    const float* level = set->level;
+    const uint16_t* delay = set->delay;
+    uint16_t* timer = set->timer;
+    uint32_t* firedList = set->fired;
+    uint32_t fired = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t pending = values[input[i]] * dir[i] > level[i];
+        uint32_t tm = pending * (timer[i] + 1u);
+        timer[i] = (uint16_t)(tm < 0xFFFF ? tm : 0xFFFF);
+        firedList[fired] = i;
+        fired += pending & (tm >= delay[i]);
+    }
+
+    // Pass 2: only the rules that changed state
+    for (uint32_t k = 0; k < fired; k++) {
+        uint32_t i = firedList[k];
+        set->active[i] ^= 1;
+        arm_rule(set, i);
+        if (fn) fn(set->machine[i], (AlarmCode_t)set->code[i], set->active[i] != 0, ctx);
+    }
+
+    set->stats.ticks++;
+    set->stats.transitions += fired;
+    set->stats.lastUs = micros() - startUs;
+    return fired;
+}
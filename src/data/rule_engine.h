@@ -0,0 +1,81 @@
+// SIGNALTAP Rule Engine
+// Threshold alarm rules (sensor, comparator, limit, hysteresis, on/off
+// delay, alarm code) compiled into structure-of-arrays form. One tick is a
+// single branch-free pass over every rule of every machine; only rules
+// that change state leave the pass, as raise/clear events.
+#ifndef RULE_ENGINE_H
+#define RULE_ENGINE_H
+
+#include <Arduino.h>
+#include "alarm_engine.h"
+
+#define RULE_SENSORS_PER_MACHINE 3
+
+typedef enum {
+    RULE_ABOVE = 0,         // Active while value > limit
+    RULE_BELOW              // Active while value < limit
+} RuleCmp_t;
+
+// Source form, as written in the rule tables. Severity comes from the
+// alarm code's entry in the message table.
+typedef struct {
+    uint8_t machine;        // Demo index
+    uint8_t sensor;         // 0..RULE_SENSORS_PER_MACHINE-1
+    RuleCmp_t cmp;
+    float limit;
+    float hysteresis;       // Release this far back past the limit
+    uint16_t onDelayS;      // Condition must hold this long to raise
+    uint16_t offDelayS;     // ... and be gone this long to clear
+    AlarmCode_t code;
+} RuleDef_t;
+
+typedef struct {
+    uint32_t rules;
+    uint32_t ticks;
+    uint32_t transitions;   // Raise + clear events emitted
+    uint32_t lastUs;        // Last evaluation pass
+} RuleStats_t;
+
+// Compiled form: one array per field, one entry per rule
+typedef struct {
+    uint32_t count;
+    uint16_t* input;        // Index into the flat value vector
+    float* sign;            // +1 above, -1 below: every test becomes "x > on"
+    float* onLevel;         // sign * limit
+    float* offLevel;        // sign * limit - hysteresis
+    uint16_t* onDelay;
+    uint16_t* offDelay;
+
+    // Test for leaving the current state, "x * dir > level", and how many
+    // ticks it must hold; swapped between on and off forms on each change
+    float* dir;
+    float* level;
+    uint16_t* delay;
+    uint16_t* timer;        // Consecutive ticks the test held
+    uint8_t* active;
+    uint8_t* machine;
+    uint8_t* code;
+    uint32_t* fired;        // Rules that changed state this tick
+    void* mem;              // Single allocation behind the arrays
+    RuleStats_t stats;
+} RuleSet_t;
+
+// Called once per state change
+typedef void (*RuleEventFn)(uint8_t machine, AlarmCode_t code, bool active, void* ctx);
+
+// ============ Public API ============
+
+// Validate and compile defs; false (set left empty) on a bad rule or no memory
+bool rule_compile(RuleSet_t* set, const RuleDef_t* defs, uint32_t count, uint8_t machines);
+void rule_free(RuleSet_t* set);
+
+// Forget all rule state (active flags and delay timers)
+void rule_reset(RuleSet_t* set);
+
+// values: machines x RULE_SENSORS_PER_MACHINE, machine-major. Returns the
+// number of state changes delivered to fn.
+uint32_t rule_eval(RuleSet_t* set, const float* values, RuleEventFn fn, void* ctx);
+
+static inline const RuleStats_t* rule_get_stats(const RuleSet_t* set) { return &set->stats; }
+
+#endif // RULE_ENGINE_H
@@ -0,0 +1,88 @@
+// SIGNALTAP Scenario Engine Implementation
+#include "scenario_engine.h"
+
+// ============ Helper: Uniform noise (same draw as the simulation) ============
+static float kf_noise(float amplitude) {
+    return (random(-1000, 1001) / 1000.0f) * amplitude;
+}
+
+static float eval_ramp(const KfRamp_t* r, float progress) {
+    float v = (r->form == KF_FADE) ? r->base * (1.0f - progress)
+                                   : r->base + progress * r->slope;
+    if (r->noise != 0.0f) v += kf_noise(r->noise);
+    return v;
+}
+
+static bool* led_ref(CNCLeds_t* leds, uint8_t led) {
+    switch (led) {
+        case KF_LED_RUN:     return &leds->run;
+        case KF_LED_FEED:    return &leds->feed;
+        case KF_LED_SPINDLE: return &leds->spindle;
+        case KF_LED_COOLANT: return &leds->coolant;
+        case KF_LED_PROGRAM: return &leds->program;
+        case KF_LED_ERROR:   return &leds->error;
+        case KF_LED_FAULT:   return &leds->fault;
+        default:             return &leds->ready;
+    }
+}
+
+static bool action_due(const KfAction_t* a, unsigned long stateTimer, float progress) {
+    switch (a->when) {
+        case KF_WHEN_AFTER:     return progress > a->at;
+        case KF_WHEN_UNTIL:     return progress <= a->at;
+        case KF_WHEN_BEFORE:    return progress < a->at;
+        case KF_WHEN_FROM:      return progress >= a->at;
+        case KF_WHEN_CYCLE_ON:  return stateTimer % (unsigned long)a->at < a->on;
+        case KF_WHEN_CYCLE_OFF: return stateTimer % (unsigned long)a->at >= a->on;
+        case KF_WHEN_CHANCE:    return random(100) < (long)a->at;
+        default:                return true;
+    }
+}
+
+// ============ Interpreter ============
+void scenario_apply(const ScenarioDef_t* def, uint8_t state, unsigned long stateTimer,
+                    float progress, DemoProfile_t* demo, ScenarioOutput_t* out) {
+    if (state >= SCENARIO_STATES) return;
+    const KfState_t* kf = &def->states[state];
+    Vision_t* v = &demo->vision;
+
+    for (int i = 0; i < SCENARIO_SENSORS; i++) {
+        out->sensorTargets[i] = eval_ramp(&kf->sensors[i], progress);
+    }
+    out->healthScore = kf->healthBase + (int)(progress * kf->healthSlope);
+    out->failureProb = kf->failureBase + progress * kf->failureSlope;
+    out->notice = ALARM_NONE;
+
+    for (uint8_t n = 0; n < kf->actionCount; n++) {
+        const KfAction_t* a = &kf->actions[n];
+        if (!action_due(a, stateTimer, progress)) continue;
+
+        bool on = a->value != 0.0f;
+        switch (a->op) {
+            case KF_OP_STACK_LIGHT:      v->stackLight = a->text; break;
+            case KF_OP_ERROR_CODE:       v->errorCode = a->text; break;
+            case KF_OP_RUN_STATE:        v->state = a->text; break;
+            case KF_OP_LED:              *led_ref(&v->leds, a->index) = on; break;
+            case KF_OP_DI:               v->diA[a->index & 7] = on; break;
+            case KF_OP_DQ:               v->dqA[a->index & 7] = on; break;
+            case KF_OP_DQ_ALL:
+                for (int i = 0; i < 8; i++) v->dqA[i] = on;
+                break;
+            case KF_OP_AQ0: {
+                int aq = (int)a->value + (int)(progress * a->slope);
+                v->aq0 = (uint8_t)(aq < 0 ? 0 : aq > 100 ? 100 : aq);
+                break;
+            }
+            case KF_OP_AQ0_NOISE:        v->aq0 = (int)a->value + (int)kf_noise(a->slope); break;
+            case KF_OP_PART_COUNT:       v->partCount++; break;
+            case KF_OP_GAUGE_PRESSURE:   v->pressure = out->sensorTargets[a->index % SCENARIO_SENSORS]; break;
+            case KF_OP_GAUGE_OIL:        v->oilTemp = out->sensorTargets[a->index % SCENARIO_SENSORS]; break;
+            case KF_OP_KPI_VALUE:        demo->kpis[a->index & 3].value = a->text; break;
+            case KF_OP_KPI_GOOD:         demo->kpis[a->index & 3].good = on; break;
+            case KF_OP_INSIGHT_SEVERITY: demo->ai.insights[0].severity = (InsightSeverity_t)(int)a->value; break;
+            case KF_OP_INSIGHT_TITLE:    demo->ai.insights[0].title = a->text; break;
+            case KF_OP_INSIGHT_DESC:     demo->ai.insights[0].description = a->text; break;
+            case KF_OP_ALARM:            out->notice = (AlarmCode_t)(int)a->value; break;
+        }
+    }
+}
@@ -0,0 +1,152 @@
+// SIGNALTAP Scenario Engine
+// Machine scenarios as data: per scenario state, one keyframe with the
+// sensor target ramps, health / failure-risk ramps, and a list of
+// conditional actions (stack light, LEDs, I/O, KPIs, insight text, alarm
+// notices). Tables are plain const data in flash (see scenario_tables.h);
+// scenario_apply interprets one machine's keyframe per tick.
+#ifndef SCENARIO_ENGINE_H
+#define SCENARIO_ENGINE_H
+
+#include <Arduino.h>
+#include "demo_profiles.h"
+#include "alarm_engine.h"
+
+#define SCENARIO_STATES     5       // Normal, degradation, warning, fault, recovery
+#define SCENARIO_SENSORS    3
+
+// ============ Ramps ============
+typedef enum {
+    KF_LINEAR = 0,          // base + progress * slope + noise
+    KF_FADE                 // base * (1 - progress) + noise
+} KfForm_t;
+
+typedef struct {
+    uint8_t form;           // KfForm_t
+    float base;
+    float slope;
+    float noise;            // Uniform +/- amplitude (0 = none)
+} KfRamp_t;
+
+#define KF_RAMP(base, slope, noise)  {KF_LINEAR, base, slope, noise}
+#define KF_FADE_OUT(base, noise)     {KF_FADE, base, 0.0f, noise}
+
+// ============ Actions ============
+typedef enum {
+    KF_WHEN_ALWAYS = 0,
+    KF_WHEN_AFTER,          // progress >  at
+    KF_WHEN_UNTIL,          // progress <= at
+    KF_WHEN_BEFORE,         // progress <  at
+    KF_WHEN_FROM,           // progress >= at
+    KF_WHEN_CYCLE_ON,       // stateTimer % at <  on
+    KF_WHEN_CYCLE_OFF,      // stateTimer % at >= on
+    KF_WHEN_CHANCE          // random(100) < at (draws every tick)
+} KfWhen_t;
+
+typedef enum {
+    KF_OP_STACK_LIGHT = 0,  // text
+    KF_OP_ERROR_CODE,       // text
+    KF_OP_RUN_STATE,        // text ("LOAD", "IDLE", ...)
+    KF_OP_LED,              // index = KfLed_t, value = on/off
+    KF_OP_DI,               // index, value
+    KF_OP_DQ,               // index, value
+    KF_OP_DQ_ALL,           // value
+    KF_OP_AQ0,              // value + (int)(progress * slope), 0..100
+    KF_OP_AQ0_NOISE,        // value + (int)noise(slope)
+    KF_OP_PART_COUNT,       // partCount++
+    KF_OP_GAUGE_PRESSURE,   // pressure = sensor target[index]
+    KF_OP_GAUGE_OIL,        // oilTemp = sensor target[index]
+    KF_OP_KPI_VALUE,        // index, text
+    KF_OP_KPI_GOOD,         // index, value
+    KF_OP_INSIGHT_SEVERITY, // value = InsightSeverity_t
+    KF_OP_INSIGHT_TITLE,    // text
+    KF_OP_INSIGHT_DESC,     // text
+    KF_OP_ALARM             // value = AlarmCode_t (event notice)
+} KfOp_t;
+
+typedef enum {
+    KF_LED_RUN = 0,
+    KF_LED_FEED,
+    KF_LED_SPINDLE,
+    KF_LED_COOLANT,
+    KF_LED_PROGRAM,
+    KF_LED_ERROR,
+    KF_LED_FAULT,
+    KF_LED_READY
+} KfLed_t;
+
+typedef struct {
+    uint8_t when;           // KfWhen_t
+    float at;               // Progress threshold, cycle period or chance %
+    uint8_t on;             // Cycle ticks on
+    uint8_t op;             // KfOp_t
+    uint8_t index;
+    float value;
+    float slope;
+    const char* text;
+} KfAction_t;
+
+// Condition columns
+#define KF_ALWAYS               KF_WHEN_ALWAYS, 0.0f, 0
+#define KF_AFTER(p)             KF_WHEN_AFTER, p, 0
+#define KF_UNTIL(p)             KF_WHEN_UNTIL, p, 0
+#define KF_BEFORE(p)            KF_WHEN_BEFORE, p, 0
+#define KF_FROM(p)              KF_WHEN_FROM, p, 0
+#define KF_CYCLE_ON(period, n)  KF_WHEN_CYCLE_ON, period, n
+#define KF_CYCLE_OFF(period, n) KF_WHEN_CYCLE_OFF, period, n
+#define KF_CHANCE(pct)          KF_WHEN_CHANCE, pct, 0
+
+// Operation columns
+#define KF_STACK(s)             KF_OP_STACK_LIGHT, 0, 0.0f, 0.0f, s
+#define KF_ERROR(s)             KF_OP_ERROR_CODE, 0, 0.0f, 0.0f, s
+#define KF_STATE(s)             KF_OP_RUN_STATE, 0, 0.0f, 0.0f, s
+#define KF_LED(led, on)         KF_OP_LED, led, (float)(on), 0.0f, NULL
+#define KF_DI(i, on)            KF_OP_DI, i, (float)(on), 0.0f, NULL
+#define KF_DQ(i, on)            KF_OP_DQ, i, (float)(on), 0.0f, NULL
+#define KF_DQ_ALL(on)           KF_OP_DQ_ALL, 0, (float)(on), 0.0f, NULL
+#define KF_AQ0(base, slope)     KF_OP_AQ0, 0, base, slope, NULL
+#define KF_AQ0_NOISE(base, amp) KF_OP_AQ0_NOISE, 0, base, amp, NULL
+#define KF_PART                 KF_OP_PART_COUNT, 0, 0.0f, 0.0f, NULL
+#define KF_PRESSURE(sensor)     KF_OP_GAUGE_PRESSURE, sensor, 0.0f, 0.0f, NULL
+#define KF_OIL(sensor)          KF_OP_GAUGE_OIL, sensor, 0.0f, 0.0f, NULL
+#define KF_KPI(i, s)            KF_OP_KPI_VALUE, i, 0.0f, 0.0f, s
+#define KF_KPI_GOOD(i, good)    KF_OP_KPI_GOOD, i, (float)(good), 0.0f, NULL
+#define KF_SEVERITY(sev)        KF_OP_INSIGHT_SEVERITY, 0, (float)(sev), 0.0f, NULL
+#define KF_TITLE(s)             KF_OP_INSIGHT_TITLE, 0, 0.0f, 0.0f, s
+#define KF_DESC(s)              KF_OP_INSIGHT_DESC, 0, 0.0f, 0.0f, s
+#define KF_NOTICE(code)         KF_OP_ALARM, 0, (float)(code), 0.0f, NULL
+
+// ============ Keyframes ============
+typedef struct {
+    KfRamp_t sensors[SCENARIO_SENSORS];
+    int16_t healthBase;     // healthBase + (int)(progress * healthSlope)
+    float healthSlope;
+    float failureBase;      // failureBase + progress * failureSlope
+    float failureSlope;
+    const KfAction_t* actions;
+    uint8_t actionCount;
+} KfState_t;
+
+typedef struct {
+    const char* name;
+    KfState_t states[SCENARIO_STATES];
+} ScenarioDef_t;
+
+#define KF_ACTIONS(list)        list, (uint8_t)(sizeof(list) / sizeof(list[0]))
+#define KF_NO_ACTIONS           NULL, 0
+
+// Interpreter output for one tick
+typedef struct {
+    float sensorTargets[SCENARIO_SENSORS];
+    uint8_t healthScore;
+    float failureProb;
+    AlarmCode_t notice;     // Last KF_OP_ALARM that fired (ALARM_NONE if none)
+} ScenarioOutput_t;
+
+// ============ Public API ============
+
+// Evaluate one machine's keyframe for the state it is in. Writes targets to
+// out and the vision / KPI / insight actions straight into demo.
+void scenario_apply(const ScenarioDef_t* def, uint8_t state, unsigned long stateTimer,
+                    float progress, DemoProfile_t* demo, ScenarioOutput_t* out);
+
+#endif // SCENARIO_ENGINE_H
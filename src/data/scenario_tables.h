@@ -0,0 +1,278 @@
+// SIGNALTAP Scenario Tables
+// Keyframes of the four demo machines, one per scenario state, interpreted
+// by scenario_engine. Ramps run over the state's duration (progress 0..1);
+// actions fire in table order, so later rows win.
+#ifndef SCENARIO_TABLES_H
+#define SCENARIO_TABLES_H
+
+#include "scenario_engine.h"
+
+// ============ CNC Machine Shop ============
+// 0 spindle load %, 1 coolant L/min, 2 spindle RPM
+static const KfAction_t cncNormal[] = {
+    {KF_ALWAYS, KF_STACK("green")},
+    {KF_ALWAYS, KF_LED(KF_LED_RUN, true)},
+    {KF_ALWAYS, KF_LED(KF_LED_READY, true)},
+    {KF_ALWAYS, KF_LED(KF_LED_ERROR, false)},
+    {KF_ALWAYS, KF_LED(KF_LED_FAULT, false)},
+    {KF_CHANCE(8), KF_PART},                        // Occasional part
+};
+
+static const KfAction_t cncDegradation[] = {
+    {KF_AFTER(0.5f), KF_STACK("yellow")},
+    {KF_AFTER(0.7f), KF_LED(KF_LED_COOLANT, false)},    // Filter clogging
+    {KF_CHANCE(5), KF_PART},
+};
+
+static const KfAction_t cncWarning[] = {
+    {KF_ALWAYS, KF_STACK("yellow")},
+    {KF_ALWAYS, KF_LED(KF_LED_COOLANT, false)},
+    {KF_CHANCE(3), KF_PART},
+};
+
+static const KfAction_t cncFault[] = {
+    {KF_ALWAYS, KF_STACK("red")},
+    {KF_ALWAYS, KF_LED(KF_LED_ERROR, true)},
+    {KF_ALWAYS, KF_LED(KF_LED_FAULT, true)},
+    {KF_ALWAYS, KF_LED(KF_LED_RUN, false)},
+    {KF_ALWAYS, KF_LED(KF_LED_SPINDLE, false)},
+    {KF_ALWAYS, KF_SEVERITY(INSIGHT_CRITICAL)},
+    {KF_ALWAYS, KF_TITLE("Spindle Bearing Overload")},
+};
+
+static const KfAction_t cncRecovery[] = {
+    {KF_BEFORE(0.3f), KF_STACK("yellow")},
+    {KF_FROM(0.3f), KF_STACK("green")},
+    {KF_AFTER(0.5f), KF_LED(KF_LED_RUN, true)},
+    {KF_AFTER(0.5f), KF_LED(KF_LED_SPINDLE, true)},
+    {KF_AFTER(0.5f), KF_LED(KF_LED_ERROR, false)},
+    {KF_AFTER(0.5f), KF_LED(KF_LED_FAULT, false)},
+    {KF_AFTER(0.5f), KF_LED(KF_LED_COOLANT, true)},
+    {KF_ALWAYS, KF_NOTICE(ALARM_CNC_RECOVERY)},
+    {KF_ALWAYS, KF_SEVERITY(INSIGHT_WARNING)},
+    {KF_ALWAYS, KF_TITLE("Spindle Bearing Wear")},
+};
+
+static const ScenarioDef_t cncScenario = {"CNC Machine Shop", {
+    // Stable operation: moderate load, good coolant, mid-speed
+    {{KF_RAMP(55.0f, 0.0f, 3.0f), KF_RAMP(13.0f, 0.0f, 0.5f), KF_RAMP(4500.0f, 0.0f, 100.0f)},
+     90, 0.0f, 5.0f, 0.0f, KF_ACTIONS(cncNormal)},
+    // Load rising 55->80 %, coolant 13->9 L/min, slight RPM drop
+    {{KF_RAMP(55.0f, 25.0f, 2.0f), KF_RAMP(13.0f, -4.0f, 0.3f), KF_RAMP(4500.0f, -500.0f, 80.0f)},
+     90, -15.0f, 5.0f, 15.0f, KF_ACTIONS(cncDegradation)},
+    // High load, low coolant, bearings heating up
+    {{KF_RAMP(82.0f, 8.0f, 2.0f), KF_RAMP(8.5f, -2.0f, 0.3f), KF_RAMP(3800.0f, -400.0f, 60.0f)},
+     75, -15.0f, 20.0f, 20.0f, KF_ACTIONS(cncWarning)},
+    // Overload trip, spindle spinning down
+    {{KF_RAMP(95.0f, 0.0f, 3.0f), KF_RAMP(4.0f, 0.0f, 0.5f), KF_FADE_OUT(1000.0f, 50.0f)},
+     55, -15.0f, 65.0f, 25.0f, KF_ACTIONS(cncFault)},
+    // Coolant restored, load dropping, spindle spooling up
+    {{KF_RAMP(90.0f, -35.0f, 2.0f), KF_RAMP(5.0f, 8.0f, 0.3f), KF_RAMP(500.0f, 4000.0f, 100.0f)},
+     45, 45.0f, 80.0f, -75.0f, KF_ACTIONS(cncRecovery)},
+}};
+
+// ============ Cold Storage Chiller ============
+// 0 compressor kW, 1 supply C, 2 return C
+static const KfAction_t chillerNormal[] = {
+    {KF_ALWAYS, KF_ERROR("---")},
+    {KF_ALWAYS, KF_KPI(0, "5.5")},                  // Delta-T
+    {KF_ALWAYS, KF_KPI(3, "OK")},
+    {KF_ALWAYS, KF_KPI_GOOD(3, true)},
+};
+
+static const KfAction_t chillerDegradation[] = {
+    {KF_AFTER(0.4f), KF_KPI(0, "4.0")},
+};
+
+static const KfAction_t chillerWarning[] = {
+    {KF_ALWAYS, KF_KPI(0, "3.0")},
+    {KF_ALWAYS, KF_KPI(3, "WARN")},
+    {KF_ALWAYS, KF_KPI_GOOD(3, false)},
+    {KF_AFTER(0.5f), KF_ERROR("E07")},
+};
+
+static const KfAction_t chillerFault[] = {
+    {KF_ALWAYS, KF_ERROR("E07")},
+    {KF_ALWAYS, KF_KPI(3, "FAULT")},
+    {KF_ALWAYS, KF_KPI_GOOD(3, false)},
+    {KF_ALWAYS, KF_SEVERITY(INSIGHT_CRITICAL)},
+    {KF_ALWAYS, KF_TITLE("Compressor Trip")},
+    {KF_ALWAYS, KF_DESC("High discharge pressure caused safety cutout")},
+};
+
+static const KfAction_t chillerRecovery[] = {
+    {KF_AFTER(0.3f), KF_ERROR("---")},
+    {KF_AFTER(0.6f), KF_KPI(3, "OK")},
+    {KF_AFTER(0.6f), KF_KPI_GOOD(3, true)},
+    {KF_AFTER(0.6f), KF_KPI(0, "5.0")},
+    {KF_ALWAYS, KF_NOTICE(ALARM_CHL_RECOVERY)},
+    {KF_ALWAYS, KF_SEVERITY(INSIGHT_WARNING)},
+    {KF_ALWAYS, KF_TITLE("Compressor Efficiency Drop")},
+    {KF_ALWAYS, KF_DESC("Power consumption 15% above baseline - check refrigerant levels")},
+};
+
+static const ScenarioDef_t chillerScenario = {"Cold Storage Chiller", {
+    // Good delta-T, moderate power, stable temps
+    {{KF_RAMP(26.0f, 0.0f, 1.0f), KF_RAMP(2.0f, 0.0f, 0.3f), KF_RAMP(7.5f, 0.0f, 0.3f)},
+     88, 0.0f, 5.0f, 0.0f, KF_ACTIONS(chillerNormal)},
+    // Compressor working harder (26->36 kW), supply 2->5 C, refrigerant low
+    {{KF_RAMP(26.0f, 10.0f, 0.8f), KF_RAMP(2.0f, 3.0f, 0.2f), KF_RAMP(7.5f, 2.0f, 0.2f)},
+     88, -18.0f, 5.0f, 18.0f, KF_ACTIONS(chillerDegradation)},
+    // High discharge pressure, poor delta-T, compressor cycling
+    {{KF_RAMP(38.0f, 8.0f, 1.5f), KF_RAMP(5.5f, 3.0f, 0.4f), KF_RAMP(10.0f, 3.0f, 0.3f)},
+     70, -15.0f, 25.0f, 20.0f, KF_ACTIONS(chillerWarning)},
+    // Compressor tripped, temps rising fast
+    {{KF_RAMP(8.0f, 0.0f, 2.0f), KF_RAMP(9.0f, 6.0f, 0.5f), KF_RAMP(14.0f, 5.0f, 0.4f)},
+     50, -20.0f, 55.0f, 35.0f, KF_ACTIONS(chillerFault)},
+    // Compressor restarting, temps slowly dropping
+    {{KF_RAMP(12.0f, 16.0f, 1.0f), KF_RAMP(14.0f, -12.0f, 0.3f), KF_RAMP(18.0f, -10.5f, 0.3f)},
+     35, 53.0f, 80.0f, -75.0f, KF_ACTIONS(chillerRecovery)},
+}};
+
+// ============ Compressed Air System ============
+// 0 tank bar, 1 oil C, 2 motor A
+static const KfAction_t compressorNormal[] = {
+    {KF_ALWAYS, KF_PRESSURE(0)},
+    {KF_ALWAYS, KF_OIL(1)},
+    {KF_ALWAYS, KF_STATE("LOAD")},
+    {KF_ALWAYS, KF_KPI(3, "LOAD")},
+    {KF_ALWAYS, KF_KPI_GOOD(3, true)},
+    {KF_CYCLE_ON(8, 2), KF_STATE("IDLE")},          // Periodic LOAD/IDLE cycling
+    {KF_CYCLE_ON(8, 2), KF_KPI(3, "IDLE")},
+};
+
+static const KfAction_t compressorDegradation[] = {
+    {KF_ALWAYS, KF_PRESSURE(0)},
+    {KF_ALWAYS, KF_OIL(1)},
+    {KF_ALWAYS, KF_STATE("LOAD")},
+};
+
+static const KfAction_t compressorWarning[] = {
+    {KF_ALWAYS, KF_PRESSURE(0)},
+    {KF_ALWAYS, KF_OIL(1)},
+    {KF_ALWAYS, KF_KPI(3, "LOAD")},
+};
+
+static const KfAction_t compressorFault[] = {
+    {KF_ALWAYS, KF_PRESSURE(0)},
+    {KF_ALWAYS, KF_OIL(1)},
+    {KF_ALWAYS, KF_STATE("FAULT")},
+    {KF_ALWAYS, KF_KPI(3, "FAULT")},
+    {KF_ALWAYS, KF_KPI_GOOD(3, false)},
+    {KF_ALWAYS, KF_SEVERITY(INSIGHT_CRITICAL)},
+    {KF_ALWAYS, KF_TITLE("Thermal Shutdown")},
+    {KF_ALWAYS, KF_DESC("Oil overtemperature caused compressor safety shutdown")},
+};
+
+static const KfAction_t compressorRecovery[] = {
+    {KF_ALWAYS, KF_PRESSURE(0)},
+    {KF_ALWAYS, KF_OIL(1)},
+    {KF_AFTER(0.4f), KF_STATE("LOAD")},
+    {KF_AFTER(0.4f), KF_KPI(3, "LOAD")},
+    {KF_AFTER(0.4f), KF_KPI_GOOD(3, true)},
+    {KF_UNTIL(0.4f), KF_STATE("IDLE")},
+    {KF_UNTIL(0.4f), KF_KPI(3, "IDLE")},
+    {KF_ALWAYS, KF_NOTICE(ALARM_CMP_RECOVERY)},
+    {KF_ALWAYS, KF_SEVERITY(INSIGHT_WARNING)},
+    {KF_ALWAYS, KF_TITLE("Oil Quality Good")},
+    {KF_ALWAYS, KF_DESC("Viscosity and contamination levels within spec")},
+};
+
+static const ScenarioDef_t compressorScenario = {"Compressed Air System", {
+    // Good pressure, normal oil temp, moderate current
+    {{KF_RAMP(8.0f, 0.0f, 0.3f), KF_RAMP(75.0f, 0.0f, 2.0f), KF_RAMP(32.0f, 0.0f, 1.5f)},
+     94, 0.0f, 3.0f, 0.0f, KF_ACTIONS(compressorNormal)},
+    // Oil 75->93 C (filter degradation), pressure 8->6.5 bar (leak starting)
+    {{KF_RAMP(8.0f, -1.5f, 0.2f), KF_RAMP(75.0f, 18.0f, 1.5f), KF_RAMP(32.0f, 8.0f, 1.0f)},
+     94, -14.0f, 3.0f, 12.0f, KF_ACTIONS(compressorDegradation)},
+    // High oil temp, low pressure, motor straining
+    {{KF_RAMP(6.2f, -1.2f, 0.3f), KF_RAMP(95.0f, 15.0f, 2.0f), KF_RAMP(42.0f, 10.0f, 1.5f)},
+     80, -20.0f, 18.0f, 25.0f, KF_ACTIONS(compressorWarning)},
+    // Thermal shutdown, pressure bleeding off, motor stopping
+    {{KF_RAMP(4.5f, -2.5f, 0.2f), KF_RAMP(112.0f, 0.0f, 1.0f), KF_FADE_OUT(5.0f, 0.5f)},
+     55, -25.0f, 50.0f, 40.0f, KF_ACTIONS(compressorFault)},
+    // Cooling down, motor restarting, pressure building
+    {{KF_RAMP(2.5f, 5.5f, 0.2f), KF_RAMP(110.0f, -35.0f, 1.0f), KF_RAMP(5.0f, 27.0f, 1.0f)},
+     35, 59.0f, 85.0f, -82.0f, KF_ACTIONS(compressorRecovery)},
+}};
+
+// ============ Custom PLC Setup ============
+// 0 chamber C, 1 chamber mbar, 2 air bar
+static const KfAction_t plcNormal[] = {
+    {KF_CYCLE_ON(6, 3), KF_DI(0, true)},            // Alternating I/O cycle
+    {KF_CYCLE_ON(6, 3), KF_DI(1, false)},
+    {KF_CYCLE_ON(6, 3), KF_DI(2, true)},
+    {KF_CYCLE_ON(6, 3), KF_DQ(0, true)},
+    {KF_CYCLE_ON(6, 3), KF_DQ(3, true)},
+    {KF_CYCLE_OFF(6, 3), KF_DI(0, false)},
+    {KF_CYCLE_OFF(6, 3), KF_DI(1, true)},
+    {KF_CYCLE_OFF(6, 3), KF_DI(2, false)},
+    {KF_CYCLE_OFF(6, 3), KF_DQ(0, false)},
+    {KF_CYCLE_OFF(6, 3), KF_DQ(3, false)},
+    {KF_ALWAYS, KF_AQ0_NOISE(65.0f, 3.0f)},
+    {KF_ALWAYS, KF_KPI(3, "AUTO")},
+    {KF_ALWAYS, KF_KPI_GOOD(3, true)},
+};
+
+static const KfAction_t plcDegradation[] = {
+    {KF_ALWAYS, KF_AQ0(65.0f, 20.0f)},              // Output compensating
+    {KF_AFTER(0.5f), KF_DI(5, true)},               // Warning DI
+};
+
+static const KfAction_t plcWarning[] = {
+    {KF_ALWAYS, KF_AQ0(90.0f, 10.0f)},              // Maxing out
+    {KF_ALWAYS, KF_DI(5, true)},                    // Warning + alarm DIs
+    {KF_ALWAYS, KF_DI(6, true)},
+};
+
+static const KfAction_t plcFault[] = {
+    {KF_ALWAYS, KF_DQ_ALL(false)},                  // Safety shutdown
+    {KF_ALWAYS, KF_DI(6, true)},                    // Fault + E-stop DIs
+    {KF_ALWAYS, KF_DI(7, true)},
+    {KF_ALWAYS, KF_AQ0(0.0f, 0.0f)},
+    {KF_ALWAYS, KF_KPI(3, "STOP")},
+    {KF_ALWAYS, KF_KPI_GOOD(3, false)},
+    {KF_ALWAYS, KF_SEVERITY(INSIGHT_CRITICAL)},
+    {KF_ALWAYS, KF_TITLE("Process Safety Shutdown")},
+    {KF_ALWAYS, KF_DESC("Chamber overtemperature triggered emergency stop")},
+};
+
+static const KfAction_t plcRecovery[] = {
+    {KF_AFTER(0.4f), KF_DQ(0, true)},               // Gradually restore I/O
+    {KF_AFTER(0.4f), KF_DQ(3, true)},
+    {KF_AFTER(0.4f), KF_DI(6, false)},
+    {KF_AFTER(0.4f), KF_DI(7, false)},
+    {KF_AFTER(0.4f), KF_AQ0(0.0f, 65.0f)},
+    {KF_AFTER(0.7f), KF_KPI(3, "AUTO")},
+    {KF_AFTER(0.7f), KF_KPI_GOOD(3, true)},
+    {KF_AFTER(0.7f), KF_DI(5, false)},
+    {KF_ALWAYS, KF_NOTICE(ALARM_PLC_RECOVERY)},
+    {KF_ALWAYS, KF_SEVERITY(INSIGHT_WARNING)},
+    {KF_ALWAYS, KF_TITLE("Process Drift Detected")},
+    {KF_ALWAYS, KF_DESC("Chamber temperature variance increased 12% this week")},
+};
+
+static const ScenarioDef_t plcScenario = {"Custom PLC Setup", {
+    // Stable chamber, process running
+    {{KF_RAMP(85.0f, 0.0f, 1.5f), KF_RAMP(500.0f, 0.0f, 15.0f), KF_RAMP(5.0f, 0.0f, 0.2f)},
+     92, 0.0f, 4.0f, 0.0f, KF_ACTIONS(plcNormal)},
+    // Chamber 85->115 C, 500->650 mbar, slight air pressure drop
+    {{KF_RAMP(85.0f, 30.0f, 2.0f), KF_RAMP(500.0f, 150.0f, 10.0f), KF_RAMP(5.0f, -0.8f, 0.15f)},
+     92, -15.0f, 4.0f, 12.0f, KF_ACTIONS(plcDegradation)},
+    // Overtemp 120->160 C, pressure rising, cycle times extending
+    {{KF_RAMP(120.0f, 40.0f, 3.0f), KF_RAMP(660.0f, 200.0f, 20.0f), KF_RAMP(4.0f, -1.0f, 0.2f)},
+     75, -15.0f, 18.0f, 25.0f, KF_ACTIONS(plcWarning)},
+    // Safety shutdown, all outputs off
+    {{KF_RAMP(165.0f, 0.0f, 2.0f), KF_RAMP(850.0f, 0.0f, 30.0f), KF_RAMP(2.0f, 0.0f, 0.3f)},
+     50, -20.0f, 55.0f, 35.0f, KF_ACTIONS(plcFault)},
+    // Cooling 160->85 C, 850->500 mbar, restarting process
+    {{KF_RAMP(160.0f, -75.0f, 2.0f), KF_RAMP(850.0f, -350.0f, 15.0f), KF_RAMP(2.5f, 2.5f, 0.15f)},
+     35, 57.0f, 80.0f, -76.0f, KF_ACTIONS(plcRecovery)},
+}};
+
+// Indexed by demo profile
+static const ScenarioDef_t* const scenarioDefs[DEMO_COUNT] = {
+    &cncScenario, &chillerScenario, &compressorScenario, &plcScenario
+};
+
+#endif // SCENARIO_TABLES_H
@@ -1,12 +1,71 @@
 // SIGNALTAP Simulation Engine Implementation
 // Physics-correlated, scenario-driven simulation for all 4 demo profiles
 #include "simulation_engine.h"
+#include "alarm_rules.h"
+#include "scenario_tables.h"
+#include "../../config.h"
 #include <math.h>
 #include <string.h>
 #include <stdio.h>
 
+#define LOAD_ACQ(x)         __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_REL(x, v)     __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+
 static SimEngine_t engine;
 
+// Only the CNC profile has an instrumented spindle. Once the vibration
+// task runs, it owns the analyzer and synth; the tick posts the spindle
+// state and takes the diagnosis back, each through a one-slot mailbox.
+typedef struct {
+    float rpm;
+    float severity;
+    VibDefect_t defect;
+    uint8_t full;
+} VibRequest_t;
+
+typedef struct {
+    VibResult_t result;
+    VibStats_t stats;
+    uint8_t full;
+} VibReport_t;
+
+static VibAnalyzer_t spindleVib;
+static VibSynth_t spindleSynth;
+static VibRequest_t vibRequest;
+static VibReport_t vibReport;
+static bool vibTask = false;
+static VibResult_t vibResult;       // Latest diagnosis taken in by the tick
+static VibStats_t vibStats;
+static uint32_t vibInlineAt = 0;    // Simulated clock of the next inline acquisition
+static char vibInsight[SIM_VIB_TEXT_LEN];
+
+// Full-rate history per demo, compressed in PSRAM
+static HistoryBlock_t blocks[DEMO_COUNT];
+
+// Alarm occurrence log per demo (PSRAM, allocated once)
+static AlarmRecord_t* alarmLogs[DEMO_COUNT];
+
+// Trend rollups of a demo's 3 sensors (PSRAM, allocated once, ~24 KB each)
+static HistoryRollup_t* rollups[DEMO_COUNT];
+
+// Threshold rules of all demos, compiled once from alarm_rules.h
+static RuleSet_t alarmRuleSet;
+
+#if ENABLE_TS_STORE
+// One store file per demo on the FAT partition; once the store task runs
+// it does all their file writes
+static TsStore_t stores[DEMO_COUNT];
+static bool storeTask = false;
+#endif
+
+// Stream capture of the active demo, and a capture replayed in its place
+static CaptureWriter_t capWriter;
+static bool capturing = false;
+static uint8_t captureDemo;
+static CaptureReader_t replay;
+static bool replaying = false;
+static char replayText[3][CAPTURE_TEXT_LEN];   // Vision strings of the replayed tick
+
 // ============ Helper: Smooth approach to target ============
 static float approach(float current, float target, float rate) {
     float diff = target - current;
@@ -20,79 +79,100 @@ static float clampf(float val, float lo, float hi) {
     return val;
 }
 
-// ============ Helper: Add noise ============
-static float noise(float amplitude) {
-    return (random(-1000, 1001) / 1000.0f) * amplitude;
-}
-
-// ============ Helper: Push to ring buffer ============
-static void history_push(SensorHistory_t* h, float value) {
+// ============ Helper: Push to ring buffer (and rollup tiers) ============
+static void history_push(SensorHistory_t* h, uint32_t t, float value) {
     h->buffer[h->head] = value;
     h->head = (h->head + 1) % SENSOR_HISTORY_LEN;
     if (h->count < SENSOR_HISTORY_LEN) h->count++;
+    if (h->rollup) rollup_push(h->rollup, t, value);
 }
 
-// ============ Helper: Format current time string ============
-static void format_time(char* buf, size_t len) {
-    unsigned long s = millis() / 1000;
-    uint8_t h = (s / 3600) % 24;
-    uint8_t m = (s / 60) % 60;
-    uint8_t sec = s % 60;
-    snprintf(buf, len, "%02d:%02d:%02d", h, m, sec);
+// ============ Helper: Record one sample of all sensors ============
+static void record_sample(uint8_t d, uint32_t t, const float* values) {
+    SimState_t* sim = &engine.demos[d];
+    for (int i = 0; i < 3; i++) history_push(&sim->history[i], t, values[i]);
+    hblock_append(&blocks[d], t, values);
 }
 
-// ============ Helper: Add dynamic alarm ============
-static void add_alarm(SimState_t* sim, const char* severity, const char* message) {
-    // Don't duplicate - check if same message already active
-    for (int i = 0; i < sim->dynamicAlarmCount; i++) {
-        if (sim->dynamicAlarms[i].active && strcmp(sim->dynamicAlarms[i].message, message) == 0) {
-            return;  // Already exists
-        }
-    }
+#if ENABLE_TS_STORE
+// ============ Helper: Replay stored samples into history ============
+static void restore_sample(uint32_t t, const float* values, void* ctx) {
+    record_sample((uint8_t)(intptr_t)ctx, t, values);
+}
 
-    // Find empty slot or use oldest
-    int slot = -1;
-    for (int i = 0; i < MAX_DYNAMIC_ALARMS; i++) {
-        if (!sim->dynamicAlarms[i].active) {
-            slot = i;
-            break;
+static void restore_history(uint8_t d, SimState_t* sim) {
+    char path[16];
+    snprintf(path, sizeof(path), "/ts%d.dat", d);
+    if (!ts_open(&stores[d], path)) return;
+
+    uint32_t latest = ts_latest_time(&stores[d]);
+    if (latest == 0) return;
+    uint32_t from = latest > SIM_TS_RESTORE_S ? latest - SIM_TS_RESTORE_S : 0;
+    ts_query(&stores[d], from, latest, restore_sample, (void*)(intptr_t)d);
+    sim->timeBase = latest + 1;
+}
+#endif
+
+// ============ Helper: Latest history window for the anomaly model ============
+// Fills [ANOMALY_WINDOW][3] oldest first, scaled to 0..1 by each sensor's range
+static bool history_window(uint8_t d, DemoProfile_t* demo, float* window) {
+    SimState_t* sim = &engine.demos[d];
+    if (blocks[d].ready) {
+        // Decodes only the newest chunk or two of the compressed block
+        if (hblock_read_last(&blocks[d], ANOMALY_WINDOW, window) < ANOMALY_WINDOW) return false;
+        for (int ch = 0; ch < ANOMALY_CHANNELS; ch++) {
+            float lo = demo->sensors[ch].min;
+            float span = demo->sensors[ch].max - lo;
+            if (span <= 0.0f) span = 1.0f;
+            for (int t = 0; t < ANOMALY_WINDOW; t++) {
+                float* v = &window[t * ANOMALY_CHANNELS + ch];
+                *v = (*v - lo) / span;
+            }
         }
+        return true;
     }
-    if (slot == -1) {
-        // Overwrite oldest
-        slot = 0;
-        unsigned long oldest = sim->dynamicAlarms[0].triggerTime;
-        for (int i = 1; i < MAX_DYNAMIC_ALARMS; i++) {
-            if (sim->dynamicAlarms[i].triggerTime < oldest) {
-                oldest = sim->dynamicAlarms[i].triggerTime;
-                slot = i;
-            }
+
+    for (int ch = 0; ch < ANOMALY_CHANNELS; ch++) {
+        SensorHistory_t* h = &sim->history[ch];
+        if (h->count < ANOMALY_WINDOW) return false;
+
+        float lo = demo->sensors[ch].min;
+        float span = demo->sensors[ch].max - lo;
+        if (span <= 0.0f) span = 1.0f;
+        int start = (h->head + SENSOR_HISTORY_LEN - ANOMALY_WINDOW) % SENSOR_HISTORY_LEN;
+        for (int t = 0; t < ANOMALY_WINDOW; t++) {
+            float v = h->buffer[(start + t) % SENSOR_HISTORY_LEN];
+            window[t * ANOMALY_CHANNELS + ch] = (v - lo) / span;
         }
     }
+    return true;
+}
 
-    DynamicAlarm_t* a = &sim->dynamicAlarms[slot];
-    strncpy(a->severity, severity, sizeof(a->severity) - 1);
-    a->severity[sizeof(a->severity) - 1] = '\0';
-    strncpy(a->message, message, sizeof(a->message) - 1);
-    a->message[sizeof(a->message) - 1] = '\0';
-    format_time(a->time, sizeof(a->time));
-    a->acked = false;
-    a->active = true;
-    a->triggerTime = millis();
+// ============ Helper: Raise a dynamic alarm ============
+static uint32_t alarm_now(void) {
+    return engine.clockS;
+}
 
-    if (slot >= sim->dynamicAlarmCount) {
-        sim->dynamicAlarmCount = slot + 1;
-    }
+static void add_alarm(SimState_t* sim, AlarmCode_t code) {
+    alarm_raise(&sim->alarms, code, alarm_now());
+}
+
+// ============ Helper: Apply a threshold rule transition ============
+static void rule_event(uint8_t machine, AlarmCode_t code, bool active, void* ctx) {
+    AlarmTable_t* table = &engine.demos[machine].alarms;
+    if (active) alarm_raise(table, code, *(uint32_t*)ctx);
+    else alarm_clear(table, code, *(uint32_t*)ctx);
 }
 
-// ============ Helper: Clear non-acked fault alarms on recovery ============
-static void clear_fault_alarms(SimState_t* sim) {
-    for (int i = 0; i < sim->dynamicAlarmCount; i++) {
-        DynamicAlarm_t* a = &sim->dynamicAlarms[i];
-        if (a->active && !a->acked && strcmp(a->severity, "error") == 0) {
-            a->active = false;
+// ============ Helper: Evaluate the alarm rules of every machine ============
+static void eval_alarm_rules(uint32_t now) {
+    float values[DEMO_COUNT * RULE_SENSORS_PER_MACHINE];
+    for (int d = 0; d < DEMO_COUNT; d++) {
+        for (int i = 0; i < RULE_SENSORS_PER_MACHINE; i++) {
+            values[d * RULE_SENSORS_PER_MACHINE + i] = demoProfiles[d].sensors[i].value;
         }
     }
+    rule_eval(&alarmRuleSet, values, rule_event, &now);
 }
 
 // ============ State Transition ============
@@ -120,453 +200,193 @@ static ScenarioState_t next_state(ScenarioState_t current) {
 
 static void transition_state(SimState_t* sim) {
     sim->scenarioState = next_state(sim->scenarioState);
-    sim->stateEnteredAt = millis();
+    sim->stateEnteredAt = engine.clockS;
     sim->stateTimer = 0;
 
     if (sim->scenarioState == SCENARIO_NORMAL) {
         sim->cycleCount++;
     }
-
-    if (sim->scenarioState == SCENARIO_RECOVERY) {
-        clear_fault_alarms(sim);
-    }
 }
 
 // ================================================================
-// Per-Demo Physics Models
-// Each demo has correlated sensor behavior based on scenario state
+// Per-Demo Scenario Keyframes
+// Each demo's correlated sensor behavior lives in scenario_tables.h
 // ================================================================
 
-// ============ CNC Machine Shop Physics ============
-static void update_cnc(DemoProfile_t* demo, SimState_t* sim) {
+// ============ Helper: Run the active demo's keyframe ============
+static void update_scenario(uint8_t d, DemoProfile_t* demo, SimState_t* sim) {
     float progress = sim->stateTimer / (float)get_state_duration(sim->scenarioState);
-    Vision_t* v = &demo->vision;
+    ScenarioOutput_t out;
+    scenario_apply(scenarioDefs[d], (uint8_t)sim->scenarioState, sim->stateTimer,
+                   progress, demo, &out);
+    for (int i = 0; i < 3; i++) sim->sensorTargets[i] = out.sensorTargets[i];
+    sim->targetHealthScore = out.healthScore;
+    sim->targetFailureProb = out.failureProb;
+    if (out.notice != ALARM_NONE) add_alarm(sim, out.notice);
+}
 
-    switch (sim->scenarioState) {
-        case SCENARIO_NORMAL:
-            // Stable operation: moderate load, good coolant, mid-speed
-            sim->sensorTargets[0] = 55.0f + noise(3.0f);   // Spindle load ~55%
-            sim->sensorTargets[1] = 13.0f + noise(0.5f);   // Coolant flow ~13 L/min
-            sim->sensorTargets[2] = 4500.0f + noise(100);  // Spindle speed ~4500 RPM
-            sim->targetHealthScore = 90;
-            sim->targetFailureProb = 5.0f;
-            v->stackLight = "green";
-            v->leds.run = true; v->leds.ready = true;
-            v->leds.error = false; v->leds.fault = false;
-            // Occasional part increment
-            if (random(100) < 8) v->partCount++;
-            break;
-
-        case SCENARIO_DEGRADATION:
-            // Load rising, coolant flow dropping (filter clogging)
-            sim->sensorTargets[0] = 55.0f + progress * 25.0f + noise(2.0f);  // 55→80%
-            sim->sensorTargets[1] = 13.0f - progress * 4.0f + noise(0.3f);   // 13→9 L/min
-            sim->sensorTargets[2] = 4500.0f - progress * 500.0f + noise(80); // Slight RPM drop
-            sim->targetHealthScore = 90 - (int)(progress * 15);  // 90→75
-            sim->targetFailureProb = 5.0f + progress * 15.0f;
-            if (progress > 0.5f) v->stackLight = "yellow";
-            if (progress > 0.3f) {
-                add_alarm(sim, "info", "Spindle load trending upward");
-            }
-            if (progress > 0.7f) {
-                add_alarm(sim, "warning", "Coolant flow below optimal range");
-                v->leds.coolant = false;  // Coolant LED goes off
-            }
-            if (random(100) < 5) v->partCount++;
-            break;
-
-        case SCENARIO_WARNING:
-            // High load, low coolant, bearings heating up
-            sim->sensorTargets[0] = 82.0f + progress * 8.0f + noise(2.0f);  // 82→90%
-            sim->sensorTargets[1] = 8.5f - progress * 2.0f + noise(0.3f);   // 8.5→6.5
-            sim->sensorTargets[2] = 3800.0f - progress * 400.0f + noise(60);
-            sim->targetHealthScore = 75 - (int)(progress * 15);  // 75→60
-            sim->targetFailureProb = 20.0f + progress * 20.0f;
-            v->stackLight = "yellow";
-            add_alarm(sim, "warning", "Spindle load above 80% threshold");
-            if (progress > 0.6f) {
-                add_alarm(sim, "error", "Coolant level critically low");
-            }
-            v->leds.coolant = false;
-            if (random(100) < 3) v->partCount++;
-            break;
-
-        case SCENARIO_FAULT:
-            // Overload trip, spindle stops
-            sim->sensorTargets[0] = 95.0f + noise(3.0f);    // Pegged high
-            sim->sensorTargets[1] = 4.0f + noise(0.5f);      // Minimal flow
-            sim->sensorTargets[2] = 1000.0f * (1.0f - progress) + noise(50);  // Spinning down
-            sim->targetHealthScore = 55 - (int)(progress * 15);  // 55→40
-            sim->targetFailureProb = 65.0f + progress * 25.0f;
-            v->stackLight = "red";
-            v->leds.error = true; v->leds.fault = true;
-            v->leds.run = false; v->leds.spindle = false;
-            add_alarm(sim, "error", "FAULT: Spindle overload protection tripped");
-            // Update AI insights to reflect the fault
-            demo->ai.insights[0].severity = INSIGHT_CRITICAL;
-            demo->ai.insights[0].title = "Spindle Bearing Overload";
-            demo->ai.insights[0].description = "Bearing overload detected - immediate inspection required";
-            demo->ai.insights[0].timeframe = "immediate";
-            break;
-
-        case SCENARIO_RECOVERY:
-            // Coolant restored, load dropping, spindle restarting
-            sim->sensorTargets[0] = 90.0f - progress * 35.0f + noise(2.0f);  // 90→55%
-            sim->sensorTargets[1] = 5.0f + progress * 8.0f + noise(0.3f);    // 5→13
-            sim->sensorTargets[2] = 500.0f + progress * 4000.0f + noise(100); // Spooling up
-            sim->targetHealthScore = 45 + (int)(progress * 45);  // 45→90
-            sim->targetFailureProb = 80.0f - progress * 75.0f;
-            if (progress < 0.3f) v->stackLight = "yellow";
-            else v->stackLight = "green";
-            if (progress > 0.5f) {
-                v->leds.run = true; v->leds.spindle = true;
-                v->leds.error = false; v->leds.fault = false;
-                v->leds.coolant = true;
-            }
-            add_alarm(sim, "info", "System recovery in progress");
-            // Restore AI insights
-            demo->ai.insights[0].severity = INSIGHT_WARNING;
-            demo->ai.insights[0].title = "Spindle Bearing Wear";
-            demo->ai.insights[0].description = "Vibration pattern suggests bearing replacement in ~14 days";
-            demo->ai.insights[0].timeframe = "14 days";
-            break;
+// ============ CNC Spindle Bearing Vibration ============
+// One second of accelerometer data at the spindle speed (SIM_VIB_RATE_HZ
+// samples) through the envelope pipeline
+static void acquire_vibration(const VibRequest_t* req) {
+    int16_t block[SIM_VIB_BLOCK];
+    vib_set_rpm(&spindleVib, req->rpm);
+    for (int done = 0; done < SIM_VIB_RATE_HZ; done += SIM_VIB_BLOCK) {
+        vib_synth(&spindleSynth, block, SIM_VIB_BLOCK, SIM_VIB_RATE_HZ, req->rpm, req->defect,
+                  req->severity, NULL);
+        vib_process(&spindleVib, block, SIM_VIB_BLOCK);
     }
 }
 
-// ============ Cold Storage Chiller Physics ============
-static void update_chiller(DemoProfile_t* demo, SimState_t* sim) {
-    float progress = sim->stateTimer / (float)get_state_duration(sim->scenarioState);
-    Vision_t* v = &demo->vision;
-
-    switch (sim->scenarioState) {
-        case SCENARIO_NORMAL:
-            // Good delta-T, moderate power, stable temps
-            sim->sensorTargets[0] = 26.0f + noise(1.0f);     // Compressor power ~26 kW
-            sim->sensorTargets[1] = 2.0f + noise(0.3f);      // Supply temp ~2°C
-            sim->sensorTargets[2] = 7.5f + noise(0.3f);      // Return temp ~7.5°C
-            sim->targetHealthScore = 88;
-            sim->targetFailureProb = 5.0f;
-            v->errorCode = "---";
-            // Update KPI delta-T
-            demo->kpis[0].value = "5.5";
-            demo->kpis[3].value = "OK";
-            demo->kpis[3].good = true;
-            break;
-
-        case SCENARIO_DEGRADATION:
-            // Compressor working harder, supply temp rising, refrigerant low
-            sim->sensorTargets[0] = 26.0f + progress * 10.0f + noise(0.8f);   // 26→36 kW
-            sim->sensorTargets[1] = 2.0f + progress * 3.0f + noise(0.2f);     // 2→5°C
-            sim->sensorTargets[2] = 7.5f + progress * 2.0f + noise(0.2f);     // 7.5→9.5°C
-            sim->targetHealthScore = 88 - (int)(progress * 18);  // 88→70
-            sim->targetFailureProb = 5.0f + progress * 18.0f;
-            if (progress > 0.4f) {
-                add_alarm(sim, "warning", "Supply temperature rising above setpoint");
-                demo->kpis[0].value = "4.0";
-            }
-            if (progress > 0.7f) {
-                add_alarm(sim, "warning", "Compressor power consumption elevated");
-            }
-            break;
-
-        case SCENARIO_WARNING:
-            // High discharge pressure, poor delta-T, compressor cycling
-            sim->sensorTargets[0] = 38.0f + progress * 8.0f + noise(1.5f);   // Cycling spikes
-            sim->sensorTargets[1] = 5.5f + progress * 3.0f + noise(0.4f);    // Supply drifting
-            sim->sensorTargets[2] = 10.0f + progress * 3.0f + noise(0.3f);   // Return high
-            sim->targetHealthScore = 70 - (int)(progress * 15);
-            sim->targetFailureProb = 25.0f + progress * 20.0f;
-            add_alarm(sim, "warning", "High discharge pressure detected");
-            demo->kpis[0].value = "3.0";
-            demo->kpis[3].value = "WARN";
-            demo->kpis[3].good = false;
-            if (progress > 0.5f) v->errorCode = "E07";
-            break;
-
-        case SCENARIO_FAULT:
-            // Compressor tripped, temps rising fast
-            sim->sensorTargets[0] = 8.0f + noise(2.0f);                       // Compressor off/cycling
-            sim->sensorTargets[1] = 9.0f + progress * 6.0f + noise(0.5f);     // Supply warming fast
-            sim->sensorTargets[2] = 14.0f + progress * 5.0f + noise(0.4f);    // Return warming
-            sim->targetHealthScore = 50 - (int)(progress * 20);
-            sim->targetFailureProb = 55.0f + progress * 35.0f;
-            v->errorCode = "E07";
-            demo->kpis[3].value = "FAULT";
-            demo->kpis[3].good = false;
-            add_alarm(sim, "error", "E07: High discharge pressure - compressor tripped");
-            demo->ai.insights[0].severity = INSIGHT_CRITICAL;
-            demo->ai.insights[0].title = "Compressor Trip";
-            demo->ai.insights[0].description = "High discharge pressure caused safety cutout";
-            demo->ai.insights[0].timeframe = "immediate";
-            break;
-
-        case SCENARIO_RECOVERY:
-            // Compressor restarting, temps slowly dropping
-            sim->sensorTargets[0] = 12.0f + progress * 16.0f + noise(1.0f);   // Power ramping
-            sim->sensorTargets[1] = 14.0f - progress * 12.0f + noise(0.3f);   // Supply cooling
-            sim->sensorTargets[2] = 18.0f - progress * 10.5f + noise(0.3f);   // Return cooling
-            sim->targetHealthScore = 35 + (int)(progress * 53);
-            sim->targetFailureProb = 80.0f - progress * 75.0f;
-            if (progress > 0.3f) v->errorCode = "---";
-            if (progress > 0.6f) {
-                demo->kpis[3].value = "OK";
-                demo->kpis[3].good = true;
-                demo->kpis[0].value = "5.0";
-            }
-            add_alarm(sim, "info", "Chiller recovery - compressor restarting");
-            demo->ai.insights[0].severity = INSIGHT_WARNING;
-            demo->ai.insights[0].title = "Compressor Efficiency Drop";
-            demo->ai.insights[0].description = "Power consumption 15% above baseline - check refrigerant levels";
-            demo->ai.insights[0].timeframe = "immediate";
-            break;
+// The diagnosis replaces the bearing insight text
+static void apply_vibration(DemoProfile_t* demo) {
+    const VibResult_t* r = &vibResult;
+    if (!r->valid) return;
+    if (r->rpm < VIB_MIN_RPM) {
+        snprintf(vibInsight, sizeof(vibInsight), "Spindle stopped - bearing analysis paused");
+    } else if (r->defect != VIB_DEFECT_NONE) {
+        int b = r->defect - 1;
+        snprintf(vibInsight, sizeof(vibInsight), "%s defect: %s %.0f Hz +%.1f dB in envelope spectrum",
+                 vib_defect_name(r->defect), vib_defect_band(r->defect), r->freqHz[b], r->defectDb);
+    } else {
+        snprintf(vibInsight, sizeof(vibInsight), "Envelope clean: BPFO %+.0f, BPFI %+.0f, BSF %+.0f dB",
+                 r->levelDb[0], r->levelDb[1], r->levelDb[2]);
     }
+    demo->ai.insights[0].description = vibInsight;
 }
 
-// ============ Compressed Air System Physics ============
-static void update_compressor(DemoProfile_t* demo, SimState_t* sim) {
+// Spindle state for this tick. With the task running, it is posted when
+// the task is free and the last diagnosis is taken in; without, one
+// acquisition runs here every SIM_VIB_INLINE_S of simulated time.
+static void update_spindle_vibration(DemoProfile_t* demo, SimState_t* sim) {
     float progress = sim->stateTimer / (float)get_state_duration(sim->scenarioState);
-    Vision_t* v = &demo->vision;
+    VibRequest_t req;
+    req.rpm = demo->sensors[2].value;
 
+    // Defect grows through the cycle; the bearing is replaced during recovery
+    float severity = 0.0f;
     switch (sim->scenarioState) {
-        case SCENARIO_NORMAL:
-            // Good pressure, normal oil temp, moderate current
-            sim->sensorTargets[0] = 8.0f + noise(0.3f);      // Tank pressure ~8 bar
-            sim->sensorTargets[1] = 75.0f + noise(2.0f);     // Oil temp ~75°C
-            sim->sensorTargets[2] = 32.0f + noise(1.5f);     // Motor current ~32A
-            sim->targetHealthScore = 94;
-            sim->targetFailureProb = 3.0f;
-            v->pressure = sim->sensorTargets[0];
-            v->oilTemp = sim->sensorTargets[1];
-            v->state = "LOAD";
-            demo->kpis[3].value = "LOAD";
-            demo->kpis[3].good = true;
-            // Periodic LOAD/IDLE cycling
-            if (sim->stateTimer % 8 < 2) {
-                v->state = "IDLE";
-                demo->kpis[3].value = "IDLE";
-            }
-            break;
-
-        case SCENARIO_DEGRADATION:
-            // Oil temp rising (filter degradation), pressure dropping (leak starting)
-            sim->sensorTargets[0] = 8.0f - progress * 1.5f + noise(0.2f);     // 8→6.5 bar
-            sim->sensorTargets[1] = 75.0f + progress * 18.0f + noise(1.5f);   // 75→93°C
-            sim->sensorTargets[2] = 32.0f + progress * 8.0f + noise(1.0f);    // 32→40A (working harder)
-            sim->targetHealthScore = 94 - (int)(progress * 14);
-            sim->targetFailureProb = 3.0f + progress * 12.0f;
-            v->pressure = sim->sensorTargets[0];
-            v->oilTemp = sim->sensorTargets[1];
-            v->state = "LOAD";
-            if (progress > 0.5f) {
-                add_alarm(sim, "warning", "Oil temperature trending above normal");
-            }
-            if (progress > 0.7f) {
-                add_alarm(sim, "info", "Tank pressure below optimal - check for leaks");
-            }
-            break;
-
-        case SCENARIO_WARNING:
-            // High oil temp, low pressure, motor straining
-            sim->sensorTargets[0] = 6.2f - progress * 1.2f + noise(0.3f);    // 6.2→5 bar
-            sim->sensorTargets[1] = 95.0f + progress * 15.0f + noise(2.0f);  // 95→110°C!
-            sim->sensorTargets[2] = 42.0f + progress * 10.0f + noise(1.5f);  // 42→52A
-            sim->targetHealthScore = 80 - (int)(progress * 20);
-            sim->targetFailureProb = 18.0f + progress * 25.0f;
-            v->pressure = sim->sensorTargets[0];
-            v->oilTemp = sim->sensorTargets[1];
-            add_alarm(sim, "warning", "Oil temp approaching high limit (100C)");
-            if (progress > 0.5f) {
-                add_alarm(sim, "error", "Tank pressure critically low");
-            }
-            demo->kpis[3].value = "LOAD";
-            break;
-
-        case SCENARIO_FAULT:
-            // Thermal shutdown, motor trips
-            sim->sensorTargets[0] = 4.5f - progress * 2.5f + noise(0.2f);   // Pressure bleeding off
-            sim->sensorTargets[1] = 112.0f + noise(1.0f);                    // Oil overtemp
-            sim->sensorTargets[2] = 5.0f * (1.0f - progress) + noise(0.5f); // Motor stopping
-            sim->targetHealthScore = 55 - (int)(progress * 25);
-            sim->targetFailureProb = 50.0f + progress * 40.0f;
-            v->pressure = sim->sensorTargets[0];
-            v->oilTemp = sim->sensorTargets[1];
-            v->state = "FAULT";
-            demo->kpis[3].value = "FAULT";
-            demo->kpis[3].good = false;
-            add_alarm(sim, "error", "THERMAL SHUTDOWN: Oil temperature exceeded limit");
-            demo->ai.insights[0].severity = INSIGHT_CRITICAL;
-            demo->ai.insights[0].title = "Thermal Shutdown";
-            demo->ai.insights[0].description = "Oil overtemperature caused compressor safety shutdown";
-            demo->ai.insights[0].timeframe = "immediate";
-            break;
-
-        case SCENARIO_RECOVERY:
-            // Cooling down, motor restarting, pressure building
-            sim->sensorTargets[0] = 2.5f + progress * 5.5f + noise(0.2f);     // 2.5→8 bar
-            sim->sensorTargets[1] = 110.0f - progress * 35.0f + noise(1.0f);  // 110→75°C
-            sim->sensorTargets[2] = 5.0f + progress * 27.0f + noise(1.0f);    // 5→32A
-            sim->targetHealthScore = 35 + (int)(progress * 59);
-            sim->targetFailureProb = 85.0f - progress * 82.0f;
-            v->pressure = sim->sensorTargets[0];
-            v->oilTemp = sim->sensorTargets[1];
-            if (progress > 0.4f) {
-                v->state = "LOAD";
-                demo->kpis[3].value = "LOAD";
-                demo->kpis[3].good = true;
-            } else {
-                v->state = "IDLE";
-                demo->kpis[3].value = "IDLE";
-            }
-            add_alarm(sim, "info", "Compressor cooling down - restart in progress");
-            demo->ai.insights[0].severity = INSIGHT_WARNING;
-            demo->ai.insights[0].title = "Oil Quality Good";
-            demo->ai.insights[0].description = "Viscosity and contamination levels within spec";
-            demo->ai.insights[0].timeframe = "stable";
-            break;
+        case SCENARIO_NORMAL:       severity = 0.0f; break;
+        case SCENARIO_DEGRADATION:  severity = 0.05f + progress * 0.25f; break;
+        case SCENARIO_WARNING:      severity = 0.3f + progress * 0.4f; break;
+        case SCENARIO_FAULT:        severity = 1.0f; break;
+        case SCENARIO_RECOVERY:     severity = 0.0f; break;
+    }
+    req.severity = severity;
+    req.defect = (VibDefect_t)(VIB_DEFECT_OUTER + sim->cycleCount % VIB_DEFECT_BANDS);
+
+    if (vibTask) {
+        if (!LOAD_ACQ(vibRequest.full)) {
+            vibRequest.rpm = req.rpm;
+            vibRequest.severity = req.severity;
+            vibRequest.defect = req.defect;
+            STORE_REL(vibRequest.full, (uint8_t)1);
+        }
+        if (LOAD_ACQ(vibReport.full)) {
+            vibResult = vibReport.result;
+            vibStats = vibReport.stats;
+            STORE_REL(vibReport.full, (uint8_t)0);
+            apply_vibration(demo);
+        }
+        return;
     }
-}
 
-// ============ Custom PLC Physics ============
-static void update_plc(DemoProfile_t* demo, SimState_t* sim) {
-    float progress = sim->stateTimer / (float)get_state_duration(sim->scenarioState);
-    Vision_t* v = &demo->vision;
+    if (engine.clockS < vibInlineAt) return;
+    vibInlineAt = engine.clockS + SIM_VIB_INLINE_S;
+    acquire_vibration(&req);
+    vibResult = spindleVib.result;
+    vibStats = spindleVib.stats;
+    apply_vibration(demo);
+}
 
-    switch (sim->scenarioState) {
-        case SCENARIO_NORMAL:
-            // Stable chamber, process running
-            sim->sensorTargets[0] = 85.0f + noise(1.5f);     // Chamber temp ~85°C
-            sim->sensorTargets[1] = 500.0f + noise(15.0f);   // Chamber press ~500 mbar
-            sim->sensorTargets[2] = 5.0f + noise(0.2f);      // Compressor ~5 bar
-            sim->targetHealthScore = 92;
-            sim->targetFailureProb = 4.0f;
-            // Normal I/O pattern: alternating cycle
-            if (sim->stateTimer % 6 < 3) {
-                v->diA[0] = true; v->diA[1] = false; v->diA[2] = true;
-                v->dqA[0] = true; v->dqA[3] = true;
-            } else {
-                v->diA[0] = false; v->diA[1] = true; v->diA[2] = false;
-                v->dqA[0] = false; v->dqA[3] = false;
-            }
-            v->aq0 = 65 + (int)noise(3);
-            demo->kpis[3].value = "AUTO";
-            demo->kpis[3].good = true;
-            break;
-
-        case SCENARIO_DEGRADATION:
-            // Chamber temp drifting up, process slowing
-            sim->sensorTargets[0] = 85.0f + progress * 30.0f + noise(2.0f);   // 85→115°C
-            sim->sensorTargets[1] = 500.0f + progress * 150.0f + noise(10.0f); // 500→650 mbar
-            sim->sensorTargets[2] = 5.0f - progress * 0.8f + noise(0.15f);     // Slight pressure drop
-            sim->targetHealthScore = 92 - (int)(progress * 15);
-            sim->targetFailureProb = 4.0f + progress * 12.0f;
-            v->aq0 = 65 + (int)(progress * 20);  // Output ramping up (compensating)
-            if (progress > 0.5f) {
-                add_alarm(sim, "warning", "Chamber temperature drifting above setpoint");
-                v->diA[5] = true;  // Warning DI activates
-            }
-            break;
-
-        case SCENARIO_WARNING:
-            // Overtemp, pressure spike, cycle times extending
-            sim->sensorTargets[0] = 120.0f + progress * 40.0f + noise(3.0f);    // 120→160°C
-            sim->sensorTargets[1] = 660.0f + progress * 200.0f + noise(20.0f);  // Pressure rising
-            sim->sensorTargets[2] = 4.0f - progress * 1.0f + noise(0.2f);
-            sim->targetHealthScore = 75 - (int)(progress * 15);
-            sim->targetFailureProb = 18.0f + progress * 25.0f;
-            v->aq0 = 90 + (int)(progress * 10);  // Maxing out
-            if (v->aq0 > 100) v->aq0 = 100;
-            v->diA[5] = true; v->diA[6] = true;  // Warning + alarm DIs
-            add_alarm(sim, "warning", "Chamber temp approaching safety limit");
-            if (progress > 0.7f) {
-                add_alarm(sim, "error", "Pressure spike detected - process deviation");
-            }
-            break;
-
-        case SCENARIO_FAULT:
-            // Safety shutdown, all outputs off
-            sim->sensorTargets[0] = 165.0f + noise(2.0f);    // Overtemp
-            sim->sensorTargets[1] = 850.0f + noise(30.0f);   // High pressure
-            sim->sensorTargets[2] = 2.0f + noise(0.3f);      // Low air
-            sim->targetHealthScore = 50 - (int)(progress * 20);
-            sim->targetFailureProb = 55.0f + progress * 35.0f;
-            // Safety shutdown - all DQs off
-            for (int i = 0; i < 8; i++) v->dqA[i] = false;
-            v->diA[6] = true; v->diA[7] = true;  // Fault + E-stop DIs
-            v->aq0 = 0;
-            demo->kpis[3].value = "STOP";
-            demo->kpis[3].good = false;
-            add_alarm(sim, "error", "SAFETY SHUTDOWN: Chamber overtemperature");
-            demo->ai.insights[0].severity = INSIGHT_CRITICAL;
-            demo->ai.insights[0].title = "Process Safety Shutdown";
-            demo->ai.insights[0].description = "Chamber overtemperature triggered emergency stop";
-            demo->ai.insights[0].timeframe = "immediate";
-            break;
-
-        case SCENARIO_RECOVERY:
-            // Cooling, restarting process
-            sim->sensorTargets[0] = 160.0f - progress * 75.0f + noise(2.0f);    // 160→85°C
-            sim->sensorTargets[1] = 850.0f - progress * 350.0f + noise(15.0f);  // 850→500
-            sim->sensorTargets[2] = 2.5f + progress * 2.5f + noise(0.15f);      // Pressure building
-            sim->targetHealthScore = 35 + (int)(progress * 57);
-            sim->targetFailureProb = 80.0f - progress * 76.0f;
-            // Gradually restore I/O
-            if (progress > 0.4f) {
-                v->dqA[0] = true; v->dqA[3] = true;
-                v->diA[6] = false; v->diA[7] = false;
-                v->aq0 = (int)(progress * 65);
-            }
-            if (progress > 0.7f) {
-                demo->kpis[3].value = "AUTO";
-                demo->kpis[3].good = true;
-                v->diA[5] = false;
-            }
-            add_alarm(sim, "info", "Process restarting - chamber cooling");
-            demo->ai.insights[0].severity = INSIGHT_WARNING;
-            demo->ai.insights[0].title = "Process Drift Detected";
-            demo->ai.insights[0].description = "Chamber temperature variance increased 12% this week";
-            demo->ai.insights[0].timeframe = "monitoring";
-            break;
+// ============ Helper: Publish RUL prediction into the AI state ============
+static void apply_rul_prediction(DemoProfile_t* demo, SimState_t* sim, const RulPrediction_t* rul) {
+    rul_format_duration(rul->ttt, sim->rulTimeframe, sizeof(sim->rulTimeframe));
+    demo->ai.insights[0].timeframe = sim->rulTimeframe;
+    demo->ai.insights[0].confidence = rul->confidence;
+
+    // Plan maintenance at the early bound of the time-to-threshold interval
+    if (rul->tttLow < 1.0f) {
+        snprintf(sim->rulNextMaint, sizeof(sim->rulNextMaint), "Now");
+    } else if (!rul->degrading || isinf(rul->tttLow)) {
+        snprintf(sim->rulNextMaint, sizeof(sim->rulNextMaint), "Not due");
+    } else {
+        rul_format_duration(rul->tttLow, sim->rulNextMaint, sizeof(sim->rulNextMaint));
     }
+    demo->ai.nextMaintenance = sim->rulNextMaint;
 }
 
 // ================================================================
 // Main Update Loop
 // ================================================================
+
+// ============ Helper: Fresh scenario, history, alarms and trend state ============
+static void reset_demo(uint8_t d) {
+    SimState_t* sim = &engine.demos[d];
+    sim->scenarioState = SCENARIO_NORMAL;
+    sim->stateEnteredAt = engine.clockS;
+    sim->stateTimer = 0;
+    sim->cycleCount = 0;
+    if (!alarmLogs[d]) alarmLogs[d] = (AlarmRecord_t*)ps_malloc(ALARM_LOG_LEN * sizeof(AlarmRecord_t));
+    alarm_table_init(&sim->alarms, alarmLogs[d], alarmLogs[d] ? ALARM_LOG_LEN : 0);
+    sim->otaInProgress = false;
+    sim->otaProgress = 0;
+
+    // Initialize targets from current profile values
+    DemoProfile_t* demo = &demoProfiles[d];
+    if (!rollups[d]) rollups[d] = (HistoryRollup_t*)ps_malloc(3 * sizeof(HistoryRollup_t));
+    for (int i = 0; i < 3; i++) {
+        sim->sensorTargets[i] = demo->sensors[i].value;
+        sim->history[i].head = 0;
+        sim->history[i].count = 0;
+        sim->history[i].rollup = rollups[d] ? &rollups[d][i] : NULL;
+        if (sim->history[i].rollup) rollup_init(sim->history[i].rollup);
+    }
+    sim->targetHealthScore = demo->ai.healthScore;
+    sim->targetFailureProb = demo->ai.failureProbability;
+
+    sim->simTime = 0;
+    sim->timeBase = 0;
+    rul_init(&sim->rul, 100.0f - SIM_RUL_FAIL_HEALTH);
+
+    if (blocks[d].ready) hblock_clear(&blocks[d]);
+    else hblock_init(&blocks[d]);
+}
+
 void sim_init(void) {
     memset(&engine, 0, sizeof(engine));
 
-    for (int d = 0; d < DEMO_COUNT; d++) {
-        SimState_t* sim = &engine.demos[d];
-        sim->scenarioState = SCENARIO_NORMAL;
-        sim->stateEnteredAt = millis();
-        sim->stateTimer = 0;
-        sim->cycleCount = 0;
-        sim->dynamicAlarmCount = 0;
-        sim->otaInProgress = false;
-        sim->otaProgress = 0;
-
-        // Initialize targets from current profile values
-        DemoProfile_t* demo = &demoProfiles[d];
-        for (int i = 0; i < 3; i++) {
-            sim->sensorTargets[i] = demo->sensors[i].value;
-            sim->history[i].head = 0;
-            sim->history[i].count = 0;
-        }
-        sim->targetHealthScore = demo->ai.healthScore;
-        sim->targetFailureProb = demo->ai.failureProbability;
+    for (int d = 0; d < DEMO_COUNT; d++) reset_demo(d);
+
+    if (alarmRuleSet.mem) rule_reset(&alarmRuleSet);
+    else rule_compile(&alarmRuleSet, alarmRules, ALARM_RULE_COUNT, DEMO_COUNT);
+
+#if ENABLE_TS_STORE
+    // Once started, the task keeps the stores open; they are not replayed
+    if (!storeTask && ts_flash_mount()) {
+        for (int d = 0; d < DEMO_COUNT; d++) restore_history(d, &engine.demos[d]);
+    }
+#endif
+
+    anomaly_init();
+    if (!vibTask) {
+        // Once started, the task keeps the analyzer it was given
+        vib_init(&spindleVib, SIM_VIB_RATE_HZ, NULL);
+        vib_synth_init(&spindleSynth, 0x5EED);
+        memset(&vibResult, 0, sizeof(vibResult));
+        memset(&vibStats, 0, sizeof(vibStats));
+        vibInlineAt = 0;
     }
 
+    capturing = false;
+    replaying = false;
+    engine.speed = SIM_SPEED < 1 ? 1 : SIM_SPEED > SIM_SPEED_MAX ? SIM_SPEED_MAX : SIM_SPEED;
     engine.lastUpdateMs = millis();
     engine.initialized = true;
 }
 
-void sim_update(void) {
-    if (!engine.initialized) return;
-
-    uint8_t demoIdx = getDemoIndex();
-    SimState_t* sim = &engine.demos[demoIdx];
-    DemoProfile_t* demo = getDemo();
-
+// ============ Helper: Scenario physics for one tick ============
+static void physics_tick(uint8_t d, DemoProfile_t* demo, SimState_t* sim, bool lastOfBatch) {
     // Increment state timer
     sim->stateTimer++;
 
@@ -575,44 +395,220 @@ void sim_update(void) {
         transition_state(sim);
     }
 
-    // Run per-demo physics model
-    switch (demoIdx) {
-        case 0: update_cnc(demo, sim); break;
-        case 1: update_chiller(demo, sim); break;
-        case 2: update_compressor(demo, sim); break;
-        case 3: update_plc(demo, sim); break;
-    }
+    // Run the demo's scenario keyframe
+    update_scenario(d, demo, sim);
+
+    if (d == 0 && lastOfBatch) update_spindle_vibration(demo, sim);
 
     // Smooth sensor values toward targets
     for (int i = 0; i < 3; i++) {
         float target = clampf(sim->sensorTargets[i], demo->sensors[i].min, demo->sensors[i].max);
         demo->sensors[i].value = approach(demo->sensors[i].value, target, 0.15f);
         demo->sensors[i].value = clampf(demo->sensors[i].value, demo->sensors[i].min, demo->sensors[i].max);
+    }
+}
+
+// ============ Helper: Field values in place of the simulated sensors ============
+// While fresh they win over the physics; once stale the physics carries on
+// from the last field value and ALARM_SYS_FIELDBUS_LOST stays up until
+// they come back.
+static void apply_field_values(DemoProfile_t* demo, SimState_t* sim, uint32_t now) {
+    if (!sim->fieldMask) return;
+
+    bool lost = false;
+    for (int i = 0; i < 3; i++) {
+        if (!(sim->fieldMask & (1 << i))) continue;
+        if (engine.clockS - sim->fieldAtS[i] <= SIM_FIELD_STALE_S) demo->sensors[i].value = sim->fieldValue[i];
+        else lost = true;
+    }
+    if (lost != sim->fieldLost) {
+        if (lost) alarm_raise(&sim->alarms, ALARM_SYS_FIELDBUS_LOST, now);
+        else alarm_clear(&sim->alarms, ALARM_SYS_FIELDBUS_LOST, now);
+        sim->fieldLost = lost;
+    }
+}
+
+// ============ Helper: Vision string from a replayed tick ============
+static const char* replay_text(const CaptureFrame_t* f, uint8_t slot, const char* s) {
+    if (!(f->textSet & (1 << slot))) return NULL;
+    // Bounded read of the frame field, which need not be terminated
+    snprintf(replayText[slot], CAPTURE_TEXT_LEN, "%.*s", CAPTURE_TEXT_LEN - 1, s);
+    return replayText[slot];
+}
+
+// ============ Helper: Drive one tick from a capture instead of the physics ============
+static void replay_apply(const CaptureFrame_t* f, DemoProfile_t* demo, SimState_t* sim, uint32_t now) {
+    ScenarioState_t state = f->scenarioState <= SCENARIO_RECOVERY ?
+                            (ScenarioState_t)f->scenarioState : SCENARIO_NORMAL;
+    if (state != sim->scenarioState) sim->stateEnteredAt = now;
+    sim->scenarioState = state;
+    sim->stateTimer = f->stateTimer;
+    sim->cycleCount = f->cycleCount;
+    sim->targetHealthScore = f->targetHealth;
+    sim->targetFailureProb = f->targetFailure;
+    for (int i = 0; i < 3; i++) {
+        demo->sensors[i].value = f->sensors[i];
+        sim->sensorTargets[i] = f->sensors[i];
+    }
+
+    Vision_t* v = &demo->vision;
+    v->partCount = f->partCount;
+    bool* leds[8] = {&v->leds.run, &v->leds.feed, &v->leds.spindle, &v->leds.coolant,
+                     &v->leds.program, &v->leds.error, &v->leds.fault, &v->leds.ready};
+    for (int i = 0; i < 8; i++) {
+        *leds[i] = (f->leds >> i) & 1;
+        v->diA[i] = (f->di >> i) & 1;
+        v->dqA[i] = (f->dq >> i) & 1;
+    }
+    v->aq0 = f->aq0;
+    v->pressure = f->pressure;
+    v->oilTemp = f->oilTemp;
+    v->stackLight = replay_text(f, 0, f->stackLight);
+    v->errorCode = replay_text(f, 1, f->errorCode);
+    v->state = replay_text(f, 2, f->runState);
+
+    // Active alarms: clear what the capture dropped, raise what it gained
+    AlarmTable_t* t = &sim->alarms;
+    for (int i = t->count - 1; i >= 0; i--) {
+        uint8_t code = t->entries[i].code;
+        if (!memchr(f->alarms, code, f->alarmCount)) alarm_clear(t, (AlarmCode_t)code, now);
+    }
+    for (uint8_t i = 0; i < f->alarmCount; i++) {
+        if (f->alarms[i] >= ALARM_CODE_COUNT) continue;
+        if (!alarm_is_active(t, (AlarmCode_t)f->alarms[i])) alarm_raise(t, (AlarmCode_t)f->alarms[i], now);
+    }
+}
+
+// ============ Helper: Append the active demo's tick to the capture ============
+static void capture_tick(const DemoProfile_t* demo, const SimState_t* sim, uint32_t t) {
+    CaptureFrame_t f;
+    memset(&f, 0, sizeof(f));
+    f.t = t;
+    for (int i = 0; i < 3; i++) f.sensors[i] = demo->sensors[i].value;
+    f.scenarioState = (uint8_t)sim->scenarioState;
+    f.cycleCount = sim->cycleCount;
+    f.stateTimer = (uint16_t)sim->stateTimer;
+    f.targetHealth = sim->targetHealthScore;
+    f.targetFailure = sim->targetFailureProb;
+
+    const Vision_t* v = &demo->vision;
+    bool leds[8] = {v->leds.run, v->leds.feed, v->leds.spindle, v->leds.coolant,
+                    v->leds.program, v->leds.error, v->leds.fault, v->leds.ready};
+    for (int i = 0; i < 8; i++) {
+        f.leds |= (uint8_t)(leds[i] << i);
+        f.di |= (uint8_t)(v->diA[i] << i);
+        f.dq |= (uint8_t)(v->dqA[i] << i);
+    }
+    f.partCount = v->partCount;
+    f.aq0 = v->aq0;
+    f.pressure = v->pressure;
+    f.oilTemp = v->oilTemp;
+    const char* texts[3] = {v->stackLight, v->errorCode, v->state};
+    char* slots[3] = {f.stackLight, f.errorCode, f.runState};
+    for (int i = 0; i < 3; i++) {
+        if (!texts[i]) continue;
+        strncpy(slots[i], texts[i], CAPTURE_TEXT_LEN - 1);
+        f.textSet |= (uint8_t)(1 << i);
+    }
+
+    f.alarmCount = alarm_count(&sim->alarms);
+    for (uint8_t i = 0; i < f.alarmCount; i++) f.alarms[i] = alarm_get(&sim->alarms, i)->code;
+
+    if (!capture_write(&capWriter, &f)) capturing = false;
+}
+
+// ============ One tick (SIM_TICK_MS of simulated time) ============
+// The bearing pipeline only feeds the insight text, so a batch of ticks
+// analyzes vibration on its last tick only (every tick at real time).
+// Returns false when a replay has run out.
+static bool sim_tick(bool lastOfBatch) {
+    const CaptureFrame_t* frame = NULL;
+    if (replaying) {
+        frame = capture_next(&replay);
+        if (!frame) {
+            replaying = false;
+            return false;
+        }
+    }
 
-        // Record history
-        history_push(&sim->history[i], demo->sensors[i].value);
+    engine.clockS += SIM_TICK_MS / 1000;
+
+    uint8_t demoIdx = getDemoIndex();
+    SimState_t* sim = &engine.demos[demoIdx];
+    DemoProfile_t* demo = getDemo();
+    if (capturing && demoIdx != captureDemo) capturing = false;  // A capture is one demo
+
+    // Alarm housekeeping (shelve expiry, chatter release, flood window)
+    uint32_t alarmNow = alarm_now();
+    for (int d = 0; d < DEMO_COUNT; d++) alarm_tick(&engine.demos[d].alarms, alarmNow);
+
+    // Physics (live field values and camera-read lamps win), or the next
+    // tick of a capture
+    if (frame) {
+        replay_apply(frame, demo, sim, alarmNow);
+    } else {
+        physics_tick(demoIdx, demo, sim, lastOfBatch);
+        apply_field_values(demo, sim, alarmNow);
+        if (sim->visionFn) sim->visionFn(sim->visionCtx, &demo->vision);
+    }
+
+    uint32_t now = frame ? frame->t : sim->timeBase + sim->simTime;
+    float values[3];
+    for (int i = 0; i < 3; i++) values[i] = demo->sensors[i].value;
+    record_sample(demoIdx, now, values);
+
+    // A replay carries its own alarms and stays out of the persistent store
+    if (!frame) {
+#if ENABLE_TS_STORE
+        ts_append(&stores[demoIdx], now, values);
+        if (!storeTask) ts_service(&stores[demoIdx]);
+#endif
+        // Threshold alarms follow the smoothed sensor values
+        eval_alarm_rules(alarmNow);
     }
 
     // Smooth AI values
     demo->ai.healthScore = (uint8_t)approach((float)demo->ai.healthScore,
                                               (float)sim->targetHealthScore, 0.12f);
-    demo->ai.failureProbability = approach(demo->ai.failureProbability,
-                                           sim->targetFailureProb, 0.1f);
 
-    // Anomaly count tied to scenario
-    switch (sim->scenarioState) {
-        case SCENARIO_NORMAL:   demo->ai.anomalyCount = 0; break;
-        case SCENARIO_DEGRADATION: demo->ai.anomalyCount = 1; break;
-        case SCENARIO_WARNING:  demo->ai.anomalyCount = 2; break;
-        case SCENARIO_FAULT:    demo->ai.anomalyCount = 3 + random(0, 2); break;
-        case SCENARIO_RECOVERY: demo->ai.anomalyCount = 1; break;
+    // Degradation trend -> time-to-failure, failure risk, maintenance date.
+    // Until the estimator has warmed up, fall back to the scenario's prior.
+    sim->simTime++;
+    rul_update(&sim->rul, (float)sim->simTime, 100.0f - (float)demo->ai.healthScore);
+    RulPrediction_t rul;
+    bool rulValid = rul_predict(&sim->rul, SIM_RUL_HORIZON_S, &rul);
+    if (rulValid) {
+        demo->ai.failureProbability = approach(demo->ai.failureProbability,
+                                               rul.failureProb, 0.3f);
+        apply_rul_prediction(demo, sim, &rul);
+    } else {
+        demo->ai.failureProbability = approach(demo->ai.failureProbability,
+                                               sim->targetFailureProb, 0.1f);
+    }
+
+    // Anomalies from the autoencoder once a full window exists,
+    // otherwise tied to the scenario
+    float window[ANOMALY_WINDOW * ANOMALY_CHANNELS];
+    AnomalyResult_t anomaly;
+    if (history_window(demoIdx, demo, window) && anomaly_score(window, &anomaly)) {
+        demo->ai.anomalyScore = anomaly.score;
+        demo->ai.anomalyCount = anomaly.channelsOver;
+    } else {
+        demo->ai.anomalyScore = 0.0f;
+        switch (sim->scenarioState) {
+            case SCENARIO_NORMAL:   demo->ai.anomalyCount = 0; break;
+            case SCENARIO_DEGRADATION: demo->ai.anomalyCount = 1; break;
+            case SCENARIO_WARNING:  demo->ai.anomalyCount = 2; break;
+            case SCENARIO_FAULT:    demo->ai.anomalyCount = 3 + random(0, 2); break;
+            case SCENARIO_RECOVERY: demo->ai.anomalyCount = 1; break;
+        }
     }
 
     // Data points always incrementing
     demo->ai.dataPoints += random(10, 40);
 
-    // Update insight confidence based on scenario
-    for (int i = 0; i < 3; i++) {
+    // Update insight confidence based on scenario (insight 0 comes from the RUL model)
+    for (int i = rulValid ? 1 : 0; i < 3; i++) {
         int baseConf;
         if (sim->scenarioState == SCENARIO_FAULT) {
             baseConf = 88 + random(0, 10);
@@ -630,13 +626,80 @@ void sim_update(void) {
         if (sim->otaProgress >= 100) {
             sim->otaProgress = 100;
             sim->otaInProgress = false;
-            add_alarm(sim, "info", "Firmware update completed successfully (v1.1.0)");
+            add_alarm(sim, ALARM_SYS_OTA_DONE);
         }
     }
 
+    if (capturing && !frame) capture_tick(demo, sim, now);
+    return true;
+}
+
+// ============ Time Base ============
+uint32_t sim_step(uint32_t dtMs, uint32_t n) {
+    if (!engine.initialized) return 0;
+
+    uint64_t total = engine.pendingMs + (uint64_t)dtMs * n;
+    uint32_t ticks = (uint32_t)(total / SIM_TICK_MS);
+    engine.pendingMs = (uint32_t)(total % SIM_TICK_MS);
+
+    unsigned long t0 = micros();
+    uint32_t ran = 0;
+    while (ran < ticks && sim_tick(ran + 1 == ticks)) ran++;
+    ticks = ran;
+
+    SimTimeStats_t* st = &engine.timeStats;
+    if (ticks > 0) {
+        uint32_t us = (uint32_t)(micros() - t0);
+        st->ticks += ticks;
+        st->lastBatchTicks = ticks;
+        st->lastBatchUs = us;
+        float perTick = us / (float)ticks;
+        st->usPerTick = (st->usPerTick == 0.0f) ? perTick : st->usPerTick * 0.9f + perTick * 0.1f;
+    }
+    return ticks;
+}
+
+uint32_t sim_update(void) {
+    if (!engine.initialized) return 0;
+
+    unsigned long now = millis();
+    uint32_t elapsed = (uint32_t)(now - engine.lastUpdateMs);
+    engine.lastUpdateMs = now;
+
+    // A long stall (flash erase, debugger) is replayed only up to a limit
+    if (elapsed > SIM_CATCHUP_MAX_MS) {
+        engine.timeStats.droppedMs += elapsed - SIM_CATCHUP_MAX_MS;
+        elapsed = SIM_CATCHUP_MAX_MS;
+    }
+
+    if (elapsed > SENSOR_UPDATE_MS) {
+        engine.timeStats.catchUpTicks += (elapsed - SENSOR_UPDATE_MS) * engine.speed / SIM_TICK_MS;
+    }
+    return sim_step(elapsed * engine.speed, 1);
+}
+
+void sim_hold(void) {
     engine.lastUpdateMs = millis();
 }
 
+void sim_set_speed(uint16_t speed) {
+    if (speed < 1) speed = 1;
+    if (speed > SIM_SPEED_MAX) speed = SIM_SPEED_MAX;
+    engine.speed = speed;
+}
+
+uint16_t sim_get_speed(void) {
+    return engine.speed;
+}
+
+uint32_t sim_get_clock(void) {
+    return engine.clockS;
+}
+
+const SimTimeStats_t* sim_get_time_stats(void) {
+    return &engine.timeStats;
+}
+
 // ============ Getters ============
 
 ScenarioState_t sim_get_scenario(void) {
@@ -655,6 +718,142 @@ const char* sim_get_scenario_name(void) {
     }
 }
 
+HistoryBlock_t* sim_get_history_block(void) {
+    return &blocks[getDemoIndex()];
+}
+
+uint16_t sim_get_trend(uint8_t sensorIndex, uint32_t spanS,
+                       RollupBucket_t* out, uint16_t maxOut, uint32_t* periodS) {
+    if (!engine.initialized || sensorIndex >= 3) return 0;
+    const HistoryRollup_t* r = engine.demos[getDemoIndex()].history[sensorIndex].rollup;
+    if (!r) return 0;
+    return rollup_query(r, spanS, out, maxOut, periodS);
+}
+
+const VibResult_t* sim_get_vibration(void) {
+    return &vibResult;
+}
+
+const VibStats_t* sim_get_vibration_stats(void) {
+    return &vibStats;
+}
+
+#if defined(ARDUINO)
+static void vib_task(void* arg) {
+    (void)arg;
+    for (;;) {
+        if (!LOAD_ACQ(vibRequest.full)) {
+            vTaskDelay(pdMS_TO_TICKS(SIM_VIB_TASK_MS));
+            continue;
+        }
+        VibRequest_t req = vibRequest;
+        STORE_REL(vibRequest.full, (uint8_t)0);
+        acquire_vibration(&req);
+        if (!LOAD_ACQ(vibReport.full)) {
+            vibReport.result = spindleVib.result;
+            vibReport.stats = spindleVib.stats;
+            STORE_REL(vibReport.full, (uint8_t)1);
+        }
+    }
+}
+
+bool sim_start_vibration_task(void) {
+    if (vibTask) return true;
+    vibTask = xTaskCreatePinnedToCore(vib_task, "vibration", SIM_VIB_TASK_STACK, NULL, 1, NULL,
+                                      tskNO_AFFINITY) == pdPASS;
+    return vibTask;
+}
+#else
+bool sim_start_vibration_task(void) {
+    return false;
+}
+#endif
+
+#if ENABLE_TS_STORE && defined(ARDUINO)
+static void store_task(void* arg) {
+    (void)arg;
+    for (;;) {
+        for (int d = 0; d < DEMO_COUNT; d++) ts_service(&stores[d]);
+        vTaskDelay(pdMS_TO_TICKS(SIM_STORE_TASK_MS));
+    }
+}
+
+bool sim_start_store_task(void) {
+    if (storeTask) return true;
+    storeTask = xTaskCreatePinnedToCore(store_task, "ts_store", 4096, NULL, 1, NULL,
+                                        tskNO_AFFINITY) == pdPASS;
+    return storeTask;
+}
+#else
+bool sim_start_store_task(void) {
+    return false;
+}
+#endif
+
+const RuleStats_t* sim_get_rule_stats(void) {
+    return rule_get_stats(&alarmRuleSet);
+}
+
+// ============ Capture / Replay ============
+bool sim_capture_start(CaptureWriteFn fn, void* ctx) {
+    if (!engine.initialized || replaying) return false;
+    uint8_t d = getDemoIndex();
+    SimState_t* sim = &engine.demos[d];
+
+    CaptureHeader_t h;
+    h.demo = d;
+    h.keyEvery = CAPTURE_KEY_EVERY;
+    h.tickMs = SIM_TICK_MS;
+    h.startT = sim->timeBase + sim->simTime;
+    h.startClock = engine.clockS;
+    captureDemo = d;
+    capturing = capture_begin(&capWriter, &h, fn, ctx);
+    return capturing;
+}
+
+void sim_capture_stop(void) {
+    capturing = false;
+}
+
+const CaptureStats_t* sim_get_capture_stats(void) {
+    return &capWriter.stats;
+}
+
+bool sim_replay_start(const uint8_t* data, uint32_t len) {
+    if (!engine.initialized || !capture_reader_init(&replay, data, len)) return false;
+    if (replay.header.demo >= DEMO_COUNT) return false;
+
+    capturing = false;
+    setDemo(replay.header.demo);
+    reset_demo(replay.header.demo);
+    replaying = true;
+    return true;
+}
+
+bool sim_replay_seek(uint32_t tick) {
+    return replaying && capture_seek(&replay, tick);
+}
+
+void sim_replay_stop(void) {
+    replaying = false;
+}
+
+bool sim_replay_active(void) {
+    return replaying;
+}
+
+const CaptureReader_t* sim_get_replay(void) {
+    return &replay;
+}
+
+const TsStats_t* sim_get_store_stats(void) {
+#if ENABLE_TS_STORE
+    return ts_get_stats(&stores[getDemoIndex()]);
+#else
+    return NULL;
+#endif
+}
+
 SensorHistory_t* sim_get_history(uint8_t sensorIndex) {
     if (!engine.initialized || sensorIndex >= 3) return NULL;
     return &engine.demos[getDemoIndex()].history[sensorIndex];
@@ -662,30 +861,32 @@ SensorHistory_t* sim_get_history(uint8_t sensorIndex) {
 
 uint8_t sim_get_alarm_count(void) {
     if (!engine.initialized) return 0;
-    SimState_t* sim = &engine.demos[getDemoIndex()];
-    uint8_t count = 0;
-    for (int i = 0; i < sim->dynamicAlarmCount; i++) {
-        if (sim->dynamicAlarms[i].active) count++;
-    }
-    return count;
+    return alarm_count(&engine.demos[getDemoIndex()].alarms);
 }
 
-DynamicAlarm_t* sim_get_alarm(uint8_t index) {
+const AlarmEntry_t* sim_get_alarm(uint8_t index) {
     if (!engine.initialized) return NULL;
-    SimState_t* sim = &engine.demos[getDemoIndex()];
-    uint8_t count = 0;
-    for (int i = 0; i < sim->dynamicAlarmCount; i++) {
-        if (sim->dynamicAlarms[i].active) {
-            if (count == index) return &sim->dynamicAlarms[i];
-            count++;
-        }
-    }
-    return NULL;
+    return alarm_get(&engine.demos[getDemoIndex()].alarms, index);
 }
 
-void sim_ack_alarm(uint8_t index) {
-    DynamicAlarm_t* a = sim_get_alarm(index);
-    if (a) a->acked = true;
+void sim_ack_alarm(AlarmCode_t code) {
+    if (!engine.initialized) return;
+    alarm_ack(&engine.demos[getDemoIndex()].alarms, code);
+}
+
+void sim_ack_alarm_record(uint32_t seq) {
+    if (!engine.initialized) return;
+    alarm_log_ack(&engine.demos[getDemoIndex()].alarms, seq);
+}
+
+void sim_shelve_alarm(AlarmCode_t code) {
+    if (!engine.initialized) return;
+    alarm_shelve(&engine.demos[getDemoIndex()].alarms, code, alarm_now(), ALARM_SHELVE_DEFAULT_S);
+}
+
+const AlarmTable_t* sim_get_alarm_table(void) {
+    if (!engine.initialized) return NULL;
+    return &engine.demos[getDemoIndex()].alarms;
 }
 
 void sim_start_ota(void) {
@@ -693,7 +894,7 @@ void sim_start_ota(void) {
     SimState_t* sim = &engine.demos[getDemoIndex()];
     sim->otaInProgress = true;
     sim->otaProgress = 0;
-    add_alarm(sim, "info", "Firmware update started - downloading v1.1.0");
+    add_alarm(sim, ALARM_SYS_OTA_STARTED);
 }
 
 bool sim_ota_active(void) {
@@ -710,3 +911,25 @@ SimState_t* sim_get_state(void) {
     if (!engine.initialized) return NULL;
     return &engine.demos[getDemoIndex()];
 }
+
+void sim_set_field_value(uint8_t machine, uint8_t sensor, float value) {
+    if (!engine.initialized || machine >= DEMO_COUNT || sensor >= 3) return;
+    SimState_t* sim = &engine.demos[machine];
+    sim->fieldValue[sensor] = value;
+    sim->fieldAtS[sensor] = engine.clockS;
+    sim->fieldMask |= (uint8_t)(1 << sensor);
+}
+
+void sim_set_vision_source(uint8_t machine, SimVisionFn fn, void* ctx) {
+    if (!engine.initialized || machine >= DEMO_COUNT) return;
+    engine.demos[machine].visionFn = fn;
+    engine.demos[machine].visionCtx = ctx;
+}
+
+void sim_set_demo(uint8_t index) {
+    setDemo(index);
+}
+
+DemoProfile_t* sim_get_demo(void) {
+    return getDemo();
+}
@@ -5,6 +5,15 @@
 
 #include <Arduino.h>
 #include "demo_profiles.h"
+#include "history_rollup.h"
+#include "history_block.h"
+#include "alarm_engine.h"
+#include "rule_engine.h"
+#include "../ai/rul_estimator.h"
+#include "../ai/anomaly_detector.h"
+#include "../dsp/vibration_analysis.h"
+#include "../storage/ts_store.h"
+#include "../storage/capture.h"
 
 // ============ Scenario States ============
 typedef enum {
@@ -22,31 +31,51 @@ typedef enum {
 #define SCENARIO_FAULT_DURATION_S       12  // 12s fault condition
 #define SCENARIO_RECOVERY_DURATION_S    10  // 10s recovery back to normal
 
+// ============ Simulated Time ============
+// The physics runs in fixed ticks of simulated time, decoupled from millis().
+// sim_update() converts wall time (times the speed factor) into ticks;
+// sim_step() advances simulated time directly, with no wall clock involved.
+#define SIM_TICK_MS         1000    // Simulated time per physics tick
+#define SIM_SPEED_MAX       1000    // Fast-forward limit for sim_update()
+#define SIM_CATCHUP_MAX_MS  10000   // Wall time replayed after a stall; beyond is dropped
+
 // ============ Sensor History ============
 #define SENSOR_HISTORY_LEN 60  // 60 data points (~1 min at 1Hz)
+#define SIM_TS_RESTORE_S   7200  // Stored history replayed into the rollups at boot
+#define SIM_STORE_TASK_MS  20    // Store writer task poll (device)
 
 typedef struct {
     float buffer[SENSOR_HISTORY_LEN];
     uint8_t head;
     uint8_t count;
+    HistoryRollup_t* rollup; // 1 s .. 1 h tiers for trend views (PSRAM, NULL without)
 } SensorHistory_t;
 
-// ============ Dynamic Alarm System ============
-#define MAX_DYNAMIC_ALARMS 8
+// ============ Remaining Useful Life ============
+// Field values (Modbus) older than this, in simulated time, fall back to
+// the simulated sensors
+#define SIM_FIELD_STALE_S     5
 
-typedef struct {
-    char severity[8];    // "error", "warning", "info"
-    char message[80];
-    char time[12];
-    bool acked;
-    bool active;         // Currently active (auto-clears on recovery)
-    unsigned long triggerTime;
-} DynamicAlarm_t;
+#define SIM_RUL_FAIL_HEALTH   50      // Health score treated as functional failure
+#define SIM_RUL_HORIZON_S     60.0f   // failureProbability horizon (demo time is compressed)
+#define SIM_RUL_TEXT_LEN      16
+
+// ============ Spindle Vibration (CNC) ============
+#define SIM_VIB_RATE_HZ       20000    // Simulated accelerometer sample rate
+#define SIM_VIB_BLOCK         500      // Samples per acquisition block
+#define SIM_VIB_TEXT_LEN      80
+#define SIM_VIB_INLINE_S      5        // Without the task: one acquisition per 5 simulated s
+#define SIM_VIB_TASK_STACK    4096
+#define SIM_VIB_TASK_MS       20       // Task idle poll for the next spindle state
+
+// Writes camera-read lamp states over the simulated ones (src/vision);
+// leaves the fields alone while it has nothing fresh
+typedef void (*SimVisionFn)(void* ctx, Vision_t* vision);
 
 // ============ Simulation State (per demo) ============
 typedef struct {
     ScenarioState_t scenarioState;
-    unsigned long stateEnteredAt;    // millis() when state was entered
+    unsigned long stateEnteredAt;    // Simulated clock (s) when state was entered
     unsigned long stateTimer;        // Seconds in current state
 
     // Sensor targets (physics model drives these, actual values smooth toward them)
@@ -55,9 +84,8 @@ typedef struct {
     // Sensor history ring buffers
     SensorHistory_t history[3];
 
-    // Dynamic alarms
-    DynamicAlarm_t dynamicAlarms[MAX_DYNAMIC_ALARMS];
-    uint8_t dynamicAlarmCount;
+    // Dynamic alarms (dense, oldest first)
+    AlarmTable_t alarms;
 
     // AI state targets
     uint8_t targetHealthScore;
@@ -66,15 +94,48 @@ typedef struct {
     // Scenario cycle counter (for variety)
     uint8_t cycleCount;
 
+    // Simulated seconds since init (time base for trend estimators)
+    uint32_t simTime;
+    // Stored-history time at init, so sample times continue across reboots
+    uint32_t timeBase;
+
+    // Degradation trend estimator driving insight[0], failure risk and maintenance
+    RulEstimator_t rul;
+    char rulTimeframe[SIM_RUL_TEXT_LEN];
+    char rulNextMaint[SIM_RUL_TEXT_LEN];
+
     // OTA simulation
     bool otaInProgress;
     uint8_t otaProgress;  // 0-100
+
+    // Values polled from the machine, in place of the physics while fresh
+    float fieldValue[3];
+    uint32_t fieldAtS[3];           // Simulated clock (sim_get_clock) of the last update
+    uint8_t fieldMask;              // Sensors that have had a field value
+    bool fieldLost;                 // ALARM_SYS_FIELDBUS_LOST raised
+
+    // Lamp states read by a camera, over the simulated vision fields
+    SimVisionFn visionFn;
+    void* visionCtx;
 } SimState_t;
 
 // ============ Engine State ============
+typedef struct {
+    uint32_t ticks;         // Physics ticks run since init
+    uint32_t catchUpTicks;  // Ticks replayed for wall time past one SENSOR_UPDATE_MS
+    uint32_t droppedMs;     // Wall time not replayed (stall over SIM_CATCHUP_MAX_MS)
+    uint32_t lastBatchTicks;
+    uint32_t lastBatchUs;
+    float usPerTick;        // Running average
+} SimTimeStats_t;
+
 typedef struct {
     SimState_t demos[DEMO_COUNT];
-    unsigned long lastUpdateMs;
+    uint32_t clockS;            // Simulated seconds since init (alarm timestamps)
+    uint32_t pendingMs;         // Simulated time not yet worth a whole tick
+    uint16_t speed;             // Simulated ms per wall ms in sim_update()
+    unsigned long lastUpdateMs; // millis() at the last sim_update() / sim_hold()
+    SimTimeStats_t timeStats;
     bool initialized;
 } SimEngine_t;
 
@@ -83,8 +144,27 @@ typedef struct {
 // Initialize the simulation engine
 void sim_init(void);
 
-// Call every SENSOR_UPDATE_MS (1 second) - drives the whole simulation
-void sim_update(void);
+// Wall-clock driver, call every SENSOR_UPDATE_MS. Runs one tick per
+// SIM_TICK_MS of wall time elapsed since the last call (times the speed),
+// so ticks lost to a stall are caught up. Returns the ticks run.
+uint32_t sim_update(void);
+
+// Advance simulated time by n x dtMs without reference to millis(): one
+// physics tick per SIM_TICK_MS, remainder carried to the next call. For
+// headless fast-forward (model training, tests); the CNC bearing analysis
+// runs on the last tick of the call only. Returns the ticks run.
+uint32_t sim_step(uint32_t dtMs, uint32_t n);
+
+// Paused: let wall time pass without advancing the simulation
+void sim_hold(void);
+
+// Fast-forward factor for sim_update(), 1..SIM_SPEED_MAX
+void sim_set_speed(uint16_t speed);
+uint16_t sim_get_speed(void);
+
+// Simulated seconds since init, and tick / catch-up counters
+uint32_t sim_get_clock(void);
+const SimTimeStats_t* sim_get_time_stats(void);
 
 // Get current scenario state for active demo
 ScenarioState_t sim_get_scenario(void);
@@ -93,10 +173,27 @@ const char* sim_get_scenario_name(void);
 // Get sensor history for sparkline rendering
 SensorHistory_t* sim_get_history(uint8_t sensorIndex);
 
-// Get dynamic alarms (merged with static profile alarms)
+// Full-rate compressed history of all 3 sensors (PSRAM, ~24 h+), read it
+// through hblock_seek_* / hblock_read without decompressing the block
+HistoryBlock_t* sim_get_history_block(void);
+
+// Rolled-up history covering the last spanS seconds (see rollup_query);
+// 0 when the rollups could not be allocated (no PSRAM)
+uint16_t sim_get_trend(uint8_t sensorIndex, uint32_t spanS,
+                       RollupBucket_t* out, uint16_t maxOut, uint32_t* periodS);
+
+// Get dynamic alarms: index 0 is the oldest active alarm
 uint8_t sim_get_alarm_count(void);
-DynamicAlarm_t* sim_get_alarm(uint8_t index);
-void sim_ack_alarm(uint8_t index);
+const AlarmEntry_t* sim_get_alarm(uint8_t index);
+void sim_ack_alarm(AlarmCode_t code);
+void sim_shelve_alarm(AlarmCode_t code);
+void sim_ack_alarm_record(uint32_t seq);   // By alarm log sequence number
+
+// Whole table: flood state, shelved codes, revision for change detection
+const AlarmTable_t* sim_get_alarm_table(void);
+
+// Threshold rule evaluation (all machines)
+const RuleStats_t* sim_get_rule_stats(void);
 
 // OTA simulation
 void sim_start_ota(void);
@@ -106,4 +203,57 @@ uint8_t sim_ota_progress(void);
 // Get the sim state for the current demo
 SimState_t* sim_get_state(void);
 
+// Live field value for a machine's sensor (Modbus poller). Used in place
+// of the simulated value while newer than SIM_FIELD_STALE_S of simulated
+// time, so a sim_step() batch ages it like the physics it replaces.
+void sim_set_field_value(uint8_t machine, uint8_t sensor, float value);
+
+// Camera reader for a machine's stack light / LEDs / IO lamps, applied
+// every tick after the physics. NULL fn detaches it.
+void sim_set_vision_source(uint8_t machine, SimVisionFn fn, void* ctx);
+
+// Demo the engine steps and reports on: setDemo()/getDemo() on the
+// engine's copy of demo_profiles.h's index and table. Both are header
+// statics, one copy per translation unit; src/net and the host tools go
+// through these to reach the engine's.
+void sim_set_demo(uint8_t index);
+DemoProfile_t* sim_get_demo(void);
+
+// CNC spindle bearing analysis (latest envelope result and pipeline load)
+const VibResult_t* sim_get_vibration(void);
+const VibStats_t* sim_get_vibration_stats(void);
+
+// Run the spindle acquisition (20k samples per simulated second) in its own
+// task instead of the tick; call once, after sim_init(). False on a host
+// build or if the task could not start: the tick then acquires one second
+// every SIM_VIB_INLINE_S.
+bool sim_start_vibration_task(void);
+
+// Do the persistent store's file writes (ENABLE_TS_STORE) in a background
+// task instead of the tick; call once, after sim_init(). False on a host
+// build, with the store disabled or if the task could not start: the tick
+// then writes its store's queued chunks itself.
+bool sim_start_store_task(void);
+
+// Persistent history store for the active demo (NULL when disabled)
+const TsStats_t* sim_get_store_stats(void);
+
+// ============ Capture / Replay ============
+// Record the active demo tick by tick through a capture sink (flash file or
+// serial, see capture.h). Stops on a demo switch or a sink error.
+bool sim_capture_start(CaptureWriteFn fn, void* ctx);
+void sim_capture_stop(void);
+const CaptureStats_t* sim_get_capture_stats(void);
+
+// Replay a capture in place of the physics. Switches to the captured demo
+// and resets its history, alarms and trend state; every tick then takes
+// sensors, scenario, vision and alarms from the next record while history,
+// AI and UI run unchanged, at whatever speed the sim is stepped. data must
+// outlive the replay, which ends by itself at the end of the capture.
+bool sim_replay_start(const uint8_t* data, uint32_t len);
+bool sim_replay_seek(uint32_t tick);            // Via the nearest keyframe
+void sim_replay_stop(void);
+bool sim_replay_active(void);
+const CaptureReader_t* sim_get_replay(void);    // Position, damaged bytes
+
 #endif // SIMULATION_ENGINE_H
@@ -0,0 +1,405 @@
+// SIGNALTAP Vibration Analysis Implementation
+// All per-sample work is integer: Q14 biquad, Q15 window/twiddles and a
+// scaled Q15 complex FFT with block-floating input normalisation.
+//
+// On the device the complex FFT is esp-dsp's dsps_fft2r_sc16, which the
+// library maps to its assembly kernel for the target (the P4's SIMD one
+// included) when the component is in the build. Everywhere else, and if
+// its table cannot be set up, it is the portable radix-4 below, which the
+// host benches check. The analysis only compares powers within a spectrum
+// (bands against the floor, the peak bin), so the two need not scale alike.
+#include "vibration_analysis.h"
+#include <math.h>
+#include <string.h>
+
+#if defined(ARDUINO) && __has_include(<esp_dsp.h>)
+#include <esp_dsp.h>
+#define VIB_ESP_DSP 1
+#endif
+
+// Default spindle bearing (angular contact, 16 balls)
+static const BearingGeometry_t defaultBearing = {16, 11.1f, 92.0f, 15.0f};
+
+// Shared tables and work buffers (one frame is analysed at a time)
+static int16_t cosTab[VIB_FFT_LEN];      // cos(2*pi*k/VIB_FFT_LEN), Q15
+static int16_t hannTab[VIB_FFT_LEN / 2]; // Symmetric half window, Q15
+static int16_t fftBuf[VIB_FFT_LEN];      // VIB_FFT_HALF interleaved complex
+static float powerBuf[VIB_FFT_HALF];
+static bool tablesReady = false;
+static bool dspReady = false;            // esp-dsp twiddle table set up
+
+// ============ Helpers ============
+static int16_t sat16(int32_t v) {
+    if (v > 32767) return 32767;
+    if (v < -32768) return -32768;
+    return (int16_t)v;
+}
+
+static int16_t q15_cos(int k) { return cosTab[k & (VIB_FFT_LEN - 1)]; }
+static int16_t q15_sin(int k) { return cosTab[(k - VIB_FFT_LEN / 4) & (VIB_FFT_LEN - 1)]; }
+
+static void init_tables(void) {
+    if (tablesReady) return;
+    for (int k = 0; k < VIB_FFT_LEN; k++) {
+        cosTab[k] = sat16((int32_t)lroundf(32768.0f * cosf(2.0f * (float)M_PI * k / VIB_FFT_LEN)));
+    }
+    for (int n = 0; n < VIB_FFT_LEN / 2; n++) {
+        float w = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * n / (VIB_FFT_LEN - 1));
+        hannTab[n] = sat16((int32_t)lroundf(32767.0f * w));
+    }
+#if VIB_ESP_DSP
+    dspReady = dsps_fft2r_init_sc16(NULL, VIB_FFT_HALF) == ESP_OK;
+#endif
+    tablesReady = true;
+}
+
+static uint32_t lcg_next(uint32_t* seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed;
+}
+
+// ============ Radix-4 Complex FFT (Q15, scaled by 1/N) ============
+// Decimation in frequency over VIB_FFT_HALF points; each stage divides by 4
+// so the butterflies never overflow. Output is base-4 digit reversed, then
+// reordered in place.
+static void fft_radix4(int16_t* x) {
+    const int N = VIB_FFT_HALF;
+
+    for (int L = N; L >= 4; L >>= 2) {
+        int q = L >> 2;
+        int twStep = (N / L) * 2;   // Index step in the 2N-point table
+        for (int j = 0; j < q; j++) {
+            int32_t c1 = q15_cos(j * twStep),     s1 = q15_sin(j * twStep);
+            int32_t c2 = q15_cos(2 * j * twStep), s2 = q15_sin(2 * j * twStep);
+            int32_t c3 = q15_cos(3 * j * twStep), s3 = q15_sin(3 * j * twStep);
+
+            for (int base = 0; base < N; base += L) {
+                int16_t* a = &x[2 * (base + j)];
+                int16_t* b = a + 2 * q;
+                int16_t* c = b + 2 * q;
+                int16_t* d = c + 2 * q;
+
+                int32_t t0r = a[0] + c[0], t0i = a[1] + c[1];
+                int32_t t1r = a[0] - c[0], t1i = a[1] - c[1];
+                int32_t t2r = b[0] + d[0], t2i = b[1] + d[1];
+                int32_t t3r = b[0] - d[0], t3i = b[1] - d[1];
+
+                // -j * t3 = (t3i, -t3r)
+                int32_t y0r = (t0r + t2r) >> 2, y0i = (t0i + t2i) >> 2;
+                int32_t y1r = (t1r + t3i) >> 2, y1i = (t1i - t3r) >> 2;
+                int32_t y2r = (t0r - t2r) >> 2, y2i = (t0i - t2i) >> 2;
+                int32_t y3r = (t1r - t3i) >> 2, y3i = (t1i + t3r) >> 2;
+
+                // Multiply by exp(-j*theta) = (cos, -sin)
+                a[0] = (int16_t)y0r;
+                a[1] = (int16_t)y0i;
+                b[0] = sat16((y1r * c1 + y1i * s1 + (1 << 14)) >> 15);
+                b[1] = sat16((y1i * c1 - y1r * s1 + (1 << 14)) >> 15);
+                c[0] = sat16((y2r * c2 + y2i * s2 + (1 << 14)) >> 15);
+                c[1] = sat16((y2i * c2 - y2r * s2 + (1 << 14)) >> 15);
+                d[0] = sat16((y3r * c3 + y3i * s3 + (1 << 14)) >> 15);
+                d[1] = sat16((y3i * c3 - y3r * s3 + (1 << 14)) >> 15);
+            }
+        }
+    }
+
+    // Undo base-4 digit reversal
+    for (int i = 0; i < N; i++) {
+        int r = 0, v = i;
+        for (int bits = 1; bits < N; bits <<= 2) {
+            r = (r << 2) | (v & 3);
+            v >>= 2;
+        }
+        if (r > i) {
+            int16_t tr = x[2 * i], ti = x[2 * i + 1];
+            x[2 * i] = x[2 * r];
+            x[2 * i + 1] = x[2 * r + 1];
+            x[2 * r] = tr;
+            x[2 * r + 1] = ti;
+        }
+    }
+}
+
+// In-place complex FFT of VIB_FFT_HALF points, natural order out
+static void fft_complex(int16_t* x) {
+#if VIB_ESP_DSP
+    if (dspReady) {
+        dsps_fft2r_sc16(x, VIB_FFT_HALF);
+        dsps_bit_rev_sc16_ansi(x, VIB_FFT_HALF);
+        return;
+    }
+#endif
+    fft_radix4(x);
+}
+
+const char* vib_fft_kernel(void) {
+    init_tables();
+    return dspReady ? "esp-dsp sc16" : "radix-4";
+}
+
+// ============ Real FFT Power Spectrum ============
+void vib_power_spectrum(const int16_t* in, float* power) {
+    init_tables();
+
+    int32_t sum = 0;
+    for (int n = 0; n < VIB_FFT_LEN; n++) sum += in[n];
+    int32_t mean = sum / VIB_FFT_LEN;
+
+    // Block floating point: scale the frame up to use the Q15 headroom
+    int32_t peak = 1;
+    for (int n = 0; n < VIB_FFT_LEN; n++) {
+        int32_t v = in[n] - mean;
+        if (v < 0) v = -v;
+        if (v > peak) peak = v;
+    }
+    int shift = 0;
+    while (shift < 14 && (peak << (shift + 1)) < 32768) shift++;
+
+    for (int n = 0; n < VIB_FFT_LEN; n++) {
+        int32_t v = (int32_t)sat16((in[n] - mean) << shift);
+        int16_t w = (n < VIB_FFT_LEN / 2) ? hannTab[n] : hannTab[VIB_FFT_LEN - 1 - n];
+        fftBuf[n] = (int16_t)((v * w) >> 15);
+    }
+
+    // Pack even/odd samples as one complex sequence, then split
+    fft_complex(fftBuf);
+
+    const int N = VIB_FFT_HALF;
+    float unscale = 1.0f / (float)(1UL << (2 * shift));
+    for (int k = 0; k < N; k++) {
+        int m = (N - k) & (N - 1);
+        int32_t zr = fftBuf[2 * k], zi = fftBuf[2 * k + 1];
+        int32_t cr = fftBuf[2 * m], ci = -fftBuf[2 * m + 1];
+
+        int32_t er = (zr + cr) >> 1, ei = (zi + ci) >> 1;
+        int32_t orr = (zr - cr) >> 1, oi = (zi - ci) >> 1;
+        // X = E + W^k * (-j * O), W^k = (cos, -sin), -j*O = (oi, -orr)
+        int32_t c = q15_cos(k), s = q15_sin(k);
+        int32_t pr = oi, pi = -orr;
+        int32_t xr = er + ((pr * c + pi * s + (1 << 14)) >> 15);
+        int32_t xi = ei + ((pi * c - pr * s + (1 << 14)) >> 15);
+        power[k] = (float)(xr * xr + xi * xi) * unscale;
+    }
+}
+
+// ============ Bearing Kinematics ============
+void vib_bearing_frequencies(const BearingGeometry_t* bearing, float rpm, float* out) {
+    const BearingGeometry_t* b = bearing ? bearing : &defaultBearing;
+    float fr = rpm / 60.0f;
+    float ratio = (b->ballDiaMm / b->pitchDiaMm) * cosf(b->contactDeg * (float)M_PI / 180.0f);
+    out[0] = 0.5f * b->balls * fr * (1.0f - ratio);                                  // BPFO
+    out[1] = 0.5f * b->balls * fr * (1.0f + ratio);                                  // BPFI
+    out[2] = (b->pitchDiaMm / (2.0f * b->ballDiaMm)) * fr * (1.0f - ratio * ratio);  // BSF
+}
+
+const char* vib_defect_name(VibDefect_t defect) {
+    switch (defect) {
+        case VIB_DEFECT_OUTER: return "Outer race";
+        case VIB_DEFECT_INNER: return "Inner race";
+        case VIB_DEFECT_BALL:  return "Rolling element";
+        default:               return "None";
+    }
+}
+
+const char* vib_defect_band(VibDefect_t defect) {
+    switch (defect) {
+        case VIB_DEFECT_OUTER: return "BPFO";
+        case VIB_DEFECT_INNER: return "BPFI";
+        case VIB_DEFECT_BALL:  return "BSF";
+        default:               return "-";
+    }
+}
+
+// ============ Frame Analysis ============
+static void spectrum(VibAnalyzer_t* va, const int16_t* in) {
+    unsigned long t0 = micros();
+    vib_power_spectrum(in, powerBuf);
+    va->stats.spectrumUs = (uint32_t)(micros() - t0);
+}
+
+static void analyze_raw(VibAnalyzer_t* va) {
+    int32_t sum = 0;
+    for (int n = 0; n < VIB_FFT_LEN; n++) sum += va->frame[n];
+    float mean = (float)sum / VIB_FFT_LEN;
+    float sq = 0.0f;
+    for (int n = 0; n < VIB_FFT_LEN; n++) {
+        float d = va->frame[n] - mean;
+        sq += d * d;
+    }
+    va->result.rmsG = sqrtf(sq / VIB_FFT_LEN) / VIB_COUNTS_PER_G;
+
+    spectrum(va, va->frame);
+    int best = 1;
+    for (int k = 2; k < VIB_FFT_HALF; k++) {
+        if (powerBuf[k] > powerBuf[best]) best = k;
+    }
+    va->result.peakHz = best * va->sampleRate / VIB_FFT_LEN;
+}
+
+static void analyze_envelope(VibAnalyzer_t* va) {
+    VibResult_t* r = &va->result;
+    float envRate = va->sampleRate / va->decim;
+    float binHz = envRate / VIB_FFT_LEN;
+
+    spectrum(va, va->env);
+
+    // Noise floor: mean power above the lowest few bins
+    float floorSum = 0.0f;
+    for (int k = 4; k < VIB_FFT_HALF; k++) floorSum += powerBuf[k];
+    float floorP = floorSum / (VIB_FFT_HALF - 4);
+    if (floorP <= 0.0f) floorP = 1.0e-12f;
+
+    r->rpm = va->rpm;
+    vib_bearing_frequencies(&va->bearing, va->rpm, r->freqHz);
+    r->defect = VIB_DEFECT_NONE;
+    r->defectDb = 0.0f;
+
+    for (int b = 0; b < VIB_DEFECT_BANDS; b++) {
+        float energy = 0.0f;
+        int bins = 0;
+        for (int h = 1; h <= VIB_HARMONICS; h++) {
+            float fc = h * r->freqHz[b];
+            // Allow ~1% slip plus window leakage around each harmonic
+            int tol = 2 + (int)(0.01f * fc / binHz);
+            int kc = (int)(fc / binHz + 0.5f);
+            if (kc + tol >= VIB_FFT_HALF) break;
+            for (int k = kc - tol; k <= kc + tol; k++) {
+                if (k < 1) continue;
+                energy += powerBuf[k];
+                bins++;
+            }
+        }
+        r->levelDb[b] = (bins > 0 && energy > 0.0f)
+            ? 10.0f * log10f(energy / (bins * floorP)) : 0.0f;
+
+        if (va->rpm >= VIB_MIN_RPM && r->levelDb[b] >= VIB_DEFECT_DB && r->levelDb[b] > r->defectDb) {
+            r->defect = (VibDefect_t)(VIB_DEFECT_OUTER + b);
+            r->defectDb = r->levelDb[b];
+        }
+    }
+
+    r->envFrames++;
+    r->valid = true;
+}
+
+// ============ Public API ============
+void vib_init(VibAnalyzer_t* va, float sampleRate, const BearingGeometry_t* bearing) {
+    init_tables();
+    memset(va, 0, sizeof(*va));
+    va->sampleRate = sampleRate > 0.0f ? sampleRate : VIB_DEFAULT_RATE_HZ;
+    va->bearing = bearing ? *bearing : defaultBearing;
+
+    int decim = (int)(va->sampleRate / VIB_ENV_RATE_HZ + 0.5f);
+    va->decim = (uint8_t)(decim < 1 ? 1 : decim);
+
+    // RBJ band-pass (0 dB peak) around the resonance, kept below Nyquist
+    float f0 = VIB_ENV_BAND_HZ;
+    if (f0 > 0.35f * va->sampleRate) f0 = 0.35f * va->sampleRate;
+    float w0 = 2.0f * (float)M_PI * f0 / va->sampleRate;
+    float alpha = sinf(w0) / (2.0f * VIB_ENV_BAND_Q);
+    float a0 = 1.0f + alpha;
+    va->b0 = (int32_t)lroundf(16384.0f * alpha / a0);
+    va->a1 = (int32_t)lroundf(16384.0f * (-2.0f * cosf(w0)) / a0);
+    va->a2 = (int32_t)lroundf(16384.0f * (1.0f - alpha) / a0);
+}
+
+void vib_set_rpm(VibAnalyzer_t* va, float rpm) {
+    va->rpm = rpm > 0.0f ? rpm : 0.0f;
+}
+
+bool vib_process(VibAnalyzer_t* va, const int16_t* samples, size_t n) {
+    unsigned long t0 = micros();
+    bool fresh = false;
+
+    for (size_t i = 0; i < n; i++) {
+        int16_t x = samples[i];
+
+        va->frame[va->frameFill++] = x;
+        if (va->frameFill >= VIB_FFT_LEN) {
+            analyze_raw(va);
+            va->frameFill = 0;
+            va->stats.frames++;
+        }
+
+        // Band-pass, full-wave rectify, box-car decimate
+        int64_t acc = (int64_t)va->b0 * (x - va->x2) - (int64_t)va->a1 * va->y1 - (int64_t)va->a2 * va->y2;
+        int32_t y = sat16((int32_t)(acc >> 14));
+        va->x2 = va->x1;
+        va->x1 = x;
+        va->y2 = va->y1;
+        va->y1 = y;
+
+        va->envAcc += (y < 0) ? -y : y;
+        if (++va->decimCount >= va->decim) {
+            va->env[va->envFill++] = (int16_t)(va->envAcc / va->decim);
+            va->envAcc = 0;
+            va->decimCount = 0;
+            if (va->envFill >= VIB_FFT_LEN) {
+                analyze_envelope(va);
+                va->envFill = 0;
+                va->stats.frames++;
+                fresh = true;
+            }
+        }
+    }
+
+    // Headroom: processing time against the time it took to acquire the block
+    uint32_t us = (uint32_t)(micros() - t0);
+    float acqUs = 1.0e6f * (float)n / va->sampleRate;
+    float load = (acqUs > 0.0f) ? 100.0f * us / acqUs : 0.0f;
+    va->stats.loadPct = (va->stats.samples == 0) ? load : 0.95f * va->stats.loadPct + 0.05f * load;
+    va->stats.headroomPct = 100.0f - va->stats.loadPct;
+    va->stats.lastBlockUs = us;
+    va->stats.samples += n;
+    return fresh;
+}
+
+// ============ Synthetic Signal ============
+void vib_synth_init(VibSynth_t* vs, uint32_t seed) {
+    memset(vs, 0, sizeof(*vs));
+    vs->seed = seed ? seed : 1;
+}
+
+void vib_synth(VibSynth_t* vs, int16_t* out, size_t n, float sampleRate, float rpm,
+               VibDefect_t defect, float severity, const BearingGeometry_t* bearing) {
+    float freqs[VIB_DEFECT_BANDS];
+    vib_bearing_frequencies(bearing, rpm, freqs);
+
+    float fr = rpm / 60.0f;
+    float fd = (defect != VIB_DEFECT_NONE) ? freqs[defect - 1] : 0.0f;
+    float fres = VIB_ENV_BAND_HZ;
+    if (fres > 0.35f * sampleRate) fres = 0.35f * sampleRate;
+    float decay = expf(-1.0f / (0.0004f * sampleRate));   // ~0.4 ms ring-down
+
+    const float imbalance = 0.05f * VIB_COUNTS_PER_G;
+    const float noiseAmp = 0.03f * VIB_COUNTS_PER_G;
+    float impact = severity * 0.5f * VIB_COUNTS_PER_G;
+
+    for (size_t i = 0; i < n; i++) {
+        vs->rotPhase += fr / sampleRate;
+        if (vs->rotPhase >= 1.0f) vs->rotPhase -= 1.0f;
+
+        if (fd > 0.0f && impact > 0.0f) {
+            vs->impactPhase += fd / sampleRate;
+            if (vs->impactPhase >= 1.0f) {
+                // Small random slip between impacts, as in a real bearing
+                float slip = ((int32_t)(lcg_next(&vs->seed) >> 16) - 32768) / 32768.0f * 0.01f;
+                vs->impactPhase -= 1.0f + slip;
+                float amp = impact;
+                // Inner race defects pass through the load zone once per revolution
+                if (defect == VIB_DEFECT_INNER) amp *= 0.6f + 0.4f * cosf(2.0f * (float)M_PI * vs->rotPhase);
+                vs->ringAmp = amp;
+            }
+        }
+
+        vs->ringPhase += fres / sampleRate;
+        if (vs->ringPhase >= 1.0f) vs->ringPhase -= 1.0f;
+
+        float noiseV = ((int32_t)(lcg_next(&vs->seed) >> 16) - 32768) / 32768.0f * noiseAmp;
+        float v = imbalance * sinf(2.0f * (float)M_PI * vs->rotPhase)
+                + vs->ringAmp * sinf(2.0f * (float)M_PI * vs->ringPhase)
+                + noiseV;
+        vs->ringAmp *= decay;
+        out[i] = sat16((int32_t)lroundf(v));
+    }
+}
@@ -0,0 +1,123 @@
+// SIGNALTAP Vibration Analysis
+// Streaming accelerometer pipeline for spindle bearing diagnosis:
+// Hann window -> Q15 real FFT (esp-dsp on the device, a portable radix-4
+// elsewhere), plus band-pass envelope demodulation with band energies at
+// the bearing defect frequencies.
+#ifndef VIBRATION_ANALYSIS_H
+#define VIBRATION_ANALYSIS_H
+
+#include <Arduino.h>
+
+// ============ Frame Geometry ============
+#define VIB_FFT_LEN          2048                 // Real samples per FFT frame
+#define VIB_FFT_HALF         (VIB_FFT_LEN / 2)    // Complex FFT length (4^5)
+#define VIB_DEFAULT_RATE_HZ  20000.0f             // Accelerometer sample rate (10-25 kHz supported)
+
+// ============ Envelope Demodulation ============
+#define VIB_ENV_RATE_HZ      5000.0f   // Target envelope rate after decimation
+#define VIB_ENV_BAND_HZ      6000.0f   // Band-pass centre (structural resonance)
+#define VIB_ENV_BAND_Q       1.4f
+#define VIB_HARMONICS        3         // Defect harmonics summed per band
+#define VIB_DEFECT_DB        6.0f      // Band level over the floor that flags a defect
+#define VIB_MIN_RPM          60.0f     // Below this the spindle counts as stopped
+#define VIB_COUNTS_PER_G     4096.0f   // ADC counts per g
+
+// ============ Bearing Defects ============
+typedef enum {
+    VIB_DEFECT_NONE = 0,
+    VIB_DEFECT_OUTER,       // BPFO - ball pass frequency, outer race
+    VIB_DEFECT_INNER,       // BPFI - ball pass frequency, inner race
+    VIB_DEFECT_BALL         // BSF  - ball spin frequency
+} VibDefect_t;
+
+#define VIB_DEFECT_BANDS 3  // Indexed by defect - 1
+
+typedef struct {
+    uint8_t balls;
+    float ballDiaMm;
+    float pitchDiaMm;
+    float contactDeg;
+} BearingGeometry_t;
+
+typedef struct {
+    float freqHz[VIB_DEFECT_BANDS];   // BPFO, BPFI, BSF at the current speed
+    float levelDb[VIB_DEFECT_BANDS];  // Harmonic band energy over the envelope floor
+    VibDefect_t defect;               // Strongest band above VIB_DEFECT_DB
+    float defectDb;
+    float rmsG;                       // Broadband RMS of the last raw frame
+    float peakHz;                     // Dominant raw spectrum frequency
+    float rpm;                        // Speed the bands were evaluated at
+    uint32_t envFrames;               // Envelope spectra evaluated
+    bool valid;
+} VibResult_t;
+
+typedef struct {
+    uint32_t samples;
+    uint32_t frames;          // Raw + envelope FFT frames
+    uint32_t lastBlockUs;
+    uint32_t spectrumUs;      // Last power spectrum (window + FFT + split) on this target
+    float loadPct;            // EWMA of processing time / acquisition time
+    float headroomPct;        // 100 - loadPct
+} VibStats_t;
+
+typedef struct {
+    float sampleRate;
+    float rpm;
+    BearingGeometry_t bearing;
+
+    // Band-pass biquad (Q14, b1 = 0, b2 = -b0)
+    int32_t b0, a1, a2;
+    int32_t x1, x2, y1, y2;
+
+    // Rectify + decimate
+    uint8_t decim;
+    uint8_t decimCount;
+    int32_t envAcc;
+
+    int16_t frame[VIB_FFT_LEN];
+    uint16_t frameFill;
+    int16_t env[VIB_FFT_LEN];
+    uint16_t envFill;
+
+    VibResult_t result;
+    VibStats_t stats;
+} VibAnalyzer_t;
+
+// Synthetic accelerometer (imbalance + impacts ringing the resonance + noise)
+typedef struct {
+    float rotPhase;
+    float impactPhase;
+    float ringPhase;
+    float ringAmp;
+    uint32_t seed;
+} VibSynth_t;
+
+// ============ Public API ============
+
+// bearing may be NULL for the default spindle bearing
+void vib_init(VibAnalyzer_t* va, float sampleRate, const BearingGeometry_t* bearing);
+
+void vib_set_rpm(VibAnalyzer_t* va, float rpm);
+
+// Feed raw samples; returns true when a new envelope result is available
+bool vib_process(VibAnalyzer_t* va, const int16_t* samples, size_t n);
+
+// BPFO, BPFI, BSF in Hz
+void vib_bearing_frequencies(const BearingGeometry_t* bearing, float rpm, float* out);
+
+// Power of bins 0..VIB_FFT_HALF-1 of a VIB_FFT_LEN frame (DC removed, Hann windowed)
+void vib_power_spectrum(const int16_t* in, float* power);
+
+// Complex FFT in use: "esp-dsp sc16" or "radix-4"
+const char* vib_fft_kernel(void);
+
+const char* vib_defect_name(VibDefect_t defect);
+const char* vib_defect_band(VibDefect_t defect);
+
+void vib_synth_init(VibSynth_t* vs, uint32_t seed);
+
+// severity 0..1 scales the defect impacts; bearing may be NULL
+void vib_synth(VibSynth_t* vs, int16_t* out, size_t n, float sampleRate, float rpm,
+               VibDefect_t defect, float severity, const BearingGeometry_t* bearing);
+
+#endif // VIBRATION_ANALYSIS_H
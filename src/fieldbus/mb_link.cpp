@@ -0,0 +1,239 @@
+// SIGNALTAP Modbus Link Implementation
+#include "mb_link.h"
+#include "../../config.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+// ============ TCP (both builds: lwIP or POSIX sockets) ============
+
+// Start the connect; the socket is open or connecting on return. A host
+// name goes through the resolver, which may wait; config.h uses addresses.
+static bool tcp_start(MbLink_t* l) {
+    char service[8];
+    snprintf(service, sizeof(service), "%u", l->port);
+    struct addrinfo hints, *res;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(l->host, service, &hints, &res) != 0) return false;
+
+    int fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    bool started = false;
+    if (fd >= 0) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        if (connect(fd, res->ai_addr, res->ai_addrlen) == 0) {
+            l->open = true;
+            started = true;
+        } else if (errno == EINPROGRESS) {
+            l->connecting = true;
+            l->connectMs = millis();
+            started = true;
+        } else {
+            close(fd);
+        }
+    }
+    freeaddrinfo(res);
+    if (started) l->fd = fd;
+    return started;
+}
+
+int mb_link_poll_connect(MbLink_t* l) {
+    if (l->open) return 1;
+    if (!l->connecting) return -1;
+
+    struct pollfd p = {l->fd, POLLOUT, 0};
+    int r = poll(&p, 1, 0);
+    if (r == 0 && (uint32_t)(millis() - l->connectMs) < MB_CONNECT_TIMEOUT_MS) return 0;
+    if (r > 0) {
+        int err = 0;
+        socklen_t len = sizeof(err);
+        if (getsockopt(l->fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0) {
+            l->connecting = false;
+            l->open = true;
+            return 1;
+        }
+    }
+    mb_link_close(l);
+    return -1;
+}
+
+static int tcp_read(MbLink_t* l, uint8_t* buf, uint16_t max) {
+    ssize_t n = recv(l->fd, buf, max, MSG_DONTWAIT);
+    if (n > 0) return (int)n;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return 0;
+    return -1;                  // Closed by the peer, or reset
+}
+
+// A request is a few bytes against a send buffer of kilobytes: if it does
+// not go whole at once, the peer has stopped reading
+static bool tcp_write(MbLink_t* l, const uint8_t* buf, uint16_t len) {
+    return send(l->fd, buf, len, MSG_DONTWAIT | MSG_NOSIGNAL) == (ssize_t)len;
+}
+
+#if defined(ARDUINO)
+
+// ============ RTU: Serial1 ============
+static uint32_t serial_config(char parity) {
+    if (parity == 'E') return SERIAL_8E1;
+    if (parity == 'O') return SERIAL_8O1;
+    return SERIAL_8N1;
+}
+
+static bool rtu_open(MbLink_t* l) {
+    Serial1.begin(l->baud, serial_config(l->parity), MODBUS_RTU_RX_PIN, MODBUS_RTU_TX_PIN);
+    Serial1.setRxFIFOFull(1);   // Hand bytes over as they arrive, for frame timing
+    if (MODBUS_RTU_DE_PIN >= 0) {
+        pinMode(MODBUS_RTU_DE_PIN, OUTPUT);
+        digitalWrite(MODBUS_RTU_DE_PIN, LOW);
+    }
+    return true;
+}
+
+static void rtu_close(MbLink_t* l) {
+    (void)l;
+    Serial1.end();
+}
+
+static int rtu_read(MbLink_t* l, uint8_t* buf, uint16_t max) {
+    (void)l;
+    int n = Serial1.available();
+    if (n <= 0) return 0;
+    return (int)Serial1.readBytes(buf, n < max ? n : max);
+}
+
+static bool rtu_write(MbLink_t* l, const uint8_t* buf, uint16_t len) {
+    (void)l;
+    // Half duplex: drive the bus only while the frame is shifted out
+    if (MODBUS_RTU_DE_PIN >= 0) digitalWrite(MODBUS_RTU_DE_PIN, HIGH);
+    bool ok = Serial1.write(buf, len) == len;
+    Serial1.flush();
+    if (MODBUS_RTU_DE_PIN >= 0) digitalWrite(MODBUS_RTU_DE_PIN, LOW);
+    return ok;
+}
+
+#else  // Host build: tty
+
+#include <termios.h>
+
+static speed_t tty_speed(uint32_t baud) {
+    switch (baud) {
+        case 1200:   return B1200;
+        case 2400:   return B2400;
+        case 4800:   return B4800;
+        case 9600:   return B9600;
+        case 19200:  return B19200;
+        case 38400:  return B38400;
+        case 57600:  return B57600;
+        case 115200: return B115200;
+        case 230400: return B230400;
+        default:     return B0;
+    }
+}
+
+static bool rtu_open(MbLink_t* l) {
+    int fd = open(l->host, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0) return false;
+
+    struct termios tio;
+    if (tcgetattr(fd, &tio) != 0) {
+        close(fd);
+        return false;
+    }
+    cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cflag &= ~(PARENB | PARODD | CSTOPB);
+    if (l->parity == 'E') tio.c_cflag |= PARENB;
+    if (l->parity == 'O') tio.c_cflag |= PARENB | PARODD;
+    speed_t sp = tty_speed(l->baud);
+    if (sp != B0) {
+        cfsetispeed(&tio, sp);
+        cfsetospeed(&tio, sp);
+    }
+    tcsetattr(fd, TCSANOW, &tio);
+    tcflush(fd, TCIOFLUSH);
+    l->fd = fd;
+    return true;
+}
+
+static void rtu_close(MbLink_t* l) {
+    close(l->fd);
+}
+
+static int rtu_read(MbLink_t* l, uint8_t* buf, uint16_t max) {
+    ssize_t n = read(l->fd, buf, max);
+    if (n > 0) return (int)n;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return 0;
+    return n == 0 ? 0 : -1;     // A tty reads 0 when there is nothing to read
+}
+
+static bool rtu_write(MbLink_t* l, const uint8_t* buf, uint16_t len) {
+    uint16_t done = 0;
+    while (done < len) {
+        ssize_t n = write(l->fd, buf + done, len - done);
+        if (n > 0) {
+            done += (uint16_t)n;
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+            struct pollfd p = {l->fd, POLLOUT, 0};
+            poll(&p, 1, MB_CONNECT_TIMEOUT_MS);
+        } else {
+            return false;
+        }
+    }
+    tcdrain(l->fd);
+    return true;
+}
+
+#endif
+
+// ============ Link (both builds) ============
+bool mb_link_reopen(MbLink_t* l) {
+    mb_link_close(l);
+    if (l->type == MB_LINK_TCP) return tcp_start(l);
+    l->open = rtu_open(l);
+    return l->open;
+}
+
+void mb_link_close(MbLink_t* l) {
+    if (!l->open && !l->connecting) return;
+    if (l->type == MB_LINK_TCP) close(l->fd);
+    else rtu_close(l);
+    l->fd = -1;
+    l->open = false;
+    l->connecting = false;
+}
+
+int mb_link_read(MbLink_t* l, uint8_t* buf, uint16_t max) {
+    if (!l->open) return -1;
+    return l->type == MB_LINK_TCP ? tcp_read(l, buf, max) : rtu_read(l, buf, max);
+}
+
+bool mb_link_write(MbLink_t* l, const uint8_t* buf, uint16_t len) {
+    if (!l->open) return false;
+    return l->type == MB_LINK_TCP ? tcp_write(l, buf, len) : rtu_write(l, buf, len);
+}
+
+// ============ Endpoint setup (both builds) ============
+bool mb_link_tcp(MbLink_t* l, const char* host, uint16_t port) {
+    l->type = MB_LINK_TCP;
+    snprintf(l->host, MB_LINK_HOST_LEN, "%s", host);
+    l->port = port;
+    return mb_link_reopen(l);
+}
+
+bool mb_link_rtu(MbLink_t* l, const char* device, uint32_t baud, char parity) {
+    l->type = MB_LINK_RTU;
+    snprintf(l->host, MB_LINK_HOST_LEN, "%s", device ? device : "");
+    l->baud = baud;
+    l->parity = parity;
+    return mb_link_reopen(l);
+}
@@ -0,0 +1,56 @@
+// SIGNALTAP Modbus Link
+// Byte transport under the Modbus master: a TCP connection or an RS-485
+// serial port. TCP is a non-blocking BSD socket on both builds (lwIP on
+// the device); RTU runs over Serial1 with an optional driver-enable pin on
+// the device and over a tty on a host build (a pty works for loopback
+// tests). Nothing on TCP blocks: mb_link_reopen() starts the connect and
+// mb_link_poll_connect() finishes it, reads take what has arrived, and a
+// frame the socket can't take whole right away fails the write. RTU writes
+// return once the frame has left.
+#ifndef MB_LINK_H
+#define MB_LINK_H
+
+#include <Arduino.h>
+
+#define MB_LINK_HOST_LEN    64
+#define MB_CONNECT_TIMEOUT_MS 1000
+
+typedef enum {
+    MB_LINK_TCP = 0,
+    MB_LINK_RTU
+} MbLinkType_t;
+
+typedef struct {
+    MbLinkType_t type;
+    char host[MB_LINK_HOST_LEN];    // TCP host, or the serial device on a host build
+    uint16_t port;
+    uint32_t baud;
+    char parity;                    // 'N', 'E' or 'O'
+    int fd;                         // Socket (TCP) or tty (host RTU)
+    uint32_t connectMs;             // TCP connect started
+    bool connecting;
+    bool open;
+} MbLink_t;
+
+// ============ Public API ============
+
+// Remember the endpoint and connect / open it. A false return leaves the
+// parameters in place for mb_link_reopen(). A TCP link may still be
+// connecting on return (connecting set, open not yet).
+bool mb_link_tcp(MbLink_t* l, const char* host, uint16_t port);
+bool mb_link_rtu(MbLink_t* l, const char* device, uint32_t baud, char parity);
+
+bool mb_link_reopen(MbLink_t* l);
+void mb_link_close(MbLink_t* l);
+
+// A connecting TCP link: 1 once open, 0 while still under way, -1 if it
+// failed or took over MB_CONNECT_TIMEOUT_MS (the link is closed then)
+int mb_link_poll_connect(MbLink_t* l);
+
+// Bytes available now, up to max: 0 if none, -1 if the link is down
+int mb_link_read(MbLink_t* l, uint8_t* buf, uint16_t max);
+
+// Whole frame or nothing; false if the link is down
+bool mb_link_write(MbLink_t* l, const uint8_t* buf, uint16_t len);
+
+#endif // MB_LINK_H
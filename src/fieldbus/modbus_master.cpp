@@ -0,0 +1,403 @@
+// SIGNALTAP Modbus Master Implementation
+#include "modbus_master.h"
+#include <string.h>
+
+// ============ Helpers: Timing, words ============
+static inline bool time_reached(uint32_t now, uint32_t at) {
+    return (int32_t)(now - at) >= 0;
+}
+
+static uint8_t tag_words(uint8_t type) {
+    return type <= MB_S16 ? 1 : 2;
+}
+
+static uint16_t get16(const uint8_t* p) {
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)(v >> 8);
+    p[1] = (uint8_t)v;
+}
+
+uint16_t mb_crc16(const uint8_t* data, uint16_t len) {
+    uint16_t crc = 0xFFFF;
+    for (uint16_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++) crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+    }
+    return crc;
+}
+
+// ============ Helper: Register words -> scaled value ============
+static float decode_tag(const MbTagDef_t* t, const uint8_t* regs) {
+    uint16_t hi = get16(regs);
+    uint16_t lo = 0;
+    if (tag_words(t->type) == 2) {
+        lo = get16(regs + 2);
+        if (t->type >= MB_U32_SWAP) {
+            uint16_t w = hi;
+            hi = lo;
+            lo = w;
+        }
+    }
+    uint32_t w = ((uint32_t)hi << 16) | lo;
+
+    float raw;
+    switch (t->type) {
+        case MB_U16:      raw = (float)hi; break;
+        case MB_S16:      raw = (float)(int16_t)hi; break;
+        case MB_U32:
+        case MB_U32_SWAP: raw = (float)w; break;
+        case MB_S32:
+        case MB_S32_SWAP: raw = (float)(int32_t)w; break;
+        default:          memcpy(&raw, &w, sizeof(raw)); break;
+    }
+    return raw * t->scale + t->offset;
+}
+
+// ============ Helper: Next read of a tag ============
+// Due tags keep their cadence (missed slots are skipped, not bunched);
+// tags read early along with a neighbour restart their period from now.
+static void reschedule(MbTagState_t* s, uint16_t periodMs, uint32_t now) {
+    uint32_t period = periodMs * 1000UL;
+    if (time_reached(now, s->dueUs)) {
+        s->dueUs += period;
+        if (time_reached(now, s->dueUs)) s->dueUs = now + period;
+    } else {
+        s->dueUs = now + period;
+    }
+}
+
+// ============ Helper: Retire a request ============
+static void release(MbMaster_t* m, MbRequest_t* r) {
+    r->used = false;
+    m->inflight--;
+}
+
+static void fail_request(MbMaster_t* m, MbRequest_t* r, uint32_t now) {
+    for (uint16_t k = r->first; k <= r->last; k++) {
+        uint16_t i = m->order[k];
+        MbTagState_t* s = &m->state[i];
+        s->busy = false;
+        if (s->fails < 0xFFFF) s->fails++;
+        reschedule(s, m->defs[i].periodMs, now);
+    }
+    release(m, r);
+}
+
+static void complete(MbMaster_t* m, MbRequest_t* r, const uint8_t* pdu, uint16_t len, uint32_t now) {
+    MbStats_t* st = &m->stats;
+    float latency = (float)(uint32_t)(now - r->sentUs);
+    st->avgLatencyUs = (st->avgLatencyUs == 0.0f) ? latency : st->avgLatencyUs * 0.95f + latency * 0.05f;
+
+    if (len >= 2 && pdu[0] == (r->fn | 0x80)) {
+        st->exceptions++;
+        st->lastException = pdu[1];
+        fail_request(m, r, now);
+        return;
+    }
+    if (len < 2 || pdu[0] != r->fn || pdu[1] != r->count * 2 || len < 2 + pdu[1]) {
+        st->badFrames++;
+        fail_request(m, r, now);
+        return;
+    }
+
+    st->responses++;
+    st->regsRead += r->count;
+    const uint8_t* regs = pdu + 2;
+    for (uint16_t k = r->first; k <= r->last; k++) {
+        uint16_t i = m->order[k];
+        const MbTagDef_t* t = &m->defs[i];
+        MbTagState_t* s = &m->state[i];
+        s->value = decode_tag(t, regs + 2 * (t->addr - r->start));
+        s->valid = true;
+        s->updatedUs = now;
+        s->fails = 0;
+        s->busy = false;
+        reschedule(s, t->periodMs, now);
+        st->tagReads++;
+        if (m->onValue) m->onValue(i, t, s->value, m->ctx);
+    }
+    release(m, r);
+}
+
+// ============ Helper: Connection lost ============
+static void link_down(MbMaster_t* m, uint32_t now) {
+    mb_link_close(m->link);
+    for (int i = 0; i < MB_MAX_INFLIGHT; i++) {
+        if (m->reqs[i].used) fail_request(m, &m->reqs[i], now);
+    }
+    m->rxLen = 0;
+    m->reconnectUs = now + MB_RECONNECT_MS * 1000UL;
+}
+
+// ============ Helper: Coalesce due tags into one read and send it ============
+static bool issue_read(MbMaster_t* m, uint32_t now) {
+    // First due tag in (unit, fn, addr) order that is not already being read
+    uint16_t k = 0;
+    while (k < m->count) {
+        const MbTagState_t* s = &m->state[m->order[k]];
+        if (!s->busy && time_reached(now, s->dueUs)) break;
+        k++;
+    }
+    if (k == m->count) return false;
+
+    // Grow the read over neighbours while the gaps stay small and the span
+    // fits one request; it ends at the last due tag taken in
+    const MbTagDef_t* t = &m->defs[m->order[k]];
+    uint32_t lo = t->addr;
+    uint32_t hi = lo + tag_words(t->type);      // One past the last register
+    uint16_t last = k;
+    uint32_t lastHi = hi;
+    for (uint16_t j = k + 1; j < m->count; j++) {
+        const MbTagDef_t* u = &m->defs[m->order[j]];
+        const MbTagState_t* s = &m->state[m->order[j]];
+        if (u->unit != t->unit || u->fn != t->fn || s->busy) break;
+        if (u->addr > hi + m->coalesceGap) break;
+        uint32_t end = (uint32_t)u->addr + tag_words(u->type);
+        if (end > hi) {
+            if (end - lo > MB_MAX_REGS) break;
+            hi = end;
+        }
+        if (time_reached(now, s->dueUs)) {
+            last = j;
+            lastHi = hi;
+        }
+    }
+
+    MbRequest_t* r = NULL;
+    for (int i = 0; i < MB_MAX_INFLIGHT && !r; i++) {
+        if (!m->reqs[i].used) r = &m->reqs[i];
+    }
+    if (!r) return false;
+
+    r->txId = m->nextTxId++;
+    r->unit = t->unit;
+    r->fn = t->fn;
+    r->start = (uint16_t)lo;
+    r->count = (uint16_t)(lastHi - lo);
+    r->first = k;
+    r->last = last;
+    r->sentUs = now;
+
+    uint8_t frame[12];
+    uint16_t n;
+    if (m->link->type == MB_LINK_TCP) {
+        put16(frame, r->txId);
+        put16(frame + 2, 0);            // Protocol id
+        put16(frame + 4, 6);            // Unit id + PDU
+        frame[6] = r->unit;
+        frame[7] = r->fn;
+        put16(frame + 8, r->start);
+        put16(frame + 10, r->count);
+        n = 12;
+    } else {
+        frame[0] = r->unit;
+        frame[1] = r->fn;
+        put16(frame + 2, r->start);
+        put16(frame + 4, r->count);
+        uint16_t crc = mb_crc16(frame, 6);
+        frame[6] = (uint8_t)crc;
+        frame[7] = (uint8_t)(crc >> 8);
+        n = 8;
+    }
+
+    for (uint16_t j = k; j <= last; j++) m->state[m->order[j]].busy = true;
+    r->used = true;
+    m->inflight++;
+    m->stats.requests++;
+    if (m->inflight > m->stats.maxInflight) m->stats.maxInflight = m->inflight;
+
+    if (!mb_link_write(m->link, frame, n)) {
+        link_down(m, now);
+        return false;
+    }
+    // RTU: the write returns once the frame is out; silence counts from there
+    if (m->link->type == MB_LINK_RTU) m->busIdleUs = micros();
+    return true;
+}
+
+// ============ Helper: TCP - split the stream on MBAP headers ============
+static void parse_tcp(MbMaster_t* m, uint32_t now) {
+    while (m->rxLen >= 8) {
+        uint16_t len = get16(m->rx + 4);
+        if (get16(m->rx + 2) != 0 || len < 3 || len > MB_ADU_MAX - 6) {
+            // Framing lost: start over on a fresh connection
+            m->stats.badFrames++;
+            link_down(m, now);
+            return;
+        }
+        uint16_t frame = 6 + len;
+        if (m->rxLen < frame) break;
+
+        // Replies may come back in any order; a reply to a request that
+        // already timed out matches nothing and is dropped. One from the
+        // wrong unit (a gateway mixing up its serial slaves) fails the read.
+        uint16_t txId = get16(m->rx);
+        for (int i = 0; i < MB_MAX_INFLIGHT; i++) {
+            MbRequest_t* r = &m->reqs[i];
+            if (r->used && r->txId == txId) {
+                if (m->rx[6] != r->unit) {
+                    m->stats.badFrames++;
+                    fail_request(m, r, now);
+                } else {
+                    complete(m, r, m->rx + 7, len - 1, now);
+                }
+                break;
+            }
+        }
+        m->rxLen -= frame;
+        memmove(m->rx, m->rx + frame, m->rxLen);
+    }
+}
+
+// ============ Helper: RTU - frame ends at its expected length ============
+static void parse_rtu(MbMaster_t* m, uint32_t now) {
+    MbRequest_t* r = NULL;
+    for (int i = 0; i < MB_MAX_INFLIGHT && !r; i++) {
+        if (m->reqs[i].used) r = &m->reqs[i];
+    }
+    if (!r) {
+        m->rxLen = 0;           // Stray bytes; they still hold off the next request
+        return;
+    }
+    if (m->rxLen < 3) return;
+
+    uint16_t need = (m->rx[1] & 0x80) ? 5 : 5 + m->rx[2];
+    if (m->rxLen < need) return;
+
+    uint16_t crc = mb_crc16(m->rx, need - 2);
+    if (m->rx[0] != r->unit || crc != (uint16_t)(m->rx[need - 2] | (m->rx[need - 1] << 8))) {
+        m->stats.badFrames++;
+        fail_request(m, r, now);
+    } else {
+        complete(m, r, m->rx + 1, need - 3, now);
+    }
+    m->rxLen = 0;               // Anything after the frame is line noise
+}
+
+// ============ Helper: Collect replies ============
+static void receive(MbMaster_t* m, uint32_t now) {
+    bool rtu = m->link->type == MB_LINK_RTU;
+    for (;;) {
+        int n = mb_link_read(m->link, m->rx + m->rxLen, sizeof(m->rx) - m->rxLen);
+        if (n < 0) {
+            link_down(m, now);
+            return;
+        }
+        if (n == 0) break;
+        m->rxLen += n;
+        m->lastRxUs = now;
+        if (rtu) {
+            m->busIdleUs = now;
+            parse_rtu(m, now);
+        } else {
+            parse_tcp(m, now);
+            if (!m->link->open) return;
+        }
+        if (m->rxLen == sizeof(m->rx)) {
+            m->stats.badFrames++;
+            m->rxLen = 0;
+        }
+    }
+
+    // RTU: a t3.5 gap ends a frame; one still short by then is broken
+    if (rtu && m->rxLen > 0 && time_reached(now, m->lastRxUs + m->t35Us)) {
+        m->stats.badFrames++;
+        m->rxLen = 0;
+        for (int i = 0; i < MB_MAX_INFLIGHT; i++) {
+            if (m->reqs[i].used) fail_request(m, &m->reqs[i], now);
+        }
+    }
+}
+
+// ============ Public API ============
+void mb_master_init(MbMaster_t* m, MbLink_t* link, const MbTagDef_t* defs, uint16_t count,
+                    MbValueFn fn, void* ctx) {
+    memset(m, 0, sizeof(*m));
+    m->link = link;
+    m->defs = defs;
+    m->count = count > MB_MAX_TAGS ? MB_MAX_TAGS : count;
+    m->onValue = fn;
+    m->ctx = ctx;
+    m->maxInflight = MB_TCP_INFLIGHT;
+    m->coalesceGap = MB_COALESCE_GAP;
+    m->timeoutUs = MB_TIMEOUT_MS * 1000UL;
+    m->nextTxId = 1;
+
+    // Inter-frame silence: 3.5 characters of 11 bits, fixed above 19200 baud
+    uint32_t baud = link->baud ? link->baud : 19200;
+    m->t35Us = baud > 19200 ? 1750 : 38500000UL / baud;
+
+    // Sort by (unit, fn, addr) so neighbours on the wire are neighbours here
+    for (uint16_t i = 0; i < m->count; i++) {
+        uint32_t key = ((uint32_t)defs[i].unit << 24) | ((uint32_t)defs[i].fn << 16) | defs[i].addr;
+        uint16_t j = i;
+        while (j > 0) {
+            const MbTagDef_t* p = &defs[m->order[j - 1]];
+            if ((((uint32_t)p->unit << 24) | ((uint32_t)p->fn << 16) | p->addr) <= key) break;
+            m->order[j] = m->order[j - 1];
+            j--;
+        }
+        m->order[j] = i;
+    }
+
+    uint32_t now = micros();
+    for (uint16_t i = 0; i < m->count; i++) m->state[i].dueUs = now;
+    m->busIdleUs = now;
+    m->reconnectUs = now;
+}
+
+void mb_master_poll(MbMaster_t* m, uint32_t nowUs) {
+    if (!m->link->open) {
+        if (!m->link->connecting) {
+            if (!time_reached(nowUs, m->reconnectUs)) return;
+            m->stats.reconnects++;
+            if (!mb_link_reopen(m->link)) {
+                m->reconnectUs = nowUs + MB_RECONNECT_MS * 1000UL;
+                return;
+            }
+        }
+        // A TCP connect finishes over later polls
+        int c = mb_link_poll_connect(m->link);
+        if (c < 0) m->reconnectUs = nowUs + MB_RECONNECT_MS * 1000UL;
+        if (c <= 0) return;
+        m->busIdleUs = nowUs;
+    }
+
+    receive(m, nowUs);
+
+    for (int i = 0; i < MB_MAX_INFLIGHT; i++) {
+        MbRequest_t* r = &m->reqs[i];
+        if (r->used && (uint32_t)(nowUs - r->sentUs) > m->timeoutUs) {
+            m->stats.timeouts++;
+            fail_request(m, r, nowUs);
+            if (m->link->type == MB_LINK_RTU) {
+                m->rxLen = 0;
+                m->busIdleUs = nowUs;
+            }
+        }
+    }
+    if (!m->link->open) return;
+
+    if (m->link->type == MB_LINK_RTU) {
+        // One transaction on the bus, then t3.5 of silence before the next
+        if (m->inflight == 0 && time_reached(nowUs, m->busIdleUs + m->t35Us)) issue_read(m, nowUs);
+        return;
+    }
+    uint8_t limit = m->maxInflight < 1 ? 1 : m->maxInflight > MB_MAX_INFLIGHT ? MB_MAX_INFLIGHT : m->maxInflight;
+    while (m->inflight < limit && m->link->open) {
+        if (!issue_read(m, nowUs)) break;
+    }
+}
+
+bool mb_master_value(const MbMaster_t* m, uint16_t tag, float* value) {
+    if (tag >= m->count || !m->state[tag].valid) return false;
+    *value = m->state[tag].value;
+    return true;
+}
+
+const MbStats_t* mb_master_stats(const MbMaster_t* m) {
+    return &m->stats;
+}
@@ -0,0 +1,144 @@
+// SIGNALTAP Modbus Master
+// Polls PLC and drive registers (functions 3 and 4) over Modbus TCP or RTU.
+// A tag names one value: unit, register, data type, scale and poll period.
+// Due tags that sit close together on the same unit and function share one
+// read - gaps of up to coalesceGap registers are read and dropped - and
+// tags inside a read that are not yet due ride along for free.
+//
+// Over TCP up to maxInflight transactions stay outstanding on the one
+// connection and are matched by transaction id, so a slow PLC scan costs
+// latency but not throughput. RTU is one transaction at a time: the bus
+// must be silent for t3.5 before each request, and a reply ends at its
+// expected length or at the first t3.5 gap. mb_master_poll() never blocks.
+#ifndef MODBUS_MASTER_H
+#define MODBUS_MASTER_H
+
+#include <Arduino.h>
+#include "mb_link.h"
+
+// ============ Limits and Defaults ============
+#define MB_MAX_TAGS         128
+#define MB_MAX_REGS         125     // Registers per read (protocol limit for FC 3/4)
+#define MB_MAX_INFLIGHT     8
+#define MB_TCP_INFLIGHT     4       // Default outstanding TCP transactions
+#define MB_ADU_MAX          260
+#define MB_COALESCE_GAP     8       // Unused registers a shared read may span
+#define MB_TIMEOUT_MS       1000
+#define MB_RECONNECT_MS     5000
+
+#define MB_FC_READ_HOLDING  3
+#define MB_FC_READ_INPUT    4
+
+// ============ Tag Types ============
+// 32-bit types take two registers, high word first; _SWAP types have the
+// low word first (CDAB order, common on drives)
+typedef enum {
+    MB_U16 = 0,
+    MB_S16,
+    MB_U32,
+    MB_S32,
+    MB_F32,
+    MB_U32_SWAP,
+    MB_S32_SWAP,
+    MB_F32_SWAP
+} MbType_t;
+
+typedef struct {
+    uint8_t unit;           // Slave / unit id
+    uint8_t fn;             // MB_FC_READ_HOLDING or MB_FC_READ_INPUT
+    uint16_t addr;          // Zero-based register address
+    uint8_t type;           // MbType_t
+    float scale;            // value = raw * scale + offset
+    float offset;
+    uint16_t periodMs;      // Poll period; 0 = as often as possible
+    uint8_t machine;        // Demo index the value belongs to
+    uint8_t sensor;         // Sensor index on that machine
+} MbTagDef_t;
+
+// ============ Runtime State ============
+typedef struct {
+    float value;
+    uint32_t dueUs;         // Next read
+    uint32_t updatedUs;     // Last good value (valid only)
+    uint16_t fails;         // Consecutive failed reads
+    bool valid;
+    bool busy;              // Part of an outstanding request
+} MbTagState_t;
+
+// One outstanding read: tags order[first..last] over start..start+count-1
+typedef struct {
+    uint16_t txId;
+    uint8_t unit;
+    uint8_t fn;
+    uint16_t start;
+    uint16_t count;
+    uint16_t first;
+    uint16_t last;
+    uint32_t sentUs;
+    bool used;
+} MbRequest_t;
+
+typedef struct {
+    uint32_t requests;
+    uint32_t responses;
+    uint32_t timeouts;
+    uint32_t exceptions;
+    uint32_t badFrames;     // CRC, length or framing errors
+    uint32_t reconnects;
+    uint32_t tagReads;      // Tag values delivered
+    uint32_t regsRead;
+    uint8_t maxInflight;    // Most requests seen outstanding at once
+    uint8_t lastException;
+    float avgLatencyUs;     // Request to reply, running average
+} MbStats_t;
+
+typedef void (*MbValueFn)(uint16_t tag, const MbTagDef_t* def, float value, void* ctx);
+
+typedef struct {
+    MbLink_t* link;
+    const MbTagDef_t* defs;
+    uint16_t count;
+    uint16_t order[MB_MAX_TAGS];        // Tag indices by (unit, fn, addr)
+    MbTagState_t state[MB_MAX_TAGS];    // Indexed like defs
+
+    // Tunables, set to the defaults above by mb_master_init()
+    uint8_t maxInflight;                // Forced to 1 on RTU
+    uint16_t coalesceGap;
+    uint32_t timeoutUs;
+
+    MbRequest_t reqs[MB_MAX_INFLIGHT];
+    uint8_t inflight;
+    uint16_t nextTxId;
+
+    uint8_t rx[MB_ADU_MAX * 2];
+    uint16_t rxLen;
+    uint32_t lastRxUs;                  // Last byte seen (RTU silence timing)
+    uint32_t busIdleUs;                 // RTU: bus quiet since
+    uint32_t t35Us;                     // RTU inter-frame silence
+    uint32_t reconnectUs;
+
+    MbValueFn onValue;
+    void* ctx;
+    MbStats_t stats;
+} MbMaster_t;
+
+// ============ Public API ============
+
+// Bind a tag table and a link (already set up with mb_link_tcp/rtu; it is
+// reopened by the master after failures). Tags beyond MB_MAX_TAGS are ignored.
+void mb_master_init(MbMaster_t* m, MbLink_t* link, const MbTagDef_t* defs, uint16_t count,
+                    MbValueFn fn, void* ctx);
+
+// Send due reads, collect replies, expire timeouts. Call as often as the
+// loop allows; nowUs is micros().
+void mb_master_poll(MbMaster_t* m, uint32_t nowUs);
+
+// Last good value of a tag; false if it has never been read
+bool mb_master_value(const MbMaster_t* m, uint16_t tag, float* value);
+
+const MbStats_t* mb_master_stats(const MbMaster_t* m);
+
+// Modbus CRC-16 (poly 0xA001, init 0xFFFF), sent low byte first
+uint16_t mb_crc16(const uint8_t* data, uint16_t len);
+
+#endif // MODBUS_MASTER_H
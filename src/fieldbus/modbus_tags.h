@@ -0,0 +1,36 @@
+// SIGNALTAP Modbus Tag Map
+// Field registers behind the sensor values of the four demo machines, one
+// unit id per machine on a shared gateway (or RS-485 segment). Edit this
+// table to match the installation; the master sorts and coalesces it, so
+// entries can be in any order. Addresses are zero-based (40001 -> 0).
+#ifndef MODBUS_TAGS_H
+#define MODBUS_TAGS_H
+
+#include "modbus_master.h"
+
+//  unit, function, address, type, scale, offset, period ms, machine, sensor
+static const MbTagDef_t modbusTags[] = {
+    // CNC Machine Shop: spindle drive parameters (input registers)
+    {1, MB_FC_READ_INPUT,    0,  MB_S16,      0.1f,  0.0f,   250, 0, 0},  // Load, 0.1 %
+    {1, MB_FC_READ_INPUT,    2,  MB_U32,      1.0f,  0.0f,   250, 0, 2},  // Speed, RPM
+    {1, MB_FC_READ_INPUT,    8,  MB_U16,      0.01f, 0.0f,   1000, 0, 1}, // Coolant, 0.01 L/min
+
+    // Cold Storage Chiller: controller floats (holding registers)
+    {2, MB_FC_READ_HOLDING,  100, MB_F32,     1.0f,  0.0f,   1000, 1, 0}, // Compressor kW
+    {2, MB_FC_READ_HOLDING,  102, MB_F32,     1.0f,  0.0f,   1000, 1, 1}, // Supply C
+    {2, MB_FC_READ_HOLDING,  104, MB_F32,     1.0f,  0.0f,   1000, 1, 2}, // Return C
+
+    // Compressed Air System: 4-20 mA inputs scaled by the PLC to 0..27648
+    {3, MB_FC_READ_INPUT,    0,  MB_U16,      12.0f / 27648.0f,  0.0f,  500, 2, 0},  // Tank bar
+    {3, MB_FC_READ_INPUT,    1,  MB_U16,      150.0f / 27648.0f, 0.0f,  1000, 2, 1}, // Oil C
+    {3, MB_FC_READ_INPUT,    4,  MB_U16,      0.1f,  0.0f,   500, 2, 2},  // Motor 0.1 A
+
+    // Custom PLC Setup: process values, word-swapped floats
+    {4, MB_FC_READ_HOLDING,  0,  MB_F32_SWAP, 1.0f,  0.0f,   500, 3, 0},  // Chamber C
+    {4, MB_FC_READ_HOLDING,  2,  MB_F32_SWAP, 1.0f,  0.0f,   250, 3, 1},  // Chamber mbar
+    {4, MB_FC_READ_HOLDING,  6,  MB_F32_SWAP, 1.0f,  0.0f,   500, 3, 2},  // Air bar
+};
+
+#define MODBUS_TAG_COUNT (sizeof(modbusTags) / sizeof(modbusTags[0]))
+
+#endif // MODBUS_TAGS_H
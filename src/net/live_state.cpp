@@ -0,0 +1,76 @@
+// SIGNALTAP Live State Snapshot Implementation
+#include "live_state.h"
+#include <string.h>
+
+// ============ Helper: Bounded text copy ("" for NULL) ============
+static void copy_text(char* dst, const char* src) {
+    if (!src) src = "";
+    strncpy(dst, src, LIVE_TEXT_LEN - 1);
+    dst[LIVE_TEXT_LEN - 1] = '\0';
+}
+
+// ============ Public API ============
+void live_init(LiveState_t* ls) {
+    memset(ls, 0, sizeof(*ls));
+}
+
+uint8_t live_publish(LiveState_t* ls, bool running) {
+    const LiveSnapshot_t* prev = &ls->slot[ls->front];
+    LiveSnapshot_t* s = &ls->slot[ls->front ^ 1];
+    const DemoProfile_t* demo = sim_get_demo();
+    const AlarmTable_t* alarms = sim_get_alarm_table();
+
+    // Zeroed first so padding and unused tails compare equal
+    memset(s, 0, sizeof(*s));
+    s->seq = prev->seq + 1;
+    s->clock = sim_get_clock();
+    s->demo = (uint8_t)demo->vision.type % DEMO_COUNT;
+    s->running = running;
+    s->scenario = (uint8_t)sim_get_scenario();
+    copy_text(s->scenarioName, sim_get_scenario_name());
+
+    for (int i = 0; i < 3; i++) {
+        s->sensors[i] = demo->sensors[i].value;
+        s->decimals[i] = demo->sensors[i].decimals;
+    }
+    for (int i = 0; i < 4; i++) {
+        copy_text(s->kpis[i].label, demo->kpis[i].label);
+        copy_text(s->kpis[i].value, demo->kpis[i].value);
+        copy_text(s->kpis[i].unit, demo->kpis[i].unit);
+        s->kpis[i].good = demo->kpis[i].good;
+    }
+
+    LiveVision_t* v = &s->vision;
+    v->v = demo->vision;
+    copy_text(v->stackLight, demo->vision.stackLight);
+    copy_text(v->errorCode, demo->vision.errorCode);
+    copy_text(v->state, demo->vision.state);
+    v->v.stackLight = v->v.errorCode = v->v.state = NULL;
+
+    if (alarms) {
+        s->alarmRevision = alarms->revision;
+        s->alarmCount = alarm_count(alarms);
+        for (uint8_t i = 0; i < s->alarmCount; i++) s->alarms[i] = *alarm_get(alarms, i);
+    }
+
+    uint8_t changed = LIVE_ALL;
+    if (prev->seq && prev->demo == s->demo) {
+        changed = 0;
+        if (prev->running != s->running || prev->scenario != s->scenario ||
+            strcmp(prev->scenarioName, s->scenarioName) != 0) {
+            changed |= LIVE_STATUS;
+        }
+        if (memcmp(prev->sensors, s->sensors, sizeof(s->sensors)) != 0) changed |= LIVE_SENSORS;
+        if (memcmp(prev->kpis, s->kpis, sizeof(s->kpis)) != 0) changed |= LIVE_KPIS;
+        if (memcmp(&prev->vision, &s->vision, sizeof(s->vision)) != 0) changed |= LIVE_VISION;
+        if (prev->alarmRevision != s->alarmRevision) changed |= LIVE_ALARMS;
+    }
+
+    ls->front ^= 1;
+    ls->changed = changed;
+    return changed;
+}
+
+const LiveSnapshot_t* live_latest(const LiveState_t* ls) {
+    return &ls->slot[ls->front];
+}
@@ -0,0 +1,74 @@
+// SIGNALTAP Live State Snapshot
+// What the web dashboard shows of the running machine, captured once per
+// tick by the loop: sensors, KPIs, vision, run status and active alarms,
+// with every string copied in (replay and scenario text can change under
+// a pointer). Two slots alternate, so after a publish the previous one is
+// still whole and readers can tell which sections changed since. Readers
+// on the loop task may hold the pointer until the next publish.
+#ifndef LIVE_STATE_H
+#define LIVE_STATE_H
+
+#include <Arduino.h>
+#include "../data/simulation_engine.h"
+
+#define LIVE_TEXT_LEN       24
+
+// Sections, as a change mask
+#define LIVE_STATUS         0x01
+#define LIVE_SENSORS        0x02
+#define LIVE_KPIS           0x04
+#define LIVE_VISION         0x08
+#define LIVE_ALARMS         0x10
+#define LIVE_ALL            0x1F
+
+typedef struct {
+    char label[LIVE_TEXT_LEN];
+    char value[LIVE_TEXT_LEN];
+    char unit[LIVE_TEXT_LEN];
+    bool good;
+} LiveKpi_t;
+
+typedef struct {
+    Vision_t v;                         // Text pointers cleared: the text is below ("" if unset)
+    char stackLight[LIVE_TEXT_LEN];
+    char errorCode[LIVE_TEXT_LEN];
+    char state[LIVE_TEXT_LEN];
+} LiveVision_t;
+
+typedef struct {
+    uint32_t seq;                       // Publish number, 0 = nothing yet
+    uint32_t clock;                     // Simulated seconds
+    uint8_t demo;
+    bool running;
+    uint8_t scenario;
+    char scenarioName[LIVE_TEXT_LEN];
+
+    float sensors[3];
+    uint8_t decimals[3];
+    LiveKpi_t kpis[4];
+    LiveVision_t vision;
+
+    uint32_t alarmRevision;
+    uint8_t alarmCount;
+    AlarmEntry_t alarms[ALARM_MAX_ACTIVE];  // Oldest first
+} LiveSnapshot_t;
+
+typedef struct {
+    LiveSnapshot_t slot[2];
+    uint8_t front;                      // Slot of the latest publish
+    uint8_t changed;                    // LIVE_* sections that differ from the one before
+} LiveState_t;
+
+// ============ Public API ============
+
+void live_init(LiveState_t* ls);
+
+// Capture the active demo into the back slot and make it the latest;
+// returns the LIVE_* sections that changed (LIVE_ALL on the first, or on
+// a demo switch)
+uint8_t live_publish(LiveState_t* ls, bool running);
+
+// Latest snapshot (seq 0 until the first publish)
+const LiveSnapshot_t* live_latest(const LiveState_t* ls);
+
+#endif // LIVE_STATE_H
@@ -0,0 +1,363 @@
+// SIGNALTAP MQTT Client Implementation
+#include "mqtt_client.h"
+#include <string.h>
+
+#define MQTT_CONNECT    0x10
+#define MQTT_CONNACK    0x20
+#define MQTT_PUBLISH    0x30
+#define MQTT_PINGREQ    0xC0
+#define MQTT_PINGRESP   0xD0
+#define MQTT_DISCONNECT 0xE0
+
+// ============ Transport (both builds: lwIP or POSIX sockets) ============
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+// Start a non-blocking connect; false if it failed outright. A host name
+// goes through the resolver, which may wait; config.h uses an address.
+static bool tcp_open(MqttClient_t* c) {
+    char service[8];
+    snprintf(service, sizeof(service), "%u", c->port);
+    struct addrinfo hints, *res;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(c->host, service, &hints, &res) != 0) return false;
+
+    c->fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    if (c->fd >= 0) {
+        int one = 1;
+        setsockopt(c->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        fcntl(c->fd, F_SETFL, fcntl(c->fd, F_GETFL, 0) | O_NONBLOCK);
+        if (connect(c->fd, res->ai_addr, res->ai_addrlen) != 0 && errno != EINPROGRESS) {
+            close(c->fd);
+            c->fd = -1;
+        }
+    }
+    freeaddrinfo(res);
+    return c->fd >= 0;
+}
+
+// 1 once the connect went through, 0 while under way, -1 if it failed
+static int tcp_connected(MqttClient_t* c) {
+    struct pollfd p = {c->fd, POLLOUT, 0};
+    if (poll(&p, 1, 0) == 0) return 0;
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (getsockopt(c->fd, SOL_SOCKET, SO_ERROR, &err, &len) != 0 || err != 0) return -1;
+    return 1;
+}
+
+static void tcp_close(MqttClient_t* c) {
+    close(c->fd);
+    c->fd = -1;
+}
+
+// Bytes accepted (possibly 0), -1 if the connection is gone
+static int tcp_write(MqttClient_t* c, const uint8_t* buf, uint32_t len) {
+    ssize_t n = send(c->fd, buf, len, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (n >= 0) return (int)n;
+    return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+}
+
+static int tcp_read(MqttClient_t* c, uint8_t* buf, uint16_t max) {
+    ssize_t n = recv(c->fd, buf, max, MSG_DONTWAIT);
+    if (n > 0) return (int)n;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return 0;
+    return -1;
+}
+
+// ============ Helpers: Encoding ============
+static uint8_t varint_len(uint32_t v) {
+    return v < 128 ? 1 : v < 16384 ? 2 : v < 2097152 ? 3 : 4;
+}
+
+static uint8_t* put_varint(uint8_t* p, uint32_t v) {
+    do {
+        uint8_t b = v & 0x7F;
+        v >>= 7;
+        *p++ = v ? (b | 0x80) : b;
+    } while (v);
+    return p;
+}
+
+static uint8_t* put_str(uint8_t* p, const char* s, uint16_t len) {
+    *p++ = (uint8_t)(len >> 8);
+    *p++ = (uint8_t)len;
+    memcpy(p, s, len);
+    return p + len;
+}
+
+// Room for len more bytes at the tail, compacting the queue if needed
+static uint8_t* reserve(MqttClient_t* c, uint32_t len) {
+    if (c->tail + len > MQTT_QUEUE_BYTES && c->head > 0) {
+        memmove(c->queue, c->queue + c->head, c->tail - c->head);
+        c->tail -= c->head;
+        c->head = 0;
+    }
+    if (c->tail + len > MQTT_QUEUE_BYTES) return NULL;
+    return c->queue + c->tail;
+}
+
+static void commit(MqttClient_t* c, uint8_t* end) {
+    c->tail = (uint32_t)(end - c->queue);
+    if (c->tail - c->head > c->stats.queueHigh) c->stats.queueHigh = c->tail - c->head;
+}
+
+// ============ Helper: Connection lost or refused ============
+static void drop(MqttClient_t* c, uint32_t now) {
+    if (c->open) tcp_close(c);
+    if (c->state == MQTT_UP) c->stats.disconnects++;
+    c->open = false;
+    c->state = MQTT_DOWN;
+    c->head = c->tail = 0;
+    c->rxLen = 0;
+    c->pingPending = false;
+    c->stateMs = now + MQTT_RECONNECT_MS;
+}
+
+// ============ Helper: Open the socket ============
+static void start_session(MqttClient_t* c, uint32_t now) {
+    if (!tcp_open(c)) {
+        c->stateMs = now + MQTT_RECONNECT_MS;
+        return;
+    }
+    c->open = true;
+    c->state = MQTT_OPENING;
+    c->stateMs = now;
+}
+
+// ============ Helper: Connected - queue CONNECT ============
+static void send_connect(MqttClient_t* c, uint32_t now) {
+    c->head = c->tail = 0;
+    c->rxLen = 0;
+
+    uint16_t idLen = (uint16_t)strlen(c->clientId);
+    uint16_t wtLen = (uint16_t)strlen(c->willTopic);
+    uint16_t wpLen = (wtLen && c->willPayload) ? (uint16_t)strlen(c->willPayload) : 0;
+    uint16_t userLen = c->user ? (uint16_t)strlen(c->user) : 0;
+    uint16_t passLen = (userLen && c->pass) ? (uint16_t)strlen(c->pass) : 0;
+
+    uint8_t flags = 0x02;                               // Clean session
+    uint32_t rem = 10 + 2 + idLen;
+    if (wtLen) {
+        flags |= 0x04 | 0x20;                           // Will, retained, QoS 0
+        rem += 2 + wtLen + 2 + wpLen;
+    }
+    if (userLen) {
+        flags |= 0x80;
+        rem += 2 + userLen;
+        if (passLen) {
+            flags |= 0x40;
+            rem += 2 + passLen;
+        }
+    }
+
+    uint8_t* p = reserve(c, 1 + varint_len(rem) + rem);
+    if (!p) {
+        drop(c, now);
+        return;
+    }
+    *p++ = MQTT_CONNECT;
+    p = put_varint(p, rem);
+    p = put_str(p, "MQTT", 4);
+    *p++ = 4;                                           // Protocol level 3.1.1
+    *p++ = flags;
+    *p++ = (uint8_t)(MQTT_KEEPALIVE_S >> 8);
+    *p++ = (uint8_t)MQTT_KEEPALIVE_S;
+    p = put_str(p, c->clientId, idLen);
+    if (wtLen) {
+        p = put_str(p, c->willTopic, wtLen);
+        p = put_str(p, c->willPayload ? c->willPayload : "", wpLen);
+    }
+    if (userLen) {
+        p = put_str(p, c->user, userLen);
+        if (passLen) p = put_str(p, c->pass, passLen);
+    }
+    commit(c, p);
+
+    c->state = MQTT_CONNECTING;
+    c->stateMs = now;
+}
+
+// ============ Helper: Acks from the broker ============
+static void receive(MqttClient_t* c, uint32_t now) {
+    for (;;) {
+        int n = tcp_read(c, c->rx + c->rxLen, MQTT_RX_BYTES - c->rxLen);
+        if (n < 0) {
+            drop(c, now);
+            return;
+        }
+        if (n == 0) return;
+        c->rxLen += n;
+
+        // Fixed header + short remaining length; nothing longer is expected
+        while (c->rxLen >= 2) {
+            uint8_t type = c->rx[0] & 0xF0;
+            uint8_t rem = c->rx[1];
+            if (rem & 0x80 || 2 + rem > MQTT_RX_BYTES) {
+                drop(c, now);
+                return;
+            }
+            if (c->rxLen < 2 + rem) break;
+
+            if (type == MQTT_CONNACK && c->state == MQTT_CONNECTING && rem >= 2) {
+                if (c->rx[3] != 0) {
+                    c->stats.lastRefusal = c->rx[3];
+                    drop(c, now);
+                    return;
+                }
+                c->state = MQTT_UP;
+                c->stats.connects++;
+                c->lastTxMs = now;
+            } else if (type == MQTT_PINGRESP) {
+                c->pingPending = false;
+            }
+            c->rxLen -= 2 + rem;
+            memmove(c->rx, c->rx + 2 + rem, c->rxLen);
+        }
+    }
+}
+
+// ============ Helper: Hand queued bytes to the socket ============
+static void drain(MqttClient_t* c, uint32_t now) {
+    while (c->head < c->tail) {
+        int n = tcp_write(c, c->queue + c->head, c->tail - c->head);
+        if (n < 0) {
+            drop(c, now);
+            return;
+        }
+        if (n == 0) return;
+        c->head += n;
+        c->stats.bytesOut += n;
+        c->stats.writes++;
+        c->lastTxMs = now;
+    }
+    c->head = c->tail = 0;
+}
+
+// ============ Public API ============
+void mqtt_init(MqttClient_t* c, const char* host, uint16_t port, const char* clientId,
+               const char* user, const char* pass) {
+    c->open = false;
+    c->state = MQTT_DOWN;
+    c->head = c->tail = 0;
+    c->rxLen = 0;
+    c->pingPending = false;
+    c->stateMs = millis();
+    memset(&c->stats, 0, sizeof(c->stats));
+
+    strncpy(c->host, host, MQTT_HOST_LEN - 1);
+    c->host[MQTT_HOST_LEN - 1] = '\0';
+    c->port = port;
+    strncpy(c->clientId, clientId, MQTT_ID_LEN - 1);
+    c->clientId[MQTT_ID_LEN - 1] = '\0';
+    c->user = user;
+    c->pass = pass;
+    c->willTopic[0] = '\0';
+    c->willPayload = NULL;
+}
+
+void mqtt_set_will(MqttClient_t* c, const char* topic, const char* payload) {
+    strncpy(c->willTopic, topic, MQTT_TOPIC_LEN - 1);
+    c->willTopic[MQTT_TOPIC_LEN - 1] = '\0';
+    c->willPayload = payload;
+}
+
+void mqtt_poll(MqttClient_t* c, uint32_t nowMs) {
+    if (c->state == MQTT_DOWN) {
+        if ((int32_t)(nowMs - c->stateMs) < 0) return;
+        start_session(c, nowMs);
+        if (c->state == MQTT_DOWN) return;
+    }
+    if (c->state == MQTT_OPENING) {
+        int r = tcp_connected(c);
+        if (r < 0 || (r == 0 && nowMs - c->stateMs > MQTT_CONNECT_TIMEOUT_MS)) {
+            drop(c, nowMs);
+            return;
+        }
+        if (r == 0) return;
+        send_connect(c, nowMs);
+        if (c->state == MQTT_DOWN) return;
+    }
+
+    receive(c, nowMs);
+    if (c->state == MQTT_DOWN) return;
+
+    if (c->state == MQTT_CONNECTING) {
+        if (nowMs - c->stateMs > MQTT_CONNACK_TIMEOUT_MS) {
+            drop(c, nowMs);
+            return;
+        }
+    } else if (c->pingPending) {
+        if (nowMs - c->pingMs > MQTT_KEEPALIVE_S * 1000UL) {
+            drop(c, nowMs);
+            return;
+        }
+    } else if (nowMs - c->lastTxMs >= MQTT_KEEPALIVE_S * 500UL) {
+        // Idle for half the keepalive: prove the session is alive
+        uint8_t* p = reserve(c, 2);
+        if (p) {
+            p[0] = MQTT_PINGREQ;
+            p[1] = 0;
+            commit(c, p + 2);
+            c->pingPending = true;
+            c->pingMs = nowMs;
+        }
+    }
+
+    drain(c, nowMs);
+}
+
+bool mqtt_publish(MqttClient_t* c, const char* topic, const void* payload, uint16_t len, bool retain) {
+    if (c->state != MQTT_UP) {
+        c->stats.dropped++;
+        return false;
+    }
+    uint16_t topicLen = (uint16_t)strlen(topic);
+    uint32_t rem = 2 + topicLen + len;
+    uint8_t* p = reserve(c, 1 + varint_len(rem) + rem);
+    if (!p) {
+        c->stats.dropped++;
+        return false;
+    }
+    *p++ = MQTT_PUBLISH | (retain ? 0x01 : 0x00);
+    p = put_varint(p, rem);
+    p = put_str(p, topic, topicLen);
+    memcpy(p, payload, len);
+    commit(c, p + len);
+    c->stats.published++;
+    return true;
+}
+
+bool mqtt_connected(const MqttClient_t* c) {
+    return c->state == MQTT_UP;
+}
+
+uint32_t mqtt_queued(const MqttClient_t* c) {
+    return c->tail - c->head;
+}
+
+void mqtt_disconnect(MqttClient_t* c) {
+    if (c->state == MQTT_UP) {
+        uint8_t* p = reserve(c, 2);
+        if (p) {
+            p[0] = MQTT_DISCONNECT;
+            p[1] = 0;
+            commit(c, p + 2);
+        }
+        drain(c, millis());
+    }
+    drop(c, millis());
+}
+
+const MqttStats_t* mqtt_get_stats(const MqttClient_t* c) {
+    return &c->stats;
+}
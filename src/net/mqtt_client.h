@@ -0,0 +1,91 @@
+// SIGNALTAP MQTT Client
+// Minimal MQTT 3.1.1 publisher: CONNECT with a clean session and a last
+// will, QoS 0 PUBLISH, keepalive PINGREQ. Packets are encoded straight into
+// a preallocated outbound queue and drained without blocking as the socket
+// takes them, so a burst of small publishes leaves in few TCP writes and
+// nothing is allocated per message. The transport is a non-blocking
+// socket on both builds (lwIP on the device), connect included, so the
+// same code runs against a local broker on a host.
+#ifndef MQTT_CLIENT_H
+#define MQTT_CLIENT_H
+
+#include <Arduino.h>
+
+#define MQTT_QUEUE_BYTES        8192
+#define MQTT_RX_BYTES           64      // Only CONNACK and PINGRESP come back
+#define MQTT_TOPIC_LEN          96
+#define MQTT_HOST_LEN           64
+#define MQTT_ID_LEN             32
+#define MQTT_KEEPALIVE_S        30
+#define MQTT_RECONNECT_MS       5000
+#define MQTT_CONNACK_TIMEOUT_MS 5000
+#define MQTT_CONNECT_TIMEOUT_MS 1000    // TCP connect, polled
+
+typedef enum {
+    MQTT_DOWN = 0,
+    MQTT_OPENING,           // TCP connect under way
+    MQTT_CONNECTING,        // CONNECT sent, waiting for CONNACK
+    MQTT_UP
+} MqttState_t;
+
+typedef struct {
+    uint32_t published;     // PUBLISH packets queued
+    uint32_t dropped;       // Refused: queue full or not connected
+    uint32_t bytesOut;      // Bytes the socket accepted
+    uint32_t writes;        // Socket writes that carried them
+    uint32_t connects;      // Sessions opened (CONNACK accepted)
+    uint32_t disconnects;
+    uint32_t queueHigh;     // Most bytes queued at once
+    uint8_t lastRefusal;    // CONNACK return code of the last refused CONNECT
+} MqttStats_t;
+
+typedef struct {
+    char host[MQTT_HOST_LEN];
+    uint16_t port;
+    char clientId[MQTT_ID_LEN];
+    const char* user;                   // NULL or "" for none
+    const char* pass;
+    char willTopic[MQTT_TOPIC_LEN];     // Empty for no will
+    const char* willPayload;
+
+    int fd;
+    bool open;                          // Socket exists (connected or connecting)
+    MqttState_t state;
+
+    uint8_t queue[MQTT_QUEUE_BYTES];    // Encoded packets, head..tail pending
+    uint32_t head;
+    uint32_t tail;
+    uint8_t rx[MQTT_RX_BYTES];
+    uint16_t rxLen;
+
+    uint32_t lastTxMs;
+    uint32_t stateMs;                   // Connect started / CONNECT sent / next attempt
+    uint32_t pingMs;                    // PINGREQ sent, valid while pingPending
+    bool pingPending;
+    MqttStats_t stats;
+} MqttClient_t;
+
+// ============ Public API ============
+
+// Broker endpoint and identity; strings are copied except user/pass/will
+// payload, which must stay valid. Connecting starts at the first poll.
+void mqtt_init(MqttClient_t* c, const char* host, uint16_t port, const char* clientId,
+               const char* user, const char* pass);
+
+// Retained message the broker publishes if the connection drops
+void mqtt_set_will(MqttClient_t* c, const char* topic, const char* payload);
+
+// Connect / reconnect, drain the queue, read acks, keep alive. Never
+// blocks: the TCP connect is polled here too; call every loop pass.
+void mqtt_poll(MqttClient_t* c, uint32_t nowMs);
+
+// Queue one QoS 0 PUBLISH; false (and nothing queued) if there is no
+// session or not enough queue space
+bool mqtt_publish(MqttClient_t* c, const char* topic, const void* payload, uint16_t len, bool retain);
+
+bool mqtt_connected(const MqttClient_t* c);
+uint32_t mqtt_queued(const MqttClient_t* c);
+void mqtt_disconnect(MqttClient_t* c);
+const MqttStats_t* mqtt_get_stats(const MqttClient_t* c);
+
+#endif // MQTT_CLIENT_H
@@ -0,0 +1,362 @@
+// SIGNALTAP Telemetry Publisher Implementation
+#include "telemetry.h"
+#include "../data/simulation_engine.h"
+#include "../ui/ui_format.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// Topic names after <root>/<device>/, by TelemTopic_t
+static const char* const topicNames[TELEM_TOPIC_COUNT] = {
+    "sensors", "kpis", "alarms", "vision", "status", "frame", "history"
+};
+
+// Dashboard demo keys, by demo index
+static const char* const demoKeys[DEMO_COUNT] = {
+    "cnc", "chiller", "compressor", "custom"
+};
+
+// Change (in sensor units) worth a sensors publish, by demo and sensor
+static const float sensorDeadband[DEMO_COUNT][3] = {
+    {0.5f,  0.1f,  25.0f},     // CNC: load %, coolant L/min, spindle RPM
+    {0.2f,  0.1f,  0.1f},      // Chiller: compressor kW, supply C, return C
+    {0.05f, 0.5f,  0.2f},      // Compressor: tank bar, oil C, motor A
+    {0.5f,  5.0f,  0.02f},     // PLC: chamber C, chamber mbar, air bar
+};
+
+// Dashboard LED keys of the CNC panel, in CNCLeds_t order
+static const char* const cncLedKeys[8] = {
+    "PR", "PS", "PF", "PF0", "V5", "NF", "SF", "CB"
+};
+
+// ============ Helpers: JSON into the payload buffer ============
+typedef struct {
+    char* buf;
+    uint16_t len;
+    uint16_t cap;
+} Json_t;
+
+static void jprintf(Json_t* j, const char* fmt, ...) {
+    if (j->len >= j->cap) return;
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(j->buf + j->len, j->cap - j->len, fmt, ap);
+    va_end(ap);
+    if (n > 0) j->len = (uint16_t)(j->len + n < j->cap ? j->len + n : j->cap);
+}
+
+// Numbers through fmt_fixed: printf's %f goes through dtoa, which can
+// allocate on the device
+static void jfixed(Json_t* j, float value, uint8_t decimals) {
+    if (j->len >= j->cap) return;
+    int n = fmt_fixed(j->buf + j->len, j->cap - j->len, value, decimals, NULL);
+    if (n > 0) j->len = (uint16_t)(j->len + n < j->cap ? j->len + n : j->cap);
+}
+
+static void jstring(Json_t* j, const char* s) {
+    jprintf(j, "\"");
+    for (; s && *s && j->len + 2 < j->cap; s++) {
+        if (*s == '"' || *s == '\\') j->buf[j->len++] = '\\';
+        if ((uint8_t)*s >= 0x20) j->buf[j->len++] = *s;
+    }
+    jprintf(j, "\"");
+}
+
+static void jbits(Json_t* j, const bool* bits) {
+    jprintf(j, "[%d,%d,%d,%d,%d,%d,%d,%d]", bits[0], bits[1], bits[2], bits[3],
+            bits[4], bits[5], bits[6], bits[7]);
+}
+
+static uint32_t fnv1a(const char* p, uint16_t len) {
+    uint32_t h = 2166136261UL;
+    while (len--) h = (h ^ (uint8_t)*p++) * 16777619UL;
+    return h;
+}
+
+// ============ Payload builders ============
+static uint16_t build_status(Telemetry_t* t, uint8_t d, bool running) {
+    Json_t j = {t->payload, 0, TELEM_PAYLOAD_MAX};
+    jprintf(&j, "{\"running\":%s,\"online\":true,\"demo\":\"%s\",\"scenario\":",
+            running ? "true" : "false", demoKeys[d]);
+    jstring(&j, sim_get_scenario_name());
+    jprintf(&j, "}");
+    return j.len;
+}
+
+static uint16_t build_sensors(Telemetry_t* t, const DemoProfile_t* demo) {
+    Json_t j = {t->payload, 0, TELEM_PAYLOAD_MAX};
+    jprintf(&j, "{\"t\":%lu,\"sensors\":[", (unsigned long)sim_get_clock());
+    for (int i = 0; i < 3; i++) {
+        const Sensor_t* s = &demo->sensors[i];
+        jprintf(&j, "%s{\"value\":", i ? "," : "");
+        jfixed(&j, s->value, s->decimals);
+        jprintf(&j, "}");
+    }
+    jprintf(&j, "]}");
+    return j.len;
+}
+
+static uint16_t build_kpis(Telemetry_t* t, const DemoProfile_t* demo) {
+    Json_t j = {t->payload, 0, TELEM_PAYLOAD_MAX};
+    jprintf(&j, "{\"kpis\":[");
+    for (int i = 0; i < 4; i++) {
+        const KPI_t* k = &demo->kpis[i];
+        jprintf(&j, "%s{\"label\":", i ? "," : "");
+        jstring(&j, k->label);
+        jprintf(&j, ",\"value\":");
+        jstring(&j, k->value);
+        jprintf(&j, ",\"unit\":");
+        jstring(&j, k->unit);
+        jprintf(&j, ",\"good\":%s}", k->good ? "true" : "false");
+    }
+    jprintf(&j, "]}");
+    return j.len;
+}
+
+// Newest first, as the dashboard lists them
+static uint16_t build_alarms(Telemetry_t* t, const AlarmTable_t* table) {
+    Json_t j = {t->payload, 0, TELEM_PAYLOAD_MAX};
+    jprintf(&j, "{\"alarms\":[");
+    for (int i = alarm_count(table) - 1; i >= 0; i--) {
+        const AlarmEntry_t* e = alarm_get(table, (uint8_t)i);
+        uint32_t s = e->raisedAt;
+        jprintf(&j, "%s{\"id\":%lu,\"sev\":\"%s\",\"msg\":", i == alarm_count(table) - 1 ? "" : ",",
+                (unsigned long)e->logSeq, alarm_severity_name(alarm_severity((AlarmCode_t)e->code)));
+        jstring(&j, alarm_message((AlarmCode_t)e->code));
+        jprintf(&j, ",\"time\":\"%02lu:%02lu:%02lu\",\"acked\":%s}",
+                (unsigned long)(s / 3600 % 24), (unsigned long)(s / 60 % 60), (unsigned long)(s % 60),
+                (e->flags & ALARM_FLAG_ACKED) ? "true" : "false");
+    }
+    jprintf(&j, "]}");
+    return j.len;
+}
+
+static uint16_t build_vision(Telemetry_t* t, const Vision_t* v) {
+    Json_t j = {t->payload, 0, TELEM_PAYLOAD_MAX};
+    switch (v->type) {
+        case VISION_CNC: {
+            const bool leds[8] = {v->leds.run, v->leds.feed, v->leds.spindle, v->leds.coolant,
+                                  v->leds.program, v->leds.error, v->leds.fault, v->leds.ready};
+            jprintf(&j, "{\"partCount\":%u", v->partCount);
+            if (v->stackLight) {
+                jprintf(&j, ",\"stackLight\":");
+                jstring(&j, v->stackLight);
+            }
+            jprintf(&j, ",\"leds\":{");
+            for (int i = 0; i < 8; i++) {
+                jprintf(&j, "%s\"%s\":%s", i ? "," : "", cncLedKeys[i], leds[i] ? "true" : "false");
+            }
+            jprintf(&j, "}}");
+            break;
+        }
+        case VISION_CHILLER:
+            jprintf(&j, "{\"errorCode\":");
+            jstring(&j, v->errorCode);
+            jprintf(&j, "}");
+            break;
+        case VISION_COMPRESSOR:
+            jprintf(&j, "{\"pressure\":");
+            jfixed(&j, v->pressure, 1);
+            jprintf(&j, ",\"oilTemp\":");
+            jfixed(&j, v->oilTemp, 0);
+            jprintf(&j, ",\"state\":");
+            jstring(&j, v->state);
+            jprintf(&j, "}");
+            break;
+        default:
+            jprintf(&j, "{\"diA\":");
+            jbits(&j, v->diA);
+            jprintf(&j, ",\"dqA\":");
+            jbits(&j, v->dqA);
+            jprintf(&j, ",\"aq0\":%u}", v->aq0);
+            break;
+    }
+    return j.len;
+}
+
+// ============ Helpers: Publishing ============
+static bool send(Telemetry_t* t, TelemTopic_t topic, uint16_t len) {
+    // Frames are deltas and backlog is history: neither is worth retaining
+    bool retain = topic != TELEM_FRAME && topic != TELEM_HISTORY;
+    if (!mqtt_publish(t->mqtt, t->topics[topic], t->payload, len, retain)) {
+        t->stats.failed++;
+        return false;
+    }
+    t->stats.published++;
+    t->stats.bytes += len;
+    return true;
+}
+
+// Publish unless the payload matches the last one sent on this topic
+static bool send_if_changed(Telemetry_t* t, TelemTopic_t topic, uint16_t len) {
+    uint32_t h = fnv1a(t->payload, len);
+    if (h == t->hash[topic]) {
+        t->stats.unchanged++;
+        return false;
+    }
+    if (!send(t, topic, len)) return false;
+    t->hash[topic] = h;
+    return true;
+}
+
+static bool sensors_due(const Telemetry_t* t, const DemoProfile_t* demo, uint8_t d, uint32_t now) {
+    if (t->fresh || now - t->sensorsSentMs >= TELEM_HEARTBEAT_MS) return true;
+    for (int i = 0; i < 3; i++) {
+        if (fabsf(demo->sensors[i].value - t->sentSensors[i]) >= sensorDeadband[d][i]) return true;
+    }
+    return false;
+}
+
+// New session or demo: everything goes out again
+static void invalidate(Telemetry_t* t) {
+    t->fresh = true;
+    memset(t->hash, 0, sizeof(t->hash));
+    t->alarmRevision = 0xFFFFFFFFUL;
+    tc_encoder_reset(&t->codec);
+}
+
+// Sensors and vision as one binary frame; a refused frame leaves the
+// decoder's delta base behind, so the next one is a keyframe
+static uint8_t send_frame(Telemetry_t* t, const DemoProfile_t* demo) {
+    TcSample_t s;
+    tc_sample(demo, (uint8_t)sim_get_scenario(), &s);
+    TcFrame_t f;
+    tc_frame_begin(&t->codec, &f, (uint8_t*)t->payload, TELEM_PAYLOAD_MAX, sim_get_clock());
+    tc_frame_put(&t->codec, &f, 0, &s);
+    uint16_t len = tc_frame_end(&t->codec, &f);
+    if (!len) {
+        t->stats.unchanged++;
+        return 0;
+    }
+    if (!send(t, TELEM_FRAME, len)) {
+        tc_encoder_reset(&t->codec);
+        return 0;
+    }
+    return 1;
+}
+
+// ============ Public API ============
+void telem_init(Telemetry_t* t, MqttClient_t* mqtt, const char* root, const char* deviceId) {
+    memset(t, 0, sizeof(*t));
+    t->mqtt = mqtt;
+    tc_encoder_init(&t->codec, &t->codecStream, 1, TC_KEY_EVERY);
+    for (int i = 0; i < TELEM_TOPIC_COUNT; i++) {
+        snprintf(t->topics[i], MQTT_TOPIC_LEN, "%s/%s/%s", root, deviceId, topicNames[i]);
+    }
+    invalidate(t);
+    mqtt_set_will(mqtt, t->topics[TELEM_STATUS], "{\"running\":false,\"online\":false}");
+}
+
+// Broker unreachable: keep what the sensors topic would have carried.
+// JSON even in binary mode, so each record stands on its own.
+static uint8_t spool_sensors(Telemetry_t* t, uint32_t nowMs) {
+    const DemoProfile_t* demo = sim_get_demo();
+    uint8_t d = (uint8_t)demo->vision.type % DEMO_COUNT;
+    if (!sensors_due(t, demo, d, nowMs)) return 0;
+    if (!spool_push(t->spool, t->payload, build_sensors(t, demo), nowMs)) return 0;
+    for (int i = 0; i < 3; i++) t->sentSensors[i] = demo->sensors[i].value;
+    t->sensorsSentMs = nowMs;
+    t->fresh = false;
+    t->stats.spooled++;
+    return 1;
+}
+
+void telem_set_spool(Telemetry_t* t, Spool_t* spool) {
+    t->spool = spool;
+}
+
+void telem_set_binary(Telemetry_t* t, bool on) {
+    t->binary = on;
+    invalidate(t);
+}
+
+uint8_t telem_tick(Telemetry_t* t, bool running, uint32_t nowMs) {
+    if (!mqtt_connected(t->mqtt)) return t->spool ? spool_sensors(t, nowMs) : 0;
+    const AlarmTable_t* alarms = sim_get_alarm_table();
+    if (!alarms) return 0;
+
+    unsigned long t0 = micros();
+    const DemoProfile_t* demo = sim_get_demo();
+    uint8_t d = (uint8_t)demo->vision.type % DEMO_COUNT;
+    uint32_t sessions = mqtt_get_stats(t->mqtt)->connects;
+    if (sessions != t->sessions || d != t->demo) {
+        invalidate(t);
+        t->sessions = sessions;
+        t->demo = d;
+        // Whatever the outage left in RAM goes to flash and out behind it
+        if (t->spool) spool_seal(t->spool);
+    }
+
+    // Status first, so a dashboard has switched demo before the data lands
+    uint8_t sent = 0;
+    sent += send_if_changed(t, TELEM_STATUS, build_status(t, d, running));
+
+    if (t->binary) {
+        sent += send_frame(t, demo);
+    } else if (sensors_due(t, demo, d, nowMs)) {
+        if (send(t, TELEM_SENSORS, build_sensors(t, demo))) {
+            for (int i = 0; i < 3; i++) t->sentSensors[i] = demo->sensors[i].value;
+            t->sensorsSentMs = nowMs;
+            t->fresh = false;
+            sent++;
+        }
+    } else {
+        t->stats.unchanged++;
+    }
+
+    sent += send_if_changed(t, TELEM_KPIS, build_kpis(t, demo));
+    if (!t->binary) sent += send_if_changed(t, TELEM_VISION, build_vision(t, &demo->vision));
+
+    if (alarms->revision != t->alarmRevision) {
+        if (send(t, TELEM_ALARMS, build_alarms(t, alarms))) {
+            t->alarmRevision = alarms->revision;
+            sent++;
+        }
+    } else {
+        t->stats.unchanged++;
+    }
+
+    TelemStats_t* st = &t->stats;
+    st->ticks++;
+    st->lastTickUs = (uint32_t)(micros() - t0);
+    st->avgTickUs = (st->avgTickUs == 0.0f) ? st->lastTickUs : st->avgTickUs * 0.95f + st->lastTickUs * 0.05f;
+    return sent;
+}
+
+uint16_t telem_drain(Telemetry_t* t) {
+    if (!t->spool || !mqtt_connected(t->mqtt)) return 0;
+    // Live messages first: only top up a nearly empty queue
+    if (mqtt_queued(t->mqtt) > MQTT_QUEUE_BYTES / 4) return 0;
+
+    // A page's records always fit: JSON separators cost less than the
+    // spool's length prefixes
+    Json_t j = {t->backlog, 0, TELEM_BACKLOG_MAX};
+    jprintf(&j, "{\"backlog\":[");
+    const uint8_t* rec;
+    uint16_t len, n = 0;
+    while (spool_next(t->spool, &rec, &len)) {
+        if (j.len + len + 3 > j.cap) {
+            spool_rewind(t->spool);
+            return 0;
+        }
+        if (n++) j.buf[j.len++] = ',';
+        memcpy(j.buf + j.len, rec, len);
+        j.len += len;
+    }
+    if (n == 0) return 0;
+    jprintf(&j, "]}");
+
+    if (!mqtt_publish(t->mqtt, t->topics[TELEM_HISTORY], j.buf, j.len, false)) {
+        spool_rewind(t->spool);
+        return 0;
+    }
+    spool_commit(t->spool);
+    t->stats.backlogBatches++;
+    t->stats.backlogRecords += n;
+    return n;
+}
+
+const TelemStats_t* telem_get_stats(const Telemetry_t* t) {
+    return &t->stats;
+}
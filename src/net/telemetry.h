@@ -0,0 +1,94 @@
+// SIGNALTAP Telemetry Publisher
+// Publishes the active machine to the dashboard's MQTT topics
+// (<root>/<device>/sensors, kpis, alarms, vision, status - the payloads
+// index.html parses). Each tick builds at most one message per topic, and
+// only when it changed: sensors when any value moved past its deadband (or
+// the heartbeat is due), alarms when the table revision moved, the others
+// when their payload differs from the last one sent. Payloads are built in
+// a fixed buffer and copied into the MQTT queue; nothing is allocated.
+// In binary mode sensors and vision go out instead as telemetry_codec
+// frames on <root>/<device>/frame, every tick something changed.
+// With a spool attached, sensors messages produced while the broker is
+// unreachable are spooled to flash and sent afterwards, batched as
+// {"backlog":[...]} on <root>/<device>/history, whenever the live
+// messages leave the client queue room.
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include "mqtt_client.h"
+#include "telemetry_codec.h"
+#include "../storage/telemetry_spool.h"
+
+#define TELEM_PAYLOAD_MAX   1024
+#define TELEM_HEARTBEAT_MS  60000   // Unchanged sensors are republished this often
+#define TELEM_BACKLOG_MAX   (SPOOL_DATA_BYTES + 32)     // One spool page per batch
+
+typedef enum {
+    TELEM_SENSORS = 0,
+    TELEM_KPIS,
+    TELEM_ALARMS,
+    TELEM_VISION,
+    TELEM_STATUS,
+    TELEM_FRAME,            // Binary mode only
+    TELEM_HISTORY,          // Spooled backlog
+    TELEM_TOPIC_COUNT
+} TelemTopic_t;
+
+typedef struct {
+    uint32_t ticks;
+    uint32_t published;
+    uint32_t unchanged;     // Topic checks that sent nothing
+    uint32_t failed;        // Publishes the client refused (retried next tick)
+    uint32_t bytes;         // Payload bytes published
+    uint32_t spooled;       // Messages spooled while the broker was unreachable
+    uint32_t backlogBatches;
+    uint32_t backlogRecords;
+    uint32_t lastTickUs;
+    float avgTickUs;
+} TelemStats_t;
+
+typedef struct {
+    MqttClient_t* mqtt;
+    char topics[TELEM_TOPIC_COUNT][MQTT_TOPIC_LEN];
+    bool binary;
+
+    // Last state sent, per topic
+    uint8_t demo;
+    bool fresh;                         // Nothing sent on this session / demo yet
+    uint32_t sessions;                  // MQTT connects seen
+    float sentSensors[3];
+    uint32_t sensorsSentMs;
+    uint32_t alarmRevision;
+    uint32_t hash[TELEM_TOPIC_COUNT];
+    TcEncoder_t codec;                  // Binary mode: this device is machine 0
+    TcStream_t codecStream;
+    Spool_t* spool;                     // NULL: nothing kept across outages
+
+    char payload[TELEM_PAYLOAD_MAX];
+    char backlog[TELEM_BACKLOG_MAX];
+    TelemStats_t stats;
+} Telemetry_t;
+
+// ============ Public API ============
+
+// Topics are <root>/<deviceId>/<name>; also sets the client's last will
+// (retained {"running":false,"online":false} on the status topic)
+void telem_init(Telemetry_t* t, MqttClient_t* mqtt, const char* root, const char* deviceId);
+
+// Binary frames in place of the sensors and vision JSON topics
+void telem_set_binary(Telemetry_t* t, bool on);
+
+// Keep sensors messages across broker outages (spool opened by the caller)
+void telem_set_spool(Telemetry_t* t, Spool_t* spool);
+
+// Once per sim tick (or update interval when stopped); returns messages queued
+uint8_t telem_tick(Telemetry_t* t, bool running, uint32_t nowMs);
+
+// Every loop pass: send one batch of spooled backlog if the client queue
+// has room after the live messages; returns records sent
+uint16_t telem_drain(Telemetry_t* t);
+
+const TelemStats_t* telem_get_stats(const Telemetry_t* t);
+
+#endif // TELEMETRY_H
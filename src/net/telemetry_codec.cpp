@@ -0,0 +1,304 @@
+// SIGNALTAP Binary Telemetry Codec Implementation
+#include "telemetry_codec.h"
+#include <string.h>
+#include <math.h>
+
+// Per-profile schemas, by demo index. index.html carries the same table
+// (TC_SCHEMAS); change both together and bump TC_VERSION.
+static const TcSchema_t schemas[DEMO_COUNT] = {
+    {9, {{TC_F_SENSOR0, 1}, {TC_F_SENSOR1, 1}, {TC_F_SENSOR2, 0},       // CNC
+         {TC_F_HEALTH, 0}, {TC_F_RISK, 1}, {TC_F_SCENARIO, 0},
+         {TC_F_PARTS, 0}, {TC_F_LEDS, 0}, {TC_F_STACK, 0}}},
+    {7, {{TC_F_SENSOR0, 1}, {TC_F_SENSOR1, 1}, {TC_F_SENSOR2, 1},       // Chiller
+         {TC_F_HEALTH, 0}, {TC_F_RISK, 1}, {TC_F_SCENARIO, 0},
+         {TC_F_ERROR, 0}}},
+    {9, {{TC_F_SENSOR0, 1}, {TC_F_SENSOR1, 0}, {TC_F_SENSOR2, 1},       // Compressor
+         {TC_F_HEALTH, 0}, {TC_F_RISK, 1}, {TC_F_SCENARIO, 0},
+         {TC_F_PRESSURE, 1}, {TC_F_OIL_TEMP, 0}, {TC_F_RUN_STATE, 0}}},
+    {9, {{TC_F_SENSOR0, 1}, {TC_F_SENSOR1, 0}, {TC_F_SENSOR2, 2},       // PLC
+         {TC_F_HEALTH, 0}, {TC_F_RISK, 1}, {TC_F_SCENARIO, 0},
+         {TC_F_DI, 0}, {TC_F_DQ, 0}, {TC_F_AQ0, 0}}},
+};
+
+// Text codes: every string the scenario tables put on the vision panels
+static const char* const texts[] = {
+    "", "green", "yellow", "red", "---", "E07", "LOAD", "IDLE", "FAULT"
+};
+#define TEXT_COUNT (sizeof(texts) / sizeof(texts[0]))
+
+static const float pow10f[] = {1.0f, 10.0f, 100.0f, 1000.0f};
+
+// ============ Helper: Byte output ============
+typedef struct {
+    uint8_t* buf;
+    uint32_t len;
+    uint32_t cap;
+} Out_t;
+
+static void put8(Out_t* o, uint8_t v) {
+    if (o->len < o->cap) o->buf[o->len] = v;
+    o->len++;
+}
+
+static void put_varint(Out_t* o, uint32_t v) {
+    while (v >= 0x80) {
+        put8(o, (uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    put8(o, (uint8_t)v);
+}
+
+// Small magnitudes of either sign become small varints
+static uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+// ============ Helper: Byte input ============
+typedef struct {
+    const uint8_t* buf;
+    uint32_t len;
+    uint32_t pos;
+    bool ok;
+} In_t;
+
+static uint8_t get8(In_t* in) {
+    if (in->pos >= in->len) {
+        in->ok = false;
+        return 0;
+    }
+    return in->buf[in->pos++];
+}
+
+static uint32_t get_varint(In_t* in) {
+    uint32_t v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        uint8_t b = get8(in);
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) return v;
+    }
+    in->ok = false;
+    return 0;
+}
+
+static int32_t unzigzag(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+// ============ Helper: Sampling ============
+static int32_t text_code(const char* s) {
+    if (!s) return 0;
+    for (uint8_t i = 0; i < TEXT_COUNT; i++) {
+        if (strcmp(s, texts[i]) == 0) return i;
+    }
+    return TC_TEXT_UNKNOWN;
+}
+
+static uint8_t pack_bits(const bool* b) {
+    uint8_t v = 0;
+    for (int i = 0; i < 8; i++) v |= (uint8_t)(b[i] ? 1 : 0) << i;
+    return v;
+}
+
+static int32_t scaled(float v, uint8_t decimals) {
+    return (int32_t)lroundf(v * pow10f[decimals]);
+}
+
+static int32_t field_value(const DemoProfile_t* demo, uint8_t scenario, const TcField_t* f) {
+    const Vision_t* v = &demo->vision;
+    switch (f->field) {
+        case TC_F_SENSOR0:
+        case TC_F_SENSOR1:
+        case TC_F_SENSOR2:  return scaled(demo->sensors[f->field - TC_F_SENSOR0].value, f->decimals);
+        case TC_F_HEALTH:   return demo->ai.healthScore;
+        case TC_F_RISK:     return scaled(demo->ai.failureProbability, f->decimals);
+        case TC_F_SCENARIO: return scenario;
+        case TC_F_PARTS:    return v->partCount;
+        case TC_F_LEDS: {
+            const bool leds[8] = {v->leds.run, v->leds.feed, v->leds.spindle, v->leds.coolant,
+                                  v->leds.program, v->leds.error, v->leds.fault, v->leds.ready};
+            return pack_bits(leds);
+        }
+        case TC_F_STACK:     return text_code(v->stackLight);
+        case TC_F_ERROR:     return text_code(v->errorCode);
+        case TC_F_PRESSURE:  return scaled(v->pressure, f->decimals);
+        case TC_F_OIL_TEMP:  return scaled(v->oilTemp, f->decimals);
+        case TC_F_RUN_STATE: return text_code(v->state);
+        case TC_F_DI:        return pack_bits(v->diA);
+        case TC_F_DQ:        return pack_bits(v->dqA);
+        case TC_F_AQ0:       return v->aq0;
+        default:             return 0;
+    }
+}
+
+// ============ Public API: Schema and samples ============
+const TcSchema_t* tc_schema(uint8_t schema) {
+    return schema < DEMO_COUNT ? &schemas[schema] : NULL;
+}
+
+void tc_sample(const DemoProfile_t* demo, uint8_t scenarioState, TcSample_t* s) {
+    s->schema = (uint8_t)demo->vision.type % DEMO_COUNT;
+    const TcSchema_t* sch = &schemas[s->schema];
+    for (uint8_t i = 0; i < sch->count; i++) {
+        s->v[i] = field_value(demo, scenarioState, &sch->fields[i]);
+    }
+}
+
+float tc_value(const TcSample_t* s, uint8_t i) {
+    return (float)s->v[i] / pow10f[schemas[s->schema].fields[i].decimals];
+}
+
+const char* tc_text(int32_t code) {
+    return (code >= 0 && code < (int32_t)TEXT_COUNT) ? texts[code] : NULL;
+}
+
+// ============ Public API: Encoder ============
+void tc_encoder_init(TcEncoder_t* e, TcStream_t* streams, uint16_t count, uint8_t keyEvery) {
+    e->streams = streams;
+    e->count = count;
+    e->keyEvery = keyEvery ? keyEvery : 1;
+    e->seq = 0;
+    e->tick = 0;
+    memset(&e->stats, 0, sizeof(e->stats));
+    tc_encoder_reset(e);
+}
+
+void tc_encoder_reset(TcEncoder_t* e) {
+    for (uint16_t i = 0; i < e->count; i++) e->streams[i].valid = false;
+}
+
+void tc_frame_begin(TcEncoder_t* e, TcFrame_t* f, uint8_t* buf, uint16_t cap, uint32_t clock) {
+    f->buf = buf;
+    f->cap = cap;
+    f->records = 0;
+    Out_t o = {buf, 0, cap};
+    put8(&o, TC_MAGIC);
+    put8(&o, TC_VERSION);
+    put8(&o, (uint8_t)e->seq);
+    put8(&o, (uint8_t)(e->seq >> 8));
+    for (int i = 0; i < 4; i++) put8(&o, (uint8_t)(clock >> (8 * i)));
+    f->len = (uint16_t)o.len;
+}
+
+bool tc_frame_put(TcEncoder_t* e, TcFrame_t* f, uint16_t machine, const TcSample_t* s) {
+    if (machine >= e->count || s->schema >= DEMO_COUNT) return false;
+    TcStream_t* st = &e->streams[machine];
+    const TcSchema_t* sch = &schemas[s->schema];
+    bool key = !st->valid || st->prev.schema != s->schema ||
+               (e->tick + machine) % e->keyEvery == 0;
+
+    uint32_t mask = 0;
+    if (!key) {
+        for (uint8_t i = 0; i < sch->count; i++) {
+            if (s->v[i] != st->prev.v[i]) mask |= 1UL << i;
+        }
+        if (!mask) return true;     // Unchanged: no record
+    }
+
+    uint8_t rec[TC_MAX_RECORD];
+    Out_t o = {rec, 0, sizeof(rec)};
+    put_varint(&o, machine);
+    put8(&o, (uint8_t)(s->schema | (key ? 0x80 : 0x00)));
+    uint8_t fields = 0;
+    if (key) {
+        for (uint8_t i = 0; i < sch->count; i++) put_varint(&o, zigzag(s->v[i]));
+        fields = sch->count;
+    } else {
+        put_varint(&o, mask);
+        for (uint8_t i = 0; i < sch->count; i++) {
+            if (!(mask & (1UL << i))) continue;
+            put_varint(&o, zigzag((int32_t)((uint32_t)s->v[i] - (uint32_t)st->prev.v[i])));
+            fields++;
+        }
+    }
+    if (o.len > sizeof(rec) || f->len + o.len > f->cap) return false;
+
+    memcpy(f->buf + f->len, rec, o.len);
+    f->len = (uint16_t)(f->len + o.len);
+    f->records++;
+    st->prev = *s;
+    st->valid = true;
+    e->stats.records++;
+    e->stats.fields += fields;
+    if (key) e->stats.keyframes++;
+    return true;
+}
+
+uint16_t tc_frame_end(TcEncoder_t* e, TcFrame_t* f) {
+    e->tick++;
+    if (f->records == 0) return 0;
+    e->seq++;
+    e->stats.frames++;
+    e->stats.bytes += f->len;
+    return f->len;
+}
+
+// ============ Public API: Decoder ============
+void tc_decoder_init(TcDecoder_t* d, TcStream_t* streams, uint16_t count) {
+    d->streams = streams;
+    d->count = count;
+    d->seq = 0;
+    d->started = false;
+    d->clock = 0;
+    d->frames = d->gaps = d->bad = d->skipped = 0;
+    for (uint16_t i = 0; i < count; i++) streams[i].valid = false;
+}
+
+static int reject(TcDecoder_t* d) {
+    d->bad++;
+    for (uint16_t i = 0; i < d->count; i++) d->streams[i].valid = false;
+    return -1;
+}
+
+int tc_decode(TcDecoder_t* d, const uint8_t* data, uint16_t len, TcRecordFn fn, void* ctx) {
+    In_t in = {data, len, 0, true};
+    if (len < TC_HEADER_LEN || get8(&in) != TC_MAGIC || get8(&in) != TC_VERSION) return reject(d);
+    uint16_t seq = get8(&in);
+    seq |= (uint16_t)get8(&in) << 8;
+    uint32_t clock = 0;
+    for (int i = 0; i < 4; i++) clock |= (uint32_t)get8(&in) << (8 * i);
+
+    // A lost frame leaves every delta base behind
+    if (d->started && seq != (uint16_t)(d->seq + 1)) {
+        d->gaps++;
+        for (uint16_t i = 0; i < d->count; i++) d->streams[i].valid = false;
+    }
+    d->started = true;
+    d->seq = seq;
+    d->clock = clock;
+    d->frames++;
+
+    int delivered = 0;
+    while (in.pos < in.len) {
+        uint32_t machine = get_varint(&in);
+        uint8_t head = get8(&in);
+        uint8_t schema = head & 0x7F;
+        bool key = (head & 0x80) != 0;
+        if (!in.ok || machine >= d->count || schema >= DEMO_COUNT) return reject(d);
+
+        const TcSchema_t* sch = &schemas[schema];
+        TcStream_t* st = &d->streams[machine];
+        TcSample_t s;
+        s.schema = schema;
+        bool based = key || (st->valid && st->prev.schema == schema);
+        if (key) {
+            for (uint8_t i = 0; i < sch->count; i++) s.v[i] = unzigzag(get_varint(&in));
+        } else {
+            uint32_t mask = get_varint(&in);
+            if (mask >> sch->count) return reject(d);
+            memcpy(s.v, st->prev.v, sizeof(s.v));
+            for (uint8_t i = 0; i < sch->count; i++) {
+                if (mask & (1UL << i)) s.v[i] = (int32_t)((uint32_t)s.v[i] + (uint32_t)unzigzag(get_varint(&in)));
+            }
+        }
+        if (!in.ok) return reject(d);
+        if (!based) {
+            d->skipped++;
+            continue;
+        }
+        st->prev = s;
+        st->valid = true;
+        if (fn) fn((uint16_t)machine, &s, key, ctx);
+        delivered++;
+    }
+    return delivered;
+}
@@ -0,0 +1,136 @@
+// SIGNALTAP Binary Telemetry Codec
+// Packed alternative to the JSON sensors/vision payloads, for links where
+// JSON's size and float formatting cost matter (and for fleets: one frame
+// carries any number of machines). Each machine's tick is reduced to a
+// sample of integers - values scaled by their display decimals, strings as
+// codes - laid out by a per-profile schema the dashboard knows by ID.
+//
+// Frame: magic, version, u16 sequence, u32 simulated clock, then one record
+// per machine that changed: varint machine ID, schema byte (top bit set
+// for a keyframe), then either every field (keyframe) or a change mask and
+// the zigzag deltas of the changed fields against that machine's previous
+// record. Keyframes go out every keyEvery ticks per machine, staggered
+// across the fleet, and whenever the delta base is unknown. A decoder that
+// sees a sequence gap drops its bases and waits for keyframes.
+#ifndef TELEMETRY_CODEC_H
+#define TELEMETRY_CODEC_H
+
+#include <Arduino.h>
+#include "../data/demo_profiles.h"
+
+#define TC_MAGIC            0xB7
+#define TC_VERSION          1
+#define TC_HEADER_LEN       8
+#define TC_MAX_FIELDS       9
+#define TC_MAX_RECORD       64      // Machine ID + schema + mask + fields, worst case
+#define TC_KEY_EVERY        10      // Ticks between a machine's keyframes
+#define TC_TEXT_UNKNOWN     0xFF    // String outside the text table
+
+// Sample fields; a schema lists the ones its profile carries
+typedef enum {
+    TC_F_SENSOR0 = 0,
+    TC_F_SENSOR1,
+    TC_F_SENSOR2,
+    TC_F_HEALTH,
+    TC_F_RISK,
+    TC_F_SCENARIO,
+    TC_F_PARTS,
+    TC_F_LEDS,          // CNC LEDs, run = bit 0 .. ready = bit 7
+    TC_F_STACK,         // Text code
+    TC_F_ERROR,         // Text code
+    TC_F_PRESSURE,
+    TC_F_OIL_TEMP,
+    TC_F_RUN_STATE,     // Text code
+    TC_F_DI,            // Bit per input
+    TC_F_DQ,
+    TC_F_AQ0
+} TcFieldId_t;
+
+typedef struct {
+    uint8_t field;      // TcFieldId_t
+    uint8_t decimals;   // Value is sent as round(x * 10^decimals)
+} TcField_t;
+
+// Schema ID = demo index (VisionType_t)
+typedef struct {
+    uint8_t count;
+    TcField_t fields[TC_MAX_FIELDS];
+} TcSchema_t;
+
+typedef struct {
+    uint8_t schema;
+    int32_t v[TC_MAX_FIELDS];   // In schema order
+} TcSample_t;
+
+// Per-machine delta base, on both ends
+typedef struct {
+    TcSample_t prev;
+    bool valid;                 // false: next record must be a keyframe
+} TcStream_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t records;
+    uint32_t keyframes;
+    uint32_t fields;            // Field values sent
+    uint32_t bytes;
+} TcStats_t;
+
+typedef struct {
+    TcStream_t* streams;        // One per machine ID
+    uint16_t count;
+    uint8_t keyEvery;
+    uint16_t seq;
+    uint32_t tick;
+    TcStats_t stats;
+} TcEncoder_t;
+
+typedef struct {
+    uint8_t* buf;
+    uint16_t cap;
+    uint16_t len;
+    uint16_t records;
+} TcFrame_t;
+
+typedef struct {
+    TcStream_t* streams;
+    uint16_t count;
+    uint16_t seq;
+    bool started;
+    uint32_t clock;             // Of the last frame
+    uint32_t frames;
+    uint32_t gaps;              // Sequence breaks (bases dropped)
+    uint32_t bad;               // Frames rejected as malformed
+    uint32_t skipped;           // Delta records without a base
+} TcDecoder_t;
+
+// Called per decoded record whose machine has a valid base
+typedef void (*TcRecordFn)(uint16_t machine, const TcSample_t* s, bool key, void* ctx);
+
+// ============ Public API ============
+
+const TcSchema_t* tc_schema(uint8_t schema);    // NULL if unknown
+
+// Reduce the machine's current state to a sample (schema from vision.type)
+void tc_sample(const DemoProfile_t* demo, uint8_t scenarioState, TcSample_t* s);
+
+// Field i of a sample back in display units, and text codes back to text
+float tc_value(const TcSample_t* s, uint8_t i);
+const char* tc_text(int32_t code);             // NULL for unknown codes
+
+void tc_encoder_init(TcEncoder_t* e, TcStream_t* streams, uint16_t count, uint8_t keyEvery);
+void tc_encoder_reset(TcEncoder_t* e);          // Keyframes for everyone next frame
+
+// One frame: begin, put each machine's sample, end. put returns false (and
+// the machine stays due) if its record does not fit; end returns the frame
+// length, or 0 if no machine changed and there is nothing to send.
+void tc_frame_begin(TcEncoder_t* e, TcFrame_t* f, uint8_t* buf, uint16_t cap, uint32_t clock);
+bool tc_frame_put(TcEncoder_t* e, TcFrame_t* f, uint16_t machine, const TcSample_t* s);
+uint16_t tc_frame_end(TcEncoder_t* e, TcFrame_t* f);
+
+void tc_decoder_init(TcDecoder_t* d, TcStream_t* streams, uint16_t count);
+
+// Decode one frame; returns records delivered, or -1 if it is malformed
+int tc_decode(TcDecoder_t* d, const uint8_t* data, uint16_t len, TcRecordFn fn, void* ctx);
+
+#endif // TELEMETRY_CODEC_H
@@ -0,0 +1,1085 @@
+// SIGNALTAP dashboard page (generated by tools/web_pack.py - do not edit)
+// index.html: 76442 bytes, 17138 gzipped (4.5x)
+#ifndef WEB_INDEX_H
+#define WEB_INDEX_H
+
+#include <Arduino.h>
+
+#define WEB_INDEX_ETAG "\"6fe769cb\""
+
+static const uint8_t webIndexGz[17138] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xdb, 0x72, 0x1b, 0x49,
+    0xb2, 0xd8, 0xbb, 0xbe, 0xa2, 0x86, 0xa3, 0x19, 0x00, 0x23, 0x00, 0x6c, 0x34, 0x2e, 0x04, 0x49,
+    0x51, 0x73, 0x28, 0x92, 0x9a, 0xe1, 0xae, 0x44, 0xf1, 0x90, 0x94, 0xf6, 0x4c, 0x28, 0x14, 0xa3,
+    0x06, 0xd0, 0x20, 0x7a, 0x09, 0xa0, 0x31, 0xdd, 0x0d, 0x52, 0x1c, 0x2e, 0x23, 0x36, 0x1c, 0x7e,
+    0x77, 0x84, 0xcf, 0xbe, 0xd8, 0x61, 0x87, 0x1f, 0xed, 0x07, 0x3f, 0x9c, 0x37, 0xfb, 0xf9, 0x7c,
+    0x80, 0x3f, 0x62, 0x7f, 0xc0, 0xfe, 0x04, 0x67, 0xd6, 0xad, 0xab, 0xaa, 0xab, 0x1b, 0x0d, 0x4a,
+    0x9a, 0xdd, 0x70, 0x78, 0x76, 0x05, 0x02, 0xdd, 0x55, 0x59, 0x55, 0x59, 0x59, 0x79, 0xab, 0xcc,
+    0xaa, 0xa7, 0x5f, 0x1d, 0xbe, 0x3e, 0xb8, 0xf8, 0xe9, 0xf4, 0x88, 0x4c, 0x92, 0xd9, 0xf4, 0xd9,
+    0xa3, 0xa7, 0xf8, 0x87, 0x4c, 0xbd, 0xf9, 0xe5, 0xde, 0x86, 0x3f, 0xdf, 0xc0, 0x07, 0xbe, 0x37,
+    0x7a, 0xf6, 0x88, 0x90, 0xa7, 0x33, 0x3f, 0xf1, 0xc8, 0x70, 0xe2, 0x45, 0xb1, 0x9f, 0xec, 0x6d,
+    0xbc, 0xb9, 0x78, 0xd1, 0xe8, 0x6f, 0xa4, 0x2f, 0xe6, 0xde, 0xcc, 0xdf, 0xdb, 0xb8, 0x0e, 0xfc,
+    0x9b, 0x45, 0x18, 0x25, 0x1b, 0x64, 0x18, 0xce, 0x13, 0x7f, 0x0e, 0x05, 0x6f, 0x82, 0x51, 0x32,
+    0xd9, 0x1b, 0xf9, 0xd7, 0xc1, 0xd0, 0x6f, 0xd0, 0x1f, 0x75, 0x12, 0xcc, 0x83, 0x24, 0xf0, 0xa6,
+    0x8d, 0x78, 0xe8, 0x4d, 0xfd, 0xbd, 0x56, 0xd3, 0x61, 0x80, 0x92, 0x20, 0x99, 0xfa, 0xcf, 0xce,
+    0x83, 0xcb, 0xb9, 0x37, 0x25, 0x17, 0xde, 0x82, 0xfc, 0xf5, 0xcf, 0x7f, 0x21, 0x2f, 0x83, 0x6b,
+    0x9f, 0x1c, 0x7a, 0xf1, 0x64, 0x10, 0x7a, 0xd1, 0xe8, 0xe9, 0x26, 0x2b, 0x84, 0xc5, 0xa7, 0xc1,
+    0xfc, 0x8a, 0x44, 0xfe, 0x74, 0x6f, 0x63, 0x11, 0xf9, 0xd0, 0xde, 0xdc, 0x1f, 0x42, 0xc3, 0x93,
+    0xc8, 0x1f, 0xef, 0x6d, 0x4c, 0x92, 0x64, 0x11, 0xef, 0x6c, 0x6e, 0x8e, 0xa1, 0x1b, 0x71, 0xf3,
+    0x32, 0x0c, 0x2f, 0xa7, 0xbe, 0xb7, 0x08, 0xe2, 0xe6, 0x30, 0x9c, 0x6d, 0xa4, 0xb5, 0x57, 0x17,
+    0xde, 0x1c, 0xc6, 0xb1, 0xfb, 0xfd, 0xd8, 0x9b, 0x05, 0xd3, 0xdb, 0xbd, 0xdf, 0xf9, 0xc9, 0xf3,
+    0xc8, 0x0b, 0xe6, 0xf1, 0x93, 0x57, 0xe1, 0x3c, 0xdc, 0xb9, 0xb9, 0x9c, 0x24, 0xff, 0xd0, 0x71,
+    0x9c, 0xdd, 0x2e, 0xfc, 0xeb, 0xc1, 0xbf, 0x2d, 0xc7, 0xf9, 0x96, 0x17, 0x3d, 0x9d, 0x2e, 0xe3,
+    0x27, 0xbf, 0xf3, 0xae, 0xbc, 0x28, 0xf1, 0x9e, 0x9c, 0x7b, 0xf3, 0xd8, 0x5e, 0x7a, 0x14, 0xc4,
+    0x8b, 0xa9, 0x77, 0xbb, 0x17, 0xdf, 0x78, 0x8b, 0x0d, 0x36, 0x98, 0x38, 0xb9, 0x9d, 0xfa, 0xf1,
+    0xc4, 0xf7, 0x13, 0xd6, 0xd1, 0x78, 0x18, 0x05, 0x8b, 0x84, 0xc4, 0xd1, 0x30, 0xed, 0xe9, 0x72,
+    0xbe, 0xb8, 0xba, 0xa4, 0xdd, 0x9b, 0xfd, 0x92, 0x24, 0x9b, 0x00, 0x25, 0xa1, 0xdf, 0x9a, 0xb3,
+    0x60, 0xde, 0xfc, 0x63, 0xbc, 0xf1, 0xec, 0xe9, 0x26, 0xab, 0xc6, 0x20, 0x20, 0x44, 0xfc, 0x46,
+    0xc8, 0xe6, 0x77, 0x64, 0x4f, 0xf9, 0x8f, 0x9c, 0x1d, 0x9d, 0x1f, 0x5d, 0x90, 0x6f, 0xc9, 0xf3,
+    0xfd, 0xf3, 0x23, 0xfd, 0xcd, 0x77, 0x9b, 0xb4, 0xc2, 0x77, 0x75, 0xf2, 0xdd, 0xce, 0xce, 0xc0,
+    0x1f, 0x87, 0x91, 0x4f, 0xbf, 0x7a, 0xe3, 0xc4, 0x8f, 0xc8, 0x1d, 0x99, 0x79, 0xd1, 0x65, 0x30,
+    0xdf, 0x21, 0xce, 0x2e, 0x59, 0x78, 0xa3, 0x51, 0x30, 0xbf, 0xa4, 0xdf, 0x07, 0xe1, 0xc7, 0x46,
+    0x1c, 0xfc, 0x4a, 0x7f, 0x0e, 0xc2, 0x68, 0xe4, 0x47, 0x0d, 0x78, 0xb4, 0x4b, 0xee, 0x29, 0xb4,
+    0x9d, 0x28, 0x0c, 0x13, 0x72, 0x47, 0xbf, 0x13, 0xd2, 0x68, 0x0c, 0x2e, 0x1b, 0xf8, 0x64, 0x87,
+    0x7c, 0xed, 0x78, 0xce, 0xb0, 0xe5, 0xec, 0xaa, 0x6f, 0x66, 0x1e, 0xc2, 0xff, 0xda, 0x19, 0xb7,
+    0x5a, 0xad, 0xae, 0xf6, 0x66, 0x08, 0x94, 0x00, 0x6f, 0x5a, 0x5e, 0x6b, 0xe4, 0x76, 0x32, 0x6f,
+    0x1a, 0x93, 0xf0, 0xda, 0x8f, 0xf0, 0xfd, 0xd8, 0x6d, 0xb7, 0x75, 0x98, 0x71, 0x30, 0xf2, 0x07,
+    0x1e, 0x7d, 0xe9, 0xb6, 0xba, 0xad, 0x81, 0xf6, 0x12, 0x49, 0xdd, 0xcf, 0x79, 0x17, 0xcc, 0x17,
+    0x4b, 0xec, 0xa7, 0xdb, 0x75, 0xfb, 0x1a, 0x4c, 0x3a, 0x46, 0x7c, 0xe1, 0xb9, 0xa3, 0x76, 0xd7,
+    0x7c, 0xd1, 0x98, 0x06, 0x30, 0xed, 0xf0, 0xba, 0xdd, 0x6d, 0xf7, 0x3b, 0x4a, 0xbd, 0xe1, 0xad,
+    0x87, 0x83, 0x73, 0xa1, 0x92, 0xef, 0xeb, 0x8f, 0x1b, 0xa3, 0x60, 0xb6, 0x43, 0xa2, 0xcb, 0x81,
+    0x57, 0x6d, 0x77, 0xea, 0xc4, 0x6d, 0xb5, 0xe0, 0xa3, 0xdd, 0xaf, 0x13, 0xa7, 0xd9, 0xea, 0xd6,
+    0x8c, 0xb2, 0x97, 0xd3, 0xf0, 0x26, 0xa7, 0x70, 0x5b, 0x29, 0xbb, 0x58, 0x46, 0x8b, 0xa9, 0x0f,
+    0x0d, 0x7a, 0x5b, 0xfd, 0xc1, 0xd8, 0x33, 0x5f, 0x28, 0x4d, 0xb6, 0x7a, 0x5b, 0x75, 0xd2, 0x6a,
+    0x6f, 0x03, 0x98, 0xae, 0x93, 0x69, 0xf3, 0x32, 0xf2, 0x7d, 0xec, 0x77, 0x07, 0x30, 0xd5, 0x77,
+    0x8c, 0xe7, 0x0a, 0x94, 0x2d, 0xec, 0x8b, 0xeb, 0x02, 0x24, 0x37, 0xdb, 0xf1, 0x5b, 0x7f, 0x4a,
+    0x7b, 0xfd, 0xf5, 0xd8, 0x1b, 0x0e, 0xd5, 0xa9, 0x65, 0x2f, 0x14, 0x30, 0xb4, 0x0b, 0xae, 0x43,
+    0x07, 0x96, 0x01, 0x13, 0xf9, 0x48, 0x04, 0xe3, 0xfe, 0x56, 0x6b, 0xab, 0xa5, 0x3d, 0x55, 0x01,
+    0x74, 0xa0, 0xf9, 0x56, 0xab, 0xcd, 0x3f, 0x0c, 0x08, 0x83, 0xe9, 0x12, 0x71, 0xd2, 0x73, 0xbc,
+    0xae, 0x8a, 0x13, 0x7c, 0xac, 0xc0, 0xd8, 0xee, 0x41, 0xed, 0x5e, 0xd7, 0x8e, 0x90, 0x30, 0x02,
+    0x5e, 0x89, 0x40, 0xc6, 0x83, 0x6d, 0xb7, 0x3d, 0x4c, 0x5f, 0x24, 0xfe, 0xc7, 0xa4, 0xb1, 0x88,
+    0x02, 0x58, 0x27, 0xb7, 0xf8, 0xba, 0x35, 0xee, 0x8e, 0xb7, 0x8d, 0xd7, 0x31, 0xb2, 0xad, 0x11,
+    0x2b, 0xb0, 0xdd, 0xf1, 0xda, 0x83, 0xbe, 0x51, 0x60, 0xb6, 0x4c, 0xe8, 0x20, 0x7b, 0x9d, 0xad,
+    0x4e, 0x7f, 0x60, 0xbc, 0xa4, 0x3d, 0xfc, 0xba, 0xb3, 0xd5, 0xed, 0xf6, 0x14, 0xc0, 0xc8, 0xc4,
+    0x1a, 0x31, 0x32, 0x1c, 0x52, 0x41, 0x26, 0x44, 0x38, 0x13, 0x22, 0xc8, 0x84, 0x2a, 0x75, 0x12,
+    0xdf, 0xc6, 0x89, 0x3f, 0x6b, 0x2c, 0x03, 0xf8, 0x0a, 0x4f, 0xa0, 0x0f, 0x51, 0x30, 0x36, 0xaa,
+    0xcf, 0x90, 0xbb, 0x91, 0x8a, 0x64, 0x77, 0x04, 0xd9, 0x1d, 0xd4, 0xc5, 0xe7, 0xf1, 0xc2, 0x1b,
+    0x2a, 0x04, 0x1b, 0x79, 0xa3, 0x60, 0x09, 0x6d, 0xb5, 0x9c, 0xc5, 0x47, 0xf3, 0x69, 0x23, 0x86,
+    0x0e, 0xf6, 0x2c, 0xcf, 0xa7, 0xc0, 0x1c, 0x5a, 0x1d, 0xf1, 0xe2, 0xfe, 0x11, 0xfd, 0x43, 0x25,
+    0xcf, 0x1d, 0x61, 0xfd, 0x0f, 0x7e, 0x05, 0x9c, 0xb6, 0xba, 0x0b, 0xc9, 0x39, 0x06, 0xe1, 0xe8,
+    0x56, 0x32, 0x8e, 0x81, 0x37, 0xbc, 0xba, 0x8c, 0xc2, 0xe5, 0x1c, 0x70, 0x73, 0xed, 0x45, 0x55,
+    0xc9, 0x48, 0xe4, 0xc4, 0x50, 0x28, 0x8c, 0x15, 0x8b, 0x22, 0x12, 0x31, 0xb2, 0xd0, 0x30, 0x9c,
+    0x86, 0x91, 0x78, 0xad, 0xce, 0x97, 0x2c, 0x01, 0xec, 0x14, 0xb8, 0x02, 0x5b, 0xc2, 0x2d, 0xc7,
+    0xb9, 0x9e, 0x88, 0x17, 0xc8, 0x61, 0xc6, 0x48, 0xab, 0x1f, 0x77, 0xc8, 0x24, 0x18, 0x8d, 0xfc,
+    0xb9, 0x18, 0x0b, 0x65, 0x73, 0x3b, 0xb1, 0x3f, 0x05, 0x69, 0x14, 0x84, 0x73, 0x18, 0x51, 0xb6,
+    0xb7, 0xb8, 0x72, 0x6b, 0xbb, 0xa2, 0xfd, 0xaf, 0x1d, 0x10, 0x06, 0xb2, 0x66, 0xe3, 0xc6, 0x1f,
+    0x5c, 0x05, 0xd0, 0xd3, 0x61, 0x14, 0x4e, 0xa7, 0xc0, 0xab, 0x00, 0x02, 0x15, 0x9b, 0x0c, 0x95,
+    0xf9, 0xe5, 0x1a, 0x49, 0x04, 0x0d, 0x19, 0xed, 0xc1, 0xb3, 0x39, 0xcc, 0x58, 0x04, 0xa2, 0xb8,
+    0xb0, 0xea, 0x64, 0x39, 0x1b, 0x58, 0xbb, 0xca, 0xd8, 0x58, 0x6d, 0x57, 0x30, 0x73, 0x31, 0xdf,
+    0xed, 0x15, 0x7d, 0x41, 0x80, 0x3b, 0x94, 0x11, 0x17, 0x80, 0x65, 0xdc, 0xb1, 0xb6, 0x2b, 0x48,
+    0xc0, 0x94, 0x4e, 0x2f, 0xf7, 0x7f, 0x7a, 0xfd, 0xe6, 0xc2, 0x2a, 0x97, 0x9a, 0xde, 0x62, 0x21,
+    0xe9, 0x81, 0x4b, 0xd1, 0x1d, 0x32, 0x9e, 0xfa, 0x1f, 0x57, 0xcc, 0x5d, 0xda, 0xd4, 0x39, 0x93,
+    0x05, 0x12, 0x22, 0x97, 0x0d, 0x12, 0x2a, 0xc7, 0xba, 0xeb, 0x2a, 0xa4, 0x6d, 0xa5, 0x3c, 0x5e,
+    0x51, 0x52, 0x8d, 0x40, 0x15, 0x6f, 0x7b, 0xf1, 0x91, 0xc4, 0xe1, 0x34, 0x18, 0x19, 0x18, 0x2d,
+    0xea, 0x3b, 0x7e, 0x87, 0xf5, 0x1d, 0x31, 0x1a, 0xda, 0x41, 0x4a, 0x59, 0xce, 0xe6, 0xda, 0xdb,
+    0x78, 0x12, 0x81, 0x06, 0x83, 0x32, 0x97, 0x3f, 0x5d, 0x84, 0x71, 0xc0, 0x4a, 0x8f, 0x83, 0x8f,
+    0xfe, 0x48, 0x3c, 0x4e, 0xc2, 0x05, 0x15, 0xcc, 0x53, 0x7f, 0x9c, 0x70, 0x09, 0x9d, 0x24, 0xe1,
+    0x4c, 0xa9, 0xf8, 0x2b, 0x08, 0xb7, 0x91, 0xff, 0x91, 0x62, 0x49, 0xd6, 0x42, 0xba, 0xe1, 0xe0,
+    0xe8, 0x77, 0x90, 0xff, 0x33, 0x94, 0x29, 0x31, 0x19, 0x2e, 0x07, 0xc1, 0xb0, 0x31, 0xf0, 0x7f,
+    0x0d, 0xfc, 0xa8, 0xea, 0x34, 0x81, 0x37, 0x53, 0xae, 0x88, 0xbc, 0xbe, 0xa6, 0x2e, 0x02, 0x81,
+    0xcf, 0xc6, 0x00, 0xea, 0x8f, 0x24, 0x56, 0xa5, 0xb2, 0x80, 0x68, 0x65, 0x1f, 0x2d, 0x85, 0x47,
+    0x48, 0x9d, 0x81, 0x75, 0xf2, 0x21, 0xc8, 0xf3, 0x80, 0xaa, 0xe6, 0x8d, 0x00, 0xb8, 0x1c, 0xd0,
+    0xe9, 0x10, 0x28, 0xdf, 0x8f, 0xc4, 0xab, 0x4b, 0x0f, 0x90, 0xd1, 0x72, 0x53, 0xce, 0x63, 0xe9,
+    0x68, 0x7c, 0x7d, 0x09, 0x24, 0xab, 0xf1, 0x06, 0xbe, 0x5e, 0x0d, 0xbc, 0x5b, 0xab, 0x53, 0x3e,
+    0x02, 0xf5, 0xf5, 0x9e, 0xe5, 0x4d, 0xa8, 0x1d, 0x04, 0xea, 0xd2, 0x82, 0x13, 0xde, 0x70, 0x0a,
+    0xde, 0x42, 0x1e, 0xa1, 0xf2, 0x46, 0xca, 0x0c, 0xa6, 0x7e, 0x02, 0xa3, 0x6b, 0x20, 0x4f, 0xa6,
+    0x38, 0x6d, 0x38, 0x4d, 0xc7, 0xf5, 0x67, 0x39, 0x70, 0xe3, 0xe5, 0xc0, 0x60, 0xb0, 0x2d, 0x04,
+    0x92, 0x65, 0x83, 0x54, 0xec, 0xd4, 0x76, 0x73, 0xb9, 0x28, 0xca, 0x81, 0x74, 0xd5, 0xca, 0x56,
+    0xe6, 0xde, 0x35, 0xc2, 0x9f, 0x52, 0x5a, 0x52, 0xd4, 0x42, 0x44, 0x38, 0x13, 0x10, 0x65, 0xd1,
+    0x42, 0xe7, 0xc9, 0x4d, 0x59, 0x4c, 0x13, 0x40, 0xd3, 0x19, 0xcd, 0x59, 0xf2, 0xd6, 0x39, 0x37,
+    0x67, 0x5b, 0xa1, 0xbd, 0x16, 0x25, 0xbb, 0x4e, 0x86, 0xec, 0x04, 0x77, 0x63, 0x63, 0x95, 0x52,
+    0xac, 0x40, 0x62, 0x48, 0x11, 0x9e, 0x96, 0x59, 0x46, 0x31, 0x16, 0x5a, 0x84, 0x81, 0x4a, 0x7a,
+    0x2a, 0xda, 0xdb, 0xcd, 0x6e, 0xda, 0xb4, 0x36, 0xcd, 0x5d, 0xfb, 0x12, 0xf4, 0xa6, 0x53, 0xaa,
+    0x78, 0xc4, 0x7a, 0x7f, 0xd5, 0xf5, 0xa1, 0x72, 0xfa, 0x0c, 0x47, 0x00, 0xc3, 0xc2, 0x4b, 0xc0,
+    0x90, 0xd2, 0xc8, 0x5e, 0xe0, 0xd4, 0xca, 0xa6, 0xb9, 0xfa, 0xd5, 0xad, 0x8b, 0x7f, 0x40, 0x59,
+    0x9d, 0xda, 0x6e, 0x91, 0xcc, 0x34, 0xe1, 0x36, 0xbd, 0x21, 0xb6, 0x59, 0x20, 0xb5, 0x85, 0xb6,
+    0x6b, 0xc7, 0x2f, 0x5b, 0x75, 0xfa, 0x04, 0xf1, 0x02, 0x76, 0xe5, 0xb8, 0x66, 0x1d, 0x1e, 0xef,
+    0x86, 0x30, 0x62, 0x64, 0x77, 0xb8, 0x85, 0x0a, 0x7a, 0x4e, 0x25, 0x8b, 0x30, 0x6f, 0x00, 0x58,
+    0x85, 0x55, 0x20, 0xde, 0x30, 0xee, 0xd9, 0x50, 0xb5, 0x1c, 0xca, 0x58, 0xbb, 0xce, 0x37, 0xda,
+    0x7c, 0x21, 0x9b, 0xe4, 0x1c, 0x13, 0x30, 0xee, 0xff, 0x54, 0x6d, 0x40, 0x09, 0x39, 0x08, 0x2e,
+    0x51, 0xda, 0x29, 0x10, 0x21, 0xa0, 0x8a, 0x65, 0x8c, 0x0d, 0x13, 0x82, 0x54, 0x1d, 0x04, 0x47,
+    0xff, 0x39, 0xd6, 0xe1, 0x73, 0x7e, 0xc6, 0x9b, 0x6e, 0xf5, 0x71, 0x51, 0x49, 0xb1, 0x48, 0x7f,
+    0x99, 0x6c, 0x2d, 0x44, 0x6e, 0x92, 0xc0, 0xd2, 0x72, 0x9a, 0x5b, 0xb9, 0x93, 0xca, 0xa0, 0xca,
+    0xa2, 0x2d, 0xad, 0xe0, 0xc0, 0x1b, 0x5d, 0xa6, 0x88, 0x66, 0x96, 0x62, 0x83, 0xa1, 0xd0, 0x5b,
+    0x26, 0x61, 0xfe, 0x40, 0x23, 0x64, 0x3b, 0x3a, 0x2d, 0x50, 0xed, 0xc8, 0xb2, 0x86, 0x9c, 0x9c,
+    0x15, 0xb4, 0x95, 0x16, 0x4f, 0x97, 0x3b, 0x60, 0xa7, 0x97, 0xbb, 0xd8, 0xfb, 0x0b, 0x4d, 0x67,
+    0x50, 0x31, 0x25, 0xa6, 0x16, 0xe9, 0x9c, 0xb2, 0x18, 0x5d, 0xa0, 0x98, 0x0c, 0x70, 0x0c, 0x2a,
+    0xa8, 0x1f, 0x65, 0x45, 0x9d, 0x45, 0xc0, 0x51, 0xea, 0x29, 0x94, 0x6e, 0x1c, 0x9f, 0xdc, 0x73,
+    0x12, 0xcc, 0xc7, 0x61, 0xb1, 0xfe, 0x8b, 0xa6, 0x6f, 0x2d, 0x9f, 0x3f, 0x58, 0xe5, 0x67, 0x49,
+    0xb6, 0xa7, 0x71, 0xf2, 0xbc, 0xde, 0x35, 0xa6, 0xde, 0xc0, 0x37, 0x35, 0x78, 0xa7, 0x58, 0xc0,
+    0xd0, 0x1f, 0xca, 0xc2, 0x59, 0x2e, 0x16, 0x7e, 0x34, 0xf4, 0x62, 0x3f, 0x2b, 0xda, 0x80, 0xff,
+    0xf4, 0x51, 0xb2, 0x71, 0x6a, 0x12, 0x0a, 0x42, 0x47, 0x11, 0x12, 0x6a, 0x67, 0xae, 0x3d, 0x30,
+    0xe2, 0x44, 0x67, 0xf2, 0x45, 0x98, 0xda, 0x57, 0x37, 0xd3, 0x57, 0x2e, 0xf7, 0x2d, 0xe0, 0xe3,
+    0xc4, 0x4b, 0xc0, 0xb6, 0xba, 0x2b, 0x2f, 0x87, 0xa8, 0xbc, 0xe6, 0x9d, 0xa7, 0x93, 0xcf, 0xd6,
+    0x9e, 0x29, 0x8c, 0x2d, 0x6d, 0x8d, 0xd0, 0x65, 0x22, 0x16, 0xf0, 0x96, 0xba, 0x7e, 0xe9, 0x0f,
+    0x63, 0x0e, 0x91, 0x23, 0xe5, 0x40, 0x69, 0x86, 0xf3, 0x69, 0x30, 0xf7, 0xad, 0x0a, 0x39, 0x35,
+    0xe0, 0x6b, 0xdc, 0x7f, 0x33, 0xf1, 0x46, 0x68, 0x9f, 0x3b, 0xf0, 0x3f, 0xe8, 0xa5, 0x51, 0xc2,
+    0x9b, 0x03, 0xbf, 0x67, 0x5c, 0x72, 0xb1, 0x9c, 0xc6, 0x3e, 0xed, 0x9f, 0x1b, 0x13, 0x68, 0x05,
+    0xfd, 0x7a, 0x7e, 0x7e, 0xeb, 0xe3, 0x71, 0x6e, 0xf3, 0x74, 0xe1, 0x2b, 0xba, 0xf9, 0x2b, 0x30,
+    0x3b, 0xa5, 0x62, 0x8e, 0x8e, 0x20, 0x49, 0xfb, 0x42, 0xbd, 0xb0, 0x31, 0x17, 0x4d, 0x55, 0x7f,
+    0x80, 0x62, 0xbd, 0xd2, 0x64, 0xf8, 0x91, 0x7a, 0x88, 0x64, 0xc7, 0x98, 0xc3, 0x48, 0x76, 0x4d,
+    0x54, 0xed, 0xf6, 0x56, 0x18, 0x0c, 0xac, 0x5e, 0xed, 0xb7, 0xd1, 0x79, 0xff, 0xb8, 0x8c, 0x93,
+    0x60, 0x7c, 0xdb, 0x90, 0xf2, 0x8e, 0x5a, 0xf0, 0xa0, 0xc0, 0x27, 0x37, 0xbe, 0x3f, 0xcf, 0x2c,
+    0x71, 0x87, 0xb8, 0x8a, 0x5e, 0x94, 0x4a, 0x44, 0x00, 0x32, 0xbc, 0xba, 0x35, 0xac, 0x0a, 0xd3,
+    0x82, 0xe8, 0x3a, 0xea, 0xb8, 0x47, 0x51, 0xb8, 0x68, 0x8c, 0x83, 0x69, 0x82, 0x9c, 0x68, 0x30,
+    0x5d, 0x46, 0x55, 0x5c, 0x63, 0x3a, 0x7b, 0x63, 0xa8, 0xa0, 0xf3, 0xb7, 0xce, 0x6a, 0x6a, 0x29,
+    0xb6, 0xb0, 0x80, 0x41, 0x3d, 0xc3, 0x06, 0xff, 0xd9, 0x92, 0x8b, 0x4c, 0x53, 0xa4, 0x6d, 0x7a,
+    0x73, 0x4b, 0xd1, 0x9b, 0x39, 0x44, 0x6a, 0xc1, 0xad, 0xd5, 0x2d, 0x95, 0x1d, 0xcd, 0xc2, 0x41,
+    0x30, 0xf5, 0x1b, 0x33, 0x7f, 0xbe, 0x6c, 0x0c, 0x92, 0x79, 0x56, 0x75, 0x9d, 0x87, 0x73, 0xdf,
+    0x46, 0x27, 0xf4, 0xb9, 0x64, 0xe1, 0xec, 0x57, 0xa1, 0xe6, 0x99, 0xa7, 0x73, 0xca, 0x49, 0x35,
+    0x7d, 0x2d, 0xb0, 0x36, 0x67, 0xc0, 0xc4, 0xa8, 0x93, 0x22, 0x44, 0xd5, 0xcf, 0xa2, 0x2a, 0xa6,
+    0xcb, 0x18, 0x8a, 0x5a, 0xfb, 0xbf, 0x0a, 0x1b, 0x7d, 0x8b, 0xe6, 0xdd, 0x33, 0x15, 0xef, 0xdf,
+    0x58, 0x94, 0xad, 0xf6, 0xf9, 0x94, 0xd0, 0xdf, 0xdd, 0x32, 0xfa, 0x7b, 0x29, 0x17, 0x54, 0x81,
+    0x92, 0x6f, 0xa0, 0x3f, 0xd5, 0xd2, 0x35, 0x4d, 0xd8, 0xea, 0x4e, 0xc9, 0x45, 0x2a, 0x73, 0x8d,
+    0xd7, 0xf4, 0xb9, 0x0d, 0x86, 0xe1, 0x3c, 0xeb, 0xf4, 0x50, 0xe5, 0x8c, 0xeb, 0xe6, 0x2a, 0x4f,
+    0xdd, 0x3c, 0x86, 0x6b, 0xa7, 0x8b, 0x0c, 0x33, 0xd2, 0x79, 0x95, 0x29, 0x8e, 0x33, 0x88, 0x40,
+    0x96, 0x02, 0xb2, 0x29, 0xed, 0x6f, 0xbe, 0xca, 0x4e, 0x59, 0xd4, 0xd0, 0x9b, 0x0e, 0xab, 0xc0,
+    0xca, 0xbf, 0x21, 0x4f, 0x90, 0x1c, 0x6b, 0xba, 0x3e, 0xef, 0x18, 0x8a, 0xb9, 0xdb, 0x73, 0x7e,
+    0x5b, 0xca, 0x54, 0xca, 0xa8, 0x62, 0x17, 0xb9, 0x1b, 0xe9, 0xa0, 0xe8, 0xa5, 0x86, 0x8e, 0x53,
+    0xa7, 0xff, 0x6b, 0xa6, 0x7e, 0x67, 0xc9, 0x70, 0xdd, 0x94, 0xde, 0x84, 0x4b, 0x52, 0x77, 0x48,
+    0xe6, 0xb0, 0x1b, 0x45, 0x88, 0x0b, 0x94, 0x02, 0x48, 0x46, 0x7e, 0xc4, 0x07, 0x05, 0xac, 0x11,
+    0x2e, 0x93, 0x7c, 0xf4, 0x37, 0xc3, 0x85, 0x3f, 0x57, 0x19, 0xe3, 0x60, 0x1a, 0x0e, 0xaf, 0x74,
+    0xb2, 0x0a, 0x17, 0xcc, 0xff, 0xa9, 0xa3, 0x18, 0xe7, 0x62, 0xf7, 0xf3, 0xd8, 0xf0, 0xae, 0xd5,
+    0x75, 0x94, 0xcf, 0x56, 0x2d, 0x16, 0xf2, 0x83, 0xb9, 0x81, 0x6a, 0x11, 0x20, 0x2d, 0x3d, 0x78,
+    0xd1, 0xa7, 0x1d, 0x44, 0xe4, 0x5b, 0x96, 0x3e, 0x43, 0xe3, 0x5a, 0x36, 0x7a, 0xb6, 0x7a, 0x93,
+    0xb1, 0x7a, 0x7f, 0x94, 0xeb, 0x8e, 0x66, 0x66, 0xb8, 0xa5, 0x2a, 0x67, 0x0f, 0xd2, 0x76, 0xd5,
+    0x18, 0x03, 0xfb, 0x65, 0xb1, 0xa7, 0x3e, 0x89, 0x19, 0xe4, 0xed, 0x01, 0x68, 0xdd, 0xe2, 0x7e,
+    0x36, 0xe9, 0x6d, 0xb2, 0x14, 0x51, 0xfd, 0x68, 0xc2, 0xf3, 0x92, 0xd1, 0x07, 0x7a, 0xa9, 0xf3,
+    0x5d, 0xab, 0xbc, 0xb6, 0xb3, 0x4c, 0xd5, 0xed, 0x5b, 0x66, 0xa7, 0x87, 0x13, 0x9f, 0xfa, 0xe6,
+    0xb5, 0xea, 0x42, 0xa3, 0x56, 0x1b, 0xe1, 0x0a, 0x84, 0xf4, 0x51, 0x33, 0x3b, 0x03, 0x56, 0x7b,
+    0x30, 0xf4, 0x40, 0x54, 0xc7, 0x52, 0xf7, 0xc4, 0x0d, 0x6f, 0xc3, 0xd0, 0x5e, 0xcb, 0x16, 0xb1,
+    0xa8, 0x08, 0xda, 0x3a, 0x33, 0x26, 0xd5, 0x35, 0xed, 0x6d, 0x05, 0x29, 0x36, 0x41, 0xd8, 0x5b,
+    0x2d, 0x08, 0x99, 0x09, 0xa6, 0x12, 0x7c, 0x3a, 0xa6, 0x26, 0xdf, 0xcf, 0xcf, 0xa1, 0x58, 0xb9,
+    0xdd, 0x68, 0x7a, 0xa4, 0x04, 0x4a, 0xb3, 0x00, 0x01, 0x39, 0xc5, 0x30, 0xf9, 0xc6, 0xa1, 0x09,
+    0x51, 0x58, 0x26, 0x26, 0xbc, 0x38, 0x98, 0x2d, 0xd1, 0xc5, 0x63, 0x07, 0x96, 0xee, 0x64, 0x9a,
+    0xf0, 0xd8, 0x1b, 0x03, 0xa4, 0x66, 0xe2, 0xf5, 0xd4, 0x15, 0xd6, 0xcb, 0x33, 0xf1, 0xd4, 0x36,
+    0x81, 0x49, 0x21, 0x57, 0x3b, 0xc0, 0x76, 0x76, 0x0b, 0x91, 0xa9, 0x36, 0x57, 0xc6, 0x90, 0xe3,
+    0xfe, 0x0d, 0x4a, 0x85, 0x8d, 0x45, 0x00, 0x1a, 0xca, 0xdf, 0x35, 0xb1, 0xdd, 0x67, 0xfa, 0xdb,
+    0x8c, 0x96, 0xf3, 0x39, 0xb4, 0xf9, 0x49, 0x64, 0xa4, 0xc2, 0x8b, 0x61, 0x81, 0x2f, 0x3e, 0x65,
+    0xd6, 0x19, 0xc8, 0x24, 0x98, 0xe1, 0x1e, 0x33, 0xc5, 0x61, 0x6a, 0xdb, 0xae, 0x5e, 0x29, 0x39,
+    0x3a, 0x12, 0xc9, 0x67, 0x4c, 0x9a, 0xde, 0xbf, 0x08, 0x6f, 0xd0, 0xd2, 0x4c, 0x32, 0x72, 0xd9,
+    0xc2, 0xd7, 0xd7, 0x53, 0xac, 0x4b, 0x2a, 0x43, 0x39, 0xf2, 0xf4, 0x33, 0xe8, 0x8e, 0xab, 0x55,
+    0x69, 0x39, 0xf8, 0x42, 0xa2, 0x28, 0xe4, 0x03, 0x16, 0x37, 0x34, 0x86, 0x18, 0x60, 0x70, 0x01,
+    0xfe, 0x73, 0x9a, 0x6e, 0x4a, 0x35, 0x69, 0x73, 0x45, 0x34, 0xb3, 0x92, 0x06, 0x2d, 0x4d, 0x6e,
+    0x75, 0xea, 0x18, 0x5c, 0x81, 0xb1, 0x15, 0xf6, 0x16, 0xa5, 0xba, 0x20, 0xad, 0x6f, 0x6a, 0xca,
+    0xce, 0xfd, 0x38, 0xae, 0xb6, 0x78, 0x0d, 0x21, 0x62, 0x0e, 0x18, 0x3a, 0x09, 0x28, 0x46, 0x9e,
+    0x2a, 0x5d, 0xe8, 0xc3, 0x1c, 0xaf, 0x4b, 0xba, 0x89, 0xa7, 0x98, 0x72, 0x72, 0x4f, 0xfc, 0x56,
+    0x75, 0xf3, 0xe6, 0x6c, 0xed, 0x1e, 0xec, 0x9f, 0x1d, 0x9e, 0xdb, 0x77, 0x76, 0x51, 0xc7, 0xfe,
+    0x4d, 0x5d, 0x9d, 0x16, 0x3f, 0xa7, 0xc2, 0xb4, 0x34, 0x6d, 0x4d, 0x99, 0x0b, 0xdc, 0xf3, 0xd4,
+    0xe9, 0x8b, 0x86, 0x25, 0xad, 0x61, 0xa6, 0x29, 0xd5, 0x1a, 0x53, 0x24, 0x46, 0x6d, 0x6f, 0x34,
+    0x77, 0x57, 0xfc, 0x87, 0xb3, 0xe3, 0x43, 0x3b, 0xe6, 0x2e, 0xa3, 0x60, 0xd4, 0xe8, 0xa8, 0x7a,
+    0x39, 0x3e, 0xd9, 0xa5, 0x9f, 0xc0, 0x13, 0x66, 0x0b, 0x14, 0x58, 0x0d, 0xe6, 0xf3, 0x8a, 0xd1,
+    0xd4, 0x5f, 0xf8, 0x5e, 0x52, 0xed, 0xd4, 0x49, 0x6b, 0x8c, 0x46, 0xa1, 0xe2, 0xc2, 0x30, 0xbc,
+    0xac, 0xa2, 0x3f, 0x69, 0x2b, 0xed, 0x75, 0x5b, 0x69, 0x3f, 0xa4, 0x15, 0x77, 0xdd, 0x56, 0x5c,
+    0x4b, 0x2b, 0x39, 0x68, 0xfc, 0xfd, 0xe9, 0xb1, 0x1d, 0x8b, 0x57, 0x8b, 0x40, 0xf8, 0xb2, 0x8b,
+    0x65, 0x50, 0x31, 0xcb, 0x25, 0x05, 0xde, 0x6d, 0x69, 0x85, 0x5a, 0x7d, 0xdc, 0x2b, 0xf4, 0x29,
+    0x03, 0x6b, 0x3d, 0xc3, 0x4e, 0xc6, 0xee, 0x73, 0xef, 0xf7, 0x03, 0xc5, 0x8a, 0xdb, 0x5b, 0xbd,
+    0xb7, 0x92, 0xb7, 0xf3, 0x2c, 0x5e, 0x07, 0x73, 0x3f, 0x75, 0xa5, 0xda, 0xfb, 0x87, 0x91, 0x96,
+    0xa3, 0x3c, 0x9d, 0x58, 0x29, 0xbc, 0x04, 0x65, 0xc4, 0xa6, 0xc6, 0xaf, 0x54, 0xc5, 0x99, 0x91,
+    0x9f, 0x55, 0xf9, 0xbb, 0x4c, 0xe5, 0xb7, 0x52, 0xc5, 0xf9, 0xd1, 0xc9, 0xf9, 0xeb, 0xb3, 0x1c,
+    0xce, 0x14, 0xfb, 0x73, 0x10, 0x5e, 0x0d, 0xe1, 0xf6, 0x35, 0xa5, 0xd6, 0x0a, 0x4f, 0xab, 0x2e,
+    0xd5, 0xd8, 0xae, 0x5b, 0xe2, 0x45, 0x49, 0x66, 0x1d, 0xf4, 0x95, 0x65, 0xc0, 0x9b, 0xb4, 0x98,
+    0x32, 0x39, 0xe6, 0x88, 0xea, 0x16, 0x5c, 0x6f, 0x7b, 0xa5, 0x87, 0x0e, 0xd0, 0x5c, 0xdb, 0x88,
+    0x77, 0x24, 0xb9, 0x5d, 0xf8, 0xe5, 0xf6, 0x78, 0x98, 0x48, 0x53, 0xad, 0x22, 0x57, 0xce, 0x44,
+    0x51, 0x4c, 0x81, 0xda, 0x9a, 0xdc, 0x66, 0xe1, 0x5a, 0x8a, 0xb6, 0x7b, 0xd9, 0x5f, 0xb1, 0xfb,
+    0xa1, 0xc1, 0x68, 0x86, 0x57, 0x6b, 0xed, 0x7b, 0xf4, 0x32, 0xfb, 0x1e, 0x56, 0xa8, 0x37, 0x5e,
+    0x34, 0x2f, 0x50, 0x05, 0x0b, 0x01, 0xcb, 0x22, 0x56, 0x45, 0xbc, 0x65, 0x55, 0xc4, 0x59, 0xe3,
+    0x9f, 0xb8, 0xbc, 0xfb, 0xab, 0x97, 0xb7, 0x41, 0x91, 0xea, 0x6e, 0x6b, 0xe1, 0xca, 0xd7, 0x91,
+    0x64, 0x59, 0xb9, 0xdd, 0xcf, 0xb6, 0x72, 0x45, 0x23, 0x6a, 0xc8, 0x96, 0x6a, 0x35, 0xe5, 0x2b,
+    0x10, 0x85, 0x8a, 0x41, 0x3b, 0xab, 0xd0, 0x98, 0x1e, 0xb5, 0x15, 0x0c, 0x38, 0xed, 0x17, 0x6e,
+    0x7e, 0x4c, 0x33, 0x9d, 0x53, 0x5d, 0x60, 0xf9, 0x8d, 0xab, 0x6a, 0x07, 0xa5, 0x7e, 0x58, 0xa2,
+    0xbd, 0x32, 0xd1, 0x57, 0x2b, 0xe3, 0x3e, 0x8c, 0xfe, 0xc9, 0x90, 0xee, 0x87, 0xc4, 0x45, 0x88,
+    0xe8, 0x32, 0x1e, 0xeb, 0x66, 0x0b, 0x2f, 0x13, 0xbe, 0xd5, 0x1c, 0xd7, 0x2a, 0x4a, 0x0a, 0xe8,
+    0xc9, 0x25, 0xa2, 0x00, 0x9a, 0xad, 0x6e, 0x3b, 0x23, 0xff, 0xb2, 0xae, 0x3a, 0xeb, 0xea, 0x36,
+    0x47, 0x97, 0x5b, 0x5b, 0x37, 0x20, 0x82, 0x0f, 0x9b, 0xc6, 0xeb, 0xae, 0xcf, 0xbb, 0x4b, 0x33,
+    0xbc, 0x72, 0x31, 0x53, 0x59, 0xb1, 0x73, 0x70, 0x71, 0xfc, 0xfa, 0x84, 0x5c, 0x1c, 0x5f, 0xbc,
+    0x3c, 0xca, 0x13, 0x3e, 0x43, 0xe6, 0xf8, 0x62, 0xdb, 0x5c, 0xb6, 0xb0, 0xa2, 0xf5, 0xd7, 0x75,
+    0xa7, 0x48, 0x9b, 0xc9, 0xc6, 0x36, 0x3d, 0x44, 0xa3, 0xe9, 0xa5, 0xbc, 0xc1, 0x3a, 0xf4, 0xfd,
+    0x97, 0xfb, 0x67, 0xaf, 0x72, 0x04, 0xae, 0x37, 0xf5, 0xa2, 0x59, 0x23, 0x0a, 0x6f, 0x3e, 0x57,
+    0xdc, 0x97, 0xfb, 0x49, 0xe1, 0x86, 0xf9, 0x8e, 0x5b, 0xc3, 0xd2, 0x94, 0xfd, 0xde, 0x99, 0x7a,
+    0x71, 0xd2, 0x18, 0x4e, 0x82, 0xe9, 0x28, 0xb5, 0x09, 0x44, 0x6b, 0x6c, 0x67, 0x2f, 0x53, 0xa5,
+    0xac, 0xab, 0x57, 0x31, 0xfc, 0x64, 0xe5, 0x26, 0xd4, 0xa1, 0x86, 0xa6, 0x12, 0xc4, 0xd3, 0x31,
+    0x8a, 0x69, 0xce, 0xa6, 0x72, 0x12, 0x35, 0x27, 0xf2, 0x51, 0xc2, 0x6b, 0xfa, 0x51, 0x14, 0x46,
+    0x05, 0x3b, 0xfb, 0xf9, 0x61, 0x05, 0xec, 0xbd, 0x5d, 0x04, 0x36, 0x6d, 0x61, 0x05, 0x69, 0xa3,
+    0x28, 0x7c, 0xf3, 0xac, 0xf8, 0x75, 0xe4, 0x6f, 0x06, 0x30, 0x0b, 0xb6, 0xb1, 0x89, 0x0e, 0x90,
+    0xbb, 0x66, 0x85, 0x59, 0x7c, 0xa9, 0xfa, 0xa1, 0x4b, 0xa8, 0xa9, 0xaa, 0x8a, 0xa6, 0x81, 0x42,
+    0xa7, 0x50, 0x39, 0x2d, 0xaf, 0x24, 0xaf, 0x51, 0x60, 0xeb, 0xae, 0x62, 0xb9, 0x22, 0x90, 0x4f,
+    0xf6, 0x73, 0x9d, 0x3d, 0x1d, 0xbb, 0x1f, 0xae, 0x44, 0xec, 0xd5, 0x43, 0x38, 0x45, 0xd7, 0xd0,
+    0x22, 0x94, 0x8e, 0x17, 0x13, 0xd8, 0x4a, 0xbf, 0xad, 0x0a, 0x69, 0x35, 0xd5, 0x94, 0x71, 0xdb,
+    0xaa, 0x10, 0x0b, 0xc9, 0xc5, 0x06, 0xcc, 0x20, 0xa3, 0xe1, 0x95, 0xe6, 0x91, 0x93, 0x73, 0xd3,
+    0x2d, 0xb3, 0x57, 0x4e, 0x13, 0x93, 0x7e, 0xb3, 0xcd, 0xf2, 0xac, 0x48, 0x58, 0x73, 0x33, 0xa0,
+    0x68, 0x77, 0xfd, 0xd3, 0x37, 0xcb, 0x39, 0x2a, 0x57, 0x26, 0x1e, 0xac, 0x0c, 0x64, 0xb5, 0x4a,
+    0xaa, 0xb7, 0xc7, 0xe7, 0x28, 0xa3, 0xad, 0x92, 0xea, 0x3a, 0x88, 0x51, 0x38, 0x2f, 0xbc, 0xb9,
+    0xe2, 0x37, 0x58, 0x9d, 0xa7, 0xb2, 0x96, 0x57, 0xca, 0xed, 0x64, 0x37, 0x3b, 0xcb, 0x84, 0x10,
+    0xf2, 0xbe, 0xad, 0x11, 0x1f, 0x63, 0x09, 0x78, 0x2c, 0x0a, 0xbc, 0xe3, 0x0d, 0x64, 0xb7, 0xcc,
+    0xdc, 0x12, 0xe1, 0x7f, 0xc5, 0xcd, 0x30, 0x9f, 0x50, 0x39, 0x46, 0xc7, 0xbb, 0x21, 0x7d, 0x97,
+    0xa6, 0xb2, 0xc0, 0xa2, 0xca, 0xa9, 0x90, 0xcb, 0xdd, 0x7a, 0xcc, 0xb5, 0xd1, 0xe9, 0xf7, 0x9b,
+    0x08, 0x41, 0xe0, 0xa7, 0x4a, 0x24, 0x5b, 0xb0, 0x2c, 0x2e, 0x67, 0xd8, 0x64, 0xaa, 0xab, 0x5d,
+    0x66, 0x9c, 0xfb, 0x2a, 0x31, 0xa8, 0x41, 0xad, 0xc5, 0x33, 0x29, 0x9c, 0x85, 0x0f, 0x0d, 0xd8,
+    0xec, 0xf0, 0x24, 0x8b, 0xd5, 0xa1, 0xac, 0xb2, 0xe3, 0x6b, 0xc4, 0x71, 0x6a, 0x36, 0xbe, 0xe6,
+    0xbe, 0x78, 0x40, 0x64, 0xa7, 0xd2, 0x85, 0xf5, 0xa3, 0x37, 0xdb, 0xae, 0x9d, 0x92, 0xad, 0xce,
+    0xa5, 0x6c, 0x0f, 0x5a, 0xae, 0xad, 0x07, 0x52, 0xea, 0x58, 0x24, 0x8b, 0xa2, 0xb1, 0x0c, 0x68,
+    0x2e, 0x31, 0x35, 0xcf, 0x32, 0x26, 0x3b, 0x90, 0xc7, 0xcb, 0xa3, 0xc3, 0x74, 0xdb, 0x76, 0x0a,
+    0xd2, 0x0a, 0x5d, 0x98, 0x9f, 0xe6, 0xa4, 0x55, 0x3d, 0x44, 0x08, 0x91, 0xa5, 0x46, 0x94, 0xcd,
+    0xae, 0xc8, 0x57, 0x9a, 0x3b, 0x3a, 0x5c, 0x25, 0x6e, 0x5c, 0xdb, 0x94, 0x6c, 0xe5, 0xef, 0x4a,
+    0x96, 0x22, 0x66, 0x0b, 0x27, 0x6f, 0xc7, 0x6a, 0xc3, 0x4d, 0x96, 0x38, 0x67, 0x51, 0x1a, 0x51,
+    0x5f, 0xb1, 0x6e, 0x77, 0x62, 0x2d, 0x3a, 0xbf, 0x85, 0x6e, 0x9e, 0x22, 0x5f, 0x23, 0x42, 0x60,
+    0x62, 0xbe, 0x58, 0xa3, 0x2c, 0xd4, 0x0b, 0x10, 0x48, 0x94, 0xbf, 0xc3, 0x5c, 0xa8, 0xa5, 0xd0,
+    0x81, 0x8f, 0xc7, 0xc5, 0x72, 0x4b, 0x99, 0x75, 0xcb, 0x42, 0xdd, 0xfe, 0x04, 0x75, 0xd1, 0xe6,
+    0xfa, 0x53, 0xe2, 0x10, 0x86, 0x57, 0x84, 0x4e, 0x5f, 0xca, 0xe4, 0xf0, 0x19, 0x9b, 0xd2, 0xcf,
+    0x4d, 0x7b, 0x1c, 0xb4, 0x37, 0x5b, 0x28, 0x91, 0x27, 0x8e, 0xb6, 0x43, 0xe9, 0xac, 0x22, 0x41,
+    0xf7, 0x13, 0x48, 0x30, 0x6d, 0x1f, 0x28, 0x71, 0xc5, 0x7c, 0xea, 0x1b, 0x3d, 0x5f, 0x8f, 0x86,
+    0x6e, 0xcf, 0xed, 0x65, 0xed, 0x0e, 0xca, 0x89, 0x2d, 0x93, 0xae, 0x37, 0x55, 0x86, 0xfe, 0x8c,
+    0x06, 0x7d, 0x6f, 0xd0, 0x76, 0xfa, 0x85, 0x0d, 0x9a, 0x44, 0xaa, 0xb7, 0xb9, 0x7a, 0xd5, 0x18,
+    0x2d, 0xba, 0xee, 0xb0, 0xdb, 0xf5, 0x0b, 0x5b, 0xcc, 0x6e, 0xa0, 0xcb, 0x06, 0x57, 0x13, 0xb8,
+    0x20, 0xba, 0xe3, 0xcd, 0xd7, 0xe4, 0x94, 0x2a, 0x54, 0x82, 0xe4, 0x82, 0x50, 0x68, 0x58, 0x45,
+    0x1b, 0x83, 0x2b, 0xa5, 0xa4, 0x2e, 0x1f, 0x65, 0x2f, 0x01, 0xba, 0x4d, 0x47, 0x2a, 0x94, 0x7d,
+    0x25, 0x54, 0x18, 0x06, 0xe0, 0x01, 0x02, 0xb1, 0x9c, 0xd6, 0x03, 0xbd, 0xa6, 0x0e, 0x12, 0xab,
+    0xb6, 0x53, 0xac, 0xec, 0xa4, 0x10, 0x06, 0xc1, 0xa7, 0xae, 0xe1, 0x14, 0xd6, 0xba, 0x82, 0x83,
+    0x5a, 0xc9, 0x85, 0xcb, 0x91, 0x01, 0x2d, 0x4b, 0xab, 0x25, 0x1d, 0xf9, 0x29, 0xd0, 0x72, 0x8b,
+    0xae, 0xac, 0x1b, 0x41, 0xc0, 0x2d, 0xc9, 0xc8, 0x83, 0x70, 0x6d, 0x3e, 0xae, 0xee, 0xa9, 0xb4,
+    0x4b, 0xa9, 0xc7, 0x62, 0x45, 0x9d, 0x46, 0x21, 0x60, 0x21, 0x4e, 0xd5, 0x91, 0x85, 0x78, 0x70,
+    0x67, 0x44, 0x1c, 0xad, 0x97, 0x08, 0x9e, 0xf1, 0x94, 0xcb, 0x88, 0x04, 0x0e, 0x9f, 0x7b, 0xc2,
+    0x75, 0x1f, 0xf8, 0x4a, 0x42, 0x10, 0x7e, 0xef, 0x4e, 0xac, 0x0e, 0xe2, 0x07, 0x6f, 0x79, 0xe9,
+    0x93, 0xf3, 0xb7, 0x3f, 0xa4, 0xfb, 0xde, 0xf8, 0x84, 0x92, 0xb7, 0x17, 0xcc, 0xa9, 0xe1, 0x67,
+    0x5b, 0x96, 0xf7, 0x6a, 0xe1, 0x87, 0x2a, 0xb9, 0x14, 0xe9, 0xbd, 0x12, 0x48, 0x2f, 0x58, 0xef,
+    0x4a, 0xec, 0x85, 0x37, 0xf3, 0x23, 0x8f, 0xf0, 0x6d, 0xae, 0x34, 0x00, 0x02, 0x9f, 0xca, 0xcd,
+    0xaf, 0xb5, 0x3d, 0x9f, 0x39, 0xd1, 0x53, 0x6e, 0xf9, 0x9d, 0xeb, 0x35, 0x42, 0xf6, 0xb4, 0xbe,
+    0x5a, 0x72, 0xa7, 0xd3, 0x55, 0x67, 0xb5, 0xa9, 0x5f, 0xbc, 0x46, 0xe7, 0x6f, 0xf5, 0x1c, 0x58,
+    0x20, 0xf0, 0xbe, 0xb8, 0x66, 0xb7, 0xae, 0x11, 0x85, 0x0d, 0xa4, 0xc7, 0x85, 0x3c, 0x79, 0x46,
+    0xf7, 0x61, 0x8b, 0xee, 0xd0, 0x82, 0x62, 0x6e, 0xcd, 0xe8, 0xe4, 0x12, 0x96, 0xa9, 0xea, 0x9a,
+    0x33, 0xda, 0xe9, 0x16, 0x86, 0x8e, 0xd2, 0x86, 0xa9, 0x2f, 0xa6, 0xce, 0x7f, 0xb0, 0x90, 0xdb,
+    0xa2, 0xf8, 0x67, 0x29, 0x85, 0xfa, 0x66, 0x38, 0xdc, 0xdf, 0xde, 0xd1, 0x63, 0xc6, 0x41, 0x17,
+    0xed, 0x33, 0xac, 0x15, 0xef, 0xac, 0x47, 0xd0, 0x98, 0x0e, 0x9c, 0x14, 0x8d, 0x3b, 0xe3, 0x70,
+    0xb8, 0x8c, 0x75, 0x64, 0xb2, 0x67, 0xe8, 0xdd, 0x5e, 0x26, 0xb8, 0x6f, 0xa4, 0xa7, 0xca, 0x34,
+    0x6c, 0xb9, 0x7b, 0x26, 0xdf, 0x66, 0xbb, 0x43, 0x79, 0x71, 0xcf, 0xea, 0xc4, 0x89, 0xf8, 0xf5,
+    0x42, 0x4d, 0xc3, 0xd8, 0x8b, 0x04, 0xe2, 0x19, 0x07, 0x97, 0x6b, 0x2d, 0xd9, 0x35, 0xd3, 0xb3,
+    0xd8, 0x0e, 0xc6, 0xdf, 0xd2, 0x29, 0x68, 0xb1, 0xf6, 0xd7, 0x9f, 0x67, 0x0d, 0x5f, 0x0f, 0x88,
+    0x99, 0xd2, 0xea, 0x5b, 0x0f, 0x4c, 0xe8, 0x99, 0x07, 0x26, 0xb4, 0xb3, 0x51, 0x15, 0xbc, 0x3a,
+    0x3d, 0xc0, 0xec, 0x73, 0x1e, 0x8c, 0x90, 0x09, 0x7a, 0xc8, 0x61, 0x7e, 0xaf, 0xfe, 0xf1, 0xe2,
+    0x82, 0x1c, 0xbc, 0x3e, 0x79, 0x71, 0xfc, 0x03, 0x39, 0xdd, 0x3f, 0x39, 0x7a, 0x69, 0xe7, 0x7e,
+    0x78, 0xb2, 0x57, 0x19, 0xcf, 0xe2, 0x17, 0x0f, 0x8b, 0x53, 0x1d, 0x49, 0x36, 0x3f, 0x9d, 0x3a,
+    0xc3, 0x4a, 0xa7, 0xcd, 0xad, 0xcb, 0x0c, 0x07, 0x57, 0x93, 0xf9, 0x68, 0x3d, 0x1e, 0x70, 0xab,
+    0x6e, 0xed, 0x7f, 0xee, 0x03, 0x1f, 0xca, 0x2e, 0x9b, 0x75, 0xd7, 0x43, 0xab, 0x67, 0x43, 0x04,
+    0x1f, 0x90, 0x48, 0x5a, 0x58, 0x4f, 0x10, 0x95, 0xb3, 0x03, 0x68, 0x3b, 0x3c, 0xd2, 0x5b, 0xdb,
+    0x4f, 0xc8, 0xcd, 0xbf, 0xd7, 0x93, 0xf2, 0x7a, 0xa5, 0x4f, 0x20, 0xb0, 0x64, 0xe6, 0x5b, 0x73,
+    0x6f, 0xca, 0xe1, 0x2f, 0x47, 0x45, 0xc9, 0xdb, 0x58, 0xfa, 0xb2, 0x1b, 0x08, 0x26, 0x12, 0x8b,
+    0x03, 0x69, 0xf1, 0x24, 0xb0, 0xbc, 0x9a, 0x4a, 0xc2, 0xc1, 0x6a, 0x67, 0xd0, 0xd7, 0xe3, 0xf1,
+    0x38, 0x3f, 0x36, 0xe0, 0x74, 0xff, 0xec, 0xf7, 0x2f, 0x8f, 0x4f, 0x8e, 0x48, 0x75, 0x16, 0xcc,
+    0x03, 0x7a, 0x06, 0x63, 0x92, 0xa3, 0x28, 0x61, 0xc8, 0xc4, 0x15, 0x0d, 0xbe, 0x53, 0xb4, 0x61,
+    0x9d, 0x0e, 0x64, 0xf2, 0xb9, 0x11, 0x96, 0xd2, 0x71, 0x6c, 0x69, 0xbf, 0x7a, 0x04, 0x49, 0x5e,
+    0x4c, 0xcc, 0xbd, 0xd9, 0xba, 0x7e, 0xe8, 0x04, 0x55, 0xf6, 0x75, 0xd5, 0x3f, 0x2f, 0x18, 0xe0,
+    0xe4, 0xf8, 0xd5, 0x3e, 0x46, 0x42, 0xd8, 0x03, 0x02, 0xfe, 0xe1, 0xca, 0xbf, 0x1d, 0x47, 0xc0,
+    0xed, 0x63, 0x65, 0x9b, 0xf8, 0x8e, 0x38, 0xdf, 0xd4, 0x29, 0x58, 0xf3, 0x44, 0x0a, 0x74, 0x08,
+    0x65, 0xf7, 0xc2, 0x79, 0x6f, 0x15, 0x58, 0xcc, 0x81, 0xbb, 0x0e, 0x1c, 0xd7, 0x0a, 0x47, 0x4d,
+    0xa5, 0x03, 0x92, 0x89, 0xc2, 0x99, 0x56, 0x6b, 0x37, 0xef, 0x8c, 0x90, 0x0e, 0x66, 0x26, 0x02,
+    0xc0, 0x24, 0x34, 0x5a, 0xb6, 0x97, 0x77, 0x6a, 0xd6, 0xd6, 0xc7, 0xde, 0xc8, 0x5f, 0xb3, 0xe5,
+    0xfe, 0x67, 0x69, 0xf8, 0x92, 0x59, 0xcf, 0x0a, 0xf6, 0x4c, 0xad, 0xab, 0x93, 0xf5, 0xda, 0x72,
+    0x9c, 0x66, 0x7c, 0x48, 0xae, 0xa5, 0xa8, 0xcc, 0x5e, 0xf0, 0xc0, 0x72, 0xa3, 0xbc, 0x5e, 0x4f,
+    0x5f, 0x11, 0x23, 0xc7, 0x88, 0xec, 0x34, 0x7b, 0x31, 0x8f, 0xc6, 0x5e, 0xbf, 0x3d, 0x3a, 0x7b,
+    0xb9, 0xff, 0x93, 0x7d, 0x01, 0x21, 0x7d, 0xd3, 0x5d, 0x9b, 0xcc, 0x79, 0x5a, 0x24, 0x98, 0xc7,
+    0x3e, 0x8b, 0x71, 0x52, 0xf3, 0xdd, 0x8d, 0x6c, 0x6f, 0x59, 0x3f, 0xe7, 0x54, 0x2e, 0x05, 0x4a,
+    0x26, 0xbe, 0xa3, 0x20, 0xcf, 0x73, 0x7b, 0x7b, 0xd7, 0x96, 0xc8, 0x99, 0x33, 0xc2, 0xb3, 0xa3,
+    0xf3, 0x53, 0x58, 0x42, 0xc7, 0x6f, 0xed, 0xa1, 0x44, 0xff, 0x30, 0xf3, 0x47, 0x81, 0x07, 0xdc,
+    0xc4, 0xfb, 0x28, 0x4f, 0x3b, 0x71, 0x70, 0x73, 0xb1, 0x26, 0xbb, 0x9d, 0x86, 0x92, 0x97, 0x8c,
+    0xb7, 0xbe, 0x57, 0xf8, 0x80, 0x05, 0xfe, 0x56, 0xaf, 0xaf, 0x81, 0x97, 0x67, 0xad, 0x59, 0x29,
+    0xed, 0x9f, 0xaa, 0x0d, 0x24, 0x24, 0x09, 0x36, 0xad, 0x20, 0x12, 0x4f, 0xed, 0xb5, 0x1c, 0xb5,
+    0x86, 0x3e, 0x21, 0xcd, 0x78, 0xa2, 0x3b, 0xc9, 0xb4, 0x8c, 0x55, 0x79, 0xc8, 0x84, 0x2e, 0x2c,
+    0x9d, 0x2c, 0xb8, 0x34, 0x9b, 0xdf, 0xd4, 0x48, 0xee, 0x3f, 0x0d, 0x75, 0x6a, 0x60, 0x7d, 0x4e,
+    0x45, 0x28, 0x6e, 0x96, 0x76, 0xcb, 0x96, 0x4e, 0x37, 0x45, 0xf5, 0x24, 0x87, 0xb4, 0x84, 0x8c,
+    0x6a, 0x56, 0x8e, 0x82, 0x30, 0x8a, 0x64, 0x36, 0x58, 0x1f, 0xe0, 0x21, 0xcc, 0x25, 0x91, 0x4e,
+    0xdf, 0x59, 0x8b, 0x02, 0xf5, 0xf1, 0x69, 0x27, 0x36, 0xa8, 0xc9, 0x91, 0x20, 0x93, 0xe6, 0x75,
+    0x7b, 0x29, 0x3d, 0x07, 0xcb, 0x58, 0x5f, 0x4a, 0x77, 0x9f, 0x6e, 0xf2, 0x13, 0x74, 0x9f, 0x6e,
+    0xb2, 0xd3, 0x90, 0x9f, 0xe2, 0x69, 0x94, 0xf4, 0x68, 0xdd, 0x51, 0x70, 0x4d, 0x86, 0x53, 0x2f,
+    0x8e, 0xf7, 0x36, 0xbc, 0xc5, 0x62, 0x83, 0x1d, 0xb2, 0xfb, 0xf4, 0xab, 0x46, 0x83, 0xbc, 0xa2,
+    0xf4, 0x42, 0x5e, 0x73, 0x7e, 0xd0, 0x68, 0xf0, 0x77, 0x4a, 0x0d, 0x9d, 0x42, 0x37, 0x48, 0x30,
+    0xca, 0x3e, 0x0b, 0xe7, 0xc3, 0x69, 0x30, 0xbc, 0xda, 0xdb, 0x18, 0x4e, 0xc3, 0xd8, 0x67, 0x40,
+    0xf9, 0xc1, 0x85, 0xd5, 0x1a, 0x9e, 0xf3, 0x0b, 0xf0, 0x9e, 0x3d, 0x4a, 0x9b, 0x15, 0x87, 0x1a,
+    0xda, 0xda, 0xe3, 0x6b, 0x88, 0x35, 0x24, 0x7e, 0x3c, 0xe3, 0xb8, 0xb1, 0x14, 0x64, 0xc7, 0xc6,
+    0xc9, 0x12, 0x78, 0x92, 0x30, 0x88, 0x75, 0x76, 0xa0, 0xf3, 0x86, 0xdb, 0xdf, 0xe0, 0x22, 0x9d,
+    0x7d, 0xc7, 0xa3, 0x9f, 0x9f, 0x87, 0x1f, 0xf7, 0x36, 0x1c, 0x7a, 0x84, 0x08, 0xfc, 0x7f, 0x03,
+    0x95, 0xa6, 0xe9, 0xde, 0x06, 0xa2, 0x73, 0x83, 0xc4, 0x49, 0x14, 0x5e, 0xf9, 0x30, 0x0e, 0x85,
+    0xb7, 0x8b, 0xa7, 0x0d, 0x01, 0x53, 0x69, 0x0b, 0x5a, 0x5b, 0x78, 0xc9, 0x84, 0x40, 0x57, 0x5f,
+    0x75, 0x40, 0x2c, 0x1c, 0xe0, 0x07, 0xe9, 0x91, 0x3e, 0xfe, 0xe9, 0x1f, 0xb4, 0xfa, 0xf0, 0xcd,
+    0x45, 0x79, 0xc1, 0x3e, 0x37, 0x36, 0xed, 0x55, 0x7b, 0x58, 0xb5, 0x47, 0xeb, 0x00, 0x93, 0xc3,
+    0xbf, 0x2d, 0xe7, 0xa0, 0xd5, 0xa3, 0xdf, 0x29, 0x28, 0xfa, 0x69, 0xd4, 0x1e, 0x06, 0xd1, 0x10,
+    0xe6, 0x6e, 0x08, 0xa3, 0x81, 0x77, 0x64, 0x78, 0x0b, 0x7f, 0x61, 0x38, 0xd1, 0xde, 0x46, 0x5b,
+    0x0c, 0x4a, 0x1b, 0x46, 0x4e, 0xdb, 0x08, 0x7d, 0xeb, 0xad, 0xdb, 0x7a, 0xb5, 0x4d, 0x5a, 0xdb,
+    0x2f, 0xb1, 0xa7, 0xee, 0xcb, 0x56, 0x17, 0xbe, 0xab, 0x15, 0x80, 0xb8, 0xae, 0x2f, 0x95, 0x9f,
+    0x79, 0xd3, 0x40, 0xcd, 0x02, 0x1d, 0x3f, 0xb9, 0x45, 0xd1, 0x1e, 0xde, 0x50, 0x0e, 0xd2, 0xe6,
+    0x54, 0x52, 0xa6, 0x6a, 0xbc, 0x1c, 0x68, 0xf4, 0xd1, 0x10, 0xa7, 0xf8, 0x00, 0x1d, 0xfc, 0xf5,
+    0xcf, 0x7f, 0x31, 0x20, 0x69, 0x3f, 0xf5, 0x1f, 0x96, 0x16, 0xe6, 0xde, 0x35, 0x83, 0x8d, 0x5f,
+    0x9e, 0xad, 0x2c, 0xce, 0x4e, 0xd3, 0xda, 0xb0, 0xe3, 0x46, 0x39, 0x5c, 0x28, 0x17, 0x29, 0x99,
+    0xc3, 0xa9, 0x36, 0x9e, 0x1d, 0xd2, 0x47, 0x85, 0xf8, 0xc8, 0x9c, 0x22, 0xc5, 0xfa, 0xcc, 0x7a,
+    0x53, 0x8c, 0x8e, 0x7c, 0x40, 0xcc, 0xfe, 0xd3, 0x7a, 0x9a, 0x5f, 0x18, 0x94, 0x5a, 0xbd, 0x4d,
+    0xf8, 0xfd, 0x2c, 0xd3, 0x14, 0x2e, 0x47, 0xe0, 0x6d, 0x6a, 0x41, 0xde, 0x0a, 0xa1, 0xec, 0x0a,
+    0x68, 0x94, 0x1a, 0x17, 0x19, 0xf7, 0x05, 0xef, 0x39, 0x56, 0xd6, 0xba, 0x5e, 0x6e, 0x6a, 0x33,
+    0x1c, 0x87, 0x1e, 0xd5, 0x64, 0x65, 0x6f, 0xf0, 0x22, 0x65, 0x2f, 0x5c, 0xbc, 0xf0, 0x77, 0xec,
+    0x57, 0xce, 0xdc, 0x2a, 0x67, 0x02, 0xe9, 0x73, 0x3b, 0x58, 0x82, 0x8d, 0x3d, 0x37, 0xd8, 0xa7,
+    0x90, 0xc8, 0x0a, 0xaf, 0x44, 0x25, 0x21, 0xc3, 0x2a, 0x0d, 0xd4, 0x29, 0x9c, 0xcc, 0x55, 0x38,
+    0x99, 0xfb, 0xd9, 0x38, 0xd9, 0x53, 0x7a, 0xd8, 0xd5, 0xc7, 0x16, 0x65, 0x1a, 0xb7, 0xf0, 0xa7,
+    0xb7, 0x41, 0x3e, 0xba, 0xf0, 0xaa, 0x05, 0x3f, 0x5d, 0xfc, 0xb9, 0x99, 0x2d, 0x83, 0xec, 0x46,
+    0x2d, 0x44, 0x59, 0x53, 0xb6, 0x54, 0xdf, 0x28, 0xd5, 0xc7, 0x52, 0x3a, 0x23, 0xc1, 0x99, 0x62,
+    0xf8, 0xd2, 0x9e, 0x4d, 0x5a, 0x06, 0x96, 0xa9, 0x4f, 0x86, 0x91, 0x1b, 0x55, 0xaf, 0xd9, 0xef,
+    0x67, 0x3f, 0x86, 0x33, 0x58, 0x26, 0x93, 0x56, 0x3e, 0x71, 0x2b, 0x07, 0x08, 0x99, 0xc8, 0xd5,
+    0xe7, 0x49, 0x9c, 0x60, 0xa3, 0x4c, 0x50, 0x12, 0x5e, 0x5e, 0x4e, 0xfd, 0x43, 0x78, 0x71, 0xc8,
+    0x4d, 0xa6, 0xcc, 0x0c, 0x59, 0x9a, 0xc3, 0x93, 0x28, 0x58, 0x4f, 0xd3, 0x9f, 0xb6, 0x75, 0xa1,
+    0xae, 0x0c, 0x5a, 0x92, 0xf1, 0x43, 0x2b, 0xd5, 0x9b, 0xc4, 0x80, 0x7c, 0x5e, 0x10, 0x03, 0x7e,
+    0xff, 0x5c, 0xc4, 0xb0, 0x08, 0xa7, 0xb7, 0x74, 0x1a, 0xa9, 0xdf, 0x02, 0x46, 0xd4, 0x23, 0xdb,
+    0x54, 0xfc, 0x74, 0x51, 0x02, 0x6d, 0xdb, 0xe6, 0xcf, 0x3e, 0x83, 0x16, 0xbc, 0x08, 0xb3, 0x53,
+    0xc1, 0x8d, 0x7c, 0x94, 0xc5, 0x4f, 0xd1, 0x3a, 0xb7, 0xae, 0x43, 0xaa, 0x2d, 0xe5, 0x32, 0xd9,
+    0x54, 0xd5, 0x62, 0xcd, 0x2b, 0xbf, 0xf3, 0xbb, 0x2d, 0x4e, 0x21, 0xc8, 0x67, 0x6b, 0xa5, 0x78,
+    0x94, 0x21, 0x37, 0xd2, 0x2c, 0x7d, 0x2e, 0xc2, 0x94, 0x07, 0xbf, 0x45, 0x5f, 0x74, 0xb2, 0x97,
+    0xc9, 0xd8, 0x7c, 0x71, 0xa5, 0x3f, 0x8d, 0x65, 0x70, 0x4e, 0x4f, 0x64, 0x2f, 0x64, 0x51, 0xad,
+    0x9e, 0x42, 0x95, 0xbd, 0xcf, 0x48, 0x95, 0x52, 0x55, 0xe9, 0x37, 0xdb, 0x3d, 0xd2, 0x6b, 0xf6,
+    0x3a, 0xde, 0x36, 0x10, 0x26, 0x28, 0x47, 0xa4, 0xd5, 0x68, 0xb9, 0xcd, 0xad, 0x36, 0x71, 0x34,
+    0x0e, 0x84, 0x0c, 0x0a, 0x59, 0x10, 0xe7, 0x53, 0xf4, 0xa7, 0xe4, 0x53, 0xa5, 0x38, 0x90, 0x82,
+    0x7a, 0x55, 0x01, 0x67, 0x58, 0xd2, 0x9e, 0xac, 0x56, 0x38, 0x18, 0x85, 0x72, 0x69, 0x94, 0x99,
+    0x56, 0x34, 0x52, 0x24, 0x51, 0xd2, 0x1f, 0xcf, 0xb2, 0x82, 0x4c, 0x95, 0x68, 0x4f, 0xd3, 0x4b,
+    0x33, 0xc0, 0xa8, 0xde, 0xd4, 0x8c, 0x67, 0xf3, 0x3f, 0x51, 0xe6, 0xf0, 0xe8, 0xed, 0xf1, 0xc1,
+    0x11, 0x39, 0x3e, 0x3c, 0x3a, 0xb9, 0x38, 0xbe, 0xf8, 0xa9, 0x74, 0x55, 0xe8, 0x52, 0x9c, 0x90,
+    0x65, 0x34, 0x3d, 0xf5, 0x22, 0x6f, 0x16, 0x93, 0x3d, 0x32, 0xf7, 0x6f, 0xc8, 0x9b, 0xb3, 0x97,
+    0xe7, 0xbe, 0x17, 0x0d, 0x27, 0xec, 0x69, 0xf5, 0x06, 0xec, 0xff, 0xf0, 0xa6, 0x09, 0xb6, 0xaa,
+    0xc7, 0xcf, 0xf1, 0xc1, 0x97, 0xdc, 0x3f, 0xc0, 0x40, 0xb0, 0x0e, 0xfc, 0x8c, 0x39, 0xe1, 0x29,
+    0xb8, 0xe6, 0xa5, 0x9f, 0x54, 0x2b, 0x4c, 0xa9, 0xa8, 0xd4, 0xc8, 0x9f, 0xfe, 0x64, 0xbe, 0x0a,
+    0x46, 0xec, 0x71, 0xe5, 0xfc, 0xf8, 0x87, 0x93, 0xfd, 0x97, 0x17, 0xfb, 0xa7, 0x8d, 0xc3, 0xa3,
+    0x57, 0xaf, 0x2b, 0x2a, 0x64, 0xdc, 0x9e, 0xf8, 0xf9, 0xe2, 0xf5, 0xe9, 0xf1, 0xc1, 0xcf, 0xa7,
+    0x67, 0x47, 0x2f, 0x8e, 0xff, 0x09, 0x5a, 0xf8, 0x10, 0x53, 0xad, 0x32, 0xf1, 0x16, 0x9b, 0x8f,
+    0xef, 0x64, 0xd3, 0xf7, 0x1f, 0x76, 0x1f, 0xad, 0x83, 0xb4, 0xf3, 0x8b, 0xfd, 0x8b, 0xa3, 0xd2,
+    0x15, 0xa6, 0x7e, 0x22, 0x5c, 0x42, 0xa7, 0x20, 0xa2, 0xa0, 0x17, 0x95, 0x09, 0x88, 0x27, 0xde,
+    0x57, 0x7c, 0x2b, 0x8e, 0x37, 0x42, 0x89, 0x82, 0xaf, 0x87, 0xf3, 0xa1, 0xfa, 0x96, 0x2e, 0xb0,
+    0x33, 0x7e, 0xe6, 0xc3, 0x1e, 0x49, 0xa2, 0xa5, 0x9f, 0xbe, 0x1d, 0x29, 0x52, 0xe8, 0x35, 0x7a,
+    0x17, 0xf6, 0xc8, 0xd8, 0x9b, 0xc6, 0x4a, 0x09, 0x74, 0xed, 0x1e, 0x4c, 0x31, 0x3b, 0x0d, 0x67,
+    0x69, 0x39, 0x9d, 0x1a, 0xaf, 0xe4, 0xe9, 0x2a, 0x99, 0x9a, 0xcb, 0xd8, 0xc7, 0xfb, 0x6b, 0x0e,
+    0xbd, 0xc4, 0xcb, 0xbe, 0x64, 0xb3, 0x73, 0x1e, 0x0e, 0xaf, 0xfc, 0x2c, 0x60, 0xf6, 0xd2, 0x02,
+    0x5a, 0xa2, 0x10, 0xcc, 0x6a, 0x2f, 0x0a, 0x42, 0xe2, 0xcf, 0x2f, 0x71, 0x71, 0x22, 0xb3, 0xf3,
+    0xd1, 0x43, 0x8c, 0x21, 0xab, 0x31, 0x39, 0x3a, 0x3f, 0x6d, 0xbb, 0x84, 0x1f, 0x52, 0x03, 0x94,
+    0xf3, 0x33, 0x2b, 0x56, 0x53, 0xa6, 0xf7, 0xfc, 0xe0, 0xe8, 0x64, 0xff, 0xec, 0xf8, 0xf5, 0xcf,
+    0x74, 0x36, 0xce, 0xa1, 0x89, 0x77, 0x95, 0x93, 0x30, 0x9a, 0x79, 0xd3, 0x4a, 0x9d, 0x54, 0x0e,
+    0x7d, 0x9a, 0x92, 0x37, 0xbf, 0xc4, 0x1f, 0x7f, 0x60, 0x39, 0x13, 0xf8, 0xf5, 0xc5, 0xfe, 0x9b,
+    0x97, 0x17, 0xf8, 0xe5, 0xcc, 0x1f, 0xa2, 0x95, 0x8a, 0x8f, 0xdf, 0xef, 0xda, 0xc0, 0x1e, 0xbe,
+    0x39, 0x13, 0xae, 0x5c, 0xf2, 0xae, 0x83, 0xf7, 0x67, 0x38, 0x75, 0x90, 0x77, 0x78, 0x27, 0x08,
+    0x3a, 0x0a, 0xdf, 0xef, 0xe2, 0x30, 0xd8, 0x3e, 0x47, 0x4c, 0x16, 0xa0, 0x1b, 0xd2, 0x21, 0x28,
+    0x90, 0x62, 0x3e, 0xc4, 0x73, 0x3a, 0xb4, 0x3d, 0x8c, 0x2c, 0x98, 0x0f, 0x77, 0x30, 0xe1, 0x11,
+    0x13, 0xaa, 0xa6, 0xe8, 0x8e, 0xc7, 0xef, 0xe1, 0x6c, 0x81, 0x21, 0x26, 0x21, 0xff, 0xb9, 0x8c,
+    0x59, 0xfe, 0x21, 0xb9, 0xdf, 0xb5, 0xc0, 0xba, 0x00, 0x06, 0x13, 0xc5, 0x9f, 0x08, 0x6c, 0x74,
+    0x0b, 0x1a, 0x45, 0x30, 0xdc, 0xc7, 0x1c, 0x10, 0x05, 0xd6, 0xbb, 0xf7, 0x0a, 0x30, 0xfa, 0x43,
+    0x81, 0x46, 0x7f, 0x73, 0x70, 0xef, 0xde, 0x23, 0x3c, 0x31, 0x93, 0x74, 0x17, 0x90, 0x6d, 0x45,
+    0x2e, 0x23, 0x3a, 0x59, 0xa4, 0x0a, 0x84, 0x03, 0xba, 0x32, 0xe8, 0x30, 0xc3, 0x09, 0xcd, 0x57,
+    0x04, 0x15, 0x3b, 0x16, 0x21, 0x12, 0x26, 0xf1, 0xe1, 0x8e, 0xf3, 0x5e, 0xba, 0x33, 0x88, 0x3c,
+    0x1e, 0xda, 0x43, 0x96, 0x31, 0x3d, 0x07, 0xe5, 0x0c, 0x56, 0x0c, 0x2e, 0xf9, 0x63, 0x94, 0x31,
+    0x15, 0xac, 0xf2, 0x33, 0x2b, 0xc2, 0xd7, 0xff, 0x0d, 0xde, 0x27, 0xc4, 0x9e, 0x34, 0x27, 0x40,
+    0xab, 0xb3, 0x5f, 0xf0, 0x5e, 0xa1, 0x9d, 0xbe, 0xe3, 0x38, 0xf4, 0x4a, 0xa1, 0x8a, 0x70, 0x9e,
+    0x60, 0x97, 0x50, 0x91, 0x2a, 0x04, 0x8d, 0x85, 0x38, 0x60, 0x59, 0x71, 0x01, 0xfc, 0xf8, 0x26,
+    0xc4, 0x1b, 0x7b, 0x0a, 0x2a, 0x62, 0x21, 0xbd, 0xa2, 0x82, 0xa1, 0x73, 0xb1, 0xaf, 0x40, 0x26,
+    0x01, 0x60, 0x30, 0xba, 0x55, 0x27, 0x56, 0xbc, 0xfb, 0x91, 0xbd, 0x42, 0x54, 0xdc, 0xaf, 0xc7,
+    0x8d, 0x90, 0xf1, 0xf1, 0x6d, 0x58, 0x41, 0xb2, 0x6b, 0xb2, 0x71, 0x84, 0x70, 0xae, 0x4c, 0x02,
+    0x25, 0x87, 0x3b, 0x29, 0xb5, 0x18, 0xda, 0x2a, 0x07, 0x27, 0x07, 0x60, 0x2d, 0x01, 0x85, 0xc0,
+    0x40, 0xce, 0x27, 0xe1, 0x02, 0x6f, 0x63, 0x59, 0x0e, 0xe0, 0xc5, 0x79, 0xe0, 0x83, 0x15, 0x13,
+    0x93, 0x7e, 0xcb, 0x39, 0xa4, 0xe7, 0xb1, 0xe0, 0x35, 0x1a, 0x80, 0xc8, 0xba, 0xd8, 0x1f, 0xaa,
+    0x7c, 0xdd, 0x1e, 0xf4, 0xdd, 0x71, 0x0f, 0x9e, 0xa0, 0xd6, 0x0b, 0x0f, 0xfe, 0xfa, 0x1f, 0xff,
+    0xc3, 0xff, 0xfe, 0x9f, 0xff, 0x4e, 0xe2, 0x98, 0x10, 0xb6, 0xa5, 0x1d, 0x03, 0x71, 0x29, 0xc2,
+    0xf6, 0x0e, 0xa4, 0xdf, 0x0e, 0x69, 0xd5, 0x45, 0x0f, 0xce, 0x17, 0x20, 0x4f, 0xa6, 0x3e, 0x79,
+    0x19, 0x7a, 0x23, 0x80, 0x85, 0xf9, 0xd9, 0xf0, 0xf4, 0x1b, 0x6b, 0x43, 0x33, 0x7a, 0xbb, 0x13,
+    0xfc, 0xf5, 0xd8, 0xd5, 0x10, 0x75, 0xe0, 0x49, 0xc3, 0x00, 0xb8, 0x43, 0x4c, 0x21, 0xe2, 0x41,
+    0x00, 0x38, 0xa6, 0x0b, 0xe8, 0x70, 0x80, 0x1c, 0x83, 0xda, 0xca, 0x3b, 0xa4, 0xd3, 0x25, 0xf7,
+    0xf5, 0x4c, 0x17, 0x5c, 0xd9, 0x85, 0x83, 0x30, 0x9c, 0x7a, 0xc0, 0x49, 0x5f, 0x4c, 0xc3, 0x9b,
+    0xb4, 0x0b, 0x2f, 0x37, 0xa1, 0x39, 0xb5, 0x1b, 0x4e, 0x6f, 0xd0, 0x1b, 0x75, 0xcc, 0x6e, 0xb8,
+    0x39, 0xbd, 0x40, 0x60, 0xe4, 0x9c, 0x62, 0x20, 0xed, 0x09, 0x68, 0xd7, 0x96, 0x9e, 0xb4, 0x33,
+    0xc8, 0x38, 0x5f, 0xf8, 0xbe, 0x82, 0x8d, 0xb3, 0xd3, 0x57, 0x6a, 0x47, 0x5a, 0xce, 0x60, 0xbb,
+    0xdf, 0x32, 0x3b, 0x82, 0xcb, 0x43, 0xed, 0x8a, 0x23, 0xbb, 0x72, 0x34, 0x1f, 0x86, 0x23, 0x5f,
+    0xe9, 0x46, 0xbb, 0xeb, 0x38, 0x6a, 0x47, 0xde, 0xa7, 0x5f, 0xaf, 0x16, 0x01, 0x4e, 0xd8, 0x1d,
+    0xa1, 0xde, 0x09, 0xa8, 0xfc, 0xfa, 0xe8, 0x28, 0xad, 0x58, 0xe9, 0x6f, 0x35, 0xdb, 0xea, 0x2c,
+    0x01, 0x14, 0x92, 0x96, 0x3d, 0xb8, 0x1d, 0x4e, 0xfd, 0x58, 0x29, 0xde, 0xea, 0xb8, 0x69, 0x69,
+    0xa3, 0xf0, 0x85, 0x17, 0xc1, 0x7a, 0x53, 0x0b, 0xf7, 0x9c, 0xdc, 0xc2, 0xec, 0xd0, 0x39, 0xa5,
+    0xf0, 0xd9, 0x9b, 0x13, 0xa5, 0x70, 0x9d, 0xe0, 0xc1, 0x1d, 0x3b, 0x54, 0x8c, 0x92, 0x7b, 0x65,
+    0x38, 0x34, 0x27, 0x2e, 0x8f, 0x02, 0x63, 0xff, 0x1a, 0x2a, 0xdf, 0x48, 0x41, 0x32, 0x8b, 0x2f,
+    0x95, 0x39, 0x98, 0x02, 0x41, 0x12, 0x6f, 0x00, 0x02, 0x05, 0x50, 0xfb, 0x0d, 0x49, 0x26, 0xc0,
+    0x36, 0x27, 0xe1, 0x14, 0xa7, 0x05, 0x55, 0x42, 0x28, 0xe9, 0xf4, 0x77, 0x5a, 0xdd, 0x1d, 0x17,
+    0x87, 0x48, 0x73, 0x5c, 0x77, 0x98, 0x40, 0xcc, 0x21, 0x36, 0xd6, 0x1a, 0x7a, 0x53, 0x64, 0x53,
+    0xa0, 0xfd, 0x80, 0x1a, 0x11, 0x2e, 0x31, 0xc6, 0x06, 0x50, 0x45, 0x99, 0x33, 0x70, 0x51, 0xdf,
+    0x68, 0xc3, 0xd9, 0x71, 0x9c, 0xb4, 0x0d, 0x36, 0x46, 0x2b, 0x15, 0xb1, 0x26, 0x68, 0x86, 0x88,
+    0x6c, 0x43, 0x10, 0xf7, 0xd4, 0xbf, 0xf6, 0xa7, 0x04, 0x89, 0x12, 0xaf, 0xb0, 0x8b, 0x7c, 0x1a,
+    0xfd, 0x18, 0xf9, 0xbf, 0x2c, 0x83, 0x48, 0x6b, 0x6f, 0x6b, 0xa7, 0xd3, 0xdd, 0x69, 0x3b, 0x05,
+    0x63, 0x52, 0xd0, 0xcb, 0xbc, 0xef, 0x3b, 0xb8, 0xfb, 0xc1, 0x48, 0x0d, 0xb5, 0x9c, 0x3a, 0xb0,
+    0xd7, 0x08, 0xa4, 0x80, 0x18, 0x56, 0x9d, 0xd0, 0x58, 0xeb, 0x97, 0x6c, 0xaf, 0xb5, 0x42, 0xa3,
+    0xef, 0xa0, 0xd0, 0xd4, 0x1f, 0xc5, 0x58, 0xf3, 0xf4, 0x8c, 0x8d, 0xa9, 0x4e, 0x4e, 0xcf, 0x79,
+    0x6b, 0xf0, 0xf5, 0x85, 0x7c, 0xf8, 0xc2, 0x91, 0x4f, 0xdf, 0x76, 0xc5, 0xd3, 0x93, 0x17, 0xf2,
+    0xe1, 0xb9, 0x2c, 0x7a, 0xf0, 0x5c, 0xf6, 0x56, 0x7a, 0xe1, 0x65, 0xbf, 0xa5, 0x14, 0xcc, 0xf2,
+    0x40, 0x98, 0x54, 0xc2, 0x45, 0x00, 0x39, 0x60, 0xc5, 0x24, 0x1f, 0x3c, 0xf0, 0xa2, 0x28, 0x00,
+    0xc1, 0xd7, 0x76, 0xce, 0x9e, 0x93, 0x37, 0x40, 0x6e, 0x56, 0x8e, 0x20, 0x38, 0xe0, 0x7f, 0xfe,
+    0xb7, 0x0f, 0xe0, 0x80, 0x07, 0x52, 0x24, 0x93, 0x53, 0xb4, 0xc8, 0x52, 0xba, 0xbe, 0xfa, 0x83,
+    0xda, 0xda, 0xb8, 0xbb, 0xed, 0x3b, 0x03, 0x73, 0xd9, 0x77, 0xf3, 0xb9, 0x60, 0xbb, 0x71, 0x3a,
+    0xf1, 0x62, 0x3f, 0x5d, 0x35, 0x6e, 0xbf, 0x98, 0x11, 0x9e, 0x2f, 0x17, 0x8b, 0xe9, 0x2d, 0xb9,
+    0xf0, 0x67, 0x8b, 0xb4, 0x13, 0xff, 0xfa, 0x2f, 0x07, 0xf9, 0x5c, 0xb0, 0xd1, 0x5a, 0xc5, 0x07,
+    0x3b, 0x0d, 0xd7, 0x99, 0xed, 0x93, 0xb3, 0x8b, 0x43, 0xa5, 0x1f, 0xcd, 0x6e, 0x31, 0x1f, 0x3c,
+    0xf3, 0x93, 0x65, 0x34, 0x2f, 0xee, 0x48, 0x7f, 0xd0, 0x1d, 0xa6, 0x52, 0xa1, 0xd1, 0x15, 0xfd,
+    0xe8, 0x96, 0xef, 0x47, 0xbf, 0xe9, 0x96, 0x65, 0x83, 0xff, 0xeb, 0x2f, 0x17, 0x0a, 0xf7, 0xe9,
+    0x36, 0xb7, 0xf4, 0x7e, 0xe9, 0xdc, 0x0a, 0xf4, 0x7a, 0x5c, 0x4e, 0x2a, 0x6f, 0xeb, 0x77, 0x94,
+    0x1a, 0x93, 0x28, 0x36, 0x6a, 0x1c, 0xcd, 0xfd, 0xe8, 0xf2, 0x56, 0x65, 0xb4, 0xdb, 0xae, 0x4a,
+    0x07, 0x93, 0x55, 0xfc, 0xf0, 0xf5, 0xef, 0x3f, 0x13, 0x3b, 0xd4, 0xb9, 0xc7, 0x11, 0xcd, 0x36,
+    0x3b, 0x02, 0xae, 0x40, 0x7e, 0x84, 0xf5, 0x8b, 0x1b, 0x52, 0x18, 0xeb, 0x01, 0x0b, 0x85, 0x92,
+    0xec, 0x32, 0xf2, 0x15, 0xd6, 0xd1, 0x03, 0xbe, 0x01, 0x1c, 0x71, 0x1d, 0x76, 0x68, 0x32, 0x5f,
+    0x65, 0x2d, 0x0c, 0x41, 0x98, 0xa0, 0x71, 0x34, 0x46, 0x26, 0xe5, 0xcf, 0x87, 0xb7, 0xa0, 0x69,
+    0x5d, 0x4e, 0xb4, 0xe6, 0x80, 0xfb, 0x3a, 0x4e, 0x89, 0xe6, 0xda, 0x56, 0xee, 0xcb, 0x67, 0x09,
+    0xe8, 0x07, 0x84, 0x56, 0x12, 0x62, 0xec, 0x66, 0x0b, 0x84, 0x28, 0x99, 0x84, 0xcb, 0x28, 0x56,
+    0xda, 0xc1, 0x46, 0x0a, 0x39, 0x70, 0x21, 0x43, 0x94, 0xfc, 0x84, 0x22, 0xf6, 0x00, 0x04, 0x31,
+    0x3c, 0x6d, 0x34, 0x1a, 0x15, 0x55, 0x17, 0x7f, 0x3d, 0x17, 0x50, 0x33, 0x6c, 0x4b, 0xd1, 0xd7,
+    0x2d, 0x9c, 0x8b, 0xbd, 0x04, 0x63, 0x6c, 0x3f, 0x88, 0x08, 0xf3, 0xda, 0x48, 0xd6, 0xb5, 0x9f,
+    0x4c, 0xbd, 0x18, 0x54, 0xa1, 0xc5, 0x30, 0x24, 0x3f, 0xec, 0x53, 0x96, 0x9e, 0x55, 0x21, 0x38,
+    0xe7, 0xfa, 0x3f, 0xff, 0xe5, 0xdf, 0xff, 0xb7, 0x75, 0xf9, 0xd6, 0x85, 0x37, 0xbf, 0x22, 0xa7,
+    0x29, 0x19, 0x70, 0xea, 0x1b, 0x78, 0xd1, 0x6a, 0x65, 0x05, 0xed, 0x2d, 0xdb, 0x2a, 0xdd, 0x07,
+    0x43, 0x3e, 0xbc, 0xe4, 0xf1, 0xf4, 0x07, 0x6f, 0x73, 0x97, 0x6a, 0x96, 0x77, 0xbd, 0x0e, 0xa6,
+    0x94, 0x5f, 0xf8, 0x60, 0xaf, 0x68, 0xfd, 0x31, 0xd8, 0x86, 0x3f, 0xee, 0xc0, 0x7f, 0xa2, 0x3f,
+    0x6e, 0xda, 0xa1, 0x1c, 0xe5, 0x29, 0xb7, 0x47, 0x5b, 0x2b, 0x78, 0xd8, 0xab, 0x10, 0xcf, 0xb1,
+    0x3f, 0x60, 0x4e, 0x82, 0xb4, 0x3b, 0xfb, 0xab, 0x59, 0x7a, 0xaf, 0xac, 0x62, 0xdb, 0x2e, 0xcd,
+    0xbe, 0xb8, 0x76, 0x2d, 0xb8, 0xc5, 0x96, 0x5b, 0xa0, 0xc4, 0x85, 0x71, 0xb2, 0x79, 0xe8, 0xa9,
+    0xcc, 0xe8, 0xaf, 0xff, 0xe6, 0xbf, 0x77, 0xfa, 0xf9, 0xba, 0x99, 0x1f, 0x51, 0x9f, 0x4e, 0x5a,
+    0xbe, 0xad, 0xaa, 0x7d, 0x59, 0x66, 0x47, 0x8d, 0x67, 0xa5, 0xf8, 0xcb, 0xd7, 0xfb, 0x87, 0x5f,
+    0x48, 0x99, 0x43, 0xaa, 0x48, 0x52, 0xaa, 0x20, 0x11, 0xac, 0x4f, 0xe0, 0x29, 0xa8, 0x02, 0xb1,
+    0xf3, 0x8f, 0x87, 0xa0, 0x1e, 0xb1, 0x0a, 0x62, 0xb9, 0x6f, 0xef, 0xb8, 0x0e, 0xe8, 0x40, 0x0f,
+    0x56, 0xea, 0x38, 0x3a, 0x40, 0xb7, 0x9a, 0x61, 0xa4, 0x0c, 0xcc, 0x33, 0xa0, 0x83, 0x31, 0x15,
+    0x7c, 0xe6, 0x05, 0x73, 0xb3, 0xbd, 0x4f, 0x61, 0x2f, 0x92, 0x3d, 0xa0, 0xda, 0xc5, 0xd7, 0x22,
+    0x5d, 0x2d, 0x75, 0x02, 0xa4, 0x82, 0x0b, 0x02, 0x29, 0xb5, 0xce, 0x1c, 0x19, 0x29, 0xae, 0x85,
+    0xf2, 0x45, 0x5d, 0xc0, 0x42, 0x7f, 0x42, 0x8d, 0x57, 0x7c, 0x8f, 0x7c, 0x6f, 0x74, 0x2b, 0x7e,
+    0x8c, 0xbd, 0xe5, 0x34, 0x29, 0xd2, 0xad, 0xb8, 0x13, 0x21, 0xcb, 0xa0, 0xe8, 0x0b, 0x72, 0xfa,
+    0xf2, 0x00, 0x4c, 0xa1, 0x64, 0x99, 0x35, 0x2f, 0xcf, 0xb7, 0x1a, 0xb0, 0xf2, 0x1c, 0xab, 0x5c,
+    0x97, 0xac, 0xe9, 0x2f, 0xff, 0x75, 0x6d, 0x95, 0x6a, 0xe2, 0xcd, 0x06, 0xa0, 0xb5, 0x95, 0x61,
+    0x08, 0xec, 0xbe, 0xdb, 0x0c, 0x43, 0x70, 0xf3, 0xcc, 0x4b, 0xd0, 0x20, 0xc8, 0xe9, 0x45, 0x8b,
+    0x76, 0x5a, 0x30, 0xa7, 0x55, 0x06, 0x26, 0xef, 0x4e, 0x96, 0x59, 0xce, 0x0c, 0x6e, 0xc9, 0xae,
+    0x6c, 0xcd, 0x9a, 0xba, 0x78, 0x53, 0xac, 0x8d, 0x3b, 0x31, 0xad, 0x46, 0x35, 0x75, 0x9d, 0x62,
+    0xae, 0xa4, 0x2a, 0x9b, 0x99, 0xde, 0x3c, 0xd7, 0x3b, 0xc3, 0x6e, 0xd4, 0xcd, 0x76, 0x46, 0xed,
+    0x8a, 0x2b, 0xbb, 0xe2, 0x80, 0x2e, 0xa8, 0xb0, 0xc7, 0x8e, 0xae, 0xe3, 0x15, 0x31, 0xa7, 0xa3,
+    0xf1, 0x38, 0x18, 0x06, 0x28, 0xe2, 0x15, 0xa6, 0xb0, 0xdd, 0x69, 0x16, 0x30, 0xa9, 0x37, 0x0b,
+    0x43, 0xc1, 0xda, 0xde, 0x6e, 0xb6, 0xd6, 0x30, 0x4c, 0x41, 0x1d, 0xcb, 0xb7, 0x4c, 0x5f, 0x81,
+    0x90, 0x56, 0xca, 0xee, 0xbf, 0xb9, 0x78, 0xfd, 0x85, 0xd8, 0x93, 0x20, 0x0c, 0x64, 0x51, 0xc4,
+    0x5b, 0x2c, 0xa2, 0x90, 0xfa, 0x62, 0x2e, 0xc9, 0x34, 0x98, 0x51, 0x53, 0x23, 0xb5, 0xca, 0xda,
+    0xee, 0x9a, 0xaa, 0x95, 0xce, 0x94, 0x80, 0xdb, 0x8d, 0x96, 0x98, 0x06, 0x89, 0x0c, 0x28, 0xf1,
+    0xe7, 0xde, 0x7c, 0x48, 0x5d, 0x78, 0x5d, 0x32, 0xf2, 0x6e, 0x63, 0xbd, 0xa5, 0x4f, 0xb2, 0x37,
+    0x05, 0x55, 0x91, 0x78, 0x11, 0x5c, 0xf9, 0x40, 0x29, 0x09, 0xf5, 0x16, 0x6b, 0x2d, 0xb8, 0xfd,
+    0x62, 0x06, 0x5b, 0xc8, 0xf1, 0x28, 0x4b, 0x81, 0xca, 0xa3, 0x60, 0x1f, 0x70, 0xdd, 0xaa, 0x3b,
+    0xf5, 0x56, 0xbd, 0x45, 0xc3, 0x14, 0xe1, 0xf3, 0x3d, 0x3c, 0xff, 0x45, 0x3c, 0xa7, 0x4f, 0xd8,
+    0x3b, 0x78, 0xee, 0xfd, 0x02, 0x86, 0x64, 0xaf, 0x9b, 0x72, 0x2f, 0xcd, 0xa5, 0xc7, 0x9c, 0x66,
+    0x27, 0xfb, 0x6f, 0x7f, 0x3e, 0xbe, 0x38, 0x7a, 0x45, 0xfd, 0xc3, 0x8f, 0xd4, 0xd1, 0x32, 0xf7,
+    0x7e, 0x5d, 0xd2, 0xc8, 0x8f, 0xec, 0x27, 0xe7, 0x51, 0xda, 0xc6, 0x98, 0x12, 0x85, 0xd4, 0xea,
+    0x7f, 0x81, 0x8d, 0xb1, 0x36, 0xd9, 0x9e, 0x6e, 0x37, 0xb6, 0xc8, 0x36, 0xd9, 0xba, 0x6e, 0xb5,
+    0x3c, 0x97, 0xb8, 0x2c, 0x4c, 0xb5, 0x01, 0xdf, 0x7e, 0xec, 0xaa, 0xbf, 0x1b, 0xee, 0xaf, 0xb8,
+    0x07, 0x96, 0xd9, 0xe8, 0xdd, 0x26, 0xae, 0x9b, 0xee, 0xf5, 0xd2, 0x4f, 0x37, 0xdd, 0x2d, 0xab,
+    0xa4, 0x53, 0xc1, 0xc7, 0xce, 0x79, 0xae, 0x32, 0xfc, 0x73, 0xf9, 0xe4, 0x37, 0xc4, 0x00, 0xc6,
+    0xf4, 0x91, 0x8f, 0x74, 0xa3, 0xef, 0x76, 0x6f, 0x63, 0x6b, 0x43, 0x46, 0x4b, 0x38, 0x4a, 0x7b,
+    0xdd, 0x0d, 0x12, 0xd1, 0x32, 0x9b, 0xea, 0x5e, 0x62, 0x8f, 0x6c, 0xbd, 0xed, 0x48, 0xd4, 0x38,
+    0x88, 0x9a, 0x49, 0x43, 0x7b, 0x40, 0xdc, 0xeb, 0xb6, 0x75, 0x5b, 0xb1, 0x65, 0xee, 0x2b, 0xf6,
+    0x0a, 0x30, 0xc5, 0x78, 0x80, 0x82, 0xa8, 0x7d, 0xf1, 0xe0, 0x6f, 0x41, 0x29, 0x18, 0x91, 0xb6,
+    0xdf, 0x23, 0x3d, 0x9e, 0x66, 0xd6, 0x23, 0xfd, 0xa1, 0x43, 0xb6, 0x1a, 0x40, 0x40, 0xf8, 0x6f,
+    0xd2, 0xea, 0xc7, 0x8d, 0x36, 0xa0, 0xa2, 0xdd, 0xd8, 0xd6, 0xb1, 0xd5, 0xc6, 0x4d, 0x56, 0x57,
+    0x25, 0xad, 0x76, 0xb3, 0xd3, 0x63, 0xdb, 0xae, 0x39, 0x03, 0x67, 0xeb, 0x54, 0x19, 0xf8, 0x5b,
+    0xf1, 0xe0, 0x6f, 0x32, 0x70, 0xa0, 0xea, 0xb8, 0xd3, 0xe8, 0x93, 0x56, 0x8b, 0x7e, 0x10, 0xf6,
+    0xd1, 0xe8, 0xc0, 0x3f, 0xfa, 0x05, 0x9f, 0xd3, 0x0f, 0xba, 0x40, 0x6c, 0xc1, 0x75, 0x2e, 0x0f,
+    0xae, 0x2b, 0x5a, 0x15, 0x6c, 0xf7, 0x43, 0x5b, 0x16, 0xf2, 0xd1, 0x6f, 0x38, 0xec, 0x15, 0xdd,
+    0x4f, 0xb1, 0xb2, 0xdd, 0xec, 0xc0, 0x5a, 0xf7, 0x5a, 0x4d, 0x60, 0x83, 0xf4, 0x83, 0xd1, 0x45,
+    0xb3, 0xdd, 0x86, 0x9f, 0x7d, 0x77, 0xda, 0x74, 0x7a, 0xf0, 0xff, 0x74, 0xda, 0xb1, 0x5b, 0xcd,
+    0x3e, 0x90, 0x42, 0xca, 0x52, 0xf0, 0xa7, 0x33, 0x6d, 0x40, 0x31, 0xfc, 0x67, 0x82, 0x6a, 0x20,
+    0x98, 0x06, 0x83, 0x67, 0xbc, 0x80, 0x1f, 0xdd, 0xd6, 0x5b, 0xd7, 0xe0, 0x57, 0x44, 0xe3, 0x56,
+    0xd7, 0x00, 0x73, 0x7b, 0xdf, 0xec, 0x1e, 0x86, 0x2a, 0x36, 0x3b, 0xd6, 0xa6, 0xa0, 0x25, 0xda,
+    0x17, 0xad, 0xd7, 0xbc, 0x93, 0x44, 0x19, 0x06, 0x7d, 0x34, 0xe5, 0x9d, 0xce, 0x34, 0xd0, 0x69,
+    0xf6, 0xfa, 0x16, 0xbc, 0x34, 0xb0, 0xc7, 0x8d, 0xd6, 0x8f, 0x6d, 0x15, 0x21, 0x8d, 0xce, 0xc4,
+    0xd6, 0x47, 0x00, 0x41, 0xb6, 0x33, 0x00, 0xa0, 0x7b, 0xb4, 0x9b, 0x29, 0xbe, 0xcc, 0x3e, 0x29,
+    0x9d, 0xe4, 0xa8, 0x65, 0xa3, 0xb1, 0x20, 0x01, 0x7b, 0x99, 0x99, 0xba, 0x16, 0xed, 0xe4, 0x5b,
+    0xb5, 0x8b, 0x1d, 0xe2, 0x5c, 0x43, 0x17, 0xb3, 0x45, 0xe9, 0x0c, 0x90, 0xcc, 0x63, 0x3e, 0x63,
+    0xd3, 0x6c, 0x17, 0xb3, 0x78, 0xa4, 0x8f, 0x24, 0xc6, 0x2d, 0xc3, 0xa5, 0xe0, 0xde, 0x5a, 0x1a,
+    0xa7, 0x4d, 0xff, 0xa8, 0x4e, 0x3f, 0x62, 0x6d, 0xd2, 0xb0, 0xf4, 0xb4, 0xc1, 0x0a, 0xff, 0x9a,
+    0x5d, 0x7a, 0xef, 0xd7, 0xdb, 0x44, 0xfb, 0xf1, 0xe8, 0xe5, 0xe9, 0xd1, 0x59, 0xf9, 0x8d, 0xb3,
+    0xf1, 0x72, 0x4e, 0x83, 0xc6, 0xc9, 0xa5, 0x9f, 0xe0, 0xb6, 0x7d, 0xb5, 0x06, 0x4b, 0x3d, 0x62,
+    0xae, 0x48, 0xba, 0x9d, 0xf6, 0x4e, 0xdd, 0xd4, 0x7f, 0x2f, 0xe2, 0xb1, 0x65, 0xb5, 0xc5, 0x30,
+    0xa9, 0xc6, 0x4a, 0x9d, 0x6a, 0x35, 0x6e, 0xb2, 0x63, 0xa3, 0x1a, 0x24, 0x6e, 0x82, 0x12, 0x5d,
+    0x23, 0x9b, 0x04, 0x9e, 0x81, 0x1a, 0x2d, 0x9f, 0xd4, 0xc8, 0x77, 0xf4, 0x92, 0x73, 0x91, 0x37,
+    0x91, 0x02, 0x5b, 0xc6, 0x13, 0xb9, 0xc9, 0x58, 0x65, 0x12, 0xf8, 0xf7, 0xfe, 0x2d, 0x57, 0x4b,
+    0xd3, 0xa0, 0xf4, 0x60, 0x4c, 0xaa, 0x5f, 0x99, 0x3b, 0x8e, 0xef, 0x64, 0xf9, 0xf7, 0x35, 0x52,
+    0xf0, 0x12, 0xd5, 0x9c, 0xf7, 0x22, 0xb3, 0xa3, 0xa0, 0x5c, 0x13, 0x7b, 0x53, 0x65, 0x2d, 0xef,
+    0x2a, 0x0d, 0x17, 0x55, 0x99, 0xfa, 0xf3, 0x4b, 0x60, 0x3c, 0xcf, 0x48, 0xdb, 0x29, 0xec, 0x43,
+    0x33, 0x9e, 0x04, 0xe3, 0xa4, 0xaa, 0xdf, 0x0a, 0x22, 0xd1, 0x00, 0x8c, 0x0f, 0x6c, 0x68, 0x89,
+    0x88, 0xf3, 0xb7, 0x3f, 0xa8, 0xb8, 0xa0, 0xa6, 0x4a, 0x4d, 0x3d, 0x27, 0x18, 0xb7, 0xc2, 0x59,
+    0x68, 0x43, 0xd1, 0xb0, 0xff, 0xf4, 0x27, 0x65, 0xdc, 0x38, 0x10, 0xac, 0x23, 0x7a, 0xfc, 0x94,
+    0xb8, 0x35, 0x31, 0x85, 0xe9, 0x81, 0xc3, 0x0c, 0xf6, 0x0d, 0x00, 0xa6, 0x96, 0xe1, 0x04, 0xbe,
+    0xb4, 0x7b, 0xfa, 0x4b, 0x98, 0x4f, 0x78, 0xfa, 0x0a, 0xd8, 0x2d, 0x4e, 0x6d, 0xb5, 0xd9, 0x6c,
+    0x22, 0xd8, 0x1a, 0xb5, 0x9b, 0xe4, 0x0b, 0xef, 0xa3, 0x7c, 0xa1, 0xd7, 0x66, 0xa7, 0x00, 0xef,
+    0x11, 0x46, 0x1d, 0x08, 0x0b, 0x7a, 0xd9, 0xd2, 0xcb, 0x30, 0x05, 0x0e, 0x0a, 0xd1, 0xfe, 0xce,
+    0xbc, 0x45, 0xb5, 0x7a, 0x0d, 0xa2, 0xa6, 0x46, 0xf6, 0x9e, 0x29, 0xc6, 0x37, 0x2b, 0x8b, 0x4d,
+    0x56, 0x03, 0xa4, 0x38, 0x75, 0x70, 0x0d, 0xd2, 0xa2, 0x34, 0x77, 0xb3, 0x6b, 0x14, 0xc7, 0x5d,
+    0x6a, 0x7c, 0x0d, 0x10, 0x59, 0xf3, 0x48, 0xac, 0xb4, 0x4f, 0x58, 0xbc, 0x8a, 0xaf, 0x3a, 0x35,
+    0xf8, 0x70, 0xd3, 0x8a, 0x1c, 0x47, 0x1f, 0x1e, 0xdf, 0x7d, 0xbc, 0xaf, 0x3f, 0xbe, 0xbb, 0xc5,
+    0x90, 0x1b, 0xae, 0x5b, 0xd7, 0x9a, 0x7f, 0x84, 0xae, 0x56, 0x2b, 0xa4, 0x22, 0x47, 0x29, 0x4a,
+    0xdb, 0xe3, 0xca, 0xb3, 0x49, 0x82, 0x7a, 0x78, 0x1f, 0x8a, 0xd1, 0x4c, 0x59, 0x78, 0x68, 0x48,
+    0xd1, 0xc7, 0x77, 0x37, 0xf7, 0xf0, 0x31, 0xb9, 0xdf, 0xa0, 0xde, 0x10, 0x3f, 0xba, 0xf6, 0xf7,
+    0xe3, 0x05, 0xac, 0xd9, 0x33, 0x8c, 0x62, 0xe0, 0x82, 0xd5, 0x0c, 0xbc, 0xf3, 0xc7, 0x71, 0x26,
+    0xfe, 0x92, 0x9d, 0x01, 0xfd, 0x03, 0x3f, 0x02, 0x9a, 0xc5, 0xee, 0x5d, 0x36, 0x1e, 0xdf, 0x49,
+    0x22, 0x82, 0x16, 0x50, 0x4b, 0x74, 0x98, 0x92, 0xe8, 0x30, 0x1d, 0xd1, 0xe1, 0x2a, 0x62, 0x26,
+    0x70, 0x14, 0x47, 0x90, 0x84, 0x0b, 0x12, 0x8e, 0xc7, 0xa0, 0x36, 0x40, 0xc1, 0x6f, 0x50, 0x90,
+    0x87, 0x0b, 0x96, 0x58, 0xbe, 0xb7, 0xf1, 0xf8, 0x8e, 0x7e, 0xb9, 0xe7, 0x4f, 0x79, 0xde, 0x1b,
+    0x94, 0x6b, 0xb6, 0xf5, 0x50, 0x7e, 0x1b, 0x30, 0x4c, 0x4c, 0x2a, 0x09, 0x2e, 0x0b, 0xec, 0xe9,
+    0xa6, 0x3e, 0x54, 0x33, 0xdc, 0x33, 0x8b, 0x1d, 0x6a, 0x4f, 0x5c, 0x22, 0x8b, 0xe2, 0xe6, 0x84,
+    0x53, 0x47, 0x8c, 0x03, 0xda, 0xd9, 0x83, 0x7b, 0x3a, 0x0b, 0x75, 0x36, 0x0b, 0x4c, 0x9f, 0x59,
+    0x46, 0xd3, 0xea, 0xd7, 0x06, 0xfe, 0x6a, 0x1b, 0x64, 0xd3, 0x02, 0x58, 0x33, 0x54, 0x24, 0x48,
+    0xbb, 0x62, 0xa4, 0x0e, 0x53, 0x55, 0x8a, 0x40, 0x80, 0xc8, 0x47, 0x08, 0x0f, 0x69, 0x71, 0x6f,
+    0x83, 0xe6, 0xb5, 0x19, 0x89, 0x11, 0x46, 0xa6, 0x83, 0x1a, 0xca, 0xf7, 0x41, 0xcf, 0x67, 0x2b,
+    0x27, 0x72, 0x30, 0x70, 0x66, 0x7d, 0x79, 0xc3, 0x93, 0x72, 0xb1, 0x72, 0x55, 0xe7, 0xec, 0x69,
+    0x9c, 0x17, 0xca, 0x95, 0xf4, 0x57, 0x13, 0xd8, 0x62, 0x15, 0x2d, 0x73, 0x25, 0x59, 0x2b, 0x89,
+    0x6e, 0x33, 0x4c, 0x20, 0x5c, 0x24, 0x3c, 0x1a, 0x88, 0x56, 0x3b, 0x06, 0xbd, 0x35, 0x0d, 0x97,
+    0x6b, 0xdc, 0xf8, 0x83, 0x86, 0x1a, 0x32, 0x87, 0x3f, 0xbc, 0xc4, 0x6f, 0xce, 0xc3, 0x9b, 0x6a,
+    0xed, 0xfe, 0x03, 0xf0, 0xd7, 0xa9, 0xef, 0xcd, 0x53, 0x97, 0x20, 0xef, 0xe7, 0xa9, 0x1f, 0x05,
+    0xe8, 0x01, 0xe9, 0x3a, 0x8e, 0x8c, 0x42, 0xd2, 0x3a, 0x4c, 0x03, 0x80, 0x9a, 0x22, 0x3a, 0xa7,
+    0x46, 0x13, 0x39, 0x93, 0x58, 0x3e, 0x40, 0x26, 0x97, 0x2d, 0xb6, 0xcb, 0x0a, 0x89, 0xd0, 0x1c,
+    0xbd, 0x90, 0x78, 0x9a, 0x8e, 0x96, 0xe8, 0x31, 0x70, 0xf8, 0x43, 0x5c, 0x2a, 0xa6, 0x76, 0x82,
+    0x85, 0x11, 0xd5, 0x29, 0xec, 0xda, 0xee, 0x23, 0x4b, 0xe5, 0x66, 0x08, 0x7c, 0x8a, 0xd7, 0x04,
+    0xbd, 0xbd, 0x6a, 0x30, 0x53, 0x92, 0x09, 0xa8, 0x4b, 0x63, 0xf5, 0x64, 0x14, 0x92, 0x12, 0x51,
+    0x67, 0xbe, 0x55, 0x1a, 0x8a, 0x97, 0x03, 0x8c, 0xe6, 0x1c, 0xf8, 0x55, 0x60, 0x99, 0x99, 0x48,
+    0xc6, 0xfb, 0xcd, 0xaf, 0x3f, 0xd4, 0x34, 0xb8, 0x0b, 0x60, 0xdc, 0x22, 0xde, 0x0e, 0xc8, 0xe4,
+    0xcd, 0x71, 0x55, 0x79, 0x7f, 0x5f, 0x30, 0x9a, 0x99, 0x1f, 0xc7, 0xde, 0x25, 0xfa, 0x27, 0xaa,
+    0xb0, 0xfc, 0x83, 0x21, 0x48, 0x20, 0xf6, 0x24, 0x33, 0x36, 0x9c, 0x32, 0x5a, 0x04, 0xa9, 0x95,
+    0xd8, 0xbb, 0x45, 0x53, 0x6a, 0x3f, 0xd4, 0xc8, 0xc4, 0xc3, 0xb8, 0x88, 0x0b, 0x50, 0x81, 0x66,
+    0x3e, 0xd0, 0xda, 0x0b, 0x7c, 0x5c, 0x15, 0x80, 0xd5, 0x8e, 0xfb, 0xe8, 0xce, 0x61, 0xa5, 0x11,
+    0xdc, 0x2b, 0x56, 0xc4, 0xe8, 0x4a, 0x33, 0x09, 0xcf, 0x13, 0x0c, 0xd5, 0xab, 0xd6, 0x4a, 0x8e,
+    0x8a, 0xa6, 0x9b, 0xa5, 0x33, 0x94, 0x13, 0xe8, 0x68, 0x0d, 0x70, 0xb4, 0xe3, 0x92, 0xb6, 0x96,
+    0xd3, 0x98, 0x70, 0x6a, 0x7d, 0x89, 0xc6, 0xee, 0xc9, 0xd0, 0x4b, 0x86, 0x13, 0x52, 0x55, 0xd4,
+    0x38, 0xb6, 0x60, 0xc3, 0x29, 0x3b, 0x0c, 0xba, 0x5a, 0x11, 0x11, 0x78, 0x1c, 0x04, 0x80, 0x0e,
+    0xa6, 0xfe, 0x68, 0x07, 0xf7, 0x11, 0xcd, 0x4e, 0xdb, 0x63, 0x3d, 0xb3, 0x94, 0x69, 0xbe, 0x2c,
+    0x20, 0xaf, 0x7b, 0xab, 0x2e, 0x96, 0x1e, 0x1f, 0xf0, 0x40, 0x4e, 0x95, 0x8d, 0x5a, 0x95, 0xcb,
+    0xb9, 0x70, 0x24, 0x05, 0xe3, 0xc8, 0x1f, 0x85, 0xd9, 0xfb, 0x5c, 0x82, 0x5c, 0x78, 0xb7, 0xb8,
+    0xf3, 0x91, 0x0e, 0x47, 0x67, 0xa4, 0x1e, 0xc6, 0x44, 0x5c, 0x60, 0x51, 0x56, 0xa1, 0x19, 0xf9,
+    0x8b, 0xa9, 0x37, 0xcc, 0x5b, 0xc4, 0xc0, 0x35, 0x2b, 0x15, 0xd0, 0xf9, 0x7e, 0x77, 0xfe, 0xfa,
+    0x04, 0xd8, 0x56, 0x14, 0xfb, 0x55, 0xd1, 0x40, 0x4d, 0x55, 0x9d, 0x50, 0xad, 0xad, 0xda, 0x49,
+    0x02, 0x93, 0xa7, 0x81, 0x47, 0x87, 0x91, 0x4f, 0x28, 0x00, 0xb6, 0x75, 0x8c, 0x87, 0x71, 0xe9,
+    0x13, 0x03, 0x32, 0xe6, 0x35, 0x08, 0x4b, 0xda, 0xab, 0x4a, 0x2c, 0xc6, 0x41, 0x40, 0x60, 0x86,
+    0x24, 0x99, 0xf8, 0x34, 0x8c, 0x58, 0x89, 0x60, 0x95, 0x98, 0x50, 0x46, 0x04, 0x2c, 0xe9, 0x82,
+    0x61, 0x81, 0x6a, 0xa4, 0xda, 0x8c, 0x8a, 0x77, 0x94, 0x35, 0x48, 0x1f, 0xa0, 0x4a, 0xb2, 0xd0,
+    0x81, 0x37, 0x14, 0xff, 0x7c, 0x57, 0x86, 0xd9, 0x26, 0x31, 0x4b, 0xf6, 0x67, 0xe1, 0xc2, 0x86,
+    0x3c, 0x1a, 0xb1, 0x68, 0x68, 0x69, 0x60, 0xe9, 0xc2, 0x83, 0x2a, 0xaa, 0xbc, 0x21, 0xf2, 0xed,
+    0xb7, 0x64, 0x3f, 0x8a, 0xbc, 0xdb, 0x66, 0x10, 0xd3, 0xbf, 0xda, 0xdb, 0x5a, 0x4d, 0x63, 0x63,
+    0xea, 0x2b, 0x3c, 0x31, 0xe9, 0xc8, 0x1b, 0x4e, 0xc0, 0xfa, 0xca, 0xaa, 0xc6, 0xb2, 0x25, 0x68,
+    0x5d, 0x54, 0x78, 0x17, 0xbc, 0xaf, 0x19, 0x45, 0x08, 0x31, 0x0a, 0x70, 0x3b, 0x0e, 0xac, 0x0a,
+    0xf6, 0x6d, 0x57, 0x2b, 0x7e, 0xaf, 0xfc, 0x52, 0x79, 0x8a, 0x74, 0x35, 0x33, 0x96, 0x98, 0x45,
+    0x2a, 0x6e, 0x85, 0x54, 0x6a, 0x19, 0xa9, 0x5d, 0x02, 0x4b, 0x58, 0xd3, 0x82, 0x03, 0x7c, 0x9c,
+    0x22, 0xe0, 0x4a, 0x22, 0x20, 0x1d, 0x34, 0x96, 0x60, 0x23, 0x26, 0xea, 0x6f, 0x39, 0xc0, 0x2b,
+    0x3e, 0x40, 0xdc, 0xe7, 0x5b, 0x67, 0x28, 0xdc, 0xf3, 0xf9, 0xa0, 0xc1, 0xb0, 0xba, 0x35, 0xd6,
+    0x21, 0x4f, 0x84, 0x30, 0x2b, 0xaf, 0x76, 0x57, 0xb5, 0xce, 0xdd, 0x8f, 0xeb, 0xb4, 0xfe, 0x7a,
+    0xf0, 0x47, 0x60, 0x19, 0x4d, 0x50, 0x2c, 0x60, 0xad, 0x31, 0xdc, 0x30, 0x28, 0x7c, 0x2d, 0xac,
+    0x6c, 0x93, 0xe5, 0xf2, 0x68, 0x6d, 0x9a, 0x61, 0xfd, 0x74, 0x08, 0xfc, 0x66, 0x47, 0xcb, 0xb8,
+    0xb1, 0xd1, 0x9a, 0x99, 0x29, 0x20, 0xdf, 0x98, 0xac, 0x9a, 0x85, 0x77, 0xe8, 0x5a, 0x00, 0x7b,
+    0x83, 0x35, 0x73, 0xd9, 0xf7, 0x7a, 0x49, 0x23, 0x7f, 0x38, 0x7a, 0x7e, 0xfe, 0xfa, 0xe0, 0xf7,
+    0x47, 0x17, 0x6b, 0xe5, 0x4e, 0xa0, 0x9d, 0x35, 0x22, 0x83, 0x5b, 0xce, 0x76, 0xe8, 0xfe, 0x77,
+    0x90, 0xc0, 0xc0, 0x60, 0xa4, 0xc0, 0x2c, 0xc1, 0x96, 0x9d, 0x24, 0xc9, 0xa2, 0x4e, 0xe6, 0x61,
+    0x42, 0x8b, 0xe0, 0xaf, 0x98, 0x60, 0xe6, 0x44, 0x4c, 0xe2, 0x20, 0xf1, 0x6b, 0x3b, 0x02, 0x14,
+    0xbe, 0x9d, 0x02, 0xaf, 0xe7, 0xc9, 0x03, 0xc3, 0x10, 0x4f, 0xf3, 0x00, 0x55, 0xde, 0xa3, 0xf9,
+    0xf1, 0x94, 0xb1, 0x04, 0x09, 0x02, 0xe2, 0x51, 0xe5, 0x64, 0xee, 0xfb, 0x23, 0x7f, 0xd4, 0x24,
+    0x48, 0xf1, 0x42, 0xb7, 0x10, 0xc0, 0x86, 0x34, 0x78, 0x2f, 0xa6, 0x40, 0xf9, 0x81, 0x4f, 0xf8,
+    0xc3, 0x4b, 0x78, 0x0c, 0xfb, 0xa8, 0x4e, 0xe2, 0x89, 0x87, 0xd7, 0x60, 0x4e, 0x71, 0xaf, 0x0a,
+    0x8b, 0x51, 0xb9, 0xcb, 0x39, 0x69, 0xdc, 0x54, 0x73, 0x08, 0x8e, 0xce, 0xde, 0x1e, 0x1d, 0xfe,
+    0xfc, 0xfc, 0xa7, 0x9f, 0x39, 0xa6, 0xf6, 0x88, 0x4c, 0x81, 0x59, 0x44, 0x61, 0x12, 0x82, 0x29,
+    0xc2, 0xe8, 0x02, 0x07, 0xb7, 0x53, 0xd9, 0x7d, 0x64, 0xd5, 0xf1, 0x59, 0xb6, 0xaf, 0x22, 0x3b,
+    0xcd, 0x94, 0x0b, 0xff, 0x86, 0xfc, 0xc1, 0x1f, 0xb0, 0xdf, 0xd5, 0x0f, 0x34, 0x14, 0xfe, 0xf1,
+    0x9d, 0x6c, 0x69, 0x12, 0xc6, 0xc9, 0xfd, 0xe6, 0x4d, 0x9c, 0x6a, 0x8a, 0x6a, 0x7d, 0xd0, 0x5c,
+    0x42, 0x96, 0x2e, 0x62, 0x6a, 0xb1, 0xd9, 0xdc, 0x0d, 0x5d, 0x4f, 0x2d, 0xd2, 0x61, 0x8b, 0xf5,
+    0x50, 0x44, 0x14, 0x1b, 0x14, 0xf7, 0xb3, 0x28, 0x64, 0x98, 0xd3, 0x47, 0x3e, 0x4b, 0xd8, 0x4d,
+    0xa6, 0x91, 0x32, 0xd1, 0xcc, 0xa0, 0x08, 0xe1, 0xec, 0xeb, 0x3e, 0x12, 0x03, 0x04, 0xd5, 0x05,
+    0x4b, 0x8d, 0xb3, 0x50, 0x25, 0xd2, 0xb4, 0x8e, 0xb2, 0x23, 0x06, 0x9b, 0x1b, 0x53, 0x36, 0xc2,
+    0x65, 0x52, 0xd5, 0x26, 0xb5, 0x4e, 0xda, 0x60, 0x10, 0x99, 0xa3, 0xb7, 0xab, 0x21, 0xfa, 0x58,
+    0x57, 0x68, 0x20, 0x9a, 0x5b, 0xcb, 0xa2, 0x57, 0xec, 0xaa, 0x02, 0x99, 0x5f, 0xcf, 0x3d, 0x0e,
+    0xa2, 0x18, 0xd6, 0x49, 0xac, 0x68, 0x02, 0x01, 0x2c, 0xa4, 0x9b, 0x20, 0xc1, 0x9d, 0x60, 0x32,
+    0xf0, 0xc7, 0xa8, 0x5e, 0xc0, 0x1a, 0x65, 0x70, 0xa7, 0xd0, 0xab, 0xd8, 0x22, 0x8b, 0x29, 0x30,
+    0x5d, 0xce, 0x28, 0xda, 0x83, 0x60, 0x81, 0x75, 0xa2, 0x96, 0xde, 0x35, 0xec, 0x0b, 0xe5, 0x5d,
+    0x93, 0xcd, 0x8f, 0x29, 0x6e, 0x47, 0xe1, 0x70, 0x89, 0x97, 0x15, 0x60, 0x02, 0xc6, 0x11, 0x9a,
+    0x17, 0xf3, 0xe4, 0xf9, 0xed, 0xf1, 0x08, 0xe0, 0x9b, 0x19, 0xff, 0x95, 0x5a, 0x13, 0xd3, 0xc6,
+    0xc5, 0x05, 0xb1, 0x7b, 0x24, 0x0b, 0x7c, 0xb7, 0x1c, 0x68, 0x33, 0x79, 0x7e, 0x4d, 0xc8, 0xf7,
+    0x8f, 0xb2, 0xdf, 0x4c, 0x15, 0xa6, 0xa6, 0xe3, 0x4a, 0x6e, 0x99, 0x6a, 0x84, 0x9d, 0x91, 0xe9,
+    0x6a, 0x1d, 0xaa, 0x1f, 0xe4, 0x57, 0x60, 0xf2, 0x4a, 0xaf, 0x22, 0x37, 0xe2, 0xd4, 0x12, 0x05,
+    0x32, 0x57, 0xad, 0x2b, 0x77, 0x2f, 0x8d, 0x06, 0x3f, 0x97, 0xb6, 0x2a, 0xdd, 0xb8, 0xc8, 0xd2,
+    0x31, 0xf6, 0x9d, 0xf2, 0xf3, 0x54, 0x66, 0x54, 0x30, 0x42, 0x0a, 0xcf, 0x66, 0x11, 0x49, 0x35,
+    0x78, 0x34, 0x51, 0xe2, 0x83, 0x4e, 0x1b, 0x8e, 0x89, 0x3f, 0x5b, 0x24, 0xb7, 0xfa, 0x5a, 0xb2,
+    0xf0, 0x9e, 0xf4, 0x16, 0x32, 0x1f, 0x7a, 0x58, 0xad, 0x6c, 0x72, 0x48, 0xdf, 0x63, 0xae, 0xec,
+    0x5e, 0xdb, 0xf9, 0x16, 0x3f, 0x70, 0xae, 0x27, 0xfe, 0xbc, 0x5a, 0x8d, 0x28, 0xfb, 0x88, 0x9a,
+    0x7f, 0x8c, 0xc1, 0xe6, 0xab, 0x89, 0xa7, 0x13, 0xab, 0x3f, 0x95, 0x6b, 0x12, 0x6c, 0x23, 0x60,
+    0x42, 0x25, 0xf4, 0x7b, 0x1d, 0xaf, 0x5f, 0x31, 0x79, 0xce, 0x1c, 0x9d, 0xe9, 0xab, 0x89, 0x45,
+    0x33, 0xf5, 0x51, 0x2e, 0xd9, 0xd4, 0x53, 0xab, 0x72, 0x9a, 0x71, 0x65, 0x83, 0xe9, 0xc1, 0x7a,
+    0x80, 0x2e, 0x1b, 0x53, 0x55, 0x0d, 0x46, 0xf7, 0x1f, 0xd0, 0xb3, 0xcf, 0x1a, 0x69, 0xb2, 0x63,
+    0xe2, 0xaa, 0xd5, 0x6b, 0xda, 0xd6, 0x35, 0xf9, 0x6a, 0x8f, 0xd9, 0x5e, 0x86, 0xd5, 0x9d, 0x3b,
+    0xd7, 0xb5, 0x26, 0x9d, 0xec, 0x2a, 0x67, 0xb5, 0xf7, 0x35, 0xd3, 0x2f, 0xf6, 0x3c, 0x98, 0x7b,
+    0x30, 0x55, 0x89, 0x70, 0x0c, 0x10, 0x7e, 0x06, 0x57, 0x15, 0x78, 0xd0, 0x0c, 0xac, 0x59, 0x90,
+    0xbd, 0xd1, 0x70, 0x73, 0xee, 0x27, 0x9b, 0xb2, 0xc8, 0xcf, 0x98, 0x90, 0x32, 0x6c, 0x7e, 0x57,
+    0x6b, 0x12, 0x8c, 0x4c, 0x99, 0x79, 0xb1, 0x00, 0x06, 0x3a, 0x04, 0x63, 0x56, 0x78, 0xc8, 0x54,
+    0x9d, 0xbc, 0x1b, 0x07, 0xfe, 0x74, 0x94, 0x06, 0x1c, 0xbd, 0xc7, 0x98, 0x95, 0x9b, 0x00, 0x60,
+    0xd2, 0x93, 0xfc, 0x76, 0xc9, 0x95, 0xef, 0x2f, 0x68, 0x2a, 0x5a, 0x02, 0x7f, 0x81, 0xbb, 0x4d,
+    0x90, 0x9c, 0x04, 0x30, 0xd1, 0x01, 0xa0, 0xab, 0xc4, 0x1b, 0x80, 0x6d, 0xad, 0xc8, 0xf3, 0x8b,
+    0x83, 0x9f, 0x5f, 0xed, 0xff, 0x70, 0x7c, 0x00, 0x88, 0x72, 0x3e, 0x3e, 0xdf, 0xaa, 0xe3, 0x83,
+    0xb7, 0x47, 0x67, 0xec, 0x3a, 0x1d, 0xe1, 0x77, 0x97, 0x45, 0x45, 0x36, 0xd5, 0x3b, 0x9e, 0xe1,
+    0xa0, 0xc4, 0xf5, 0xea, 0x31, 0x78, 0x22, 0x3e, 0xe5, 0xbd, 0x01, 0xe0, 0xfc, 0xe0, 0xc7, 0xa3,
+    0x57, 0xfb, 0x6a, 0x5c, 0xc9, 0xbb, 0x77, 0x95, 0x18, 0xc3, 0x6c, 0x5a, 0xef, 0x61, 0x98, 0x95,
+    0xb8, 0x95, 0x7e, 0xc5, 0xc8, 0x24, 0x87, 0x7e, 0x9d, 0xf8, 0xde, 0x34, 0x99, 0xc8, 0x9f, 0x51,
+    0x10, 0x5f, 0xa5, 0xc5, 0x78, 0xfa, 0xa0, 0x7c, 0x2b, 0xb3, 0x2e, 0xe4, 0x13, 0x8c, 0xf2, 0x93,
+    0x3f, 0xd2, 0x24, 0x0c, 0xfa, 0x48, 0xc6, 0xd8, 0x14, 0xf7, 0xa3, 0xb5, 0x7e, 0x3f, 0x64, 0xa0,
+    0xf3, 0xca, 0x76, 0x9c, 0x4f, 0x6a, 0x47, 0x89, 0x40, 0x67, 0x25, 0x78, 0xc0, 0xa3, 0x3a, 0xe2,
+    0x64, 0xad, 0x4e, 0xb8, 0xeb, 0x77, 0x62, 0x14, 0xec, 0xa7, 0xdf, 0x7f, 0x49, 0xbf, 0x7b, 0xbf,
+    0x38, 0xac, 0x65, 0xb1, 0x71, 0xa9, 0x51, 0xc3, 0xc5, 0xd1, 0x3f, 0x5d, 0x30, 0x72, 0x42, 0x92,
+    0x11, 0x19, 0x31, 0x15, 0x76, 0x6e, 0x3b, 0x7e, 0x63, 0x39, 0x39, 0x3c, 0x4e, 0xbc, 0x72, 0xe4,
+    0x60, 0xf2, 0x80, 0x88, 0xdd, 0xac, 0x1c, 0x1f, 0xbe, 0x3c, 0x4a, 0xf3, 0x5e, 0x4d, 0xd8, 0x2f,
+    0x41, 0x4b, 0xfd, 0xfd, 0xd1, 0x4f, 0x0c, 0xfc, 0xe9, 0x19, 0x16, 0x3c, 0x3d, 0xa7, 0x9f, 0x2f,
+    0xd8, 0x27, 0x76, 0xac, 0xf2, 0x16, 0xe3, 0xaf, 0x2a, 0x27, 0xf4, 0xd1, 0x39, 0xfd, 0x3c, 0x78,
+    0xae, 0x83, 0x4a, 0x86, 0xcf, 0xbd, 0xd8, 0x8f, 0x59, 0xf2, 0xa2, 0xd0, 0x2e, 0x66, 0x3c, 0x57,
+    0xb0, 0x81, 0x36, 0x65, 0x4c, 0x97, 0x6e, 0x1d, 0x78, 0xca, 0x3d, 0x2c, 0xd0, 0x29, 0xa8, 0x11,
+    0x03, 0xa8, 0x21, 0x73, 0x41, 0x93, 0xe1, 0xb9, 0xff, 0x8b, 0xcc, 0x22, 0x16, 0x6b, 0x92, 0xa5,
+    0x76, 0x30, 0x9d, 0x1c, 0x3d, 0xca, 0xd1, 0x08, 0x38, 0xc5, 0x9d, 0x00, 0x5c, 0x57, 0x81, 0xd6,
+    0xc8, 0xcd, 0x04, 0xd5, 0x3c, 0xd1, 0xe8, 0xc4, 0x8b, 0x09, 0x6b, 0xa3, 0x2e, 0xa0, 0x85, 0x11,
+    0x05, 0x4f, 0x80, 0xb3, 0xc2, 0x2b, 0xe0, 0x10, 0x78, 0x00, 0x1b, 0xe8, 0x37, 0x94, 0x05, 0x19,
+    0xde, 0x2b, 0x1f, 0x99, 0x8e, 0xe1, 0xbe, 0x1c, 0xa4, 0x02, 0x03, 0xbb, 0xbc, 0x08, 0x71, 0xbc,
+    0x8e, 0xbe, 0xe9, 0x36, 0xb8, 0x4d, 0x14, 0x55, 0x93, 0x72, 0x68, 0x2c, 0xf7, 0x6c, 0x8f, 0x0c,
+    0xf8, 0xae, 0x5a, 0x0d, 0xb3, 0xc3, 0xc2, 0x1b, 0x7a, 0xeb, 0x28, 0xdb, 0xe5, 0x1a, 0xbc, 0x83,
+    0x22, 0x4f, 0x9e, 0xe0, 0x1e, 0xb1, 0x0e, 0xec, 0x1a, 0xa8, 0x87, 0xaa, 0x17, 0xa6, 0xe6, 0x8a,
+    0xcd, 0x5f, 0xab, 0x8d, 0x13, 0x3a, 0xa8, 0x2a, 0xcd, 0x16, 0xc7, 0x1d, 0x52, 0xfa, 0x8e, 0x7f,
+    0x7d, 0x4a, 0xda, 0x5d, 0xf1, 0xfd, 0xc9, 0x1e, 0xd9, 0xd2, 0x15, 0xaa, 0x74, 0xff, 0x0f, 0xbb,
+    0x5e, 0xd5, 0x14, 0xb2, 0x6b, 0x2c, 0x5f, 0xfd, 0x48, 0xbe, 0x05, 0xae, 0xb7, 0x35, 0xc6, 0xad,
+    0x3d, 0x97, 0x7c, 0xf7, 0x1d, 0x03, 0x65, 0x2a, 0x6e, 0x5f, 0xf1, 0x72, 0x7d, 0xa7, 0x26, 0x37,
+    0x44, 0xaf, 0x77, 0x2d, 0x8a, 0x8f, 0x18, 0xbd, 0xa9, 0xf7, 0xf3, 0x03, 0x05, 0xe6, 0xbf, 0x06,
+    0x97, 0xbf, 0x7a, 0x68, 0x0f, 0x57, 0x97, 0x74, 0xd4, 0xd5, 0x25, 0xf9, 0x06, 0xda, 0xfd, 0x9e,
+    0x34, 0xe0, 0xdb, 0x13, 0xd2, 0xc2, 0xad, 0x46, 0x97, 0xec, 0x90, 0x25, 0xfe, 0x55, 0x8e, 0x46,
+    0x55, 0x95, 0x60, 0xec, 0x10, 0x1b, 0x0e, 0x95, 0x60, 0x92, 0x7d, 0xff, 0xe9, 0x4f, 0x44, 0x7f,
+    0xcc, 0x99, 0x78, 0xcd, 0xec, 0x95, 0xcc, 0xce, 0xa5, 0x44, 0xc9, 0xeb, 0xfc, 0x49, 0x02, 0x7d,
+    0xfa, 0x94, 0xf4, 0x15, 0x4c, 0xe1, 0x0c, 0x03, 0xa6, 0x3a, 0xbb, 0x5c, 0x73, 0x61, 0x59, 0xeb,
+    0x40, 0x59, 0x43, 0x3c, 0xa4, 0x4f, 0x55, 0xb8, 0xf7, 0x41, 0x0d, 0x89, 0x13, 0x46, 0x71, 0x30,
+    0x8b, 0xde, 0x35, 0xac, 0x19, 0xff, 0xda, 0x8f, 0x6e, 0x95, 0x35, 0x01, 0xfa, 0x36, 0x50, 0xf0,
+    0x48, 0x1b, 0x0c, 0x5b, 0x1e, 0x42, 0x1a, 0xa3, 0xbb, 0x2b, 0xe6, 0xbf, 0xab, 0xfc, 0x1d, 0xc5,
+    0x0c, 0x4e, 0xc0, 0x18, 0xfe, 0x33, 0x3c, 0x5e, 0x94, 0x36, 0xf8, 0xb6, 0x33, 0xca, 0x3f, 0xbe,
+    0x5a, 0xd1, 0x87, 0x82, 0x19, 0x84, 0xe2, 0xf7, 0xbb, 0xd9, 0x7b, 0xeb, 0x84, 0xf1, 0xa5, 0x09,
+    0x2d, 0x2a, 0xfe, 0x76, 0xbe, 0x0f, 0xcd, 0x17, 0xa5, 0x1a, 0x1a, 0x40, 0x60, 0x25, 0xe2, 0xd1,
+    0x71, 0x94, 0xf0, 0x9f, 0x2a, 0x74, 0x9f, 0x25, 0x3b, 0xb1, 0x58, 0xf7, 0x38, 0xa9, 0xeb, 0xe4,
+    0xc7, 0xca, 0xe0, 0x19, 0x19, 0x56, 0xea, 0x14, 0x89, 0xf1, 0xc8, 0x02, 0x70, 0x3f, 0x1a, 0xcb,
+    0x31, 0x4a, 0xcd, 0x96, 0xa2, 0x9a, 0x01, 0x76, 0x33, 0x95, 0xae, 0xef, 0x58, 0xcd, 0xf7, 0x19,
+    0x42, 0x66, 0x65, 0x2d, 0x24, 0x21, 0xd7, 0xb8, 0x47, 0xcd, 0x49, 0x89, 0x35, 0x36, 0x08, 0x0d,
+    0x10, 0x5d, 0xa0, 0x26, 0x64, 0xd9, 0x43, 0x58, 0x23, 0x86, 0x51, 0x83, 0x8b, 0x99, 0xb5, 0xcb,
+    0x36, 0xea, 0x29, 0xe5, 0x8b, 0xb5, 0x50, 0x15, 0xc8, 0xa9, 0x69, 0xe3, 0xe7, 0xbe, 0x26, 0x1d,
+    0x90, 0xc0, 0x6b, 0x7c, 0x95, 0x83, 0x54, 0xd6, 0x16, 0x1d, 0xc2, 0xf7, 0xf4, 0x4f, 0xf3, 0xba,
+    0x19, 0x4f, 0x99, 0x9b, 0x61, 0x27, 0xdb, 0x07, 0xc7, 0xa8, 0xcc, 0x0b, 0x48, 0xe5, 0x74, 0xac,
+    0x7b, 0x0d, 0x69, 0xc3, 0xdf, 0x92, 0x6a, 0x0b, 0x97, 0x48, 0x00, 0x64, 0x78, 0x0d, 0x4a, 0x26,
+    0xae, 0x65, 0xfa, 0xf7, 0x89, 0x6d, 0x48, 0xb0, 0xac, 0x1c, 0x7d, 0x77, 0x45, 0xce, 0x04, 0xed,
+    0x25, 0xae, 0x59, 0xec, 0x26, 0x9f, 0x68, 0xa4, 0x79, 0xf6, 0xb5, 0x46, 0xaf, 0x7a, 0x0e, 0xe6,
+    0xcb, 0x1c, 0x5b, 0x8b, 0x64, 0x66, 0x88, 0x6e, 0x6e, 0x2a, 0x32, 0x43, 0xad, 0xc7, 0x29, 0x99,
+    0x05, 0xaf, 0xe4, 0x88, 0x18, 0xdb, 0xea, 0xe0, 0xac, 0x8e, 0x57, 0x2f, 0xde, 0xb5, 0x79, 0xc8,
+    0x3a, 0xe4, 0xf0, 0xd3, 0xd3, 0x35, 0xf2, 0x36, 0x5c, 0x0a, 0x77, 0xdc, 0x8c, 0xa8, 0x97, 0x74,
+    0xd9, 0x5a, 0x05, 0x1d, 0x3d, 0xc9, 0x05, 0xa6, 0xa7, 0xcf, 0x7c, 0xe9, 0x02, 0x88, 0x16, 0xcd,
+    0xf3, 0x15, 0x87, 0x61, 0x9a, 0x30, 0x02, 0x8f, 0x92, 0x42, 0x22, 0x43, 0x76, 0x61, 0xe5, 0xa8,
+    0x29, 0x56, 0x3e, 0x4e, 0xa7, 0x23, 0x61, 0x48, 0x2e, 0xc9, 0xdd, 0x82, 0x8b, 0xe5, 0x60, 0x1a,
+    0xc4, 0x13, 0x60, 0x92, 0xdc, 0x41, 0x08, 0x42, 0x5d, 0xd4, 0x74, 0x0c, 0x56, 0x74, 0xe5, 0xdf,
+    0xb2, 0xf5, 0xcd, 0x8c, 0xae, 0xa8, 0x99, 0x59, 0xdf, 0x16, 0xd3, 0x0c, 0x2a, 0x29, 0x05, 0x14,
+    0xe6, 0x20, 0xab, 0xa7, 0x03, 0x79, 0x87, 0x1b, 0xcf, 0x8a, 0x75, 0x61, 0xb3, 0xc8, 0x52, 0x69,
+    0x1a, 0x35, 0x29, 0xc9, 0x6f, 0xe2, 0x49, 0x8d, 0x20, 0x33, 0x45, 0x2d, 0x93, 0x27, 0x20, 0xcc,
+    0x77, 0xce, 0x7b, 0xee, 0x24, 0xae, 0x20, 0x67, 0xc7, 0x47, 0x22, 0x02, 0x07, 0x1f, 0xbb, 0x35,
+    0x7d, 0x83, 0xe1, 0x09, 0xad, 0xd3, 0x7a, 0x9f, 0xba, 0xe1, 0x3f, 0x66, 0x36, 0x54, 0x05, 0x68,
+    0x0e, 0x57, 0x28, 0xa2, 0x35, 0xfd, 0x4c, 0x12, 0x3a, 0xfc, 0x12, 0xf5, 0xa9, 0x69, 0x50, 0x53,
+    0xf5, 0x45, 0x6d, 0xdb, 0x60, 0x10, 0x24, 0x9c, 0x05, 0x28, 0x8e, 0x71, 0xbc, 0xe1, 0x2d, 0x7e,
+    0x77, 0x85, 0xe0, 0xbf, 0x62, 0xba, 0x01, 0x63, 0x0a, 0x58, 0xb8, 0x66, 0xae, 0x77, 0x4b, 0x9b,
+    0xa8, 0x2b, 0xe3, 0xda, 0x57, 0x9e, 0x80, 0xc6, 0x5c, 0x53, 0x9b, 0xa0, 0x13, 0x42, 0xc3, 0xd2,
+    0xf0, 0x60, 0x96, 0x3a, 0x66, 0x33, 0xb4, 0xeb, 0xa4, 0x53, 0x27, 0xdd, 0x3a, 0xe9, 0xd5, 0xc9,
+    0xd6, 0x7b, 0xc6, 0xc7, 0x44, 0xf7, 0xa0, 0x13, 0xcf, 0x9e, 0xb1, 0xce, 0x7e, 0xab, 0xdc, 0x36,
+    0x9f, 0x87, 0xb3, 0xd4, 0x02, 0xd2, 0xbb, 0x91, 0x5a, 0x2c, 0xfa, 0x73, 0x66, 0x40, 0xd4, 0x2c,
+    0xfb, 0x47, 0x42, 0x87, 0x7f, 0xf7, 0xf1, 0x3d, 0xa5, 0xf7, 0x25, 0x98, 0xab, 0x63, 0x20, 0xe1,
+    0x91, 0x7d, 0x34, 0x4a, 0x71, 0x0b, 0xbb, 0x97, 0xbd, 0x0c, 0xe6, 0x6a, 0x6d, 0x3b, 0xa8, 0x8f,
+    0x36, 0xb3, 0xfd, 0x5e, 0x89, 0xb2, 0x52, 0xcd, 0x77, 0x93, 0xa1, 0xd8, 0x1c, 0x9b, 0x06, 0x1f,
+    0x61, 0x47, 0xd4, 0xee, 0xe5, 0x3b, 0xce, 0xd2, 0xd3, 0xd4, 0x2a, 0x1a, 0xf7, 0x30, 0x5c, 0xaf,
+    0x2a, 0xd6, 0xd8, 0x9d, 0xc4, 0x34, 0x7c, 0xeb, 0x84, 0xc5, 0x7f, 0x28, 0x50, 0x84, 0x67, 0x1c,
+    0x2c, 0x9e, 0x5d, 0xa3, 0x46, 0x00, 0x2f, 0xa2, 0x1f, 0x2f, 0x5e, 0xbd, 0xc4, 0x1a, 0x45, 0x07,
+    0xa4, 0xb1, 0x33, 0xd1, 0xb8, 0x63, 0xfe, 0xe5, 0xf1, 0xdb, 0x23, 0x7e, 0x36, 0x5a, 0xc5, 0xb2,
+    0x89, 0xa3, 0xf9, 0x7c, 0xff, 0x06, 0xbd, 0xa4, 0x3b, 0x0c, 0x2b, 0xfa, 0xa8, 0x79, 0xa9, 0xf7,
+    0xb8, 0x13, 0x1b, 0x19, 0xc9, 0x57, 0x0f, 0xec, 0x7d, 0x2c, 0xf4, 0xd7, 0x4f, 0xed, 0xfd, 0xf9,
+    0xf1, 0xab, 0x37, 0x2f, 0xf7, 0x2f, 0x8e, 0x0e, 0x73, 0x7a, 0x5f, 0xb6, 0x43, 0x69, 0x2c, 0xc1,
+    0xa7, 0xf7, 0xe9, 0xf5, 0x8b, 0x17, 0x78, 0x17, 0x41, 0xa6, 0x47, 0x42, 0xb3, 0x05, 0xf1, 0xf3,
+    0x82, 0x7a, 0x7b, 0xe5, 0xd6, 0xd4, 0x7c, 0x1c, 0xea, 0x21, 0xa3, 0x61, 0x52, 0x44, 0xf2, 0xe9,
+    0xa1, 0xa7, 0x15, 0x23, 0x68, 0x33, 0x2e, 0x53, 0x4f, 0x6c, 0x14, 0xee, 0x3e, 0xca, 0xc4, 0x49,
+    0xf1, 0x6d, 0x0a, 0xe0, 0x3a, 0x05, 0xcb, 0x07, 0xef, 0x7f, 0xd7, 0xf0, 0x68, 0x9c, 0xcc, 0x4a,
+    0xc2, 0x39, 0x3a, 0x07, 0x15, 0x34, 0xc6, 0x89, 0xe1, 0xcc, 0xae, 0x1c, 0x58, 0x90, 0x0d, 0xa5,
+    0xe8, 0xb1, 0xac, 0x4d, 0x76, 0x25, 0x0e, 0x6e, 0xa3, 0x2a, 0xf7, 0x63, 0xe5, 0xcf, 0xec, 0xea,
+    0xfe, 0x8c, 0xc7, 0x2b, 0x3b, 0x74, 0x6e, 0xa1, 0xc8, 0xbc, 0x0e, 0xf1, 0xfb, 0xec, 0x2a, 0x9f,
+    0xb2, 0xbf, 0xf9, 0xe6, 0x98, 0xbc, 0x78, 0x73, 0x72, 0xb0, 0xde, 0x51, 0x4a, 0x92, 0x71, 0x5a,
+    0x8e, 0x6f, 0x4d, 0x77, 0xf0, 0x56, 0xec, 0x5e, 0x54, 0x6a, 0x0c, 0x5b, 0x2f, 0x03, 0x18, 0x9f,
+    0x37, 0x82, 0x17, 0x08, 0x2d, 0x25, 0x87, 0xdc, 0xfa, 0xfa, 0xc1, 0xdb, 0x59, 0x30, 0x78, 0x7e,
+    0x7c, 0x45, 0xbb, 0xfb, 0x2c, 0xdd, 0x6d, 0xb4, 0x1c, 0xcd, 0xfd, 0xb0, 0x0e, 0x47, 0x20, 0x83,
+    0xae, 0xfd, 0xcf, 0xd1, 0x67, 0x01, 0x49, 0xef, 0xb6, 0xde, 0x6f, 0xdb, 0x29, 0xac, 0xca, 0x56,
+    0x69, 0xe6, 0x58, 0xbc, 0xaf, 0xcc, 0x67, 0x2b, 0x3b, 0xa8, 0x9d, 0x45, 0xaa, 0xf5, 0x8f, 0xb5,
+    0xcd, 0x47, 0x5a, 0xcf, 0xb4, 0x56, 0x80, 0xe8, 0xf2, 0xfd, 0xd5, 0x76, 0x23, 0x1f, 0xd0, 0x47,
+    0xdb, 0x6c, 0x18, 0x3d, 0x62, 0xe1, 0x04, 0x34, 0xda, 0x21, 0x50, 0xd8, 0x88, 0x11, 0x65, 0x10,
+    0xc8, 0xed, 0x4e, 0xcb, 0x08, 0xf4, 0xe0, 0x2a, 0x33, 0xba, 0xc0, 0x54, 0x31, 0x2c, 0x13, 0x28,
+    0xce, 0x0f, 0x4d, 0x5b, 0x37, 0x02, 0x23, 0xbe, 0xd2, 0x1e, 0xe8, 0xed, 0x99, 0x71, 0x0e, 0x46,
+    0x0b, 0x73, 0xef, 0x3a, 0xb8, 0x84, 0x62, 0x17, 0x61, 0x75, 0xa1, 0xdb, 0x41, 0xda, 0x79, 0x8c,
+    0xf8, 0x6e, 0x25, 0xa2, 0xd3, 0xe3, 0x85, 0x33, 0xdb, 0x7f, 0xf8, 0xaa, 0x89, 0x67, 0x9d, 0xec,
+    0x27, 0x55, 0x07, 0x5e, 0x86, 0x6f, 0xf0, 0xb6, 0xc4, 0x03, 0x30, 0xe6, 0x60, 0x58, 0x4f, 0xd8,
+    0x6b, 0x66, 0x64, 0xa7, 0x7a, 0xa7, 0x6d, 0xd5, 0xe9, 0x58, 0x3b, 0xf1, 0xae, 0x4b, 0x22, 0x12,
+    0x54, 0x55, 0x9a, 0x3b, 0xa8, 0x4d, 0x22, 0xf0, 0xac, 0x97, 0xfe, 0xa5, 0x37, 0xbc, 0xdd, 0xc1,
+    0xf7, 0x34, 0x46, 0x22, 0x18, 0x92, 0x45, 0x14, 0x8e, 0xd1, 0x3b, 0xc3, 0xb6, 0xef, 0x1e, 0x95,
+    0x09, 0x7f, 0x61, 0x6f, 0x69, 0x05, 0x6a, 0x31, 0xca, 0xb8, 0x9b, 0x26, 0x68, 0xb1, 0xa3, 0xaa,
+    0x87, 0xca, 0xb5, 0xd7, 0x0c, 0x46, 0x54, 0xfb, 0x08, 0x46, 0x9a, 0xe8, 0xa2, 0x05, 0x6b, 0xac,
+    0x72, 0x93, 0xa6, 0xf0, 0x1a, 0x21, 0x03, 0xb6, 0x71, 0x61, 0x84, 0x09, 0x3b, 0xa2, 0x90, 0xb7,
+    0x8a, 0xfd, 0x0f, 0x62, 0x6e, 0xe2, 0xd2, 0xd8, 0x11, 0x78, 0x02, 0x45, 0xd8, 0xa0, 0x51, 0xf7,
+    0xa5, 0xfa, 0x34, 0xea, 0xc4, 0x0c, 0x1e, 0x3f, 0xda, 0x90, 0xc7, 0x71, 0xac, 0xc5, 0xfb, 0xcf,
+    0x8e, 0x4e, 0x0e, 0x8f, 0xce, 0x76, 0x30, 0xbd, 0x77, 0x7d, 0xd6, 0xaf, 0x4c, 0x9c, 0x99, 0x68,
+    0x52, 0x88, 0xdc, 0xe5, 0x5c, 0xe0, 0x46, 0x47, 0x2f, 0xdd, 0x8d, 0xa3, 0x08, 0xfe, 0xca, 0x63,
+    0xe8, 0xab, 0x71, 0xd3, 0x70, 0x25, 0xb9, 0x02, 0xe9, 0x03, 0x9d, 0xaa, 0xda, 0x91, 0x4c, 0x58,
+    0xa6, 0x76, 0x11, 0xbd, 0x73, 0xdd, 0xb2, 0x75, 0x29, 0x74, 0x7a, 0x7c, 0x2f, 0x26, 0x55, 0x6c,
+    0xf6, 0xa2, 0x56, 0x29, 0xba, 0xfa, 0x8c, 0x38, 0xe4, 0x7b, 0xf2, 0x81, 0x1d, 0x55, 0xcd, 0x55,
+    0x2e, 0x68, 0x53, 0x9c, 0x9d, 0xfc, 0xf8, 0x8e, 0x17, 0xbc, 0xe7, 0xaa, 0xd6, 0x07, 0xb2, 0xa3,
+    0x64, 0xc8, 0x58, 0x52, 0x3c, 0xf4, 0x24, 0x0f, 0x04, 0x45, 0xbb, 0xf8, 0xf8, 0x4e, 0x5b, 0xab,
+    0x7b, 0x69, 0xcf, 0xbe, 0x87, 0x7e, 0x0d, 0xf1, 0x72, 0xa7, 0x0a, 0x05, 0x7d, 0xaf, 0x9c, 0x4c,
+    0xac, 0xac, 0xfb, 0xca, 0xe3, 0x3b, 0x5e, 0xe1, 0xbe, 0x62, 0x9e, 0x51, 0x2c, 0x5e, 0xc1, 0xc8,
+    0xef, 0x2d, 0xe7, 0x26, 0xf3, 0xd7, 0x34, 0x61, 0xf3, 0xde, 0x76, 0xf6, 0xf6, 0xe3, 0x3b, 0x3a,
+    0xda, 0xfb, 0xfc, 0x63, 0x95, 0xb3, 0x59, 0x2e, 0x95, 0x42, 0x73, 0x4b, 0xf0, 0xcf, 0x92, 0xd4,
+    0x53, 0x2c, 0x15, 0x70, 0x5c, 0x06, 0x0d, 0x50, 0xf2, 0xc2, 0xe7, 0x6b, 0x41, 0x60, 0x8a, 0x56,
+    0x7a, 0xe1, 0x8f, 0x00, 0xc4, 0x54, 0xaf, 0x27, 0xa4, 0xe2, 0x3a, 0x95, 0x72, 0x00, 0xd1, 0x32,
+    0xcd, 0x46, 0x4f, 0x20, 0x2c, 0x1a, 0xd6, 0xbf, 0xae, 0xb0, 0x53, 0x87, 0xc6, 0x63, 0xf4, 0xa0,
+    0x2c, 0x6e, 0x65, 0x57, 0xa9, 0x83, 0xa7, 0xc6, 0x5c, 0x00, 0xef, 0x02, 0xdc, 0x16, 0x7e, 0x4f,
+    0xdd, 0x00, 0x4a, 0x4e, 0x91, 0xe5, 0x9c, 0x77, 0x7e, 0x6b, 0x26, 0xcc, 0x3c, 0xa3, 0x7c, 0x4d,
+    0x12, 0x7e, 0x8f, 0x91, 0xad, 0xec, 0x77, 0x96, 0xe4, 0x14, 0x51, 0x8a, 0x24, 0x97, 0xa1, 0xb6,
+    0xcc, 0xb1, 0xe7, 0xac, 0x29, 0x7e, 0x2a, 0x3c, 0xbf, 0xf2, 0x40, 0xb9, 0x53, 0xe9, 0xf1, 0xdd,
+    0x88, 0xe1, 0xf7, 0xde, 0x75, 0x70, 0x39, 0x8d, 0x18, 0x99, 0xae, 0xb8, 0xb2, 0x21, 0x85, 0x9b,
+    0xb9, 0x6f, 0x23, 0xbf, 0x28, 0x3b, 0x5f, 0x1e, 0x9b, 0xc0, 0x6f, 0xf7, 0xb6, 0x73, 0xc4, 0x73,
+    0x6a, 0xe2, 0x75, 0x1b, 0xb4, 0x22, 0x7c, 0xb9, 0x5f, 0x75, 0x54, 0x3b, 0xc9, 0x47, 0xab, 0xc6,
+    0x45, 0x68, 0x03, 0xf4, 0xc4, 0x9d, 0x8d, 0x67, 0x7f, 0xfd, 0x4f, 0xff, 0x2c, 0x4c, 0x35, 0x86,
+    0xf1, 0x47, 0x79, 0x87, 0x73, 0x7f, 0x28, 0xb7, 0xc0, 0x52, 0x85, 0xc1, 0x58, 0x62, 0x78, 0xcc,
+    0x7a, 0x91, 0x7d, 0xa6, 0x9c, 0xc6, 0x6e, 0x1a, 0x76, 0x78, 0x9f, 0x52, 0x41, 0x4d, 0x79, 0x74,
+    0x7a, 0x5a, 0x0f, 0xa1, 0xe8, 0x66, 0x91, 0x02, 0x9e, 0x54, 0x60, 0x49, 0x55, 0x75, 0x2d, 0x08,
+    0x70, 0xc4, 0x43, 0x43, 0x29, 0x1e, 0x30, 0x53, 0x6b, 0x01, 0x54, 0xa8, 0x03, 0x54, 0x57, 0xc3,
+    0x87, 0xd5, 0xa6, 0xf0, 0xe3, 0xbb, 0x4c, 0x1b, 0x67, 0x6f, 0x4e, 0x4e, 0x8e, 0x4f, 0x7e, 0xa0,
+    0x6d, 0x9c, 0x5f, 0xbc, 0x3e, 0x3d, 0x3d, 0x3a, 0xac, 0x48, 0x06, 0x2e, 0x2f, 0x46, 0x4c, 0xe6,
+    0x7a, 0xdf, 0xe5, 0x00, 0xd7, 0xef, 0xb9, 0x7d, 0x92, 0x30, 0x64, 0xae, 0x8c, 0x0d, 0xa2, 0x1e,
+    0xb7, 0x9e, 0xe1, 0x2a, 0xe8, 0xc5, 0xc6, 0x0c, 0xa5, 0x2a, 0x2a, 0x64, 0x2f, 0xf1, 0xe8, 0x5e,
+    0x0a, 0x57, 0x24, 0x92, 0x3c, 0x24, 0x63, 0x4b, 0xe8, 0x06, 0xa7, 0xfb, 0x3f, 0x1c, 0x9d, 0x3f,
+    0x54, 0x3b, 0x60, 0xc7, 0x61, 0x1c, 0x78, 0xd1, 0x08, 0x83, 0xce, 0x31, 0x20, 0x04, 0xa4, 0x58,
+    0x86, 0x1a, 0x51, 0xab, 0xa4, 0x29, 0xc2, 0x46, 0x4e, 0xa9, 0x17, 0x21, 0xad, 0x2d, 0x40, 0xfc,
+    0xf6, 0x1d, 0x74, 0x05, 0x2c, 0xc8, 0x53, 0xd2, 0x32, 0x36, 0xa1, 0x99, 0x2b, 0xfc, 0x03, 0x26,
+    0xd0, 0xa5, 0xcb, 0x0c, 0xa3, 0x7f, 0x62, 0x1a, 0xef, 0x23, 0x69, 0x46, 0xcb, 0x1a, 0xbe, 0xc2,
+    0x1c, 0x59, 0x1e, 0xb1, 0x5e, 0x2e, 0x0f, 0x13, 0xef, 0x6b, 0xcd, 0xbf, 0xd1, 0x87, 0x5d, 0x51,
+    0x9b, 0xb9, 0x28, 0x45, 0x94, 0x2b, 0xba, 0x2d, 0x83, 0xd7, 0x15, 0x6c, 0x29, 0xce, 0x65, 0x4b,
+    0xd6, 0x6a, 0x78, 0xf6, 0x0b, 0xab, 0x86, 0xdf, 0xac, 0xdc, 0xac, 0x98, 0xc1, 0x71, 0x38, 0xfc,
+    0x4e, 0xf0, 0xc7, 0x77, 0x14, 0xe7, 0xdf, 0xb3, 0x03, 0x79, 0x28, 0x0d, 0x87, 0x57, 0xc0, 0xf9,
+    0x9f, 0xad, 0x66, 0x77, 0x16, 0xa0, 0xfc, 0x46, 0x1e, 0xed, 0x86, 0x1b, 0xec, 0x2a, 0xcf, 0x4d,
+    0xa4, 0xdd, 0xa6, 0x65, 0x80, 0x66, 0x5f, 0xe0, 0x8d, 0x7b, 0x55, 0x0c, 0x28, 0x64, 0x7b, 0x07,
+    0xb5, 0x7b, 0x8d, 0x4d, 0x72, 0x88, 0x78, 0xd4, 0x10, 0xab, 0x87, 0xdf, 0xc4, 0x62, 0x2d, 0xd3,
+    0x17, 0x7a, 0x7d, 0x96, 0xfd, 0x39, 0xbd, 0xef, 0x5e, 0x76, 0x93, 0xdd, 0x70, 0xf6, 0xf8, 0x4e,
+    0x66, 0x2b, 0xe3, 0x71, 0xca, 0x8b, 0xda, 0xfd, 0x37, 0xbb, 0x9a, 0xbc, 0x4a, 0x47, 0xc1, 0xb9,
+    0x4c, 0x89, 0x3e, 0xd0, 0xa4, 0xe1, 0x8d, 0x94, 0x21, 0x21, 0x78, 0x39, 0x86, 0xf4, 0xa1, 0xf7,
+    0x11, 0x13, 0x45, 0x57, 0x0c, 0x11, 0x33, 0x3c, 0xe9, 0x62, 0xc2, 0xc9, 0xc2, 0x89, 0xb2, 0xe4,
+    0x83, 0x73, 0x2a, 0x67, 0xb9, 0xe0, 0xf7, 0x65, 0x92, 0x39, 0x8d, 0xd5, 0x8b, 0x67, 0xf9, 0xac,
+    0xa9, 0xdc, 0xc7, 0x01, 0xee, 0x9e, 0x6b, 0x1b, 0x2f, 0xfa, 0xd9, 0x00, 0x7a, 0x69, 0x28, 0xc8,
+    0x19, 0xab, 0x71, 0xc2, 0xfd, 0xbb, 0x38, 0xb0, 0x94, 0x3d, 0xe0, 0xee, 0x2f, 0x6c, 0x05, 0x37,
+    0xd3, 0x70, 0xf0, 0x9a, 0x6b, 0x0e, 0x10, 0xc1, 0xdf, 0xb5, 0xd3, 0x77, 0x78, 0x7d, 0xab, 0xf2,
+    0xa6, 0x93, 0xbe, 0x19, 0xe0, 0xfa, 0xa7, 0x64, 0x6e, 0xf7, 0xa7, 0xc9, 0x23, 0xe4, 0xe5, 0xf1,
+    0xf1, 0xda, 0x71, 0xf2, 0xfa, 0xd0, 0x34, 0x13, 0x06, 0x2d, 0x18, 0x54, 0xd7, 0x6b, 0xcd, 0x08,
+    0x63, 0x1e, 0xd0, 0x38, 0xe6, 0x56, 0xb1, 0x53, 0x27, 0x9d, 0x72, 0x3c, 0x27, 0xbd, 0x42, 0x33,
+    0xcb, 0x79, 0x38, 0xb5, 0x8a, 0x7b, 0xf0, 0xe8, 0xb5, 0x86, 0xe6, 0xf5, 0xe4, 0xfa, 0xed, 0xe4,
+    0xea, 0x3d, 0x7f, 0xfc, 0x9a, 0x3f, 0xfd, 0x3a, 0x64, 0xbc, 0xce, 0xb3, 0x40, 0x89, 0x62, 0x77,
+    0xfc, 0xc9, 0x75, 0x82, 0x2d, 0xee, 0x64, 0xf3, 0xb9, 0x79, 0xd4, 0x25, 0x4d, 0xb7, 0x41, 0x75,
+    0xf4, 0x4a, 0x57, 0x43, 0x4b, 0xb1, 0x56, 0x5b, 0x21, 0x00, 0x28, 0xee, 0x05, 0x7b, 0x7c, 0x77,
+    0x25, 0xcd, 0x14, 0x0b, 0x97, 0xb4, 0xd5, 0x64, 0x9b, 0x87, 0x58, 0x11, 0x8f, 0x28, 0xc3, 0xf9,
+    0xc7, 0xbf, 0x42, 0xaf, 0xa5, 0x10, 0x69, 0x11, 0x9d, 0xe9, 0x60, 0x4d, 0xc1, 0x71, 0xae, 0x8a,
+    0x97, 0x63, 0x2e, 0xaf, 0xd5, 0x74, 0xb5, 0xfb, 0x75, 0x38, 0x33, 0x45, 0x8b, 0xce, 0x95, 0x5a,
+    0x78, 0x35, 0xf6, 0x2e, 0xbd, 0x1e, 0x8c, 0xce, 0xa6, 0x31, 0x8f, 0xf4, 0x22, 0x4c, 0x5a, 0x44,
+    0x5c, 0x0b, 0x89, 0x3f, 0x0a, 0xef, 0x6a, 0x52, 0xd0, 0x2a, 0x2e, 0xa9, 0xc8, 0x17, 0x3d, 0x26,
+    0x23, 0x17, 0x0b, 0xf2, 0x7e, 0x57, 0xbd, 0x00, 0x1a, 0xef, 0x7f, 0x4e, 0xef, 0x89, 0x6e, 0x75,
+    0xb1, 0x07, 0xac, 0xf0, 0x49, 0x9e, 0xc2, 0xbd, 0xa6, 0x70, 0x51, 0x2e, 0x28, 0xdf, 0x78, 0x86,
+    0xdb, 0x41, 0xfc, 0x38, 0xf9, 0xb8, 0xb0, 0x1e, 0xbb, 0xb1, 0x33, 0x63, 0x14, 0xab, 0xdb, 0xcd,
+    0x94, 0x62, 0x63, 0x1a, 0xf9, 0x6c, 0xd1, 0x5e, 0x68, 0xae, 0xa6, 0x7d, 0x32, 0xd7, 0xee, 0x30,
+    0xe7, 0x27, 0x55, 0x68, 0x5f, 0x30, 0x17, 0xee, 0xeb, 0xb8, 0xaf, 0x15, 0x02, 0xd3, 0xa8, 0x42,
+    0x4c, 0xb3, 0xb3, 0x2b, 0xaf, 0x7a, 0x66, 0x37, 0x3d, 0x67, 0x47, 0x69, 0xb4, 0x92, 0xb2, 0x4f,
+    0x75, 0x66, 0x25, 0xd9, 0xf4, 0xac, 0x64, 0xa6, 0xde, 0x51, 0xc7, 0xf8, 0xad, 0x3a, 0xd1, 0x1d,
+    0x9c, 0xe8, 0x93, 0x90, 0x30, 0xbe, 0xc7, 0x7d, 0x6e, 0x6c, 0x2c, 0xb0, 0xd0, 0xf4, 0xdc, 0x03,
+    0xd9, 0x1b, 0x44, 0xb8, 0x67, 0x63, 0x11, 0xda, 0x6d, 0x9d, 0x58, 0xb6, 0x81, 0x01, 0x4a, 0x8f,
+    0xef, 0xb8, 0x67, 0x88, 0xf9, 0x43, 0xae, 0x52, 0xdb, 0xf4, 0x59, 0x21, 0x8b, 0x61, 0x10, 0x70,
+    0x07, 0x06, 0x21, 0xc4, 0xfe, 0xf5, 0xfd, 0x46, 0xee, 0x1a, 0xce, 0x54, 0x9b, 0xc5, 0x97, 0x48,
+    0xc1, 0x5e, 0x13, 0xbe, 0xdc, 0x97, 0xae, 0x85, 0xea, 0x3a, 0xab, 0x86, 0xdf, 0x72, 0x14, 0xba,
+    0xec, 0xc3, 0x0f, 0xa5, 0x08, 0xac, 0xbc, 0x08, 0xe7, 0x2b, 0xa3, 0xb4, 0x14, 0x17, 0x02, 0x29,
+    0x4f, 0x0e, 0x7d, 0x00, 0xa3, 0xc7, 0xbe, 0x64, 0x4c, 0xdf, 0x5a, 0x56, 0xab, 0x5f, 0x53, 0x65,
+    0x5f, 0xe9, 0x36, 0xc3, 0xb5, 0x80, 0xa9, 0x6c, 0xa3, 0xc6, 0xf4, 0x52, 0xae, 0x09, 0x43, 0xa6,
+    0xf5, 0xec, 0x32, 0xed, 0x4b, 0x88, 0xcf, 0x5e, 0x0e, 0xaf, 0xcd, 0xa1, 0x16, 0x21, 0x47, 0xd3,
+    0x15, 0x84, 0x17, 0xbd, 0x1b, 0x9c, 0x74, 0x95, 0x49, 0x90, 0x0b, 0xab, 0x0d, 0xb0, 0x72, 0xee,
+    0x94, 0x64, 0x6d, 0x8c, 0x41, 0x8d, 0x99, 0xde, 0xf2, 0xb7, 0xf4, 0xc9, 0x2c, 0x9c, 0x87, 0xb5,
+    0x62, 0x63, 0x22, 0x47, 0xc4, 0xad, 0xad, 0xfb, 0x73, 0xd4, 0xed, 0x38, 0x5f, 0xd0, 0x08, 0x28,
+    0x6b, 0xfa, 0xd0, 0x5b, 0x76, 0x79, 0x3f, 0xf9, 0xbd, 0xf7, 0x54, 0x86, 0xea, 0xb3, 0xdb, 0xc7,
+    0xc9, 0xfd, 0x2d, 0xed, 0x87, 0xd5, 0x16, 0xc4, 0x2b, 0x3c, 0x7c, 0x56, 0x98, 0x11, 0x59, 0x8b,
+    0x81, 0x95, 0xc1, 0x83, 0x69, 0xcb, 0x5b, 0x15, 0x28, 0x2a, 0xca, 0x1b, 0x12, 0xa5, 0x1c, 0xc0,
+    0xe8, 0x31, 0xe5, 0x52, 0xa0, 0x88, 0x4f, 0x31, 0x79, 0xb0, 0xa6, 0xb1, 0xf1, 0x49, 0x8a, 0xb9,
+    0xb9, 0xe3, 0x33, 0x95, 0xa0, 0xde, 0xe1, 0x39, 0x54, 0x02, 0xf4, 0xfb, 0x54, 0x81, 0xa7, 0x97,
+    0x60, 0xbd, 0x0a, 0x59, 0x4c, 0x21, 0xfa, 0x5d, 0x68, 0x2e, 0x61, 0xce, 0xde, 0x86, 0x04, 0x58,
+    0x6a, 0x67, 0xe3, 0xff, 0x45, 0xe3, 0xe9, 0xef, 0xca, 0xb6, 0x29, 0x96, 0x03, 0x19, 0x4e, 0xc9,
+    0xae, 0x3a, 0xf3, 0xa2, 0xdb, 0xac, 0x8a, 0x03, 0x22, 0x5d, 0x4e, 0x2d, 0x57, 0xd9, 0x34, 0x9d,
+    0x27, 0xfb, 0x9e, 0x06, 0xc2, 0xb5, 0xa8, 0x47, 0x9d, 0xab, 0x2b, 0xa8, 0xf8, 0x89, 0x2d, 0x23,
+    0x46, 0x33, 0xf3, 0xf0, 0x66, 0xea, 0x8f, 0x2e, 0x01, 0xd9, 0x79, 0x9c, 0xc0, 0xd0, 0xd1, 0xa0,
+    0x2f, 0x04, 0x2d, 0xb6, 0xdd, 0x01, 0x4d, 0xf8, 0x6a, 0xe0, 0x29, 0x55, 0xcb, 0x18, 0x1f, 0xef,
+    0x1a, 0x62, 0x40, 0x15, 0x29, 0x3d, 0x50, 0xce, 0x2d, 0xfa, 0xbb, 0xce, 0x9a, 0xe4, 0x73, 0xd7,
+    0x05, 0xb3, 0x80, 0x3a, 0x38, 0x29, 0x13, 0xc9, 0x55, 0xe1, 0xbf, 0x84, 0xc6, 0x9a, 0x41, 0x62,
+    0xa1, 0xc6, 0xea, 0x76, 0x4a, 0x6a, 0xac, 0x59, 0x15, 0x95, 0x9e, 0x79, 0xcf, 0xdc, 0xb8, 0x18,
+    0xcd, 0x82, 0xb7, 0xba, 0xcd, 0x2f, 0xc9, 0x9c, 0x5e, 0xae, 0x37, 0xbd, 0xb5, 0x2b, 0xb0, 0x69,
+    0xe7, 0xe8, 0x96, 0x8b, 0x27, 0xc2, 0x63, 0xff, 0xbe, 0xb4, 0xd8, 0x62, 0x4b, 0x3d, 0x5f, 0xd9,
+    0xb5, 0xab, 0x52, 0x82, 0xf8, 0x8b, 0xd4, 0xe0, 0x87, 0x2a, 0xc2, 0x39, 0x7a, 0x85, 0xb8, 0x1c,
+    0x58, 0x83, 0xc7, 0xf6, 0x6c, 0x53, 0x0c, 0xf0, 0x6f, 0x7a, 0x20, 0xc2, 0xbd, 0xfd, 0xf6, 0x60,
+    0x24, 0xac, 0xaf, 0x52, 0xe4, 0x7f, 0x30, 0x76, 0xc5, 0xe0, 0xb9, 0x71, 0xeb, 0xab, 0xba, 0xf5,
+    0x5e, 0x31, 0x14, 0xd6, 0x4a, 0xfd, 0xf1, 0x5d, 0x70, 0x0f, 0x14, 0xb5, 0x7f, 0xf0, 0x7b, 0xb9,
+    0x41, 0xf3, 0xc1, 0xd8, 0xb9, 0xf9, 0x0d, 0x14, 0x7d, 0xb5, 0x8f, 0x28, 0x2f, 0xe9, 0x01, 0x90,
+    0xc1, 0xe8, 0xa3, 0x29, 0x4b, 0x39, 0xd5, 0x9b, 0xa2, 0x92, 0x57, 0x59, 0xe9, 0xbe, 0xd2, 0x22,
+    0x1d, 0xe8, 0xcb, 0x77, 0xd0, 0xc8, 0xfb, 0x1a, 0x51, 0x7e, 0x94, 0x8a, 0x7a, 0xb0, 0x89, 0x7f,
+    0x76, 0x28, 0xf2, 0x9a, 0xe2, 0xff, 0x5a, 0x6c, 0xa7, 0xb2, 0x48, 0xe0, 0x5d, 0x25, 0x5f, 0x6d,
+    0x98, 0xc6, 0xd3, 0x55, 0x64, 0x22, 0x0f, 0xf6, 0xfc, 0x9a, 0xea, 0xb6, 0x6c, 0xa3, 0x1f, 0x33,
+    0x56, 0x8d, 0x83, 0x51, 0x78, 0xa5, 0x0f, 0xb9, 0xa6, 0xfc, 0x65, 0x7a, 0xe3, 0x6d, 0x81, 0xb2,
+    0x76, 0x29, 0x9c, 0x2a, 0xf4, 0x22, 0x33, 0x9a, 0x7b, 0xea, 0x47, 0x2b, 0x55, 0xbc, 0x4b, 0xae,
+    0x35, 0x03, 0x49, 0xf3, 0x8d, 0x9b, 0xeb, 0xa6, 0xcc, 0x5d, 0xad, 0xc1, 0xd7, 0xd1, 0x39, 0x26,
+    0x87, 0x57, 0x3b, 0x75, 0x52, 0x71, 0x2a, 0xb5, 0x35, 0xf9, 0x30, 0x88, 0x97, 0x06, 0xfa, 0x40,
+    0x32, 0x9c, 0xd6, 0xd8, 0x4b, 0xbe, 0xa6, 0xd1, 0xec, 0x62, 0x33, 0xf9, 0xaa, 0x0e, 0x8b, 0xe1,
+    0xfd, 0x4a, 0xe6, 0x86, 0xc0, 0x51, 0xfc, 0xae, 0xe0, 0x60, 0x18, 0xd0, 0xf2, 0xf8, 0x2e, 0xa4,
+    0x3b, 0x0c, 0x78, 0x9c, 0x2c, 0xcd, 0xef, 0xa4, 0xbb, 0x0c, 0xe3, 0x71, 0xa5, 0x9c, 0x4d, 0x8e,
+    0x2d, 0xa5, 0x8e, 0xc0, 0xcf, 0x6c, 0x57, 0xdb, 0x0c, 0x36, 0x7b, 0xe3, 0x82, 0x47, 0xe6, 0x3a,
+    0xe3, 0x84, 0xe2, 0x41, 0x3d, 0x70, 0xa0, 0x96, 0x21, 0x8f, 0x28, 0x9e, 0x7f, 0x0c, 0xc2, 0x6f,
+    0x4c, 0x33, 0x17, 0x78, 0xe7, 0x94, 0xf3, 0x66, 0x0b, 0x40, 0xe5, 0x75, 0x33, 0x8d, 0xdd, 0x67,
+    0x44, 0x8d, 0x09, 0xb2, 0x1c, 0xbd, 0x11, 0x17, 0x2c, 0x45, 0xc8, 0x5d, 0x03, 0x32, 0x4f, 0xc2,
+    0xe5, 0xc0, 0xc5, 0xaf, 0xcf, 0x07, 0x9f, 0x53, 0x43, 0x79, 0xd2, 0x58, 0x45, 0xff, 0x1f, 0x2c,
+    0x01, 0xe4, 0xda, 0xfa, 0xe7, 0xa9, 0xea, 0x5f, 0x98, 0x07, 0xb0, 0xab, 0xc2, 0x30, 0x8b, 0xa2,
+    0x2c, 0x07, 0xa0, 0xe8, 0x91, 0xb9, 0x17, 0x54, 0x7d, 0xa4, 0x19, 0xcf, 0x88, 0x1b, 0x76, 0xfe,
+    0x5e, 0xea, 0xb9, 0x56, 0x0a, 0x96, 0x65, 0x08, 0x79, 0xa4, 0xbb, 0x51, 0x48, 0xf8, 0xb4, 0x53,
+    0xea, 0xcd, 0x5c, 0x39, 0x33, 0xa5, 0x1b, 0xc2, 0x2e, 0x3a, 0x35, 0xb8, 0x59, 0x4d, 0xbf, 0x0b,
+    0xcb, 0x9f, 0x78, 0xcb, 0x24, 0xdc, 0x58, 0x65, 0xf7, 0x66, 0x17, 0x1c, 0x5f, 0x5e, 0x49, 0xb8,
+    0x60, 0x36, 0x79, 0x7a, 0x6f, 0xcb, 0x7a, 0xec, 0x90, 0xba, 0x83, 0x5d, 0x09, 0xf6, 0xd2, 0x5b,
+    0xe4, 0x1a, 0x09, 0xbc, 0x46, 0x10, 0x36, 0x40, 0xa5, 0xf0, 0xa7, 0x1b, 0x45, 0xce, 0x71, 0x45,
+    0xf7, 0x6e, 0xd9, 0x5c, 0x30, 0xa3, 0x60, 0x06, 0x1a, 0x03, 0xbb, 0x4f, 0x70, 0xa5, 0xa7, 0x3d,
+    0x05, 0xe6, 0xba, 0x59, 0xdf, 0x10, 0x07, 0xce, 0x2f, 0x1e, 0x5c, 0xe1, 0xd5, 0x71, 0x9b, 0xdd,
+    0x7f, 0xfd, 0x97, 0x83, 0xf5, 0x9d, 0x24, 0x9f, 0x71, 0xd0, 0x2c, 0xc1, 0xfd, 0x33, 0x0d, 0x9a,
+    0x5d, 0x86, 0xb4, 0x62, 0xd0, 0xfd, 0xa6, 0x5b, 0x72, 0xd0, 0xeb, 0x72, 0x8e, 0xf4, 0x64, 0x8b,
+    0xf5, 0x98, 0xc7, 0x25, 0xde, 0x96, 0x96, 0x73, 0x94, 0x33, 0x3f, 0xcc, 0x59, 0x3b, 0xb6, 0xb9,
+    0xe5, 0x38, 0xa4, 0xe7, 0xc8, 0x0b, 0x3d, 0x5a, 0x1d, 0xe5, 0x46, 0x8f, 0x7e, 0x3f, 0x3b, 0x29,
+    0xf2, 0x4a, 0x03, 0x4c, 0xc5, 0xeb, 0x76, 0xc9, 0x3e, 0xe9, 0x38, 0xf8, 0x7f, 0x76, 0xb0, 0xfc,
+    0x36, 0x3e, 0xb3, 0x9f, 0x18, 0xfc, 0xb5, 0xeb, 0xb9, 0xa3, 0x76, 0xd7, 0x3c, 0x30, 0xb8, 0xaf,
+    0x1d, 0x17, 0x3c, 0xf4, 0x16, 0xd6, 0xd3, 0x82, 0x3f, 0xb1, 0x69, 0x76, 0x13, 0x9e, 0xd9, 0x74,
+    0x2f, 0xaf, 0x69, 0xf1, 0x78, 0xe4, 0xc5, 0x13, 0x0f, 0x93, 0x36, 0xf1, 0x56, 0x87, 0x9e, 0xf6,
+    0x58, 0x1c, 0x00, 0xfd, 0xf8, 0x0e, 0xde, 0xe0, 0xd9, 0xdd, 0xa0, 0x48, 0x89, 0xeb, 0x77, 0x36,
+    0xc1, 0x6c, 0xa6, 0x87, 0xcb, 0xbb, 0xbd, 0x7b, 0xcb, 0x30, 0x94, 0x3b, 0x23, 0xba, 0x0e, 0xbb,
+    0x33, 0xa2, 0xcb, 0xee, 0x8c, 0x90, 0x97, 0x50, 0x7c, 0x3d, 0x6e, 0x8d, 0xbb, 0xe3, 0x6d, 0x4b,
+    0x65, 0xa4, 0x76, 0xc2, 0x6b, 0x42, 0xc5, 0x0e, 0x54, 0x64, 0x5c, 0x76, 0x3e, 0x9c, 0xe0, 0xf1,
+    0xd3, 0x33, 0xb0, 0x75, 0xa7, 0xbe, 0x84, 0x23, 0x06, 0x2e, 0x49, 0x9e, 0xdd, 0x4f, 0xa1, 0x90,
+    0xfc, 0xde, 0xc6, 0x20, 0x9c, 0x8e, 0xf8, 0x23, 0x46, 0xe7, 0x7b, 0x1b, 0xbf, 0xf3, 0x93, 0xe7,
+    0x11, 0xd0, 0x4f, 0x4c, 0x5e, 0x01, 0x9d, 0x33, 0x21, 0x20, 0x86, 0x27, 0xbd, 0xa8, 0x2d, 0xd4,
+    0x0f, 0xb1, 0x71, 0x93, 0xf2, 0xb5, 0x83, 0x9d, 0xed, 0xf4, 0x29, 0x94, 0x57, 0x81, 0xb2, 0xea,
+    0xc0, 0x8b, 0x6a, 0x6b, 0xb2, 0xd7, 0xff, 0x4f, 0xe8, 0xd9, 0xa6, 0xd9, 0x15, 0x8b, 0x5f, 0x94,
+    0xd0, 0x81, 0xd2, 0xf9, 0x69, 0x2f, 0x78, 0x24, 0xbd, 0x53, 0xa3, 0x49, 0xb9, 0xce, 0xdf, 0x09,
+    0xbd, 0x8b, 0xf1, 0x7f, 0x06, 0x7a, 0xe7, 0x83, 0x94, 0xe4, 0xee, 0x7c, 0x3a, 0xb9, 0x8b, 0x8b,
+    0x32, 0x49, 0x15, 0x84, 0x46, 0xed, 0x81, 0xc6, 0x95, 0xd4, 0x27, 0x50, 0xbd, 0xc0, 0xdb, 0xcb,
+    0x30, 0x95, 0x0b, 0x4f, 0x9f, 0x5f, 0xce, 0xe6, 0xf1, 0x4e, 0xe4, 0x2f, 0x7c, 0x2f, 0xa9, 0xba,
+    0xf5, 0xd6, 0x38, 0xaa, 0x7d, 0x59, 0x43, 0x4c, 0xf5, 0xfe, 0x80, 0x00, 0x8e, 0xd8, 0x26, 0xf4,
+    0x4e, 0x14, 0xde, 0xec, 0x52, 0x5d, 0xc7, 0x16, 0x19, 0x90, 0x6b, 0xac, 0x61, 0x18, 0x07, 0xca,
+    0x3d, 0x7a, 0xdf, 0x61, 0xc6, 0xbc, 0x10, 0x3a, 0x60, 0x2d, 0x4f, 0x09, 0x44, 0xc7, 0xa9, 0x50,
+    0x02, 0x99, 0x13, 0x75, 0x2d, 0x43, 0x4f, 0x57, 0xfd, 0x76, 0x1c, 0xe6, 0xe8, 0x4b, 0x22, 0x6f,
+    0x1e, 0xe3, 0xa9, 0x36, 0x3b, 0xb0, 0x64, 0x82, 0x04, 0x14, 0xd9, 0x5f, 0xfd, 0x2f, 0x67, 0x13,
+    0xda, 0xb4, 0xff, 0xcc, 0xb6, 0x39, 0xe0, 0x14, 0xd6, 0x5c, 0xa1, 0x12, 0x99, 0x5a, 0xf9, 0x39,
+    0xfa, 0x8e, 0xf0, 0xce, 0x52, 0xfb, 0x28, 0xe1, 0xfa, 0x06, 0x3d, 0xe0, 0x08, 0xd1, 0x2e, 0xae,
+    0x1e, 0x24, 0xf4, 0x4e, 0x44, 0x6f, 0x38, 0x6c, 0x75, 0x85, 0x19, 0x40, 0x8b, 0xdf, 0x7f, 0xb2,
+    0x66, 0xc3, 0x4e, 0xe9, 0x5a, 0x4f, 0xab, 0xc9, 0x51, 0x12, 0x8d, 0x22, 0x3c, 0xfe, 0xe1, 0xf0,
+    0x98, 0x78, 0xa4, 0xda, 0x74, 0x1a, 0xcd, 0xad, 0xda, 0x6a, 0xe5, 0x13, 0xe8, 0xd5, 0x12, 0x63,
+    0x74, 0xdd, 0x1c, 0x05, 0xfb, 0x6c, 0x61, 0xe0, 0xb1, 0xb4, 0x76, 0xe7, 0x6b, 0x06, 0xd6, 0x20,
+    0x48, 0x56, 0x7a, 0x41, 0xa1, 0xd8, 0x03, 0x9d, 0x14, 0x59, 0x38, 0x8c, 0xad, 0x34, 0xd1, 0x4b,
+    0xf8, 0x65, 0x02, 0x86, 0x0a, 0x29, 0x75, 0xbd, 0x49, 0xf9, 0xc7, 0xcf, 0x32, 0x29, 0xbf, 0xfc,
+    0x56, 0x93, 0x52, 0xd2, 0xfb, 0xf0, 0x77, 0x3c, 0x2b, 0x92, 0xa9, 0x81, 0x31, 0xab, 0x44, 0x77,
+    0x95, 0x9a, 0xad, 0xfd, 0x7f, 0x24, 0xce, 0x8a, 0x6d, 0x22, 0x85, 0xab, 0xf4, 0x73, 0xad, 0x28,
+    0x66, 0x31, 0x0d, 0x6f, 0xbd, 0x79, 0xcd, 0xb2, 0x79, 0xb2, 0x2a, 0x4c, 0xe0, 0xba, 0xe9, 0xfd,
+    0xe2, 0xa8, 0x02, 0xf8, 0x9b, 0x15, 0x94, 0xb3, 0x88, 0xc2, 0x4b, 0x54, 0x29, 0x6d, 0xb6, 0x3c,
+    0x1b, 0xbb, 0xad, 0xb4, 0x7d, 0x7b, 0x9d, 0x36, 0xae, 0x6f, 0xaa, 0x2b, 0xa3, 0xc9, 0x8f, 0xca,
+    0xcd, 0xe3, 0x86, 0x8f, 0x3e, 0x75, 0xd3, 0x92, 0x17, 0x61, 0xae, 0xe8, 0x95, 0x2b, 0x8f, 0x17,
+    0xe3, 0xf3, 0xc9, 0xa3, 0xd0, 0xca, 0x24, 0xa4, 0xf0, 0x8a, 0x22, 0x17, 0x85, 0x46, 0xe2, 0xd8,
+    0xd2, 0x51, 0xac, 0xb5, 0x38, 0x27, 0xc7, 0x9a, 0xfc, 0xeb, 0xa7, 0xec, 0xe5, 0x29, 0xb3, 0xb7,
+    0x42, 0xe8, 0x0d, 0x61, 0x60, 0x91, 0xc7, 0x83, 0xcc, 0xb3, 0xba, 0xfc, 0x6f, 0x79, 0x01, 0xa2,
+    0xdb, 0x26, 0xad, 0x6d, 0xe3, 0x6a, 0xd0, 0xb6, 0x7e, 0x35, 0xe8, 0xdb, 0xbe, 0x7a, 0xd5, 0x5b,
+    0xc3, 0x9d, 0x74, 0xa6, 0x6e, 0xa3, 0x3d, 0xe9, 0x4d, 0x5d, 0xd2, 0x9e, 0x74, 0xd4, 0x77, 0xc4,
+    0xcd, 0xbd, 0x25, 0xb1, 0xcd, 0x55, 0x68, 0x71, 0x55, 0x9b, 0x31, 0xe6, 0x03, 0x8a, 0x11, 0xec,
+    0xa8, 0xef, 0xcd, 0xc4, 0xce, 0xcc, 0xbf, 0xfe, 0x0f, 0xd2, 0x76, 0xc8, 0x8b, 0xd3, 0x73, 0xfc,
+    0x76, 0xf0, 0x16, 0xd3, 0x57, 0x87, 0xb0, 0x00, 0x70, 0x3b, 0xd2, 0x9f, 0xe3, 0x31, 0x9d, 0xa3,
+    0xb5, 0x18, 0xcf, 0x3a, 0x41, 0x62, 0xec, 0x76, 0xc6, 0xb5, 0xa3, 0xc4, 0xd6, 0x5a, 0x25, 0x5f,
+    0x35, 0x1a, 0xec, 0x14, 0x71, 0x76, 0x03, 0xcd, 0x32, 0xa2, 0x27, 0x77, 0x93, 0x46, 0x23, 0x8f,
+    0xda, 0xf0, 0x28, 0x88, 0x95, 0x2b, 0xc9, 0x88, 0xae, 0x14, 0x0d, 0xf0, 0x73, 0x5c, 0x56, 0xac,
+    0x0b, 0xda, 0x02, 0xcf, 0x46, 0xa2, 0x19, 0x02, 0x05, 0x9a, 0xb5, 0xcc, 0x2b, 0xd2, 0x59, 0x91,
+    0xe2, 0xdf, 0xec, 0x67, 0x76, 0xe3, 0xbb, 0x8e, 0x11, 0xf6, 0xa3, 0x9f, 0x6e, 0x61, 0x09, 0xc0,
+    0x50, 0xa3, 0x2e, 0x72, 0x7d, 0xea, 0xea, 0xa6, 0xa8, 0x3a, 0x04, 0x96, 0x06, 0x67, 0x69, 0x25,
+    0xfd, 0x91, 0x84, 0x34, 0x6f, 0x29, 0x73, 0x11, 0x10, 0x36, 0x7d, 0xa8, 0x1e, 0x3d, 0x92, 0xb3,
+    0x83, 0x6a, 0xec, 0x98, 0xd2, 0xd6, 0x79, 0x25, 0x9a, 0x14, 0x65, 0x69, 0x3c, 0x3d, 0xd1, 0x24,
+    0x9b, 0x48, 0x58, 0x58, 0x9c, 0x5d, 0xa6, 0xc2, 0x32, 0xa9, 0xbc, 0x6b, 0x7a, 0x43, 0xc9, 0xfe,
+    0x7c, 0xc4, 0x0b, 0x57, 0x6b, 0xd6, 0xfd, 0x72, 0x0b, 0xc0, 0x43, 0xbd, 0x7d, 0xfe, 0xce, 0xb2,
+    0x47, 0xab, 0xe7, 0xd8, 0x95, 0x72, 0x8f, 0x1a, 0x5e, 0x64, 0x7d, 0xef, 0xc7, 0x29, 0xa4, 0x27,
+    0x34, 0x5d, 0x1a, 0x48, 0x18, 0x0b, 0x9b, 0x1d, 0x46, 0xd5, 0x14, 0xad, 0x28, 0x57, 0x5c, 0x9e,
+    0xb3, 0xe9, 0x7a, 0x73, 0xf6, 0x92, 0x54, 0xe5, 0x79, 0xf8, 0xa0, 0xb3, 0xd1, 0xd7, 0x16, 0x40,
+    0xc1, 0x7c, 0xb1, 0x4c, 0xe8, 0x1d, 0xd1, 0xcc, 0xe3, 0xbf, 0xa1, 0x01, 0xa5, 0x6f, 0x37, 0xe8,
+    0x2d, 0x6e, 0x74, 0x2a, 0x19, 0x31, 0x88, 0xc7, 0xd4, 0x50, 0x51, 0x26, 0x29, 0x25, 0x17, 0xbc,
+    0x46, 0x0e, 0xef, 0x7a, 0x99, 0x80, 0xb5, 0xee, 0x03, 0xa3, 0xa3, 0xc7, 0xf1, 0xb3, 0x57, 0xcd,
+    0x09, 0xf0, 0xb2, 0xd9, 0x2f, 0xb8, 0x55, 0xb0, 0xd3, 0x77, 0x1c, 0x67, 0x13, 0x2b, 0x6f, 0xac,
+    0x1d, 0x47, 0xf8, 0x40, 0xf4, 0xb0, 0x6b, 0x28, 0x4e, 0x23, 0x7f, 0x1c, 0x7c, 0xfc, 0x44, 0xa4,
+    0xc8, 0xd1, 0x67, 0x2f, 0xb3, 0x01, 0xe6, 0xee, 0x7b, 0xa3, 0x70, 0x3e, 0xbd, 0x15, 0x33, 0xcf,
+    0x6f, 0x92, 0xdb, 0x71, 0x9a, 0xbd, 0x4f, 0x1a, 0x6b, 0x59, 0x4a, 0x2a, 0xc2, 0xc1, 0x1b, 0x71,
+    0x9d, 0x58, 0x95, 0x65, 0xae, 0x7a, 0xd3, 0xcf, 0x46, 0x1f, 0x78, 0x27, 0x59, 0x11, 0x75, 0x88,
+    0x3b, 0xcb, 0x4c, 0xfa, 0xf8, 0xeb, 0x9f, 0xff, 0xf2, 0x37, 0x47, 0xcb, 0xa9, 0xb8, 0x40, 0x6d,
+    0x5d, 0xb4, 0x88, 0x3b, 0xd6, 0x8a, 0x51, 0x83, 0xa5, 0x8a, 0x50, 0x23, 0xa0, 0x3c, 0x10, 0x35,
+    0x79, 0xd2, 0xde, 0x94, 0xb0, 0xec, 0xd8, 0xf7, 0xd2, 0x32, 0xb6, 0x44, 0x0c, 0xf5, 0x4a, 0x8f,
+    0x86, 0x26, 0x80, 0x6d, 0xed, 0x97, 0x63, 0xa2, 0x5f, 0x80, 0x1b, 0xf0, 0xce, 0x1c, 0x1f, 0x7e,
+    0x2e, 0x56, 0x90, 0x5e, 0x09, 0xf8, 0xe5, 0x58, 0xc0, 0x3a, 0x03, 0xdc, 0x67, 0x9a, 0x23, 0x4d,
+    0x2d, 0x3f, 0x65, 0xa7, 0x9d, 0xe4, 0x0f, 0x95, 0x45, 0x2f, 0x69, 0x60, 0xd8, 0x23, 0x2a, 0x90,
+    0xe9, 0xc5, 0x2f, 0x5a, 0x6a, 0x7f, 0x32, 0x09, 0x44, 0x8e, 0xac, 0xd5, 0x44, 0xcf, 0x78, 0x2c,
+    0x73, 0x8f, 0x21, 0x78, 0xca, 0x8f, 0x1a, 0x90, 0x78, 0x0c, 0x70, 0x19, 0x94, 0x3d, 0x78, 0x40,
+    0xcd, 0xd6, 0x67, 0x80, 0x9e, 0xe5, 0x5a, 0xe3, 0xdc, 0xe9, 0x4b, 0x01, 0x3c, 0x64, 0x55, 0x7d,
+    0x32, 0x07, 0x2a, 0x20, 0x46, 0x2f, 0x9e, 0x0c, 0x42, 0x5c, 0x6f, 0x20, 0xbc, 0x73, 0x66, 0x69,
+    0x4d, 0x72, 0xbc, 0x09, 0xe6, 0xa3, 0xf0, 0xa6, 0x99, 0xde, 0x82, 0x03, 0x72, 0xaf, 0x98, 0x32,
+    0x0b, 0xad, 0xfa, 0x5d, 0x7d, 0x23, 0x77, 0xe3, 0x61, 0x1c, 0x88, 0x1f, 0x60, 0x86, 0xf3, 0x7d,
+    0x34, 0xbf, 0xc4, 0xe3, 0x4b, 0xf9, 0xd5, 0x2b, 0xbf, 0x21, 0x17, 0xca, 0xf4, 0xe1, 0x37, 0xd1,
+    0xe3, 0x3e, 0x87, 0x94, 0x12, 0x69, 0x78, 0x14, 0x69, 0x05, 0x8b, 0xd9, 0xf4, 0xf5, 0x64, 0x9c,
+    0x3b, 0x8f, 0xef, 0xc4, 0xcd, 0x14, 0x65, 0xa3, 0xcb, 0x85, 0x59, 0xf7, 0xc5, 0x03, 0xc4, 0xc9,
+    0x7d, 0xad, 0x5a, 0xa3, 0x6e, 0xeb, 0x4c, 0xe0, 0x7a, 0x7e, 0xf7, 0xde, 0x3f, 0x30, 0x21, 0xe5,
+    0x33, 0xcf, 0x0f, 0x1e, 0xab, 0x10, 0x91, 0x4d, 0xc2, 0x39, 0xef, 0x3e, 0x4f, 0x73, 0x2b, 0x31,
+    0x4d, 0x05, 0x41, 0xe6, 0x22, 0x43, 0x12, 0x87, 0x4e, 0x1b, 0x30, 0x32, 0x18, 0xee, 0x63, 0x74,
+    0x09, 0xd0, 0x34, 0xbe, 0x95, 0x49, 0x0e, 0x7b, 0xcf, 0xd2, 0xe0, 0x4d, 0x19, 0x9f, 0xae, 0x24,
+    0xe3, 0x7d, 0x3e, 0x55, 0x83, 0xe5, 0x96, 0x3d, 0x4c, 0xd5, 0x28, 0xbf, 0x92, 0x6d, 0x8d, 0x60,
+    0xc8, 0xf6, 0x0a, 0xa7, 0x59, 0x5e, 0x66, 0xe7, 0x87, 0xd5, 0xb9, 0x4b, 0x43, 0xda, 0x56, 0xce,
+    0xee, 0xd8, 0x2a, 0x17, 0xb3, 0x06, 0xa3, 0xd4, 0xb1, 0x0e, 0xc5, 0x10, 0x66, 0x7e, 0xe2, 0x29,
+    0x49, 0x59, 0x8c, 0x0e, 0x58, 0xce, 0xcf, 0x5f, 0xff, 0xfc, 0xcf, 0xb6, 0xd4, 0x9e, 0xb5, 0xe2,
+    0xab, 0x4d, 0x36, 0x92, 0x27, 0x19, 0x32, 0x19, 0x5c, 0x46, 0x56, 0xc1, 0xaa, 0x44, 0xae, 0xd5,
+    0x1d, 0xcc, 0x3d, 0x94, 0x22, 0xbc, 0xca, 0xf3, 0x83, 0x7c, 0xc9, 0xa8, 0x6a, 0x9b, 0xc7, 0x41,
+    0x7a, 0xc7, 0xb2, 0xee, 0x93, 0x82, 0x23, 0x71, 0x32, 0x86, 0x75, 0xa5, 0xa6, 0xdf, 0x95, 0x69,
+    0xb1, 0x9f, 0x56, 0xc2, 0x4b, 0x0d, 0xb1, 0x02, 0x68, 0xca, 0x95, 0xd1, 0xc5, 0xd0, 0x52, 0xdb,
+    0xc5, 0x84, 0x86, 0xaa, 0xc5, 0xf4, 0x3c, 0x09, 0x23, 0x7a, 0xac, 0x9f, 0x9f, 0x1c, 0xe3, 0xf1,
+    0x85, 0xb4, 0xd2, 0xcf, 0x6c, 0x48, 0x95, 0x7a, 0x16, 0x1b, 0xb5, 0x12, 0xb5, 0x71, 0x00, 0x7a,
+    0x5d, 0x79, 0x2d, 0x76, 0x89, 0xda, 0xd8, 0x61, 0xbd, 0xb6, 0x18, 0xab, 0x1a, 0x23, 0x9e, 0x3a,
+    0x91, 0x1e, 0x7e, 0x00, 0x0e, 0x79, 0xb5, 0x7f, 0x7c, 0xf2, 0xd0, 0xe3, 0x6f, 0x32, 0x0e, 0xd5,
+    0x74, 0x2f, 0xb5, 0xe8, 0x18, 0x69, 0x2c, 0x92, 0x1e, 0x77, 0xc4, 0xee, 0xa6, 0x23, 0x55, 0xe5,
+    0x68, 0x38, 0x6d, 0x7b, 0x16, 0x2f, 0x0e, 0xa8, 0x4c, 0xc2, 0x99, 0x5f, 0xd9, 0x11, 0xf0, 0xb5,
+    0xd3, 0x91, 0xd4, 0xb3, 0x3c, 0x76, 0xc9, 0x00, 0x94, 0xc3, 0xab, 0x5d, 0xa3, 0xb6, 0xb8, 0x82,
+    0xad, 0x08, 0x80, 0xcc, 0x24, 0xce, 0x81, 0xc1, 0x8f, 0xcd, 0x2b, 0x02, 0x21, 0x92, 0xfc, 0x72,
+    0x20, 0xf0, 0x1b, 0xda, 0x8a, 0x20, 0x88, 0x3c, 0x81, 0xdc, 0x71, 0x30, 0x47, 0xf6, 0x8a, 0x81,
+    0x08, 0x6f, 0xb7, 0x01, 0xe5, 0x21, 0xa7, 0xe7, 0xf2, 0x63, 0x9f, 0xf1, 0x72, 0xac, 0xa3, 0x93,
+    0x1f, 0x8e, 0x4f, 0x8e, 0x48, 0x55, 0x08, 0xf2, 0xc6, 0x28, 0x02, 0x21, 0x3c, 0xaf, 0x93, 0xc5,
+    0xe4, 0x36, 0x0e, 0x86, 0x31, 0x70, 0x74, 0x98, 0x40, 0x7a, 0xb4, 0x6f, 0x6d, 0x7d, 0x82, 0xf2,
+    0x16, 0x8b, 0x28, 0xc4, 0x53, 0xe8, 0x39, 0x19, 0xd4, 0x49, 0x02, 0x5a, 0x8c, 0x0f, 0x7f, 0x41,
+    0x26, 0xd2, 0xeb, 0xe6, 0xb8, 0xf6, 0xc6, 0xdf, 0xe3, 0xe1, 0x54, 0xac, 0x04, 0x69, 0x88, 0x67,
+    0x18, 0x06, 0x84, 0xa5, 0x77, 0x33, 0x47, 0x87, 0x86, 0x41, 0xec, 0x57, 0xbd, 0xd9, 0x42, 0x81,
+    0x53, 0xa5, 0x19, 0xac, 0x91, 0x07, 0x16, 0x06, 0x1e, 0x3b, 0xd9, 0x20, 0x4e, 0xb3, 0xcb, 0xaf,
+    0xc5, 0x21, 0x50, 0x72, 0x37, 0x7b, 0xe0, 0x2b, 0x3c, 0xad, 0x5e, 0xd7, 0x61, 0xd9, 0xd6, 0xc9,
+    0x24, 0x50, 0x20, 0xb1, 0x54, 0x58, 0xef, 0x63, 0x15, 0xdf, 0xc8, 0xbc, 0xd8, 0x49, 0x50, 0x27,
+    0xd7, 0xf4, 0x78, 0x7c, 0xe3, 0xa0, 0x54, 0x76, 0x6e, 0x15, 0x2e, 0x1d, 0xb1, 0x0b, 0xa1, 0x1d,
+    0x70, 0x25, 0xd5, 0xd4, 0x0f, 0x32, 0x4d, 0x62, 0x84, 0x8b, 0xe8, 0xc7, 0x70, 0x89, 0xd4, 0xa9,
+    0xe4, 0x49, 0xb8, 0x75, 0x9a, 0x26, 0xb1, 0xa3, 0x97, 0x7b, 0x15, 0xcc, 0x97, 0x89, 0x5f, 0xa6,
+    0xe4, 0x39, 0xd5, 0xcf, 0xac, 0x25, 0x3f, 0xec, 0x66, 0xd3, 0x70, 0x46, 0x23, 0x99, 0x86, 0xc3,
+    0x12, 0x66, 0x7d, 0x40, 0xc6, 0x2c, 0xbe, 0xcc, 0xe4, 0xe1, 0x44, 0x51, 0x26, 0x09, 0x47, 0xbd,
+    0x9b, 0x81, 0x26, 0xd8, 0x44, 0x91, 0x76, 0xe0, 0x28, 0xdf, 0x21, 0xfa, 0xf6, 0x5b, 0x42, 0xf3,
+    0xaf, 0xa8, 0xa6, 0x8d, 0xa0, 0xcd, 0x1b, 0x29, 0x44, 0x5d, 0x9e, 0x33, 0xf7, 0x6c, 0x8f, 0xf4,
+    0x6b, 0xd8, 0x60, 0x93, 0xde, 0x63, 0x94, 0x6e, 0xe0, 0xe0, 0x23, 0x7e, 0xfb, 0x87, 0xe8, 0x66,
+    0x9d, 0x62, 0x7e, 0x27, 0xc5, 0x7f, 0x9d, 0xd0, 0x6c, 0x9e, 0x1d, 0x76, 0x36, 0x6f, 0x9d, 0xef,
+    0x52, 0xed, 0xd0, 0xdc, 0x1e, 0x72, 0x9f, 0x93, 0xce, 0x23, 0xce, 0x53, 0x37, 0x2e, 0x41, 0xd7,
+    0x8f, 0xb5, 0xc5, 0xb3, 0xbc, 0x56, 0x9f, 0xf3, 0x2d, 0x46, 0xc6, 0xc1, 0xd8, 0x7d, 0x0d, 0xe9,
+    0x8d, 0x15, 0x14, 0xe7, 0xf4, 0xf2, 0x41, 0xe3, 0xa6, 0x0a, 0x43, 0xb1, 0x46, 0x54, 0x3f, 0x79,
+    0x92, 0xb9, 0xfc, 0x28, 0x6b, 0x1c, 0xe9, 0xf7, 0x65, 0xf0, 0x43, 0x0d, 0xf8, 0xa6, 0xb4, 0x52,
+    0x58, 0x01, 0x0b, 0x66, 0x81, 0x34, 0x68, 0x0e, 0xdf, 0x9c, 0x51, 0xb6, 0xc0, 0x93, 0x71, 0xcd,
+    0x9b, 0x48, 0x7d, 0x42, 0xe3, 0x97, 0x02, 0x7a, 0x64, 0xab, 0x7a, 0x81, 0x82, 0x0d, 0xec, 0xb3,
+    0xbd, 0x1c, 0xb8, 0xfa, 0x0d, 0x0c, 0xd6, 0xfb, 0x2e, 0xaa, 0x30, 0x32, 0x7a, 0x5f, 0xd2, 0x37,
+    0xa4, 0xbb, 0x6b, 0x29, 0xac, 0xb6, 0xb3, 0xa7, 0xdf, 0x00, 0xa4, 0x76, 0x47, 0x85, 0x89, 0x56,
+    0x5e, 0xcd, 0x42, 0xc0, 0x72, 0x32, 0xbc, 0xf4, 0x92, 0x1c, 0x9a, 0x9b, 0xa7, 0x5c, 0x26, 0x51,
+    0xa9, 0xa5, 0xd4, 0x2c, 0x4e, 0x7d, 0x36, 0x6e, 0x9b, 0xd1, 0x6e, 0xfe, 0x62, 0x2c, 0x2c, 0xe6,
+    0x17, 0x5f, 0xe0, 0xff, 0x33, 0x73, 0x12, 0x8b, 0x34, 0x30, 0x2e, 0xc5, 0x74, 0x64, 0x9f, 0x32,
+    0xe6, 0x4b, 0x66, 0xe1, 0xc8, 0x9f, 0xc6, 0x64, 0x41, 0x0f, 0xbb, 0x9f, 0x85, 0x1a, 0xce, 0xe9,
+    0x81, 0x14, 0xb6, 0x8c, 0xb0, 0x54, 0xf8, 0xc6, 0x81, 0x79, 0xdb, 0x05, 0x95, 0x38, 0xce, 0x8e,
+    0xda, 0xc3, 0x6e, 0xf7, 0x09, 0xe3, 0xa4, 0x6d, 0x58, 0x3c, 0xad, 0x36, 0xff, 0x81, 0x7c, 0xb3,
+    0x4e, 0x3a, 0x5d, 0xc7, 0xe1, 0x0f, 0x30, 0x20, 0x13, 0xac, 0x6d, 0xf5, 0x02, 0x91, 0x34, 0x17,
+    0x66, 0x8f, 0xe7, 0xc1, 0xec, 0x66, 0x2e, 0x18, 0x69, 0x9e, 0xbc, 0xd8, 0xe3, 0x08, 0xcb, 0xbc,
+    0x3a, 0x97, 0xaf, 0x82, 0xb1, 0xce, 0xb8, 0x9f, 0x39, 0xcd, 0x6d, 0x57, 0xbb, 0x31, 0x23, 0xcd,
+    0x29, 0x83, 0x65, 0x60, 0xca, 0x51, 0x39, 0xb2, 0x96, 0x39, 0x32, 0x41, 0xfa, 0xdf, 0xb9, 0x62,
+    0x94, 0x2e, 0x1d, 0x65, 0x43, 0xbe, 0xe8, 0xc8, 0x01, 0xb7, 0xf9, 0x80, 0xd3, 0x77, 0xe9, 0xe8,
+    0xfb, 0x74, 0xf0, 0xd0, 0x4d, 0xf1, 0xee, 0x19, 0x15, 0x2c, 0x79, 0xd8, 0xe0, 0x91, 0x3e, 0x66,
+    0x8d, 0x76, 0x2d, 0xc3, 0x70, 0x2b, 0x78, 0xcc, 0x7e, 0xa5, 0x5e, 0x39, 0x5f, 0x04, 0x78, 0x74,
+    0x32, 0xbd, 0x04, 0x15, 0x56, 0x19, 0xc8, 0x7c, 0x64, 0x39, 0xcb, 0xc5, 0x0d, 0x98, 0x9e, 0xa0,
+    0x55, 0x19, 0x80, 0xb6, 0x2c, 0x80, 0xf0, 0xf0, 0x3b, 0x3c, 0xc3, 0xb1, 0x5e, 0x39, 0x08, 0xc3,
+    0xa9, 0x87, 0x99, 0xfe, 0xd0, 0x07, 0x02, 0x16, 0x3e, 0x7c, 0xa2, 0x07, 0x12, 0x6c, 0x9a, 0x4a,
+    0x2d, 0x1f, 0x77, 0xae, 0x86, 0xbb, 0xbe, 0x9b, 0xe2, 0xae, 0xaf, 0xa0, 0xae, 0xdf, 0xec, 0xa6,
+    0xf8, 0x71, 0x35, 0xdc, 0xb5, 0xfb, 0x2a, 0xee, 0x3a, 0x12, 0x77, 0xbd, 0x42, 0xc2, 0x91, 0xa8,
+    0x2a, 0x18, 0x90, 0x86, 0x1c, 0x6f, 0x10, 0xc2, 0x32, 0xec, 0x3b, 0xdf, 0x64, 0xd1, 0xd2, 0xb3,
+    0xa0, 0x85, 0x2d, 0xe0, 0x14, 0x29, 0xc3, 0x08, 0xd8, 0xd7, 0x10, 0xb3, 0xa4, 0xc9, 0x94, 0x9e,
+    0x5c, 0x9f, 0x8b, 0x90, 0xb6, 0x86, 0x90, 0x6d, 0x75, 0x99, 0x74, 0xb4, 0x55, 0x02, 0x4b, 0xc3,
+    0xf9, 0xae, 0xda, 0x92, 0x63, 0xaf, 0xf1, 0xb7, 0xdd, 0xc2, 0x81, 0x63, 0x24, 0xaa, 0x7d, 0xbd,
+    0xd0, 0x3c, 0x54, 0xeb, 0x72, 0x61, 0x6f, 0x72, 0xc7, 0x48, 0xaf, 0x90, 0xdc, 0x21, 0x02, 0x5d,
+    0xf4, 0xd8, 0x7e, 0x46, 0x4f, 0x01, 0x3f, 0xd2, 0x33, 0x77, 0xb0, 0x1d, 0x7d, 0xb0, 0xca, 0x44,
+    0xb6, 0xd5, 0x95, 0xd3, 0xcd, 0x52, 0x05, 0x9b, 0x7c, 0x5c, 0x2a, 0xea, 0xdc, 0x1b, 0x6c, 0x23,
+    0xb3, 0x0e, 0x56, 0xf1, 0x11, 0x73, 0xa9, 0xdd, 0xe5, 0x33, 0x96, 0x7c, 0xbe, 0x72, 0x9f, 0xbf,
+    0xdc, 0x58, 0xea, 0x3c, 0xde, 0x85, 0x45, 0x2f, 0xf7, 0x0b, 0xe6, 0x52, 0x4a, 0x5a, 0xb1, 0xa4,
+    0x5c, 0x10, 0x9d, 0x86, 0xa0, 0xa6, 0x1c, 0xd8, 0x92, 0x93, 0xb7, 0x26, 0x17, 0x76, 0x7b, 0x02,
+    0x61, 0x80, 0x4c, 0x7d, 0x5d, 0x6d, 0x35, 0xbb, 0xca, 0x6f, 0x83, 0xa2, 0x64, 0x1e, 0xdd, 0x1e,
+    0x4d, 0xb6, 0xe3, 0x2f, 0xf1, 0x24, 0xbb, 0x77, 0x6d, 0x7e, 0xff, 0xd4, 0x5e, 0xe5, 0xf5, 0xef,
+    0xcd, 0x17, 0x78, 0x92, 0x1c, 0xa7, 0xa6, 0x72, 0xbc, 0x14, 0xfa, 0x27, 0xa7, 0xb7, 0xe5, 0xc8,
+    0xfe, 0xf4, 0x69, 0x6f, 0x53, 0x5a, 0x91, 0x2f, 0x5c, 0xde, 0x71, 0x0b, 0xaf, 0x70, 0xb3, 0x04,
+    0xd1, 0x29, 0xe4, 0x67, 0x2c, 0xf1, 0x8c, 0x60, 0x60, 0x3a, 0x89, 0x02, 0x0c, 0x2d, 0x2a, 0xcf,
+    0xc7, 0xda, 0xfd, 0x2c, 0xc5, 0xb6, 0xe8, 0xaa, 0xed, 0xaa, 0xbd, 0x4b, 0x3b, 0xde, 0xa1, 0x0b,
+    0xda, 0xf6, 0x86, 0xe2, 0xbe, 0xa0, 0x9b, 0x3f, 0x02, 0x05, 0xd3, 0x9b, 0x70, 0x26, 0xd8, 0x3c,
+    0x91, 0x17, 0xda, 0xd6, 0x56, 0x08, 0x0e, 0x65, 0x0a, 0xf1, 0x6a, 0x58, 0xfb, 0x14, 0xfe, 0x61,
+    0xff, 0xec, 0xc4, 0x3a, 0x89, 0x5c, 0x82, 0x96, 0x63, 0x62, 0x2a, 0x27, 0xdf, 0x4e, 0xc7, 0xd8,
+    0xd3, 0xd9, 0x59, 0x27, 0x7d, 0xd3, 0x55, 0xf0, 0x92, 0x4f, 0x79, 0xf9, 0xdd, 0x66, 0x97, 0xda,
+    0x16, 0xf4, 0x3b, 0x97, 0x97, 0x01, 0xcc, 0x1d, 0x92, 0xe6, 0x49, 0xae, 0xcf, 0xc3, 0x5a, 0x0a,
+    0x5d, 0xb6, 0xd4, 0xd5, 0xd5, 0xea, 0xa4, 0xcc, 0xad, 0xa5, 0x2f, 0xb5, 0x56, 0x5f, 0x79, 0xe5,
+    0x98, 0xeb, 0xae, 0x90, 0x89, 0x65, 0x16, 0xa2, 0x29, 0x9a, 0xee, 0xf2, 0x56, 0x66, 0xce, 0xc2,
+    0xcc, 0x67, 0x5e, 0x07, 0x8c, 0xdd, 0x48, 0xee, 0xf5, 0x10, 0x8e, 0x65, 0xcf, 0x05, 0x5c, 0x93,
+    0x69, 0xe9, 0x22, 0x60, 0x4b, 0x15, 0x14, 0x6d, 0x57, 0x59, 0x6c, 0x59, 0x29, 0x98, 0xc0, 0xd8,
+    0x69, 0x7e, 0x80, 0xfe, 0x46, 0xac, 0x99, 0x3d, 0xde, 0xc8, 0x3b, 0xc7, 0xa8, 0xca, 0x33, 0x68,
+    0xe4, 0xfb, 0xd6, 0xfb, 0xb2, 0x0c, 0x4c, 0x9d, 0x59, 0x65, 0x62, 0x5d, 0xd6, 0xf1, 0xf4, 0x9d,
+    0xce, 0x24, 0xda, 0x16, 0x35, 0xa8, 0x65, 0x8e, 0xe7, 0x41, 0xbd, 0xce, 0xb0, 0x84, 0x02, 0xce,
+    0x82, 0x49, 0x3e, 0x94, 0xfb, 0x49, 0xc5, 0x70, 0x02, 0xbc, 0xa6, 0x3c, 0x13, 0xec, 0x35, 0x5d,
+    0x75, 0xf4, 0x3a, 0xcd, 0x6f, 0xab, 0xa3, 0x57, 0xa7, 0xb0, 0xe3, 0x5a, 0x58, 0xbe, 0x65, 0x3a,
+    0x1f, 0x34, 0xfc, 0x32, 0xa3, 0x15, 0xde, 0x23, 0x1c, 0xf0, 0x34, 0x98, 0x05, 0x89, 0x95, 0x95,
+    0xe6, 0x72, 0x90, 0x0b, 0x6f, 0x7e, 0x25, 0xb9, 0xf0, 0x83, 0xf5, 0xbe, 0x8e, 0xa6, 0xf0, 0x1a,
+    0x94, 0xd3, 0x92, 0xfc, 0x03, 0x19, 0x4b, 0xd7, 0xa6, 0x04, 0x3a, 0xb9, 0xf4, 0xaf, 0xf1, 0xc6,
+    0x4f, 0xc1, 0xe5, 0xe7, 0x65, 0xbc, 0x17, 0x3f, 0x1e, 0x9d, 0xbd, 0xda, 0x7f, 0x49, 0xce, 0x7f,
+    0x7c, 0x73, 0x71, 0xf8, 0xfa, 0x0f, 0x27, 0xe5, 0x39, 0xae, 0xab, 0x4a, 0xd4, 0x6e, 0x06, 0x55,
+    0x36, 0x9d, 0xb2, 0xa5, 0xeb, 0x94, 0xee, 0x96, 0xba, 0xc6, 0x4c, 0x1d, 0xe1, 0x2e, 0x97, 0x89,
+    0xd8, 0x30, 0x60, 0x79, 0xa3, 0x30, 0x57, 0xca, 0x12, 0x2d, 0xf0, 0xe8, 0x6d, 0xec, 0x5f, 0x82,
+    0xbe, 0x05, 0xef, 0x4e, 0x25, 0xda, 0x10, 0x2c, 0x12, 0x24, 0x6d, 0x76, 0x53, 0xc6, 0xfa, 0x2c,
+    0x3c, 0x9b, 0xf4, 0xb4, 0x2e, 0xfb, 0xee, 0xea, 0x0a, 0x51, 0xaa, 0xb4, 0xd3, 0x9f, 0xba, 0xc2,
+    0xa6, 0x0e, 0xd8, 0xfb, 0xc5, 0xd9, 0xeb, 0xa5, 0xf6, 0x90, 0x9d, 0x02, 0xf7, 0xdf, 0x5c, 0xbc,
+    0xfe, 0x64, 0xb5, 0xb3, 0xaf, 0xea, 0x68, 0x8e, 0x6a, 0x88, 0xa8, 0xf6, 0x46, 0xab, 0x9b, 0x9a,
+    0x1b, 0xf8, 0x2e, 0x25, 0x34, 0xd0, 0x50, 0xe5, 0x30, 0x5a, 0xdd, 0x9c, 0x71, 0xa4, 0xe4, 0xe7,
+    0xac, 0xc7, 0x97, 0x0f, 0x26, 0xde, 0x6c, 0x00, 0x82, 0x98, 0x72, 0xab, 0x51, 0x14, 0x8c, 0x93,
+    0xb5, 0x74, 0xd3, 0x96, 0xab, 0xd9, 0x4c, 0x8a, 0x7d, 0xd9, 0xeb, 0x39, 0x6a, 0xaf, 0xe4, 0xc0,
+    0x71, 0x74, 0xa9, 0xf6, 0x52, 0x3c, 0x41, 0xda, 0x59, 0x8e, 0xdb, 0x2a, 0xb6, 0x9c, 0xda, 0x6e,
+    0xe9, 0x51, 0x95, 0xe0, 0xc1, 0x5b, 0x05, 0x3c, 0x58, 0x66, 0x63, 0xc7, 0x8b, 0xe0, 0x0a, 0x17,
+    0x5c, 0xc2, 0x62, 0xa4, 0x4a, 0xb3, 0xdf, 0x56, 0x4f, 0x15, 0x49, 0x7d, 0x39, 0xd1, 0x6d, 0xc7,
+    0xb0, 0x93, 0x2c, 0x18, 0x70, 0xf4, 0x47, 0xa3, 0x5f, 0xf6, 0xf7, 0xde, 0x39, 0x75, 0xed, 0x7f,
+    0x39, 0xdc, 0x13, 0x6f, 0xd6, 0x78, 0x10, 0xf3, 0x3c, 0xdf, 0x7f, 0x71, 0x74, 0xf1, 0x93, 0xe4,
+    0x9d, 0x3b, 0xe4, 0x35, 0x28, 0x68, 0x88, 0x48, 0x3c, 0xa2, 0x8d, 0x1b, 0x03, 0x25, 0xd5, 0xd7,
+    0x9e, 0xc2, 0x2f, 0xb7, 0x0c, 0x24, 0xa8, 0x9c, 0x54, 0x5b, 0xb4, 0x1a, 0x0b, 0x56, 0xa5, 0x15,
+    0x23, 0xfe, 0x42, 0x8e, 0x4a, 0xf1, 0xd3, 0xa2, 0x78, 0x69, 0xf1, 0x7f, 0x80, 0x1f, 0x13, 0xa9,
+    0xa9, 0xd1, 0xd0, 0x05, 0x15, 0xd5, 0xa4, 0x84, 0xbb, 0x7c, 0x4e, 0xb0, 0xb6, 0x9a, 0x7b, 0xca,
+    0x32, 0x49, 0x40, 0xcd, 0x8d, 0x71, 0x17, 0x23, 0x6f, 0x69, 0xdd, 0xdb, 0xbc, 0xb0, 0xe8, 0xb0,
+    0x9e, 0x85, 0x61, 0x32, 0x21, 0xcc, 0xbf, 0xca, 0xa2, 0xcf, 0x62, 0x92, 0x84, 0xe8, 0x50, 0x13,
+    0x78, 0xd6, 0xef, 0xfd, 0x46, 0xcf, 0x6d, 0x40, 0xdd, 0xc9, 0xf0, 0xe7, 0x29, 0x69, 0xc3, 0x9f,
+    0x27, 0x4f, 0x0c, 0xf6, 0xfa, 0x2e, 0x48, 0x2f, 0x75, 0x66, 0x7b, 0x47, 0x72, 0x8b, 0x2b, 0x7d,
+    0x57, 0xe7, 0xaf, 0x84, 0x3c, 0x08, 0xde, 0xd7, 0x59, 0x4d, 0x58, 0x8d, 0xe2, 0x9b, 0xf7, 0x11,
+    0x66, 0x8b, 0x4e, 0x8b, 0xf5, 0x5d, 0xf6, 0x22, 0x73, 0x74, 0x37, 0x17, 0x9d, 0x4d, 0x56, 0x72,
+    0xeb, 0xef, 0xf8, 0xe4, 0xf8, 0xa2, 0x74, 0x79, 0xb9, 0xdd, 0x0b, 0x53, 0x74, 0x74, 0x0d, 0x5f,
+    0xf0, 0xd6, 0x42, 0x7f, 0x0e, 0x6d, 0x57, 0x68, 0x2a, 0x44, 0xa5, 0x4e, 0x7c, 0x75, 0xdb, 0x82,
+    0x6e, 0x9a, 0xf8, 0x4d, 0x36, 0xee, 0x26, 0xbd, 0x3f, 0x2f, 0x4e, 0xaa, 0x95, 0x26, 0xbd, 0x2f,
+    0x88, 0x05, 0xfe, 0xa0, 0xc1, 0x51, 0xcb, 0xbf, 0xa5, 0x50, 0x8e, 0x12, 0x27, 0xd0, 0x4f, 0xc4,
+    0x15, 0xaf, 0xc7, 0x87, 0xe8, 0xa1, 0x79, 0x73, 0xfc, 0xa8, 0xcc, 0x85, 0x97, 0x0d, 0x71, 0x81,
+    0xe9, 0x28, 0x73, 0xe3, 0x8c, 0x8c, 0x84, 0xdd, 0x2d, 0x86, 0x24, 0xae, 0x88, 0x5d, 0x1b, 0x10,
+    0x8d, 0xff, 0xc1, 0xa4, 0xe3, 0xf3, 0xe0, 0x72, 0xee, 0x4d, 0xc9, 0x85, 0xb7, 0xe0, 0x71, 0x3f,
+    0x69, 0x10, 0xee, 0x07, 0x3e, 0xc4, 0xcc, 0x1d, 0x82, 0xb6, 0x0b, 0x1a, 0xed, 0x97, 0x28, 0xda,
+    0x6e, 0x7e, 0x56, 0xdf, 0xb0, 0xeb, 0x79, 0x76, 0x1f, 0xe9, 0xd4, 0xf2, 0x88, 0xdd, 0x1c, 0x99,
+    0x1c, 0x63, 0x9a, 0x13, 0x50, 0x6a, 0x35, 0x2d, 0xcc, 0x9c, 0x98, 0xbc, 0x86, 0x5a, 0x44, 0x6c,
+    0x8d, 0x69, 0x05, 0x70, 0x9e, 0xcf, 0x8f, 0xce, 0xde, 0x1e, 0x1d, 0xfe, 0xfc, 0xfc, 0xa7, 0x9f,
+    0xd9, 0xc8, 0x6a, 0x22, 0x76, 0x81, 0x85, 0x2f, 0x57, 0x95, 0x89, 0xdc, 0x5f, 0x26, 0xa1, 0xc8,
+    0xb7, 0x61, 0xc9, 0x54, 0xe1, 0x9c, 0xf9, 0x72, 0x01, 0x10, 0x0f, 0x45, 0x09, 0x62, 0x32, 0xe4,
+    0xd1, 0x52, 0x3c, 0x63, 0x0c, 0x2a, 0x56, 0xdf, 0xcc, 0xc1, 0x50, 0x45, 0xc4, 0x92, 0x64, 0xe2,
+    0x13, 0x3c, 0x69, 0x82, 0xfb, 0xb3, 0x93, 0x90, 0x1e, 0xc5, 0x24, 0xa0, 0xca, 0xad, 0xe9, 0x4c,
+    0xfc, 0xc4, 0xd3, 0xcd, 0x18, 0x34, 0xff, 0x45, 0xf2, 0xec, 0xd1, 0xd3, 0xcd, 0x41, 0x38, 0xba,
+    0xc5, 0xbf, 0x93, 0x64, 0x36, 0x7d, 0xf6, 0xe8, 0xff, 0x02, 0xd4, 0x47, 0xcf, 0x5f, 0x9a, 0x2a,
+    0x01, 0x00,
+};
+
+#endif // WEB_INDEX_H
@@ -0,0 +1,886 @@
+// SIGNALTAP Web Server Implementation
+#include "web_server.h"
+#include "web_index.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define WS_OP_TEXT          0x1
+#define WS_OP_CLOSE         0x8
+#define WS_OP_PING          0x9
+#define WS_OP_PONG          0xA
+#define WS_GUID             "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+#define WS_KEY_LEN          64
+
+#define WEB_WRITE_BUDGET    4096    // Bytes per client per poll: one slow send can't hold the loop
+#define WEB_LISTEN_BACKLOG  8
+
+static const char* const demoKeys[DEMO_COUNT] = {
+    "cnc", "chiller", "compressor", "custom"
+};
+
+// Dashboard LED keys of the CNC panel, in CNCLeds_t order
+static const char* const cncLedKeys[8] = {
+    "PR", "PS", "PF", "PF0", "V5", "NF", "SF", "CB"
+};
+
+static const char refusal[] =
+    "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+
+// ============ Transport (both builds: lwIP or POSIX sockets) ============
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+static void set_nonblocking(int fd) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+}
+
+static bool tcp_listen(WebServer_t* w, uint16_t port) {
+    w->fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (w->fd < 0) return false;
+    int one = 1;
+    setsockopt(w->fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in a;
+    memset(&a, 0, sizeof(a));
+    a.sin_family = AF_INET;
+    a.sin_addr.s_addr = htonl(INADDR_ANY);
+    a.sin_port = htons(port);
+    if (bind(w->fd, (struct sockaddr*)&a, sizeof(a)) != 0 || listen(w->fd, WEB_LISTEN_BACKLOG) != 0) {
+        close(w->fd);
+        w->fd = -1;
+        return false;
+    }
+    set_nonblocking(w->fd);
+    return true;
+}
+
+static void tcp_unlisten(WebServer_t* w) {
+    close(w->fd);
+    w->fd = -1;
+}
+
+static bool tcp_accept(WebServer_t* w, WebClient_t* c) {
+    int fd = accept(w->fd, NULL, NULL);
+    if (fd < 0) return false;
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    set_nonblocking(fd);
+    c->fd = fd;
+    return true;
+}
+
+static bool tcp_refuse(WebServer_t* w) {
+    int fd = accept(w->fd, NULL, NULL);
+    if (fd < 0) return false;
+    send(fd, refusal, sizeof(refusal) - 1, MSG_NOSIGNAL | MSG_DONTWAIT);
+    close(fd);
+    return true;
+}
+
+static void tcp_close(WebClient_t* c) {
+    close(c->fd);
+    c->fd = -1;
+}
+
+// Bytes accepted (possibly 0), -1 if the connection is gone
+static int tcp_write(WebClient_t* c, const uint8_t* buf, uint32_t len) {
+    ssize_t n = send(c->fd, buf, len, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (n >= 0) return (int)n;
+    return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+}
+
+static int tcp_read(WebClient_t* c, uint8_t* buf, uint16_t max) {
+    ssize_t n = recv(c->fd, buf, max, MSG_DONTWAIT);
+    if (n > 0) return (int)n;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return 0;
+    return -1;
+}
+
+// ============ Helper: SHA-1 (WebSocket handshake only) ============
+static uint32_t rol32(uint32_t x, int n) {
+    return (x << n) | (x >> (32 - n));
+}
+
+static void sha1(const uint8_t* msg, uint32_t len, uint8_t out[20]) {
+    uint32_t h[5] = {0x67452301u, 0xEFCDAB89u, 0x98BADCFEu, 0x10325476u, 0xC3D2E1F0u};
+    uint64_t bits = (uint64_t)len * 8;
+    uint32_t total = (len + 9 + 63) / 64 * 64;      // Message + 0x80 + length, padded
+    for (uint32_t off = 0; off < total; off += 64) {
+        uint8_t block[64];
+        for (int i = 0; i < 64; i++) {
+            uint32_t k = off + i;
+            block[i] = k < len ? msg[k] : (k == len ? 0x80 : 0);
+        }
+        if (off + 64 == total) {
+            for (int i = 0; i < 8; i++) block[63 - i] = (uint8_t)(bits >> (8 * i));
+        }
+
+        uint32_t wv[80];
+        for (int i = 0; i < 16; i++) {
+            wv[i] = (uint32_t)block[4 * i] << 24 | (uint32_t)block[4 * i + 1] << 16 |
+                    (uint32_t)block[4 * i + 2] << 8 | block[4 * i + 3];
+        }
+        for (int i = 16; i < 80; i++) wv[i] = rol32(wv[i - 3] ^ wv[i - 8] ^ wv[i - 14] ^ wv[i - 16], 1);
+
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i = 0; i < 80; i++) {
+            uint32_t f, k;
+            if (i < 20)      { f = (b & c) | (~b & d);           k = 0x5A827999u; }
+            else if (i < 40) { f = b ^ c ^ d;                    k = 0x6ED9EBA1u; }
+            else if (i < 60) { f = (b & c) | (b & d) | (c & d);  k = 0x8F1BBCDCu; }
+            else             { f = b ^ c ^ d;                    k = 0xCA62C1D6u; }
+            uint32_t t = rol32(a, 5) + f + e + k + wv[i];
+            e = d;
+            d = c;
+            c = rol32(b, 30);
+            b = a;
+            a = t;
+        }
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    }
+    for (int i = 0; i < 20; i++) out[i] = (uint8_t)(h[i / 4] >> (24 - 8 * (i % 4)));
+}
+
+static void base64(const uint8_t* in, uint16_t len, char* out) {
+    static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (uint16_t i = 0; i < len; i += 3) {
+        uint32_t v = (uint32_t)in[i] << 16;
+        if (i + 1 < len) v |= (uint32_t)in[i + 1] << 8;
+        if (i + 2 < len) v |= in[i + 2];
+        *out++ = digits[v >> 18 & 63];
+        *out++ = digits[v >> 12 & 63];
+        *out++ = i + 1 < len ? digits[v >> 6 & 63] : '=';
+        *out++ = i + 2 < len ? digits[v & 63] : '=';
+    }
+    *out = '\0';
+}
+
+// ============ Helpers: Buffer pool and send queues ============
+// A new buffer holds one reference for its builder until queued
+static int8_t buf_alloc(WebServer_t* w) {
+    int8_t found = -1;
+    uint8_t used = 0;
+    for (int8_t i = 0; i < WEB_POOL_BUFFERS; i++) {
+        if (w->pool[i].refs) used++;
+        else if (found < 0) found = i;
+    }
+    if (found < 0) {
+        w->stats.poolExhausted++;
+        return -1;
+    }
+    w->pool[found].refs = 1;
+    if (used + 1 > w->stats.poolHigh) w->stats.poolHigh = used + 1;
+    return found;
+}
+
+static void buf_release(WebServer_t* w, int8_t b) {
+    if (b >= 0 && w->pool[b].refs) w->pool[b].refs--;
+}
+
+static bool tx_push(WebServer_t* w, WebClient_t* c, const uint8_t* data, uint32_t len, int8_t buf) {
+    if (c->txCount >= WEB_TX_DEPTH) return false;
+    WebSend_t* s = &c->tx[(c->txHead + c->txCount) % WEB_TX_DEPTH];
+    s->data = data;
+    s->len = len;
+    s->buf = buf;
+    if (buf >= 0) w->pool[buf].refs++;
+    c->txCount++;
+    return true;
+}
+
+static void close_client(WebServer_t* w, WebClient_t* c) {
+    while (c->txCount) {
+        buf_release(w, c->tx[c->txHead].buf);
+        c->txHead = (c->txHead + 1) % WEB_TX_DEPTH;
+        c->txCount--;
+    }
+    tcp_close(c);
+    c->state = WEB_FREE;
+}
+
+// ============ Helpers: Formatting into pool buffers ============
+// A single message fails when it outgrows its buffer; a reply chained to
+// a client queues each full buffer and carries on in a fresh one
+typedef struct {
+    WebServer_t* w;
+    WebClient_t* c;         // NULL: one buffer only
+    int8_t buf;
+    uint16_t start;         // First byte of the data
+    uint16_t len;           // End of the data
+    bool failed;
+} WebOut_t;
+
+static bool out_begin(WebOut_t* o, WebServer_t* w, WebClient_t* c, uint16_t headroom) {
+    o->w = w;
+    o->c = c;
+    o->buf = buf_alloc(w);
+    o->start = o->len = headroom;
+    o->failed = o->buf < 0;
+    return !o->failed;
+}
+
+// Queue the filled buffer to the client, hand the builder's reference back
+static bool out_queue(WebOut_t* o) {
+    bool ok = tx_push(o->w, o->c, o->w->pool[o->buf].data + o->start, o->len - o->start, o->buf);
+    buf_release(o->w, o->buf);
+    o->buf = -1;
+    return ok;
+}
+
+static void out_printf(WebOut_t* o, const char* fmt, ...) {
+    for (bool fresh = false; !o->failed; fresh = true) {
+        char* p = (char*)o->w->pool[o->buf].data + o->len;
+        uint16_t room = WEB_BUF_BYTES - o->len;
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(p, room, fmt, ap);
+        va_end(ap);
+        if (n >= 0 && n < room) {
+            o->len += n;
+            return;
+        }
+        if (!o->c || fresh || !out_queue(o) || !out_begin(o, o->w, o->c, 0)) o->failed = true;
+    }
+}
+
+// Room for need more bytes, in a fresh buffer if this one is full
+static char* out_reserve(WebOut_t* o, uint32_t need) {
+    if (!o->failed && (uint32_t)(WEB_BUF_BYTES - o->len) < need) {
+        if (!o->c || !out_queue(o) || !out_begin(o, o->w, o->c, 0) || WEB_BUF_BYTES < need) o->failed = true;
+    }
+    return o->failed ? NULL : (char*)o->w->pool[o->buf].data + o->len;
+}
+
+// Quoted and escaped straight into the buffer; control characters dropped
+static void out_string(WebOut_t* o, const char* s) {
+    uint32_t len = s ? (uint32_t)strlen(s) : 0;
+    char* start = out_reserve(o, 2 * len + 2);
+    if (!start) return;
+    char* p = start;
+    *p++ = '"';
+    for (uint32_t i = 0; i < len; i++) {
+        if (s[i] == '"' || s[i] == '\\') *p++ = '\\';
+        if ((uint8_t)s[i] >= 0x20) *p++ = s[i];
+    }
+    *p++ = '"';
+    o->len += (uint16_t)(p - start);
+}
+
+// ============ Snapshot sections (payloads as on the MQTT topics) ============
+static void put_status(WebOut_t* o, const WebServer_t* w, const LiveSnapshot_t* s) {
+    out_printf(o, ",\"status\":{\"device\":");
+    out_string(o, w->deviceId);
+    out_printf(o, ",\"running\":%s,\"online\":true,\"demo\":\"%s\",\"scenario\":",
+               s->running ? "true" : "false", demoKeys[s->demo]);
+    out_string(o, s->scenarioName);
+    out_printf(o, "}");
+}
+
+static void put_sensors(WebOut_t* o, const LiveSnapshot_t* s) {
+    out_printf(o, ",\"sensors\":[");
+    for (int i = 0; i < 3; i++) {
+        out_printf(o, "%s{\"value\":%.*f}", i ? "," : "", s->decimals[i], s->sensors[i]);
+    }
+    out_printf(o, "]");
+}
+
+static void put_kpis(WebOut_t* o, const LiveSnapshot_t* s) {
+    out_printf(o, ",\"kpis\":[");
+    for (int i = 0; i < 4; i++) {
+        const LiveKpi_t* k = &s->kpis[i];
+        out_printf(o, "%s{\"label\":", i ? "," : "");
+        out_string(o, k->label);
+        out_printf(o, ",\"value\":");
+        out_string(o, k->value);
+        out_printf(o, ",\"unit\":");
+        out_string(o, k->unit);
+        out_printf(o, ",\"good\":%s}", k->good ? "true" : "false");
+    }
+    out_printf(o, "]");
+}
+
+static void put_bits(WebOut_t* o, const bool* b) {
+    out_printf(o, "[%d,%d,%d,%d,%d,%d,%d,%d]", b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7]);
+}
+
+static void put_vision(WebOut_t* o, const LiveSnapshot_t* s) {
+    const LiveVision_t* lv = &s->vision;
+    const Vision_t* v = &lv->v;
+    out_printf(o, ",\"vision\":");
+    switch (v->type) {
+        case VISION_CNC: {
+            const bool leds[8] = {v->leds.run, v->leds.feed, v->leds.spindle, v->leds.coolant,
+                                  v->leds.program, v->leds.error, v->leds.fault, v->leds.ready};
+            out_printf(o, "{\"partCount\":%u", v->partCount);
+            if (lv->stackLight[0]) {
+                out_printf(o, ",\"stackLight\":");
+                out_string(o, lv->stackLight);
+            }
+            out_printf(o, ",\"leds\":{");
+            for (int i = 0; i < 8; i++) {
+                out_printf(o, "%s\"%s\":%s", i ? "," : "", cncLedKeys[i], leds[i] ? "true" : "false");
+            }
+            out_printf(o, "}}");
+            break;
+        }
+        case VISION_CHILLER:
+            out_printf(o, "{\"errorCode\":");
+            out_string(o, lv->errorCode);
+            out_printf(o, "}");
+            break;
+        case VISION_COMPRESSOR:
+            out_printf(o, "{\"pressure\":%.1f,\"oilTemp\":%.0f,\"state\":", v->pressure, v->oilTemp);
+            out_string(o, lv->state);
+            out_printf(o, "}");
+            break;
+        default:
+            out_printf(o, "{\"diA\":");
+            put_bits(o, v->diA);
+            out_printf(o, ",\"dqA\":");
+            put_bits(o, v->dqA);
+            out_printf(o, ",\"aq0\":%u}", v->aq0);
+            break;
+    }
+}
+
+// Newest first, as the dashboard lists them
+static void put_alarms(WebOut_t* o, const LiveSnapshot_t* s) {
+    out_printf(o, ",\"alarms\":[");
+    for (int i = s->alarmCount - 1; i >= 0; i--) {
+        const AlarmEntry_t* e = &s->alarms[i];
+        uint32_t t = e->raisedAt;
+        out_printf(o, "%s{\"id\":%lu,\"sev\":\"%s\",\"msg\":", i == s->alarmCount - 1 ? "" : ",",
+                   (unsigned long)e->logSeq, alarm_severity_name(alarm_severity((AlarmCode_t)e->code)));
+        out_string(o, alarm_message((AlarmCode_t)e->code));
+        out_printf(o, ",\"time\":\"%02lu:%02lu:%02lu\",\"acked\":%s}",
+                   (unsigned long)(t / 3600 % 24), (unsigned long)(t / 60 % 60), (unsigned long)(t % 60),
+                   (e->flags & ALARM_FLAG_ACKED) ? "true" : "false");
+    }
+    out_printf(o, "]");
+}
+
+// One text frame holding the given sections; returns its pool buffer (the
+// builder's reference, to be released once queued) or -1
+static int8_t build_message(WebServer_t* w, const LiveSnapshot_t* s, uint8_t sections,
+                            const uint8_t** frame, uint32_t* frameLen) {
+    unsigned long t0 = micros();
+    WebOut_t o;
+    if (!out_begin(&o, w, NULL, WEB_WS_HEADROOM)) return -1;
+    out_printf(&o, "{\"seq\":%lu,\"t\":%lu", (unsigned long)s->seq, (unsigned long)s->clock);
+    if (sections & LIVE_STATUS) put_status(&o, w, s);
+    if (sections & LIVE_SENSORS) put_sensors(&o, s);
+    if (sections & LIVE_KPIS) put_kpis(&o, s);
+    if (sections & LIVE_VISION) put_vision(&o, s);
+    if (sections & LIVE_ALARMS) put_alarms(&o, s);
+    out_printf(&o, "}");
+    if (o.failed) {
+        buf_release(w, o.buf);
+        return -1;
+    }
+
+    // Frame header written back into the headroom: no copy of the payload
+    uint32_t n = o.len - o.start;
+    uint8_t hdr = n < 126 ? 2 : 4;
+    uint8_t* h = w->pool[o.buf].data + o.start - hdr;
+    h[0] = 0x80 | WS_OP_TEXT;
+    if (hdr == 2) {
+        h[1] = (uint8_t)n;
+    } else {
+        h[1] = 126;
+        h[2] = (uint8_t)(n >> 8);
+        h[3] = (uint8_t)n;
+    }
+    *frame = h;
+    *frameLen = n + hdr;
+
+    WebStats_t* st = &w->stats;
+    st->messages++;
+    if (sections == LIVE_ALL) st->fullMessages++;
+    st->lastBuildUs = (uint32_t)(micros() - t0);
+    st->avgBuildUs = (st->avgBuildUs == 0.0f) ? st->lastBuildUs : st->avgBuildUs * 0.95f + st->lastBuildUs * 0.05f;
+    return o.buf;
+}
+
+// Small control frame (close / pong) with up to 125 payload bytes
+static bool send_control(WebServer_t* w, WebClient_t* c, uint8_t op, const uint8_t* payload, uint8_t len) {
+    int8_t b = buf_alloc(w);
+    if (b < 0) return false;
+    uint8_t* p = w->pool[b].data;
+    p[0] = 0x80 | op;
+    p[1] = len;
+    memcpy(p + 2, payload, len);
+    bool ok = tx_push(w, c, p, 2 + len, b);
+    buf_release(w, b);
+    return ok;
+}
+
+// ============ Helper: Live state to the sockets ============
+static void send_live(WebServer_t* w) {
+    const LiveSnapshot_t* s = live_latest(w->live);
+    if (s->seq == 0) return;
+
+    if (s->seq != w->liveSeq) {
+        // A publish this server never saw leaves the change mask short
+        uint8_t sections = (s->seq == w->liveSeq + 1) ? w->live->changed : LIVE_ALL;
+        w->liveSeq = s->seq;
+
+        bool any = false;
+        for (int i = 0; i < WEB_MAX_CLIENTS; i++) {
+            WebClient_t* c = &w->clients[i];
+            if (c->state != WEB_SOCKET || c->needFull) continue;
+            if (c->txCount >= WEB_TX_DEPTH) {
+                c->needFull = true;
+                w->stats.skipped++;
+            } else {
+                any = true;
+            }
+        }
+
+        const uint8_t* frame;
+        uint32_t len;
+        int8_t b = (any && sections) ? build_message(w, s, sections, &frame, &len) : -1;
+        for (int i = 0; any && sections && i < WEB_MAX_CLIENTS; i++) {
+            WebClient_t* c = &w->clients[i];
+            if (c->state != WEB_SOCKET || c->needFull) continue;
+            if (b >= 0 && tx_push(w, c, frame, len, b)) {
+                w->stats.frames++;
+            } else {
+                c->needFull = true;
+                w->stats.skipped++;
+            }
+        }
+        buf_release(w, b);
+    }
+
+    // New clients and those that fell behind share one full message
+    bool want = false;
+    for (int i = 0; i < WEB_MAX_CLIENTS; i++) {
+        const WebClient_t* c = &w->clients[i];
+        if (c->state == WEB_SOCKET && c->needFull && c->txCount < WEB_TX_DEPTH) want = true;
+    }
+    if (!want) return;
+    const uint8_t* frame;
+    uint32_t len;
+    int8_t b = build_message(w, s, LIVE_ALL, &frame, &len);
+    if (b < 0) return;
+    for (int i = 0; i < WEB_MAX_CLIENTS; i++) {
+        WebClient_t* c = &w->clients[i];
+        if (c->state != WEB_SOCKET || !c->needFull) continue;
+        if (tx_push(w, c, frame, len, b)) {
+            c->needFull = false;
+            w->stats.frames++;
+        }
+    }
+    buf_release(w, b);
+}
+
+// ============ Helpers: HTTP requests ============
+// Value of a header in the request head (name without the colon)
+static bool header_value(const char* head, const char* name, char* out, uint16_t cap) {
+    size_t nameLen = strlen(name);
+    for (const char* line = strstr(head, "\r\n"); line; line = strstr(line, "\r\n")) {
+        line += 2;
+        if (strncasecmp(line, name, nameLen) != 0 || line[nameLen] != ':') continue;
+        const char* v = line + nameLen + 1;
+        while (*v == ' ' || *v == '\t') v++;
+        uint16_t n = 0;
+        while (v[n] && v[n] != '\r' && n + 1 < cap) {
+            out[n] = v[n];
+            n++;
+        }
+        out[n] = '\0';
+        return true;
+    }
+    return false;
+}
+
+static uint32_t query_uint(const char* query, const char* name, uint32_t def) {
+    size_t nameLen = strlen(name);
+    for (const char* p = query; p && *p; p = strchr(p, '&')) {
+        if (*p == '&') p++;
+        if (strncmp(p, name, nameLen) == 0 && p[nameLen] == '=') return strtoul(p + nameLen + 1, NULL, 10);
+    }
+    return def;
+}
+
+// Headers-only reply, connection closed once it is out
+static void reply_status(WebServer_t* w, WebClient_t* c, const char* status) {
+    WebOut_t o;
+    if (!out_begin(&o, w, c, 0)) {
+        close_client(w, c);
+        return;
+    }
+    out_printf(&o, "HTTP/1.1 %s\r\nContent-Length: 0\r\nConnection: close\r\n\r\n", status);
+    out_queue(&o);
+    c->state = WEB_RESPONSE;
+}
+
+static void reply_error(WebServer_t* w, WebClient_t* c, const char* status) {
+    w->stats.errors++;
+    reply_status(w, c, status);
+}
+
+// index.html from flash. Always gzip: every browser that can run the
+// dashboard accepts it.
+static void serve_page(WebServer_t* w, WebClient_t* c, const char* head) {
+    char tag[24];
+    if (header_value(head, "If-None-Match", tag, sizeof(tag)) && strcmp(tag, WEB_INDEX_ETAG) == 0) {
+        w->stats.notModified++;
+        reply_status(w, c, "304 Not Modified");
+        return;
+    }
+    WebOut_t o;
+    if (!out_begin(&o, w, c, 0)) {
+        close_client(w, c);
+        return;
+    }
+    out_printf(&o, "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\n"
+                   "Content-Encoding: gzip\r\nContent-Length: %lu\r\nCache-Control: no-cache\r\n"
+                   "ETag: %s\r\nConnection: close\r\n\r\n",
+               (unsigned long)sizeof(webIndexGz), WEB_INDEX_ETAG);
+    out_queue(&o);
+    tx_push(w, c, webIndexGz, sizeof(webIndexGz), -1);
+    c->state = WEB_RESPONSE;
+    w->stats.pages++;
+}
+
+// Rolled-up trends of the running machine's sensors, oldest bucket first:
+// {"t":clock,"demo":key,"period":s,"sensors":[[mean|null,...],x3]}
+static void serve_history(WebServer_t* w, WebClient_t* c, const char* query) {
+    const LiveSnapshot_t* s = live_latest(w->live);
+    uint32_t span = query_uint(query, "span", WEB_HISTORY_SPAN_S);
+    uint32_t points = query_uint(query, "n", WEB_HISTORY_POINTS);
+    if (span == 0) span = 1;
+    if (points == 0 || points > WEB_HISTORY_POINTS) points = WEB_HISTORY_POINTS;
+
+    WebOut_t o;
+    if (!out_begin(&o, w, c, 0)) {
+        close_client(w, c);
+        return;
+    }
+    out_printf(&o, "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nCache-Control: no-store\r\n"
+                   "Connection: close\r\n\r\n");
+    uint32_t period = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        uint16_t n = sim_get_trend(i, span, w->trend, (uint16_t)points, &period);
+        if (i == 0) {
+            out_printf(&o, "{\"t\":%lu,\"demo\":\"%s\",\"period\":%lu,\"sensors\":[",
+                       (unsigned long)sim_get_clock(), demoKeys[s->demo], (unsigned long)period);
+        }
+        out_printf(&o, "%s[", i ? "," : "");
+        for (uint16_t k = 0; k < n; k++) {
+            const RollupBucket_t* b = &w->trend[k];
+            if (b->count) out_printf(&o, "%s%.*f", k ? "," : "", s->decimals[i] + 1, b->mean);
+            else out_printf(&o, "%snull", k ? "," : "");
+        }
+        out_printf(&o, "]");
+    }
+    out_printf(&o, "]}");
+    if (o.failed || !out_queue(&o)) {
+        // Out of buffers or queue slots partway: a cut-off reply is worse than none
+        if (o.buf >= 0) buf_release(w, o.buf);
+        close_client(w, c);
+        return;
+    }
+    c->state = WEB_RESPONSE;
+    w->stats.history++;
+}
+
+// Full-rate history of the running machine as CSV, oldest first:
+// t,<sensor>,<sensor>,<sensor>. Headers and the column line go out here;
+// export_fill() streams the samples.
+static void serve_export(WebServer_t* w, WebClient_t* c, const char* query) {
+    const LiveSnapshot_t* s = live_latest(w->live);
+    uint32_t oldest = 0, newest = 0;
+    hblock_time_range(sim_get_history_block(), &oldest, &newest);
+    uint32_t to = query_uint(query, "to", newest);
+    uint32_t from = query_uint(query, "from", to > WEB_EXPORT_SPAN_S ? to - WEB_EXPORT_SPAN_S : 0);
+    if (from > to) {
+        reply_error(w, c, "400 Bad Request");
+        return;
+    }
+
+    WebOut_t o;
+    if (!out_begin(&o, w, c, 0)) {
+        close_client(w, c);
+        return;
+    }
+    DemoProfile_t* demo = sim_get_demo();
+    out_printf(&o, "HTTP/1.1 200 OK\r\nContent-Type: text/csv\r\nCache-Control: no-store\r\n"
+                   "Content-Disposition: attachment; filename=\"%s-%lu-%lu.csv\"\r\n"
+                   "Connection: close\r\n\r\nt,%s,%s,%s\n",
+               demoKeys[s->demo], (unsigned long)from, (unsigned long)to,
+               demo->sensors[0].name, demo->sensors[1].name, demo->sensors[2].name);
+    if (o.failed || !out_queue(&o)) {
+        if (o.buf >= 0) buf_release(w, o.buf);
+        close_client(w, c);
+        return;
+    }
+    c->state = WEB_EXPORT;
+    c->exportBlock = sim_get_history_block();
+    c->exportNext = from;
+    c->exportEnd = to;
+    w->stats.exports++;
+}
+
+// ============ Helper: Stream an export ============
+// Tops the client's queue up to WEB_EXPORT_BUFFERS, a pool buffer of lines
+// at a time. Each buffer seeks afresh from the next sample time, so no
+// reader is held across polls while the block takes new samples; a
+// machine switch ends the reply where it is.
+#define WEB_EXPORT_LINE     64      // Room kept for one more line
+
+static void export_fill(WebServer_t* w, WebClient_t* c) {
+    const LiveSnapshot_t* s = live_latest(w->live);
+    while (c->state == WEB_EXPORT && c->txCount < WEB_EXPORT_BUFFERS) {
+        HBlockIter_t it;
+        if (sim_get_history_block() != c->exportBlock || c->exportNext > c->exportEnd ||
+            !hblock_seek_time(c->exportBlock, &it, c->exportNext)) {
+            c->state = WEB_RESPONSE;
+            return;
+        }
+        WebOut_t o;
+        if (!out_begin(&o, w, c, 0)) return;    // Pool busy: next poll
+
+        uint32_t t;
+        float v[HBLOCK_SERIES];
+        bool more = true;
+        while (WEB_BUF_BYTES - o.len >= WEB_EXPORT_LINE) {
+            if (!hblock_next(&it, &t, v) || t > c->exportEnd) {
+                more = false;
+                break;
+            }
+            out_printf(&o, "%lu,%.*f,%.*f,%.*f\n", (unsigned long)t, s->decimals[0] + 1, v[0],
+                       s->decimals[1] + 1, v[1], s->decimals[2] + 1, v[2]);
+            c->exportNext = t + 1;
+            w->stats.exportSamples++;
+        }
+        if (o.len > 0) {
+            out_queue(&o);
+        } else {
+            buf_release(w, o.buf);
+        }
+        if (!more) c->state = WEB_RESPONSE;
+    }
+}
+
+static void upgrade(WebServer_t* w, WebClient_t* c, const char* head) {
+    char value[WS_KEY_LEN];
+    char key[WS_KEY_LEN + sizeof(WS_GUID)];
+    if (!header_value(head, "Upgrade", value, sizeof(value)) || strcasecmp(value, "websocket") != 0 ||
+        !header_value(head, "Sec-WebSocket-Key", key, WS_KEY_LEN)) {
+        reply_error(w, c, "400 Bad Request");
+        return;
+    }
+    strcat(key, WS_GUID);
+    uint8_t digest[20];
+    char accept[32];
+    sha1((const uint8_t*)key, (uint32_t)strlen(key), digest);
+    base64(digest, sizeof(digest), accept);
+
+    WebOut_t o;
+    if (!out_begin(&o, w, c, 0)) {
+        close_client(w, c);
+        return;
+    }
+    out_printf(&o, "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                   "Sec-WebSocket-Accept: %s\r\n\r\n", accept);
+    out_queue(&o);
+    c->state = WEB_SOCKET;
+    c->needFull = true;
+    c->rxLen = 0;
+    w->stats.upgrades++;
+}
+
+static void handle_request(WebServer_t* w, WebClient_t* c, char* head) {
+    w->stats.requests++;
+    if (strncmp(head, "GET ", 4) != 0) {
+        reply_error(w, c, "405 Method Not Allowed");
+        return;
+    }
+    char* path = head + 4;
+    char* end = strchr(path, ' ');
+    if (!end) {
+        reply_error(w, c, "400 Bad Request");
+        return;
+    }
+    *end = '\0';
+    char* query = strchr(path, '?');
+    if (query) *query++ = '\0';
+    const char* headers = end + 1;
+
+    if (strcmp(path, "/") == 0 || strcmp(path, "/index.html") == 0) serve_page(w, c, headers);
+    else if (strcmp(path, "/history") == 0) serve_history(w, c, query);
+    else if (strcmp(path, "/history/raw") == 0) serve_export(w, c, query);
+    else if (strcmp(path, "/ws") == 0) upgrade(w, c, headers);
+    else reply_error(w, c, "404 Not Found");
+}
+
+// ============ Helpers: Reading ============
+static void read_request(WebServer_t* w, WebClient_t* c, uint32_t now) {
+    int n = tcp_read(c, c->rx + c->rxLen, WEB_RX_BYTES - 1 - c->rxLen);
+    if (n < 0) {
+        close_client(w, c);
+        return;
+    }
+    c->rxLen += n;
+    c->rx[c->rxLen] = '\0';
+    char* end = strstr((char*)c->rx, "\r\n\r\n");
+    if (end) {
+        end[2] = '\0';      // Keep the last header's line break for header_value
+        handle_request(w, c, (char*)c->rx);
+    } else if (c->rxLen >= WEB_RX_BYTES - 1) {
+        reply_error(w, c, "431 Request Header Fields Too Large");
+    } else if (now - c->sinceMs > WEB_REQUEST_TIMEOUT_MS) {
+        close_client(w, c);
+    }
+}
+
+// Client frames: answer close and ping, ignore the rest
+static void read_frames(WebServer_t* w, WebClient_t* c) {
+    int n = tcp_read(c, c->rx + c->rxLen, WEB_RX_BYTES - c->rxLen);
+    if (n < 0) {
+        close_client(w, c);
+        return;
+    }
+    c->rxLen += n;
+
+    while (c->rxLen >= 2) {
+        uint8_t op = c->rx[0] & 0x0F;
+        uint32_t len = c->rx[1] & 0x7F;
+        uint16_t hdr = 2;
+        if (len == 126) {
+            if (c->rxLen < 4) return;
+            len = (uint32_t)c->rx[2] << 8 | c->rx[3];
+            hdr = 4;
+        } else if (len == 127) {
+            len = WEB_RX_BYTES;     // Never that large from the dashboard
+        }
+        bool masked = c->rx[1] & 0x80;
+        if (masked) hdr += 4;
+        if (hdr + len > WEB_RX_BYTES) {
+            close_client(w, c);
+            return;
+        }
+        if (c->rxLen < hdr + len) return;
+
+        uint8_t* payload = c->rx + hdr;
+        if (masked) {
+            const uint8_t* mask = payload - 4;
+            for (uint32_t i = 0; i < len; i++) payload[i] ^= mask[i & 3];
+        }
+        if (op == WS_OP_CLOSE && c->state == WEB_SOCKET) {
+            send_control(w, c, WS_OP_CLOSE, payload, len >= 2 ? 2 : 0);
+            c->state = WEB_CLOSING;
+        } else if (op == WS_OP_PING && len <= 125 && c->state == WEB_SOCKET) {
+            send_control(w, c, WS_OP_PONG, payload, (uint8_t)len);
+        }
+        c->rxLen -= hdr + len;
+        memmove(c->rx, c->rx + hdr + len, c->rxLen);
+    }
+}
+
+// ============ Helper: Hand queued sends to the socket ============
+static void flush(WebServer_t* w, WebClient_t* c) {
+    uint32_t budget = WEB_WRITE_BUDGET;
+    while (c->txCount && budget) {
+        const WebSend_t* s = &c->tx[c->txHead];
+        uint32_t left = s->len - c->txOff;
+        if (left > budget) left = budget;
+        int n = tcp_write(c, s->data + c->txOff, left);
+        if (n < 0) {
+            close_client(w, c);
+            return;
+        }
+        if (n == 0) return;
+        c->txOff += n;
+        budget -= n;
+        w->stats.bytesOut += n;
+        if (c->txOff < s->len) continue;
+        buf_release(w, s->buf);
+        c->txHead = (c->txHead + 1) % WEB_TX_DEPTH;
+        c->txCount--;
+        c->txOff = 0;
+    }
+    if (c->txCount == 0 && (c->state == WEB_RESPONSE || c->state == WEB_CLOSING)) close_client(w, c);
+}
+
+// ============ Public API ============
+bool web_begin(WebServer_t* w, uint16_t port, const LiveState_t* live, const char* deviceId) {
+    for (int i = 0; i < WEB_MAX_CLIENTS; i++) w->clients[i].state = WEB_FREE;
+    for (int i = 0; i < WEB_POOL_BUFFERS; i++) w->pool[i].refs = 0;
+    memset(&w->stats, 0, sizeof(w->stats));
+    w->live = live;
+    w->deviceId = deviceId;
+    w->liveSeq = 0;
+    w->listening = tcp_listen(w, port);
+    return w->listening;
+}
+
+void web_poll(WebServer_t* w, uint32_t nowMs) {
+    if (!w->listening) return;
+
+    // New connections into free slots, 503 for the rest
+    for (;;) {
+        WebClient_t* c = NULL;
+        for (int i = 0; i < WEB_MAX_CLIENTS && !c; i++) {
+            if (w->clients[i].state == WEB_FREE) c = &w->clients[i];
+        }
+        if (!c) {
+            while (tcp_refuse(w)) w->stats.refused++;
+            break;
+        }
+        if (!tcp_accept(w, c)) break;
+        c->state = WEB_REQUEST;
+        c->sinceMs = nowMs;
+        c->rxLen = 0;
+        c->txHead = c->txCount = 0;
+        c->txOff = 0;
+        c->needFull = false;
+        w->stats.accepted++;
+    }
+
+    for (int i = 0; i < WEB_MAX_CLIENTS; i++) {
+        WebClient_t* c = &w->clients[i];
+        if (c->state == WEB_REQUEST) read_request(w, c, nowMs);
+        else if (c->state == WEB_SOCKET || c->state == WEB_CLOSING) read_frames(w, c);
+    }
+
+    send_live(w);
+
+    for (int i = 0; i < WEB_MAX_CLIENTS; i++) {
+        if (w->clients[i].state == WEB_EXPORT) export_fill(w, &w->clients[i]);
+        if (w->clients[i].state != WEB_FREE) flush(w, &w->clients[i]);
+    }
+}
+
+void web_stop(WebServer_t* w) {
+    for (int i = 0; i < WEB_MAX_CLIENTS; i++) {
+        if (w->clients[i].state != WEB_FREE) close_client(w, &w->clients[i]);
+    }
+    if (w->listening) tcp_unlisten(w);
+    w->listening = false;
+}
+
+uint8_t web_sockets(const WebServer_t* w) {
+    uint8_t n = 0;
+    for (int i = 0; i < WEB_MAX_CLIENTS; i++) {
+        if (w->clients[i].state == WEB_SOCKET) n++;
+    }
+    return n;
+}
+
+const WebStats_t* web_get_stats(const WebServer_t* w) {
+    return &w->stats;
+}
@@ -0,0 +1,127 @@
+// SIGNALTAP Web Server
+// The dashboard, served by the device itself: GET / returns index.html,
+// gzip-compressed at build time (tools/web_pack.py -> web_index.h) and sent
+// straight out of flash; GET /history returns the rolled-up sensor trends
+// for the charts' initial load; GET /history/raw streams the full-rate
+// history block as CSV (from/to in the samples' seconds, default the last
+// hour held), a pool buffer or two at a time as the socket takes it; GET
+// /ws upgrades to a WebSocket that carries the live state, one JSON
+// message per published snapshot holding the sections that changed (a
+// client's first message holds them all).
+//
+// Memory is fixed: a set of client slots and a pool of send buffers. A
+// message is formatted once, straight from the snapshot into a pool
+// buffer behind room for the frame header, and every socket client queues
+// a reference to that same buffer; the last one to send it frees it. A
+// client whose send queue is full skips messages and gets a full one as
+// soon as it has room again, so a slow reader costs nobody else anything.
+// Connections past the slot count are refused with 503. The transport is
+// non-blocking sockets on both builds (lwIP on the device): a send takes
+// what the socket has room for and the rest stays queued in its buffer,
+// and the same code can be load-tested over loopback.
+#ifndef WEB_SERVER_H
+#define WEB_SERVER_H
+
+#include <Arduino.h>
+#include "live_state.h"
+
+#define WEB_MAX_CLIENTS         6
+#define WEB_POOL_BUFFERS        16
+#define WEB_BUF_BYTES           2048
+#define WEB_TX_DEPTH            6       // Sends queued per client
+#define WEB_RX_BYTES            1024    // Request head / inbound frames
+#define WEB_WS_HEADROOM         4       // Frame header room ahead of each message
+#define WEB_HISTORY_POINTS      180     // Buckets per sensor in a /history reply
+#define WEB_HISTORY_SPAN_S      120     // Default /history span
+#define WEB_EXPORT_SPAN_S       3600    // Default /history/raw span
+#define WEB_EXPORT_BUFFERS      2       // Pool buffers an export keeps queued
+#define WEB_REQUEST_TIMEOUT_MS  5000
+
+typedef enum {
+    WEB_FREE = 0,
+    WEB_REQUEST,            // Reading the request head
+    WEB_RESPONSE,           // Sending a reply, closing once it is out
+    WEB_EXPORT,             // Streaming /history/raw, refilled as it drains
+    WEB_SOCKET,             // WebSocket open
+    WEB_CLOSING             // Close frame queued, closing once it is out
+} WebClientState_t;
+
+typedef struct {
+    const uint8_t* data;
+    uint32_t len;
+    int8_t buf;             // Pool buffer holding data, -1 for flash
+} WebSend_t;
+
+typedef struct {
+    uint8_t data[WEB_BUF_BYTES];
+    uint8_t refs;           // Send queues holding it; 0 = free
+} WebBuf_t;
+
+typedef struct {
+    int fd;
+    uint8_t state;          // WebClientState_t
+    uint32_t sinceMs;       // Accepted (request timeout)
+    uint8_t rx[WEB_RX_BYTES];
+    uint16_t rxLen;
+    WebSend_t tx[WEB_TX_DEPTH];
+    uint8_t txHead;
+    uint8_t txCount;
+    uint32_t txOff;         // Bytes of tx[txHead] already sent
+    bool needFull;          // Next message carries every section
+    const HistoryBlock_t* exportBlock;  // Machine being exported
+    uint32_t exportNext;    // Next sample time to send
+    uint32_t exportEnd;     // Last sample time to send
+} WebClient_t;
+
+typedef struct {
+    uint32_t accepted;
+    uint32_t refused;       // No free slot
+    uint32_t requests;
+    uint32_t pages;         // index.html sent (200)
+    uint32_t notModified;   // index.html still cached (304)
+    uint32_t history;
+    uint32_t exports;       // /history/raw replies started
+    uint32_t exportSamples; // Samples sent in them
+    uint32_t errors;        // 4xx / 5xx replies
+    uint32_t upgrades;
+    uint32_t messages;      // Snapshot messages formatted
+    uint32_t fullMessages;  // Of which every section, for new or lagging clients
+    uint32_t frames;        // Messages queued to clients
+    uint32_t skipped;       // Messages a client's full queue missed
+    uint32_t poolExhausted; // Messages or replies not sent for want of a buffer
+    uint32_t bytesOut;
+    uint8_t poolHigh;       // Most buffers in use at once
+    uint32_t lastBuildUs;   // Formatting one snapshot message
+    float avgBuildUs;
+} WebStats_t;
+
+typedef struct {
+    int fd;                 // Listening socket
+    bool listening;
+    const LiveState_t* live;
+    const char* deviceId;
+    uint32_t liveSeq;       // Last snapshot sent
+    WebClient_t clients[WEB_MAX_CLIENTS];
+    WebBuf_t pool[WEB_POOL_BUFFERS];
+    RollupBucket_t trend[WEB_HISTORY_POINTS];
+    WebStats_t stats;
+} WebServer_t;
+
+// ============ Public API ============
+
+// Listen on port; snapshots come from live (published by the caller),
+// deviceId goes into the status section
+bool web_begin(WebServer_t* w, uint16_t port, const LiveState_t* live, const char* deviceId);
+
+// Accept, serve requests, send the latest snapshot to the sockets and
+// write out what the clients' sockets take. Never blocks; call every
+// loop pass.
+void web_poll(WebServer_t* w, uint32_t nowMs);
+
+void web_stop(WebServer_t* w);
+
+// WebSockets open
+uint8_t web_sockets(const WebServer_t* w);
+const WebStats_t* web_get_stats(const WebServer_t* w);
+
+#endif // WEB_SERVER_H
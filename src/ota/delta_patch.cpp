@@ -0,0 +1,203 @@
+// SIGNALTAP Delta Patch Implementation
+#include "delta_patch.h"
+#include <string.h>
+
+typedef enum {
+    S_HEADER = 0,
+    S_OP,
+    S_LEN,                  // Varint length
+    S_ARG,                  // Varint SRC offset / TGT distance
+    S_COPY,
+    S_END,
+    S_ERROR
+} DpState_t;
+
+#define WINDOW_MASK         (DP_WINDOW_BYTES - 1)
+
+// ============ Helper: Header ============
+static uint32_t get_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static void put_u32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static bool parse_header(DpDecoder_t* d) {
+    DpHeader_t* h = &d->header;
+    const uint8_t* p = d->hdr;
+    h->magic = get_u32(p);
+    h->version = (uint16_t)(p[4] | p[5] << 8);
+    h->windowBits = (uint16_t)(p[6] | p[7] << 8);
+    h->srcSize = get_u32(p + 8);
+    h->dstSize = get_u32(p + 12);
+    memcpy(h->srcSha, p + 16, SHA256_BYTES);
+    memcpy(h->dstSha, p + 16 + SHA256_BYTES, SHA256_BYTES);
+    return h->magic == DP_MAGIC && h->version == DP_VERSION && h->windowBits <= DP_WINDOW_BITS;
+}
+
+// ============ Helper: Output ============
+// Into the window ring as well, for later TGT copies
+static void keep(DpDecoder_t* d, const uint8_t* p, uint32_t n) {
+    if (n > DP_WINDOW_BYTES) {
+        // Only the last window's worth can be copied from again
+        d->outPos += n - DP_WINDOW_BYTES;
+        p += n - DP_WINDOW_BYTES;
+        n = DP_WINDOW_BYTES;
+    }
+    uint32_t at = d->outPos & WINDOW_MASK;
+    uint32_t first = DP_WINDOW_BYTES - at < n ? DP_WINDOW_BYTES - at : n;
+    memcpy(d->window + at, p, first);
+    memcpy(d->window, p + first, n - first);
+    d->outPos += n;
+}
+
+// Op length and argument read: check the copy against both images
+static bool start_copy(DpDecoder_t* d) {
+    if (d->len > d->header.dstSize - d->outPos) return false;
+    if (d->op == DP_OP_SRC) return d->srcPos <= d->header.srcSize && d->len <= d->header.srcSize - d->srcPos;
+    if (d->op == DP_OP_TGT) return d->dist >= 1 && d->dist <= (1u << d->header.windowBits) && d->dist <= d->outPos;
+    return true;
+}
+
+// ============ Public API ============
+void dp_init(DpDecoder_t* d, DpReadFn readSrc, void* ctx) {
+    d->state = S_HEADER;
+    d->hdrLen = 0;
+    d->srcPos = 0;
+    d->outPos = 0;
+    d->readSrc = readSrc;
+    d->ctx = ctx;
+}
+
+DpResult_t dp_decode(DpDecoder_t* d, const uint8_t* in, uint32_t inLen, uint32_t* inUsed,
+                     uint8_t* out, uint32_t outCap, uint32_t* outLen) {
+    uint32_t ip = 0, op = 0;
+    DpResult_t result = DP_MORE;
+
+    for (;;) {
+        if (d->state == S_COPY) {
+            uint32_t n = d->len < outCap - op ? d->len : outCap - op;
+            if (d->op == DP_OP_LIT && n > inLen - ip) n = inLen - ip;
+            if (n == 0) break;
+            uint8_t* dst = out + op;
+            if (d->op == DP_OP_LIT) {
+                memcpy(dst, in + ip, n);
+                ip += n;
+            } else if (d->op == DP_OP_SRC) {
+                if (!d->readSrc(d->ctx, d->srcPos, dst, n)) {
+                    d->state = S_ERROR;
+                    continue;
+                }
+                d->srcPos += n;
+            }
+            if (d->op != DP_OP_TGT) {
+                keep(d, dst, n);
+            } else {
+                // Byte by byte: a run repeats what it has just written
+                uint32_t from = d->outPos - d->dist;
+                for (uint32_t i = 0; i < n; i++) {
+                    uint8_t b = d->window[(from + i) & WINDOW_MASK];
+                    dst[i] = b;
+                    d->window[(d->outPos + i) & WINDOW_MASK] = b;
+                }
+                d->outPos += n;
+            }
+            op += n;
+            d->len -= n;
+            if (d->len == 0) d->state = S_OP;
+            continue;
+        }
+        if (d->state == S_END) {
+            result = DP_DONE;
+            break;
+        }
+        if (d->state == S_ERROR) {
+            result = DP_ERROR;
+            break;
+        }
+        if (ip == inLen) break;
+
+        uint8_t b = in[ip++];
+        switch (d->state) {
+        case S_HEADER:
+            d->hdr[d->hdrLen++] = b;
+            if (d->hdrLen < DP_HEADER_BYTES) break;
+            if (!parse_header(d)) {
+                d->state = S_ERROR;
+                break;
+            }
+            d->state = S_OP;
+            *inUsed = ip;
+            *outLen = op;
+            return DP_HEADER;
+
+        case S_OP:
+            if (b == DP_OP_END) {
+                d->state = d->outPos == d->header.dstSize ? S_END : S_ERROR;
+                break;
+            }
+            d->op = b & 0xC0;
+            if (d->op == 0xC0) {
+                d->state = S_ERROR;
+                break;
+            }
+            d->len = b & DP_SHORT_MAX;
+            d->var = 0;
+            d->varShift = 0;
+            d->state = d->len == 0 ? S_LEN : d->op == DP_OP_LIT ? S_COPY : S_ARG;
+            if (d->state == S_COPY && !start_copy(d)) d->state = S_ERROR;
+            break;
+
+        case S_LEN:
+        case S_ARG:
+            if (d->varShift > 28) {
+                d->state = S_ERROR;
+                break;
+            }
+            d->var |= (uint32_t)(b & 0x7F) << d->varShift;
+            d->varShift += 7;
+            if (b & 0x80) break;
+            if (d->state == S_LEN) {
+                d->len = d->var;
+                d->var = 0;
+                d->varShift = 0;
+                d->state = d->len == 0 ? S_ERROR : d->op == DP_OP_LIT ? S_COPY : S_ARG;
+                if (d->state == S_COPY && !start_copy(d)) d->state = S_ERROR;
+                break;
+            }
+            if (d->op == DP_OP_SRC) {
+                // Zigzag: 0, -1, 1, -2, ... relative to the last SRC copy
+                int32_t delta = (int32_t)(d->var >> 1) ^ -(int32_t)(d->var & 1);
+                d->srcPos += (uint32_t)delta;
+            } else {
+                d->dist = d->var;
+            }
+            d->state = start_copy(d) ? S_COPY : S_ERROR;
+            break;
+        }
+    }
+
+    *inUsed = ip;
+    *outLen = op;
+    return result;
+}
+
+const DpHeader_t* dp_header(const DpDecoder_t* d) {
+    return &d->header;
+}
+
+void dp_write_header(const DpHeader_t* h, uint8_t out[DP_HEADER_BYTES]) {
+    put_u32(out, h->magic);
+    out[4] = (uint8_t)h->version;
+    out[5] = (uint8_t)(h->version >> 8);
+    out[6] = (uint8_t)h->windowBits;
+    out[7] = (uint8_t)(h->windowBits >> 8);
+    put_u32(out + 8, h->srcSize);
+    put_u32(out + 12, h->dstSize);
+    memcpy(out + 16, h->srcSha, SHA256_BYTES);
+    memcpy(out + 16 + SHA256_BYTES, h->dstSha, SHA256_BYTES);
+}
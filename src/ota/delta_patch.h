@@ -0,0 +1,94 @@
+// SIGNALTAP Delta Patch
+// Streaming decoder for firmware patches. A patch rebuilds the new image
+// from three kinds of copy: bytes from the running image (code that only
+// moved), bytes from the last few KB of the new image itself (LZ77-style
+// repeats, which is all the compression a full image gets) and literals.
+// That keeps a typical update to the changed code plus a few bytes per
+// moved block, and the decoder needs nothing but the source reader and a
+// small window of its own output. Input and output are taken in pieces of
+// any size; the decoder stops where either runs out and picks up there.
+//
+// Patch layout (little-endian):
+//   header  DP_HEADER_BYTES  magic, version, window bits, source and image
+//                            sizes, SHA-256 of the source and of the image
+//   ops     op byte: kind in the top 2 bits, length 1..63 in the low 6
+//           (0 = a varint length follows)
+//             00 LIT  length bytes follow
+//             01 SRC  zigzag varint offset from the end of the last SRC
+//                     copy; copy length bytes of the source from there
+//             10 TGT  varint distance back into the output; copy length
+//                     bytes from there (may overlap, for runs)
+//             0xFF    end of patch
+// Patches are made on the host (tools/ota_bench.cpp make).
+#ifndef DELTA_PATCH_H
+#define DELTA_PATCH_H
+
+#include <Arduino.h>
+#include "sha256.h"
+
+#define DP_MAGIC            0x50445453u     // "STDP"
+#define DP_VERSION          1
+#define DP_HEADER_BYTES     80
+#define DP_WINDOW_BITS      13              // Largest window a patch may use (8 KB)
+#define DP_WINDOW_BYTES     (1u << DP_WINDOW_BITS)
+
+#define DP_OP_LIT           0x00
+#define DP_OP_SRC           0x40
+#define DP_OP_TGT           0x80
+#define DP_OP_END           0xFF
+#define DP_SHORT_MAX        63
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t windowBits;
+    uint32_t srcSize;
+    uint32_t dstSize;
+    uint8_t srcSha[SHA256_BYTES];
+    uint8_t dstSha[SHA256_BYTES];
+} DpHeader_t;
+
+typedef enum {
+    DP_MORE = 0,            // Input used up or output full: call again with more
+    DP_HEADER,              // Header complete and valid (check it, then call again)
+    DP_DONE,                // End of patch, image complete
+    DP_ERROR
+} DpResult_t;
+
+// Read len bytes of the source image at offset
+typedef bool (*DpReadFn)(void* ctx, uint32_t offset, void* buf, uint32_t len);
+
+typedef struct {
+    uint8_t state;
+    uint8_t hdr[DP_HEADER_BYTES];
+    uint8_t hdrLen;
+    DpHeader_t header;
+
+    uint8_t op;             // Current op kind
+    uint32_t len;           // Bytes of it still to copy
+    uint32_t var;           // Varint being read
+    uint8_t varShift;
+    uint32_t srcPos;        // Source offset of the next SRC byte
+    uint32_t dist;          // TGT distance
+    uint32_t outPos;        // Image bytes produced
+
+    DpReadFn readSrc;
+    void* ctx;
+    uint8_t window[DP_WINDOW_BYTES];    // Last image bytes, ring
+} DpDecoder_t;
+
+// ============ Public API ============
+
+void dp_init(DpDecoder_t* d, DpReadFn readSrc, void* ctx);
+
+// Decode from in into out; inUsed / outLen say how far it got
+DpResult_t dp_decode(DpDecoder_t* d, const uint8_t* in, uint32_t inLen, uint32_t* inUsed,
+                     uint8_t* out, uint32_t outCap, uint32_t* outLen);
+
+// Header, valid once dp_decode() returned DP_HEADER
+const DpHeader_t* dp_header(const DpDecoder_t* d);
+
+// Header bytes of h, for the encoder
+void dp_write_header(const DpHeader_t* h, uint8_t out[DP_HEADER_BYTES]);
+
+#endif // DELTA_PATCH_H
@@ -0,0 +1,122 @@
+// SIGNALTAP OTA Slots Implementation
+#include "ota_slot.h"
+#include <string.h>
+
+#if defined(ARDUINO)
+
+bool ota_slot_running(OtaSlot_t* s, const char* hostPath) {
+    memset(s, 0, sizeof(*s));
+    s->part = esp_ota_get_running_partition();
+    if (!s->part) return false;
+    s->size = s->part->size;
+    return true;
+}
+
+bool ota_slot_begin_next(OtaSlot_t* s, const char* hostPath, uint32_t size) {
+    memset(s, 0, sizeof(*s));
+    s->part = esp_ota_get_next_update_partition(NULL);
+    if (!s->part || size > s->part->size) return false;
+    s->size = s->part->size;
+    // Sequential writes: each sector is erased as the image reaches it,
+    // instead of the whole partition up front
+    if (esp_ota_begin(s->part, OTA_WITH_SEQUENTIAL_WRITES, &s->handle) != ESP_OK) return false;
+    s->writing = true;
+    return true;
+}
+
+bool ota_slot_read(OtaSlot_t* s, uint32_t offset, void* buf, uint32_t len) {
+    return esp_partition_read(s->part, offset, buf, len) == ESP_OK;
+}
+
+bool ota_slot_write(OtaSlot_t* s, const void* buf, uint32_t len) {
+    if (!s->writing || esp_ota_write(s->handle, buf, len) != ESP_OK) return false;
+    s->written += len;
+    return true;
+}
+
+bool ota_slot_finish(OtaSlot_t* s, bool activate) {
+    if (!s->writing) return false;
+    s->writing = false;
+    // esp_ota_end() also checks the image header and its appended hash
+    if (esp_ota_end(s->handle) != ESP_OK) return false;
+    return !activate || esp_ota_set_boot_partition(s->part) == ESP_OK;
+}
+
+void ota_slot_abort(OtaSlot_t* s) {
+    if (s->writing) esp_ota_abort(s->handle);
+    s->writing = false;
+}
+
+void ota_slot_close(OtaSlot_t* s) {
+    ota_slot_abort(s);
+    s->part = NULL;
+}
+
+#else  // Host build: image files
+
+#include <unistd.h>
+
+bool ota_slot_running(OtaSlot_t* s, const char* hostPath) {
+    memset(s, 0, sizeof(*s));
+    s->fp = fopen(hostPath, "rb");
+    if (!s->fp) return false;
+    fseek(s->fp, 0, SEEK_END);
+    s->size = (uint32_t)ftell(s->fp);
+    return true;
+}
+
+bool ota_slot_begin_next(OtaSlot_t* s, const char* hostPath, uint32_t size) {
+    uint32_t sectorUs = s->sectorUs;
+    memset(s, 0, sizeof(*s));
+    s->sectorUs = sectorUs;
+    s->fp = fopen(hostPath, "w+b");
+    if (!s->fp) return false;
+    uint8_t erased[OTA_SECTOR_BYTES];
+    memset(erased, 0xFF, sizeof(erased));
+    for (uint32_t off = 0; off < size; off += sizeof(erased)) {
+        uint32_t n = size - off < sizeof(erased) ? size - off : sizeof(erased);
+        if (fwrite(erased, 1, n, s->fp) != n) return false;
+    }
+    rewind(s->fp);
+    s->size = size;
+    s->writing = true;
+    return true;
+}
+
+bool ota_slot_read(OtaSlot_t* s, uint32_t offset, void* buf, uint32_t len) {
+    if (!s->fp || fseek(s->fp, offset, SEEK_SET) != 0) return false;
+    return fread(buf, 1, len, s->fp) == len;
+}
+
+bool ota_slot_write(OtaSlot_t* s, const void* buf, uint32_t len) {
+    if (!s->writing || s->written + len > s->size) return false;
+    if (fwrite(buf, 1, len, s->fp) != len) return false;
+    s->written += len;
+    // Stand in for the flash: erase + program time per sector reached
+    s->pendingBytes += len;
+    while (s->sectorUs && s->pendingBytes >= OTA_SECTOR_BYTES) {
+        usleep(s->sectorUs);
+        s->pendingBytes -= OTA_SECTOR_BYTES;
+    }
+    return true;
+}
+
+bool ota_slot_finish(OtaSlot_t* s, bool activate) {
+    if (!s->writing) return false;
+    s->writing = false;
+    if (fflush(s->fp) != 0) return false;
+    s->activated = activate;
+    return true;
+}
+
+void ota_slot_abort(OtaSlot_t* s) {
+    s->writing = false;
+}
+
+void ota_slot_close(OtaSlot_t* s) {
+    if (s->fp) fclose(s->fp);
+    s->fp = NULL;
+    s->writing = false;
+}
+
+#endif
@@ -0,0 +1,58 @@
+// SIGNALTAP OTA Slots
+// The two app partitions of the A/B scheme: the running one, read as the
+// patch source, and the next one, written front to back with the new
+// image and made the boot partition once it checks out. On the device
+// this is the ESP-IDF OTA API, which erases each sector just ahead of the
+// write; on a host build two image files stand in for the partitions.
+#ifndef OTA_SLOT_H
+#define OTA_SLOT_H
+
+#include <Arduino.h>
+
+#if defined(ARDUINO)
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#else
+#include <stdio.h>
+#endif
+
+#define OTA_SECTOR_BYTES    4096
+
+typedef struct {
+#if defined(ARDUINO)
+    const esp_partition_t* part;
+    esp_ota_handle_t handle;
+#else
+    FILE* fp;
+    uint32_t sectorUs;      // Host: emulated erase + program time per sector, 0 = none
+    uint32_t pendingBytes;  // Host: written since the last emulated sector
+    bool activated;         // Host: finished with activate, the boot image from now on
+#endif
+    uint32_t size;          // Partition bytes
+    uint32_t written;
+    bool writing;           // Opened for the update, not yet finished
+} OtaSlot_t;
+
+// ============ Public API ============
+
+// Running partition, for reading (host: hostPath, the image file)
+bool ota_slot_running(OtaSlot_t* s, const char* hostPath);
+
+// Next partition, opened for a sequential write of a new image (host:
+// hostPath, created or truncated to size bytes of erased flash)
+bool ota_slot_begin_next(OtaSlot_t* s, const char* hostPath, uint32_t size);
+
+bool ota_slot_read(OtaSlot_t* s, uint32_t offset, void* buf, uint32_t len);
+
+// Append to the image being written
+bool ota_slot_write(OtaSlot_t* s, const void* buf, uint32_t len);
+
+// Close the written image; activate makes it the boot partition
+bool ota_slot_finish(OtaSlot_t* s, bool activate);
+
+// Give up on the image being written (the running one stays the boot one)
+void ota_slot_abort(OtaSlot_t* s);
+
+void ota_slot_close(OtaSlot_t* s);
+
+#endif // OTA_SLOT_H
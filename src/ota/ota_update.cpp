@@ -0,0 +1,449 @@
+// SIGNALTAP OTA Update Implementation
+#include "ota_update.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#if defined(ARDUINO)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+// Hand-over flags between the stages
+#define LOAD_ACQ(x)         __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_REL(x, v)     __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+
+// ============ Transport ============
+#if defined(ARDUINO)
+
+static bool tcp_open(OtaUpdate_t* o) {
+    return o->client.connect(o->host, o->port, OTA_CONNECT_TIMEOUT_MS);
+}
+
+static void tcp_close(OtaUpdate_t* o) {
+    o->client.stop();
+}
+
+static int tcp_write(OtaUpdate_t* o, const uint8_t* buf, uint32_t len) {
+    if (!o->client.connected()) return -1;
+    return (int)o->client.write(buf, len);
+}
+
+static int tcp_read(OtaUpdate_t* o, uint8_t* buf, uint32_t max) {
+    int n = o->client.available();
+    if (n <= 0) return o->client.connected() ? 0 : -1;
+    return o->client.read(buf, (uint32_t)n < max ? n : max);
+}
+
+#else  // Host build: POSIX socket
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+
+#define OTA_HOST_TCP_WINDOW 5760
+
+static bool tcp_open(OtaUpdate_t* o) {
+    char service[8];
+    snprintf(service, sizeof(service), "%u", o->port);
+    struct addrinfo hints, *res;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(o->host, service, &hints, &res) != 0) return false;
+
+    o->fd = -1;
+    for (struct addrinfo* a = res; a; a = a->ai_next) {
+        o->fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+        if (o->fd < 0) continue;
+        // About the device's TCP window, so a stage that stops reading
+        // holds the sender back here too
+        int window = OTA_HOST_TCP_WINDOW;
+        setsockopt(o->fd, SOL_SOCKET, SO_RCVBUF, &window, sizeof(window));
+        if (connect(o->fd, a->ai_addr, a->ai_addrlen) == 0) break;
+        close(o->fd);
+        o->fd = -1;
+    }
+    freeaddrinfo(res);
+    if (o->fd < 0) return false;
+    fcntl(o->fd, F_SETFL, fcntl(o->fd, F_GETFL) | O_NONBLOCK);
+    return true;
+}
+
+static void tcp_close(OtaUpdate_t* o) {
+    close(o->fd);
+    o->fd = -1;
+}
+
+static int tcp_write(OtaUpdate_t* o, const uint8_t* buf, uint32_t len) {
+    ssize_t n = send(o->fd, buf, len, MSG_NOSIGNAL);
+    if (n >= 0) return (int)n;
+    return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+}
+
+static int tcp_read(OtaUpdate_t* o, uint8_t* buf, uint32_t max) {
+    ssize_t n = recv(o->fd, buf, max, 0);
+    if (n > 0) return (int)n;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return 0;
+    return -1;
+}
+
+#endif
+
+// ============ Helpers ============
+// First failure wins; every stage sees it and stops
+static bool fail(OtaUpdate_t* o, OtaError_t e) {
+    if (ota_busy(o)) {
+        o->error = (uint8_t)e;
+        STORE_REL(o->state, (uint8_t)OTA_FAILED);
+    }
+    return false;
+}
+
+static bool parse_url(OtaUpdate_t* o, const char* url) {
+    if (strncmp(url, "http://", 7) != 0) return false;
+    const char* host = url + 7;
+    const char* path = strchr(host, '/');
+    const char* colon = strchr(host, ':');
+    if (!path) path = host + strlen(host);
+    if (colon && colon > path) colon = NULL;
+    uint32_t hostLen = (uint32_t)((colon ? colon : path) - host);
+    if (hostLen == 0 || hostLen >= OTA_HOST_LEN || strlen(path) >= OTA_PATH_LEN) return false;
+    memcpy(o->host, host, hostLen);
+    o->host[hostLen] = '\0';
+    o->port = colon ? (uint16_t)atoi(colon + 1) : 80;
+    snprintf(o->path, sizeof(o->path), "%s", *path ? path : "/");
+    return o->port != 0;
+}
+
+static bool read_source(void* ctx, uint32_t offset, void* buf, uint32_t len) {
+    return ota_slot_read(&((OtaUpdate_t*)ctx)->running, offset, buf, len);
+}
+
+// Download buffer full, or the last of the patch: over to the decoder
+static void hand_in(OtaUpdate_t* o) {
+    OtaBuf_t* b = &o->in[o->inFill];
+    bool last = o->stats.patchBytes == o->contentLength;
+    if (b->len == OTA_CHUNK_BYTES || (last && b->len)) {
+        STORE_REL(b->full, (uint8_t)1);
+        o->inFill ^= 1;
+    }
+    if (last) {
+        STORE_REL(o->fetchDone, (uint8_t)1);
+        tcp_close(o);
+        o->connected = false;
+    }
+}
+
+// Status line and Content-Length; the body bytes read along with the head
+// go into the first download buffer
+static bool parse_head(OtaUpdate_t* o, char* end) {
+    *end = '\0';
+    if (strncmp(o->head, "HTTP/1.", 7) != 0 || strncmp(o->head + 8, " 200", 4) != 0) return false;
+    o->contentLength = 0;
+    for (char* line = strstr(o->head, "\r\n"); line; line = strstr(line + 2, "\r\n")) {
+        if (strncasecmp(line + 2, "Content-Length:", 15) == 0) {
+            o->contentLength = (uint32_t)strtoul(line + 17, NULL, 10);
+        }
+    }
+    if (o->contentLength < DP_HEADER_BYTES) return false;
+    uint32_t body = o->headLen - (uint32_t)(end + 4 - o->head);
+    if (body > o->contentLength) body = o->contentLength;
+    memcpy(o->in[0].data, end + 4, body);
+    o->in[0].len = body;
+    o->stats.patchBytes = body;
+    hand_in(o);
+    return true;
+}
+
+// ============ Helper: Stage tasks ============
+#if defined(ARDUINO)
+// Until the update ends, then one more pass to release what the stage holds
+static void run_stage(OtaUpdate_t* o, bool (*stage)(OtaUpdate_t*)) {
+    while (ota_busy(o)) {
+        if (!stage(o)) vTaskDelay(1);
+    }
+    stage(o);
+    vTaskDelete(NULL);
+}
+
+static void fetch_task(void* arg) { run_stage((OtaUpdate_t*)arg, ota_fetch_service); }
+static void decode_task(void* arg) { run_stage((OtaUpdate_t*)arg, ota_decode_service); }
+static void write_task(void* arg) { run_stage((OtaUpdate_t*)arg, ota_write_service); }
+
+static void start_tasks(OtaUpdate_t* o) {
+    // Writer above the others: flash is the slow stage
+    if (xTaskCreatePinnedToCore(fetch_task, "ota_fetch", OTA_TASK_STACK, o, 1, NULL, tskNO_AFFINITY) != pdPASS ||
+        xTaskCreatePinnedToCore(decode_task, "ota_decode", OTA_TASK_STACK, o, 1, NULL, tskNO_AFFINITY) != pdPASS ||
+        xTaskCreatePinnedToCore(write_task, "ota_write", OTA_TASK_STACK, o, 2, NULL, tskNO_AFFINITY) != pdPASS) {
+        fail(o, OTA_ERR_FLASH);
+    }
+}
+#endif
+
+// ============ Public API ============
+void ota_init(OtaUpdate_t* o, const char* runningPath, const char* nextPath) {
+    o->runningPath = runningPath;
+    o->nextPath = nextPath;
+    o->state = OTA_IDLE;
+    o->error = OTA_OK;
+    o->connected = false;
+    memset(&o->running, 0, sizeof(o->running));
+    memset(&o->next, 0, sizeof(o->next));
+    memset(&o->stats, 0, sizeof(o->stats));
+}
+
+bool ota_start(OtaUpdate_t* o, const char* url) {
+    if (ota_busy(o)) return false;
+    memset(&o->stats, 0, sizeof(o->stats));
+    o->stats.startMs = millis();
+    o->error = OTA_OK;
+    o->state = OTA_CONNECTING;
+    if (!parse_url(o, url)) return fail(o, OTA_ERR_URL);
+
+    o->connected = false;
+    o->headLen = 0;
+    o->contentLength = 0;
+    o->fetchDone = 0;
+    o->decodeDone = 0;
+    for (int i = 0; i < 2; i++) {
+        o->in[i].len = o->out[i].len = 0;
+        o->in[i].full = o->out[i].full = 0;
+    }
+    o->inFill = o->inRead = o->outFill = o->outWrite = 0;
+    o->inPos = 0;
+    dp_init(&o->dec, read_source, o);
+    sha256_init(&o->dstHash);
+
+    // Both partitions are the same size; the patch header says how much
+    // of each it uses
+    if (!ota_slot_running(&o->running, o->runningPath) ||
+        !ota_slot_begin_next(&o->next, o->nextPath, o->running.size)) {
+        ota_slot_close(&o->running);
+        ota_slot_close(&o->next);
+        return fail(o, OTA_ERR_FLASH);
+    }
+
+#if defined(ARDUINO)
+    start_tasks(o);
+#endif
+    return true;
+}
+
+bool ota_fetch_service(OtaUpdate_t* o) {
+    if (!ota_busy(o)) {
+        if (o->connected) tcp_close(o);
+        o->connected = false;
+        return false;
+    }
+    if (LOAD_ACQ(o->fetchDone)) return false;
+
+    unsigned long t0 = micros();
+    uint32_t now = millis();
+    if (!o->connected) {
+        if (!tcp_open(o)) return fail(o, OTA_ERR_CONNECT);
+        o->connected = true;
+        int n = snprintf(o->head, sizeof(o->head),
+                         "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n", o->path, o->host);
+        if (tcp_write(o, (const uint8_t*)o->head, (uint32_t)n) != n) return fail(o, OTA_ERR_CONNECT);
+        o->lastDataMs = now;
+        o->stats.fetchUs += micros() - t0;
+        return true;
+    }
+
+    int n;
+    if (o->contentLength == 0) {
+        n = tcp_read(o, (uint8_t*)o->head + o->headLen, OTA_HEAD_BYTES - 1 - o->headLen);
+        if (n > 0) {
+            o->headLen += n;
+            o->head[o->headLen] = '\0';
+            char* end = strstr(o->head, "\r\n\r\n");
+            if (end && !parse_head(o, end)) return fail(o, OTA_ERR_HTTP);
+            if (!end && o->headLen == OTA_HEAD_BYTES - 1) return fail(o, OTA_ERR_HTTP);
+        }
+    } else {
+        OtaBuf_t* b = &o->in[o->inFill];
+        if (LOAD_ACQ(b->full)) {
+            o->stats.fetchWaits++;
+            o->lastDataMs = now;        // Not the network's fault
+            return false;
+        }
+        uint32_t want = OTA_CHUNK_BYTES - b->len;
+        if (want > o->contentLength - o->stats.patchBytes) want = o->contentLength - o->stats.patchBytes;
+        n = tcp_read(o, b->data + b->len, want);
+        if (n > 0) {
+            b->len += n;
+            o->stats.patchBytes += n;
+            hand_in(o);
+        }
+    }
+    if (n < 0) return fail(o, o->contentLength ? OTA_ERR_NETWORK : OTA_ERR_HTTP);
+    if (n == 0) {
+        if (now - o->lastDataMs > OTA_STALL_TIMEOUT_MS) return fail(o, OTA_ERR_NETWORK);
+        return false;
+    }
+    o->lastDataMs = now;
+    o->stats.fetchUs += micros() - t0;
+    return true;
+}
+
+bool ota_decode_service(OtaUpdate_t* o) {
+    if (!ota_busy(o)) {
+        ota_slot_close(&o->running);
+        return false;
+    }
+    if (LOAD_ACQ(o->decodeDone)) return false;
+
+    unsigned long t0 = micros();
+    const DpHeader_t* h = dp_header(&o->dec);
+    if (LOAD_ACQ(o->state) == OTA_CHECKING) {
+        // The sector buffer is free until decoding starts
+        uint8_t* scratch = o->out[o->outFill].data;
+        for (uint32_t end = o->checkPos + OTA_CHECK_BYTES; o->checkPos < h->srcSize && o->checkPos < end; ) {
+            uint32_t n = h->srcSize - o->checkPos < OTA_CHUNK_BYTES ? h->srcSize - o->checkPos : OTA_CHUNK_BYTES;
+            if (!ota_slot_read(&o->running, o->checkPos, scratch, n)) return fail(o, OTA_ERR_FLASH);
+            sha256_update(&o->srcHash, scratch, n);
+            o->checkPos += n;
+        }
+        if (o->checkPos == h->srcSize) {
+            uint8_t digest[SHA256_BYTES];
+            sha256_final(&o->srcHash, digest);
+            if (memcmp(digest, h->srcSha, SHA256_BYTES) != 0) return fail(o, OTA_ERR_BASE);
+            STORE_REL(o->state, (uint8_t)OTA_UPDATING);
+        }
+        o->stats.checkUs += micros() - t0;
+        return true;
+    }
+
+    OtaBuf_t* out = &o->out[o->outFill];
+    if (LOAD_ACQ(out->full)) {
+        o->stats.decodeWaits++;
+        return false;
+    }
+    // Done flag first: it is set after the last hand-over. No input is
+    // fine as long as the current copy still has bytes to give.
+    bool fetched = LOAD_ACQ(o->fetchDone);
+    OtaBuf_t* in = &o->in[o->inRead];
+    bool haveIn = LOAD_ACQ(in->full);
+
+    uint32_t used, made;
+    DpResult_t r = dp_decode(&o->dec, in->data + o->inPos, haveIn ? in->len - o->inPos : 0, &used,
+                             out->data + out->len, OTA_CHUNK_BYTES - out->len, &made);
+    if (r == DP_MORE && used == 0 && made == 0) {
+        if (fetched) return fail(o, OTA_ERR_PATCH);     // Patch ended early
+        o->stats.decodeWaits++;
+        return false;
+    }
+    o->inPos += used;
+    out->len += made;
+    if (haveIn && o->inPos == in->len) {
+        in->len = 0;
+        o->inPos = 0;
+        STORE_REL(in->full, (uint8_t)0);
+        o->inRead ^= 1;
+    }
+    if (r == DP_ERROR) return fail(o, OTA_ERR_PATCH);
+    if (r == DP_HEADER) {
+        if (h->srcSize > o->running.size || h->dstSize > o->next.size) return fail(o, OTA_ERR_BASE);
+        sha256_init(&o->srcHash);
+        o->checkPos = 0;
+        STORE_REL(o->state, (uint8_t)OTA_CHECKING);
+    }
+    if (out->len == OTA_CHUNK_BYTES || (r == DP_DONE && out->len)) {
+        STORE_REL(out->full, (uint8_t)1);
+        o->outFill ^= 1;
+    }
+    if (r == DP_DONE) STORE_REL(o->decodeDone, (uint8_t)1);
+    o->stats.decodeUs += micros() - t0;
+    return true;
+}
+
+bool ota_write_service(OtaUpdate_t* o) {
+    if (!ota_busy(o)) {
+        ota_slot_abort(&o->next);
+        ota_slot_close(&o->next);
+        return false;
+    }
+
+    unsigned long t0 = micros();
+    // Done flag first: it is set after the last hand-over
+    bool decoded = LOAD_ACQ(o->decodeDone);
+    OtaBuf_t* b = &o->out[o->outWrite];
+    if (LOAD_ACQ(b->full)) {
+        if (!ota_slot_write(&o->next, b->data, b->len)) return fail(o, OTA_ERR_FLASH);
+        sha256_update(&o->dstHash, b->data, b->len);
+        o->stats.imageBytes += b->len;
+        b->len = 0;
+        STORE_REL(b->full, (uint8_t)0);
+        o->outWrite ^= 1;
+        o->stats.writeUs += micros() - t0;
+        return true;
+    }
+    if (!decoded) {
+        o->stats.writeWaits++;
+        return false;
+    }
+
+    // Everything is written: the image must be the one the patch promised
+    const DpHeader_t* h = dp_header(&o->dec);
+    uint8_t digest[SHA256_BYTES];
+    sha256_final(&o->dstHash, digest);
+    if (o->stats.imageBytes != h->dstSize || memcmp(digest, h->dstSha, SHA256_BYTES) != 0) {
+        return fail(o, OTA_ERR_VERIFY);
+    }
+    if (!ota_slot_finish(&o->next, true)) return fail(o, OTA_ERR_FLASH);
+    o->stats.writeUs += micros() - t0;
+    o->stats.totalMs = millis() - o->stats.startMs;
+    STORE_REL(o->state, (uint8_t)OTA_DONE);
+    return true;
+}
+
+bool ota_service(OtaUpdate_t* o) {
+    bool work = ota_fetch_service(o);
+    work |= ota_decode_service(o);
+    work |= ota_write_service(o);
+    return work;
+}
+
+bool ota_busy(const OtaUpdate_t* o) {
+    uint8_t s = LOAD_ACQ(o->state);
+    return s != OTA_IDLE && s != OTA_DONE && s != OTA_FAILED;
+}
+
+OtaState_t ota_state(const OtaUpdate_t* o) {
+    return (OtaState_t)LOAD_ACQ(o->state);
+}
+
+OtaError_t ota_error(const OtaUpdate_t* o) {
+    return (OtaError_t)o->error;
+}
+
+const char* ota_error_text(OtaError_t e) {
+    switch (e) {
+    case OTA_OK:            return "ok";
+    case OTA_ERR_URL:       return "bad URL";
+    case OTA_ERR_CONNECT:   return "server unreachable";
+    case OTA_ERR_HTTP:      return "server refused the patch";
+    case OTA_ERR_NETWORK:   return "download interrupted";
+    case OTA_ERR_PATCH:     return "patch corrupt";
+    case OTA_ERR_BASE:      return "patch is for another version";
+    case OTA_ERR_FLASH:     return "flash error";
+    case OTA_ERR_VERIFY:    return "image check failed";
+    }
+    return "?";
+}
+
+uint8_t ota_progress(const OtaUpdate_t* o) {
+    uint8_t s = LOAD_ACQ(o->state);
+    if (s == OTA_DONE) return 100;
+    if (s != OTA_UPDATING) return 0;
+    uint32_t size = dp_header(&o->dec)->dstSize;
+    return size ? (uint8_t)((uint64_t)o->stats.imageBytes * 100 / size) : 0;
+}
+
+const OtaStats_t* ota_get_stats(const OtaUpdate_t* o) {
+    return &o->stats;
+}
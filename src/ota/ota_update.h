@@ -0,0 +1,154 @@
+// SIGNALTAP OTA Update
+// Firmware update from a delta patch (delta_patch.h) fetched over HTTP.
+// Three stages run at once and hand over through double buffers:
+//   fetch   HTTP GET of the patch into two download buffers
+//   decode  patch + running image -> new image bytes, into two sector
+//           buffers (first, the running image is hashed against the
+//           patch's source hash: a patch only applies to its own base)
+//   write   sector buffers -> the next app partition, hashing the image
+//           as it goes; at the end the hash and size must match the
+//           patch header before the partition becomes the boot one
+// So the download, the decoding and the flash writes overlap and the
+// update takes about as long as the slowest of them. Memory is fixed:
+// the four buffers and the decoder's window. A failure at any stage
+// stops the others and leaves the running image as the boot one.
+//
+// On the device each stage runs in its own task (ota_start() starts
+// them); on a host build the caller runs the stage functions, one thread
+// each or all in turn with ota_service().
+#ifndef OTA_UPDATE_H
+#define OTA_UPDATE_H
+
+#include <Arduino.h>
+#include "delta_patch.h"
+#include "ota_slot.h"
+#include "sha256.h"
+
+#if defined(ARDUINO)
+#include <WiFiClient.h>
+#endif
+
+#define OTA_CHUNK_BYTES         4096    // Download buffer
+#define OTA_HEAD_BYTES          512     // HTTP response head
+#define OTA_HOST_LEN            64
+#define OTA_PATH_LEN            96
+#define OTA_CHECK_BYTES         32768   // Running image hashed per decode pass
+#define OTA_CONNECT_TIMEOUT_MS  5000
+#define OTA_STALL_TIMEOUT_MS    15000   // No patch bytes for this long: give up
+#define OTA_TASK_STACK          4096
+
+typedef enum {
+    OTA_IDLE = 0,
+    OTA_CONNECTING,         // Until the response head is in
+    OTA_CHECKING,           // Hashing the running image against the patch
+    OTA_UPDATING,
+    OTA_DONE,               // New image written, verified and set to boot
+    OTA_FAILED
+} OtaState_t;
+
+typedef enum {
+    OTA_OK = 0,
+    OTA_ERR_URL,
+    OTA_ERR_CONNECT,
+    OTA_ERR_HTTP,           // Not a 200 with a length
+    OTA_ERR_NETWORK,        // Dropped or stalled mid-download
+    OTA_ERR_PATCH,          // Malformed or truncated patch
+    OTA_ERR_BASE,           // Patch is for another running image
+    OTA_ERR_FLASH,
+    OTA_ERR_VERIFY          // New image hash or size mismatch
+} OtaError_t;
+
+typedef struct {
+    uint8_t data[OTA_CHUNK_BYTES];
+    uint32_t len;
+    volatile uint8_t full;  // Set by the producing stage, cleared by the consumer
+} OtaBuf_t;
+
+typedef struct {
+    uint32_t patchBytes;    // Downloaded
+    uint32_t imageBytes;    // Written
+    uint32_t startMs;
+    uint32_t totalMs;       // Start to done
+    uint32_t checkUs;       // Time in each stage
+    uint32_t fetchUs;
+    uint32_t decodeUs;
+    uint32_t writeUs;
+    uint32_t fetchWaits;    // Passes a stage had nothing to do for want of a buffer
+    uint32_t decodeWaits;
+    uint32_t writeWaits;
+} OtaStats_t;
+
+typedef struct {
+    char host[OTA_HOST_LEN];
+    uint16_t port;
+    char path[OTA_PATH_LEN];
+    const char* runningPath;    // Host: image files standing in for the partitions
+    const char* nextPath;
+
+    volatile uint8_t state;     // OtaState_t
+    volatile uint8_t error;     // OtaError_t
+
+    // Fetch stage
+#if defined(ARDUINO)
+    WiFiClient client;
+#else
+    int fd;
+#endif
+    bool connected;
+    char head[OTA_HEAD_BYTES];
+    uint16_t headLen;
+    uint32_t contentLength;
+    uint32_t lastDataMs;
+    OtaBuf_t in[2];
+    uint8_t inFill;
+    volatile uint8_t fetchDone;
+
+    // Decode stage
+    DpDecoder_t dec;
+    uint8_t inRead;
+    uint32_t inPos;
+    uint32_t checkPos;
+    Sha256_t srcHash;
+    OtaBuf_t out[2];
+    uint8_t outFill;
+    volatile uint8_t decodeDone;
+
+    // Write stage
+    OtaSlot_t running;
+    OtaSlot_t next;
+    uint8_t outWrite;
+    Sha256_t dstHash;
+
+    OtaStats_t stats;
+} OtaUpdate_t;
+
+// ============ Public API ============
+
+// Host: image files for the running and the next partition (the next one
+// also gets the host sector time, next.sectorUs). Device: NULL, NULL.
+void ota_init(OtaUpdate_t* o, const char* runningPath, const char* nextPath);
+
+// Start an update from url (http://host[:port]/path). Device: starts the
+// stage tasks. False if one is already running or it could not start.
+bool ota_start(OtaUpdate_t* o, const char* url);
+
+// Stages: each does what it can without waiting and says whether it got
+// anything done. Once the update has ended they release what they hold.
+bool ota_fetch_service(OtaUpdate_t* o);
+bool ota_decode_service(OtaUpdate_t* o);
+bool ota_write_service(OtaUpdate_t* o);
+
+// Host: all three stages once, in order
+bool ota_service(OtaUpdate_t* o);
+
+bool ota_busy(const OtaUpdate_t* o);
+OtaState_t ota_state(const OtaUpdate_t* o);
+OtaError_t ota_error(const OtaUpdate_t* o);
+const char* ota_error_text(OtaError_t e);
+
+// Image written, 0-100
+uint8_t ota_progress(const OtaUpdate_t* o);
+
+const OtaStats_t* ota_get_stats(const OtaUpdate_t* o);
+
+#endif // OTA_UPDATE_H
@@ -0,0 +1,25 @@
+// SIGNALTAP SHA-256
+// Incremental SHA-256 (FIPS 180-4) for firmware images: bytes go in as
+// they stream past, in pieces of any size, and the digest comes out at
+// the end, so an image never has to be in RAM at once to be verified.
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <Arduino.h>
+
+#define SHA256_BYTES        32
+
+typedef struct {
+    uint32_t h[8];
+    uint8_t block[64];
+    uint8_t used;           // Bytes in block
+    uint64_t total;         // Bytes hashed
+} Sha256_t;
+
+// ============ Public API ============
+
+void sha256_init(Sha256_t* s);
+void sha256_update(Sha256_t* s, const void* data, uint32_t len);
+void sha256_final(Sha256_t* s, uint8_t digest[SHA256_BYTES]);
+
+#endif // SHA256_H
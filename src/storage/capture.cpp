@@ -0,0 +1,515 @@
+// SIGNALTAP Stream Capture Implementation
+#include "capture.h"
+#include <string.h>
+
+#if !defined(ARDUINO)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Change mask: which fields a record carries
+#define CH_SENSOR0      0x0001  // .. CH_SENSOR0 << 2
+#define CH_SCENARIO     0x0008  // state, cycle, stateTimer
+#define CH_TARGETS      0x0010  // health, failure risk
+#define CH_IO           0x0020  // LEDs, DI, DQ, AQ0, part count
+#define CH_GAUGES       0x0040  // pressure, oil temperature
+#define CH_STACK        0x0080
+#define CH_ERROR        0x0100
+#define CH_RUNSTATE     0x0200
+#define CH_ALARMS       0x0400  // Full active list
+#define CH_TIME         0x0800  // Sample time did not advance by one
+#define CH_ALL          0x07FF
+
+// ============ Helper: Byte output ============
+typedef struct {
+    uint8_t* buf;
+    uint32_t len;
+    uint32_t cap;
+} Out_t;
+
+static void put8(Out_t* o, uint8_t v) {
+    if (o->len < o->cap) o->buf[o->len] = v;
+    o->len++;
+}
+
+static void put32(Out_t* o, uint32_t v) {
+    for (int i = 0; i < 4; i++) put8(o, (uint8_t)(v >> (8 * i)));
+}
+
+static void put_varint(Out_t* o, uint32_t v) {
+    while (v >= 0x80) {
+        put8(o, (uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    put8(o, (uint8_t)v);
+}
+
+static uint32_t float_bits(float f) {
+    uint32_t u;
+    memcpy(&u, &f, 4);
+    return u;
+}
+
+// Close values share sign, exponent and top mantissa bits, so the XOR is
+// a small number and its varint short
+static void put_float(Out_t* o, float v, float prev) {
+    put_varint(o, float_bits(v) ^ float_bits(prev));
+}
+
+#define TEXT_NONE 0xFF     // Length byte of an absent string
+
+static void put_text(Out_t* o, const char* s, bool set) {
+    if (!set) {
+        put8(o, TEXT_NONE);
+        return;
+    }
+    uint8_t n = (uint8_t)strnlen(s, CAPTURE_TEXT_LEN - 1);
+    put8(o, n);
+    for (uint8_t i = 0; i < n; i++) put8(o, (uint8_t)s[i]);
+}
+
+// ============ Helper: Byte input ============
+typedef struct {
+    const uint8_t* buf;
+    uint32_t len;
+    uint32_t pos;
+    bool ok;
+} In_t;
+
+static uint8_t get8(In_t* in) {
+    if (in->pos >= in->len) {
+        in->ok = false;
+        return 0;
+    }
+    return in->buf[in->pos++];
+}
+
+static uint32_t get32(In_t* in) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++) v |= (uint32_t)get8(in) << (8 * i);
+    return v;
+}
+
+static uint32_t get_varint(In_t* in) {
+    uint32_t v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        uint8_t b = get8(in);
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) return v;
+    }
+    in->ok = false;
+    return 0;
+}
+
+static float get_float(In_t* in, float prev) {
+    uint32_t u = get_varint(in) ^ float_bits(prev);
+    float f;
+    memcpy(&f, &u, 4);
+    return f;
+}
+
+// Returns whether the string is present
+static bool get_text(In_t* in, char* s) {
+    uint8_t n = get8(in);
+    if (n == TEXT_NONE) {
+        s[0] = '\0';
+        return false;
+    }
+    if (n >= CAPTURE_TEXT_LEN) {
+        in->ok = false;
+        n = 0;
+    }
+    for (uint8_t i = 0; i < n; i++) s[i] = (char)get8(in);
+    s[n] = '\0';
+    return true;
+}
+
+static uint8_t crc8(const uint8_t* p, uint32_t len) {
+    uint8_t crc = 0;
+    while (len--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) crc = (uint8_t)((crc << 1) ^ (0x07 & (0u - (crc >> 7))));
+    }
+    return crc;
+}
+
+// ============ Helper: Record bodies ============
+static uint16_t change_mask(const CaptureFrame_t* f, const CaptureFrame_t* p) {
+    uint16_t mask = 0;
+    for (int i = 0; i < CAPTURE_SENSORS; i++) {
+        if (float_bits(f->sensors[i]) != float_bits(p->sensors[i])) mask |= CH_SENSOR0 << i;
+    }
+    if (f->scenarioState != p->scenarioState || f->cycleCount != p->cycleCount ||
+        f->stateTimer != (uint16_t)(p->stateTimer + 1)) mask |= CH_SCENARIO;
+    if (f->targetHealth != p->targetHealth ||
+        float_bits(f->targetFailure) != float_bits(p->targetFailure)) mask |= CH_TARGETS;
+    if (f->leds != p->leds || f->di != p->di || f->dq != p->dq || f->aq0 != p->aq0 ||
+        f->partCount != p->partCount) mask |= CH_IO;
+    if (float_bits(f->pressure) != float_bits(p->pressure) ||
+        float_bits(f->oilTemp) != float_bits(p->oilTemp)) mask |= CH_GAUGES;
+    uint8_t textDiff = f->textSet ^ p->textSet;
+    if ((textDiff & 1) || strcmp(f->stackLight, p->stackLight) != 0) mask |= CH_STACK;
+    if ((textDiff & 2) || strcmp(f->errorCode, p->errorCode) != 0) mask |= CH_ERROR;
+    if ((textDiff & 4) || strcmp(f->runState, p->runState) != 0) mask |= CH_RUNSTATE;
+    if (f->alarmCount != p->alarmCount ||
+        memcmp(f->alarms, p->alarms, f->alarmCount) != 0) mask |= CH_ALARMS;
+    if (f->t != p->t + 1) mask |= CH_TIME;
+    return mask;
+}
+
+static void encode_fields(Out_t* o, const CaptureFrame_t* f, const CaptureFrame_t* p, uint16_t mask) {
+    put_varint(o, mask);
+    if (mask & CH_TIME) put_varint(o, f->t - p->t);
+    for (int i = 0; i < CAPTURE_SENSORS; i++) {
+        if (mask & (CH_SENSOR0 << i)) put_float(o, f->sensors[i], p->sensors[i]);
+    }
+    if (mask & CH_SCENARIO) {
+        put8(o, f->scenarioState);
+        put8(o, f->cycleCount);
+        put_varint(o, f->stateTimer);
+    }
+    if (mask & CH_TARGETS) {
+        put8(o, f->targetHealth);
+        put_float(o, f->targetFailure, p->targetFailure);
+    }
+    if (mask & CH_IO) {
+        put8(o, f->leds);
+        put8(o, f->di);
+        put8(o, f->dq);
+        put8(o, f->aq0);
+        put_varint(o, f->partCount);
+    }
+    if (mask & CH_GAUGES) {
+        put_float(o, f->pressure, p->pressure);
+        put_float(o, f->oilTemp, p->oilTemp);
+    }
+    if (mask & CH_STACK) put_text(o, f->stackLight, f->textSet & 1);
+    if (mask & CH_ERROR) put_text(o, f->errorCode, f->textSet & 2);
+    if (mask & CH_RUNSTATE) put_text(o, f->runState, f->textSet & 4);
+    if (mask & CH_ALARMS) {
+        put8(o, f->alarmCount);
+        for (uint8_t i = 0; i < f->alarmCount; i++) put8(o, f->alarms[i]);
+    }
+}
+
+// f holds the delta base on entry and the decoded tick on success
+static bool decode_fields(In_t* in, CaptureFrame_t* f) {
+    uint32_t mask = get_varint(in);
+    if (mask & ~(uint32_t)(CH_ALL | CH_TIME)) return false;
+
+    f->t = (mask & CH_TIME) ? f->t + get_varint(in) : f->t + 1;
+    for (int i = 0; i < CAPTURE_SENSORS; i++) {
+        if (mask & (CH_SENSOR0 << i)) f->sensors[i] = get_float(in, f->sensors[i]);
+    }
+    if (mask & CH_SCENARIO) {
+        f->scenarioState = get8(in);
+        f->cycleCount = get8(in);
+        f->stateTimer = (uint16_t)get_varint(in);
+    } else {
+        f->stateTimer++;
+    }
+    if (mask & CH_TARGETS) {
+        f->targetHealth = get8(in);
+        f->targetFailure = get_float(in, f->targetFailure);
+    }
+    if (mask & CH_IO) {
+        f->leds = get8(in);
+        f->di = get8(in);
+        f->dq = get8(in);
+        f->aq0 = get8(in);
+        f->partCount = (uint16_t)get_varint(in);
+    }
+    if (mask & CH_GAUGES) {
+        f->pressure = get_float(in, f->pressure);
+        f->oilTemp = get_float(in, f->oilTemp);
+    }
+    char* texts[3] = {f->stackLight, f->errorCode, f->runState};
+    for (int i = 0; i < 3; i++) {
+        if (!(mask & (CH_STACK << i))) continue;
+        if (get_text(in, texts[i])) f->textSet |= (uint8_t)(1 << i);
+        else f->textSet &= (uint8_t)~(1 << i);
+    }
+    if (mask & CH_ALARMS) {
+        f->alarmCount = get8(in);
+        if (f->alarmCount > ALARM_MAX_ACTIVE) return false;
+        for (uint8_t i = 0; i < f->alarmCount; i++) f->alarms[i] = get8(in);
+    }
+    return in->ok && in->pos == in->len;
+}
+
+// ============ Writer ============
+bool capture_begin(CaptureWriter_t* w, const CaptureHeader_t* h, CaptureWriteFn fn, void* ctx) {
+    memset(w, 0, sizeof(*w));
+    w->write = fn;
+    w->ctx = ctx;
+    w->keyEvery = h->keyEvery ? h->keyEvery : CAPTURE_KEY_EVERY;
+
+    uint8_t buf[CAPTURE_HEADER_LEN];
+    Out_t o = {buf, 0, sizeof(buf)};
+    put32(&o, CAPTURE_MAGIC);
+    put8(&o, CAPTURE_VERSION);
+    put8(&o, h->demo);
+    put8(&o, CAPTURE_SENSORS);
+    put8(&o, w->keyEvery);
+    put8(&o, (uint8_t)h->tickMs);
+    put8(&o, (uint8_t)(h->tickMs >> 8));
+    put8(&o, 0);
+    put8(&o, 0);
+    put32(&o, h->startT);
+    put32(&o, h->startClock);
+
+    w->ok = fn(buf, o.len, ctx);
+    if (w->ok) w->stats.bytes = o.len;
+    return w->ok;
+}
+
+bool capture_write(CaptureWriter_t* w, CaptureFrame_t* f) {
+    if (!w->ok) return false;
+
+    f->tick = w->stats.records;
+    bool key = (f->tick % w->keyEvery) == 0;
+
+    uint8_t buf[CAPTURE_MAX_RECORD];
+    Out_t o = {buf, 3, sizeof(buf)};
+    if (key) {
+        CaptureFrame_t zero;
+        memset(&zero, 0, sizeof(zero));
+        zero.t = f->t - 1;
+        put32(&o, f->tick);
+        put32(&o, f->t);
+        encode_fields(&o, f, &zero, CH_ALL);
+    } else {
+        encode_fields(&o, f, &w->prev, change_mask(f, &w->prev));
+    }
+    if (o.len + 1 > o.cap) {
+        w->stats.failed++;
+        return false;
+    }
+
+    uint16_t body = (uint16_t)(o.len - 3);
+    buf[0] = key ? CAPTURE_TAG_KEY : CAPTURE_TAG_DELTA;
+    buf[1] = (uint8_t)body;
+    buf[2] = (uint8_t)(body >> 8);
+    put8(&o, crc8(buf, o.len));
+    if (!w->write(buf, o.len, w->ctx)) {
+        w->stats.failed++;
+        w->ok = false;
+        return false;
+    }
+
+    w->prev = *f;
+    w->stats.records++;
+    if (key) w->stats.keyframes++;
+    w->stats.bytes += o.len;
+    return true;
+}
+
+// ============ Reader ============
+bool capture_reader_init(CaptureReader_t* r, const uint8_t* data, uint32_t len) {
+    memset(r, 0, sizeof(*r));
+    In_t in = {data, len, 0, true};
+    if (get32(&in) != CAPTURE_MAGIC || get8(&in) != CAPTURE_VERSION) return false;
+    r->header.demo = get8(&in);
+    if (get8(&in) != CAPTURE_SENSORS) return false;
+    r->header.keyEvery = get8(&in);
+    r->header.tickMs = (uint16_t)(get8(&in) | (get8(&in) << 8));
+    get8(&in);
+    get8(&in);
+    r->header.startT = get32(&in);
+    r->header.startClock = get32(&in);
+    if (!in.ok) return false;
+
+    r->data = data;
+    r->len = len;
+    r->pos = CAPTURE_HEADER_LEN;
+    return true;
+}
+
+// Body length of an intact record at pos (tag, length and CRC check), or -1
+static int32_t record_len(const CaptureReader_t* r, uint32_t pos) {
+    if (pos + 4 > r->len) return -1;
+    uint8_t tag = r->data[pos];
+    if (tag != CAPTURE_TAG_KEY && tag != CAPTURE_TAG_DELTA) return -1;
+    uint32_t body = r->data[pos + 1] | (r->data[pos + 2] << 8);
+    if (pos + 4 + body > r->len) return -1;
+    if (crc8(r->data + pos, 3 + body) != r->data[pos + 3 + body]) return -1;
+    return (int32_t)body;
+}
+
+static bool decode_record(CaptureReader_t* r, uint32_t pos, uint32_t body) {
+    In_t in = {r->data + pos + 3, body, 0, true};
+    CaptureFrame_t f;
+    if (r->data[pos] == CAPTURE_TAG_KEY) {
+        memset(&f, 0, sizeof(f));
+        f.tick = get32(&in);
+        f.t = get32(&in) - 1;
+        if (!decode_fields(&in, &f)) return false;
+    } else {
+        if (!r->synced) return false;
+        f = r->frame;
+        f.tick++;
+        if (!decode_fields(&in, &f)) return false;
+    }
+    r->frame = f;
+    r->synced = true;
+    return true;
+}
+
+const CaptureFrame_t* capture_next(CaptureReader_t* r) {
+    while (r->data && r->pos < r->len) {
+        int32_t body = record_len(r, r->pos);
+        if (body >= 0) {
+            if (decode_record(r, r->pos, (uint32_t)body)) {
+                r->pos += 4 + body;
+                return &r->frame;
+            }
+            // Intact delta without a base: wait for the next keyframe
+            if (r->data[r->pos] == CAPTURE_TAG_DELTA && !r->synced) {
+                r->pos += 4 + body;
+                r->skipped += 4 + body;
+                continue;
+            }
+        }
+        // Damaged: step byte by byte until a record decodes again
+        r->synced = false;
+        r->pos++;
+        r->skipped++;
+    }
+    return NULL;
+}
+
+bool capture_seek(CaptureReader_t* r, uint32_t tick) {
+    if (!r->data) return false;
+
+    // Hop record to record for the last keyframe at or before tick
+    uint32_t keyPos = 0;
+    uint32_t keyTick = 0;
+    bool found = false;
+    uint32_t pos = CAPTURE_HEADER_LEN;
+    while (pos < r->len) {
+        int32_t body = record_len(r, pos);
+        if (body < 0) {
+            pos++;
+            continue;
+        }
+        if (r->data[pos] == CAPTURE_TAG_KEY && body >= 4) {
+            const uint8_t* b = r->data + pos + 3;
+            uint32_t at = b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24);
+            if (at > tick) break;
+            keyPos = pos;
+            keyTick = at;
+            found = true;
+        }
+        pos += 4 + body;
+    }
+    if (!found) return false;
+
+    r->pos = keyPos;
+    r->synced = false;
+    if (keyTick >= tick) return true;
+
+    // Decode up to the tick before; step back if damage made us overshoot
+    while (r->pos < r->len) {
+        uint32_t at = r->pos;
+        CaptureFrame_t base = r->frame;
+        bool synced = r->synced;
+        const CaptureFrame_t* f = capture_next(r);
+        if (!f) return false;
+        if (f->tick + 1 >= tick) {
+            if (f->tick >= tick) {
+                r->pos = at;
+                r->frame = base;
+                r->synced = synced;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============ Files ============
+#if defined(ARDUINO)
+
+bool capture_file_open(CaptureFile_t* f, const char* path) {
+    memset(f, 0, sizeof(*f));
+    TsFlash_t fl;
+    if (!ts_flash_mount() || !ts_flash_open(&fl, path)) return false;
+    uint32_t len = ts_flash_size(&fl);
+    uint8_t* mem = len ? (uint8_t*)ps_malloc(len) : NULL;
+    bool ok = mem && ts_flash_read(&fl, 0, mem, len);
+    ts_flash_close(&fl);
+    if (!ok) {
+        free(mem);
+        return false;
+    }
+    f->data = mem;
+    f->len = len;
+    f->mem = mem;
+    return true;
+}
+
+void capture_file_close(CaptureFile_t* f) {
+    free(f->mem);
+    memset(f, 0, sizeof(*f));
+}
+
+bool capture_sink_serial(const uint8_t* data, uint32_t len, void* ctx) {
+    (void)ctx;
+    return Serial.write(data, len) == len;
+}
+
+#else  // Host build: map the file, serial goes to stdout
+
+bool capture_file_open(CaptureFile_t* f, const char* path) {
+    memset(f, 0, sizeof(*f));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    void* map = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (map == MAP_FAILED) return false;
+    madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+    f->data = (const uint8_t*)map;
+    f->len = (uint32_t)st.st_size;
+    f->mem = map;
+    return true;
+}
+
+void capture_file_close(CaptureFile_t* f) {
+    if (f->mem) munmap(f->mem, f->len);
+    memset(f, 0, sizeof(*f));
+}
+
+bool capture_sink_serial(const uint8_t* data, uint32_t len, void* ctx) {
+    (void)ctx;
+    return fwrite(data, 1, len, stdout) == len;
+}
+
+#endif
+
+// ============ Flash Sink ============
+bool capture_flash_sink_open(CaptureFlashSink_t* s, const char* path) {
+    s->offset = 0;
+    if (!ts_flash_mount()) return false;
+    ts_flash_remove(path);
+    return ts_flash_open(&s->fl, path);
+}
+
+void capture_flash_sink_close(CaptureFlashSink_t* s) {
+    ts_flash_sync(&s->fl);
+    ts_flash_close(&s->fl);
+}
+
+// Synced at every keyframe: a power cut loses at most one keyframe interval
+bool capture_sink_flash(const uint8_t* data, uint32_t len, void* ctx) {
+    CaptureFlashSink_t* s = (CaptureFlashSink_t*)ctx;
+    if (!ts_flash_write(&s->fl, s->offset, data, len)) return false;
+    s->offset += len;
+    if (data[0] == CAPTURE_TAG_KEY) ts_flash_sync(&s->fl);
+    return true;
+}
@@ -0,0 +1,140 @@
+// SIGNALTAP Stream Capture
+// Compact binary record of everything one machine showed, tick by tick:
+// sensor values, scenario state, health / risk targets, vision state and the
+// active alarm set. A fixed header is followed by length-prefixed records;
+// most are deltas against the previous tick (XOR'd float bits, changed
+// fields only), and every CAPTURE_KEY_EVERY ticks a keyframe carries the
+// full state so a reader can seek or resync after damage. Each record ends
+// in a CRC-8, so damaged records are dropped rather than decoded wrong.
+//
+// Writers push records through a sink (flash file or serial); readers work
+// on a byte buffer - mmap'd on host, loaded into PSRAM on the device.
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <Arduino.h>
+#include "ts_flash.h"
+#include "../data/alarm_engine.h"
+
+#define CAPTURE_MAGIC       0x50435453UL    // "STCP"
+#define CAPTURE_VERSION     1
+#define CAPTURE_HEADER_LEN  20
+#define CAPTURE_SENSORS     3
+#define CAPTURE_KEY_EVERY   60              // Ticks between keyframes
+#define CAPTURE_TEXT_LEN    16              // Vision strings, NUL included
+#define CAPTURE_MAX_RECORD  256
+
+// Record tags (followed by a little-endian u16 body length, the body and
+// a CRC-8 over all of it)
+#define CAPTURE_TAG_KEY     0xA5
+#define CAPTURE_TAG_DELTA   0x5A
+
+typedef struct {
+    uint8_t demo;               // Demo index the capture was taken on
+    uint8_t keyEvery;
+    uint16_t tickMs;            // Simulated time per record
+    uint32_t startT;            // Sample time of the first record
+    uint32_t startClock;        // Simulated clock (s) of the first record
+} CaptureHeader_t;
+
+// One tick of machine state
+typedef struct {
+    uint32_t tick;              // Records since the start of the capture
+    uint32_t t;                 // Sample time (s)
+    float sensors[CAPTURE_SENSORS];
+
+    uint8_t scenarioState;
+    uint8_t cycleCount;
+    uint16_t stateTimer;
+    uint8_t targetHealth;
+    float targetFailure;
+
+    uint16_t partCount;
+    uint8_t leds;               // CNC LEDs, run = bit 0 .. ready = bit 7
+    uint8_t di;
+    uint8_t dq;
+    uint8_t aq0;
+    float pressure;
+    float oilTemp;
+    char stackLight[CAPTURE_TEXT_LEN];
+    char errorCode[CAPTURE_TEXT_LEN];
+    char runState[CAPTURE_TEXT_LEN];
+    uint8_t textSet;            // Bit per string above; clear = no string (NULL)
+
+    uint8_t alarmCount;
+    uint8_t alarms[ALARM_MAX_ACTIVE];   // Active codes, oldest first
+} CaptureFrame_t;
+
+typedef struct {
+    uint32_t records;
+    uint32_t keyframes;
+    uint32_t bytes;             // Header included
+    uint32_t failed;            // Records the sink refused
+} CaptureStats_t;
+
+// Sink: false if the bytes could not be stored (the writer stops)
+typedef bool (*CaptureWriteFn)(const uint8_t* data, uint32_t len, void* ctx);
+
+typedef struct {
+    CaptureWriteFn write;
+    void* ctx;
+    uint8_t keyEvery;
+    bool ok;
+    CaptureFrame_t prev;        // Delta base
+    CaptureStats_t stats;
+} CaptureWriter_t;
+
+typedef struct {
+    const uint8_t* data;
+    uint32_t len;
+    CaptureHeader_t header;
+    uint32_t pos;               // Next record
+    bool synced;                // frame holds a valid delta base
+    uint32_t skipped;           // Damaged bytes stepped over while resyncing
+    CaptureFrame_t frame;       // Last decoded tick
+} CaptureReader_t;
+
+// Capture file held as one byte buffer
+typedef struct {
+    const uint8_t* data;
+    uint32_t len;
+    void* mem;                  // ps_malloc'd copy (device) or mapping (host)
+} CaptureFile_t;
+
+// Flash sink state: appends to one file
+typedef struct {
+    TsFlash_t fl;
+    uint32_t offset;
+} CaptureFlashSink_t;
+
+// ============ Public API ============
+
+// Writes the header; false if the sink refused it
+bool capture_begin(CaptureWriter_t* w, const CaptureHeader_t* h, CaptureWriteFn fn, void* ctx);
+
+// Append one tick (a keyframe every keyEvery ticks, a delta otherwise).
+// f->tick is assigned by the writer.
+bool capture_write(CaptureWriter_t* w, CaptureFrame_t* f);
+
+// Parse the header; false if data is not a capture
+bool capture_reader_init(CaptureReader_t* r, const uint8_t* data, uint32_t len);
+
+// Decode the next tick. Damaged records are skipped up to the next
+// keyframe. Returns NULL at the end of the data.
+const CaptureFrame_t* capture_next(CaptureReader_t* r);
+
+// Position so the next capture_next() returns tick (or the first tick
+// after it that is still intact); false if the capture ends before it
+bool capture_seek(CaptureReader_t* r, uint32_t tick);
+
+// Whole file as a buffer: mmap on host, PSRAM copy on the device
+bool capture_file_open(CaptureFile_t* f, const char* path);
+void capture_file_close(CaptureFile_t* f);
+
+// Sinks. The flash sink truncates path first.
+bool capture_flash_sink_open(CaptureFlashSink_t* s, const char* path);
+void capture_flash_sink_close(CaptureFlashSink_t* s);
+bool capture_sink_flash(const uint8_t* data, uint32_t len, void* ctx);
+bool capture_sink_serial(const uint8_t* data, uint32_t len, void* ctx);
+
+#endif // CAPTURE_H
@@ -0,0 +1,202 @@
+// SIGNALTAP Gorilla Codec Implementation
+#include "gorilla.h"
+#include <string.h>
+
+// ============ Bit Streams ============
+void bitw_init(BitWriter_t* w, uint8_t* buf, uint32_t capBytes) {
+    w->buf = buf;
+    w->capBytes = capBytes;
+    w->bitPos = 0;
+    memset(buf, 0, capBytes);
+}
+
+uint32_t bitw_bytes(const BitWriter_t* w) {
+    return (w->bitPos + 7) >> 3;
+}
+
+static void bitw_put(BitWriter_t* w, uint32_t value, uint8_t nbits) {
+    // MSB first; caller has checked capacity
+    for (int i = nbits - 1; i >= 0; i--) {
+        if ((value >> i) & 1) w->buf[w->bitPos >> 3] |= (uint8_t)(0x80 >> (w->bitPos & 7));
+        w->bitPos++;
+    }
+}
+
+void bitr_init(BitReader_t* r, const uint8_t* buf, uint32_t lenBytes) {
+    r->buf = buf;
+    r->lenBytes = lenBytes;
+    r->bitPos = 0;
+}
+
+static bool bitr_get(BitReader_t* r, uint8_t nbits, uint32_t* out) {
+    if (r->bitPos + nbits > r->lenBytes * 8) return false;
+    uint32_t v = 0;
+    for (int i = 0; i < nbits; i++) {
+        v = (v << 1) | ((r->buf[r->bitPos >> 3] >> (7 - (r->bitPos & 7))) & 1);
+        r->bitPos++;
+    }
+    *out = v;
+    return true;
+}
+
+// ============ Helpers ============
+static uint32_t float_bits(float f) {
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+static float bits_float(uint32_t u) {
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+static uint8_t clz32(uint32_t v) { return v ? (uint8_t)__builtin_clz(v) : 32; }
+static uint8_t ctz32(uint32_t v) { return v ? (uint8_t)__builtin_ctz(v) : 32; }
+
+// ============ Codec ============
+void gorilla_reset(GorillaState_t* s, uint8_t series) {
+    memset(s, 0, sizeof(*s));
+    s->series = series > GORILLA_MAX_SERIES ? GORILLA_MAX_SERIES : series;
+    for (int i = 0; i < GORILLA_MAX_SERIES; i++) s->prevLead[i] = 0xFF;
+}
+
+static void encode_timestamp(GorillaState_t* s, BitWriter_t* w, uint32_t t) {
+    if (s->count == 0) {
+        bitw_put(w, t, 32);
+        return;
+    }
+    int32_t delta = (int32_t)(t - s->prevT);
+    int32_t dod = delta - s->prevDelta;
+    if (dod == 0) {
+        bitw_put(w, 0, 1);
+    } else if (dod >= -64 && dod <= 63) {
+        bitw_put(w, 0x2, 2);
+        bitw_put(w, (uint32_t)dod & 0x7F, 7);
+    } else if (dod >= -256 && dod <= 255) {
+        bitw_put(w, 0x6, 3);
+        bitw_put(w, (uint32_t)dod & 0x1FF, 9);
+    } else if (dod >= -2048 && dod <= 2047) {
+        bitw_put(w, 0xE, 4);
+        bitw_put(w, (uint32_t)dod & 0xFFF, 12);
+    } else {
+        bitw_put(w, 0xF, 4);
+        bitw_put(w, (uint32_t)dod, 32);
+    }
+    s->prevDelta = delta;
+}
+
+static void encode_value(GorillaState_t* s, BitWriter_t* w, uint8_t i, float value) {
+    uint32_t bits = float_bits(value);
+    if (s->count == 0) {
+        bitw_put(w, bits, 32);
+        s->prevBits[i] = bits;
+        return;
+    }
+    uint32_t x = bits ^ s->prevBits[i];
+    s->prevBits[i] = bits;
+    if (x == 0) {
+        bitw_put(w, 0, 1);
+        return;
+    }
+    uint8_t lead = clz32(x);
+    uint8_t trail = ctz32(x);
+    if (lead > 31) lead = 31;   // 5-bit field
+
+    if (s->prevLead[i] != 0xFF && lead >= s->prevLead[i] && trail >= s->prevTrail[i]) {
+        // Meaningful bits fit in the previous window
+        uint8_t len = 32 - s->prevLead[i] - s->prevTrail[i];
+        bitw_put(w, 0x2, 2);
+        bitw_put(w, x >> s->prevTrail[i], len);
+    } else {
+        uint8_t len = 32 - lead - trail;
+        bitw_put(w, 0x3, 2);
+        bitw_put(w, lead, 5);
+        bitw_put(w, len - 1, 6);    // len is 1..32
+        bitw_put(w, x >> trail, len);
+        s->prevLead[i] = lead;
+        s->prevTrail[i] = trail;
+    }
+}
+
+bool gorilla_encode(GorillaState_t* s, BitWriter_t* w, uint32_t t, const float* values) {
+    if (w->bitPos + GORILLA_MAX_SAMPLE_BITS > w->capBytes * 8) return false;
+
+    encode_timestamp(s, w, t);
+    for (uint8_t i = 0; i < s->series; i++) encode_value(s, w, i, values[i]);
+    s->prevT = t;
+    s->count++;
+    return true;
+}
+
+static bool decode_timestamp(GorillaState_t* s, BitReader_t* r, uint32_t* t) {
+    uint32_t v;
+    if (s->count == 0) {
+        if (!bitr_get(r, 32, &v)) return false;
+        *t = v;
+        return true;
+    }
+    // Prefix is up to four 1-bits terminated by a 0
+    uint8_t ones = 0;
+    while (ones < 4) {
+        if (!bitr_get(r, 1, &v)) return false;
+        if (v == 0) break;
+        ones++;
+    }
+    int32_t dod = 0;
+    static const uint8_t widths[5] = {0, 7, 9, 12, 32};
+    if (ones > 0) {
+        uint8_t n = widths[ones];
+        if (!bitr_get(r, n, &v)) return false;
+        if (n < 32 && (v & (1u << (n - 1)))) v |= ~((1u << n) - 1);   // sign-extend
+        dod = (int32_t)v;
+    }
+    s->prevDelta += dod;
+    *t = s->prevT + (uint32_t)s->prevDelta;
+    return true;
+}
+
+static bool decode_value(GorillaState_t* s, BitReader_t* r, uint8_t i, float* value) {
+    uint32_t v;
+    if (s->count == 0) {
+        if (!bitr_get(r, 32, &v)) return false;
+        s->prevBits[i] = v;
+        *value = bits_float(v);
+        return true;
+    }
+    if (!bitr_get(r, 1, &v)) return false;
+    if (v == 0) {
+        *value = bits_float(s->prevBits[i]);
+        return true;
+    }
+    if (!bitr_get(r, 1, &v)) return false;
+    uint8_t lead, len;
+    if (v == 0) {
+        if (s->prevLead[i] == 0xFF) return false;
+        lead = s->prevLead[i];
+        len = 32 - s->prevLead[i] - s->prevTrail[i];
+    } else {
+        uint32_t l, n;
+        if (!bitr_get(r, 5, &l) || !bitr_get(r, 6, &n)) return false;
+        lead = (uint8_t)l;
+        len = (uint8_t)(n + 1);
+        if (lead + len > 32) return false;
+        s->prevLead[i] = lead;
+        s->prevTrail[i] = 32 - lead - len;
+    }
+    if (!bitr_get(r, len, &v)) return false;
+    s->prevBits[i] ^= v << s->prevTrail[i];
+    *value = bits_float(s->prevBits[i]);
+    return true;
+}
+
+bool gorilla_decode(GorillaState_t* s, BitReader_t* r, uint32_t* t, float* values) {
+    if (!decode_timestamp(s, r, t)) return false;
+    for (uint8_t i = 0; i < s->series; i++) {
+        if (!decode_value(s, r, i, &values[i])) return false;
+    }
+    s->prevT = *t;
+    s->count++;
+    return true;
+}
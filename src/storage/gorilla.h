@@ -0,0 +1,52 @@
+// SIGNALTAP Gorilla Codec
+// Delta-of-delta timestamps and XOR float compression (Pelkonen et al.,
+// "Gorilla", VLDB 2015) over a plain bit stream. Codec state carries
+// across byte-aligned chunks so a segment can be flushed incrementally.
+#ifndef GORILLA_H
+#define GORILLA_H
+
+#include <Arduino.h>
+
+#define GORILLA_MAX_SERIES      3
+// Worst case: '1111' + 32-bit dod, per series '11' + 5 + 6 + 32 bits
+#define GORILLA_MAX_SAMPLE_BITS (4 + 32 + GORILLA_MAX_SERIES * (2 + 5 + 6 + 32))
+
+// ============ Bit Streams ============
+typedef struct {
+    uint8_t* buf;
+    uint32_t capBytes;
+    uint32_t bitPos;
+} BitWriter_t;
+
+typedef struct {
+    const uint8_t* buf;
+    uint32_t lenBytes;
+    uint32_t bitPos;
+} BitReader_t;
+
+// ============ Codec State ============
+typedef struct {
+    uint8_t series;
+    uint32_t count;             // Samples coded so far
+    uint32_t prevT;
+    int32_t prevDelta;
+    uint32_t prevBits[GORILLA_MAX_SERIES];
+    uint8_t prevLead[GORILLA_MAX_SERIES];
+    uint8_t prevTrail[GORILLA_MAX_SERIES];
+} GorillaState_t;
+
+// ============ Public API ============
+
+void bitw_init(BitWriter_t* w, uint8_t* buf, uint32_t capBytes);
+uint32_t bitw_bytes(const BitWriter_t* w);   // Bytes used, rounded up
+void bitr_init(BitReader_t* r, const uint8_t* buf, uint32_t lenBytes);
+
+void gorilla_reset(GorillaState_t* s, uint8_t series);
+
+// Encode one sample; false if the writer is out of space (writer unchanged)
+bool gorilla_encode(GorillaState_t* s, BitWriter_t* w, uint32_t t, const float* values);
+
+// Decode one sample; false on truncated input
+bool gorilla_decode(GorillaState_t* s, BitReader_t* r, uint32_t* t, float* values);
+
+#endif // GORILLA_H
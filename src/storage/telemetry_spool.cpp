@@ -0,0 +1,269 @@
+// SIGNALTAP Telemetry Spool Implementation
+#include "telemetry_spool.h"
+#include <string.h>
+
+#if defined(ARDUINO)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+// Hand-over flags between the loop task and the writer task
+#define LOAD_ACQ(x)         __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_REL(x, v)     __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+
+// ============ Helper: CRC-32 (IEEE, reflected) ============
+static uint32_t crc32_update(uint32_t crc, const void* data, uint32_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    crc = ~crc;
+    while (len--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+static uint32_t page_crc(const SpoolPageHeader_t* h, const uint8_t* data) {
+    uint32_t crc = crc32_update(0, &h->seq, sizeof(h->seq));
+    crc = crc32_update(crc, &h->used, sizeof(h->used));
+    crc = crc32_update(crc, &h->records, sizeof(h->records));
+    return crc32_update(crc, data, h->used);
+}
+
+static uint32_t page_base(uint32_t seq) {
+    return (seq % SPOOL_PAGES) * SPOOL_PAGE_BYTES;
+}
+
+// Header and mark of the slot that should hold seq; false if it does not
+static bool read_header(Spool_t* sp, uint32_t seq, SpoolPageHeader_t* h, uint32_t* mark) {
+    uint8_t buf[SPOOL_HEADER_BYTES];
+    if (!ts_flash_read(&sp->flash, page_base(seq), buf, sizeof(buf))) return false;
+    memcpy(h, buf, sizeof(*h));
+    memcpy(mark, buf + sizeof(*h), sizeof(*mark));
+    return h->magic == SPOOL_MAGIC && h->seq == seq && h->used <= SPOOL_DATA_BYTES;
+}
+
+// ============ Helper: Writer side ============
+static void write_page(Spool_t* sp, SpoolStage_t* s) {
+    unsigned long t0 = micros();
+
+    // Ring full: the oldest unsent page makes room. If it is the page loaded
+    // for draining, it still goes out from RAM and is not lost.
+    if (sp->nextSeq - sp->headSeq >= SPOOL_PAGES) {
+        bool loaded = LOAD_ACQ(sp->drainState) != SPOOL_DRAIN_EMPTY && sp->drainSeq == sp->headSeq;
+        SpoolPageHeader_t old;
+        uint32_t mark;
+        if (!loaded) {
+            if (read_header(sp, sp->headSeq, &old, &mark)) sp->stats.recordsLost += old.records;
+            sp->stats.pagesLost++;
+        }
+        sp->headSeq++;
+    }
+
+    SpoolPageHeader_t h;
+    h.magic = SPOOL_MAGIC;
+    h.seq = sp->nextSeq;
+    h.used = s->used;
+    h.records = s->records;
+    h.crc = page_crc(&h, s->page + SPOOL_HEADER_BYTES);
+    uint32_t mark = 0xFFFFFFFFu;
+    memcpy(s->page, &h, sizeof(h));
+    memcpy(s->page + sizeof(h), &mark, sizeof(mark));
+
+    if (ts_flash_write(&sp->flash, page_base(h.seq), s->page, SPOOL_HEADER_BYTES + s->used) &&
+        ts_flash_sync(&sp->flash)) {
+        sp->nextSeq++;
+        sp->stats.pagesWritten++;
+    }
+
+    uint32_t us = (uint32_t)(micros() - t0);
+    sp->stats.writeUs += us;
+    if (us > sp->stats.maxWriteUs) sp->stats.maxWriteUs = us;
+}
+
+static void mark_drained(Spool_t* sp, uint32_t seq) {
+    uint32_t mark = SPOOL_DRAINED;
+    ts_flash_write(&sp->flash, page_base(seq) + sizeof(SpoolPageHeader_t), &mark, sizeof(mark));
+    ts_flash_sync(&sp->flash);
+}
+
+// Head page into the drain buffer; corrupt pages are stepped over, and
+// marked if their header still reads so a reopen does not start there
+static bool load_head(Spool_t* sp) {
+    while (sp->headSeq < sp->nextSeq) {
+        uint32_t seq = sp->headSeq;
+        SpoolPageHeader_t h;
+        uint32_t mark;
+        bool header = read_header(sp, seq, &h, &mark);
+        if (header &&
+            ts_flash_read(&sp->flash, page_base(seq) + SPOOL_HEADER_BYTES, sp->drain, h.used) &&
+            page_crc(&h, sp->drain) == h.crc) {
+            sp->drainUsed = h.used;
+            sp->drainSeq = seq;
+            return true;
+        }
+        if (header) mark_drained(sp, seq);
+        sp->stats.pagesCorrupt++;
+        sp->headSeq++;
+    }
+    return false;
+}
+
+// ============ Public API ============
+bool spool_open(Spool_t* sp, const char* path) {
+    memset(sp, 0, sizeof(*sp));
+    if (!ts_flash_mount() || !ts_flash_open(&sp->flash, path)) return false;
+
+    // Newest page written
+    bool any = false;
+    uint32_t newest = 0;
+    for (uint32_t slot = 0; slot < SPOOL_PAGES; slot++) {
+        uint8_t buf[SPOOL_HEADER_BYTES];
+        SpoolPageHeader_t h;
+        if (!ts_flash_read(&sp->flash, slot * SPOOL_PAGE_BYTES, buf, sizeof(buf))) continue;
+        memcpy(&h, buf, sizeof(h));
+        if (h.magic != SPOOL_MAGIC || h.seq % SPOOL_PAGES != slot) continue;
+        if (!any || h.seq > newest) newest = h.seq;
+        any = true;
+    }
+    sp->nextSeq = any ? newest + 1 : 1;
+
+    // Oldest page in the ring still waiting to be sent
+    sp->headSeq = sp->nextSeq;
+    uint32_t first = sp->nextSeq > SPOOL_PAGES ? sp->nextSeq - SPOOL_PAGES : 1;
+    for (uint32_t seq = first; seq < sp->nextSeq; seq++) {
+        SpoolPageHeader_t h;
+        uint32_t mark;
+        if (read_header(sp, seq, &h, &mark) && mark != SPOOL_DRAINED) {
+            sp->headSeq = seq;
+            break;
+        }
+    }
+    sp->pending = sp->nextSeq - sp->headSeq;
+    sp->ready = true;
+    return true;
+}
+
+void spool_close(Spool_t* sp) {
+    ts_flash_close(&sp->flash);
+    sp->ready = false;
+}
+
+bool spool_push(Spool_t* sp, const void* rec, uint16_t len, uint32_t nowMs) {
+    if (!sp->ready || len > SPOOL_DATA_BYTES - 2) return false;
+    SpoolStage_t* s = &sp->stage[sp->fill];
+    if (s->used + 2 + len > SPOOL_DATA_BYTES || (s->records && nowMs - s->openedMs >= SPOOL_SEAL_MS)) {
+        spool_seal(sp);
+        s = &sp->stage[sp->fill];
+        if (LOAD_ACQ(s->full) || s->used + 2 + len > SPOOL_DATA_BYTES) {
+            sp->stats.dropped++;
+            return false;
+        }
+    }
+    if (s->records == 0) s->openedMs = nowMs;
+    uint8_t* p = s->page + SPOOL_HEADER_BYTES + s->used;
+    p[0] = (uint8_t)len;
+    p[1] = (uint8_t)(len >> 8);
+    memcpy(p + 2, rec, len);
+    s->used += 2 + len;
+    s->records++;
+    sp->stats.pushed++;
+    return true;
+}
+
+void spool_seal(Spool_t* sp) {
+    SpoolStage_t* s = &sp->stage[sp->fill];
+    SpoolStage_t* next = &sp->stage[sp->fill ^ 1];
+    if (s->records == 0 || LOAD_ACQ(next->full)) return;
+    STORE_REL(s->full, 1);
+    next->used = 0;
+    next->records = 0;
+    sp->fill ^= 1;
+}
+
+bool spool_next(Spool_t* sp, const uint8_t** rec, uint16_t* len) {
+    if (LOAD_ACQ(sp->drainState) != SPOOL_DRAIN_READY || sp->readPos + 2 > sp->drainUsed) return false;
+    const uint8_t* p = sp->drain + sp->readPos;
+    uint16_t n = (uint16_t)(p[0] | (p[1] << 8));
+    if (sp->readPos + 2 + n > sp->drainUsed) return false;
+    *rec = p + 2;
+    *len = n;
+    sp->readPos += 2 + n;
+    return true;
+}
+
+void spool_commit(Spool_t* sp) {
+    if (LOAD_ACQ(sp->drainState) != SPOOL_DRAIN_READY) return;
+    for (uint16_t pos = sp->commitPos; pos < sp->readPos; ) {
+        uint16_t n = (uint16_t)(sp->drain[pos] | (sp->drain[pos + 1] << 8));
+        sp->stats.drainedRecords++;
+        sp->stats.drainedBytes += n;
+        pos += 2 + n;
+    }
+    sp->commitPos = sp->readPos;
+    if (sp->commitPos + 2 > sp->drainUsed) {
+        sp->readPos = sp->commitPos = 0;
+        STORE_REL(sp->drainState, (uint8_t)SPOOL_DRAIN_DONE);
+    }
+}
+
+void spool_rewind(Spool_t* sp) {
+    sp->readPos = sp->commitPos;
+}
+
+uint32_t spool_pending(const Spool_t* sp) {
+    uint32_t n = LOAD_ACQ(sp->pending);
+    for (int i = 0; i < 2; i++) {
+        if (LOAD_ACQ(sp->stage[i].full) || (i == sp->fill && sp->stage[i].records)) n++;
+    }
+    return n;
+}
+
+void spool_service(Spool_t* sp) {
+    if (!sp->ready) return;
+
+    // Sealed pages, in the order they were sealed
+    while (LOAD_ACQ(sp->stage[sp->write].full)) {
+        write_page(sp, &sp->stage[sp->write]);
+        STORE_REL(sp->stage[sp->write].full, (uint8_t)0);
+        sp->write ^= 1;
+    }
+
+    uint8_t state = LOAD_ACQ(sp->drainState);
+    if (state == SPOOL_DRAIN_DONE) {
+        // Unless the ring already overwrote it while it was going out
+        if (sp->drainSeq >= sp->headSeq) {
+            mark_drained(sp, sp->drainSeq);
+            sp->headSeq = sp->drainSeq + 1;
+        }
+        sp->stats.pagesDrained++;
+        state = SPOOL_DRAIN_EMPTY;
+        STORE_REL(sp->drainState, state);
+    }
+    if (state == SPOOL_DRAIN_EMPTY && load_head(sp)) {
+        STORE_REL(sp->drainState, (uint8_t)SPOOL_DRAIN_READY);
+    }
+    STORE_REL(sp->pending, sp->nextSeq - sp->headSeq);
+}
+
+#if defined(ARDUINO)
+static void spool_task(void* arg) {
+    Spool_t* sp = (Spool_t*)arg;
+    for (;;) {
+        spool_service(sp);
+        vTaskDelay(pdMS_TO_TICKS(SPOOL_TASK_MS));
+    }
+}
+
+bool spool_start_task(Spool_t* sp) {
+    return xTaskCreatePinnedToCore(spool_task, "spool", 4096, sp, 1, NULL, tskNO_AFFINITY) == pdPASS;
+}
+#else
+bool spool_start_task(Spool_t* sp) {
+    (void)sp;
+    return false;
+}
+#endif
+
+const SpoolStats_t* spool_get_stats(const Spool_t* sp) {
+    return &sp->stats;
+}
@@ -0,0 +1,129 @@
+// SIGNALTAP Telemetry Spool
+// Store-and-forward for outbound telemetry while the uplink is down. The
+// producer (the telemetry publisher, on the loop task) appends records to
+// a RAM page; full pages go to a ring of fixed-size pages in a flash file,
+// oldest overwritten once the ring is full. After reconnect the ring is
+// read back oldest first, one page per batch.
+//
+// All flash I/O happens in spool_service(): on the device a low-priority
+// background task runs it, so neither the sim loop nor the UI task ever
+// waits on the file system. The two sides hand pages over through two
+// RAM stage pages and one drain page with acquire/release flags; a push
+// that finds both stage pages still waiting for flash is dropped, never
+// blocked. On a host build the caller runs spool_service() itself.
+#ifndef TELEMETRY_SPOOL_H
+#define TELEMETRY_SPOOL_H
+
+#include <Arduino.h>
+#include "ts_flash.h"
+
+// ============ Geometry ============
+#define SPOOL_PAGE_BYTES    4096
+#define SPOOL_PAGES         512     // 2 MB spool file
+#define SPOOL_HEADER_BYTES  20      // SpoolPageHeader_t + drained mark
+#define SPOOL_DATA_BYTES    (SPOOL_PAGE_BYTES - SPOOL_HEADER_BYTES)
+#define SPOOL_SEAL_MS       60000   // A partial page goes to flash at least this often
+#define SPOOL_TASK_MS       10      // Background task period (device)
+
+#define SPOOL_MAGIC         0x4C505353u   // "SSPL"
+#define SPOOL_DRAINED       0x444E5244u   // "DRND", written over the mark once sent
+
+// ============ On-Flash Page ============
+// Header, then a u32 mark (erased until the page is drained), then records:
+// u16 length + bytes, packed
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;           // Page number since the spool was created; slot = seq % SPOOL_PAGES
+    uint16_t used;          // Record bytes
+    uint16_t records;
+    uint32_t crc;           // Over seq, used, records and the record bytes
+} SpoolPageHeader_t;
+
+typedef enum {
+    SPOOL_DRAIN_EMPTY = 0,  // Writer may load the next page
+    SPOOL_DRAIN_READY,      // Page loaded, consumer reading
+    SPOOL_DRAIN_DONE        // Consumer sent it all, writer marks it drained
+} SpoolDrainState_t;
+
+typedef struct {
+    // Producer / consumer side
+    uint32_t pushed;            // Records accepted
+    uint32_t dropped;           // Records refused: both stage pages waiting for flash
+    uint32_t drainedRecords;
+    uint32_t drainedBytes;
+    // Writer side
+    uint32_t pagesWritten;
+    uint32_t pagesDrained;
+    uint32_t pagesLost;         // Overwritten before they were sent
+    uint32_t recordsLost;       // Records in those pages
+    uint32_t pagesCorrupt;      // Failed CRC on the way back
+    uint32_t writeUs;           // Total time in page writes
+    uint32_t maxWriteUs;
+} SpoolStats_t;
+
+typedef struct {
+    uint8_t page[SPOOL_PAGE_BYTES];     // Laid out as on flash
+    uint16_t used;
+    uint16_t records;
+    uint32_t openedMs;                  // First record's push time
+    volatile uint8_t full;              // Set by the producer, cleared by the writer
+} SpoolStage_t;
+
+typedef struct {
+    TsFlash_t flash;
+    bool ready;
+
+    // Flash ring (writer side)
+    uint32_t headSeq;                   // Oldest page not yet drained
+    uint32_t nextSeq;                   // Next page to write
+    volatile uint32_t pending;          // nextSeq - headSeq, for the producer side
+
+    // Producer fills stage[fill]; the writer empties them in the same order
+    SpoolStage_t stage[2];
+    uint8_t fill;
+    uint8_t write;
+
+    // One page on its way out
+    uint8_t drain[SPOOL_DATA_BYTES];
+    uint16_t drainUsed;
+    uint32_t drainSeq;
+    volatile uint8_t drainState;        // SpoolDrainState_t
+    uint16_t readPos;
+    uint16_t commitPos;
+
+    SpoolStats_t stats;
+} Spool_t;
+
+// ============ Public API ============
+
+// Open (or create) the spool file and find the pages still to send
+bool spool_open(Spool_t* sp, const char* path);
+void spool_close(Spool_t* sp);
+
+// Producer: append one record (RAM only; false if dropped)
+bool spool_push(Spool_t* sp, const void* rec, uint16_t len, uint32_t nowMs);
+
+// Producer: hand the partial page to the writer now (e.g. on reconnect)
+void spool_seal(Spool_t* sp);
+
+// Consumer: next record of the page being drained (false when there is
+// none loaded or the page is used up); commit once the records returned
+// so far are delivered, rewind to hand them out again
+bool spool_next(Spool_t* sp, const uint8_t** rec, uint16_t* len);
+void spool_commit(Spool_t* sp);
+void spool_rewind(Spool_t* sp);
+
+// Pages waiting: on flash, plus staged in RAM
+uint32_t spool_pending(const Spool_t* sp);
+
+// Writer: write sealed pages, load the next page to drain, mark drained
+// pages. Runs in the background task on the device.
+void spool_service(Spool_t* sp);
+
+// Device: start the background writer task. Host: false, call
+// spool_service() from the loop instead.
+bool spool_start_task(Spool_t* sp);
+
+const SpoolStats_t* spool_get_stats(const Spool_t* sp);
+
+#endif // TELEMETRY_SPOOL_H
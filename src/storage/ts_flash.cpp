@@ -0,0 +1,103 @@
+// SIGNALTAP Storage Backend Implementation
+#include "ts_flash.h"
+
+#if defined(ARDUINO)
+#include <FFat.h>
+
+bool ts_flash_mount(void) {
+    return FFat.begin(true);
+}
+
+bool ts_flash_open(TsFlash_t* fl, const char* path) {
+    fl->open = false;
+    if (!FFat.exists(path)) {
+        File f = FFat.open(path, FILE_WRITE);
+        if (!f) return false;
+        f.close();
+    }
+    fl->file = FFat.open(path, "r+");
+    fl->open = (bool)fl->file;
+    return fl->open;
+}
+
+void ts_flash_close(TsFlash_t* fl) {
+    if (fl->open) fl->file.close();
+    fl->open = false;
+}
+
+bool ts_flash_remove(const char* path) {
+    return !FFat.exists(path) || FFat.remove(path);
+}
+
+uint32_t ts_flash_size(TsFlash_t* fl) {
+    return fl->open ? (uint32_t)fl->file.size() : 0;
+}
+
+bool ts_flash_read(TsFlash_t* fl, uint32_t offset, void* buf, uint32_t len) {
+    if (!fl->open || !fl->file.seek(offset)) return false;
+    return fl->file.read((uint8_t*)buf, len) == len;
+}
+
+bool ts_flash_write(TsFlash_t* fl, uint32_t offset, const void* buf, uint32_t len) {
+    if (!fl->open || !fl->file.seek(offset)) return false;
+    return fl->file.write((const uint8_t*)buf, len) == len;
+}
+
+bool ts_flash_sync(TsFlash_t* fl) {
+    if (!fl->open) return false;
+    fl->file.flush();
+    return true;
+}
+
+#else  // Host build: file-backed flash image
+
+// Partition paths ("/ts0.dat") live in the working directory
+static const char* host_path(const char* path) {
+    return path[0] == '/' ? path + 1 : path;
+}
+
+bool ts_flash_mount(void) {
+    return true;
+}
+
+bool ts_flash_open(TsFlash_t* fl, const char* path) {
+    path = host_path(path);
+    fl->fp = fopen(path, "r+b");
+    if (!fl->fp) fl->fp = fopen(path, "w+b");
+    fl->open = fl->fp != NULL;
+    return fl->open;
+}
+
+void ts_flash_close(TsFlash_t* fl) {
+    if (fl->open) fclose(fl->fp);
+    fl->open = false;
+}
+
+bool ts_flash_remove(const char* path) {
+    path = host_path(path);
+    FILE* fp = fopen(path, "rb");
+    if (!fp) return true;
+    fclose(fp);
+    return remove(path) == 0;
+}
+
+uint32_t ts_flash_size(TsFlash_t* fl) {
+    if (!fl->open || fseek(fl->fp, 0, SEEK_END) != 0) return 0;
+    return (uint32_t)ftell(fl->fp);
+}
+
+bool ts_flash_read(TsFlash_t* fl, uint32_t offset, void* buf, uint32_t len) {
+    if (!fl->open || fseek(fl->fp, offset, SEEK_SET) != 0) return false;
+    return fread(buf, 1, len, fl->fp) == len;
+}
+
+bool ts_flash_write(TsFlash_t* fl, uint32_t offset, const void* buf, uint32_t len) {
+    if (!fl->open || fseek(fl->fp, offset, SEEK_SET) != 0) return false;
+    return fwrite(buf, 1, len, fl->fp) == len;
+}
+
+bool ts_flash_sync(TsFlash_t* fl) {
+    return fl->open && fflush(fl->fp) == 0;
+}
+
+#endif
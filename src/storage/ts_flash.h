@@ -0,0 +1,44 @@
+// SIGNALTAP Storage Backend
+// Byte-addressed file access for the time-series store. On the device it
+// sits on the FAT partition (app3M_fat9M_16MB scheme); on a host build the
+// same calls use a plain file as the flash image.
+#ifndef TS_FLASH_H
+#define TS_FLASH_H
+
+#include <Arduino.h>
+
+#if defined(ARDUINO)
+#include <FS.h>
+#else
+#include <stdio.h>
+#endif
+
+typedef struct {
+#if defined(ARDUINO)
+    File file;
+#else
+    FILE* fp;
+#endif
+    bool open;
+} TsFlash_t;
+
+// ============ Public API ============
+
+// Mount the FAT partition, formatting it on first use (no-op on host)
+bool ts_flash_mount(void);
+
+// Open for read/write, creating an empty file if needed
+bool ts_flash_open(TsFlash_t* fl, const char* path);
+void ts_flash_close(TsFlash_t* fl);
+
+// Delete a file (true if it is gone afterwards)
+bool ts_flash_remove(const char* path);
+
+uint32_t ts_flash_size(TsFlash_t* fl);
+bool ts_flash_read(TsFlash_t* fl, uint32_t offset, void* buf, uint32_t len);
+bool ts_flash_write(TsFlash_t* fl, uint32_t offset, const void* buf, uint32_t len);
+
+// Push buffered writes down to the medium
+bool ts_flash_sync(TsFlash_t* fl);
+
+#endif // TS_FLASH_H
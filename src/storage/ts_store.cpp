@@ -0,0 +1,519 @@
+// SIGNALTAP Time-Series Store Implementation
+#include "ts_store.h"
+#include <string.h>
+#include <float.h>
+
+// Hand-over flags between the producer and the writer
+#define LOAD_ACQ(x)         __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_REL(x, v)     __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+
+// Scratch for reading chunks back (queries and recovery); single-threaded
+static uint8_t readBuf[TS_CHUNK_BYTES];
+
+// Erased-looking fill for new segments; writer side only
+static uint8_t fillBuf[TS_CHUNK_BYTES];
+
+// ============ Helper: CRC-32 (IEEE, reflected) ============
+static uint32_t crc32_update(uint32_t crc, const void* data, uint32_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    crc = ~crc;
+    while (len--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+static uint32_t chunk_crc(uint32_t seq, const TsChunkHeader_t* h, const uint8_t* payload) {
+    uint32_t crc = crc32_update(0, &seq, sizeof(seq));
+    crc = crc32_update(crc, h, offsetof(TsChunkHeader_t, crc));
+    return crc32_update(crc, payload, h->payloadBytes);
+}
+
+static uint32_t seg_base(int idx) {
+    return (uint32_t)idx * TS_SEGMENT_BYTES;
+}
+
+// ============ Helper: Segment summary ============
+static void info_reset(TsSegInfo_t* s) {
+    s->startTime = 0;
+    s->endTime = 0;
+    s->count = 0;
+    s->dataBytes = 0;
+    for (int i = 0; i < TS_SERIES; i++) {
+        s->min[i] = FLT_MAX;
+        s->max[i] = -FLT_MAX;
+    }
+}
+
+static void info_add(TsSegInfo_t* s, uint32_t t, const float* values) {
+    if (s->count == 0) s->startTime = t;
+    s->endTime = t;
+    s->count++;
+    for (int i = 0; i < TS_SERIES; i++) {
+        if (values[i] < s->min[i]) s->min[i] = values[i];
+        if (values[i] > s->max[i]) s->max[i] = values[i];
+    }
+}
+
+static void update_wear(TsStore_t* st) {
+    st->stats.minWrites = UINT32_MAX;
+    st->stats.maxWrites = 0;
+    for (int i = 0; i < TS_SEGMENT_COUNT; i++) {
+        uint32_t w = st->seg[i].writes;
+        if (w < st->stats.minWrites) st->stats.minWrites = w;
+        if (w > st->stats.maxWrites) st->stats.maxWrites = w;
+    }
+}
+
+// ============ Write Queue ============
+static bool queue_free(const TsStore_t* st, uint8_t n) {
+    for (uint8_t k = 0; k < n; k++) {
+        if (LOAD_ACQ(st->jobs[(st->jobFill + k) % TS_WRITE_JOBS].full)) return false;
+    }
+    return true;
+}
+
+// Callers check queue_free first
+static TsWriteJob_t* job_begin(TsStore_t* st, uint32_t offset, uint32_t extendTo) {
+    TsWriteJob_t* j = &st->jobs[st->jobFill];
+    j->offset = offset;
+    j->extendTo = extendTo;
+    j->len = 0;
+    return j;
+}
+
+static void job_add(TsWriteJob_t* j, const void* data, uint16_t len) {
+    memcpy(j->data + j->len, data, len);
+    j->len += len;
+}
+
+static void job_commit(TsStore_t* st, TsWriteJob_t* j) {
+    STORE_REL(j->full, (uint8_t)1);
+    st->jobFill = (st->jobFill + 1) % TS_WRITE_JOBS;
+}
+
+// Grow the file to size with 0xFF, as a first use of a segment slot
+static bool extend_file(TsStore_t* st, uint32_t size) {
+    uint32_t have = ts_flash_size(&st->flash);
+    if (have >= size) return true;
+    memset(fillBuf, 0xFF, sizeof(fillBuf));
+    for (uint32_t off = have; off < size; off += sizeof(fillBuf)) {
+        uint32_t n = size - off;
+        if (n > sizeof(fillBuf)) n = sizeof(fillBuf);
+        if (!ts_flash_write(&st->flash, off, fillBuf, n)) return false;
+    }
+    return true;
+}
+
+// Write out every queued job in order; returns how many
+static uint32_t drain_jobs(TsStore_t* st) {
+    uint32_t n = 0;
+    while (LOAD_ACQ(st->jobs[st->jobWrite].full)) {
+        TsWriteJob_t* j = &st->jobs[st->jobWrite];
+        unsigned long t0 = micros();
+        bool ok = extend_file(st, j->extendTo) &&
+                  ts_flash_write(&st->flash, j->offset, j->data, j->len) &&
+                  ts_flash_sync(&st->flash);
+        uint32_t us = (uint32_t)(micros() - t0);
+        if (!ok) st->stats.writeErrors++;
+        st->stats.writeUs += us;
+        if (us > st->stats.maxWriteUs) st->stats.maxWriteUs = us;
+        st->stats.jobsWritten++;
+        STORE_REL(j->full, (uint8_t)0);
+        st->jobWrite = (st->jobWrite + 1) % TS_WRITE_JOBS;
+        n++;
+    }
+    return n;
+}
+
+// ============ Chunk Walk ============
+// Decode every valid chunk of a segment in order. Stops at the first chunk
+// that fails its CRC (torn tail) or at dataBytes when the length is known.
+typedef struct {
+    uint32_t t0, t1;
+    TsSampleFn fn;
+    void* ctx;
+    uint32_t delivered;
+    bool pastEnd;
+} TsWalk_t;
+
+static bool walk_chunk(GorillaState_t* dec, const uint8_t* payload, uint16_t len, uint16_t count,
+                       TsSegInfo_t* summary, TsWalk_t* walk) {
+    BitReader_t r;
+    bitr_init(&r, payload, len);
+    uint32_t t;
+    float v[TS_SERIES];
+    for (uint16_t n = 0; n < count; n++) {
+        if (!gorilla_decode(dec, &r, &t, v)) return false;
+        if (summary) info_add(summary, t, v);
+        if (walk) {
+            if (t > walk->t1) {
+                walk->pastEnd = true;
+                return true;
+            }
+            if (t >= walk->t0) {
+                if (walk->fn) walk->fn(t, v, walk->ctx);
+                walk->delivered++;
+            }
+        }
+    }
+    return true;
+}
+
+// Returns bytes of valid chunk data; dec holds the codec state at the end
+static uint32_t walk_segment(TsStore_t* st, int idx, uint32_t limit, GorillaState_t* dec,
+                             TsSegInfo_t* summary, TsWalk_t* walk) {
+    uint32_t seq = st->seg[idx].seq;
+    uint32_t off = 0;
+    gorilla_reset(dec, TS_SERIES);
+
+    while (off + sizeof(TsChunkHeader_t) <= limit) {
+        TsChunkHeader_t h;
+        uint32_t at = seg_base(idx) + TS_DATA_START + off;
+        if (!ts_flash_read(&st->flash, at, &h, sizeof(h))) break;
+        if (h.payloadBytes == 0 || h.payloadBytes > TS_CHUNK_BYTES || h.count == 0) break;
+        if (off + sizeof(h) + h.payloadBytes > limit) break;
+        if (!ts_flash_read(&st->flash, at + sizeof(h), readBuf, h.payloadBytes)) break;
+        if (chunk_crc(seq, &h, readBuf) != h.crc) break;
+
+        if (!walk_chunk(dec, readBuf, h.payloadBytes, h.count, summary, walk)) break;
+        off += sizeof(h) + h.payloadBytes;
+        if (walk && walk->pastEnd) break;
+    }
+    return off;
+}
+
+// ============ Segment Lifecycle ============
+// Queues one job
+static void write_seal(TsStore_t* st, int idx) {
+    TsSegInfo_t* s = &st->seg[idx];
+    TsSeal_t seal;
+    memset(&seal, 0, sizeof(seal));
+    seal.magic = TS_SEAL_MAGIC;
+    seal.seq = s->seq;
+    seal.count = s->count;
+    seal.startTime = s->startTime;
+    seal.endTime = s->endTime;
+    seal.dataBytes = s->dataBytes;
+    memcpy(seal.min, s->min, sizeof(seal.min));
+    memcpy(seal.max, s->max, sizeof(seal.max));
+    seal.crc = crc32_update(0, &seal, offsetof(TsSeal_t, crc));
+
+    TsWriteJob_t* j = job_begin(st, seg_base(idx) + TS_DATA_END, 0);
+    job_add(j, &seal, sizeof(seal));
+    job_commit(st, j);
+    s->state = TS_SEG_SEALED;
+}
+
+// Wear-aware pick: unused segments by lowest write count, else the oldest
+static int pick_segment(TsStore_t* st) {
+    int best = -1;
+    for (int i = 0; i < TS_SEGMENT_COUNT; i++) {
+        if (st->seg[i].state != TS_SEG_FREE) continue;
+        if (best < 0 || st->seg[i].writes < st->seg[best].writes) best = i;
+    }
+    if (best >= 0) return best;
+    for (int i = 0; i < TS_SEGMENT_COUNT; i++) {
+        if (best < 0 || st->seg[i].seq < st->seg[best].seq) best = i;
+    }
+    return best;
+}
+
+// Queues one job; the writer extends the file on a slot's first use
+static bool open_segment(TsStore_t* st) {
+    int idx = pick_segment(st);
+    if (idx < 0) return false;
+
+    TsSegInfo_t* s = &st->seg[idx];
+    s->seq = st->nextSeq++;
+    s->writes++;
+    s->state = TS_SEG_OPEN;
+    info_reset(s);
+
+    // New seq invalidates any stale chunks and seal left in the slot
+    TsSegHeader_t h;
+    memset(&h, 0, sizeof(h));
+    h.magic = TS_SEG_MAGIC;
+    h.version = TS_VERSION;
+    h.series = TS_SERIES;
+    h.seq = s->seq;
+    h.writes = s->writes;
+    h.crc = crc32_update(0, &h, offsetof(TsSegHeader_t, crc));
+    TsWriteJob_t* j = job_begin(st, seg_base(idx), seg_base(idx + 1));
+    job_add(j, &h, sizeof(h));
+    job_commit(st, j);
+
+    st->active = idx;
+    st->dataOff = 0;
+    gorilla_reset(&st->codec, TS_SERIES);
+    bitw_init(&st->writer, st->chunk, sizeof(st->chunk));
+    st->chunkCount = 0;
+    update_wear(st);
+    return true;
+}
+
+// Queues up to three jobs
+static bool rotate(TsStore_t* st) {
+    if (st->active >= 0) {
+        if (!ts_flush(st)) return false;
+        write_seal(st, st->active);
+        st->active = -1;
+    }
+    return open_segment(st);
+}
+
+// ============ Public API ============
+bool ts_open(TsStore_t* st, const char* path) {
+    memset(st, 0, sizeof(*st));
+    st->active = -1;
+    if (!ts_flash_open(&st->flash, path)) return false;
+
+    uint32_t size = ts_flash_size(&st->flash);
+    int tail = -1;
+    for (int i = 0; i < TS_SEGMENT_COUNT; i++) {
+        TsSegInfo_t* s = &st->seg[i];
+        info_reset(s);
+        s->state = TS_SEG_FREE;
+        if (size < seg_base(i + 1)) continue;
+
+        TsSegHeader_t h;
+        if (!ts_flash_read(&st->flash, seg_base(i), &h, sizeof(h))) continue;
+        if (h.magic != TS_SEG_MAGIC || h.version != TS_VERSION ||
+            h.crc != crc32_update(0, &h, offsetof(TsSegHeader_t, crc))) continue;
+        s->seq = h.seq;
+        s->writes = h.writes;
+        if (h.seq >= st->nextSeq) st->nextSeq = h.seq + 1;
+
+        TsSeal_t seal;
+        if (ts_flash_read(&st->flash, seg_base(i) + TS_DATA_END, &seal, sizeof(seal)) &&
+            seal.magic == TS_SEAL_MAGIC && seal.seq == h.seq &&
+            seal.crc == crc32_update(0, &seal, offsetof(TsSeal_t, crc))) {
+            s->state = TS_SEG_SEALED;
+            s->count = seal.count;
+            s->startTime = seal.startTime;
+            s->endTime = seal.endTime;
+            s->dataBytes = seal.dataBytes;
+            memcpy(s->min, seal.min, sizeof(s->min));
+            memcpy(s->max, seal.max, sizeof(s->max));
+        } else {
+            s->state = TS_SEG_OPEN;
+            if (tail < 0 || s->seq > st->seg[tail].seq) tail = i;
+        }
+    }
+
+    // Rebuild summaries of unsealed segments from their valid chunks. Only
+    // the newest one keeps accepting appends; older ones were interrupted
+    // mid-seal and are sealed now, each seal written before the next is
+    // queued (no writer runs yet, and any number of them may be open).
+    for (int i = 0; i < TS_SEGMENT_COUNT; i++) {
+        TsSegInfo_t* s = &st->seg[i];
+        if (s->state != TS_SEG_OPEN) continue;
+        GorillaState_t dec;
+        s->dataBytes = walk_segment(st, i, TS_DATA_END - TS_DATA_START, &dec, s, NULL);
+        if (i == tail && s->seq == st->nextSeq - 1) {
+            st->active = i;
+            st->dataOff = s->dataBytes;
+            st->codec = dec;
+        } else {
+            write_seal(st, i);
+            drain_jobs(st);
+        }
+    }
+
+    bitw_init(&st->writer, st->chunk, sizeof(st->chunk));
+    update_wear(st);
+    st->ready = true;
+    return true;
+}
+
+void ts_close(TsStore_t* st) {
+    if (!st->ready) return;
+    ts_service(st);
+    ts_flush(st);
+    ts_service(st);
+    ts_flash_close(&st->flash);
+    st->ready = false;
+}
+
+bool ts_flush(TsStore_t* st) {
+    if (!st->ready || st->active < 0 || st->chunkCount == 0) return true;
+    if (!queue_free(st, 1)) return false;
+
+    TsChunkHeader_t h;
+    h.payloadBytes = (uint16_t)bitw_bytes(&st->writer);
+    h.count = st->chunkCount;
+    h.crc = chunk_crc(st->seg[st->active].seq, &h, st->chunk);
+
+    TsWriteJob_t* j = job_begin(st, seg_base(st->active) + TS_DATA_START + st->dataOff, 0);
+    job_add(j, &h, sizeof(h));
+    job_add(j, st->chunk, h.payloadBytes);
+    job_commit(st, j);
+
+    st->dataOff += sizeof(h) + h.payloadBytes;
+    st->seg[st->active].dataBytes = st->dataOff;
+    st->stats.bytes += sizeof(h) + h.payloadBytes;
+    st->stats.flushes++;
+    bitw_init(&st->writer, st->chunk, sizeof(st->chunk));
+    st->chunkCount = 0;
+    return true;
+}
+
+bool ts_append(TsStore_t* st, uint32_t t, const float* values) {
+    if (!st->ready) return false;
+    unsigned long t0 = micros();
+
+    if (st->active >= 0 && st->seg[st->active].count > 0 && t < st->seg[st->active].endTime) {
+        return false;
+    }
+
+    // Make sure a worst-case sample still fits in both the chunk and the
+    // segment, and that the jobs this may take are free
+    const uint32_t worst = (GORILLA_MAX_SAMPLE_BITS + 7) / 8;
+    uint8_t need = 1;
+    if (st->active >= 0) {
+        bool flush = bitw_bytes(&st->writer) + worst > TS_CHUNK_BYTES;
+        bool full = st->dataOff + sizeof(TsChunkHeader_t) + bitw_bytes(&st->writer) + worst >
+                    TS_DATA_END - TS_DATA_START;
+        need = full ? 3 : flush ? 1 : 0;
+    }
+    if (!queue_free(st, need)) {
+        st->stats.dropped++;
+        return false;
+    }
+    if (st->active < 0) {
+        if (!open_segment(st)) return false;
+    } else {
+        if (bitw_bytes(&st->writer) + worst > TS_CHUNK_BYTES && !ts_flush(st)) return false;
+        if (st->dataOff + sizeof(TsChunkHeader_t) + bitw_bytes(&st->writer) + worst >
+            TS_DATA_END - TS_DATA_START) {
+            if (!rotate(st)) return false;
+        }
+    }
+    if (!gorilla_encode(&st->codec, &st->writer, t, values)) return false;
+
+    info_add(&st->seg[st->active], t, values);
+    st->chunkCount++;
+    // With the queue full the chunk just keeps growing until a job frees
+    if (st->chunkCount >= TS_FLUSH_SAMPLES) ts_flush(st);
+
+    st->stats.samples++;
+    st->stats.appendMs += (micros() - t0) / 1000.0f;
+    st->stats.bytesPerSample = (st->stats.bytes + bitw_bytes(&st->writer)) / (float)st->stats.samples;
+    st->stats.samplesPerSec = (st->stats.appendMs > 0.0f) ? 1000.0f * st->stats.samples / st->stats.appendMs : 0.0f;
+    return true;
+}
+
+uint32_t ts_service(TsStore_t* st) {
+    if (!st->ready) return 0;
+    return drain_jobs(st);
+}
+
+uint8_t ts_pending(const TsStore_t* st) {
+    uint8_t n = 0;
+    for (int i = 0; i < TS_WRITE_JOBS; i++) {
+        if (LOAD_ACQ(st->jobs[i].full)) n++;
+    }
+    return n;
+}
+
+uint32_t ts_latest_time(const TsStore_t* st) {
+    uint32_t latest = 0;
+    for (int i = 0; i < TS_SEGMENT_COUNT; i++) {
+        if (st->seg[i].state != TS_SEG_FREE && st->seg[i].count > 0 && st->seg[i].endTime > latest) {
+            latest = st->seg[i].endTime;
+        }
+    }
+    return latest;
+}
+
+// Segments in seq (time) order
+static int sorted_segments(const TsStore_t* st, int16_t* order) {
+    int n = 0;
+    for (int i = 0; i < TS_SEGMENT_COUNT; i++) {
+        if (st->seg[i].state == TS_SEG_FREE || st->seg[i].count == 0) continue;
+        int j = n++;
+        while (j > 0 && st->seg[order[j - 1]].seq > st->seg[i].seq) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+    return n;
+}
+
+static void walk_range(TsStore_t* st, int idx, TsWalk_t* walk) {
+    GorillaState_t dec;
+    walk_segment(st, idx, st->seg[idx].dataBytes, &dec, NULL, walk);
+    if (idx == st->active && st->chunkCount > 0 && !walk->pastEnd) {
+        walk_chunk(&dec, st->chunk, bitw_bytes(&st->writer), st->chunkCount, NULL, walk);
+    }
+}
+
+uint32_t ts_query(TsStore_t* st, uint32_t t0, uint32_t t1, TsSampleFn fn, void* ctx) {
+    if (!st->ready) return 0;
+    ts_service(st);
+    unsigned long start = micros();
+
+    int16_t order[TS_SEGMENT_COUNT];
+    int n = sorted_segments(st, order);
+    TsWalk_t walk = {t0, t1, fn, ctx, 0, false};
+    uint16_t skipped = 0;
+
+    for (int k = 0; k < n && !walk.pastEnd; k++) {
+        const TsSegInfo_t* s = &st->seg[order[k]];
+        if (s->endTime < t0 || s->startTime > t1) {
+            skipped++;
+            continue;
+        }
+        walk_range(st, order[k], &walk);
+    }
+
+    st->stats.lastQueryUs = (uint32_t)(micros() - start);
+    st->stats.lastQuerySamples = walk.delivered;
+    st->stats.lastQuerySkipped = skipped;
+    return walk.delivered;
+}
+
+typedef struct {
+    uint8_t series;
+    float min;
+    float max;
+} TsMinMax_t;
+
+static void minmax_cb(uint32_t t, const float* values, void* ctx) {
+    (void)t;
+    TsMinMax_t* m = (TsMinMax_t*)ctx;
+    float v = values[m->series];
+    if (v < m->min) m->min = v;
+    if (v > m->max) m->max = v;
+}
+
+bool ts_range_minmax(TsStore_t* st, uint32_t t0, uint32_t t1, uint8_t series,
+                     float* minOut, float* maxOut) {
+    if (!st->ready || series >= TS_SERIES) return false;
+    ts_service(st);
+    TsMinMax_t m = {series, FLT_MAX, -FLT_MAX};
+
+    for (int i = 0; i < TS_SEGMENT_COUNT; i++) {
+        const TsSegInfo_t* s = &st->seg[i];
+        if (s->state == TS_SEG_FREE || s->count == 0) continue;
+        if (s->endTime < t0 || s->startTime > t1) continue;
+        if (s->startTime >= t0 && s->endTime <= t1) {
+            // Fully covered: the summary is enough
+            if (s->min[series] < m.min) m.min = s->min[series];
+            if (s->max[series] > m.max) m.max = s->max[series];
+        } else {
+            TsWalk_t walk = {t0, t1, minmax_cb, &m, 0, false};
+            walk_range(st, i, &walk);
+        }
+    }
+    if (m.min > m.max) return false;
+    *minOut = m.min;
+    *maxOut = m.max;
+    return true;
+}
+
+const TsStats_t* ts_get_stats(const TsStore_t* st) {
+    return &st->stats;
+}
@@ -0,0 +1,172 @@
+// SIGNALTAP Time-Series Store
+// Append-only, log-structured sensor history on the FAT partition.
+// The file is a ring of fixed-size segments; each holds a header, CRC'd
+// Gorilla-compressed chunks and, once full, a seal with time and min/max
+// summaries so queries can skip it without decoding.
+//
+// ts_append only encodes into RAM: finished chunks, seals and segment
+// headers go into a short queue of write jobs, and ts_service() does the
+// file writes and syncs. On the device a background task runs it (see
+// sim_start_store_task), so the loop never waits on the FAT partition; a
+// sample that finds the queue full is dropped and counted. Without a task
+// the caller runs ts_service() after appending. ts_open, ts_close and the
+// queries touch the file directly: call them only while no task services
+// the store (boot restore, host tools).
+#ifndef TS_STORE_H
+#define TS_STORE_H
+
+#include <Arduino.h>
+#include "ts_flash.h"
+#include "gorilla.h"
+
+// ============ Geometry ============
+#define TS_SERIES           3
+#define TS_SEGMENT_BYTES    16384   // ~1400 samples of 3 sensors at 1 Hz
+#define TS_SEGMENT_COUNT    64      // 1 MB per store file
+#define TS_HEADER_BYTES     32      // Segment header slot
+#define TS_SEAL_BYTES       64      // Seal slot at the end of the segment
+#define TS_DATA_START       TS_HEADER_BYTES
+#define TS_DATA_END         (TS_SEGMENT_BYTES - TS_SEAL_BYTES)
+#define TS_CHUNK_BYTES      768     // Staging buffer for one chunk
+#define TS_FLUSH_SAMPLES    60      // Samples per chunk (bounds loss on power cut)
+#define TS_WRITE_JOBS       4       // Queued file writes; a rotation takes 3
+
+#define TS_SEG_MAGIC        0x47535453u   // "STSG"
+#define TS_SEAL_MAGIC       0x4C455353u   // "SSEL"
+#define TS_VERSION          1
+
+// ============ On-Flash Records ============
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t series;
+    uint8_t reserved;
+    uint32_t seq;           // Monotonic across rotations
+    uint32_t writes;        // Times this segment has been (re)opened
+    uint32_t crc;
+} TsSegHeader_t;
+
+typedef struct {
+    uint16_t payloadBytes;
+    uint16_t count;
+    uint32_t crc;           // Over segment seq, this header and the payload
+} TsChunkHeader_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t count;
+    uint32_t startTime;
+    uint32_t endTime;
+    uint32_t dataBytes;
+    float min[TS_SERIES];
+    float max[TS_SERIES];
+    uint32_t crc;
+} TsSeal_t;
+
+// ============ Write Queue ============
+#define TS_JOB_BYTES        (sizeof(TsChunkHeader_t) + TS_CHUNK_BYTES)
+
+// One queued write: data at offset, the file first grown to extendTo with
+// erased-looking bytes (0: no growth), then synced
+typedef struct {
+    uint32_t offset;
+    uint32_t extendTo;
+    uint16_t len;
+    volatile uint8_t full;  // Set by the producer, cleared by the writer
+    uint8_t data[TS_JOB_BYTES];
+} TsWriteJob_t;
+
+// ============ RAM Index ============
+typedef enum {
+    TS_SEG_FREE = 0,
+    TS_SEG_OPEN,
+    TS_SEG_SEALED
+} TsSegState_t;
+
+typedef struct {
+    uint32_t seq;
+    uint32_t writes;
+    uint32_t startTime;
+    uint32_t endTime;
+    uint32_t count;
+    uint32_t dataBytes;
+    float min[TS_SERIES];
+    float max[TS_SERIES];
+    uint8_t state;          // TsSegState_t
+} TsSegInfo_t;
+
+typedef struct {
+    // Producer side
+    uint32_t samples;           // Appended this session
+    uint32_t dropped;           // Refused: the write queue was full
+    uint32_t bytes;             // Chunk bytes queued (headers included)
+    uint32_t flushes;
+    float bytesPerSample;
+    float appendMs;             // Total time in ts_append (RAM only)
+    float samplesPerSec;        // Append throughput: samples / appendMs
+    // Writer side (ts_service)
+    uint32_t jobsWritten;
+    uint32_t writeErrors;
+    uint32_t writeUs;           // Total time in file writes and syncs
+    uint32_t maxWriteUs;
+    uint32_t lastQueryUs;
+    uint32_t lastQuerySamples;
+    uint16_t lastQuerySkipped;  // Segments skipped via headers
+    uint32_t minWrites;         // Wear spread across segments
+    uint32_t maxWrites;
+} TsStats_t;
+
+typedef struct {
+    TsFlash_t flash;
+    TsSegInfo_t seg[TS_SEGMENT_COUNT];
+    int16_t active;             // Segment being appended, -1 if none
+    uint32_t nextSeq;
+    uint32_t dataOff;           // Bytes used in the active data area
+    GorillaState_t codec;
+    BitWriter_t writer;
+    uint8_t chunk[TS_CHUNK_BYTES];
+    uint16_t chunkCount;
+    TsWriteJob_t jobs[TS_WRITE_JOBS];
+    uint8_t jobFill;            // Next job the producer queues
+    uint8_t jobWrite;           // Next job the writer takes
+    TsStats_t stats;
+    bool ready;
+} TsStore_t;
+
+typedef void (*TsSampleFn)(uint32_t t, const float* values, void* ctx);
+
+// ============ Public API ============
+
+// Open (or create) a store file and recover the unsealed tail
+bool ts_open(TsStore_t* st, const char* path);
+
+// Queue the staged samples and write everything queued, then close
+void ts_close(TsStore_t* st);
+
+// Append one sample (t non-decreasing) in RAM; a chunk is queued for the
+// writer every TS_FLUSH_SAMPLES. False if dropped (queue full) or refused.
+bool ts_append(TsStore_t* st, uint32_t t, const float* values);
+
+// Queue any staged samples now (false if the queue is full)
+bool ts_flush(TsStore_t* st);
+
+// Writer: do the queued writes in order; returns the jobs written
+uint32_t ts_service(TsStore_t* st);
+
+// Jobs queued and not yet written
+uint8_t ts_pending(const TsStore_t* st);
+
+// Newest stored timestamp (0 if empty)
+uint32_t ts_latest_time(const TsStore_t* st);
+
+// Deliver samples with t0 <= t <= t1 in time order; returns the count
+uint32_t ts_query(TsStore_t* st, uint32_t t0, uint32_t t1, TsSampleFn fn, void* ctx);
+
+// Min/max of one series over [t0, t1]; fully covered segments use their seal
+bool ts_range_minmax(TsStore_t* st, uint32_t t0, uint32_t t1, uint8_t series,
+                     float* minOut, float* maxOut);
+
+const TsStats_t* ts_get_stats(const TsStore_t* st);
+
+#endif // TS_STORE_H
@@ -0,0 +1,349 @@
+// SIGNALTAP Alarm List Implementation
+#include "alarm_list.h"
+#include "ui_theme.h"
+#include "../data/simulation_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// ============ Row Pool ============
+typedef struct {
+    lv_obj_t* row;
+    lv_obj_t* dot;
+    lv_obj_t* msg;
+    lv_obj_t* time;
+    lv_obj_t* shelveBtn;
+    lv_obj_t* ackBtn;
+    uint32_t seq;           // Bound log record
+    uint8_t flags;          // Record flags when bound
+    bool bound;
+} AlarmRowSlot_t;
+
+static lv_obj_t* listObj = NULL;
+static lv_obj_t* spacer = NULL;
+static lv_obj_t* emptyLabel = NULL;
+static AlarmRowSlot_t pool[ALARM_LIST_POOL_MAX];
+static uint8_t poolSize = 0;
+
+// ============ Filter Index ============
+// Matching seqs, oldest first, in a ring: new records are appended at the
+// tail and recycled ones dropped from the head, so an alarm table change
+// costs the records it added, not a rescan of the log
+static uint32_t* rowIndex = NULL;       // PSRAM, or a shorter one in internal RAM
+static uint32_t indexCap = 0;
+static uint32_t indexHead = 0;
+static uint32_t rowCount = 0;
+static AlarmView_t view = ALARM_VIEW_ALL;
+static const AlarmTable_t* indexedTable = NULL;
+static uint32_t indexedRevision = 0;
+static uint32_t indexedEnd = 0;         // Log end seq when last indexed
+static uint32_t indexedAcks = 0;
+static AlarmView_t indexedView = ALARM_VIEW_COUNT;
+
+static const char* viewNames[ALARM_VIEW_COUNT] = {
+    "All", "Active", "Unacked", "Errors", "Warnings"
+};
+
+static bool view_matches(const AlarmRecord_t* rec) {
+    switch (view) {
+        case ALARM_VIEW_ACTIVE:   return !(rec->flags & ALARM_REC_CLEARED);
+        case ALARM_VIEW_UNACKED:  return !(rec->flags & ALARM_REC_ACKED);
+        case ALARM_VIEW_ERRORS:   return alarm_severity((AlarmCode_t)rec->code) == ALARM_SEV_ERROR;
+        case ALARM_VIEW_WARNINGS: return alarm_severity((AlarmCode_t)rec->code) == ALARM_SEV_WARNING;
+        default:                  return true;
+    }
+}
+
+// Row pos of the list (0 is the newest)
+static inline uint32_t index_at(uint32_t pos) {
+    return rowIndex[(indexHead + rowCount - 1 - pos) % indexCap];
+}
+
+// A full ring (the internal RAM fallback) lets the oldest row go; rows
+// acked out of the Unacked view are not back-filled from older records
+static void index_append(uint32_t seq) {
+    if (rowCount == indexCap) {
+        indexHead = (indexHead + 1) % indexCap;
+        rowCount--;
+    }
+    rowIndex[(indexHead + rowCount) % indexCap] = seq;
+    rowCount++;
+}
+
+static void index_append_range(const AlarmTable_t* table, uint32_t from, uint32_t end) {
+    uint32_t first = alarm_log_first_seq(table);
+    if (from < first) from = first;
+    for (uint32_t seq = from; seq < end; seq++) {
+        const AlarmRecord_t* rec = alarm_log_get(table, seq);
+        if (rec && view_matches(rec)) index_append(seq);
+    }
+}
+
+// Rows that no longer match (acked, in the Unacked view) leave; order kept
+static void index_compact(const AlarmTable_t* table) {
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < rowCount; i++) {
+        uint32_t seq = rowIndex[(indexHead + i) % indexCap];
+        const AlarmRecord_t* rec = alarm_log_get(table, seq);
+        if (rec && view_matches(rec)) rowIndex[(indexHead + kept++) % indexCap] = seq;
+    }
+    rowCount = kept;
+}
+
+static void update_index(const AlarmTable_t* table) {
+    bool full = table != indexedTable || view != indexedView ||
+                (table && alarm_log_end_seq(table) < indexedEnd);
+    indexedTable = table;
+    indexedRevision = table ? table->revision : 0;
+    indexedView = view;
+    if (!table || !rowIndex) {
+        rowCount = 0;
+        indexedEnd = 0;
+        return;
+    }
+    uint32_t end = alarm_log_end_seq(table);
+
+    if (view == ALARM_VIEW_ACTIVE) {
+        // The uncleared records are the active table's entries, oldest first
+        indexHead = rowCount = 0;
+        for (uint8_t i = 0; i < alarm_count(table); i++) {
+            uint32_t seq = alarm_get(table, i)->logSeq;
+            if (alarm_log_get(table, seq)) index_append(seq);
+        }
+    } else if (full) {
+        // Table or view changed: the one full scan
+        indexHead = rowCount = 0;
+        index_append_range(table, 0, end);
+    } else {
+        uint32_t first = alarm_log_first_seq(table);
+        while (rowCount && rowIndex[indexHead] < first) {
+            indexHead = (indexHead + 1) % indexCap;
+            rowCount--;
+        }
+        if (view == ALARM_VIEW_UNACKED && table->logAcks != indexedAcks) index_compact(table);
+        index_append_range(table, indexedEnd, end);
+    }
+    indexedEnd = end;
+    indexedAcks = table->logAcks;
+}
+
+// ============ Row Binding ============
+static void ack_row_event_cb(lv_event_t* e) {
+    AlarmRowSlot_t* slot = (AlarmRowSlot_t*)lv_event_get_user_data(e);
+    if (!slot->bound) return;
+    sim_ack_alarm_record(slot->seq);
+    alarm_list_refresh();
+}
+
+static void shelve_row_event_cb(lv_event_t* e) {
+    AlarmRowSlot_t* slot = (AlarmRowSlot_t*)lv_event_get_user_data(e);
+    if (!slot->bound) return;
+    const AlarmRecord_t* rec = alarm_log_get(sim_get_alarm_table(), slot->seq);
+    if (rec) sim_shelve_alarm((AlarmCode_t)rec->code);
+    alarm_list_refresh();
+}
+
+static void bind_slot(AlarmRowSlot_t* slot, uint32_t seq, const AlarmRecord_t* rec) {
+    AlarmCode_t code = (AlarmCode_t)rec->code;
+    AlarmSeverity_t severity = alarm_severity(code);
+    bool acked = (rec->flags & ALARM_REC_ACKED) != 0;
+    bool cleared = (rec->flags & ALARM_REC_CLEARED) != 0;
+
+    lv_obj_set_style_bg_color(slot->dot,
+        severity == ALARM_SEV_ERROR ? COLOR_ERROR :
+        severity == ALARM_SEV_WARNING ? COLOR_WARNING : COLOR_INFO, 0);
+
+    if (rec->flags & ALARM_REC_CHATTER) {
+        lv_label_set_text_fmt(slot->msg, "%s (chattering)", alarm_message(code));
+    } else {
+        lv_label_set_text(slot->msg, alarm_message(code));
+    }
+    lv_obj_set_style_text_color(slot->msg, acked ? COLOR_TEXT_DIM : COLOR_TEXT_PRIMARY, 0);
+
+    char timeStr[24];
+    char raised[12];
+    alarm_format_time(rec->raisedAt, raised, sizeof(raised));
+    if (cleared) {
+        char clearedStr[12];
+        alarm_format_time(rec->clearedAt, clearedStr, sizeof(clearedStr));
+        snprintf(timeStr, sizeof(timeStr), "%s-%s", raised, clearedStr);
+    } else {
+        snprintf(timeStr, sizeof(timeStr), "%s", raised);
+    }
+    lv_label_set_text(slot->time, timeStr);
+
+    lv_obj_set_style_opa(slot->row, (acked || cleared) ? LV_OPA_50 : LV_OPA_COVER, 0);
+    if (acked) lv_obj_add_flag(slot->ackBtn, LV_OBJ_FLAG_HIDDEN);
+    else lv_obj_clear_flag(slot->ackBtn, LV_OBJ_FLAG_HIDDEN);
+    if (cleared) lv_obj_add_flag(slot->shelveBtn, LV_OBJ_FLAG_HIDDEN);
+    else lv_obj_clear_flag(slot->shelveBtn, LV_OBJ_FLAG_HIDDEN);
+
+    slot->seq = seq;
+    slot->flags = rec->flags;
+    slot->bound = true;
+}
+
+static void bind_rows(bool force) {
+    if (!listObj) return;
+    const AlarmTable_t* table = sim_get_alarm_table();
+
+    int32_t first = lv_obj_get_scroll_y(listObj) / ALARM_LIST_ROW_H;
+    if (first < 0) first = 0;
+
+    for (uint8_t i = 0; i < poolSize; i++) {
+        AlarmRowSlot_t* slot = &pool[i];
+        uint32_t pos = (uint32_t)first + i;
+        const AlarmRecord_t* rec = NULL;
+        uint32_t seq = pos < rowCount ? index_at(pos) : 0;
+        if (table && pos < rowCount) rec = alarm_log_get(table, seq);
+        if (!rec) {
+            lv_obj_add_flag(slot->row, LV_OBJ_FLAG_HIDDEN);
+            slot->bound = false;
+            continue;
+        }
+        lv_obj_clear_flag(slot->row, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_set_y(slot->row, (int32_t)pos * ALARM_LIST_ROW_H);
+        if (force || !slot->bound || slot->seq != seq || slot->flags != rec->flags) {
+            bind_slot(slot, seq, rec);
+        }
+    }
+
+    if (rowCount == 0) lv_obj_clear_flag(emptyLabel, LV_OBJ_FLAG_HIDDEN);
+    else lv_obj_add_flag(emptyLabel, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void list_scroll_event_cb(lv_event_t* e) {
+    (void)e;
+    bind_rows(false);
+}
+
+// ============ Row Creation (once per pool slot) ============
+static void create_slot(AlarmRowSlot_t* slot, int width) {
+    lv_obj_t* row = lv_obj_create(listObj);
+    lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_color(row, COLOR_BORDER, 0);
+    lv_obj_set_style_border_width(row, 1, 0);
+    lv_obj_set_style_border_side(row, LV_BORDER_SIDE_BOTTOM, 0);
+    lv_obj_set_style_radius(row, 0, 0);
+    lv_obj_set_style_pad_all(row, 8, 0);
+    lv_obj_set_size(row, width, ALARM_LIST_ROW_H);
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+    slot->row = row;
+
+    slot->dot = lv_obj_create(row);
+    lv_obj_set_size(slot->dot, 8, 8);
+    lv_obj_set_style_radius(slot->dot, 4, 0);
+    lv_obj_set_style_border_width(slot->dot, 0, 0);
+    lv_obj_set_style_bg_opa(slot->dot, LV_OPA_COVER, 0);
+    lv_obj_align(slot->dot, LV_ALIGN_LEFT_MID, 0, 0);
+
+    slot->msg = lv_label_create(row);
+    lv_obj_set_style_text_font(slot->msg, &lv_font_montserrat_12, 0);
+    lv_obj_align(slot->msg, LV_ALIGN_LEFT_MID, 16, 0);
+    lv_obj_set_width(slot->msg, width - 300);
+    lv_label_set_long_mode(slot->msg, LV_LABEL_LONG_DOT);
+
+    slot->time = lv_label_create(row);
+    lv_obj_set_style_text_color(slot->time, COLOR_TEXT_DIM, 0);
+    lv_obj_align(slot->time, LV_ALIGN_RIGHT_MID, -126, 0);
+
+    slot->shelveBtn = lv_btn_create(row);
+    lv_obj_set_size(slot->shelveBtn, 60, 26);
+    lv_obj_set_style_bg_color(slot->shelveBtn, COLOR_BORDER, 0);
+    lv_obj_set_style_radius(slot->shelveBtn, 4, 0);
+    lv_obj_set_style_shadow_width(slot->shelveBtn, 0, 0);
+    lv_obj_align(slot->shelveBtn, LV_ALIGN_RIGHT_MID, -56, 0);
+    lv_obj_t* shelveLabel = lv_label_create(slot->shelveBtn);
+    lv_label_set_text(shelveLabel, "SHELVE");
+    lv_obj_set_style_text_color(shelveLabel, COLOR_TEXT_MUTED, 0);
+    lv_obj_set_style_text_font(shelveLabel, &lv_font_montserrat_12, 0);
+    lv_obj_center(shelveLabel);
+    lv_obj_add_event_cb(slot->shelveBtn, shelve_row_event_cb, LV_EVENT_CLICKED, slot);
+
+    slot->ackBtn = lv_btn_create(row);
+    lv_obj_set_size(slot->ackBtn, 50, 26);
+    lv_obj_set_style_bg_color(slot->ackBtn, COLOR_BORDER, 0);
+    lv_obj_set_style_radius(slot->ackBtn, 4, 0);
+    lv_obj_set_style_shadow_width(slot->ackBtn, 0, 0);
+    lv_obj_align(slot->ackBtn, LV_ALIGN_RIGHT_MID, 0, 0);
+    lv_obj_t* ackLabel = lv_label_create(slot->ackBtn);
+    lv_label_set_text(ackLabel, "ACK");
+    lv_obj_set_style_text_color(ackLabel, COLOR_TEXT_PRIMARY, 0);
+    lv_obj_center(ackLabel);
+    lv_obj_add_event_cb(slot->ackBtn, ack_row_event_cb, LV_EVENT_CLICKED, slot);
+
+    slot->bound = false;
+}
+
+// ============ Public API ============
+lv_obj_t* alarm_list_create(lv_obj_t* parent, int width, int height) {
+    if (!rowIndex) {
+        rowIndex = (uint32_t*)ps_malloc(ALARM_LOG_LEN * sizeof(uint32_t));
+        indexCap = ALARM_LOG_LEN;
+    }
+    if (!rowIndex) {
+        // No PSRAM: the newest rows only, from internal RAM
+        rowIndex = (uint32_t*)malloc(ALARM_LIST_INDEX_FALLBACK * sizeof(uint32_t));
+        indexCap = rowIndex ? ALARM_LIST_INDEX_FALLBACK : 0;
+    }
+
+    listObj = lv_obj_create(parent);
+    style_card(listObj);
+    lv_obj_set_size(listObj, width, height);
+    lv_obj_set_scroll_dir(listObj, LV_DIR_VER);
+    lv_obj_add_event_cb(listObj, list_scroll_event_cb, LV_EVENT_SCROLL, NULL);
+
+    int inner = width - 2 * 12 - 2;
+    spacer = lv_obj_create(listObj);
+    lv_obj_set_style_bg_opa(spacer, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(spacer, 0, 0);
+    lv_obj_clear_flag(spacer, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_pos(spacer, 0, 0);
+    lv_obj_set_size(spacer, 1, 0);
+
+    emptyLabel = lv_label_create(listObj);
+    lv_label_set_text(emptyLabel, "No alarms in this view");
+    lv_obj_set_style_text_color(emptyLabel, COLOR_SUCCESS, 0);
+    lv_obj_add_flag(emptyLabel, LV_OBJ_FLAG_HIDDEN);
+
+    // One row more than fits, plus one for a partially scrolled row
+    poolSize = (uint8_t)(height / ALARM_LIST_ROW_H + 2);
+    if (poolSize > ALARM_LIST_POOL_MAX) poolSize = ALARM_LIST_POOL_MAX;
+    for (uint8_t i = 0; i < poolSize; i++) create_slot(&pool[i], inner);
+
+    indexedTable = NULL;
+    indexedView = ALARM_VIEW_COUNT;
+    alarm_list_refresh();
+    return listObj;
+}
+
+void alarm_list_set_view(AlarmView_t view_) {
+    if (view_ >= ALARM_VIEW_COUNT || view_ == view) return;
+    view = view_;
+    if (listObj) lv_obj_scroll_to_y(listObj, 0, LV_ANIM_OFF);
+    alarm_list_refresh();
+}
+
+AlarmView_t alarm_list_get_view(void) {
+    return view;
+}
+
+const char* alarm_list_view_name(AlarmView_t v) {
+    return v < ALARM_VIEW_COUNT ? viewNames[v] : "";
+}
+
+uint32_t alarm_list_row_count(void) {
+    return rowCount;
+}
+
+void alarm_list_refresh(void) {
+    if (!listObj) return;
+    const AlarmTable_t* table = sim_get_alarm_table();
+    bool changed = table != indexedTable || view != indexedView ||
+                   (table && table->revision != indexedRevision);
+    if (changed) {
+        update_index(table);
+        lv_obj_set_height(spacer, (int32_t)rowCount * ALARM_LIST_ROW_H);
+    }
+    bind_rows(changed);
+}
@@ -0,0 +1,40 @@
+// SIGNALTAP Alarm List
+// Virtualized view of the alarm log. A fixed pool of row widgets, sized to
+// the viewport, is rebound to log records as the list scrolls, so frame
+// time and widget memory do not depend on how many alarms are logged.
+// Filters go through a precomputed index of matching sequence numbers,
+// kept up to date from the log head as alarms are added, acked or recycled.
+#ifndef ALARM_LIST_H
+#define ALARM_LIST_H
+
+#include <lvgl.h>
+
+#define ALARM_LIST_ROW_H    40
+#define ALARM_LIST_POOL_MAX 24      // Rows for up to ~900 px of viewport
+#define ALARM_LIST_INDEX_FALLBACK 1024  // Newest rows indexed without PSRAM
+
+typedef enum {
+    ALARM_VIEW_ALL = 0,
+    ALARM_VIEW_ACTIVE,
+    ALARM_VIEW_UNACKED,
+    ALARM_VIEW_ERRORS,
+    ALARM_VIEW_WARNINGS,
+    ALARM_VIEW_COUNT
+} AlarmView_t;
+
+// ============ Public API ============
+
+// Create the list inside parent (replaces any previous list)
+lv_obj_t* alarm_list_create(lv_obj_t* parent, int width, int height);
+
+void alarm_list_set_view(AlarmView_t view);
+AlarmView_t alarm_list_get_view(void);
+const char* alarm_list_view_name(AlarmView_t view);
+
+// Rows matching the current view
+uint32_t alarm_list_row_count(void);
+
+// Re-index if the alarm table changed, then rebind the visible rows
+void alarm_list_refresh(void);
+
+#endif // ALARM_LIST_H
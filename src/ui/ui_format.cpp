@@ -0,0 +1,162 @@
+// SIGNALTAP Number Formatting Implementation
+#include "ui_format.h"
+#include <string.h>
+
+static const uint32_t powersOf10[FMT_MAX_DECIMALS + 1] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+
+static FmtStats_t stats;
+
+typedef enum {
+    SCALED_OK = 0,
+    SCALED_NAN,
+    SCALED_INF,
+    SCALED_RANGE
+} Scaled_t;
+
+// ============ Helper: Scale ============
+// A float is mant * 2^e exactly; mant * 10^decimals < 2^44 fits 64 bits,
+// so the shift by e is the only rounding step. Rounds half to even, the
+// way printf rounds the exact binary value.
+static Scaled_t scale(float value, uint8_t decimals, uint64_t* mag, uint8_t* neg) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    *neg = (uint8_t)(bits >> 31);
+    *mag = 0;
+    uint32_t exp = (bits >> 23) & 0xFF;
+    uint32_t mant = bits & 0x7FFFFF;
+    if (exp == 0xFF) return mant ? SCALED_NAN : SCALED_INF;
+
+    int e = -149;
+    if (exp != 0) {
+        mant |= 0x800000;
+        e = (int)exp - 150;
+    }
+    uint64_t p = (uint64_t)mant * powersOf10[decimals];
+    if (e >= 0) {
+        if (e > 19) return SCALED_RANGE;
+        *mag = p << e;
+        return SCALED_OK;
+    }
+    int k = -e;
+    if (k >= 64) return SCALED_OK;      // p < 2^44: under half of 2^k
+    uint64_t q = p >> k;
+    uint64_t r = p - (q << k);
+    uint64_t half = 1ULL << (k - 1);
+    if (r > half || (r == half && (q & 1))) q++;
+    *mag = q;
+    return SCALED_OK;
+}
+
+// ============ Helper: Output ============
+typedef struct {
+    char* out;
+    size_t size;
+    size_t len;
+} Writer_t;
+
+static void put(Writer_t* w, char c) {
+    if (w->len + 1 < w->size) w->out[w->len++] = c;
+}
+
+static void put_str(Writer_t* w, const char* s) {
+    while (s && *s) put(w, *s++);
+}
+
+static int finish(Writer_t* w) {
+    if (w->size) w->out[w->len] = '\0';
+    return (int)w->len;
+}
+
+// Digits of mag with the point decimals places from the right, and at
+// least one digit in front of it
+static void put_fixed(Writer_t* w, Scaled_t st, uint64_t mag, uint8_t neg, uint8_t decimals) {
+    if (st == SCALED_RANGE) {
+        put_str(w, "--");
+        return;
+    }
+    if (neg) put(w, '-');
+    if (st != SCALED_OK) {
+        put_str(w, st == SCALED_NAN ? "nan" : "inf");
+        return;
+    }
+    char digits[24];
+    int n = 0;
+    // 32-bit divides where they do: most labels never need the 64-bit ones
+    while (mag > 0xFFFFFFFFull) {
+        digits[n++] = (char)('0' + mag % 10);
+        mag /= 10;
+    }
+    uint32_t m = (uint32_t)mag;
+    do {
+        digits[n++] = (char)('0' + m % 10);
+        m /= 10;
+    } while (m);
+    while (n <= decimals) digits[n++] = '0';
+    while (n > 0) {
+        if (n == decimals) put(w, '.');
+        put(w, digits[--n]);
+    }
+}
+
+// ============ Public API ============
+int fmt_fixed(char* out, size_t size, float value, uint8_t decimals, const char* suffix) {
+    if (decimals > FMT_MAX_DECIMALS) decimals = FMT_MAX_DECIMALS;
+    Writer_t w = {out, size, 0};
+    uint64_t mag;
+    uint8_t neg;
+    Scaled_t st = scale(value, decimals, &mag, &neg);
+    put_fixed(&w, st, mag, neg, decimals);
+    put_str(&w, suffix);
+    return finish(&w);
+}
+
+int fmt_value_unit(char* out, size_t size, float value, uint8_t decimals, const char* unit) {
+    int n = fmt_fixed(out, size, value, decimals, " ");
+    Writer_t w = {out, size, (size_t)n};
+    put_str(&w, unit);
+    return finish(&w);
+}
+
+int fmt_int(char* out, size_t size, int32_t value, const char* suffix) {
+    Writer_t w = {out, size, 0};
+    uint32_t m = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+    put_fixed(&w, SCALED_OK, m, value < 0, 0);
+    put_str(&w, suffix);
+    return finish(&w);
+}
+
+void fmt_cache_reset(FmtCache_t* c) {
+    memset(c, 0, sizeof(*c));
+}
+
+bool fmt_cache_update(FmtCache_t* c, float value, uint8_t decimals, const char* unit) {
+    if (decimals > FMT_MAX_DECIMALS) decimals = FMT_MAX_DECIMALS;
+    stats.updates++;
+    uint64_t mag;
+    uint8_t neg;
+    Scaled_t st = scale(value, decimals, &mag, &neg);
+    // NaN, infinity and out of range each get a key no digits can have
+    uint64_t key = (st == SCALED_OK) ? mag : ~(uint64_t)st;
+    if (c->valid && key == c->mag && neg == c->neg && decimals == c->decimals && unit == c->unit) {
+        stats.unchanged++;
+        return false;
+    }
+    c->mag = key;
+    c->neg = neg;
+    c->decimals = decimals;
+    c->unit = unit;
+    c->valid = 1;
+
+    Writer_t w = {c->text, sizeof(c->text), 0};
+    put_fixed(&w, st, mag, neg, decimals);
+    if (unit) {
+        put(&w, ' ');
+        put_str(&w, unit);
+    }
+    finish(&w);
+    return true;
+}
+
+const FmtStats_t* fmt_get_stats(void) {
+    return &stats;
+}
@@ -0,0 +1,55 @@
+// SIGNALTAP Number Formatting
+// Value labels without printf: a float is scaled to an integer of the
+// display precision straight from its bits (exact, no double maths, ties
+// to even as printf does), so "%.*f" output comes out byte for byte the
+// same with no heap, a few dozen bytes of stack and no float printf
+// linked into the UI path.
+//
+// A FmtCache_t sits next to a label and remembers the scaled integer it
+// last showed: fmt_cache_update() reports a change only when the digits
+// on screen would differ, so the label is left alone (no set_text, no
+// relayout, no redraw) while a sensor wanders below its display precision.
+#ifndef UI_FORMAT_H
+#define UI_FORMAT_H
+
+#include <Arduino.h>
+
+#define FMT_MAX_DECIMALS    6
+#define FMT_TEXT_MAX        32      // Value, space and unit
+
+typedef struct {
+    uint64_t mag;           // |value| * 10^decimals, rounded: the digits shown
+    uint8_t neg;
+    uint8_t decimals;
+    uint8_t valid;
+    const char* unit;
+    char text[FMT_TEXT_MAX];
+} FmtCache_t;
+
+typedef struct {
+    uint32_t updates;       // fmt_cache_update() calls
+    uint32_t unchanged;     // ... where the digits were the same
+} FmtStats_t;
+
+// ============ Public API ============
+
+// value to decimals (0..FMT_MAX_DECIMALS) places as "%.*f" would, then
+// suffix verbatim (NULL for none). Values of 2^43 and up print "--"; NaN
+// and infinities as printf does. Returns the length, truncated to fit.
+int fmt_fixed(char* out, size_t size, float value, uint8_t decimals, const char* suffix);
+
+// "value unit", as "%.*f %s"
+int fmt_value_unit(char* out, size_t size, float value, uint8_t decimals, const char* unit);
+
+int fmt_int(char* out, size_t size, int32_t value, const char* suffix);
+
+// Forget the last value: the next update reports a change
+void fmt_cache_reset(FmtCache_t* c);
+
+// True, with c->text rewritten, when value shows differently from the
+// last update (digits, decimals or unit); false and nothing touched if not
+bool fmt_cache_update(FmtCache_t* c, float value, uint8_t decimals, const char* unit);
+
+const FmtStats_t* fmt_get_stats(void);
+
+#endif // UI_FORMAT_H
@@ -1,8 +1,12 @@
 // SIGNALTAP UI Manager Implementation - Full Featured
 #include "ui_manager.h"
 #include "ui_theme.h"
+#include "alarm_list.h"
 #include "../../config.h"
 #include "../data/simulation_engine.h"
+#include "../data/downsample.h"
+#include "ui_format.h"
+#include "ui_mem.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -46,8 +50,25 @@ static lv_obj_t* visionContent = NULL;
 static lv_obj_t* aiContent = NULL;
 static lv_obj_t* remoteContent = NULL;
 
+// What the vision screen was built for; rebuilt only when this changes.
+// Between rebuilds the readouts update in place and the preview timer
+// redraws only the image.
+static uint8_t visionShownDemo = 0xFF;
+
 // Device ID for QR code
-static char deviceId[32] = "STAP-001-A7F3";
+static char deviceId[32] = DEVICE_ID;
+
+#if ENABLE_OTA
+static OtaUpdate_t* otaUpdate = NULL;
+#endif
+
+#if ENABLE_VISION
+// The image shows whichever preview buffer was taken last; the camera side
+// fills the other one
+static CamPreview_t* camPreview = NULL;
+static lv_image_dsc_t previewDsc;
+static lv_obj_t* previewImg = NULL;
+#endif
 
 // ============ Forward Declarations ============
 static void create_sidebar(lv_obj_t* parent);
@@ -69,13 +90,14 @@ static void rebuild_setup_content(void);
 static void rebuild_home_content(void);
 static void rebuild_sensors_content(void);
 static void rebuild_alarms_content(void);
+static bool alarms_view_changed(void);
 static void rebuild_vision_content(void);
 static void rebuild_ai_content(void);
 static void rebuild_remote_content(void);
+static void rebuild_settings_content(void);
 static void update_header_demo(void);
-static void create_vision_panel_content(lv_obj_t* parent, DemoProfile_t* demo, int yOffset);
+static void update_scenario_badge(void);
 static void create_qr_code(lv_obj_t* parent, const char* data, int size);
-static void create_insight_card(lv_obj_t* parent, AIInsight_t* insight, int width);
 
 // ============ Event Handlers ============
 static void nav_btn_event_cb(lv_event_t* e) {
@@ -94,14 +116,28 @@ static void power_btn_event_cb(lv_event_t* e) {
 }
 
 static void ack_btn_event_cb(lv_event_t* e) {
-    intptr_t alarmIdx = (intptr_t)lv_event_get_user_data(e);
-    sim_ack_alarm((uint8_t)alarmIdx);
+    intptr_t alarmCode = (intptr_t)lv_event_get_user_data(e);
+    sim_ack_alarm((AlarmCode_t)alarmCode);
+    rebuild_alarms_content();
+    rebuild_home_content();
+}
+
+static void shelve_btn_event_cb(lv_event_t* e) {
+    intptr_t alarmCode = (intptr_t)lv_event_get_user_data(e);
+    sim_shelve_alarm((AlarmCode_t)alarmCode);
     rebuild_alarms_content();
     rebuild_home_content();
 }
 
 static void ota_btn_event_cb(lv_event_t* e) {
     (void)e;
+#if ENABLE_OTA
+    if (otaUpdate) {
+        if (!ota_busy(otaUpdate)) ota_start(otaUpdate, OTA_URL);
+        rebuild_ai_content();
+        return;
+    }
+#endif
     if (!sim_ota_active()) {
         sim_start_ota();
         rebuild_ai_content();
@@ -170,11 +206,29 @@ void ui_show_main(void) {
     ui_navigate_to(SCREEN_HOME);
 }
 
+// Only the visible screen is kept current; the others catch up here when
+// they are shown. Each one updates in place and rebuilds its layout only
+// when the demo changes.
+static void refresh_screen(ScreenID_t screen) {
+    switch (screen) {
+        case SCREEN_SETUP:      rebuild_setup_content(); break;
+        case SCREEN_HOME:       rebuild_home_content(); break;
+        case SCREEN_SENSORS:    rebuild_sensors_content(); break;
+        case SCREEN_ALARMS:     if (alarms_view_changed()) rebuild_alarms_content(); break;
+        case SCREEN_VISION:     rebuild_vision_content(); break;
+        case SCREEN_AI:         rebuild_ai_content(); break;
+        case SCREEN_REMOTE:     rebuild_remote_content(); break;
+        case SCREEN_SETTINGS:   rebuild_settings_content(); break;
+        default: break;
+    }
+}
+
 void ui_navigate_to(ScreenID_t screen) {
     if (screen >= SCREEN_COUNT || screen == SCREEN_SPLASH) return;
     
     uiState.currentScreen = screen;
     update_nav_highlight();
+    refresh_screen(screen);
     
     for (int i = SCREEN_SETUP; i < SCREEN_COUNT; i++) {
         if (screens[i]) {
@@ -188,19 +242,46 @@ void ui_navigate_to(ScreenID_t screen) {
 }
 
 void ui_refresh(void) {
+    // Closes the last interval's heap counts; the view is screen and demo
+    ui_mem_tick(((uint32_t)getDemoIndex() << 8) | uiState.currentScreen);
     update_scenario_badge();
-    rebuild_setup_content();
-    rebuild_home_content();
-    rebuild_sensors_content();
-    rebuild_alarms_content();
+    refresh_screen(uiState.currentScreen);
+}
+
+#if ENABLE_OTA
+void ui_set_ota(OtaUpdate_t* ota) {
+    otaUpdate = ota;
+}
+#endif
+
+#if ENABLE_VISION
+// Polls at twice the preview rate so a new frame waits at most half an
+// interval. Only the image area is redrawn, and only when there is one.
+static void preview_timer_cb(lv_timer_t* timer) {
+    (void)timer;
+    if (!camPreview || !previewImg || uiState.currentScreen != SCREEN_VISION) return;
+    const uint16_t* buf = preview_take(camPreview);
+    if (!buf) return;
+    previewDsc.data = (const uint8_t*)buf;
+    lv_image_cache_drop(&previewDsc);
+    lv_obj_invalidate(previewImg);
+}
+
+void ui_set_preview(CamPreview_t* preview) {
+    camPreview = preview;
+    memset(&previewDsc, 0, sizeof(previewDsc));
+    previewDsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    previewDsc.header.cf = LV_COLOR_FORMAT_RGB565;
+    previewDsc.header.w = preview->width;
+    previewDsc.header.h = preview->height;
+    previewDsc.header.stride = preview->width * 2;
+    previewDsc.data_size = (uint32_t)preview->width * preview->height * 2;
+    previewDsc.data = (const uint8_t*)preview_front(preview);
+    lv_timer_create(preview_timer_cb, 1000 / (2 * PREVIEW_FPS), NULL);
+    visionShownDemo = 0xFF;     // The camera card gains the image
     rebuild_vision_content();
-    rebuild_ai_content();
-    rebuild_remote_content();
-    // Settings screen shows live sim state
-    if (uiState.currentScreen == SCREEN_SETTINGS) {
-        rebuild_settings_content();
-    }
 }
+#endif
 
 UIState_t* ui_get_state(void) {
     return &uiState;
@@ -230,8 +311,8 @@ void ui_toggle_system(void) {
 
 void ui_update_sensors(void) {
     if (!uiState.systemRunning) return;
-    rebuild_home_content();
-    rebuild_sensors_content();
+    if (uiState.currentScreen == SCREEN_HOME) rebuild_home_content();
+    if (uiState.currentScreen == SCREEN_SENSORS) rebuild_sensors_content();
 }
 
 // ============ Splash Screen ============
@@ -275,13 +356,14 @@ static void create_setup_screen(void) {
     rebuild_setup_content();
 }
 
-static void rebuild_setup_content(void) {
-    if (!setupContent) return;
-    lv_obj_clean(setupContent);
-
-    int contentWidth = DISPLAY_WIDTH - SIDEBAR_WIDTH - 28;
-    DemoProfile_t* demo = getDemo();
+// Built once; a demo switch only rewrites the demo badge, so the Switch
+// Demo button is never deleted from under its own click
+static lv_obj_t* setupDemoBadge = NULL;
+static lv_obj_t* setupDemoName = NULL;
+static lv_obj_t* setupDemoSub = NULL;
+static uint8_t setupShownDemo = 0xFF;
 
+static void create_setup_layout(int contentWidth) {
     lv_obj_t* title = lv_label_create(setupContent);
     lv_label_set_text(title, "Welcome to SIGNALTAP");
     lv_obj_set_style_text_color(title, COLOR_TEXT_PRIMARY, 0);
@@ -304,26 +386,23 @@ static void rebuild_setup_content(void) {
     lv_obj_set_style_text_color(step1, COLOR_TEXT_PRIMARY, 0);
     lv_obj_set_pos(step1, 0, 0);
 
-    lv_obj_t* demoBadge = lv_obj_create(setupCard);
-    lv_obj_set_size(demoBadge, 360, 54);
-    lv_obj_set_pos(demoBadge, 0, 25);
-    lv_obj_set_style_bg_color(demoBadge, COLOR_BG_DARK2, 0);
-    lv_obj_set_style_bg_opa(demoBadge, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(demoBadge, 1, 0);
-    lv_obj_set_style_border_color(demoBadge, lv_color_hex(demo->color), 0);
-    lv_obj_set_style_radius(demoBadge, 6, 0);
-    lv_obj_clear_flag(demoBadge, LV_OBJ_FLAG_SCROLLABLE);
-
-    lv_obj_t* demoName = lv_label_create(demoBadge);
-    lv_label_set_text(demoName, demo->name);
-    lv_obj_set_style_text_color(demoName, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_set_style_text_font(demoName, &lv_font_montserrat_16, 0);
-    lv_obj_set_pos(demoName, 10, 7);
-
-    lv_obj_t* demoSub = lv_label_create(demoBadge);
-    lv_label_set_text(demoSub, demo->sub);
-    lv_obj_set_style_text_color(demoSub, COLOR_TEXT_DIM, 0);
-    lv_obj_set_pos(demoSub, 10, 30);
+    setupDemoBadge = lv_obj_create(setupCard);
+    lv_obj_set_size(setupDemoBadge, 360, 54);
+    lv_obj_set_pos(setupDemoBadge, 0, 25);
+    lv_obj_set_style_bg_color(setupDemoBadge, COLOR_BG_DARK2, 0);
+    lv_obj_set_style_bg_opa(setupDemoBadge, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(setupDemoBadge, 1, 0);
+    lv_obj_set_style_radius(setupDemoBadge, 6, 0);
+    lv_obj_clear_flag(setupDemoBadge, LV_OBJ_FLAG_SCROLLABLE);
+
+    setupDemoName = lv_label_create(setupDemoBadge);
+    lv_obj_set_style_text_color(setupDemoName, COLOR_TEXT_PRIMARY, 0);
+    lv_obj_set_style_text_font(setupDemoName, &lv_font_montserrat_16, 0);
+    lv_obj_set_pos(setupDemoName, 10, 7);
+
+    setupDemoSub = lv_label_create(setupDemoBadge);
+    lv_obj_set_style_text_color(setupDemoSub, COLOR_TEXT_DIM, 0);
+    lv_obj_set_pos(setupDemoSub, 10, 30);
 
     lv_obj_t* nextDemoBtn = lv_btn_create(setupCard);
     lv_obj_set_size(nextDemoBtn, 190, 34);
@@ -375,6 +454,18 @@ static void rebuild_setup_content(void) {
     lv_obj_center(finishLabel);
 }
 
+static void rebuild_setup_content(void) {
+    if (!setupContent) return;
+    if (!setupDemoBadge) create_setup_layout(DISPLAY_WIDTH - SIDEBAR_WIDTH - 28);
+    if (getDemoIndex() == setupShownDemo) return;
+
+    DemoProfile_t* demo = getDemo();
+    lv_obj_set_style_border_color(setupDemoBadge, lv_color_hex(demo->color), 0);
+    lv_label_set_text(setupDemoName, demo->name);
+    lv_label_set_text(setupDemoSub, demo->sub);
+    setupShownDemo = getDemoIndex();
+}
+
 // ============ Sidebar ============
 static void create_sidebar(lv_obj_t* parent) {
     sidebar = lv_obj_create(parent);
@@ -607,8 +698,27 @@ static void create_content_area(lv_obj_t* parent) {
     lv_obj_clear_flag(contentArea, LV_OBJ_FLAG_SCROLLABLE);
 }
 
+// ============ Helper: Set Label Text ============
+// lv_label_set_text reallocates the text and relayouts even for the same
+// string, so refreshes go through here. True when the text changed.
+static bool set_label_text(lv_obj_t* label, const char* text) {
+    if (strcmp(lv_label_get_text(label), text) == 0) return false;
+    lv_label_set_text(label, text);
+    return true;
+}
+
 // ============ Helper: Create Sensor Card ============
-static lv_obj_t* create_sensor_card(lv_obj_t* parent, Sensor_t* sensor, int width) {
+// Built once per demo; refreshes touch only what the new values change
+typedef struct {
+    lv_obj_t* value;
+    lv_obj_t* unit;
+    lv_obj_t* bar;
+    lv_obj_t* line;
+    FmtCache_t text;
+    int pct;
+} SensorCard_t;
+
+static lv_obj_t* create_sensor_card(lv_obj_t* parent, Sensor_t* sensor, int width, SensorCard_t* sc) {
     lv_obj_t* card = lv_obj_create(parent);
     style_card(card);
     lv_obj_set_size(card, width, 95);
@@ -636,39 +746,33 @@ static lv_obj_t* create_sensor_card(lv_obj_t* parent, Sensor_t* sensor, int widt
     lv_obj_set_style_text_color(typeLabel, COLOR_TEXT_DIM, 0);
     lv_obj_set_pos(typeLabel, 0, 16);
     
-    // Value
-    char valStr[32];
-    snprintf(valStr, sizeof(valStr), "%.*f", sensor->decimals, sensor->value);
-    lv_obj_t* valLabel = lv_label_create(card);
-    lv_label_set_text(valLabel, valStr);
-    lv_obj_set_style_text_color(valLabel, lv_color_hex(sensor->color), 0);
-    lv_obj_set_style_text_font(valLabel, &lv_font_montserrat_24, 0);
-    lv_obj_set_pos(valLabel, 0, 30);
+    // Value, written by update_sensor_card
+    sc->value = lv_label_create(card);
+    lv_obj_set_style_text_color(sc->value, lv_color_hex(sensor->color), 0);
+    lv_obj_set_style_text_font(sc->value, &lv_font_montserrat_24, 0);
+    lv_obj_set_pos(sc->value, 0, 30);
+    fmt_cache_reset(&sc->text);
     
     // Unit
-    lv_obj_t* unitLabel = lv_label_create(card);
-    lv_label_set_text(unitLabel, sensor->unit);
-    lv_obj_set_style_text_color(unitLabel, COLOR_TEXT_MUTED, 0);
-    lv_obj_align_to(unitLabel, valLabel, LV_ALIGN_OUT_RIGHT_BOTTOM, 4, 0);
+    sc->unit = lv_label_create(card);
+    lv_label_set_text(sc->unit, sensor->unit);
+    lv_obj_set_style_text_color(sc->unit, COLOR_TEXT_MUTED, 0);
     
     // Progress bar
-    lv_obj_t* bar = lv_bar_create(card);
-    lv_obj_set_size(bar, width - 24, 6);
-    lv_obj_set_pos(bar, 0, 70);
-    lv_obj_set_style_bg_color(bar, COLOR_BORDER, LV_PART_MAIN);
-    lv_obj_set_style_bg_color(bar, lv_color_hex(sensor->color), LV_PART_INDICATOR);
-    lv_obj_set_style_radius(bar, 3, LV_PART_MAIN);
-    lv_obj_set_style_radius(bar, 3, LV_PART_INDICATOR);
-    
-    int pct = (int)(((sensor->value - sensor->min) / (sensor->max - sensor->min)) * 100);
-    if (pct < 0) pct = 0;
-    if (pct > 100) pct = 100;
-    lv_bar_set_value(bar, pct, LV_ANIM_OFF);
+    sc->bar = lv_bar_create(card);
+    lv_obj_set_size(sc->bar, width - 24, 6);
+    lv_obj_set_pos(sc->bar, 0, 70);
+    lv_obj_set_style_bg_color(sc->bar, COLOR_BORDER, LV_PART_MAIN);
+    lv_obj_set_style_bg_color(sc->bar, lv_color_hex(sensor->color), LV_PART_INDICATOR);
+    lv_obj_set_style_radius(sc->bar, 3, LV_PART_MAIN);
+    lv_obj_set_style_radius(sc->bar, 3, LV_PART_INDICATOR);
+    sc->pct = -1;
+    sc->line = NULL;
     
     // Range labels
     char minStr[16], maxStr[16];
-    snprintf(minStr, sizeof(minStr), "%.0f", sensor->min);
-    snprintf(maxStr, sizeof(maxStr), "%.0f", sensor->max);
+    fmt_fixed(minStr, sizeof(minStr), sensor->min, 0, NULL);
+    fmt_fixed(maxStr, sizeof(maxStr), sensor->max, 0, NULL);
     
     lv_obj_t* minLabel = lv_label_create(card);
     lv_label_set_text(minLabel, minStr);
@@ -683,8 +787,29 @@ static lv_obj_t* create_sensor_card(lv_obj_t* parent, Sensor_t* sensor, int widt
     return card;
 }
 
+// Value text and bar; the unit moves only when the digits do
+static void update_sensor_card(SensorCard_t* sc, Sensor_t* s, int unitGap) {
+    if (fmt_cache_update(&sc->text, s->value, s->decimals, NULL)) {
+        lv_label_set_text(sc->value, sc->text.text);
+        lv_obj_align_to(sc->unit, sc->value, LV_ALIGN_OUT_RIGHT_BOTTOM, unitGap, 0);
+    }
+
+    int pct = (int)(((s->value - s->min) / (s->max - s->min)) * 100);
+    if (pct < 0) pct = 0;
+    if (pct > 100) pct = 100;
+    if (pct != sc->pct) {
+        lv_bar_set_value(sc->bar, pct, LV_ANIM_OFF);
+        sc->pct = pct;
+    }
+}
+
 // ============ Helper: Create KPI Card ============
-static lv_obj_t* create_kpi_card(lv_obj_t* parent, KPI_t* kpi, int width) {
+typedef struct {
+    lv_obj_t* value;
+    int8_t good;            // -1 until first shown
+} KpiCard_t;
+
+static lv_obj_t* create_kpi_card(lv_obj_t* parent, KPI_t* kpi, int width, KpiCard_t* kc) {
     lv_obj_t* card = lv_obj_create(parent);
     style_card(card);
     lv_obj_set_size(card, width, 70);
@@ -695,24 +820,35 @@ static lv_obj_t* create_kpi_card(lv_obj_t* parent, KPI_t* kpi, int width) {
     lv_obj_set_style_text_color(labelObj, COLOR_TEXT_MUTED, 0);
     lv_obj_set_pos(labelObj, 0, 0);
     
-    char valStr[32];
-    snprintf(valStr, sizeof(valStr), "%s%s", kpi->value, kpi->unit);
-    lv_obj_t* valLabel = lv_label_create(card);
-    lv_label_set_text(valLabel, valStr);
-    lv_obj_set_style_text_color(valLabel, kpi->good ? COLOR_SUCCESS : COLOR_TEXT_PRIMARY, 0);
-    lv_obj_set_style_text_font(valLabel, &lv_font_montserrat_18, 0);
-    lv_obj_set_pos(valLabel, 0, 22);
+    kc->value = lv_label_create(card);
+    lv_label_set_text(kc->value, "");
+    lv_obj_set_style_text_font(kc->value, &lv_font_montserrat_18, 0);
+    lv_obj_set_pos(kc->value, 0, 22);
+    kc->good = -1;
     
     return card;
 }
 
+static void update_kpi_card(KpiCard_t* kc, KPI_t* kpi) {
+    char valStr[32];
+    snprintf(valStr, sizeof(valStr), "%s%s", kpi->value, kpi->unit);
+    set_label_text(kc->value, valStr);
+    if (kc->good != (int8_t)kpi->good) {
+        lv_obj_set_style_text_color(kc->value, kpi->good ? COLOR_SUCCESS : COLOR_TEXT_PRIMARY, 0);
+        kc->good = (int8_t)kpi->good;
+    }
+}
+
 // ============ Helper: Update Scenario Badge ============
+static uint8_t badgeShownScenario = 0xFF;
+
 static void update_scenario_badge(void) {
     if (!scenarioBadge || !scenarioLabel) return;
-    const char* name = sim_get_scenario_name();
     ScenarioState_t state = sim_get_scenario();
+    if (state == badgeShownScenario) return;
+    badgeShownScenario = (uint8_t)state;
 
-    lv_label_set_text(scenarioLabel, name);
+    lv_label_set_text(scenarioLabel, sim_get_scenario_name());
 
     lv_color_t bgColor, textColor;
     switch (state) {
@@ -734,8 +870,11 @@ static void update_scenario_badge(void) {
 }
 
 // ============ Helper: Create Dynamic Alarm Row ============
-static lv_obj_t* create_dynamic_alarm_row(lv_obj_t* parent, DynamicAlarm_t* alarm, int index, bool showAckBtn) {
-    if (!alarm || !alarm->active || strlen(alarm->message) == 0) return NULL;
+static lv_obj_t* create_dynamic_alarm_row(lv_obj_t* parent, const AlarmEntry_t* alarm, bool showAckBtn) {
+    if (!alarm) return NULL;
+    AlarmCode_t code = (AlarmCode_t)alarm->code;
+    AlarmSeverity_t severity = alarm_severity(code);
+    bool acked = (alarm->flags & ALARM_FLAG_ACKED) != 0;
 
     lv_obj_t* row = lv_obj_create(parent);
     lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
@@ -746,7 +885,7 @@ static lv_obj_t* create_dynamic_alarm_row(lv_obj_t* parent, DynamicAlarm_t* alar
     lv_obj_set_size(row, lv_pct(100), 40);
     lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
 
-    if (alarm->acked) {
+    if (acked) {
         lv_obj_set_style_opa(row, LV_OPA_50, 0);
     }
 
@@ -757,9 +896,9 @@ static lv_obj_t* create_dynamic_alarm_row(lv_obj_t* parent, DynamicAlarm_t* alar
     lv_obj_set_style_border_width(dot, 0, 0);
     lv_obj_align(dot, LV_ALIGN_LEFT_MID, 0, 0);
 
-    if (strcmp(alarm->severity, "error") == 0) {
+    if (severity == ALARM_SEV_ERROR) {
         lv_obj_set_style_bg_color(dot, COLOR_ERROR, 0);
-    } else if (strcmp(alarm->severity, "warning") == 0) {
+    } else if (severity == ALARM_SEV_WARNING) {
         lv_obj_set_style_bg_color(dot, COLOR_WARNING, 0);
     } else {
         lv_obj_set_style_bg_color(dot, COLOR_INFO, 0);
@@ -768,21 +907,45 @@ static lv_obj_t* create_dynamic_alarm_row(lv_obj_t* parent, DynamicAlarm_t* alar
 
     // Message
     lv_obj_t* msgLabel = lv_label_create(row);
-    lv_label_set_text(msgLabel, alarm->message);
-    lv_obj_set_style_text_color(msgLabel, alarm->acked ? COLOR_TEXT_DIM : COLOR_TEXT_PRIMARY, 0);
+    if (alarm->flags & ALARM_FLAG_CHATTER) {
+        lv_label_set_text_fmt(msgLabel, "%s (chattering)", alarm_message(code));
+    } else {
+        lv_label_set_text(msgLabel, alarm_message(code));
+    }
+    lv_obj_set_style_text_color(msgLabel, acked ? COLOR_TEXT_DIM : COLOR_TEXT_PRIMARY, 0);
     lv_obj_set_style_text_font(msgLabel, &lv_font_montserrat_12, 0);
     lv_obj_align(msgLabel, LV_ALIGN_LEFT_MID, 16, 0);
-    lv_obj_set_width(msgLabel, showAckBtn ? 350 : 420);
+    lv_obj_set_width(msgLabel, showAckBtn ? 290 : 420);
     lv_label_set_long_mode(msgLabel, LV_LABEL_LONG_DOT);
 
     // Time
+    char timeStr[12];
+    alarm_format_time(alarm->raisedAt, timeStr, sizeof(timeStr));
     lv_obj_t* timeLabel = lv_label_create(row);
-    lv_label_set_text(timeLabel, alarm->time);
+    lv_label_set_text(timeLabel, timeStr);
     lv_obj_set_style_text_color(timeLabel, COLOR_TEXT_DIM, 0);
-    lv_obj_align(timeLabel, LV_ALIGN_RIGHT_MID, showAckBtn ? -70 : -8, 0);
+    lv_obj_align(timeLabel, LV_ALIGN_RIGHT_MID, showAckBtn ? -126 : -8, 0);
+
+    // SHELVE button
+    if (showAckBtn) {
+        lv_obj_t* shelveBtn = lv_btn_create(row);
+        lv_obj_set_size(shelveBtn, 60, 26);
+        lv_obj_set_style_bg_color(shelveBtn, COLOR_BORDER, 0);
+        lv_obj_set_style_radius(shelveBtn, 4, 0);
+        lv_obj_set_style_shadow_width(shelveBtn, 0, 0);
+        lv_obj_align(shelveBtn, LV_ALIGN_RIGHT_MID, -56, 0);
+
+        lv_obj_t* shelveLabel = lv_label_create(shelveBtn);
+        lv_label_set_text(shelveLabel, "SHELVE");
+        lv_obj_set_style_text_color(shelveLabel, COLOR_TEXT_MUTED, 0);
+        lv_obj_set_style_text_font(shelveLabel, &lv_font_montserrat_12, 0);
+        lv_obj_center(shelveLabel);
+
+        lv_obj_add_event_cb(shelveBtn, shelve_btn_event_cb, LV_EVENT_CLICKED, (void*)(intptr_t)code);
+    }
 
     // ACK button
-    if (showAckBtn && !alarm->acked) {
+    if (showAckBtn && !acked) {
         lv_obj_t* ackBtn = lv_btn_create(row);
         lv_obj_set_size(ackBtn, 50, 26);
         lv_obj_set_style_bg_color(ackBtn, COLOR_BORDER, 0);
@@ -795,19 +958,137 @@ static lv_obj_t* create_dynamic_alarm_row(lv_obj_t* parent, DynamicAlarm_t* alar
         lv_obj_set_style_text_color(ackLabel, COLOR_TEXT_PRIMARY, 0);
         lv_obj_center(ackLabel);
 
-        lv_obj_add_event_cb(ackBtn, ack_btn_event_cb, LV_EVENT_CLICKED, (void*)(intptr_t)index);
+        lv_obj_add_event_cb(ackBtn, ack_btn_event_cb, LV_EVENT_CLICKED, (void*)(intptr_t)code);
     }
 
     return row;
 }
 
+// ============ Helper: Alarm Flood / Shelving Summary Row ============
+// One row instead of many while alarms are held back
+static lv_obj_t* create_alarm_summary_row(lv_obj_t* parent) {
+    const AlarmTable_t* table = sim_get_alarm_table();
+    if (!table) return NULL;
+    uint8_t shelved = alarm_shelved_count(table);
+    if (!table->flood && shelved == 0) return NULL;
+
+    lv_obj_t* row = lv_label_create(parent);
+    if (table->flood) {
+        lv_label_set_text_fmt(row, "Alarm flood: %lu low-priority alarms held, %u shelved",
+                              (unsigned long)table->floodSuppressed, shelved);
+        lv_obj_set_style_text_color(row, COLOR_WARNING, 0);
+    } else {
+        lv_label_set_text_fmt(row, "%u alarm%s shelved", shelved, shelved == 1 ? "" : "s");
+        lv_obj_set_style_text_color(row, COLOR_TEXT_DIM, 0);
+    }
+    lv_obj_set_style_text_font(row, &lv_font_montserrat_12, 0);
+    return row;
+}
+
 // ============ Helper: Draw Sparkline from History ============
+// The live span is the last SPARKLINE_SPAN_S of full-rate history, decoded
+// from the compressed history block once per refresh. The longer spans
+// (1 h to 1 week) are the bucket means of the rollup tier that covers
+// them. Either way LTTB reduces the series to about one point per pixel,
+// so the point count follows the widget width rather than the history
+// length. Without the block (no PSRAM) the live span draws the 60-sample
+// ring as a min/max envelope instead.
+#define SPARKLINE_MAX_POINTS 320
+#define SPARKLINE_SPAN_S     600     // 10 min at 1 Hz
+#define SPARKLINE_SPANS      4
+#define TREND_MAX_BUCKETS    ROLLUP_T3_LEN   // Longest tier ring (1 week of 1 h)
+
+static const uint32_t sparklineSpanS[SPARKLINE_SPANS] = {SPARKLINE_SPAN_S, 3600, 86400, 7 * 86400};
+static const char* const sparklineSpanName[SPARKLINE_SPANS] = {"10 min", "1 h", "1 day", "1 week"};
+static uint8_t sparklineSpan = 0;       // Index into sparklineSpanS, 0 = live
+
 // 3 static point arrays so each sensor line keeps its own data
-static lv_point_precise_t sparklinePoints[3][SENSOR_HISTORY_LEN];
+static lv_point_precise_t sparklinePoints[3][SPARKLINE_MAX_POINTS];
+static DsPoint_t sparklineScratch[SPARKLINE_MAX_POINTS];
+static DsColumn_t sparklineColumns[SPARKLINE_MAX_POINTS / 2];
+static float* sparklineRaw = NULL;      // Samples as the block hands them out (PSRAM)
+static float* sparklineWindow = NULL;   // Per sensor: [HBLOCK_SERIES][SPARKLINE_SPAN_S]
+static RollupBucket_t* trendBuckets = NULL;  // One sensor's tier query (PSRAM)
+static uint32_t sparklineLen[3] = {0};
+
+static lv_obj_t* create_sparkline(lv_obj_t* parent, lv_color_t color) {
+    lv_obj_t* line = lv_line_create(parent);
+    lv_obj_set_style_line_color(line, color, 0);
+    lv_obj_set_style_line_width(line, 2, 0);
+    lv_obj_set_style_line_rounded(line, true, 0);
+    lv_obj_set_style_line_opa(line, LV_OPA_70, 0);
+    return line;
+}
+
+// Bucket means oldest first; a bucket with no samples (a gap) holds the
+// mean before it, and gaps before the first sample are left out
+static void load_trend_window(uint32_t spanS) {
+    if (!trendBuckets) {
+        trendBuckets = (RollupBucket_t*)ps_malloc(TREND_MAX_BUCKETS * sizeof(RollupBucket_t));
+        if (!trendBuckets) return;
+    }
+    for (uint8_t ch = 0; ch < 3; ch++) {
+        uint16_t n = sim_get_trend(ch, spanS, trendBuckets, TREND_MAX_BUCKETS, NULL);
+        float* w = sparklineWindow + ch * SPARKLINE_SPAN_S;
+        uint32_t len = 0;
+        for (uint16_t i = 0; i < n; i++) {
+            if (trendBuckets[i].count > 0) w[len++] = trendBuckets[i].mean;
+            else if (len > 0) { w[len] = w[len - 1]; len++; }
+        }
+        sparklineLen[ch] = len;
+    }
+}
+
+// Once per refresh, for all three lines
+static void load_sparkline_window(void) {
+    for (int ch = 0; ch < 3; ch++) sparklineLen[ch] = 0;
+    if (!sparklineRaw) {
+        sparklineRaw = (float*)ps_malloc(2 * HBLOCK_SERIES * SPARKLINE_SPAN_S * sizeof(float));
+        if (!sparklineRaw) return;
+        sparklineWindow = sparklineRaw + HBLOCK_SERIES * SPARKLINE_SPAN_S;
+    }
+    if (sparklineSpan > 0) {
+        load_trend_window(sparklineSpanS[sparklineSpan]);
+        return;
+    }
+
+    HistoryBlock_t* block = sim_get_history_block();
+    if (!block || !block->ready) return;
+    uint32_t n = hblock_read_last(block, SPARKLINE_SPAN_S, sparklineRaw);
+    for (uint32_t i = 0; i < n; i++) {
+        for (int ch = 0; ch < HBLOCK_SERIES; ch++) {
+            sparklineWindow[ch * SPARKLINE_SPAN_S + i] = sparklineRaw[i * HBLOCK_SERIES + ch];
+        }
+    }
+    for (int ch = 0; ch < 3; ch++) sparklineLen[ch] = n;
+}
 
-static void draw_sparkline(lv_obj_t* parent, uint8_t sensorIndex, int width, int height, lv_color_t color) {
-    SensorHistory_t* hist = sim_get_history(sensorIndex);
-    if (!hist || hist->count < 2 || sensorIndex >= 3) return;
+// Points rewritten in place; the line object stays
+static void update_sparkline(lv_obj_t* line, uint8_t sensorIndex, int width, int height) {
+    if (!line || sensorIndex >= 3) return;
+
+    DsSeries_t series;
+    uint32_t count;
+    uint32_t len = sparklineLen[sensorIndex];
+    if (len >= 2) {
+        ds_series_array(&series, sparklineWindow + sensorIndex * SPARKLINE_SPAN_S, len);
+        uint32_t maxOut = width < SPARKLINE_MAX_POINTS ? (uint32_t)width : SPARKLINE_MAX_POINTS;
+        count = ds_lttb(&series, sparklineScratch, maxOut);
+        float xScale = (float)width / (float)(len - 1);
+        for (uint32_t i = 0; i < count; i++) sparklineScratch[i].x *= xScale;
+    } else {
+        SensorHistory_t* hist = sim_get_history(sensorIndex);
+        if (sparklineSpan > 0 || !hist || hist->count < 2) {
+            lv_line_set_points(line, sparklinePoints[sensorIndex], 0);
+            return;
+        }
+        ds_series_ring(&series, hist->buffer, SENSOR_HISTORY_LEN, hist->head, hist->count);
+        int columns = width / 2;
+        if (columns > SPARKLINE_MAX_POINTS / 2) columns = SPARKLINE_MAX_POINTS / 2;
+        if (columns < 2) columns = 2;
+        count = ds_minmax_points(&series, sparklineScratch, sparklineColumns, (uint16_t)columns,
+                                 (float)width);
+    }
 
     DemoProfile_t* demo = getDemo();
     float sMin = demo->sensors[sensorIndex].min;
@@ -815,26 +1096,16 @@ static void draw_sparkline(lv_obj_t* parent, uint8_t sensorIndex, int width, int
     float range = sMax - sMin;
     if (range < 0.01f) range = 1.0f;
 
-    int count = hist->count;
-    float xStep = (float)width / (float)(count - 1);
-
-    for (int i = 0; i < count; i++) {
-        int idx = (hist->head - count + i + SENSOR_HISTORY_LEN) % SENSOR_HISTORY_LEN;
-        float val = hist->buffer[idx];
-        float norm = (val - sMin) / range;
+    for (uint32_t i = 0; i < count; i++) {
+        float norm = (sparklineScratch[i].y - sMin) / range;
         if (norm < 0) norm = 0;
         if (norm > 1) norm = 1;
 
-        sparklinePoints[sensorIndex][i].x = (int)(i * xStep);
+        sparklinePoints[sensorIndex][i].x = (int)sparklineScratch[i].x;
         sparklinePoints[sensorIndex][i].y = height - (int)(norm * height);
     }
 
-    lv_obj_t* line = lv_line_create(parent);
     lv_line_set_points(line, sparklinePoints[sensorIndex], count);
-    lv_obj_set_style_line_color(line, color, 0);
-    lv_obj_set_style_line_width(line, 2, 0);
-    lv_obj_set_style_line_rounded(line, true, 0);
-    lv_obj_set_style_line_opa(line, LV_OPA_70, 0);
 }
 
 // ============ Helper: Create Alarm Row ============
@@ -902,164 +1173,81 @@ static lv_obj_t* create_alarm_row(lv_obj_t* parent, Alarm_t* alarm, int index, b
     return row;
 }
 
-// ============ Screen Creation Functions ============
-
-static void create_home_screen(void) {
-    screens[SCREEN_HOME] = lv_obj_create(contentArea);
-    lv_obj_set_style_bg_opa(screens[SCREEN_HOME], LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(screens[SCREEN_HOME], 0, 0);
-    lv_obj_set_style_pad_all(screens[SCREEN_HOME], 0, 0);
-    lv_obj_set_size(screens[SCREEN_HOME], lv_pct(100), lv_pct(100));
-    lv_obj_set_pos(screens[SCREEN_HOME], 0, 0);
-    lv_obj_add_flag(screens[SCREEN_HOME], LV_OBJ_FLAG_HIDDEN);
-    
-    homeContent = lv_obj_create(screens[SCREEN_HOME]);
-    lv_obj_set_style_bg_opa(homeContent, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(homeContent, 0, 0);
-    lv_obj_set_style_pad_all(homeContent, 0, 0);
-    lv_obj_set_size(homeContent, lv_pct(100), lv_pct(100));
-    lv_obj_set_layout(homeContent, LV_LAYOUT_FLEX);
-    lv_obj_set_flex_flow(homeContent, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_style_pad_row(homeContent, 12, 0);
-    
-    rebuild_home_content();
+// ============ Vision Panel Content ============
+// Built once per demo; refreshes restyle only the lamps and rewrite only
+// the readouts whose values moved. Home and Vision each keep one.
+typedef struct {
+    VisionType_t type;
+    lv_obj_t* value;        // Part count, error code, pressure or AQ0
+    lv_obj_t* state;        // Compressor LOAD / IDLE
+    lv_obj_t* lamps[16];    // CNC: stack light 0-2, LEDs 3-10; custom: DI 0-7, DQ 8-15
+    bool lit[16];
+    char light[8];          // Stack light shown
+    FmtCache_t number;
+    bool valid;
+} VisionWidgets_t;
+
+static VisionWidgets_t homeVision;
+static VisionWidgets_t visionVision;
+
+static lv_obj_t* create_vision_box(lv_obj_t* parent, lv_color_t bg, lv_color_t border,
+                                   int radius, int pad, int w, int h) {
+    lv_obj_t* box = lv_obj_create(parent);
+    lv_obj_set_style_bg_color(box, bg, 0);
+    lv_obj_set_style_bg_opa(box, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_color(box, border, 0);
+    lv_obj_set_style_border_width(box, 1, 0);
+    lv_obj_set_style_radius(box, radius, 0);
+    lv_obj_set_style_pad_all(box, pad, 0);
+    lv_obj_set_size(box, w, h);
+    lv_obj_clear_flag(box, LV_OBJ_FLAG_SCROLLABLE);
+    return box;
 }
 
-static void rebuild_home_content(void) {
-    if (!homeContent) return;
-    lv_obj_clean(homeContent);
-    
-    DemoProfile_t* demo = getDemo();
-    int contentWidth = DISPLAY_WIDTH - SIDEBAR_WIDTH - 28;
-    
-    // KPI Row - 4 cards
-    lv_obj_t* kpiRow = lv_obj_create(homeContent);
-    lv_obj_set_style_bg_opa(kpiRow, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(kpiRow, 0, 0);
-    lv_obj_set_style_pad_all(kpiRow, 0, 0);
-    lv_obj_set_size(kpiRow, contentWidth, 75);
-    lv_obj_set_layout(kpiRow, LV_LAYOUT_FLEX);
-    lv_obj_set_flex_flow(kpiRow, LV_FLEX_FLOW_ROW);
-    lv_obj_set_style_pad_column(kpiRow, 10, 0);
-    lv_obj_clear_flag(kpiRow, LV_OBJ_FLAG_SCROLLABLE);
-    
-    int kpiWidth = (contentWidth - 30) / 4;
-    for (int i = 0; i < 4; i++) {
-        create_kpi_card(kpiRow, &demo->kpis[i], kpiWidth);
-    }
-    
-    // Sensors Row - 3 cards
-    lv_obj_t* sensorRow = lv_obj_create(homeContent);
-    lv_obj_set_style_bg_opa(sensorRow, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(sensorRow, 0, 0);
-    lv_obj_set_style_pad_all(sensorRow, 0, 0);
-    lv_obj_set_size(sensorRow, contentWidth, 100);
-    lv_obj_set_layout(sensorRow, LV_LAYOUT_FLEX);
-    lv_obj_set_flex_flow(sensorRow, LV_FLEX_FLOW_ROW);
-    lv_obj_set_style_pad_column(sensorRow, 10, 0);
-    lv_obj_clear_flag(sensorRow, LV_OBJ_FLAG_SCROLLABLE);
-    
-    int sensorWidth = (contentWidth - 20) / 3;
-    for (int i = 0; i < 3; i++) {
-        create_sensor_card(sensorRow, &demo->sensors[i], sensorWidth);
-    }
-    
-    // Bottom Row - Alarms and Vision
-    lv_obj_t* bottomRow = lv_obj_create(homeContent);
-    lv_obj_set_style_bg_opa(bottomRow, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(bottomRow, 0, 0);
-    lv_obj_set_style_pad_all(bottomRow, 0, 0);
-    lv_obj_set_size(bottomRow, contentWidth, 280);
-    lv_obj_set_layout(bottomRow, LV_LAYOUT_FLEX);
-    lv_obj_set_flex_flow(bottomRow, LV_FLEX_FLOW_ROW);
-    lv_obj_set_style_pad_column(bottomRow, 10, 0);
-    lv_obj_clear_flag(bottomRow, LV_OBJ_FLAG_SCROLLABLE);
-    
-    // Alarms panel
-    lv_obj_t* alarmsPanel = lv_obj_create(bottomRow);
-    style_card(alarmsPanel);
-    lv_obj_set_size(alarmsPanel, (contentWidth - 10) / 2, 270);
-    lv_obj_set_layout(alarmsPanel, LV_LAYOUT_FLEX);
-    lv_obj_set_flex_flow(alarmsPanel, LV_FLEX_FLOW_COLUMN);
-    
-    lv_obj_t* alarmsTitle = lv_label_create(alarmsPanel);
-    char alarmTitleStr[40];
-    uint8_t alarmCount = sim_get_alarm_count();
-    snprintf(alarmTitleStr, sizeof(alarmTitleStr), "Live Alarms (%d)", alarmCount);
-    lv_label_set_text(alarmsTitle, alarmTitleStr);
-    lv_obj_set_style_text_color(alarmsTitle, alarmCount > 0 ? COLOR_WARNING : COLOR_TEXT_PRIMARY, 0);
-    lv_obj_set_style_text_font(alarmsTitle, &lv_font_montserrat_14, 0);
+static lv_obj_t* create_vision_lamp(lv_obj_t* parent, int size, int border) {
+    lv_obj_t* lamp = lv_obj_create(parent);
+    lv_obj_set_size(lamp, size, size);
+    lv_obj_set_style_radius(lamp, size / 2, 0);
+    lv_obj_set_style_border_width(lamp, border, 0);
+    lv_obj_set_style_border_color(lamp, COLOR_BORDER_LIGHT, 0);
+    lv_obj_set_style_bg_color(lamp, COLOR_BORDER, 0);
+    lv_obj_set_style_bg_opa(lamp, LV_OPA_COVER, 0);
+    lv_obj_clear_flag(lamp, LV_OBJ_FLAG_SCROLLABLE);
+    return lamp;
+}
 
-    // Show dynamic alarms from simulation engine (most recent first, max 4)
-    int shown = 0;
-    for (int i = alarmCount - 1; i >= 0 && shown < 4; i--) {
-        DynamicAlarm_t* a = sim_get_alarm(i);
-        if (a) {
-            create_dynamic_alarm_row(alarmsPanel, a, i, false);
-            shown++;
-        }
-    }
-    if (shown == 0) {
-        lv_obj_t* noAlarms = lv_label_create(alarmsPanel);
-        lv_label_set_text(noAlarms, "No active alarms");
-        lv_obj_set_style_text_color(noAlarms, COLOR_TEXT_DIM, 0);
-    }
-    
-    // Vision preview panel
-    lv_obj_t* visionPanel = lv_obj_create(bottomRow);
-    lv_obj_set_style_bg_color(visionPanel, lv_color_hex(0x111827), 0);
-    lv_obj_set_style_bg_opa(visionPanel, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_color(visionPanel, COLOR_BORDER, 0);
-    lv_obj_set_style_border_width(visionPanel, 1, 0);
-    lv_obj_set_style_radius(visionPanel, 8, 0);
-    lv_obj_set_style_pad_all(visionPanel, 12, 0);
-    lv_obj_set_size(visionPanel, (contentWidth - 10) / 2, 270);
-    lv_obj_clear_flag(visionPanel, LV_OBJ_FLAG_SCROLLABLE);
-    
-    lv_obj_t* visionTitle = lv_label_create(visionPanel);
-    lv_label_set_text(visionTitle, demo->name);
-    lv_obj_set_style_text_color(visionTitle, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_set_style_text_font(visionTitle, &lv_font_montserrat_16, 0);
-    lv_obj_align(visionTitle, LV_ALIGN_TOP_MID, 0, 0);
-    
-    lv_obj_t* visionSub = lv_label_create(visionPanel);
-    lv_label_set_text(visionSub, demo->sub);
-    lv_obj_set_style_text_color(visionSub, COLOR_TEXT_MUTED, 0);
-    lv_obj_align(visionSub, LV_ALIGN_TOP_MID, 0, 18);
-    
-    // Vision content based on demo type
-    create_vision_panel_content(visionPanel, demo, 40);
+// Restyles lamp i only when it turns on or off
+static void set_vision_lamp(VisionWidgets_t* w, int i, bool on, lv_color_t color, int glow, bool ring) {
+    if (w->valid && w->lit[i] == on) return;
+    lv_obj_t* lamp = w->lamps[i];
+    lv_obj_set_style_bg_color(lamp, on ? color : COLOR_BORDER, 0);
+    lv_obj_set_style_shadow_color(lamp, color, 0);
+    lv_obj_set_style_shadow_width(lamp, on ? glow : 0, 0);
+    if (ring) lv_obj_set_style_border_color(lamp, on ? color : COLOR_BORDER_LIGHT, 0);
+    w->lit[i] = on;
 }
 
-// ============ Vision Panel Content ============
-static void create_vision_panel_content(lv_obj_t* parent, DemoProfile_t* demo, int yOffset) {
+static void create_vision_panel_content(lv_obj_t* parent, DemoProfile_t* demo, int yOffset,
+                                        VisionWidgets_t* w) {
     Vision_t* v = &demo->vision;
+    memset(w, 0, sizeof(*w));
+    w->type = v->type;
     
     if (v->type == VISION_CNC) {
         // Part counter display
-        lv_obj_t* partDisplay = lv_obj_create(parent);
-        lv_obj_set_style_bg_color(partDisplay, lv_color_hex(0x000000), 0);
-        lv_obj_set_style_bg_opa(partDisplay, LV_OPA_COVER, 0);
-        lv_obj_set_style_border_color(partDisplay, COLOR_BORDER_LIGHT, 0);
-        lv_obj_set_style_border_width(partDisplay, 1, 0);
-        lv_obj_set_style_radius(partDisplay, 6, 0);
-        lv_obj_set_style_pad_all(partDisplay, 8, 0);
-        lv_obj_set_size(partDisplay, 100, 60);
+        lv_obj_t* partDisplay = create_vision_box(parent, lv_color_hex(0x000000), COLOR_BORDER_LIGHT,
+                                                  6, 8, 100, 60);
         lv_obj_set_pos(partDisplay, 20, yOffset + 10);
-        lv_obj_clear_flag(partDisplay, LV_OBJ_FLAG_SCROLLABLE);
         
         lv_obj_t* partLabel = lv_label_create(partDisplay);
         lv_label_set_text(partLabel, "PARTS");
         lv_obj_set_style_text_color(partLabel, COLOR_TEXT_DIM, 0);
         lv_obj_align(partLabel, LV_ALIGN_TOP_MID, 0, 0);
         
-        char partStr[16];
-        snprintf(partStr, sizeof(partStr), "%04d", v->partCount);
-        lv_obj_t* partVal = lv_label_create(partDisplay);
-        lv_label_set_text(partVal, partStr);
-        lv_obj_set_style_text_color(partVal, COLOR_SUCCESS, 0);
-        lv_obj_set_style_text_font(partVal, &lv_font_montserrat_24, 0);
-        lv_obj_align(partVal, LV_ALIGN_BOTTOM_MID, 0, 0);
+        w->value = lv_label_create(partDisplay);
+        lv_obj_set_style_text_color(w->value, COLOR_SUCCESS, 0);
+        lv_obj_set_style_text_font(w->value, &lv_font_montserrat_24, 0);
+        lv_obj_align(w->value, LV_ALIGN_BOTTOM_MID, 0, 0);
         
         // Stack light
         lv_obj_t* stackContainer = lv_obj_create(parent);
@@ -1069,26 +1257,9 @@ static void create_vision_panel_content(lv_obj_t* parent, DemoProfile_t* demo, i
         lv_obj_set_pos(stackContainer, 150, yOffset);
         lv_obj_clear_flag(stackContainer, LV_OBJ_FLAG_SCROLLABLE);
         
-        const char* colors[] = {"red", "yellow", "green"};
-        const lv_color_t lvColors[] = {COLOR_ERROR, COLOR_WARNING, COLOR_SUCCESS};
         for (int i = 0; i < 3; i++) {
-            lv_obj_t* lamp = lv_obj_create(stackContainer);
-            lv_obj_set_size(lamp, 26, 26);
-            lv_obj_set_style_radius(lamp, 13, 0);
-            lv_obj_set_style_border_width(lamp, 2, 0);
-            lv_obj_set_pos(lamp, 5, i * 30);
-            
-            bool isOn = (strcmp(v->stackLight, colors[i]) == 0);
-            if (isOn) {
-                lv_obj_set_style_bg_color(lamp, lvColors[i], 0);
-                lv_obj_set_style_border_color(lamp, lvColors[i], 0);
-                lv_obj_set_style_shadow_color(lamp, lvColors[i], 0);
-                lv_obj_set_style_shadow_width(lamp, 10, 0);
-            } else {
-                lv_obj_set_style_bg_color(lamp, COLOR_BORDER, 0);
-                lv_obj_set_style_border_color(lamp, COLOR_BORDER_LIGHT, 0);
-            }
-            lv_obj_set_style_bg_opa(lamp, LV_OPA_COVER, 0);
+            w->lamps[i] = create_vision_lamp(stackContainer, 26, 2);
+            lv_obj_set_pos(w->lamps[i], 5, i * 30);
         }
         
         // LED indicators
@@ -1105,8 +1276,6 @@ static void create_vision_panel_content(lv_obj_t* parent, DemoProfile_t* demo, i
         lv_obj_clear_flag(ledPanel, LV_OBJ_FLAG_SCROLLABLE);
         
         const char* ledNames[] = {"RUN", "FEED", "SPIN", "COOL", "PROG", "ERR", "FLT", "RDY"};
-        bool ledStates[] = {v->leds.run, v->leds.feed, v->leds.spindle, v->leds.coolant, 
-                           v->leds.program, v->leds.error, v->leds.fault, v->leds.ready};
         for (int i = 0; i < 8; i++) {
             lv_obj_t* ledItem = lv_obj_create(ledPanel);
             lv_obj_set_style_bg_opa(ledItem, LV_OPA_TRANSP, 0);
@@ -1115,22 +1284,8 @@ static void create_vision_panel_content(lv_obj_t* parent, DemoProfile_t* demo, i
             lv_obj_set_size(ledItem, 30, 24);
             lv_obj_clear_flag(ledItem, LV_OBJ_FLAG_SCROLLABLE);
             
-            lv_obj_t* led = lv_obj_create(ledItem);
-            lv_obj_set_size(led, 12, 12);
-            lv_obj_set_style_radius(led, 6, 0);
-            lv_obj_set_style_border_width(led, 1, 0);
-            lv_obj_set_style_border_color(led, COLOR_BORDER_LIGHT, 0);
-            lv_obj_set_pos(led, 9, 0);
-            
-            if (ledStates[i]) {
-                lv_color_t c = (i == 5 || i == 6) ? COLOR_ERROR : COLOR_SUCCESS;
-                lv_obj_set_style_bg_color(led, c, 0);
-                lv_obj_set_style_shadow_color(led, c, 0);
-                lv_obj_set_style_shadow_width(led, 6, 0);
-            } else {
-                lv_obj_set_style_bg_color(led, COLOR_BORDER, 0);
-            }
-            lv_obj_set_style_bg_opa(led, LV_OPA_COVER, 0);
+            w->lamps[3 + i] = create_vision_lamp(ledItem, 12, 1);
+            lv_obj_set_pos(w->lamps[3 + i], 9, 0);
             
             lv_obj_t* ledLabel = lv_label_create(ledItem);
             lv_label_set_text(ledLabel, ledNames[i]);
@@ -1140,49 +1295,30 @@ static void create_vision_panel_content(lv_obj_t* parent, DemoProfile_t* demo, i
         
     } else if (v->type == VISION_CHILLER) {
         // Error code display
-        lv_obj_t* errDisplay = lv_obj_create(parent);
-        lv_obj_set_style_bg_color(errDisplay, lv_color_hex(0x000000), 0);
-        lv_obj_set_style_bg_opa(errDisplay, LV_OPA_COVER, 0);
-        lv_obj_set_style_border_color(errDisplay, COLOR_BORDER_LIGHT, 0);
-        lv_obj_set_style_border_width(errDisplay, 1, 0);
-        lv_obj_set_style_radius(errDisplay, 6, 0);
-        lv_obj_set_style_pad_all(errDisplay, 12, 0);
-        lv_obj_set_size(errDisplay, 140, 70);
+        lv_obj_t* errDisplay = create_vision_box(parent, lv_color_hex(0x000000), COLOR_BORDER_LIGHT,
+                                                 6, 12, 140, 70);
         lv_obj_align(errDisplay, LV_ALIGN_CENTER, 0, yOffset/2);
-        lv_obj_clear_flag(errDisplay, LV_OBJ_FLAG_SCROLLABLE);
         
         lv_obj_t* errLabel = lv_label_create(errDisplay);
         lv_label_set_text(errLabel, "ERROR CODE");
         lv_obj_set_style_text_color(errLabel, COLOR_TEXT_DIM, 0);
         lv_obj_align(errLabel, LV_ALIGN_TOP_MID, 0, 0);
         
-        lv_obj_t* errVal = lv_label_create(errDisplay);
-        lv_label_set_text(errVal, v->errorCode);
-        bool hasError = strcmp(v->errorCode, "---") != 0;
-        lv_obj_set_style_text_color(errVal, hasError ? COLOR_ERROR : COLOR_SUCCESS, 0);
-        lv_obj_set_style_text_font(errVal, &lv_font_montserrat_28, 0);
-        lv_obj_align(errVal, LV_ALIGN_BOTTOM_MID, 0, 0);
+        w->value = lv_label_create(errDisplay);
+        lv_label_set_text(w->value, "");
+        lv_obj_set_style_text_font(w->value, &lv_font_montserrat_28, 0);
+        lv_obj_align(w->value, LV_ALIGN_BOTTOM_MID, 0, 0);
         
     } else if (v->type == VISION_COMPRESSOR) {
         // Pressure gauge
-        lv_obj_t* pressBox = lv_obj_create(parent);
-        lv_obj_set_style_bg_color(pressBox, lv_color_hex(0x000000), 0);
-        lv_obj_set_style_bg_opa(pressBox, LV_OPA_COVER, 0);
-        lv_obj_set_style_border_color(pressBox, COLOR_BORDER_LIGHT, 0);
-        lv_obj_set_style_border_width(pressBox, 1, 0);
-        lv_obj_set_style_radius(pressBox, 6, 0);
-        lv_obj_set_style_pad_all(pressBox, 8, 0);
-        lv_obj_set_size(pressBox, 100, 55);
+        lv_obj_t* pressBox = create_vision_box(parent, lv_color_hex(0x000000), COLOR_BORDER_LIGHT,
+                                               6, 8, 100, 55);
         lv_obj_set_pos(pressBox, 30, yOffset + 20);
-        lv_obj_clear_flag(pressBox, LV_OBJ_FLAG_SCROLLABLE);
         
-        char pressStr[16];
-        snprintf(pressStr, sizeof(pressStr), "%.1f", v->pressure);
-        lv_obj_t* pressVal = lv_label_create(pressBox);
-        lv_label_set_text(pressVal, pressStr);
-        lv_obj_set_style_text_color(pressVal, COLOR_ACCENT, 0);
-        lv_obj_set_style_text_font(pressVal, &lv_font_montserrat_24, 0);
-        lv_obj_align(pressVal, LV_ALIGN_TOP_MID, 0, 0);
+        w->value = lv_label_create(pressBox);
+        lv_obj_set_style_text_color(w->value, COLOR_ACCENT, 0);
+        lv_obj_set_style_text_font(w->value, &lv_font_montserrat_24, 0);
+        lv_obj_align(w->value, LV_ALIGN_TOP_MID, 0, 0);
         
         lv_obj_t* pressLabel = lv_label_create(pressBox);
         lv_label_set_text(pressLabel, "bar");
@@ -1190,125 +1326,272 @@ static void create_vision_panel_content(lv_obj_t* parent, DemoProfile_t* demo, i
         lv_obj_align(pressLabel, LV_ALIGN_BOTTOM_MID, 0, 0);
         
         // State indicator
-        lv_obj_t* stateBox = lv_obj_create(parent);
-        lv_obj_set_style_bg_color(stateBox, lv_color_hex(0x000000), 0);
-        lv_obj_set_style_bg_opa(stateBox, LV_OPA_COVER, 0);
-        lv_obj_set_style_border_color(stateBox, COLOR_BORDER_LIGHT, 0);
-        lv_obj_set_style_border_width(stateBox, 1, 0);
-        lv_obj_set_style_radius(stateBox, 6, 0);
-        lv_obj_set_style_pad_all(stateBox, 8, 0);
-        lv_obj_set_size(stateBox, 90, 40);
+        lv_obj_t* stateBox = create_vision_box(parent, lv_color_hex(0x000000), COLOR_BORDER_LIGHT,
+                                               6, 8, 90, 40);
         lv_obj_set_pos(stateBox, 160, yOffset + 30);
-        lv_obj_clear_flag(stateBox, LV_OBJ_FLAG_SCROLLABLE);
         
-        lv_obj_t* stateVal = lv_label_create(stateBox);
-        lv_label_set_text(stateVal, v->state);
-        bool isLoad = strcmp(v->state, "LOAD") == 0;
-        lv_obj_set_style_text_color(stateVal, isLoad ? COLOR_SUCCESS : COLOR_WARNING, 0);
-        lv_obj_set_style_text_font(stateVal, &lv_font_montserrat_18, 0);
-        lv_obj_center(stateVal);
+        w->state = lv_label_create(stateBox);
+        lv_label_set_text(w->state, "");
+        lv_obj_set_style_text_font(w->state, &lv_font_montserrat_18, 0);
+        lv_obj_center(w->state);
         
     } else if (v->type == VISION_CUSTOM) {
-        // DI panel
-        lv_obj_t* diPanel = lv_obj_create(parent);
-        lv_obj_set_style_bg_color(diPanel, COLOR_BG_DARK2, 0);
-        lv_obj_set_style_bg_opa(diPanel, LV_OPA_COVER, 0);
-        lv_obj_set_style_border_color(diPanel, COLOR_BORDER, 0);
-        lv_obj_set_style_border_width(diPanel, 1, 0);
-        lv_obj_set_style_radius(diPanel, 4, 0);
-        lv_obj_set_style_pad_all(diPanel, 6, 0);
-        lv_obj_set_size(diPanel, 170, 50);
-        lv_obj_set_pos(diPanel, 10, yOffset + 10);
-        lv_obj_clear_flag(diPanel, LV_OBJ_FLAG_SCROLLABLE);
-        
-        lv_obj_t* diLabel = lv_label_create(diPanel);
-        lv_label_set_text(diLabel, "DI 0.0-0.7");
-        lv_obj_set_style_text_color(diLabel, COLOR_TEXT_DIM, 0);
-        lv_obj_set_pos(diLabel, 0, 0);
-        
-        for (int i = 0; i < 8; i++) {
-            lv_obj_t* led = lv_obj_create(diPanel);
-            lv_obj_set_size(led, 12, 12);
-            lv_obj_set_style_radius(led, 6, 0);
-            lv_obj_set_style_border_width(led, 0, 0);
-            lv_obj_set_pos(led, i * 18 + 10, 22);
-            lv_obj_set_style_bg_color(led, v->diA[i] ? COLOR_SUCCESS : COLOR_BORDER, 0);
-            lv_obj_set_style_bg_opa(led, LV_OPA_COVER, 0);
-            if (v->diA[i]) {
-                lv_obj_set_style_shadow_color(led, COLOR_SUCCESS, 0);
-                lv_obj_set_style_shadow_width(led, 6, 0);
-            }
-        }
-        
-        // DQ panel
-        lv_obj_t* dqPanel = lv_obj_create(parent);
-        lv_obj_set_style_bg_color(dqPanel, COLOR_BG_DARK2, 0);
-        lv_obj_set_style_bg_opa(dqPanel, LV_OPA_COVER, 0);
-        lv_obj_set_style_border_color(dqPanel, COLOR_BORDER, 0);
-        lv_obj_set_style_border_width(dqPanel, 1, 0);
-        lv_obj_set_style_radius(dqPanel, 4, 0);
-        lv_obj_set_style_pad_all(dqPanel, 6, 0);
-        lv_obj_set_size(dqPanel, 170, 50);
-        lv_obj_set_pos(dqPanel, 190, yOffset + 10);
-        lv_obj_clear_flag(dqPanel, LV_OBJ_FLAG_SCROLLABLE);
-        
-        lv_obj_t* dqLabel = lv_label_create(dqPanel);
-        lv_label_set_text(dqLabel, "DQ 0.0-0.7");
-        lv_obj_set_style_text_color(dqLabel, COLOR_TEXT_DIM, 0);
-        lv_obj_set_pos(dqLabel, 0, 0);
-        
-        for (int i = 0; i < 8; i++) {
-            lv_obj_t* led = lv_obj_create(dqPanel);
-            lv_obj_set_size(led, 12, 12);
-            lv_obj_set_style_radius(led, 6, 0);
-            lv_obj_set_style_border_width(led, 0, 0);
-            lv_obj_set_pos(led, i * 18 + 10, 22);
-            lv_obj_set_style_bg_color(led, v->dqA[i] ? COLOR_WARNING : COLOR_BORDER, 0);
-            lv_obj_set_style_bg_opa(led, LV_OPA_COVER, 0);
-            if (v->dqA[i]) {
-                lv_obj_set_style_shadow_color(led, COLOR_WARNING, 0);
-                lv_obj_set_style_shadow_width(led, 6, 0);
+        // DI and DQ panels
+        const char* names[] = {"DI 0.0-0.7", "DQ 0.0-0.7"};
+        for (int p = 0; p < 2; p++) {
+            lv_obj_t* panel = create_vision_box(parent, COLOR_BG_DARK2, COLOR_BORDER, 4, 6, 170, 50);
+            lv_obj_set_pos(panel, 10 + p * 180, yOffset + 10);
+            
+            lv_obj_t* label = lv_label_create(panel);
+            lv_label_set_text(label, names[p]);
+            lv_obj_set_style_text_color(label, COLOR_TEXT_DIM, 0);
+            lv_obj_set_pos(label, 0, 0);
+            
+            for (int i = 0; i < 8; i++) {
+                lv_obj_t* led = create_vision_lamp(panel, 12, 0);
+                lv_obj_set_pos(led, i * 18 + 10, 22);
+                w->lamps[p * 8 + i] = led;
             }
         }
         
         // AQ0 display
-        lv_obj_t* aqPanel = lv_obj_create(parent);
-        lv_obj_set_style_bg_color(aqPanel, COLOR_BG_DARK2, 0);
-        lv_obj_set_style_bg_opa(aqPanel, LV_OPA_COVER, 0);
-        lv_obj_set_style_border_color(aqPanel, COLOR_BORDER, 0);
-        lv_obj_set_style_border_width(aqPanel, 1, 0);
-        lv_obj_set_style_radius(aqPanel, 4, 0);
-        lv_obj_set_style_pad_all(aqPanel, 8, 0);
-        lv_obj_set_size(aqPanel, 80, 60);
+        lv_obj_t* aqPanel = create_vision_box(parent, COLOR_BG_DARK2, COLOR_BORDER, 4, 8, 80, 60);
         lv_obj_set_pos(aqPanel, 100, yOffset + 70);
-        lv_obj_clear_flag(aqPanel, LV_OBJ_FLAG_SCROLLABLE);
         
         lv_obj_t* aqLabel = lv_label_create(aqPanel);
         lv_label_set_text(aqLabel, "AQ0");
         lv_obj_set_style_text_color(aqLabel, COLOR_TEXT_DIM, 0);
         lv_obj_align(aqLabel, LV_ALIGN_TOP_MID, 0, 0);
         
-        char aqStr[16];
-        snprintf(aqStr, sizeof(aqStr), "%d%%", v->aq0);
-        lv_obj_t* aqVal = lv_label_create(aqPanel);
-        lv_label_set_text(aqVal, aqStr);
-        lv_obj_set_style_text_color(aqVal, COLOR_ACCENT, 0);
-        lv_obj_set_style_text_font(aqVal, &lv_font_montserrat_18, 0);
-        lv_obj_align(aqVal, LV_ALIGN_BOTTOM_MID, 0, 0);
+        w->value = lv_label_create(aqPanel);
+        lv_obj_set_style_text_color(w->value, COLOR_ACCENT, 0);
+        lv_obj_set_style_text_font(w->value, &lv_font_montserrat_18, 0);
+        lv_obj_align(w->value, LV_ALIGN_BOTTOM_MID, 0, 0);
     }
+    fmt_cache_reset(&w->number);
 }
 
-static void create_sensors_screen(void) {
-    screens[SCREEN_SENSORS] = lv_obj_create(contentArea);
-    lv_obj_set_style_bg_opa(screens[SCREEN_SENSORS], LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(screens[SCREEN_SENSORS], 0, 0);
-    lv_obj_set_style_pad_all(screens[SCREEN_SENSORS], 0, 0);
-    lv_obj_set_size(screens[SCREEN_SENSORS], lv_pct(100), lv_pct(100));
-    lv_obj_set_pos(screens[SCREEN_SENSORS], 0, 0);
-    lv_obj_add_flag(screens[SCREEN_SENSORS], LV_OBJ_FLAG_HIDDEN);
+static void update_vision_panel(VisionWidgets_t* w, const Vision_t* v) {
+    if (!w->value || w->type != v->type) return;
     
-    sensorsContent = lv_obj_create(screens[SCREEN_SENSORS]);
-    lv_obj_set_style_bg_opa(sensorsContent, LV_OPA_TRANSP, 0);
+    if (v->type == VISION_CNC) {
+        if (fmt_cache_update(&w->number, v->partCount, 0, NULL)) {
+            lv_label_set_text_fmt(w->value, "%04d", v->partCount);
+        }
+        
+        const char* colors[] = {"red", "yellow", "green"};
+        const lv_color_t lvColors[] = {COLOR_ERROR, COLOR_WARNING, COLOR_SUCCESS};
+        if (!w->valid || strcmp(w->light, v->stackLight) != 0) {
+            for (int i = 0; i < 3; i++) {
+                set_vision_lamp(w, i, strcmp(v->stackLight, colors[i]) == 0, lvColors[i], 10, true);
+            }
+            snprintf(w->light, sizeof(w->light), "%s", v->stackLight);
+        }
+        
+        bool ledStates[] = {v->leds.run, v->leds.feed, v->leds.spindle, v->leds.coolant,
+                           v->leds.program, v->leds.error, v->leds.fault, v->leds.ready};
+        for (int i = 0; i < 8; i++) {
+            lv_color_t c = (i == 5 || i == 6) ? COLOR_ERROR : COLOR_SUCCESS;
+            set_vision_lamp(w, 3 + i, ledStates[i], c, 6, false);
+        }
+        
+    } else if (v->type == VISION_CHILLER) {
+        if (!w->valid || strcmp(lv_label_get_text(w->value), v->errorCode) != 0) {
+            lv_label_set_text(w->value, v->errorCode);
+            bool hasError = strcmp(v->errorCode, "---") != 0;
+            lv_obj_set_style_text_color(w->value, hasError ? COLOR_ERROR : COLOR_SUCCESS, 0);
+        }
+        
+    } else if (v->type == VISION_COMPRESSOR) {
+        if (fmt_cache_update(&w->number, v->pressure, 1, NULL)) {
+            lv_label_set_text(w->value, w->number.text);
+        }
+        if (!w->valid || strcmp(lv_label_get_text(w->state), v->state) != 0) {
+            lv_label_set_text(w->state, v->state);
+            bool isLoad = strcmp(v->state, "LOAD") == 0;
+            lv_obj_set_style_text_color(w->state, isLoad ? COLOR_SUCCESS : COLOR_WARNING, 0);
+        }
+        
+    } else if (v->type == VISION_CUSTOM) {
+        for (int i = 0; i < 8; i++) {
+            set_vision_lamp(w, i, v->diA[i], COLOR_SUCCESS, 6, false);
+            set_vision_lamp(w, 8 + i, v->dqA[i], COLOR_WARNING, 6, false);
+        }
+        if (fmt_cache_update(&w->number, v->aq0, 0, NULL)) {
+            lv_label_set_text_fmt(w->value, "%d%%", v->aq0);
+        }
+    }
+    w->valid = true;
+}
+
+// ============ Screen Creation Functions ============
+
+static void create_home_screen(void) {
+    screens[SCREEN_HOME] = lv_obj_create(contentArea);
+    lv_obj_set_style_bg_opa(screens[SCREEN_HOME], LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(screens[SCREEN_HOME], 0, 0);
+    lv_obj_set_style_pad_all(screens[SCREEN_HOME], 0, 0);
+    lv_obj_set_size(screens[SCREEN_HOME], lv_pct(100), lv_pct(100));
+    lv_obj_set_pos(screens[SCREEN_HOME], 0, 0);
+    lv_obj_add_flag(screens[SCREEN_HOME], LV_OBJ_FLAG_HIDDEN);
+    
+    homeContent = lv_obj_create(screens[SCREEN_HOME]);
+    lv_obj_set_style_bg_opa(homeContent, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(homeContent, 0, 0);
+    lv_obj_set_style_pad_all(homeContent, 0, 0);
+    lv_obj_set_size(homeContent, lv_pct(100), lv_pct(100));
+    lv_obj_set_layout(homeContent, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(homeContent, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(homeContent, 12, 0);
+    
+    rebuild_home_content();
+}
+
+// What the home screen was built for and last showed; the layout is
+// rebuilt only on a demo change, the alarm rows on an alarm table change
+static uint8_t homeShownDemo = 0xFF;
+static uint32_t homeShownRevision = 0;
+
+static KpiCard_t homeKpis[4];
+static SensorCard_t homeSensors[3];
+static lv_obj_t* homeAlarms = NULL;
+
+static void fill_home_alarms(void) {
+    lv_obj_clean(homeAlarms);
+    const AlarmTable_t* table = sim_get_alarm_table();
+    homeShownRevision = table ? table->revision : 0;
+
+    lv_obj_t* alarmsTitle = lv_label_create(homeAlarms);
+    uint8_t alarmCount = sim_get_alarm_count();
+    lv_label_set_text_fmt(alarmsTitle, "Live Alarms (%d)", alarmCount);
+    lv_obj_set_style_text_color(alarmsTitle, alarmCount > 0 ? COLOR_WARNING : COLOR_TEXT_PRIMARY, 0);
+    lv_obj_set_style_text_font(alarmsTitle, &lv_font_montserrat_14, 0);
+
+    // Show dynamic alarms from simulation engine (most recent first, max 4)
+    create_alarm_summary_row(homeAlarms);
+    int shown = 0;
+    for (int i = alarmCount - 1; i >= 0 && shown < 4; i--) {
+        const AlarmEntry_t* a = sim_get_alarm(i);
+        if (a) {
+            create_dynamic_alarm_row(homeAlarms, a, false);
+            shown++;
+        }
+    }
+    if (shown == 0) {
+        lv_obj_t* noAlarms = lv_label_create(homeAlarms);
+        lv_label_set_text(noAlarms, "No active alarms");
+        lv_obj_set_style_text_color(noAlarms, COLOR_TEXT_DIM, 0);
+    }
+}
+
+static void create_home_layout(DemoProfile_t* demo, int contentWidth) {
+    lv_obj_clean(homeContent);
+    
+    // KPI Row - 4 cards
+    lv_obj_t* kpiRow = lv_obj_create(homeContent);
+    lv_obj_set_style_bg_opa(kpiRow, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(kpiRow, 0, 0);
+    lv_obj_set_style_pad_all(kpiRow, 0, 0);
+    lv_obj_set_size(kpiRow, contentWidth, 75);
+    lv_obj_set_layout(kpiRow, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(kpiRow, LV_FLEX_FLOW_ROW);
+    lv_obj_set_style_pad_column(kpiRow, 10, 0);
+    lv_obj_clear_flag(kpiRow, LV_OBJ_FLAG_SCROLLABLE);
+    
+    int kpiWidth = (contentWidth - 30) / 4;
+    for (int i = 0; i < 4; i++) {
+        create_kpi_card(kpiRow, &demo->kpis[i], kpiWidth, &homeKpis[i]);
+    }
+    
+    // Sensors Row - 3 cards
+    lv_obj_t* sensorRow = lv_obj_create(homeContent);
+    lv_obj_set_style_bg_opa(sensorRow, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(sensorRow, 0, 0);
+    lv_obj_set_style_pad_all(sensorRow, 0, 0);
+    lv_obj_set_size(sensorRow, contentWidth, 100);
+    lv_obj_set_layout(sensorRow, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(sensorRow, LV_FLEX_FLOW_ROW);
+    lv_obj_set_style_pad_column(sensorRow, 10, 0);
+    lv_obj_clear_flag(sensorRow, LV_OBJ_FLAG_SCROLLABLE);
+    
+    int sensorWidth = (contentWidth - 20) / 3;
+    for (int i = 0; i < 3; i++) {
+        create_sensor_card(sensorRow, &demo->sensors[i], sensorWidth, &homeSensors[i]);
+    }
+    
+    // Bottom Row - Alarms and Vision
+    lv_obj_t* bottomRow = lv_obj_create(homeContent);
+    lv_obj_set_style_bg_opa(bottomRow, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(bottomRow, 0, 0);
+    lv_obj_set_style_pad_all(bottomRow, 0, 0);
+    lv_obj_set_size(bottomRow, contentWidth, 280);
+    lv_obj_set_layout(bottomRow, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(bottomRow, LV_FLEX_FLOW_ROW);
+    lv_obj_set_style_pad_column(bottomRow, 10, 0);
+    lv_obj_clear_flag(bottomRow, LV_OBJ_FLAG_SCROLLABLE);
+    
+    // Alarms panel
+    homeAlarms = lv_obj_create(bottomRow);
+    style_card(homeAlarms);
+    lv_obj_set_size(homeAlarms, (contentWidth - 10) / 2, 270);
+    lv_obj_set_layout(homeAlarms, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(homeAlarms, LV_FLEX_FLOW_COLUMN);
+    fill_home_alarms();
+    
+    // Vision preview panel
+    lv_obj_t* visionPanel = lv_obj_create(bottomRow);
+    lv_obj_set_style_bg_color(visionPanel, lv_color_hex(0x111827), 0);
+    lv_obj_set_style_bg_opa(visionPanel, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_color(visionPanel, COLOR_BORDER, 0);
+    lv_obj_set_style_border_width(visionPanel, 1, 0);
+    lv_obj_set_style_radius(visionPanel, 8, 0);
+    lv_obj_set_style_pad_all(visionPanel, 12, 0);
+    lv_obj_set_size(visionPanel, (contentWidth - 10) / 2, 270);
+    lv_obj_clear_flag(visionPanel, LV_OBJ_FLAG_SCROLLABLE);
+    
+    lv_obj_t* visionTitle = lv_label_create(visionPanel);
+    lv_label_set_text(visionTitle, demo->name);
+    lv_obj_set_style_text_color(visionTitle, COLOR_TEXT_PRIMARY, 0);
+    lv_obj_set_style_text_font(visionTitle, &lv_font_montserrat_16, 0);
+    lv_obj_align(visionTitle, LV_ALIGN_TOP_MID, 0, 0);
+    
+    lv_obj_t* visionSub = lv_label_create(visionPanel);
+    lv_label_set_text(visionSub, demo->sub);
+    lv_obj_set_style_text_color(visionSub, COLOR_TEXT_MUTED, 0);
+    lv_obj_align(visionSub, LV_ALIGN_TOP_MID, 0, 18);
+    
+    // Vision content based on demo type
+    create_vision_panel_content(visionPanel, demo, 40, &homeVision);
+    homeShownDemo = getDemoIndex();
+}
+
+static void rebuild_home_content(void) {
+    if (!homeContent) return;
+    
+    DemoProfile_t* demo = getDemo();
+    int contentWidth = DISPLAY_WIDTH - SIDEBAR_WIDTH - 28;
+    if (getDemoIndex() != homeShownDemo) create_home_layout(demo, contentWidth);
+    
+    for (int i = 0; i < 4; i++) update_kpi_card(&homeKpis[i], &demo->kpis[i]);
+    for (int i = 0; i < 3; i++) update_sensor_card(&homeSensors[i], &demo->sensors[i], 4);
+    
+    const AlarmTable_t* table = sim_get_alarm_table();
+    if ((table ? table->revision : 0) != homeShownRevision) fill_home_alarms();
+    
+    update_vision_panel(&homeVision, &demo->vision);
+}
+
+static void create_sensors_screen(void) {
+    screens[SCREEN_SENSORS] = lv_obj_create(contentArea);
+    lv_obj_set_style_bg_opa(screens[SCREEN_SENSORS], LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(screens[SCREEN_SENSORS], 0, 0);
+    lv_obj_set_style_pad_all(screens[SCREEN_SENSORS], 0, 0);
+    lv_obj_set_size(screens[SCREEN_SENSORS], lv_pct(100), lv_pct(100));
+    lv_obj_set_pos(screens[SCREEN_SENSORS], 0, 0);
+    lv_obj_add_flag(screens[SCREEN_SENSORS], LV_OBJ_FLAG_HIDDEN);
+    
+    sensorsContent = lv_obj_create(screens[SCREEN_SENSORS]);
+    lv_obj_set_style_bg_opa(sensorsContent, LV_OPA_TRANSP, 0);
     lv_obj_set_style_border_width(sensorsContent, 0, 0);
     lv_obj_set_style_pad_all(sensorsContent, 0, 0);
     lv_obj_set_size(sensorsContent, lv_pct(100), lv_pct(100));
@@ -1316,13 +1599,32 @@ static void create_sensors_screen(void) {
     rebuild_sensors_content();
 }
 
-static void rebuild_sensors_content(void) {
-    if (!sensorsContent) return;
+// What the sensors screen was built for; rebuilt only when this changes
+static uint8_t sensorsShownDemo = 0xFF;
+static uint8_t sensorsShownScenario = 0xFF;
+
+static lv_obj_t* sensorsScenario = NULL;
+static lv_obj_t* sensorsSpanBtns[SPARKLINE_SPANS] = {NULL};
+static SensorCard_t sensorCards[3];
+
+static void update_span_btns(void) {
+    for (int i = 0; i < SPARKLINE_SPANS; i++) {
+        bool active = (i == sparklineSpan);
+        lv_obj_set_style_bg_color(sensorsSpanBtns[i], active ? COLOR_ACCENT : COLOR_BORDER, 0);
+        lv_obj_set_style_text_color(lv_obj_get_child(sensorsSpanBtns[i], 0),
+                                    active ? COLOR_BG_DARK : COLOR_TEXT_MUTED, 0);
+    }
+}
+
+static void span_btn_event_cb(lv_event_t* e) {
+    sparklineSpan = (uint8_t)(intptr_t)lv_event_get_user_data(e);
+    update_span_btns();
+    rebuild_sensors_content();
+}
+
+static void create_sensors_layout(DemoProfile_t* demo, int contentWidth) {
     lv_obj_clean(sensorsContent);
-    
-    DemoProfile_t* demo = getDemo();
-    int contentWidth = DISPLAY_WIDTH - SIDEBAR_WIDTH - 28;
-    
+
     lv_obj_t* title = lv_label_create(sensorsContent);
     lv_label_set_text(title, "Sensor Monitoring");
     lv_obj_set_style_text_color(title, COLOR_TEXT_PRIMARY, 0);
@@ -1336,20 +1638,28 @@ static void rebuild_sensors_content(void) {
     lv_obj_set_style_pad_all(scenarioRow, 0, 0);
     lv_obj_set_size(scenarioRow, contentWidth, 20);
     lv_obj_set_pos(scenarioRow, 0, 25);
+    sensorsScenario = lv_label_create(scenarioRow);
 
-    char scenStr[64];
-    snprintf(scenStr, sizeof(scenStr), "Scenario: %s", sim_get_scenario_name());
-    lv_obj_t* scenLabel = lv_label_create(scenarioRow);
-    lv_label_set_text(scenLabel, scenStr);
-    ScenarioState_t scState = sim_get_scenario();
-    lv_color_t scColor = (scState == SCENARIO_NORMAL) ? COLOR_SUCCESS :
-                         (scState == SCENARIO_FAULT) ? COLOR_ERROR :
-                         (scState == SCENARIO_RECOVERY) ? COLOR_INFO : COLOR_WARNING;
-    lv_obj_set_style_text_color(scenLabel, scColor, 0);
+    // Trend span chips, right of the title
+    for (int i = 0; i < SPARKLINE_SPANS; i++) {
+        lv_obj_t* btn = lv_btn_create(sensorsContent);
+        lv_obj_set_size(btn, 64, 22);
+        lv_obj_set_style_radius(btn, 11, 0);
+        lv_obj_set_style_shadow_width(btn, 0, 0);
+        lv_obj_set_pos(btn, contentWidth - (SPARKLINE_SPANS - i) * 70, 0);
+        lv_obj_t* label = lv_label_create(btn);
+        lv_label_set_text(label, sparklineSpanName[i]);
+        lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
+        lv_obj_center(label);
+        lv_obj_add_event_cb(btn, span_btn_event_cb, LV_EVENT_CLICKED, (void*)(intptr_t)i);
+        sensorsSpanBtns[i] = btn;
+    }
+    update_span_btns();
 
     // Large sensor cards with sparklines
     int sensorWidth = (contentWidth - 20) / 3;
     for (int i = 0; i < 3; i++) {
+        SensorCard_t* sc = &sensorCards[i];
         lv_obj_t* card = lv_obj_create(sensorsContent);
         style_card(card);
         lv_obj_set_size(card, sensorWidth, 230);
@@ -1368,32 +1678,26 @@ static void rebuild_sensors_content(void) {
         lv_obj_set_style_text_color(typeLabel, COLOR_TEXT_DIM, 0);
         lv_obj_set_pos(typeLabel, 0, 18);
 
-        char valStr[32];
-        snprintf(valStr, sizeof(valStr), "%.*f", s->decimals, s->value);
-        lv_obj_t* valLabel = lv_label_create(card);
-        lv_label_set_text(valLabel, valStr);
-        lv_obj_set_style_text_color(valLabel, lv_color_hex(s->color), 0);
-        lv_obj_set_style_text_font(valLabel, &lv_font_montserrat_32, 0);
-        lv_obj_set_pos(valLabel, 0, 40);
+        sc->value = lv_label_create(card);
+        lv_obj_set_style_text_color(sc->value, lv_color_hex(s->color), 0);
+        lv_obj_set_style_text_font(sc->value, &lv_font_montserrat_32, 0);
+        lv_obj_set_pos(sc->value, 0, 40);
+        fmt_cache_reset(&sc->text);
 
-        lv_obj_t* unitLabel = lv_label_create(card);
-        lv_label_set_text(unitLabel, s->unit);
-        lv_obj_set_style_text_color(unitLabel, COLOR_TEXT_MUTED, 0);
-        lv_obj_set_style_text_font(unitLabel, &lv_font_montserrat_18, 0);
-        lv_obj_align_to(unitLabel, valLabel, LV_ALIGN_OUT_RIGHT_BOTTOM, 6, 0);
+        sc->unit = lv_label_create(card);
+        lv_label_set_text(sc->unit, s->unit);
+        lv_obj_set_style_text_color(sc->unit, COLOR_TEXT_MUTED, 0);
+        lv_obj_set_style_text_font(sc->unit, &lv_font_montserrat_18, 0);
 
         // Progress bar
-        lv_obj_t* bar = lv_bar_create(card);
-        lv_obj_set_size(bar, sensorWidth - 24, 8);
-        lv_obj_set_pos(bar, 0, 95);
-        lv_obj_set_style_bg_color(bar, COLOR_BORDER, LV_PART_MAIN);
-        lv_obj_set_style_bg_color(bar, lv_color_hex(s->color), LV_PART_INDICATOR);
-        lv_obj_set_style_radius(bar, 4, LV_PART_MAIN);
-        lv_obj_set_style_radius(bar, 4, LV_PART_INDICATOR);
-
-        int pct = (int)(((s->value - s->min) / (s->max - s->min)) * 100);
-        if (pct < 0) pct = 0; if (pct > 100) pct = 100;
-        lv_bar_set_value(bar, pct, LV_ANIM_OFF);
+        sc->bar = lv_bar_create(card);
+        lv_obj_set_size(sc->bar, sensorWidth - 24, 8);
+        lv_obj_set_pos(sc->bar, 0, 95);
+        lv_obj_set_style_bg_color(sc->bar, COLOR_BORDER, LV_PART_MAIN);
+        lv_obj_set_style_bg_color(sc->bar, lv_color_hex(s->color), LV_PART_INDICATOR);
+        lv_obj_set_style_radius(sc->bar, 4, LV_PART_MAIN);
+        lv_obj_set_style_radius(sc->bar, 4, LV_PART_INDICATOR);
+        sc->pct = -1;
 
         // Sparkline container
         lv_obj_t* sparkBox = lv_obj_create(card);
@@ -1406,14 +1710,12 @@ static void rebuild_sensors_content(void) {
         lv_obj_set_size(sparkBox, sensorWidth - 24, 70);
         lv_obj_set_pos(sparkBox, 0, 115);
         lv_obj_clear_flag(sparkBox, LV_OBJ_FLAG_SCROLLABLE);
-
-        // Draw sparkline from history
-        draw_sparkline(sparkBox, i, sensorWidth - 36, 58, lv_color_hex(s->color));
+        sc->line = create_sparkline(sparkBox, lv_color_hex(s->color));
 
         // Min/Max labels below sparkline
         char minStr[16], maxStr[16];
-        snprintf(minStr, sizeof(minStr), "%.0f", s->min);
-        snprintf(maxStr, sizeof(maxStr), "%.0f", s->max);
+        fmt_fixed(minStr, sizeof(minStr), s->min, 0, NULL);
+        fmt_fixed(maxStr, sizeof(maxStr), s->max, 0, NULL);
 
         lv_obj_t* minLabel = lv_label_create(card);
         lv_label_set_text(minLabel, minStr);
@@ -1425,6 +1727,36 @@ static void rebuild_sensors_content(void) {
         lv_obj_set_style_text_color(maxLabel, COLOR_TEXT_DIM, 0);
         lv_obj_align(maxLabel, LV_ALIGN_TOP_RIGHT, 0, 190);
     }
+    sensorsShownDemo = getDemoIndex();
+    sensorsShownScenario = 0xFF;
+}
+
+static void rebuild_sensors_content(void) {
+    if (!sensorsContent) return;
+    
+    DemoProfile_t* demo = getDemo();
+    int contentWidth = DISPLAY_WIDTH - SIDEBAR_WIDTH - 28;
+    if (getDemoIndex() != sensorsShownDemo) create_sensors_layout(demo, contentWidth);
+
+    ScenarioState_t scState = sim_get_scenario();
+    if (scState != sensorsShownScenario) {
+        lv_label_set_text_fmt(sensorsScenario, "Scenario: %s", sim_get_scenario_name());
+        lv_color_t scColor = (scState == SCENARIO_NORMAL) ? COLOR_SUCCESS :
+                             (scState == SCENARIO_FAULT) ? COLOR_ERROR :
+                             (scState == SCENARIO_RECOVERY) ? COLOR_INFO : COLOR_WARNING;
+        lv_obj_set_style_text_color(sensorsScenario, scColor, 0);
+        sensorsShownScenario = (uint8_t)scState;
+    }
+
+    int sensorWidth = (contentWidth - 20) / 3;
+    load_sparkline_window();
+    for (int i = 0; i < 3; i++) {
+        SensorCard_t* sc = &sensorCards[i];
+        Sensor_t* s = &demo->sensors[i];
+
+        update_sensor_card(sc, s, 6);
+        update_sparkline(sc->line, i, sensorWidth - 36, 58);
+    }
 }
 
 static void create_alarms_screen(void) {
@@ -1445,55 +1777,107 @@ static void create_alarms_screen(void) {
     rebuild_alarms_content();
 }
 
+// What the alarms screen last showed; refreshed only when this changes
+static uint32_t alarmsShownRevision = 0;
+static uint8_t alarmsShownDemo = 0xFF;
+static ScenarioState_t alarmsShownScenario = SCENARIO_NORMAL;
+
+// Built once; later refreshes only update text and rebind the list rows
+static lv_obj_t* alarmsTitle = NULL;
+static lv_obj_t* alarmsScenario = NULL;
+static lv_obj_t* alarmsSummary = NULL;
+static lv_obj_t* alarmsViewBtns[ALARM_VIEW_COUNT] = {NULL};
+static lv_obj_t* alarmsList = NULL;
+
+static bool alarms_view_changed(void) {
+    const AlarmTable_t* table = sim_get_alarm_table();
+    return !table || table->revision != alarmsShownRevision ||
+           getDemoIndex() != alarmsShownDemo || sim_get_scenario() != alarmsShownScenario;
+}
+
+static void update_alarm_view_btns(void) {
+    AlarmView_t view = alarm_list_get_view();
+    for (int i = 0; i < ALARM_VIEW_COUNT; i++) {
+        bool active = (i == view);
+        lv_obj_set_style_bg_color(alarmsViewBtns[i], active ? COLOR_ACCENT : COLOR_BORDER, 0);
+        lv_obj_set_style_text_color(lv_obj_get_child(alarmsViewBtns[i], 0),
+                                    active ? COLOR_BG_DARK : COLOR_TEXT_MUTED, 0);
+    }
+}
+
+static void alarm_view_btn_event_cb(lv_event_t* e) {
+    intptr_t view = (intptr_t)lv_event_get_user_data(e);
+    alarm_list_set_view((AlarmView_t)view);
+    update_alarm_view_btns();
+}
+
+static void create_alarms_layout(int contentWidth) {
+    alarmsTitle = lv_label_create(alarmsContent);
+    lv_obj_set_style_text_color(alarmsTitle, COLOR_TEXT_PRIMARY, 0);
+    lv_obj_set_style_text_font(alarmsTitle, &lv_font_montserrat_18, 0);
+    lv_obj_set_pos(alarmsTitle, 0, 0);
+
+    alarmsScenario = lv_label_create(alarmsContent);
+    lv_obj_set_pos(alarmsScenario, 0, 28);
+
+    // View filter chips
+    for (int i = 0; i < ALARM_VIEW_COUNT; i++) {
+        lv_obj_t* btn = lv_btn_create(alarmsContent);
+        lv_obj_set_size(btn, 84, 28);
+        lv_obj_set_style_radius(btn, 14, 0);
+        lv_obj_set_style_shadow_width(btn, 0, 0);
+        lv_obj_set_pos(btn, i * 92, 52);
+        lv_obj_t* label = lv_label_create(btn);
+        lv_label_set_text(label, alarm_list_view_name((AlarmView_t)i));
+        lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
+        lv_obj_center(label);
+        lv_obj_add_event_cb(btn, alarm_view_btn_event_cb, LV_EVENT_CLICKED, (void*)(intptr_t)i);
+        alarmsViewBtns[i] = btn;
+    }
+    update_alarm_view_btns();
+
+    // Flood / shelving summary, next to the chips
+    alarmsSummary = lv_obj_create(alarmsContent);
+    lv_obj_set_style_bg_opa(alarmsSummary, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(alarmsSummary, 0, 0);
+    lv_obj_set_style_pad_all(alarmsSummary, 0, 0);
+    lv_obj_set_size(alarmsSummary, contentWidth - ALARM_VIEW_COUNT * 92, 28);
+    lv_obj_set_pos(alarmsSummary, ALARM_VIEW_COUNT * 92, 58);
+    lv_obj_clear_flag(alarmsSummary, LV_OBJ_FLAG_SCROLLABLE);
+
+    alarmsList = alarm_list_create(alarmsContent, contentWidth, 380);
+    lv_obj_set_pos(alarmsList, 0, 90);
+}
+
 static void rebuild_alarms_content(void) {
     if (!alarmsContent) return;
-    lv_obj_clean(alarmsContent);
+
+    const AlarmTable_t* table = sim_get_alarm_table();
+    alarmsShownRevision = table ? table->revision : 0;
+    alarmsShownDemo = getDemoIndex();
+    alarmsShownScenario = sim_get_scenario();
 
     int contentWidth = DISPLAY_WIDTH - SIDEBAR_WIDTH - 28;
-    uint8_t alarmCount = sim_get_alarm_count();
+    if (!alarmsList) create_alarms_layout(contentWidth);
 
-    // Title with count
-    lv_obj_t* title = lv_label_create(alarmsContent);
-    char titleStr[48];
-    snprintf(titleStr, sizeof(titleStr), "Alarm Management (%d active)", alarmCount);
-    lv_label_set_text(title, titleStr);
-    lv_obj_set_style_text_color(title, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_set_style_text_font(title, &lv_font_montserrat_18, 0);
-    lv_obj_set_pos(title, 0, 0);
+    // Title with counts
+    uint8_t alarmCount = sim_get_alarm_count();
+    uint32_t logged = table ? alarm_log_end_seq(table) - alarm_log_first_seq(table) : 0;
+    lv_label_set_text_fmt(alarmsTitle, "Alarm Management (%d active, %lu logged)",
+                          alarmCount, (unsigned long)logged);
 
     // Scenario context
-    lv_obj_t* scenInfo = lv_label_create(alarmsContent);
-    char scenStr[64];
-    snprintf(scenStr, sizeof(scenStr), "System State: %s", sim_get_scenario_name());
-    lv_label_set_text(scenInfo, scenStr);
+    lv_label_set_text_fmt(alarmsScenario, "System State: %s", sim_get_scenario_name());
     ScenarioState_t scState = sim_get_scenario();
     lv_color_t scColor = (scState == SCENARIO_NORMAL) ? COLOR_SUCCESS :
                          (scState == SCENARIO_FAULT) ? COLOR_ERROR :
                          (scState == SCENARIO_RECOVERY) ? COLOR_INFO : COLOR_WARNING;
-    lv_obj_set_style_text_color(scenInfo, scColor, 0);
-    lv_obj_set_pos(scenInfo, 0, 28);
-
-    // Dynamic alarms card
-    lv_obj_t* alarmsCard = lv_obj_create(alarmsContent);
-    style_card(alarmsCard);
-    lv_obj_set_size(alarmsCard, contentWidth, 420);
-    lv_obj_set_pos(alarmsCard, 0, 50);
-    lv_obj_set_layout(alarmsCard, LV_LAYOUT_FLEX);
-    lv_obj_set_flex_flow(alarmsCard, LV_FLEX_FLOW_COLUMN);
-
-    if (alarmCount == 0) {
-        lv_obj_t* noAlarms = lv_label_create(alarmsCard);
-        lv_label_set_text(noAlarms, "No active alarms - system operating normally");
-        lv_obj_set_style_text_color(noAlarms, COLOR_SUCCESS, 0);
-    } else {
-        // Show most recent alarms first (up to 8)
-        for (int i = alarmCount - 1; i >= 0; i--) {
-            DynamicAlarm_t* a = sim_get_alarm(i);
-            if (a) {
-                create_dynamic_alarm_row(alarmsCard, a, i, true);
-            }
-        }
-    }
+    lv_obj_set_style_text_color(alarmsScenario, scColor, 0);
+
+    lv_obj_clean(alarmsSummary);
+    create_alarm_summary_row(alarmsSummary);
+
+    alarm_list_refresh();
 }
 
 static void create_vision_screen(void) {
@@ -1514,13 +1898,12 @@ static void create_vision_screen(void) {
     rebuild_vision_content();
 }
 
-static void rebuild_vision_content(void) {
-    if (!visionContent) return;
+static void create_vision_layout(DemoProfile_t* demo, int contentWidth) {
+#if ENABLE_VISION
+    previewImg = NULL;
+#endif
     lv_obj_clean(visionContent);
     
-    DemoProfile_t* demo = getDemo();
-    int contentWidth = DISPLAY_WIDTH - SIDEBAR_WIDTH - 28;
-    
     lv_obj_t* title = lv_label_create(visionContent);
     lv_label_set_text(title, "Computer Vision");
     lv_obj_set_style_text_color(title, COLOR_TEXT_PRIMARY, 0);
@@ -1550,7 +1933,8 @@ static void rebuild_vision_content(void) {
     lv_obj_set_style_text_color(panelSub, COLOR_TEXT_MUTED, 0);
     lv_obj_align(panelSub, LV_ALIGN_TOP_MID, 0, 22);
     
-    create_vision_panel_content(visionPanel, demo, 50);
+    create_vision_panel_content(visionPanel, demo, 50, &visionVision);
+    visionShownDemo = getDemoIndex();
     
     // Camera status card
     lv_obj_t* camCard = lv_obj_create(visionContent);
@@ -1559,12 +1943,38 @@ static void rebuild_vision_content(void) {
     lv_obj_set_pos(camCard, 0, 400);
     lv_obj_clear_flag(camCard, LV_OBJ_FLAG_SCROLLABLE);
     
+#if ENABLE_VISION
+    if (camPreview) {
+        // Live picture on the left, showing the last frame taken
+        lv_obj_set_height(camCard, camPreview->height + 26);
+        previewDsc.data = (const uint8_t*)preview_front(camPreview);
+        previewImg = lv_image_create(camCard);
+        lv_image_set_src(previewImg, &previewDsc);
+        lv_obj_align(previewImg, LV_ALIGN_LEFT_MID, 0, 0);
+    
+        lv_obj_t* liveLabel = lv_label_create(camCard);
+        lv_label_set_text(liveLabel, LV_SYMBOL_VIDEO " Camera live - lamps and displays read from the image");
+        lv_obj_set_style_text_color(liveLabel, COLOR_TEXT_MUTED, 0);
+        lv_obj_align(liveLabel, LV_ALIGN_LEFT_MID, camPreview->width + 16, 0);
+        return;
+    }
+#endif
+    
     lv_obj_t* camLabel = lv_label_create(camCard);
     lv_label_set_text(camLabel, LV_SYMBOL_IMAGE " Camera stream active - 30 FPS - CV processing enabled");
     lv_obj_set_style_text_color(camLabel, COLOR_TEXT_MUTED, 0);
     lv_obj_center(camLabel);
 }
 
+static void rebuild_vision_content(void) {
+    if (!visionContent) return;
+    
+    DemoProfile_t* demo = getDemo();
+    int contentWidth = DISPLAY_WIDTH - SIDEBAR_WIDTH - 28;
+    if (getDemoIndex() != visionShownDemo) create_vision_layout(demo, contentWidth);
+    update_vision_panel(&visionVision, &demo->vision);
+}
+
 // ============ QR Code Generation (Simple visual representation) ============
 static void create_qr_code(lv_obj_t* parent, const char* data, int size) {
     // Create a visual QR code pattern (simplified - in production use qrcode library)
@@ -1631,61 +2041,82 @@ static void create_qr_code(lv_obj_t* parent, const char* data, int size) {
 }
 
 // ============ AI Insight Card Helper ============
-static void create_insight_card(lv_obj_t* parent, AIInsight_t* insight, int width) {
+typedef struct {
+    lv_obj_t* card;
+    lv_obj_t* title;
+    lv_obj_t* desc;
+    lv_obj_t* confBadge;
+    lv_obj_t* conf;
+    lv_obj_t* time;
+    int8_t severity;        // -1 until first shown
+} InsightCard_t;
+
+static void create_insight_card(lv_obj_t* parent, int width, InsightCard_t* ic) {
     lv_obj_t* card = lv_obj_create(parent);
     lv_obj_set_size(card, width, 85);
     lv_obj_set_style_bg_color(card, COLOR_BG_DARK2, 0);
     lv_obj_set_style_bg_opa(card, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(card, 1, 0);
     lv_obj_set_style_radius(card, 6, 0);
     lv_obj_set_style_pad_all(card, 10, 0);
     lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
     
-    // Severity indicator
-    lv_color_t sevColor = (insight->severity == INSIGHT_CRITICAL) ? COLOR_ERROR :
-                          (insight->severity == INSIGHT_WARNING) ? COLOR_WARNING : COLOR_SUCCESS;
-    lv_obj_set_style_border_color(card, sevColor, 0);
+    // Severity indicator, coloured by update_insight_card
     lv_obj_set_style_border_side(card, LV_BORDER_SIDE_LEFT, 0);
     lv_obj_set_style_border_width(card, 3, 0);
+    ic->card = card;
+    ic->severity = -1;
     
     // Title
-    lv_obj_t* titleLabel = lv_label_create(card);
-    lv_label_set_text(titleLabel, insight->title);
-    lv_obj_set_style_text_color(titleLabel, COLOR_TEXT_PRIMARY, 0);
-    lv_obj_set_style_text_font(titleLabel, &lv_font_montserrat_14, 0);
-    lv_obj_set_pos(titleLabel, 0, 0);
+    ic->title = lv_label_create(card);
+    lv_label_set_text(ic->title, "");
+    lv_obj_set_style_text_color(ic->title, COLOR_TEXT_PRIMARY, 0);
+    lv_obj_set_style_text_font(ic->title, &lv_font_montserrat_14, 0);
+    lv_obj_set_pos(ic->title, 0, 0);
     
     // Description
-    lv_obj_t* descLabel = lv_label_create(card);
-    lv_label_set_text(descLabel, insight->description);
-    lv_obj_set_style_text_color(descLabel, COLOR_TEXT_MUTED, 0);
-    lv_label_set_long_mode(descLabel, LV_LABEL_LONG_WRAP);
-    lv_obj_set_width(descLabel, width - 100);
-    lv_obj_set_pos(descLabel, 0, 20);
+    ic->desc = lv_label_create(card);
+    lv_label_set_text(ic->desc, "");
+    lv_obj_set_style_text_color(ic->desc, COLOR_TEXT_MUTED, 0);
+    lv_label_set_long_mode(ic->desc, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(ic->desc, width - 100);
+    lv_obj_set_pos(ic->desc, 0, 20);
     
     // Confidence badge
-    char confStr[16];
-    snprintf(confStr, sizeof(confStr), "%d%%", insight->confidence);
-    lv_obj_t* confBadge = lv_obj_create(card);
-    lv_obj_set_size(confBadge, 40, 22);
-    lv_obj_set_style_bg_color(confBadge, sevColor, 0);
-    lv_obj_set_style_bg_opa(confBadge, LV_OPA_30, 0);
-    lv_obj_set_style_border_width(confBadge, 0, 0);
-    lv_obj_set_style_radius(confBadge, 4, 0);
-    lv_obj_align(confBadge, LV_ALIGN_TOP_RIGHT, 0, 0);
-    
-    lv_obj_t* confLabel = lv_label_create(confBadge);
-    lv_label_set_text(confLabel, confStr);
-    lv_obj_set_style_text_color(confLabel, sevColor, 0);
-    lv_obj_center(confLabel);
+    ic->confBadge = lv_obj_create(card);
+    lv_obj_set_size(ic->confBadge, 40, 22);
+    lv_obj_set_style_bg_opa(ic->confBadge, LV_OPA_30, 0);
+    lv_obj_set_style_border_width(ic->confBadge, 0, 0);
+    lv_obj_set_style_radius(ic->confBadge, 4, 0);
+    lv_obj_align(ic->confBadge, LV_ALIGN_TOP_RIGHT, 0, 0);
+    
+    ic->conf = lv_label_create(ic->confBadge);
+    lv_label_set_text(ic->conf, "");
+    lv_obj_center(ic->conf);
     
     // Timeframe
-    lv_obj_t* timeLabel = lv_label_create(card);
-    char timeStr[32];
-    snprintf(timeStr, sizeof(timeStr), LV_SYMBOL_LOOP " %s", insight->timeframe);
-    lv_label_set_text(timeLabel, timeStr);
-    lv_obj_set_style_text_color(timeLabel, COLOR_TEXT_DIM, 0);
-    lv_obj_align(timeLabel, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+    ic->time = lv_label_create(card);
+    lv_label_set_text(ic->time, "");
+    lv_obj_set_style_text_color(ic->time, COLOR_TEXT_DIM, 0);
+    lv_obj_align(ic->time, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+}
+
+static void update_insight_card(InsightCard_t* ic, AIInsight_t* insight) {
+    if (ic->severity != (int8_t)insight->severity) {
+        lv_color_t sevColor = (insight->severity == INSIGHT_CRITICAL) ? COLOR_ERROR :
+                              (insight->severity == INSIGHT_WARNING) ? COLOR_WARNING : COLOR_SUCCESS;
+        lv_obj_set_style_border_color(ic->card, sevColor, 0);
+        lv_obj_set_style_bg_color(ic->confBadge, sevColor, 0);
+        lv_obj_set_style_text_color(ic->conf, sevColor, 0);
+        ic->severity = (int8_t)insight->severity;
+    }
+    set_label_text(ic->title, insight->title);
+    set_label_text(ic->desc, insight->description);
+    
+    char str[32];
+    snprintf(str, sizeof(str), "%d%%", insight->confidence);
+    set_label_text(ic->conf, str);
+    snprintf(str, sizeof(str), LV_SYMBOL_LOOP " %s", insight->timeframe);
+    set_label_text(ic->time, str);
 }
 
 // ============ AI Screen ============
@@ -1707,14 +2138,23 @@ static void create_ai_screen(void) {
     rebuild_ai_content();
 }
 
-static void rebuild_ai_content(void) {
-    if (!aiContent) return;
-    lv_obj_clean(aiContent);
-    
-    DemoProfile_t* demo = getDemo();
-    AIState_t* ai = &demo->ai;
-    int contentWidth = DISPLAY_WIDTH - SIDEBAR_WIDTH - 28;
-    
+// Built once; refreshes restyle and rewrite only what changed. The layout
+// does not depend on the demo, only the values do.
+static lv_obj_t* aiModelBadge = NULL;
+static lv_obj_t* aiModelLabel = NULL;
+static lv_obj_t* aiArc = NULL;
+static lv_obj_t* aiHealth = NULL;
+static lv_obj_t* aiStats[4] = {NULL};
+static InsightCard_t aiInsights[3];
+static lv_obj_t* aiOtaBar = NULL;
+static lv_obj_t* aiOtaStatus = NULL;
+static lv_obj_t* aiUpdateBtn = NULL;
+static lv_obj_t* aiUpdateLabel = NULL;
+static int16_t aiShownHealth = -1;
+static int8_t aiShownOtaActive = -1;
+static int16_t aiShownOtaBar = -1;
+
+static void create_ai_layout(int contentWidth) {
     // Title
     lv_obj_t* title = lv_label_create(aiContent);
     lv_label_set_text(title, "AI Predictive Maintenance");
@@ -1723,19 +2163,16 @@ static void rebuild_ai_content(void) {
     lv_obj_set_pos(title, 0, 0);
     
     // Model status badge
-    lv_obj_t* modelBadge = lv_obj_create(aiContent);
-    lv_obj_set_size(modelBadge, 100, 26);
-    bool isLearning = strcmp(ai->modelStatus, "Learning") == 0;
-    lv_obj_set_style_bg_color(modelBadge, isLearning ? COLOR_WARNING : COLOR_SUCCESS, 0);
-    lv_obj_set_style_bg_opa(modelBadge, LV_OPA_30, 0);
-    lv_obj_set_style_border_width(modelBadge, 0, 0);
-    lv_obj_set_style_radius(modelBadge, 4, 0);
-    lv_obj_set_pos(modelBadge, contentWidth - 100, 0);
-    
-    lv_obj_t* modelLabel = lv_label_create(modelBadge);
-    lv_label_set_text(modelLabel, ai->modelStatus);
-    lv_obj_set_style_text_color(modelLabel, isLearning ? COLOR_WARNING : COLOR_SUCCESS, 0);
-    lv_obj_center(modelLabel);
+    aiModelBadge = lv_obj_create(aiContent);
+    lv_obj_set_size(aiModelBadge, 100, 26);
+    lv_obj_set_style_bg_opa(aiModelBadge, LV_OPA_30, 0);
+    lv_obj_set_style_border_width(aiModelBadge, 0, 0);
+    lv_obj_set_style_radius(aiModelBadge, 4, 0);
+    lv_obj_set_pos(aiModelBadge, contentWidth - 100, 0);
+    
+    aiModelLabel = lv_label_create(aiModelBadge);
+    lv_label_set_text(aiModelLabel, "");
+    lv_obj_center(aiModelLabel);
     
     // ========== Top Row: Health Score + Quick Stats ==========
     lv_obj_t* topRow = lv_obj_create(aiContent);
@@ -1761,44 +2198,24 @@ static void rebuild_ai_content(void) {
     lv_obj_align(healthTitle, LV_ALIGN_TOP_MID, 0, 0);
     
     // Health arc
-    lv_obj_t* arc = lv_arc_create(healthCard);
-    lv_obj_set_size(arc, 80, 80);
-    lv_arc_set_rotation(arc, 135);
-    lv_arc_set_bg_angles(arc, 0, 270);
-    lv_arc_set_value(arc, ai->healthScore);
-    lv_obj_set_style_arc_width(arc, 10, LV_PART_MAIN);
-    lv_obj_set_style_arc_width(arc, 10, LV_PART_INDICATOR);
-    lv_obj_set_style_arc_color(arc, COLOR_BORDER, LV_PART_MAIN);
-    lv_color_t healthColor = (ai->healthScore >= 80) ? COLOR_SUCCESS : 
-                             (ai->healthScore >= 60) ? COLOR_WARNING : COLOR_ERROR;
-    lv_obj_set_style_arc_color(arc, healthColor, LV_PART_INDICATOR);
-    lv_obj_remove_style(arc, NULL, LV_PART_KNOB);
-    lv_obj_clear_flag(arc, LV_OBJ_FLAG_CLICKABLE);
-    lv_obj_align(arc, LV_ALIGN_CENTER, 0, 10);
-    
-    char healthStr[8];
-    snprintf(healthStr, sizeof(healthStr), "%d", ai->healthScore);
-    lv_obj_t* healthVal = lv_label_create(arc);
-    lv_label_set_text(healthVal, healthStr);
-    lv_obj_set_style_text_color(healthVal, healthColor, 0);
-    lv_obj_set_style_text_font(healthVal, &lv_font_montserrat_24, 0);
-    lv_obj_center(healthVal);
+    aiArc = lv_arc_create(healthCard);
+    lv_obj_set_size(aiArc, 80, 80);
+    lv_arc_set_rotation(aiArc, 135);
+    lv_arc_set_bg_angles(aiArc, 0, 270);
+    lv_obj_set_style_arc_width(aiArc, 10, LV_PART_MAIN);
+    lv_obj_set_style_arc_width(aiArc, 10, LV_PART_INDICATOR);
+    lv_obj_set_style_arc_color(aiArc, COLOR_BORDER, LV_PART_MAIN);
+    lv_obj_remove_style(aiArc, NULL, LV_PART_KNOB);
+    lv_obj_clear_flag(aiArc, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_align(aiArc, LV_ALIGN_CENTER, 0, 10);
+    
+    aiHealth = lv_label_create(aiArc);
+    lv_obj_set_style_text_font(aiHealth, &lv_font_montserrat_24, 0);
+    lv_obj_center(aiHealth);
+    aiShownHealth = -1;
     
     // Quick Stats Cards
     const char* statLabels[] = {"Failure Risk", "Anomalies", "Data Points", "Next Maint."};
-    char statValues[4][32];
-    snprintf(statValues[0], sizeof(statValues[0]), "%.1f%%", ai->failureProbability);
-    snprintf(statValues[1], sizeof(statValues[1]), "%d", ai->anomalyCount);
-    snprintf(statValues[2], sizeof(statValues[2]), "%lu", (unsigned long)ai->dataPoints);
-    snprintf(statValues[3], sizeof(statValues[3]), "%s", ai->nextMaintenance);
-    
-    lv_color_t statColors[] = {
-        (ai->failureProbability > 25) ? COLOR_ERROR : (ai->failureProbability > 10) ? COLOR_WARNING : COLOR_SUCCESS,
-        (ai->anomalyCount > 1) ? COLOR_WARNING : COLOR_SUCCESS,
-        COLOR_ACCENT,
-        COLOR_INFO
-    };
-    
     int statWidth = (contentWidth - 160 - 40) / 4;
     for (int i = 0; i < 4; i++) {
         lv_obj_t* statCard = lv_obj_create(topRow);
@@ -1811,11 +2228,11 @@ static void rebuild_ai_content(void) {
         lv_obj_set_style_text_color(sLabel, COLOR_TEXT_MUTED, 0);
         lv_obj_align(sLabel, LV_ALIGN_TOP_MID, 0, 0);
         
-        lv_obj_t* sVal = lv_label_create(statCard);
-        lv_label_set_text(sVal, statValues[i]);
-        lv_obj_set_style_text_color(sVal, statColors[i], 0);
-        lv_obj_set_style_text_font(sVal, (i == 2) ? &lv_font_montserrat_16 : &lv_font_montserrat_24, 0);
-        lv_obj_center(sVal);
+        aiStats[i] = lv_label_create(statCard);
+        lv_label_set_text(aiStats[i], "");
+        lv_obj_set_style_text_color(aiStats[i], i == 2 ? COLOR_ACCENT : COLOR_INFO, 0);
+        lv_obj_set_style_text_font(aiStats[i], (i == 2) ? &lv_font_montserrat_16 : &lv_font_montserrat_24, 0);
+        lv_obj_center(aiStats[i]);
     }
     
     // ========== Middle Row: Predictions ==========
@@ -1838,7 +2255,7 @@ static void rebuild_ai_content(void) {
     
     int insightWidth = (contentWidth - 20) / 3;
     for (int i = 0; i < 3; i++) {
-        create_insight_card(predRow, &ai->insights[i], insightWidth);
+        create_insight_card(predRow, insightWidth, &aiInsights[i]);
     }
     
     // ========== Bottom Row: QR Code + OTA ==========
@@ -1897,52 +2314,124 @@ static void rebuild_ai_content(void) {
     lv_obj_set_pos(fwAvail, 0, 45);
     
     // OTA Progress bar
-    lv_obj_t* otaProgressBar = lv_bar_create(otaCard);
-    lv_obj_set_size(otaProgressBar, contentWidth - 250, 12);
-    lv_obj_set_pos(otaProgressBar, 0, 75);
-    lv_obj_set_style_bg_color(otaProgressBar, COLOR_BORDER, LV_PART_MAIN);
-    lv_obj_set_style_bg_color(otaProgressBar, COLOR_ACCENT, LV_PART_INDICATOR);
-    lv_obj_set_style_radius(otaProgressBar, 6, LV_PART_MAIN);
-    lv_obj_set_style_radius(otaProgressBar, 6, LV_PART_INDICATOR);
+    aiOtaBar = lv_bar_create(otaCard);
+    lv_obj_set_size(aiOtaBar, contentWidth - 250, 12);
+    lv_obj_set_pos(aiOtaBar, 0, 75);
+    lv_obj_set_style_bg_color(aiOtaBar, COLOR_BORDER, LV_PART_MAIN);
+    lv_obj_set_style_bg_color(aiOtaBar, COLOR_ACCENT, LV_PART_INDICATOR);
+    lv_obj_set_style_radius(aiOtaBar, 6, LV_PART_MAIN);
+    lv_obj_set_style_radius(aiOtaBar, 6, LV_PART_INDICATOR);
+    aiShownOtaBar = -1;
+
+    aiOtaStatus = lv_label_create(otaCard);
+    lv_label_set_text(aiOtaStatus, "");
+    lv_obj_set_pos(aiOtaStatus, 0, 95);
+
+    // Update button; the callback ignores taps while an update runs
+    aiUpdateBtn = lv_btn_create(otaCard);
+    lv_obj_set_size(aiUpdateBtn, 130, 35);
+    lv_obj_set_style_radius(aiUpdateBtn, 6, 0);
+    lv_obj_set_style_shadow_width(aiUpdateBtn, 0, 0);
+    lv_obj_align(aiUpdateBtn, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+    lv_obj_add_event_cb(aiUpdateBtn, ota_btn_event_cb, LV_EVENT_CLICKED, NULL);
+
+    aiUpdateLabel = lv_label_create(aiUpdateBtn);
+    lv_obj_center(aiUpdateLabel);
+    aiShownOtaActive = -1;
+}
 
+static void update_ai_ota(void) {
     bool otaActive = sim_ota_active();
     uint8_t otaProg = sim_ota_progress();
-    lv_bar_set_value(otaProgressBar, otaActive ? otaProg : 0, LV_ANIM_OFF);
+#if ENABLE_OTA
+    if (otaUpdate) {
+        otaActive = ota_busy(otaUpdate);
+        otaProg = ota_progress(otaUpdate);
+    }
+#endif
+    int16_t barValue = otaActive ? otaProg : 0;
+    if (barValue != aiShownOtaBar) {
+        lv_bar_set_value(aiOtaBar, barValue, LV_ANIM_OFF);
+        aiShownOtaBar = barValue;
+    }
 
-    lv_obj_t* otaStatus = lv_label_create(otaCard);
+    char otaStr[64];
+    lv_color_t otaColor;
+#if ENABLE_OTA
+    if (otaUpdate && ota_state(otaUpdate) == OTA_FAILED) {
+        snprintf(otaStr, sizeof(otaStr), "Update failed: %s", ota_error_text(ota_error(otaUpdate)));
+        otaColor = COLOR_ERROR;
+    } else if (otaUpdate && ota_state(otaUpdate) == OTA_DONE) {
+        snprintf(otaStr, sizeof(otaStr), "Update installed - restart to run it");
+        otaColor = COLOR_SUCCESS;
+    } else if (otaUpdate && ota_state(otaUpdate) <= OTA_CHECKING && otaActive) {
+        snprintf(otaStr, sizeof(otaStr), "Checking the update...");
+        otaColor = COLOR_ACCENT;
+    } else
+#endif
     if (otaActive) {
-        char otaStr[48];
         snprintf(otaStr, sizeof(otaStr), "Downloading firmware... %d%%", otaProg);
-        lv_label_set_text(otaStatus, otaStr);
-        lv_obj_set_style_text_color(otaStatus, COLOR_ACCENT, 0);
+        otaColor = COLOR_ACCENT;
     } else if (otaProg >= 100) {
-        lv_label_set_text(otaStatus, "Update complete! Running v1.1.0");
-        lv_obj_set_style_text_color(otaStatus, COLOR_SUCCESS, 0);
+        snprintf(otaStr, sizeof(otaStr), "Update complete! Running v1.1.0");
+        otaColor = COLOR_SUCCESS;
     } else {
-        lv_label_set_text(otaStatus, "Ready to update - tap button to start");
-        lv_obj_set_style_text_color(otaStatus, COLOR_TEXT_DIM, 0);
+        snprintf(otaStr, sizeof(otaStr), "Ready to update - tap button to start");
+        otaColor = COLOR_TEXT_DIM;
     }
-    lv_obj_set_pos(otaStatus, 0, 95);
+    if (set_label_text(aiOtaStatus, otaStr)) lv_obj_set_style_text_color(aiOtaStatus, otaColor, 0);
 
-    // Update button
-    lv_obj_t* updateBtn = lv_btn_create(otaCard);
-    lv_obj_set_size(updateBtn, 130, 35);
-    lv_obj_set_style_radius(updateBtn, 6, 0);
-    lv_obj_set_style_shadow_width(updateBtn, 0, 0);
-    lv_obj_align(updateBtn, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+    if ((int8_t)otaActive != aiShownOtaActive) {
+        lv_obj_set_style_bg_color(aiUpdateBtn, otaActive ? COLOR_BORDER : COLOR_ACCENT, 0);
+        lv_label_set_text(aiUpdateLabel, otaActive ? "Updating..." : "Start Update");
+        lv_obj_set_style_text_color(aiUpdateLabel, otaActive ? COLOR_TEXT_MUTED : COLOR_BG_DARK, 0);
+        aiShownOtaActive = (int8_t)otaActive;
+    }
+}
 
-    lv_obj_t* updateLabel = lv_label_create(updateBtn);
-    if (otaActive) {
-        lv_obj_set_style_bg_color(updateBtn, COLOR_BORDER, 0);
-        lv_label_set_text(updateLabel, "Updating...");
-        lv_obj_set_style_text_color(updateLabel, COLOR_TEXT_MUTED, 0);
-    } else {
-        lv_obj_set_style_bg_color(updateBtn, COLOR_ACCENT, 0);
-        lv_label_set_text(updateLabel, "Start Update");
-        lv_obj_set_style_text_color(updateLabel, COLOR_BG_DARK, 0);
-        lv_obj_add_event_cb(updateBtn, ota_btn_event_cb, LV_EVENT_CLICKED, NULL);
+static void rebuild_ai_content(void) {
+    if (!aiContent) return;
+    if (!aiArc) create_ai_layout(DISPLAY_WIDTH - SIDEBAR_WIDTH - 28);
+    
+    DemoProfile_t* demo = getDemo();
+    AIState_t* ai = &demo->ai;
+    
+    if (set_label_text(aiModelLabel, ai->modelStatus)) {
+        bool isLearning = strcmp(ai->modelStatus, "Learning") == 0;
+        lv_obj_set_style_bg_color(aiModelBadge, isLearning ? COLOR_WARNING : COLOR_SUCCESS, 0);
+        lv_obj_set_style_text_color(aiModelLabel, isLearning ? COLOR_WARNING : COLOR_SUCCESS, 0);
     }
-    lv_obj_center(updateLabel);
+    
+    if (ai->healthScore != aiShownHealth) {
+        lv_arc_set_value(aiArc, ai->healthScore);
+        lv_color_t healthColor = (ai->healthScore >= 80) ? COLOR_SUCCESS : 
+                                 (ai->healthScore >= 60) ? COLOR_WARNING : COLOR_ERROR;
+        lv_obj_set_style_arc_color(aiArc, healthColor, LV_PART_INDICATOR);
+        lv_label_set_text_fmt(aiHealth, "%d", ai->healthScore);
+        lv_obj_set_style_text_color(aiHealth, healthColor, 0);
+        aiShownHealth = ai->healthScore;
+    }
+    
+    // Quick stats: failure risk and anomalies recolour with their value
+    char statValues[4][32];
+    fmt_fixed(statValues[0], sizeof(statValues[0]), ai->failureProbability, 1, "%");
+    snprintf(statValues[1], sizeof(statValues[1]), "%d", ai->anomalyCount);
+    snprintf(statValues[2], sizeof(statValues[2]), "%lu", (unsigned long)ai->dataPoints);
+    snprintf(statValues[3], sizeof(statValues[3]), "%s", ai->nextMaintenance);
+    
+    if (set_label_text(aiStats[0], statValues[0])) {
+        lv_obj_set_style_text_color(aiStats[0], (ai->failureProbability > 25) ? COLOR_ERROR :
+                                    (ai->failureProbability > 10) ? COLOR_WARNING : COLOR_SUCCESS, 0);
+    }
+    if (set_label_text(aiStats[1], statValues[1])) {
+        lv_obj_set_style_text_color(aiStats[1], (ai->anomalyCount > 1) ? COLOR_WARNING : COLOR_SUCCESS, 0);
+    }
+    set_label_text(aiStats[2], statValues[2]);
+    set_label_text(aiStats[3], statValues[3]);
+    
+    for (int i = 0; i < 3; i++) update_insight_card(&aiInsights[i], &ai->insights[i]);
+    
+    update_ai_ota();
 }
 
 // ============ Remote View Screen ============
@@ -1965,11 +2454,11 @@ static void create_remote_screen(void) {
     rebuild_remote_content();
 }
 
-static void rebuild_remote_content(void) {
-    if (!remoteContent) return;
-    lv_obj_clean(remoteContent);
+// Built once; only the setup status can change
+static lv_obj_t* remoteSetupStatus = NULL;
+static int8_t remoteShownSetup = -1;
 
-    int contentWidth = DISPLAY_WIDTH - SIDEBAR_WIDTH - 28;
+static void create_remote_layout(int contentWidth) {
 
     lv_obj_t* title = lv_label_create(remoteContent);
     lv_label_set_text(title, "Remote View");
@@ -2038,21 +2527,28 @@ static void rebuild_remote_content(void) {
     lv_obj_set_width(hint, contentWidth - 280);
     lv_obj_set_pos(hint, 0, 78);
 
-    lv_obj_t* setupStatus = lv_label_create(infoCard);
+    remoteSetupStatus = lv_label_create(infoCard);
+    lv_obj_set_pos(remoteSetupStatus, 0, 140);
+    remoteShownSetup = -1;
+}
+
+static void rebuild_remote_content(void) {
+    if (!remoteContent) return;
+    if (!remoteSetupStatus) create_remote_layout(DISPLAY_WIDTH - SIDEBAR_WIDTH - 28);
+    if ((int8_t)uiState.setupCompleted == remoteShownSetup) return;
+
     if (uiState.setupCompleted) {
-        lv_label_set_text(setupStatus, "Setup complete");
-        lv_obj_set_style_text_color(setupStatus, COLOR_SUCCESS, 0);
+        lv_label_set_text(remoteSetupStatus, "Setup complete");
+        lv_obj_set_style_text_color(remoteSetupStatus, COLOR_SUCCESS, 0);
     } else {
-        lv_label_set_text(setupStatus, LV_SYMBOL_WARNING " Setup not completed yet");
-        lv_obj_set_style_text_color(setupStatus, COLOR_WARNING, 0);
+        lv_label_set_text(remoteSetupStatus, LV_SYMBOL_WARNING " Setup not completed yet");
+        lv_obj_set_style_text_color(remoteSetupStatus, COLOR_WARNING, 0);
     }
-    lv_obj_set_pos(setupStatus, 0, 140);
+    remoteShownSetup = (int8_t)uiState.setupCompleted;
 }
 
 static lv_obj_t* settingsContent = NULL;
 
-static void rebuild_settings_content(void);
-
 static void create_settings_screen(void) {
     screens[SCREEN_SETTINGS] = lv_obj_create(contentArea);
     lv_obj_set_style_bg_opa(screens[SCREEN_SETTINGS], LV_OPA_TRANSP, 0);
@@ -2071,12 +2567,17 @@ static void create_settings_screen(void) {
     rebuild_settings_content();
 }
 
-static void rebuild_settings_content(void) {
-    if (!settingsContent) return;
-    lv_obj_clean(settingsContent);
+// Built once per demo; the simulation rows and sensor values update in place
+static uint8_t settingsShownDemo = 0xFF;
+static uint8_t settingsShownScenario = 0xFF;
+static lv_obj_t* settingsScenario = NULL;
+static lv_obj_t* settingsCycle = NULL;
+static lv_obj_t* settingsAlarms = NULL;
+static lv_obj_t* settingsValues[3] = {NULL};
+static FmtCache_t settingsValueText[3];
 
-    int contentWidth = DISPLAY_WIDTH - SIDEBAR_WIDTH - 28;
-    DemoProfile_t* demo = getDemo();
+static void create_settings_layout(DemoProfile_t* demo, int contentWidth) {
+    lv_obj_clean(settingsContent);
     int halfWidth = (contentWidth - 10) / 2;
 
     lv_obj_t* title = lv_label_create(settingsContent);
@@ -2123,24 +2624,16 @@ static void rebuild_settings_content(void) {
     lv_obj_set_style_text_font(simTitle, &lv_font_montserrat_14, 0);
     lv_obj_set_pos(simTitle, 0, 0);
 
-    SimState_t* simState = sim_get_state();
     char simInfo[80];
 
-    snprintf(simInfo, sizeof(simInfo), "Scenario: %s", sim_get_scenario_name());
-    lv_obj_t* scenRow = lv_label_create(simCard);
-    lv_label_set_text(scenRow, simInfo);
-    ScenarioState_t scState = sim_get_scenario();
-    lv_obj_set_style_text_color(scenRow, (scState == SCENARIO_NORMAL) ? COLOR_SUCCESS :
-                                          (scState == SCENARIO_FAULT) ? COLOR_ERROR : COLOR_WARNING, 0);
-    lv_obj_set_pos(scenRow, 0, 25);
+    settingsScenario = lv_label_create(simCard);
+    lv_obj_set_pos(settingsScenario, 0, 25);
+    settingsShownScenario = 0xFF;
 
-    snprintf(simInfo, sizeof(simInfo), "Cycle: %d | Timer: %lus",
-             simState ? simState->cycleCount : 0,
-             simState ? simState->stateTimer : 0);
-    lv_obj_t* cycleRow = lv_label_create(simCard);
-    lv_label_set_text(cycleRow, simInfo);
-    lv_obj_set_style_text_color(cycleRow, COLOR_TEXT_MUTED, 0);
-    lv_obj_set_pos(cycleRow, 0, 47);
+    settingsCycle = lv_label_create(simCard);
+    lv_label_set_text(settingsCycle, "");
+    lv_obj_set_style_text_color(settingsCycle, COLOR_TEXT_MUTED, 0);
+    lv_obj_set_pos(settingsCycle, 0, 47);
 
     snprintf(simInfo, sizeof(simInfo), "Active Demo: %s", demo->name);
     lv_obj_t* demoRow = lv_label_create(simCard);
@@ -2148,11 +2641,10 @@ static void rebuild_settings_content(void) {
     lv_obj_set_style_text_color(demoRow, COLOR_TEXT_MUTED, 0);
     lv_obj_set_pos(demoRow, 0, 69);
 
-    snprintf(simInfo, sizeof(simInfo), "Dynamic Alarms: %d active", sim_get_alarm_count());
-    lv_obj_t* alarmRow = lv_label_create(simCard);
-    lv_label_set_text(alarmRow, simInfo);
-    lv_obj_set_style_text_color(alarmRow, COLOR_TEXT_MUTED, 0);
-    lv_obj_set_pos(alarmRow, 0, 91);
+    settingsAlarms = lv_label_create(simCard);
+    lv_label_set_text(settingsAlarms, "");
+    lv_obj_set_style_text_color(settingsAlarms, COLOR_TEXT_MUTED, 0);
+    lv_obj_set_pos(settingsAlarms, 0, 91);
 
     // ========== Sensor Config Card (full width) ==========
     lv_obj_t* sensorCard = lv_obj_create(settingsContent);
@@ -2196,20 +2688,21 @@ static void rebuild_settings_content(void) {
         lv_obj_set_style_text_color(sName, COLOR_TEXT_PRIMARY, 0);
         lv_obj_align(sName, LV_ALIGN_LEFT_MID, 18, -8);
 
-        char sInfo[80];
-        snprintf(sInfo, sizeof(sInfo), "%s | Range: %.0f - %.0f %s", s->type, s->min, s->max, s->unit);
+        char sInfo[80], minStr[16], maxStr[16];
+        fmt_fixed(minStr, sizeof(minStr), s->min, 0, NULL);
+        fmt_fixed(maxStr, sizeof(maxStr), s->max, 0, NULL);
+        snprintf(sInfo, sizeof(sInfo), "%s | Range: %s - %s %s", s->type, minStr, maxStr, s->unit);
         lv_obj_t* sInfoLabel = lv_label_create(row);
         lv_label_set_text(sInfoLabel, sInfo);
         lv_obj_set_style_text_color(sInfoLabel, COLOR_TEXT_DIM, 0);
         lv_obj_align(sInfoLabel, LV_ALIGN_LEFT_MID, 18, 8);
 
         // Current value
-        char valStr[32];
-        snprintf(valStr, sizeof(valStr), "%.*f %s", s->decimals, s->value, s->unit);
-        lv_obj_t* valLabel = lv_label_create(row);
-        lv_label_set_text(valLabel, valStr);
-        lv_obj_set_style_text_color(valLabel, lv_color_hex(s->color), 0);
-        lv_obj_align(valLabel, LV_ALIGN_RIGHT_MID, -30, 0);
+        settingsValues[i] = lv_label_create(row);
+        lv_label_set_text(settingsValues[i], "");
+        lv_obj_set_style_text_color(settingsValues[i], lv_color_hex(s->color), 0);
+        lv_obj_align(settingsValues[i], LV_ALIGN_RIGHT_MID, -30, 0);
+        fmt_cache_reset(&settingsValueText[i]);
 
         // Status dot
         lv_obj_t* dot = lv_obj_create(row);
@@ -2242,4 +2735,38 @@ static void rebuild_settings_content(void) {
     lv_obj_set_pos(aboutDesc, 0, 25);
     lv_label_set_long_mode(aboutDesc, LV_LABEL_LONG_WRAP);
     lv_obj_set_width(aboutDesc, contentWidth - 24);
+    settingsShownDemo = getDemoIndex();
+}
+
+static void rebuild_settings_content(void) {
+    if (!settingsContent) return;
+
+    DemoProfile_t* demo = getDemo();
+    if (getDemoIndex() != settingsShownDemo) {
+        create_settings_layout(demo, DISPLAY_WIDTH - SIDEBAR_WIDTH - 28);
+    }
+
+    ScenarioState_t scState = sim_get_scenario();
+    if (scState != settingsShownScenario) {
+        lv_label_set_text_fmt(settingsScenario, "Scenario: %s", sim_get_scenario_name());
+        lv_obj_set_style_text_color(settingsScenario, (scState == SCENARIO_NORMAL) ? COLOR_SUCCESS :
+                                    (scState == SCENARIO_FAULT) ? COLOR_ERROR : COLOR_WARNING, 0);
+        settingsShownScenario = (uint8_t)scState;
+    }
+
+    SimState_t* simState = sim_get_state();
+    char simInfo[80];
+    snprintf(simInfo, sizeof(simInfo), "Cycle: %d | Timer: %lus",
+             simState ? simState->cycleCount : 0,
+             simState ? simState->stateTimer : 0);
+    set_label_text(settingsCycle, simInfo);
+    snprintf(simInfo, sizeof(simInfo), "Dynamic Alarms: %d active", sim_get_alarm_count());
+    set_label_text(settingsAlarms, simInfo);
+
+    for (int i = 0; i < 3; i++) {
+        Sensor_t* s = &demo->sensors[i];
+        if (fmt_cache_update(&settingsValueText[i], s->value, s->decimals, s->unit)) {
+            lv_label_set_text(settingsValues[i], settingsValueText[i].text);
+        }
+    }
 }
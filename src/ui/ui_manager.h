@@ -44,6 +44,18 @@ void ui_update_sensors(void);
 
 #ifdef __cplusplus
 }
+
+#include "../../config.h"
+#if ENABLE_OTA
+#include "../ota/ota_update.h"
+// The OTA card drives this update instead of the simulated one
+void ui_set_ota(OtaUpdate_t* ota);
+#endif
+#if ENABLE_VISION
+#include "../vision/cam_preview.h"
+// Live camera picture in the Vision screen (call with the LVGL lock held)
+void ui_set_preview(CamPreview_t* preview);
+#endif
 #endif
 
 #endif // UI_MANAGER_H
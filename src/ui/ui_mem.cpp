@@ -0,0 +1,598 @@
+// SIGNALTAP LVGL Heap Implementation
+#include "ui_mem.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ARDUINO)
+#include <lvgl.h>
+#include "esp_heap_caps.h"
+#include "../../config.h"
+#endif
+
+// ============ TLSF ============
+// Free blocks sit in one list per size class: FL picks the power of two,
+// SL splits it into 16. A bitmap per level finds the first non-empty list
+// at least as large as the request in two bit scans.
+#define ALIGN_LOG2          3
+#define ALIGN               (1u << ALIGN_LOG2)
+#define SL_LOG2             4
+#define SL_COUNT            (1u << SL_LOG2)
+#define FL_SHIFT            (SL_LOG2 + ALIGN_LOG2)
+#define SMALL_BLOCK         (1u << FL_SHIFT)    // Below: one list per ALIGN bytes
+#define FL_MAX              26                  // Pools up to 64 MB
+#define FL_COUNT            (FL_MAX - FL_SHIFT + 1)
+
+#define BLOCK_FREE          1u
+#define BLOCK_PREV_FREE     2u
+#define BLOCK_FLAGS         (BLOCK_FREE | BLOCK_PREV_FREE)
+
+// Links are 32-bit offsets from the pool base, so a header is 8 bytes on
+// the device and on a 64-bit host alike
+typedef struct {
+    uint32_t prevPhys;
+    uint32_t size;              // Payload bytes | flags
+    uint32_t nextFree;          // Free blocks only: lives in the payload
+    uint32_t prevFree;
+} Block_t;
+
+#define HDR                 offsetof(Block_t, nextFree)
+#define MIN_PAYLOAD         (sizeof(Block_t) - HDR)
+#define NIL                 0xFFFFFFFFu
+
+typedef struct {
+    char* base;
+    size_t size;
+    uint32_t flBitmap;
+    uint32_t slBitmap[FL_COUNT];
+    uint32_t heads[FL_COUNT][SL_COUNT];
+    size_t used;
+    size_t usedMax;
+    uint32_t blocks;
+} Tlsf_t;
+
+static inline size_t block_size(const Block_t* b) {
+    return b->size & ~(uint32_t)BLOCK_FLAGS;
+}
+
+static inline void* block_payload(Block_t* b) {
+    return (char*)b + HDR;
+}
+
+static inline Block_t* block_from(void* p) {
+    return (Block_t*)((char*)p - HDR);
+}
+
+static inline Block_t* block_next(Block_t* b) {
+    return (Block_t*)((char*)b + HDR + block_size(b));
+}
+
+static inline Block_t* at(const Tlsf_t* t, uint32_t o) {
+    return o == NIL ? NULL : (Block_t*)(t->base + o);
+}
+
+static inline uint32_t off(const Tlsf_t* t, const Block_t* b) {
+    return (uint32_t)((const char*)b - t->base);
+}
+
+static inline int fls_size(size_t x) {
+    return (int)(sizeof(unsigned long) * 8 - 1 - __builtin_clzl((unsigned long)x));
+}
+
+static void mapping(size_t size, int* fl, int* sl) {
+    if (size < SMALL_BLOCK) {
+        *fl = 0;
+        *sl = (int)(size / (SMALL_BLOCK / SL_COUNT));
+    } else {
+        int f = fls_size(size);
+        *sl = (int)((size >> (f - SL_LOG2)) ^ SL_COUNT);
+        *fl = f - (FL_SHIFT - 1);
+    }
+}
+
+static void list_insert(Tlsf_t* t, Block_t* b) {
+    int fl, sl;
+    mapping(block_size(b), &fl, &sl);
+    Block_t* head = at(t, t->heads[fl][sl]);
+    b->nextFree = t->heads[fl][sl];
+    b->prevFree = NIL;
+    if (head) head->prevFree = off(t, b);
+    t->heads[fl][sl] = off(t, b);
+    t->flBitmap |= 1u << fl;
+    t->slBitmap[fl] |= 1u << sl;
+}
+
+static void list_remove(Tlsf_t* t, Block_t* b) {
+    int fl, sl;
+    mapping(block_size(b), &fl, &sl);
+    if (b->prevFree != NIL) at(t, b->prevFree)->nextFree = b->nextFree;
+    else t->heads[fl][sl] = b->nextFree;
+    if (b->nextFree != NIL) at(t, b->nextFree)->prevFree = b->prevFree;
+    if (t->heads[fl][sl] == NIL) {
+        t->slBitmap[fl] &= ~(1u << sl);
+        if (!t->slBitmap[fl]) t->flBitmap &= ~(1u << fl);
+    }
+}
+
+// First free block of a class that holds size whatever its position in it
+static Block_t* find_suitable(Tlsf_t* t, size_t size) {
+    if (size >= SMALL_BLOCK) size += ((size_t)1 << (fls_size(size) - SL_LOG2)) - 1;
+    int fl, sl;
+    mapping(size, &fl, &sl);
+    if (fl >= (int)FL_COUNT) return NULL;
+    uint32_t slMap = t->slBitmap[fl] & (~0u << sl);
+    if (!slMap) {
+        uint32_t flMap = fl + 1 < 32 ? t->flBitmap & (~0u << (fl + 1)) : 0;
+        if (!flMap) return NULL;
+        fl = __builtin_ctz(flMap);
+        slMap = t->slBitmap[fl];
+    }
+    return at(t, t->heads[fl][__builtin_ctz(slMap)]);
+}
+
+// Cuts b down to size and frees the rest, merged with a free neighbour
+static void trim(Tlsf_t* t, Block_t* b, size_t size) {
+    size_t have = block_size(b);
+    if (have < size + sizeof(Block_t)) return;
+    Block_t* rest = (Block_t*)((char*)block_payload(b) + size);
+    rest->prevPhys = off(t, b);
+    rest->size = (uint32_t)(have - size - HDR) | BLOCK_FREE;
+    b->size = (uint32_t)size | (b->size & BLOCK_FLAGS);
+    Block_t* next = block_next(rest);
+    if (next->size & BLOCK_FREE) {
+        list_remove(t, next);
+        rest->size += (uint32_t)(HDR + block_size(next));
+        next = block_next(rest);
+    }
+    next->prevPhys = off(t, rest);
+    next->size |= BLOCK_PREV_FREE;
+    list_insert(t, rest);
+}
+
+static inline size_t adjust(size_t size) {
+    if (size < MIN_PAYLOAD) size = MIN_PAYLOAD;
+    return (size + ALIGN - 1) & ~(size_t)(ALIGN - 1);
+}
+
+static bool tlsf_init(Tlsf_t* t, void* mem, size_t bytes) {
+    memset(t, 0, sizeof(*t));
+    memset(t->heads, 0xFF, sizeof(t->heads));
+    char* base = (char*)(((uintptr_t)mem + ALIGN - 1) & ~(uintptr_t)(ALIGN - 1));
+    bytes -= base - (char*)mem;
+    bytes &= ~(size_t)(ALIGN - 1);
+    if (bytes < 2 * HDR + sizeof(Block_t) || bytes >= ((size_t)1 << FL_MAX)) return false;
+    t->base = base;
+    t->size = bytes;
+
+    // One free block, then a used zero-size sentinel that never merges
+    Block_t* first = (Block_t*)base;
+    first->prevPhys = NIL;
+    first->size = (uint32_t)(bytes - 2 * HDR) | BLOCK_FREE;
+    Block_t* end = block_next(first);
+    end->prevPhys = 0;
+    end->size = BLOCK_PREV_FREE;
+    list_insert(t, first);
+    return true;
+}
+
+static void* tlsf_alloc(Tlsf_t* t, size_t request) {
+    if (!t->base || request > t->size) return NULL;
+    size_t size = adjust(request);
+    Block_t* b = find_suitable(t, size);
+    if (!b) return NULL;
+    list_remove(t, b);
+    b->size &= ~BLOCK_FREE;
+    block_next(b)->size &= ~BLOCK_PREV_FREE;
+    trim(t, b, size);
+
+    t->used += block_size(b);
+    if (t->used > t->usedMax) t->usedMax = t->used;
+    t->blocks++;
+    return block_payload(b);
+}
+
+static void tlsf_free(Tlsf_t* t, void* p) {
+    Block_t* b = block_from(p);
+    t->used -= block_size(b);
+    t->blocks--;
+
+    b->size |= BLOCK_FREE;
+    if (b->size & BLOCK_PREV_FREE) {
+        Block_t* prev = at(t, b->prevPhys);
+        list_remove(t, prev);
+        prev->size += (uint32_t)(HDR + block_size(b));
+        b = prev;
+    }
+    Block_t* next = block_next(b);
+    if (next->size & BLOCK_FREE) {
+        list_remove(t, next);
+        b->size += (uint32_t)(HDR + block_size(next));
+        next = block_next(b);
+    }
+    next->prevPhys = off(t, b);
+    next->size |= BLOCK_PREV_FREE;
+    list_insert(t, b);
+}
+
+// In place: shrinks, or grows into a free right-hand neighbour. False
+// when the block has to move.
+static bool tlsf_resize(Tlsf_t* t, void* p, size_t request) {
+    if (request > t->size) return false;
+    Block_t* b = block_from(p);
+    size_t size = adjust(request);
+    size_t have = block_size(b);
+    if (size > have) {
+        Block_t* next = block_next(b);
+        if (!(next->size & BLOCK_FREE) || have + HDR + block_size(next) < size) return false;
+        list_remove(t, next);
+        b->size += (uint32_t)(HDR + block_size(next));
+        Block_t* after = block_next(b);
+        after->prevPhys = off(t, b);
+        after->size &= ~BLOCK_PREV_FREE;
+    }
+    trim(t, b, size);
+    t->used += block_size(b) - have;
+    if (t->used > t->usedMax) t->usedMax = t->used;
+    return true;
+}
+
+static inline bool tlsf_owns(const Tlsf_t* t, const void* p) {
+    return t->base && (const char*)p >= t->base && (const char*)p < t->base + t->size;
+}
+
+static void tlsf_stats(const Tlsf_t* t, UiMemPoolStats_t* s) {
+    memset(s, 0, sizeof(*s));
+    if (!t->base) return;
+    s->size = t->size;
+    s->used = t->used;
+    s->usedMax = t->usedMax;
+    s->blocks = t->blocks;
+    for (int fl = 0; fl < (int)FL_COUNT; fl++) {
+        for (int sl = 0; sl < (int)SL_COUNT; sl++) {
+            for (Block_t* b = at(t, t->heads[fl][sl]); b; b = at(t, b->nextFree)) {
+                size_t n = block_size(b);
+                s->free += n;
+                if (n > s->largest) s->largest = n;
+            }
+        }
+    }
+    s->fragPct = s->free ? (uint8_t)(100 - s->largest * 100 / s->free) : 0;
+}
+
+static bool tlsf_check(const Tlsf_t* t) {
+    if (!t->base) return true;
+    size_t used = 0;
+    uint32_t blocks = 0, freeBlocks = 0;
+    Block_t* prev = NULL;
+    Block_t* b = (Block_t*)t->base;
+    const char* end = t->base + t->size - HDR;
+    for (;;) {
+        if ((const char*)b > end || b->prevPhys != (prev ? off(t, prev) : NIL)) return false;
+        bool prevFree = prev && (prev->size & BLOCK_FREE);
+        if (!!(b->size & BLOCK_PREV_FREE) != prevFree) return false;
+        if ((const char*)b == end) break;
+        if (b->size & BLOCK_FREE) {
+            if (prevFree) return false;     // Two free neighbours: a missed merge
+            freeBlocks++;
+        } else {
+            used += block_size(b);
+            blocks++;
+        }
+        prev = b;
+        b = block_next(b);
+    }
+    if (block_size(b) != 0 || (b->size & BLOCK_FREE)) return false;
+    if (used != t->used || blocks != t->blocks) return false;
+
+    // Every free block in the list of its class, and nothing else there
+    uint32_t listed = 0;
+    for (int fl = 0; fl < (int)FL_COUNT; fl++) {
+        for (int sl = 0; sl < (int)SL_COUNT; sl++) {
+            bool bit = (t->slBitmap[fl] >> sl) & 1;
+            if (bit != (t->heads[fl][sl] != NIL)) return false;
+            uint32_t before = NIL;
+            for (Block_t* f = at(t, t->heads[fl][sl]); f; f = at(t, f->nextFree)) {
+                int bfl, bsl;
+                mapping(block_size(f), &bfl, &bsl);
+                if (!(f->size & BLOCK_FREE) || f->prevFree != before || bfl != fl || bsl != sl) return false;
+                before = off(t, f);
+                listed++;
+            }
+        }
+        if (!!((t->flBitmap >> fl) & 1) != (t->slBitmap[fl] != 0)) return false;
+    }
+    return listed == freeBlocks;
+}
+
+// ============ State ============
+#define CLIB_HDR            8       // Size in front of each clib block; keeps 8-byte alignment
+
+static uint8_t backend = UI_MEM_CLIB;
+static Tlsf_t pool;
+static Tlsf_t arena;
+static void* poolMem = NULL;
+static void* arenaMem = NULL;
+static size_t largeMin = 0;
+static size_t clibUsed = 0;
+static size_t clibUsedMax = 0;
+static uint32_t clibBlocks = 0;
+
+static UiMemStats_t stats;
+static UiMemTick_t tick;
+static size_t tickUsed = 0;
+static uint32_t tickView = 0xFFFFFFFF;
+static uint32_t sameViewTicks = 0;
+static UiMemSteadyFn steadyFn = NULL;
+static void* steadyCtx = NULL;
+
+// ============ Helper: Accounting ============
+static size_t used_bytes(void) {
+    return backend == UI_MEM_TLSF ? pool.used + arena.used : clibUsed;
+}
+
+static void note_request(size_t size) {
+    stats.allocs++;
+    tick.allocs++;
+    tick.bytes += (uint32_t)size;
+    if (size > tick.largestRequest) tick.largestRequest = (uint32_t)size;
+}
+
+// ============ Helper: Backends ============
+static void* sys_alloc(size_t size, bool internal) {
+#if defined(ARDUINO)
+    return heap_caps_malloc(size, internal ? MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+                                           : MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+    (void)internal;
+    return malloc(size);
+#endif
+}
+
+static void sys_free(void* p) {
+#if defined(ARDUINO)
+    heap_caps_free(p);
+#else
+    free(p);
+#endif
+}
+
+static void* clib_alloc(size_t size) {
+    char* p = (char*)malloc(size + CLIB_HDR);
+    if (!p) return NULL;
+    *(size_t*)p = size;
+    clibUsed += size;
+    if (clibUsed > clibUsedMax) clibUsedMax = clibUsed;
+    clibBlocks++;
+    return p + CLIB_HDR;
+}
+
+static void* clib_realloc(void* p, size_t size) {
+    char* h = (char*)p - CLIB_HDR;
+    size_t old = *(size_t*)h;
+    char* n = (char*)realloc(h, size + CLIB_HDR);
+    if (!n) return NULL;
+    *(size_t*)n = size;
+    clibUsed += size - old;
+    if (clibUsed > clibUsedMax) clibUsedMax = clibUsed;
+    return n + CLIB_HDR;
+}
+
+static void clib_free(void* p) {
+    char* h = (char*)p - CLIB_HDR;
+    clibUsed -= *(size_t*)h;
+    clibBlocks--;
+    free(h);
+}
+
+// Its own pool first, then the other one
+static void* pools_alloc(size_t size) {
+    bool large = arena.base && size >= largeMin;
+    Tlsf_t* first = large ? &arena : &pool;
+    Tlsf_t* second = large ? &pool : &arena;
+    void* p = tlsf_alloc(first, size);
+    if (!p && (p = tlsf_alloc(second, size)) != NULL) stats.spills++;
+    return p;
+}
+
+static size_t pools_size_of(void* p) {
+    return block_size(block_from(p));
+}
+
+static void pools_free(void* p) {
+    tlsf_free(tlsf_owns(&arena, p) ? &arena : &pool, p);
+}
+
+// ============ Public API ============
+bool ui_mem_init(uint8_t which, size_t poolSize, size_t arenaSize, size_t large) {
+    ui_mem_deinit();
+    memset(&stats, 0, sizeof(stats));
+    memset(&tick, 0, sizeof(tick));
+    tickUsed = 0;
+    tickView = 0xFFFFFFFF;
+    sameViewTicks = 0;
+    backend = UI_MEM_CLIB;
+    stats.backend = UI_MEM_CLIB;
+    if (which != UI_MEM_TLSF) return true;
+
+    poolMem = sys_alloc(poolSize, true);
+    if (!poolMem || !tlsf_init(&pool, poolMem, poolSize)) {
+        ui_mem_deinit();
+        return false;
+    }
+    // No PSRAM: everything comes from the pool
+    if (arenaSize) {
+        arenaMem = sys_alloc(arenaSize, false);
+        if (arenaMem && !tlsf_init(&arena, arenaMem, arenaSize)) {
+            sys_free(arenaMem);
+            arenaMem = NULL;
+        }
+    }
+    largeMin = large;
+    backend = UI_MEM_TLSF;
+    stats.backend = UI_MEM_TLSF;
+    return true;
+}
+
+void ui_mem_deinit(void) {
+    if (poolMem) sys_free(poolMem);
+    if (arenaMem) sys_free(arenaMem);
+    poolMem = arenaMem = NULL;
+    memset(&pool, 0, sizeof(pool));
+    memset(&arena, 0, sizeof(arena));
+    clibUsed = clibUsedMax = 0;
+    clibBlocks = 0;
+    backend = UI_MEM_CLIB;
+}
+
+void* ui_mem_alloc(size_t size) {
+    note_request(size);
+    void* p = backend == UI_MEM_TLSF ? pools_alloc(size) : clib_alloc(size);
+    if (!p) stats.failures++;
+    return p;
+}
+
+void* ui_mem_realloc(void* p, size_t size) {
+    if (!p) return ui_mem_alloc(size);
+    if (size == 0) {
+        ui_mem_free(p);
+        return NULL;
+    }
+    if (backend != UI_MEM_TLSF) {
+        note_request(size);
+        void* n = clib_realloc(p, size);
+        if (!n) stats.failures++;
+        return n;
+    }
+    note_request(size);
+    if (tlsf_resize(tlsf_owns(&arena, p) ? &arena : &pool, p, size)) return p;
+    void* n = pools_alloc(size);
+    if (!n) {
+        stats.failures++;
+        return NULL;
+    }
+    size_t old = pools_size_of(p);
+    memcpy(n, p, old < size ? old : size);
+    pools_free(p);
+    return n;
+}
+
+void ui_mem_free(void* p) {
+    if (!p) return;
+    stats.frees++;
+    if (backend == UI_MEM_TLSF) pools_free(p);
+    else clib_free(p);
+}
+
+void ui_mem_tick(uint32_t view) {
+    size_t used = used_bytes();
+    tick.netBytes = (int32_t)(used - tickUsed);
+    tickUsed = used;
+
+    if (stats.ticks > 0) {
+        stats.tickAllocs = tick.allocs;
+        stats.tickNetBytes = tick.netBytes;
+        if (tick.allocs > stats.maxTickAllocs) stats.maxTickAllocs = tick.allocs;
+        stats.avgTickAllocs = (stats.ticks == 1) ? tick.allocs
+                                                 : 0.95f * stats.avgTickAllocs + 0.05f * tick.allocs;
+        // The view has to have been up for the whole interval, and still be:
+        // a demo or screen change lands in the interval that closes with it
+        if (view == tickView && sameViewTicks >= UI_MEM_STEADY_TICKS) {
+            stats.steadyTicks++;
+            if (tick.allocs > UI_MEM_STEADY_ALLOCS) {
+                stats.steadyOverTicks++;
+                if (steadyFn) steadyFn(&tick, steadyCtx);
+            }
+        }
+    }
+    sameViewTicks = (view == tickView) ? sameViewTicks + 1 : 0;
+    tickView = view;
+
+    uint32_t next = ++stats.ticks;
+    memset(&tick, 0, sizeof(tick));
+    tick.tick = next;
+}
+
+void ui_mem_set_steady_hook(UiMemSteadyFn fn, void* ctx) {
+    steadyFn = fn;
+    steadyCtx = ctx;
+}
+
+bool ui_mem_check(void) {
+    if (backend != UI_MEM_TLSF) return true;
+    return tlsf_check(&pool) && tlsf_check(&arena);
+}
+
+const UiMemStats_t* ui_mem_get_stats(void) {
+    if (backend == UI_MEM_TLSF) {
+        tlsf_stats(&pool, &stats.pool);
+        tlsf_stats(&arena, &stats.arena);
+        return &stats;
+    }
+    memset(&stats.pool, 0, sizeof(stats.pool));
+    memset(&stats.arena, 0, sizeof(stats.arena));
+    stats.pool.used = clibUsed;
+    stats.pool.usedMax = clibUsedMax;
+    stats.pool.blocks = clibBlocks;
+#if defined(ARDUINO)
+    stats.pool.free = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    stats.pool.largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    stats.pool.size = stats.pool.used + stats.pool.free;
+    stats.pool.fragPct = stats.pool.free ? (uint8_t)(100 - stats.pool.largest * 100 / stats.pool.free) : 0;
+#endif
+    return &stats;
+}
+
+// ============ LVGL Hooks ============
+// The functions LVGL leaves to LV_STDLIB_CUSTOM
+#if defined(ARDUINO) && LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+void lv_mem_init(void) {
+    if (!ui_mem_init(UI_MEM_BACKEND, UI_MEM_POOL_SIZE, UI_MEM_ARENA_SIZE, UI_MEM_LARGE_MIN)) {
+        ui_mem_init(UI_MEM_CLIB, 0, 0, 0);
+    }
+}
+
+void lv_mem_deinit(void) {
+    ui_mem_deinit();
+}
+
+lv_mem_pool_t lv_mem_add_pool(void* mem, size_t bytes) {
+    LV_UNUSED(mem);
+    LV_UNUSED(bytes);
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool) {
+    LV_UNUSED(pool);
+}
+
+void* lv_malloc_core(size_t size) {
+    return ui_mem_alloc(size);
+}
+
+void* lv_realloc_core(void* p, size_t new_size) {
+    return ui_mem_realloc(p, new_size);
+}
+
+void lv_free_core(void* p) {
+    ui_mem_free(p);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t* mon_p) {
+    const UiMemStats_t* s = ui_mem_get_stats();
+    size_t total = s->pool.size + s->arena.size;
+    size_t used = s->pool.used + s->arena.used;
+    size_t freeBytes = s->pool.free + s->arena.free;
+    size_t largest = s->pool.largest > s->arena.largest ? s->pool.largest : s->arena.largest;
+    mon_p->total_size = total;
+    mon_p->free_size = freeBytes;
+    mon_p->free_biggest_size = largest;
+    mon_p->used_cnt = s->pool.blocks + s->arena.blocks;
+    mon_p->max_used = s->pool.usedMax + s->arena.usedMax;
+    mon_p->used_pct = total ? (uint8_t)(used * 100 / total) : 0;
+    mon_p->frag_pct = freeBytes ? (uint8_t)(100 - largest * 100 / freeBytes) : 0;
+}
+
+lv_result_t lv_mem_test_core(void) {
+    return ui_mem_check() ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+#endif
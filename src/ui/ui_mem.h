@@ -0,0 +1,90 @@
+// SIGNALTAP LVGL Heap
+// LVGL's lv_malloc / lv_realloc / lv_free land here (lv_conf.h sets
+// LV_STDLIB_CUSTOM). Two backends:
+//  - UI_MEM_CLIB: the system heap, as LVGL's own clib wrapper, but counted
+//  - UI_MEM_TLSF: a two-level segregated fit pool in internal SRAM for the
+//    small blocks (objects, styles, label text, draw tasks) and a second
+//    one in PSRAM for the large ones (layer buffers); O(1) alloc and free,
+//    neighbours merged on free. A request that does not fit its own pool
+//    spills into the other one.
+//
+// Accounting is per refresh: ui_refresh() calls ui_mem_tick() once a
+// second, which closes the last interval's counts (allocations, bytes,
+// net growth). A refresh with the same screen and demo as the last
+// UI_MEM_STEADY_TICKS is steady. A steady refresh still allocates a little
+// (label text that changed length, draw tasks for what it redrew); the
+// steady hook, when set, hears about every one that allocated more than
+// UI_MEM_STEADY_ALLOCS, which is a screen being rebuilt rather than updated.
+//
+// LVGL only allocates from its own task or under lvgl_port_lock(), so the
+// heap takes no lock of its own; call ui_mem_get_stats() under the lock.
+#ifndef UI_MEM_H
+#define UI_MEM_H
+
+#include <Arduino.h>
+
+#define UI_MEM_CLIB         0
+#define UI_MEM_TLSF         1
+
+#define UI_MEM_STEADY_TICKS 3       // Refreshes on one view before it counts as steady
+#define UI_MEM_STEADY_ALLOCS 256    // Allocations a steady refresh may make
+
+typedef struct {
+    size_t size;            // Bytes under management (0: not in use / unknown)
+    size_t used;            // In allocated blocks
+    size_t free;
+    size_t largest;         // Largest block that can be handed out
+    size_t usedMax;
+    uint32_t blocks;        // Allocated
+    uint8_t fragPct;        // 100 - largest / free
+} UiMemPoolStats_t;
+
+typedef struct {
+    uint8_t backend;
+    uint32_t allocs;        // malloc and realloc calls
+    uint32_t frees;
+    uint32_t failures;      // NULL returned
+    uint32_t spills;        // Served from the other pool
+    uint32_t ticks;         // Refreshes seen
+    uint32_t tickAllocs;    // Last refresh
+    uint32_t maxTickAllocs;
+    float avgTickAllocs;
+    int32_t tickNetBytes;   // Last refresh's growth in used bytes
+    uint32_t steadyTicks;
+    uint32_t steadyOverTicks; // Steady refreshes over UI_MEM_STEADY_ALLOCS
+    UiMemPoolStats_t pool;  // TLSF: internal SRAM pool; clib: the system heap
+    UiMemPoolStats_t arena; // TLSF: PSRAM pool for large blocks
+} UiMemStats_t;
+
+typedef struct {
+    uint32_t tick;
+    uint32_t allocs;
+    uint32_t bytes;         // Requested
+    int32_t netBytes;
+    uint32_t largestRequest;
+} UiMemTick_t;
+
+typedef void (*UiMemSteadyFn)(const UiMemTick_t* tick, void* ctx);
+
+// ============ Public API ============
+
+// TLSF: poolSize bytes of internal RAM, arenaSize of PSRAM (0 for none),
+// requests of largeMin bytes and up go to the arena first. False when the
+// pool cannot be had; the clib backend always starts.
+bool ui_mem_init(uint8_t backend, size_t poolSize, size_t arenaSize, size_t largeMin);
+void ui_mem_deinit(void);
+
+void* ui_mem_alloc(size_t size);
+void* ui_mem_realloc(void* p, size_t size);
+void ui_mem_free(void* p);
+
+// Once per refresh; view identifies what is on screen (screen, demo)
+void ui_mem_tick(uint32_t view);
+void ui_mem_set_steady_hook(UiMemSteadyFn fn, void* ctx);
+
+// Walks both pools block by block: links, flags, counts. True when sound.
+bool ui_mem_check(void);
+
+const UiMemStats_t* ui_mem_get_stats(void);
+
+#endif // UI_MEM_H
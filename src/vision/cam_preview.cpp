@@ -0,0 +1,153 @@
+// SIGNALTAP Camera Preview Implementation
+#include "cam_preview.h"
+#include <string.h>
+
+#if defined(ARDUINO)
+#include "driver/ppa.h"
+#include "esp_heap_caps.h"
+#include "esp_private/esp_cache_private.h"
+#endif
+
+#define LOAD_ACQ(x)         __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_REL(x, v)     __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+
+#define ALIGN_UP(n, a)      (((n) + (a) - 1) / (a) * (a))
+
+#if defined(ARDUINO)
+// ============ Helper: PPA ============
+static bool convert_init(CamPreview_t* p) {
+    ppa_client_config_t cfg = {};
+    cfg.oper_type = PPA_OPERATION_SRM;
+    ppa_client_handle_t client = NULL;
+    if (ppa_register_client(&cfg, &client) != ESP_OK) return false;
+    p->ppa = client;
+
+    // The PPA writes by DMA: buffers on cache lines, sizes in whole lines
+    size_t line = 0;
+    esp_cache_get_alignment(MALLOC_CAP_DMA | MALLOC_CAP_SPIRAM, &line);
+    if (line == 0) line = 64;
+    p->bufSize = ALIGN_UP((uint32_t)p->width * p->height * 2, (uint32_t)line);
+    for (int i = 0; i < 2; i++) {
+        p->buf[i] = (uint16_t*)heap_caps_aligned_calloc(line, 1, p->bufSize,
+                                                       MALLOC_CAP_DMA | MALLOC_CAP_SPIRAM);
+        if (!p->buf[i]) return false;
+    }
+    return true;
+}
+
+// Scale + YUYV -> RGB565 in one pass; the driver keeps the caches right
+// for the CPU that reads the output
+static bool convert(CamPreview_t* p, const uint8_t* frame, uint16_t width, uint16_t height,
+                    uint32_t stride) {
+    ppa_srm_oper_config_t op = {};
+    op.in.buffer = frame;
+    op.in.pic_w = stride / 2;
+    op.in.pic_h = height;
+    op.in.block_w = width;
+    op.in.block_h = height;
+    op.in.srm_cm = PPA_SRM_COLOR_MODE_YUV422;
+    op.in.yuv_std = PPA_COLOR_CONV_STD_RGB_YUV_BT601;
+    op.out.buffer = p->buf[p->back];
+    op.out.buffer_size = p->bufSize;
+    op.out.pic_w = p->width;
+    op.out.pic_h = p->height;
+    op.out.srm_cm = PPA_SRM_COLOR_MODE_RGB565;
+    op.rotation_angle = PPA_SRM_ROTATION_ANGLE_0;
+    op.scale_x = (float)p->width / width;
+    op.scale_y = (float)p->height / height;
+    op.mode = PPA_TRANS_MODE_BLOCKING;
+    return ppa_do_scale_rotate_mirror((ppa_client_handle_t)p->ppa, &op) == ESP_OK;
+}
+#else
+// ============ Helper: Software scaler ============
+static bool convert_init(CamPreview_t* p) {
+    p->bufSize = (uint32_t)p->width * p->height * 2;
+    for (int i = 0; i < 2; i++) {
+        p->buf[i] = (uint16_t*)calloc(1, p->bufSize);
+        if (!p->buf[i]) return false;
+    }
+    return true;
+}
+
+static inline uint8_t clamp8(int v) {
+    return (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+// BT.601 full range, as the camera's ISP outputs it
+static inline uint16_t to_rgb565(int y, int u, int v) {
+    int d = u - 128, e = v - 128;
+    uint8_t r = clamp8(y + ((359 * e) >> 8));
+    uint8_t g = clamp8(y - ((88 * d + 183 * e) >> 8));
+    uint8_t b = clamp8(y + ((454 * d) >> 8));
+    return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+// Nearest pixel: the centre of each output pixel's footprint
+static bool convert(CamPreview_t* p, const uint8_t* frame, uint16_t width, uint16_t height,
+                    uint32_t stride) {
+    uint16_t* out = p->buf[p->back];
+    for (uint16_t y = 0; y < p->height; y++) {
+        const uint8_t* line = frame + (uint32_t)((2 * y + 1) * height / (2 * p->height)) * stride;
+        for (uint16_t x = 0; x < p->width; x++) {
+            uint32_t sx = (uint32_t)(2 * x + 1) * width / (2 * p->width);
+            const uint8_t* pair = line + (sx & ~1u) * 2;
+            *out++ = to_rgb565(pair[(sx & 1) * 2], pair[1], pair[3]);
+        }
+    }
+    return true;
+}
+#endif
+
+// ============ Public API ============
+bool preview_init(CamPreview_t* p, uint16_t width, uint16_t height, uint8_t fps) {
+    memset(p, 0, sizeof(*p));
+    p->width = width;
+    p->height = height;
+    p->intervalMs = 1000 / (fps ? fps : 1);
+    return convert_init(p);
+}
+
+bool preview_push(CamPreview_t* p, const uint8_t* frame, uint16_t width, uint16_t height,
+                  uint32_t stride, uint32_t nowMs) {
+    if (!p->buf[0] || !p->buf[1]) return false;
+    if (p->stats.frames && nowMs - p->lastMs < p->intervalMs) return false;
+    if (LOAD_ACQ(p->ready)) {
+        p->stats.skipped++;
+        return false;
+    }
+    // Next one due an interval after this one was, so pacing doesn't drift
+    // by a camera frame each time
+    p->lastMs = (p->stats.frames && nowMs - p->lastMs < 2 * p->intervalMs) ? p->lastMs + p->intervalMs : nowMs;
+
+    uint32_t t0 = micros();
+    if (!convert(p, frame, width, height, stride)) return false;
+    STORE_REL(p->ready, (uint8_t)1);
+
+    PreviewStats_t* ps = &p->stats;
+    uint32_t us = micros() - t0;
+    float load = us * 100.0f / (p->intervalMs * 1000.0f);
+    ps->lastUs = us;
+    if (us > ps->maxUs) ps->maxUs = us;
+    ps->avgUs = (ps->frames == 0) ? us : 0.95f * ps->avgUs + 0.05f * us;
+    ps->loadPct = (ps->frames == 0) ? load : 0.95f * ps->loadPct + 0.05f * load;
+    ps->frames++;
+    return true;
+}
+
+const uint16_t* preview_take(CamPreview_t* p) {
+    if (!LOAD_ACQ(p->ready)) return NULL;
+    uint8_t b = p->back;
+    // The camera side reads back only after it sees ready clear
+    p->back = (uint8_t)(b ^ 1);
+    STORE_REL(p->ready, (uint8_t)0);
+    p->stats.shown++;
+    return p->buf[b];
+}
+
+const uint16_t* preview_front(const CamPreview_t* p) {
+    return p->buf[p->back ^ 1];
+}
+
+const PreviewStats_t* preview_get_stats(const CamPreview_t* p) {
+    return &p->stats;
+}
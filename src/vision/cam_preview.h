@@ -0,0 +1,69 @@
+// SIGNALTAP Camera Preview
+// The live picture on the Vision screen. The vision task hands each frame
+// to preview_push() while it still sits in the camera driver's buffer; when
+// a preview frame is due, the PPA scales it and converts YUYV to RGB565
+// straight into one of two buffers that back the screen's lv_image (on the
+// host, a plain C loop does the same). The UI side, an LVGL timer, takes
+// the newest finished buffer with preview_take(), points the image at it
+// and invalidates just the image area.
+//
+// The two sides only meet at the ready flag: the camera side converts
+// into the back buffer only once the UI took the last one, and the UI
+// swaps only when there is a new one. A UI that is busy or on another
+// screen costs the camera side nothing (frames are skipped, not queued),
+// and a slow camera leaves the last picture up without redraws.
+#ifndef CAM_PREVIEW_H
+#define CAM_PREVIEW_H
+
+#include <Arduino.h>
+
+// 1280x720 / 8: the PPA scales in 1/16 steps, so this is exact
+#define PREVIEW_WIDTH       160
+#define PREVIEW_HEIGHT      90
+#define PREVIEW_FPS         15
+
+typedef struct {
+    uint32_t frames;        // Converted
+    uint32_t skipped;       // Due, but the UI had not taken the last one
+    uint32_t shown;         // Taken by the UI
+    uint32_t lastUs;        // Conversion, on the camera side
+    uint32_t maxUs;
+    float avgUs;
+    float loadPct;          // EWMA of conversion time / preview interval
+} PreviewStats_t;
+
+typedef struct {
+    uint16_t* buf[2];       // RGB565, width x height
+    uint32_t bufSize;
+    uint16_t width;
+    uint16_t height;
+    uint32_t intervalMs;
+    uint32_t lastMs;
+    volatile uint8_t back;  // The camera side converts into buf[back]
+    volatile uint8_t ready; // buf[back] holds a frame the UI has not taken
+    void* ppa;              // Device: PPA client
+    PreviewStats_t stats;
+} CamPreview_t;
+
+// ============ Public API ============
+
+// Two zeroed (black) buffers of width x height RGB565
+bool preview_init(CamPreview_t* p, uint16_t width, uint16_t height, uint8_t fps);
+
+// Camera side: a YUYV frame; converted when a preview frame is due and
+// the UI has taken the last one. True when it was.
+bool preview_push(CamPreview_t* p, const uint8_t* frame, uint16_t width, uint16_t height,
+                  uint32_t stride, uint32_t nowMs);
+
+// UI side: the buffer holding the newest frame, NULL when there is none
+// since the last call. It stays untouched until the next call returns
+// another one; the one shown before it may be overwritten from then on.
+const uint16_t* preview_take(CamPreview_t* p);
+
+// UI side: the buffer last taken (black before the first), for an image
+// created after it
+const uint16_t* preview_front(const CamPreview_t* p);
+
+const PreviewStats_t* preview_get_stats(const CamPreview_t* p);
+
+#endif // CAM_PREVIEW_H
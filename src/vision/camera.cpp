@@ -0,0 +1,266 @@
+// SIGNALTAP Camera Implementation
+#include "camera.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if defined(ARDUINO)
+#include "esp_video_init.h"
+#include "esp_video_device.h"
+#include "linux/videodev2.h"
+#include "../../config.h"
+#define CAMERA_DEFAULT_DEV  ESP_VIDEO_MIPI_CSI_DEVICE_NAME
+#else
+#include <linux/videodev2.h>
+#define CAMERA_DEFAULT_DEV  "/dev/video0"
+#endif
+
+// ============ Helper: Board camera ============
+#if defined(ARDUINO)
+// Sensor control bus and the CSI receiver + ISP, once
+static bool board_init(void) {
+    static bool ready = false;
+    if (ready) return true;
+    static const esp_video_init_csi_config_t csi = {
+        .sccb_config = {
+            .init_sccb = true,
+            .i2c_config = {
+                .port = CAMERA_SCCB_PORT,
+                .scl_pin = CAMERA_SCCB_SCL,
+                .sda_pin = CAMERA_SCCB_SDA,
+            },
+            .freq = 100000,
+        },
+        .reset_pin = CAMERA_RESET_PIN,
+        .pwdn_pin = CAMERA_PWDN_PIN,
+    };
+    esp_video_init_config_t cfg = {};
+    cfg.csi = &csi;
+    ready = esp_video_init(&cfg) == ESP_OK;
+    return ready;
+}
+#else
+static bool board_init(void) {
+    return true;
+}
+#endif
+
+// ============ Helper: Clip file ============
+#if !defined(ARDUINO)
+static bool clip_open(Camera_t* c, const char* path, uint16_t width, uint16_t height, uint8_t fps) {
+    c->fd = open(path, O_RDONLY);
+    if (c->fd < 0) return false;
+    struct stat st;
+    size_t frameLen = (size_t)width * 2 * height;
+    if (fstat(c->fd, &st) != 0 || frameLen == 0 || (size_t)st.st_size < frameLen) {
+        camera_close(c);
+        return false;
+    }
+    void* p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, c->fd, 0);
+    if (p == MAP_FAILED) {
+        camera_close(c);
+        return false;
+    }
+    c->clip = (const uint8_t*)p;
+    c->clipLen = (size_t)st.st_size;
+    c->clipFrames = (uint32_t)(c->clipLen / frameLen);
+    c->width = width;
+    c->height = height;
+    c->stride = (uint32_t)width * 2;
+    c->intervalUs = 1000000 / (fps ? fps : 1);
+    c->nextUs = micros();
+    return true;
+}
+
+// Like the device: waits for the next frame, and a late reader gets the
+// newest one with the skipped ones counted as dropped
+static const uint8_t* clip_grab(Camera_t* c, uint32_t timeoutMs) {
+    int32_t wait = (int32_t)(c->nextUs - (uint32_t)micros());
+    if (wait > (int32_t)(timeoutMs * 1000)) {
+        usleep(timeoutMs * 1000);
+        c->stats.timeouts++;
+        return NULL;
+    }
+    if (wait > 0) usleep((useconds_t)wait);
+    uint32_t late = wait < 0 ? (uint32_t)-wait / c->intervalUs : 0;
+    if (c->stats.frames) {
+        c->stats.dropped += late;
+        c->sequence += late + 1;
+    }
+    c->nextUs += (late + 1) * c->intervalUs;
+    c->held = 0;
+    c->stats.frames++;
+    c->frameMs = millis();
+    return c->clip + (size_t)(c->sequence % c->clipFrames) * c->stride * c->height;
+}
+#endif
+
+// ============ Helper: Give a buffer back to the driver ============
+static bool queue(Camera_t* c, int index) {
+    struct v4l2_buffer b;
+    memset(&b, 0, sizeof(b));
+    b.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    b.memory = V4L2_MEMORY_MMAP;
+    b.index = index;
+    return ioctl(c->fd, VIDIOC_QBUF, &b) == 0;
+}
+
+// ============ Public API ============
+bool camera_open(Camera_t* c, const char* dev, uint16_t width, uint16_t height, uint8_t fps) {
+    memset(c, 0, sizeof(*c));
+    c->fd = -1;
+    c->held = -1;
+    if (!board_init()) return false;
+
+#if !defined(ARDUINO)
+    struct stat st;
+    if (dev && stat(dev, &st) == 0 && S_ISREG(st.st_mode)) {
+        return clip_open(c, dev, width, height, fps);
+    }
+#endif
+    c->fd = open(dev ? dev : CAMERA_DEFAULT_DEV, O_RDWR | O_NONBLOCK);
+    if (c->fd < 0) return false;
+
+    struct v4l2_format fmt;
+    memset(&fmt, 0, sizeof(fmt));
+    fmt.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    fmt.fmt.pix.width = width;
+    fmt.fmt.pix.height = height;
+    fmt.fmt.pix.pixelformat = V4L2_PIX_FMT_YUYV;
+    fmt.fmt.pix.field = V4L2_FIELD_NONE;
+    if (ioctl(c->fd, VIDIOC_S_FMT, &fmt) != 0 || fmt.fmt.pix.pixelformat != V4L2_PIX_FMT_YUYV) {
+        camera_close(c);
+        return false;
+    }
+    c->width = (uint16_t)fmt.fmt.pix.width;
+    c->height = (uint16_t)fmt.fmt.pix.height;
+    c->stride = fmt.fmt.pix.bytesperline ? fmt.fmt.pix.bytesperline : (uint32_t)c->width * 2;
+
+    // Frame rate is a request; not every sensor driver takes it
+    struct v4l2_streamparm parm;
+    memset(&parm, 0, sizeof(parm));
+    parm.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    parm.parm.capture.timeperframe.numerator = 1;
+    parm.parm.capture.timeperframe.denominator = fps;
+    ioctl(c->fd, VIDIOC_S_PARM, &parm);
+
+    struct v4l2_requestbuffers req;
+    memset(&req, 0, sizeof(req));
+    req.count = CAMERA_BUFFERS;
+    req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    req.memory = V4L2_MEMORY_MMAP;
+    if (ioctl(c->fd, VIDIOC_REQBUFS, &req) != 0 || req.count < 2) {
+        camera_close(c);
+        return false;
+    }
+    c->count = req.count < CAMERA_BUFFERS ? (uint8_t)req.count : CAMERA_BUFFERS;
+
+    for (uint8_t i = 0; i < c->count; i++) {
+        struct v4l2_buffer b;
+        memset(&b, 0, sizeof(b));
+        b.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        b.memory = V4L2_MEMORY_MMAP;
+        b.index = i;
+        if (ioctl(c->fd, VIDIOC_QUERYBUF, &b) != 0) {
+            camera_close(c);
+            return false;
+        }
+        void* p = mmap(NULL, b.length, PROT_READ | PROT_WRITE, MAP_SHARED, c->fd, b.m.offset);
+        if (p == MAP_FAILED) {
+            camera_close(c);
+            return false;
+        }
+        c->buf[i] = (uint8_t*)p;
+        c->len[i] = b.length;
+        if (!queue(c, i)) {
+            camera_close(c);
+            return false;
+        }
+    }
+
+    int type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    if (ioctl(c->fd, VIDIOC_STREAMON, &type) != 0) {
+        camera_close(c);
+        return false;
+    }
+    return true;
+}
+
+const uint8_t* camera_grab(Camera_t* c, uint32_t timeoutMs) {
+    if (c->fd < 0) return NULL;
+    if (c->held >= 0) camera_release(c);
+#if !defined(ARDUINO)
+    if (c->clip) return clip_grab(c, timeoutMs);
+#endif
+
+    struct pollfd pfd = {c->fd, POLLIN, 0};
+    int ready = poll(&pfd, 1, (int)timeoutMs);
+    if (ready <= 0) {
+        if (ready == 0) c->stats.timeouts++;
+        else c->stats.errors++;
+        return NULL;
+    }
+
+    // Everything that is done, keeping only the newest: a late reader
+    // skips frames instead of falling further behind
+    struct v4l2_buffer b;
+    for (;;) {
+        memset(&b, 0, sizeof(b));
+        b.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        b.memory = V4L2_MEMORY_MMAP;
+        if (ioctl(c->fd, VIDIOC_DQBUF, &b) != 0) {
+            if (errno != EAGAIN) c->stats.errors++;
+            break;
+        }
+        if (c->held >= 0) queue(c, c->held);
+        if (c->stats.frames && b.sequence > c->sequence + 1) {
+            c->stats.dropped += b.sequence - c->sequence - 1;
+        }
+        c->sequence = b.sequence;
+        c->held = (int8_t)b.index;
+        c->stats.frames++;
+    }
+    if (c->held < 0) return NULL;
+    c->frameMs = millis();
+    return c->buf[c->held];
+}
+
+void camera_release(Camera_t* c) {
+    if (c->held < 0) return;
+    if (c->clip) {
+        c->held = -1;
+        return;
+    }
+    if (!queue(c, c->held)) c->stats.errors++;
+    c->held = -1;
+}
+
+void camera_close(Camera_t* c) {
+    if (c->fd < 0) return;
+    if (c->clip) {
+        munmap((void*)c->clip, c->clipLen);
+        c->clip = NULL;
+        close(c->fd);
+        c->fd = -1;
+        c->held = -1;
+        return;
+    }
+    int type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    ioctl(c->fd, VIDIOC_STREAMOFF, &type);
+    for (uint8_t i = 0; i < CAMERA_BUFFERS; i++) {
+        if (c->buf[i]) munmap(c->buf[i], c->len[i]);
+        c->buf[i] = NULL;
+    }
+    close(c->fd);
+    c->fd = -1;
+    c->held = -1;
+}
+
+const CameraStats_t* camera_get_stats(const Camera_t* c) {
+    return &c->stats;
+}
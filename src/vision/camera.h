@@ -0,0 +1,63 @@
+// SIGNALTAP Camera
+// YUYV frame capture through V4L2: on the ESP32-P4 the esp_video driver's
+// MIPI-CSI device (sensor -> ISP -> YUYV into PSRAM by DMA), on a Linux
+// host any /dev/videoN that delivers YUYV. Frames stay in the driver's
+// buffers: camera_grab() lends the newest one out and camera_release()
+// queues it again, so a frame is never copied. While one is being read
+// the sensor keeps filling the other CAMERA_BUFFERS - 1.
+//
+// On the host a regular file works as the device too: a clip of raw YUYV
+// frames of the requested size, mapped once and lent out in place at the
+// requested rate, looping.
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include <Arduino.h>
+
+#define CAMERA_BUFFERS      3
+
+typedef struct {
+    uint32_t frames;        // Grabbed
+    uint32_t dropped;       // Sequence gaps: frames the reader was too slow for
+    uint32_t timeouts;
+    uint32_t errors;
+} CameraStats_t;
+
+typedef struct {
+    int fd;
+    uint8_t* buf[CAMERA_BUFFERS];
+    uint32_t len[CAMERA_BUFFERS];
+    uint8_t count;          // Buffers the driver gave
+    int8_t held;            // Lent out by camera_grab(), -1 for none
+    uint16_t width;
+    uint16_t height;
+    uint32_t stride;        // Bytes per line
+    uint32_t sequence;      // Of the last frame grabbed
+    uint32_t frameMs;       // millis() when it was grabbed
+
+    // Host clip file (clip != NULL): frames back to back
+    const uint8_t* clip;
+    size_t clipLen;
+    uint32_t clipFrames;
+    uint32_t intervalUs;
+    uint32_t nextUs;        // micros() the next frame is due
+
+    CameraStats_t stats;
+} Camera_t;
+
+// ============ Public API ============
+
+// dev NULL for the board camera (device) or /dev/video0 (host), or on the
+// host a clip file. The driver may settle on another size: see c->width,
+// c->height after.
+bool camera_open(Camera_t* c, const char* dev, uint16_t width, uint16_t height, uint8_t fps);
+
+// Next frame, or NULL after timeoutMs. Valid until camera_release().
+const uint8_t* camera_grab(Camera_t* c, uint32_t timeoutMs);
+void camera_release(Camera_t* c);
+
+void camera_close(Camera_t* c);
+
+const CameraStats_t* camera_get_stats(const Camera_t* c);
+
+#endif // CAMERA_H
@@ -0,0 +1,204 @@
+// SIGNALTAP ROI Vision Engine Implementation
+#include "roi_engine.h"
+#include <math.h>
+#include <string.h>
+
+#define LOAD_ACQ(x)         __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_REL(x, v)     __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+
+#if defined(ARDUINO)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+// ============ Helper: Blink detection ============
+// Called every frame: a blinking lamp also has to stop being one when its
+// edges stop coming.
+static void update_blink(RoiState_t* st, uint32_t nowMs) {
+    st->blinking = 0;
+    st->blinkHz = 0.0f;
+    if (st->edges < VISION_BLINK_EDGES) return;
+
+    uint32_t span = st->rise[0] - st->rise[VISION_BLINK_EDGES - 1];
+    uint32_t mean = span / (VISION_BLINK_EDGES - 1);
+    if (mean < VISION_BLINK_MIN_MS || mean > VISION_BLINK_MAX_MS) return;
+    if (nowMs - st->rise[0] > mean + mean / 2) return;
+    uint32_t jitter = mean * VISION_BLINK_JITTER_PCT / 100;
+    for (int i = 0; i < VISION_BLINK_EDGES - 1; i++) {
+        uint32_t period = st->rise[i] - st->rise[i + 1];
+        if (period + jitter < mean || period > mean + jitter) return;
+    }
+    st->blinking = 1;
+    st->blinkHz = 1000.0f / mean;
+}
+
+// ============ Helper: Debounce ============
+static bool debounce(RoiState_t* st, uint32_t nowMs) {
+    if (st->raw == st->lit) {
+        st->run = 0;
+        return false;
+    }
+    if (++st->run < VISION_DEBOUNCE_FRAMES) return false;
+    st->lit = st->raw;
+    st->run = 0;
+    if (st->lit) {
+        memmove(st->rise + 1, st->rise, sizeof(st->rise) - sizeof(st->rise[0]));
+        st->rise[0] = nowMs;
+        if (st->edges < VISION_BLINK_EDGES) st->edges++;
+    }
+    return true;
+}
+
+// ============ Public API ============
+void vision_init(RoiEngine_t* e, const RoiDef_t* rois, uint8_t count) {
+    memset(e, 0, sizeof(*e));
+    if (count > VISION_MAX_ROIS) count = VISION_MAX_ROIS;
+    e->count = count;
+    e->thrY = VISION_THR_Y;
+    e->minBrightPct = VISION_MIN_BRIGHT_PCT;
+    for (uint8_t i = 0; i < count; i++) {
+        // Whole YUYV pairs
+        e->rois[i] = rois[i];
+        e->rois[i].x &= ~1u;
+        e->rois[i].w &= ~1u;
+    }
+}
+
+void vision_process(RoiEngine_t* e, const uint8_t* frame, uint16_t width, uint16_t height,
+                    uint32_t stride, uint32_t nowMs) {
+    unsigned long t0 = micros();
+    uint32_t pixels = 0;
+
+    for (uint8_t i = 0; i < e->count; i++) {
+        const RoiDef_t* r = &e->rois[i];
+        RoiState_t* st = &e->state[i];
+        if (r->w == 0 || r->h == 0 || r->x + r->w > width || r->y + r->h > height) continue;
+
+        RoiStats_t s;
+        roi_stats(frame, stride, r->x, r->y, r->w, r->h, e->thrY, &s);
+        pixels += r->w * r->h;
+
+        st->brightPct = (uint8_t)(s.bright * 100 / s.pairs);
+        st->lumaMean = (uint8_t)(s.sumY / (2 * s.pairs));
+        st->color = vision_classify(&s);
+        st->raw = st->brightPct >= e->minBrightPct &&
+                  (r->color == ROI_COLOR_ANY || st->color == r->color || st->color == ROI_COLOR_WHITE);
+        if (debounce(st, nowMs)) e->stats.changes++;
+        update_blink(st, nowMs);
+    }
+
+    // Read by vision_apply() on the caller's task
+    STORE_REL(e->lastFrameMs, nowMs);
+    STORE_REL(e->seen, true);
+
+    uint32_t us = micros() - t0;
+    float load = us * 100.0f / VISION_FRAME_US;
+    VisionStats_t* vs = &e->stats;
+    vs->lastUs = us;
+    if (us > vs->maxUs) vs->maxUs = us;
+    vs->avgUs = (vs->frames == 0) ? us : 0.95f * vs->avgUs + 0.05f * us;
+    vs->loadPct = (vs->frames == 0) ? load : 0.95f * vs->loadPct + 0.05f * load;
+    vs->headroomPct = 100.0f - vs->loadPct;
+    vs->pixels = pixels;
+    vs->frames++;
+}
+
+#if defined(ARDUINO)
+static void vision_task(void* arg) {
+    RoiEngine_t* e = (RoiEngine_t*)arg;
+    Camera_t* c = e->camera;
+    for (;;) {
+        const uint8_t* frame = camera_grab(c, 1000);
+        if (!frame) continue;
+        vision_process(e, frame, c->width, c->height, c->stride, c->frameMs);
+        if (e->frameFn) e->frameFn(e->frameCtx, frame, c->frameMs);
+        camera_release(c);
+    }
+}
+
+bool vision_start_task(RoiEngine_t* e, Camera_t* camera, VisionFrameFn fn, void* ctx) {
+    e->camera = camera;
+    e->frameFn = fn;
+    e->frameCtx = ctx;
+    return xTaskCreatePinnedToCore(vision_task, "vision", VISION_TASK_STACK, e, 2, NULL,
+                                   tskNO_AFFINITY) == pdPASS;
+}
+#else
+bool vision_start_task(RoiEngine_t* e, Camera_t* camera, VisionFrameFn fn, void* ctx) {
+    (void)e;
+    (void)camera;
+    (void)fn;
+    (void)ctx;
+    return false;
+}
+#endif
+
+bool vision_apply(const RoiEngine_t* e, Vision_t* v, uint32_t nowMs) {
+    if (!LOAD_ACQ(e->seen) || nowMs - LOAD_ACQ(e->lastFrameMs) > VISION_STALE_MS) return false;
+
+    static const char* const stackNames[3] = {"red", "yellow", "green"};
+    bool* leds = &v->leds.run;  // CNCLeds_t is eight bools in field order
+    int8_t stack = -1;
+    bool haveStack = false;
+
+    for (uint8_t i = 0; i < e->count; i++) {
+        const RoiDef_t* r = &e->rois[i];
+        bool on = vision_lamp_on(e, i);
+        if (r->index >= 8) continue;
+        switch (r->target) {
+            case ROI_STACK:
+                if (r->index >= 3) break;
+                haveStack = true;
+                // Red over yellow over green when several are on
+                if (on && (stack < 0 || r->index < stack)) stack = (int8_t)r->index;
+                break;
+            case ROI_LED: leds[r->index] = on; break;
+            case ROI_DI:  v->diA[r->index] = on; break;
+            case ROI_DQ:  v->dqA[r->index] = on; break;
+        }
+    }
+    if (haveStack) v->stackLight = stack < 0 ? "" : stackNames[stack];
+    return true;
+}
+
+bool vision_lamp_on(const RoiEngine_t* e, uint8_t roi) {
+    if (roi >= e->count) return false;
+    return e->state[roi].lit || e->state[roi].blinking;
+}
+
+const RoiState_t* vision_lamp(const RoiEngine_t* e, uint8_t roi) {
+    return roi < e->count ? &e->state[roi] : NULL;
+}
+
+// Hue of the mean chroma (BT.601): red ~110 deg, amber/yellow 155-170,
+// green ~230, blue ~350
+RoiColor_t vision_classify(const RoiStats_t* s) {
+    if (s->bright == 0) return ROI_COLOR_DARK;
+    int32_t u = (int32_t)(s->sumU / s->bright) - 128;
+    int32_t v = (int32_t)(s->sumV / s->bright) - 128;
+    if (abs(u) + abs(v) < VISION_MIN_SAT) return ROI_COLOR_WHITE;
+
+    float hue = atan2f((float)v, (float)u) * (180.0f / (float)M_PI);
+    if (hue < 0.0f) hue += 360.0f;
+    if (hue >= 70.0f && hue < 140.0f) return ROI_COLOR_RED;
+    if (hue >= 140.0f && hue < 200.0f) return ROI_COLOR_YELLOW;
+    if (hue >= 200.0f && hue < 290.0f) return ROI_COLOR_GREEN;
+    return ROI_COLOR_BLUE;
+}
+
+const char* vision_color_name(RoiColor_t c) {
+    switch (c) {
+        case ROI_COLOR_DARK:   return "dark";
+        case ROI_COLOR_RED:    return "red";
+        case ROI_COLOR_YELLOW: return "yellow";
+        case ROI_COLOR_GREEN:  return "green";
+        case ROI_COLOR_BLUE:   return "blue";
+        case ROI_COLOR_WHITE:  return "white";
+        case ROI_COLOR_ANY:    return "any";
+    }
+    return "?";
+}
+
+const VisionStats_t* vision_get_stats(const RoiEngine_t* e) {
+    return &e->stats;
+}
@@ -0,0 +1,139 @@
+// SIGNALTAP ROI Vision Engine
+// Reads a machine's stack light and LED panel through a camera, for
+// machines where tapping the lamp wiring is not an option. Each region of
+// interest (ROI) of the frame is one lamp. Per frame, its statistics
+// (roi_stats.h) give the share of bright pixels and their mean colour; a
+// lamp is lit when enough of it is bright in its own colour, or burnt out
+// to white. The lit state is debounced over VISION_DEBOUNCE_FRAMES, and a
+// lamp that keeps switching at a steady rate is reported as blinking, with
+// its rate, and reads as on. vision_apply() writes the result into the
+// Vision_t fields the simulation fills otherwise: stackLight, leds, diA
+// and dqA.
+//
+// Only ROI pixels are read, so the cost per frame is set by the ROI area,
+// not the frame size: 32 lamps of 48x48 pixels are 74k of the 922k pixels
+// of a 720p frame.
+#ifndef ROI_ENGINE_H
+#define ROI_ENGINE_H
+
+#include <Arduino.h>
+#include "roi_stats.h"
+#include "camera.h"
+#include "../data/demo_profiles.h"
+
+#define VISION_MAX_ROIS         32
+#define VISION_FPS              30
+#define VISION_FRAME_US         (1000000 / VISION_FPS)
+#define VISION_THR_Y            150     // Pixel brightness (roi_stats.h) over this counts as lit
+#define VISION_MIN_BRIGHT_PCT   30      // Share of a lamp's ROI that must be lit
+#define VISION_MIN_SAT          24      // |U - 128| + |V - 128| below this is white
+#define VISION_DEBOUNCE_FRAMES  3       // A new state must hold this long (100 ms)
+#define VISION_STALE_MS         1000    // No frame for this long: leave the Vision_t alone
+#define VISION_TASK_STACK       4096
+
+// ============ Blink Detection ============
+// Rising edges of the debounced state, kept per lamp. Blinking: the last
+// VISION_BLINK_EDGES - 1 periods within VISION_BLINK_JITTER_PCT of their
+// mean, the mean within the limits, and the last edge at most 1.5 periods
+// ago (so a lamp that stops blinking drops out after 1.5 periods).
+#define VISION_BLINK_EDGES      4
+#define VISION_BLINK_MIN_MS     300     // Period limits (3.3 .. 0.33 Hz)
+#define VISION_BLINK_MAX_MS     3000
+#define VISION_BLINK_JITTER_PCT 25
+
+typedef enum {
+    ROI_COLOR_DARK = 0,     // Nothing bright
+    ROI_COLOR_RED,
+    ROI_COLOR_YELLOW,
+    ROI_COLOR_GREEN,
+    ROI_COLOR_BLUE,
+    ROI_COLOR_WHITE,        // Bright but unsaturated (also a lamp overexposed)
+    ROI_COLOR_ANY           // ROI colour: lit in any colour counts
+} RoiColor_t;
+
+// What a lamp stands for in Vision_t
+typedef enum {
+    ROI_STACK = 0,          // Stack light segment: index 0 red, 1 yellow, 2 green
+    ROI_LED,                // CNCLeds_t, index in field order (0 run .. 7 ready)
+    ROI_DI,                 // diA[index]
+    ROI_DQ                  // dqA[index]
+} RoiTarget_t;
+
+typedef struct {
+    uint16_t x, y, w, h;    // Pixels; x and w are rounded down to even
+    uint8_t target;         // RoiTarget_t
+    uint8_t index;
+    uint8_t color;          // RoiColor_t the lamp lights in
+} RoiDef_t;
+
+typedef struct {
+    uint8_t raw;            // Lit in this frame
+    uint8_t lit;            // Debounced
+    uint8_t run;            // Frames raw has differed from lit
+    uint8_t color;          // RoiColor_t of the bright pixels, this frame
+    uint8_t brightPct;
+    uint8_t lumaMean;
+    uint8_t blinking;
+    uint8_t edges;          // Rising edges in rise[], newest first
+    uint32_t rise[VISION_BLINK_EDGES];
+    float blinkHz;
+} RoiState_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t pixels;        // ROI pixels read per frame
+    uint32_t changes;       // Debounced lamp changes
+    uint32_t lastUs;
+    uint32_t maxUs;
+    float avgUs;
+    float loadPct;          // EWMA of processing time / frame interval
+    float headroomPct;      // 100 - loadPct
+} VisionStats_t;
+
+// Another reader of the same frames (seven-segment OCR)
+typedef void (*VisionFrameFn)(void* ctx, const uint8_t* frame, uint32_t nowMs);
+
+typedef struct {
+    RoiDef_t rois[VISION_MAX_ROIS];
+    RoiState_t state[VISION_MAX_ROIS];
+    uint8_t count;
+    uint8_t thrY;
+    uint8_t minBrightPct;
+    volatile uint32_t lastFrameMs;  // Capture time of the last frame
+    bool seen;                      // Any frame yet
+    Camera_t* camera;               // Device: fed by vision_start_task()
+    VisionFrameFn frameFn;
+    void* frameCtx;
+    VisionStats_t stats;
+} RoiEngine_t;
+
+// ============ Public API ============
+
+// count is capped at VISION_MAX_ROIS
+void vision_init(RoiEngine_t* e, const RoiDef_t* rois, uint8_t count);
+
+// One YUYV frame (stride in bytes), captured at nowMs. ROIs reaching past
+// the frame are skipped.
+void vision_process(RoiEngine_t* e, const uint8_t* frame, uint16_t width, uint16_t height,
+                    uint32_t stride, uint32_t nowMs);
+
+// Device: a task that runs every frame of an open camera through the
+// engine as it arrives, then through fn if not NULL. Host: false, the
+// caller feeds frames.
+bool vision_start_task(RoiEngine_t* e, Camera_t* camera, VisionFrameFn fn, void* ctx);
+
+// The lamp states into v, over the fields that have an ROI. False, and v
+// untouched, when there has been no frame for VISION_STALE_MS.
+bool vision_apply(const RoiEngine_t* e, Vision_t* v, uint32_t nowMs);
+
+// Lit or blinking
+bool vision_lamp_on(const RoiEngine_t* e, uint8_t roi);
+const RoiState_t* vision_lamp(const RoiEngine_t* e, uint8_t roi);
+
+// Colour of the bright part of a frame's chroma sums
+RoiColor_t vision_classify(const RoiStats_t* s);
+const char* vision_color_name(RoiColor_t c);
+
+const VisionStats_t* vision_get_stats(const RoiEngine_t* e);
+
+#endif // ROI_ENGINE_H
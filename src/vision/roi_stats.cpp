@@ -0,0 +1,125 @@
+// SIGNALTAP ROI Statistics Implementation
+#include "roi_stats.h"
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// |c - 128|
+static const uint8_t chroma[256] = {
+#define C4(n) (n), (n) - 1, (n) - 2, (n) - 3
+    C4(128), C4(124), C4(120), C4(116), C4(112), C4(108), C4(104), C4(100),
+    C4(96), C4(92), C4(88), C4(84), C4(80), C4(76), C4(72), C4(68),
+    C4(64), C4(60), C4(56), C4(52), C4(48), C4(44), C4(40), C4(36),
+    C4(32), C4(28), C4(24), C4(20), C4(16), C4(12), C4(8), C4(4),
+#undef C4
+#define C4(n) (n), (n) + 1, (n) + 2, (n) + 3
+    C4(0), C4(4), C4(8), C4(12), C4(16), C4(20), C4(24), C4(28),
+    C4(32), C4(36), C4(40), C4(44), C4(48), C4(52), C4(56), C4(60),
+    C4(64), C4(68), C4(72), C4(76), C4(80), C4(84), C4(88), C4(92),
+    C4(96), C4(100), C4(104), C4(108), C4(112), C4(116), C4(120), C4(124),
+#undef C4
+};
+
+// ============ Helper: Pairs one at a time ============
+// YUYV little-endian: Y0 | U << 8 | Y1 << 16 | V << 24. The bright mask is
+// all ones or all zeros, so there is no branch on the pixel data.
+static void stats_pairs(const uint8_t* p, uint32_t n, uint32_t thr2, RoiStats_t* s) {
+    uint32_t sumY = 0, bright = 0, sumU = 0, sumV = 0;
+    for (uint32_t i = 0; i < n; i++, p += 4) {
+        uint32_t q;
+        memcpy(&q, p, 4);
+        uint32_t py = (q & 0xFF) + ((q >> 16) & 0xFF);
+        uint32_t u = (q >> 8) & 0xFF, v = q >> 24;
+        uint32_t m = 0u - (uint32_t)(py + chroma[u] + chroma[v] > thr2);
+        sumY += py;
+        bright += m & 1;
+        sumU += u & m;
+        sumV += v & m;
+    }
+    s->sumY += sumY;
+    s->bright += bright;
+    s->sumU += sumU;
+    s->sumV += sumV;
+}
+
+#if defined(__SSE2__)
+// ============ Helper: Four pairs per step (host only) ============
+// 16 bytes = 4 pairs. Even bytes are luma: madd with ones gives Y0 + Y1 of
+// each pair in its own 32-bit lane, which is also where the pair's U and V
+// sit once the odd bytes are shifted down, so the lane compare masks both
+// and another madd gives |U - 128| + |V - 128| in the same lane.
+static void stats_rows_sse2(const uint8_t* row, uint32_t stride, uint32_t pairs, uint16_t h,
+                            uint32_t thr2, RoiStats_t* s) {
+    const __m128i lo = _mm_set1_epi16(0x00FF);
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128i pickU = _mm_set1_epi32(1);
+    const __m128i pickV = _mm_set1_epi32(1 << 16);
+    const __m128i bias = _mm_set1_epi16(128);
+    const __m128i thr = _mm_set1_epi32((int)thr2);
+    __m128i accY = _mm_setzero_si128(), accB = _mm_setzero_si128();
+    __m128i accU = _mm_setzero_si128(), accV = _mm_setzero_si128();
+    uint32_t vec = pairs / 4, tail = pairs % 4;
+
+    for (uint16_t r = 0; r < h; r++, row += stride) {
+        const uint8_t* p = row;
+        for (uint32_t i = 0; i < vec; i++, p += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i*)p);
+            __m128i py = _mm_madd_epi16(_mm_and_si128(v, lo), ones);
+            __m128i c = _mm_srli_epi16(v, 8);
+            __m128i d = _mm_sub_epi16(c, bias);
+            __m128i sat = _mm_madd_epi16(_mm_max_epi16(d, _mm_sub_epi16(_mm_setzero_si128(), d)), ones);
+            __m128i m = _mm_cmpgt_epi32(_mm_add_epi32(py, sat), thr);
+            __m128i uv = _mm_and_si128(c, m);
+            accY = _mm_add_epi32(accY, py);
+            accB = _mm_sub_epi32(accB, m);
+            accU = _mm_add_epi32(accU, _mm_madd_epi16(uv, pickU));
+            accV = _mm_add_epi32(accV, _mm_madd_epi16(uv, pickV));
+        }
+        if (tail) stats_pairs(p, tail, thr2, s);
+    }
+
+    uint32_t lane[4];
+    _mm_storeu_si128((__m128i*)lane, accY);
+    s->sumY += lane[0] + lane[1] + lane[2] + lane[3];
+    _mm_storeu_si128((__m128i*)lane, accB);
+    s->bright += lane[0] + lane[1] + lane[2] + lane[3];
+    _mm_storeu_si128((__m128i*)lane, accU);
+    s->sumU += lane[0] + lane[1] + lane[2] + lane[3];
+    _mm_storeu_si128((__m128i*)lane, accV);
+    s->sumV += lane[0] + lane[1] + lane[2] + lane[3];
+}
+#endif
+
+// ============ Public API ============
+void roi_stats(const uint8_t* frame, uint32_t stride, uint16_t x, uint16_t y,
+               uint16_t w, uint16_t h, uint8_t thrY, RoiStats_t* s) {
+    memset(s, 0, sizeof(*s));
+    uint32_t pairs = w / 2;
+    s->pairs = pairs * h;
+    const uint8_t* row = frame + (uint32_t)y * stride + (uint32_t)x * 2;
+#if defined(__SSE2__)
+    stats_rows_sse2(row, stride, pairs, h, 2u * thrY, s);
+#else
+    for (uint16_t r = 0; r < h; r++, row += stride) stats_pairs(row, pairs, 2u * thrY, s);
+#endif
+}
+
+void roi_stats_ref(const uint8_t* frame, uint32_t stride, uint16_t x, uint16_t y,
+                   uint16_t w, uint16_t h, uint8_t thrY, RoiStats_t* s) {
+    memset(s, 0, sizeof(*s));
+    s->pairs = (uint32_t)(w / 2) * h;
+    for (uint16_t r = 0; r < h; r++) {
+        const uint8_t* p = frame + (uint32_t)(y + r) * stride + (uint32_t)x * 2;
+        for (uint16_t c = 0; c < w / 2; c++, p += 4) {
+            uint32_t py = p[0] + p[2];
+            s->sumY += py;
+            if (py + abs(p[1] - 128) + abs(p[3] - 128) > 2u * thrY) {
+                s->bright++;
+                s->sumU += p[1];
+                s->sumV += p[3];
+            }
+        }
+    }
+}
@@ -0,0 +1,38 @@
+// SIGNALTAP ROI Statistics
+// Per-frame statistics of a rectangle of a YUYV (YUV 4:2:2) frame, the
+// only per-pixel work of the vision engine. Taken per pixel pair, which
+// shares one U and one V: the luma sum, and of the bright pairs, their
+// count and their chroma sums. That is enough for "how much of this lamp
+// is lit, and in what colour". Bright is luma plus chroma magnitude over
+// the threshold, roughly the brightest of R, G and B: a lit red lamp has
+// a luma of only ~96 out of 255, under that of a grey wall.
+//
+// The ESP32-P4 build runs a branch-free scalar loop, one pixel pair per
+// 32-bit load; there is no vector kernel for the device. Host builds with
+// SSE2 take 8 pixels per step, which only speeds up the simulator and the
+// host tools. roi_stats_ref() is the plain per-byte version both are
+// checked against (make -C tools check runs vision_bench both ways).
+#ifndef ROI_STATS_H
+#define ROI_STATS_H
+
+#include <Arduino.h>
+
+typedef struct {
+    uint32_t pairs;     // Pixel pairs in the rectangle
+    uint32_t sumY;      // Luma of all pixels
+    uint32_t bright;    // Pairs with Y0 + Y1 + |U - 128| + |V - 128| > 2 * thrY
+    uint32_t sumU;      // Chroma of the bright pairs (128 = none)
+    uint32_t sumV;
+} RoiStats_t;
+
+// ============ Public API ============
+
+// Rectangle x, y, w, h in pixels; x and w even (whole pairs). stride in
+// bytes. The rectangle must lie inside the frame.
+void roi_stats(const uint8_t* frame, uint32_t stride, uint16_t x, uint16_t y,
+               uint16_t w, uint16_t h, uint8_t thrY, RoiStats_t* s);
+
+void roi_stats_ref(const uint8_t* frame, uint32_t stride, uint16_t x, uint16_t y,
+                   uint16_t w, uint16_t h, uint8_t thrY, RoiStats_t* s);
+
+#endif // ROI_STATS_H
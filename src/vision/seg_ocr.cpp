@@ -0,0 +1,273 @@
+// SIGNALTAP Seven-Segment OCR Implementation
+#include "seg_ocr.h"
+#include <string.h>
+
+#define LOAD_ACQ(x)         __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_REL(x, v)     __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+
+// ============ Digit Geometry ============
+// In a digit cell: x 0..1 across the digit pitch, y 0..1 top to bottom.
+// Centre lines of segments a..g (kept clear of the corners, where
+// neighbouring segments meet), and the middle of the two holes.
+static const float segLine[7][4] = {
+    {0.30f, 0.08f, 0.70f, 0.08f},   // a
+    {0.82f, 0.20f, 0.82f, 0.40f},   // b
+    {0.82f, 0.60f, 0.82f, 0.80f},   // c
+    {0.30f, 0.92f, 0.70f, 0.92f},   // d
+    {0.18f, 0.60f, 0.18f, 0.80f},   // e
+    {0.18f, 0.20f, 0.18f, 0.40f},   // f
+    {0.30f, 0.50f, 0.70f, 0.50f},   // g
+};
+static const float holeY[2] = {0.29f, 0.71f};
+
+// Characters a display can show
+typedef struct {
+    uint8_t mask;
+    char c;
+} Glyph_t;
+
+static const Glyph_t glyphs[] = {
+    {0x3F, '0'}, {0x06, '1'}, {0x5B, '2'}, {0x4F, '3'}, {0x66, '4'},
+    {0x6D, '5'}, {0x7D, '6'}, {0x07, '7'}, {0x7F, '8'}, {0x6F, '9'},
+    {0x00, ' '}, {0x40, '-'}, {0x79, 'E'}, {0x50, 'r'}, {0x77, 'A'},
+    {0x7C, 'b'}, {0x39, 'C'}, {0x5E, 'd'}, {0x71, 'F'}, {0x76, 'H'},
+    {0x38, 'L'}, {0x54, 'n'}, {0x5C, 'o'}, {0x73, 'P'}, {0x3E, 'U'},
+    // Variants some drivers use
+    {0x7C, '6'}, {0x27, '7'}, {0x67, '9'},
+};
+
+#define GLYPH_COUNT (sizeof(glyphs) / sizeof(glyphs[0]))
+
+// ============ Helper: Corners -> homography ============
+// Unit square (u right, v down) onto the quad TL, TR, BR, BL
+typedef struct {
+    float a, b, c, d, e, f, g, h;
+} Homography_t;
+
+static void homography(const int16_t q[4][2], Homography_t* m) {
+    float x0 = q[0][0], y0 = q[0][1], x1 = q[1][0], y1 = q[1][1];
+    float x2 = q[2][0], y2 = q[2][1], x3 = q[3][0], y3 = q[3][1];
+    float dx1 = x1 - x2, dx2 = x3 - x2, dx3 = x0 - x1 + x2 - x3;
+    float dy1 = y1 - y2, dy2 = y3 - y2, dy3 = y0 - y1 + y2 - y3;
+    float det = dx1 * dy2 - dx2 * dy1;
+    if ((dx3 == 0.0f && dy3 == 0.0f) || det == 0.0f) {
+        m->g = m->h = 0.0f;     // Parallelogram: affine
+    } else {
+        m->g = (dx3 * dy2 - dx2 * dy3) / det;
+        m->h = (dx1 * dy3 - dx3 * dy1) / det;
+    }
+    m->a = x1 - x0 + m->g * x1;
+    m->b = x3 - x0 + m->h * x3;
+    m->c = x0;
+    m->d = y1 - y0 + m->g * y1;
+    m->e = y3 - y0 + m->h * y3;
+    m->f = y0;
+}
+
+// Digit-cell point -> luma byte offset; false outside the frame
+static bool map_point(const Homography_t* m, const SegDisplayDef_t* def, uint8_t digit,
+                      float x, float y, uint16_t width, uint16_t height, uint32_t stride,
+                      uint32_t* offset) {
+    x += def->slantPct * 0.01f * (0.5f - y);
+    float u = (digit + x) / def->digits, v = y;
+    float w = m->g * u + m->h * v + 1.0f;
+    int px = (int)((m->a * u + m->b * v + m->c) / w + 0.5f);
+    int py = (int)((m->d * u + m->e * v + m->f) / w + 0.5f);
+    if (px < 0 || py < 0 || px >= width || py >= height) return false;
+    *offset = (uint32_t)py * stride + (uint32_t)px * 2;
+    return true;
+}
+
+static uint32_t sum_at(const uint8_t* frame, const uint32_t* offsets, int n) {
+    uint32_t s = 0;
+    for (int i = 0; i < n; i++) s += frame[offsets[i]];
+    return s;
+}
+
+// ============ Helper: One display ============
+// Returns false for a frame with a digit no glyph has
+static bool read_display(SegOcr_t* o, uint8_t i, const uint8_t* frame) {
+    const SegDisplayDef_t* def = &o->defs[i];
+    SegDisplay_t* d = &o->disp[i];
+
+    uint32_t level[SEG_MAX_DIGITS][7];
+    uint32_t hi = 0, lo = UINT32_MAX, bg = 0;
+    for (uint8_t k = 0; k < def->digits; k++) {
+        for (int s = 0; s < 7; s++) {
+            uint32_t l = sum_at(frame, d->seg[k][s], SEG_SAMPLES);
+            level[k][s] = l;
+            if (l > hi) hi = l;
+            if (l < lo) lo = l;
+        }
+        bg += sum_at(frame, d->hole[k], 2 * SEG_HOLE_SAMPLES);
+    }
+    // Background per point, scaled to a segment's sum
+    bg = bg * SEG_SAMPLES / (2u * SEG_HOLE_SAMPLES * def->digits);
+
+    uint32_t edge = def->dark ? lo : hi;
+    uint32_t contrast = def->dark ? (bg > lo ? bg - lo : 0) : (hi > bg ? hi - bg : 0);
+    contrast /= SEG_SAMPLES;
+    d->contrast = (uint8_t)(contrast > 255 ? 255 : contrast);
+    uint32_t thr = (bg + edge) / 2;
+
+    bool ok = true;
+    for (uint8_t k = 0; k < def->digits; k++) {
+        uint8_t mask = 0;
+        if (contrast >= SEG_MIN_CONTRAST) {
+            for (int s = 0; s < 7; s++) {
+                bool lit = def->dark ? level[k][s] < thr : level[k][s] > thr;
+                if (lit) mask |= (uint8_t)(1 << s);
+            }
+        }
+        d->mask[k] = mask;
+        char c = seg_decode(mask);
+        if (!c || (def->target == SEG_PART_COUNT && c != ' ' && (c < '0' || c > '9'))) {
+            c = '?';
+            ok = false;
+        }
+        d->raw[k] = c;
+    }
+    d->raw[def->digits] = '\0';
+    return ok;
+}
+
+// ============ Helper: Voting ============
+static bool vote(SegOcr_t* o, uint8_t i) {
+    const SegDisplayDef_t* def = &o->defs[i];
+    SegDisplay_t* d = &o->disp[i];
+
+    memcpy(d->votes[d->voteHead], d->raw, sizeof(d->raw));
+    d->voteHead = (uint8_t)((d->voteHead + 1) % SEG_VOTE_FRAMES);
+    if (d->voteCount < SEG_VOTE_FRAMES) d->voteCount++;
+
+    uint8_t agree = 0;
+    for (uint8_t k = 0; k < d->voteCount; k++) {
+        if (strcmp(d->votes[k], d->raw) == 0) agree++;
+    }
+    if (agree < SEG_VOTE_MIN) return false;
+
+    // As the Vision_t shows it
+    char text[SEG_MAX_DIGITS + 1];
+    uint16_t value = 0;
+    if (def->target == SEG_PART_COUNT) {
+        strcpy(text, d->raw);
+        for (const char* p = d->raw; *p; p++) {
+            if (*p != ' ') value = (uint16_t)(value * 10 + (*p - '0'));
+        }
+    } else {
+        const char* p = d->raw;
+        while (*p == ' ') p++;
+        strcpy(text, p);
+        size_t n = strlen(text);
+        while (n && text[n - 1] == ' ') text[--n] = '\0';
+        if (n == 0) strcpy(text, "---");
+    }
+
+    uint8_t cur = d->cur;
+    if (d->valid && strcmp(d->text[cur], text) == 0) return false;
+    // The reader may still hold text[cur]: write the other one, then flip
+    strcpy(d->text[cur ^ 1], text);
+    d->value = value;
+    STORE_REL(d->cur, (uint8_t)(cur ^ 1));
+    STORE_REL(d->valid, (uint8_t)1);
+    return true;
+}
+
+// ============ Public API ============
+void seg_ocr_init(SegOcr_t* o, const SegDisplayDef_t* defs, uint8_t count,
+                  uint16_t width, uint16_t height, uint32_t stride, uint8_t fps) {
+    memset(o, 0, sizeof(*o));
+    if (count > SEG_MAX_DISPLAYS) count = SEG_MAX_DISPLAYS;
+    o->count = count;
+    o->frameUs = 1000000u / (fps ? fps : 30);
+
+    for (uint8_t i = 0; i < count; i++) {
+        SegDisplayDef_t* def = &o->defs[i];
+        SegDisplay_t* d = &o->disp[i];
+        *def = defs[i];
+        if (def->digits > SEG_MAX_DIGITS) def->digits = SEG_MAX_DIGITS;
+
+        Homography_t m;
+        homography(def->quad, &m);
+        bool in = def->digits > 0;
+        for (uint8_t k = 0; k < def->digits; k++) {
+            for (int s = 0; s < 7; s++) {
+                const float* l = segLine[s];
+                for (int j = 0; j < SEG_SAMPLES; j++) {
+                    float t = (float)j / (SEG_SAMPLES - 1);
+                    in &= map_point(&m, def, k, l[0] + (l[2] - l[0]) * t, l[1] + (l[3] - l[1]) * t,
+                                    width, height, stride, &d->seg[k][s][j]);
+                }
+            }
+            for (int h = 0; h < 2; h++) {
+                for (int j = 0; j < SEG_HOLE_SAMPLES; j++) {
+                    float x = 0.4f + 0.2f * j / (SEG_HOLE_SAMPLES - 1);
+                    in &= map_point(&m, def, k, x, holeY[h], width, height, stride,
+                                    &d->hole[k][h * SEG_HOLE_SAMPLES + j]);
+                }
+            }
+        }
+        d->inside = in;
+    }
+}
+
+void seg_ocr_process(SegOcr_t* o, const uint8_t* frame, uint32_t nowMs) {
+    unsigned long t0 = micros();
+    for (uint8_t i = 0; i < o->count; i++) {
+        if (!o->disp[i].inside) continue;
+        if (!read_display(o, i, frame)) {
+            o->stats.rejected++;
+            continue;
+        }
+        if (vote(o, i)) o->stats.readings++;
+    }
+    o->lastFrameMs = nowMs;
+    o->seen = true;
+
+    uint32_t us = micros() - t0;
+    float load = us * 100.0f / o->frameUs;
+    SegStats_t* st = &o->stats;
+    st->lastUs = us;
+    if (us > st->maxUs) st->maxUs = us;
+    st->avgUs = (st->frames == 0) ? us : 0.95f * st->avgUs + 0.05f * us;
+    st->loadPct = (st->frames == 0) ? load : 0.95f * st->loadPct + 0.05f * load;
+    st->frames++;
+}
+
+bool seg_ocr_apply(const SegOcr_t* o, uint8_t machine, Vision_t* v, uint32_t nowMs) {
+    if (!o->seen || nowMs - o->lastFrameMs > SEG_STALE_MS) return false;
+    for (uint8_t i = 0; i < o->count; i++) {
+        const SegDisplay_t* d = &o->disp[i];
+        if (o->defs[i].machine != machine || !LOAD_ACQ(d->valid)) continue;
+        if (o->defs[i].target == SEG_PART_COUNT) v->partCount = d->value;
+        else v->errorCode = d->text[LOAD_ACQ(d->cur)];
+    }
+    return true;
+}
+
+const char* seg_ocr_text(const SegOcr_t* o, uint8_t display) {
+    if (display >= o->count || !o->disp[display].valid) return "";
+    return o->disp[display].text[o->disp[display].cur];
+}
+
+const char* seg_ocr_raw(const SegOcr_t* o, uint8_t display) {
+    return display < o->count ? o->disp[display].raw : "";
+}
+
+char seg_decode(uint8_t mask) {
+    for (size_t i = 0; i < GLYPH_COUNT; i++) {
+        if (glyphs[i].mask == mask) return glyphs[i].c;
+    }
+    return 0;
+}
+
+uint8_t seg_encode(char c) {
+    for (size_t i = 0; i < GLYPH_COUNT; i++) {
+        if (glyphs[i].c == c) return glyphs[i].mask;
+    }
+    return 0;
+}
+
+const SegStats_t* seg_ocr_get_stats(const SegOcr_t* o) {
+    return &o->stats;
+}
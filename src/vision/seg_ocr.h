@@ -0,0 +1,122 @@
+// SIGNALTAP Seven-Segment OCR
+// Reads part counters and error codes off seven-segment displays in the
+// camera image. A display is given by the four corners of its digit row,
+// which also corrects the perspective: at init every segment gets
+// SEG_SAMPLES luma sample points along its centre line, mapped through the
+// corners' homography to frame offsets, plus points in the two holes of
+// each digit for the background. Per frame a display then costs a few
+// hundred byte loads, whatever its size in the image.
+//
+// Per frame: the segment levels against a threshold halfway between the
+// background and the brightest segment (the darkest, for LCDs), which
+// follows exposure and ageing LEDs; too little contrast reads as blank.
+// Each digit's seven segments decode to a character, and a frame with a
+// pattern no glyph has (say, a counter caught mid-change) does not count.
+// A reading is taken when SEG_VOTE_MIN of the last SEG_VOTE_FRAMES frames
+// agree on it, so single bad frames never reach the Vision_t.
+#ifndef SEG_OCR_H
+#define SEG_OCR_H
+
+#include <Arduino.h>
+#include "../data/demo_profiles.h"
+
+#define SEG_MAX_DISPLAYS    4
+#define SEG_MAX_DIGITS      6
+#define SEG_SAMPLES         5       // Per segment
+#define SEG_HOLE_SAMPLES    3       // Per hole, two holes per digit
+#define SEG_MIN_CONTRAST    40      // Segment - background luma; under it reads blank
+#define SEG_VOTE_FRAMES     5
+#define SEG_VOTE_MIN        3
+#define SEG_STALE_MS        2000    // No frame for this long: leave the Vision_t alone
+
+// Segment bits, a = top, clockwise, g = middle
+#define SEG_A   0x01
+#define SEG_B   0x02
+#define SEG_C   0x04
+#define SEG_D   0x08
+#define SEG_E   0x10
+#define SEG_F   0x20
+#define SEG_G   0x40
+
+// What a display stands for in Vision_t
+typedef enum {
+    SEG_PART_COUNT = 0,     // partCount: digits, leading blanks allowed
+    SEG_ERROR_CODE          // errorCode: text; blank reads as "---"
+} SegTarget_t;
+
+typedef struct {
+    int16_t quad[4][2];     // Digit row corners in pixels: TL, TR, BR, BL
+    uint8_t digits;
+    uint8_t machine;        // Demo whose Vision_t gets the reading
+    uint8_t target;         // SegTarget_t
+    uint8_t dark;           // LCD: segments darker than the background
+    int8_t slantPct;        // Digit tops lean right by this % of the digit width
+} SegDisplayDef_t;
+
+typedef struct {
+    uint32_t seg[SEG_MAX_DIGITS][7][SEG_SAMPLES];       // Frame offsets of luma bytes
+    uint32_t hole[SEG_MAX_DIGITS][2 * SEG_HOLE_SAMPLES];
+    bool inside;                                        // All points within the frame
+
+    // Last frame
+    uint8_t mask[SEG_MAX_DIGITS];                       // Lit segments per digit
+    char raw[SEG_MAX_DIGITS + 1];                       // Decoded, '?' for no glyph
+    uint8_t contrast;
+
+    // Voting
+    char votes[SEG_VOTE_FRAMES][SEG_MAX_DIGITS + 1];    // Valid frames only
+    uint8_t voteHead;
+    uint8_t voteCount;
+
+    // Reading: text[cur], flipped when a new one is voted in
+    char text[2][SEG_MAX_DIGITS + 1];
+    volatile uint8_t cur;
+    volatile uint8_t valid;
+    uint16_t value;                                     // SEG_PART_COUNT
+} SegDisplay_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t rejected;      // Display-frames with an undecodable digit
+    uint32_t readings;      // New readings voted in
+    uint32_t lastUs;
+    uint32_t maxUs;
+    float avgUs;
+    float loadPct;          // EWMA of processing time / frame interval
+} SegStats_t;
+
+typedef struct {
+    SegDisplayDef_t defs[SEG_MAX_DISPLAYS];
+    SegDisplay_t disp[SEG_MAX_DISPLAYS];
+    uint8_t count;
+    uint32_t frameUs;       // Frame interval, for loadPct
+    volatile uint32_t lastFrameMs;
+    bool seen;
+    SegStats_t stats;
+} SegOcr_t;
+
+// ============ Public API ============
+
+// Sample points for YUYV frames of this size and stride (bytes). Displays
+// with a point outside the frame are never read.
+void seg_ocr_init(SegOcr_t* o, const SegDisplayDef_t* defs, uint8_t count,
+                  uint16_t width, uint16_t height, uint32_t stride, uint8_t fps);
+
+void seg_ocr_process(SegOcr_t* o, const uint8_t* frame, uint32_t nowMs);
+
+// The readings of machine's displays into v. False, and v untouched, when
+// there has been no frame for SEG_STALE_MS.
+bool seg_ocr_apply(const SegOcr_t* o, uint8_t machine, Vision_t* v, uint32_t nowMs);
+
+// Current reading of a display ("" before the first), and the last frame's
+const char* seg_ocr_text(const SegOcr_t* o, uint8_t display);
+const char* seg_ocr_raw(const SegOcr_t* o, uint8_t display);
+
+// Character for a segment pattern, 0 for none
+char seg_decode(uint8_t mask);
+// Pattern for a character, for tests and renderers (0 for blank / unknown)
+uint8_t seg_encode(char c);
+
+const SegStats_t* seg_ocr_get_stats(const SegOcr_t* o);
+
+#endif // SEG_OCR_H
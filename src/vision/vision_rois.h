@@ -0,0 +1,65 @@
+// SIGNALTAP Vision ROI Tables
+// Where the lamps and seven-segment displays are in the camera image
+// (1280x720), one lamp table per kind of machine panel. Edit to match the
+// installation: aim the camera, grab a frame, and box each lamp a little
+// inside its lens so the surround does not dilute it. The ROI colour is
+// the colour the lamp lights in; ROI_COLOR_ANY for white or unknown lamps.
+#ifndef VISION_ROIS_H
+#define VISION_ROIS_H
+
+#include "roi_engine.h"
+#include "seg_ocr.h"
+
+//  x, y, w, h, target, index, colour
+// CNC Machine Shop: three-segment stack light and the control's LED row
+static const RoiDef_t visionRoisCnc[] = {
+    {200, 120, 64, 64, ROI_STACK, 0, ROI_COLOR_RED},
+    {200, 200, 64, 64, ROI_STACK, 1, ROI_COLOR_YELLOW},
+    {200, 280, 64, 64, ROI_STACK, 2, ROI_COLOR_GREEN},
+
+    {480, 560, 32, 32, ROI_LED, 0, ROI_COLOR_GREEN},    // Run
+    {560, 560, 32, 32, ROI_LED, 1, ROI_COLOR_GREEN},    // Feed
+    {640, 560, 32, 32, ROI_LED, 2, ROI_COLOR_GREEN},    // Spindle
+    {720, 560, 32, 32, ROI_LED, 3, ROI_COLOR_GREEN},    // Coolant
+    {800, 560, 32, 32, ROI_LED, 4, ROI_COLOR_YELLOW},   // Program
+    {880, 560, 32, 32, ROI_LED, 5, ROI_COLOR_RED},      // Error
+    {960, 560, 32, 32, ROI_LED, 6, ROI_COLOR_RED},      // Fault
+    {1040, 560, 32, 32, ROI_LED, 7, ROI_COLOR_GREEN},   // Ready
+};
+
+// Custom PLC Setup: status LEDs of the DI and DQ modules
+static const RoiDef_t visionRoisPlc[] = {
+    {320, 300, 24, 24, ROI_DI, 0, ROI_COLOR_GREEN},
+    {384, 300, 24, 24, ROI_DI, 1, ROI_COLOR_GREEN},
+    {448, 300, 24, 24, ROI_DI, 2, ROI_COLOR_GREEN},
+    {512, 300, 24, 24, ROI_DI, 3, ROI_COLOR_GREEN},
+    {576, 300, 24, 24, ROI_DI, 4, ROI_COLOR_GREEN},
+    {640, 300, 24, 24, ROI_DI, 5, ROI_COLOR_GREEN},
+    {704, 300, 24, 24, ROI_DI, 6, ROI_COLOR_GREEN},
+    {768, 300, 24, 24, ROI_DI, 7, ROI_COLOR_GREEN},
+
+    {320, 420, 24, 24, ROI_DQ, 0, ROI_COLOR_YELLOW},
+    {384, 420, 24, 24, ROI_DQ, 1, ROI_COLOR_YELLOW},
+    {448, 420, 24, 24, ROI_DQ, 2, ROI_COLOR_YELLOW},
+    {512, 420, 24, 24, ROI_DQ, 3, ROI_COLOR_YELLOW},
+    {576, 420, 24, 24, ROI_DQ, 4, ROI_COLOR_YELLOW},
+    {640, 420, 24, 24, ROI_DQ, 5, ROI_COLOR_YELLOW},
+    {704, 420, 24, 24, ROI_DQ, 6, ROI_COLOR_YELLOW},
+    {768, 420, 24, 24, ROI_DQ, 7, ROI_COLOR_YELLOW},
+};
+
+// Seven-segment displays: corners of the digit row, taken half a digit gap
+// outside the first and last digit so the row divides into equal cells
+//  TL, TR, BR, BL, digits, machine, target, LCD, slant %
+static const SegDisplayDef_t segDisplays[] = {
+    // CNC Machine Shop: part counter, red LED
+    {{{420, 110}, {760, 128}, {756, 250}, {416, 236}}, 4, 0, SEG_PART_COUNT, 0, 10},
+    // Cold Storage Chiller: controller error code, green LED
+    {{{860, 380}, {1100, 372}, {1104, 470}, {862, 482}}, 3, 1, SEG_ERROR_CODE, 0, 8},
+};
+
+#define VISION_ROI_COUNT_CNC (sizeof(visionRoisCnc) / sizeof(visionRoisCnc[0]))
+#define VISION_ROI_COUNT_PLC (sizeof(visionRoisPlc) / sizeof(visionRoisPlc[0]))
+#define SEG_DISPLAY_COUNT    (sizeof(segDisplays) / sizeof(segDisplays[0]))
+
+#endif // VISION_ROIS_H
@@ -0,0 +1,238 @@
+// SIGNALTAP Alarm Engine Stress Bench (host)
+// Drives one alarm table (src/data/alarm_engine) with a storm of random
+// requests, then lets it go quiet, and checks it after every request.
+//  - Storm: -r requests per simulated second for -s seconds over every
+//    alarm code: raise, clear, ack, log ack, clear by severity and now and
+//    then a shelve (5-30 s); alarm_tick once per second. Then the same at
+//    one request every LIGHT_EVERY_S, under the flood threshold, so the
+//    table and the chatter latch get exercised outside a flood too
+//  - Quiet: no raises, every code cleared each second, until the chatter
+//    hold and two flood windows have passed
+//  - Checks, exit 1 on a failure: at most ALARM_MAX_ACTIVE entries, dense
+//    and oldest first, code->slot map consistent both ways, no shelved
+//    code active, every active entry's log record open and matching, the
+//    log's ack count, nothing below ALARM_SEV_ERROR let in while flooding,
+//    the revision bumped on every visible change (entries, flood state,
+//    shelved codes; the held count is only refreshed once per flood
+//    window); after the quiet period the flood and every chatter latch
+//    released and the table empty
+//  - Time per request without the checks, visible changes per second
+//
+// Build: make -C tools alarm_bench (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage: alarm_bench [-s storm seconds (600)] [-r requests per second (5000)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/data/alarm_engine.h"
+
+#define LIGHT_EVERY_S   4
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t rng;
+
+static uint32_t xorshift(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint32_t failures = 0;
+
+static void fail(const char* what, uint32_t now) {
+    if (failures < 10) printf("  FAILED at %lu s: %s\n", (unsigned long)now, what);
+    failures++;
+}
+
+static AlarmTable_t table;
+static AlarmRecord_t alarmLog[ALARM_LOG_LEN];
+
+// ============ Requests ============
+static AlarmCode_t any_code(void) {
+    return (AlarmCode_t)(1 + xorshift() % (ALARM_CODE_COUNT - 1));
+}
+
+static void request(AlarmTable_t* t, uint32_t now) {
+    uint32_t r = xorshift() % 10000;
+    if (r < 4500) {
+        alarm_raise(t, any_code(), now);
+    } else if (r < 8500) {
+        alarm_clear(t, any_code(), now);
+    } else if (r < 9500) {
+        alarm_ack(t, any_code());
+    } else if (r < 9900) {
+        uint32_t end = alarm_log_end_seq(t);
+        if (end > 0) alarm_log_ack(t, end - 1 - xorshift() % (end < 64 ? end : 64));
+    } else if (r < 9901) {
+        alarm_shelve(t, any_code(), now, 5 + xorshift() % 26);
+    } else if (r < 9910) {
+        alarm_clear_severity(t, (AlarmSeverity_t)(xorshift() % 3), xorshift() & 1, now);
+    }
+}
+
+// ============ Checks ============
+typedef struct {
+    AlarmEntry_t entries[ALARM_MAX_ACTIVE];
+    uint8_t count;
+    bool flood;
+    uint8_t shelved;
+} Visible_t;
+
+static void visible(const AlarmTable_t* t, Visible_t* v) {
+    memset(v, 0, sizeof(*v));
+    memcpy(v->entries, t->entries, t->count * sizeof(AlarmEntry_t));
+    v->count = t->count;
+    v->flood = t->flood;
+    v->shelved = alarm_shelved_count(t);
+}
+
+static void check_table(const AlarmTable_t* t, uint32_t now) {
+    if (t->count > ALARM_MAX_ACTIVE) {
+        fail("table over ALARM_MAX_ACTIVE", now);
+        return;
+    }
+    uint32_t slots = 0;
+    for (uint8_t c = 0; c < ALARM_CODE_COUNT; c++) {
+        uint8_t s = t->slotOf[c];
+        if (s == ALARM_NO_SLOT) continue;
+        slots++;
+        if (s >= t->count || t->entries[s].code != c) fail("slot map points at the wrong entry", now);
+    }
+    if (slots != t->count) fail("slot map and entry count disagree", now);
+
+    for (uint8_t i = 0; i < t->count; i++) {
+        const AlarmEntry_t* e = &t->entries[i];
+        if (i > 0 && e->raisedAt < t->entries[i - 1].raisedAt) fail("entries not oldest first", now);
+        if (t->codes[e->code].flags & ALARM_CODE_SHELVED) fail("shelved code active", now);
+        const AlarmRecord_t* rec = alarm_log_get(t, e->logSeq);
+        if (!rec || rec->code != e->code || (rec->flags & ALARM_REC_CLEARED) ||
+            rec->raisedAt != e->raisedAt) {
+            fail("active entry's log record", now);
+        }
+        if (rec && ((rec->flags & ALARM_REC_ACKED) != 0) != ((e->flags & ALARM_FLAG_ACKED) != 0)) {
+            fail("entry and log record ack differ", now);
+        }
+    }
+}
+
+// The log never wraps here, so every ack is still in it
+static void check_log(const AlarmTable_t* t, uint32_t now) {
+    uint32_t acked = 0;
+    for (uint32_t s = alarm_log_first_seq(t); s < alarm_log_end_seq(t); s++) {
+        if (alarm_log_get(t, s)->flags & ALARM_REC_ACKED) acked++;
+    }
+    if (alarm_log_end_seq(t) <= t->logLen && acked != t->logAcks) fail("log ack count", now);
+}
+
+// ============ Run ============
+typedef struct {
+    uint32_t requests;
+    uint32_t maxChangesPerS;
+    uint32_t maxActive;
+    uint32_t floodSeconds;
+} RunStats_t;
+
+// Storm (perS requests every everyS seconds) then quiet; every request
+// checked when check is set
+static uint32_t run(uint32_t stormS, uint32_t perS, uint32_t everyS, bool check, RunStats_t* rs) {
+    rng = 0x2545F491;
+    alarm_table_init(&table, alarmLog, ALARM_LOG_LEN);
+    memset(rs, 0, sizeof(*rs));
+    uint32_t quietS = ALARM_CHATTER_HOLD_S + 2 * ALARM_FLOOD_WINDOW_S + 2;
+    uint32_t now = 1;
+    Visible_t before, after;
+    for (; now <= stormS + quietS; now++) {
+        uint32_t rev0 = table.revision;
+        bool storm = now <= stormS;
+        uint32_t n = !storm ? (uint32_t)ALARM_CODE_COUNT : now % everyS == 0 ? perS : 0;
+        for (uint32_t k = 0; k < n; k++) {
+            if (check) visible(&table, &before);
+            uint32_t rev = table.revision;
+            uint32_t raised = table.stats.raised;
+            if (storm) request(&table, now);
+            else if (k > 0) alarm_clear(&table, (AlarmCode_t)k, now);
+            rs->requests++;
+            if (!check) continue;
+            visible(&table, &after);
+            if (memcmp(&before, &after, sizeof(before)) != 0 && table.revision == rev) {
+                fail("visible change without a revision bump", now);
+            }
+            if (table.stats.raised != raised && before.flood &&
+                alarm_severity((AlarmCode_t)table.entries[table.count - 1].code) < ALARM_SEV_ERROR) {
+                fail("alarm below error let in during a flood", now);
+            }
+            if (table.count > rs->maxActive) rs->maxActive = table.count;
+            check_table(&table, now);
+        }
+        uint32_t rev = table.revision;
+        if (check) visible(&table, &before);
+        alarm_tick(&table, now);
+        if (check) {
+            visible(&table, &after);
+            if (memcmp(&before, &after, sizeof(before)) != 0 && table.revision == rev) {
+                fail("alarm_tick changed the view without a revision bump", now);
+            }
+            check_table(&table, now);
+            check_log(&table, now);
+        }
+        if (table.revision - rev0 > rs->maxChangesPerS) rs->maxChangesPerS = table.revision - rev0;
+        if (table.flood) rs->floodSeconds++;
+    }
+
+    if (check) {
+        if (table.flood) fail("flood still latched after the quiet period", now);
+        for (uint8_t c = 1; c < ALARM_CODE_COUNT; c++) {
+            if (table.codes[c].flags & (ALARM_CODE_CHATTERING | ALARM_CODE_CLEAR_PENDING)) {
+                fail("chatter latch not released after the quiet period", now);
+                break;
+            }
+        }
+        if (table.count != 0) fail("table not empty after the quiet period", now);
+    }
+    return now - 1;
+}
+
+static void report(const char* name, uint32_t stormS, uint32_t perS, uint32_t everyS) {
+    RunStats_t rs;
+    uint32_t seconds = run(stormS, perS, everyS, true, &rs);
+    const AlarmStats_t* st = &table.stats;
+    printf("%s: %lu s, %lu requests every %lu s, then quiet to %lu s (%lu requests, each checked)\n",
+           name, (unsigned long)stormS, (unsigned long)perS, (unsigned long)everyS,
+           (unsigned long)seconds, (unsigned long)rs.requests);
+    printf("  raised %lu, evicted %lu, dropped %lu, rate-limited %lu, chatter-held %lu, "
+           "shelved-held %lu, flood-held %lu\n",
+           (unsigned long)st->raised, (unsigned long)st->evicted, (unsigned long)st->dropped,
+           (unsigned long)st->rateLimited, (unsigned long)st->chatterHeld,
+           (unsigned long)st->shelvedHeld, (unsigned long)st->floodHeld);
+    printf("  at most %lu active, %lu visible changes in one second, flood for %lu s, "
+           "%lu log records\n",
+           (unsigned long)rs.maxActive, (unsigned long)rs.maxChangesPerS,
+           (unsigned long)rs.floodSeconds, (unsigned long)alarm_log_end_seq(&table));
+}
+
+int main(int argc, char** argv) {
+    uint32_t stormS = 600, perS = 5000;
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-s") == 0) stormS = (uint32_t)atol(argv[a + 1]);
+        else if (strcmp(argv[a], "-r") == 0) perS = (uint32_t)atol(argv[a + 1]);
+    }
+    report("storm", stormS, perS, 1);
+    report("light", stormS, 1, LIGHT_EVERY_S);
+
+    RunStats_t rs;
+    double t = now_ns();
+    run(stormS, perS, 1, false, &rs);
+    double ns = (now_ns() - t) / rs.requests;
+    printf("timing: %.1f ns per request (alarm_tick included)\n", ns);
+
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
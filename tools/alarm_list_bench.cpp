@@ -0,0 +1,188 @@
+// SIGNALTAP Alarm List Bench (host)
+// The virtualized alarm list (src/ui/alarm_list) over alarm logs of 10,
+// 1,000 and 10,000 records, against tools/host/lvgl.h, which draws nothing
+// but counts the widgets created and every widget call.
+//  - Log: one raise and clear every BENCH_STEP_S over the alarm codes, far
+//    enough apart that nothing is rate limited or latched chattering
+//  - List: a 480 px viewport (the alarms screen), in the All and Errors
+//    views; rows in the view, widgets the list created
+//  - Scroll: -n scrolls to random positions, each one LV_EVENT_SCROLL as
+//    LVGL sends it; time and widget calls per scroll
+//  - Update: -n new alarms (raise, clear) each followed by
+//    alarm_list_refresh() at the top of the list, as a tick with a new
+//    alarm does; time and widget calls per update
+//  - Checks, exit 1 on a failure: the list creates the same widgets for
+//    every log length. At 10,000 records, widget calls and time (best of
+//    BENCH_REPEATS rounds) stay within BENCH_MAX_RATIO of: an update at 10
+//    records, for an update and for a scroll (10 records do not scroll, so
+//    their update, which rebinds every row, stands in); a scroll at 1,000
+//    records, for a scroll. Neither grows with the log
+//
+// Build: make -C tools alarm_list_bench (tools/Makefile, against tools/host/Arduino.h
+// and tools/host/lvgl.h)
+//
+// Usage: alarm_list_bench [-n scrolls / updates per round (2000)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/ui/alarm_list.h"
+#include "../src/data/simulation_engine.h"
+
+#define BENCH_VIEW_W        760
+#define BENCH_VIEW_H        480
+#define BENCH_STEP_S        30
+#define BENCH_REPEATS       5
+#define BENCH_MAX_RATIO     3.0
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t rng = 0x2545F491;
+
+static uint32_t xorshift(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint32_t failures = 0;
+
+static void fail(const char* what) {
+    if (failures < 10) printf("  FAILED: %s\n", what);
+    failures++;
+}
+
+// ============ The simulation calls the list makes ============
+static AlarmTable_t table;
+static AlarmRecord_t alarmLog[ALARM_LOG_LEN];
+static uint32_t clockS = 0;
+
+const AlarmTable_t* sim_get_alarm_table(void) {
+    return &table;
+}
+
+void sim_ack_alarm_record(uint32_t seq) {
+    alarm_log_ack(&table, seq);
+}
+
+void sim_shelve_alarm(AlarmCode_t code) {
+    alarm_shelve(&table, code, clockS, 60);
+}
+
+static void add_alarm(void) {
+    AlarmCode_t code = (AlarmCode_t)(1 + table.logWritten % (ALARM_CODE_COUNT - 1));
+    clockS += BENCH_STEP_S;
+    alarm_raise(&table, code, clockS);
+    alarm_clear(&table, code, clockS + 1);
+    alarm_tick(&table, clockS + 1);
+}
+
+// ============ Bench ============
+typedef struct {
+    uint32_t rows;
+    uint32_t objects;
+    double scrollNs, updateNs;          // Best round
+    double scrollCalls, updateCalls;    // Widget calls, per scroll / update
+} Cost_t;
+
+static Cost_t measure(uint32_t records, AlarmView_t v, uint32_t n) {
+    Cost_t c = {};
+    alarm_table_init(&table, alarmLog, ALARM_LOG_LEN);
+    clockS = 0;
+    for (uint32_t i = 0; i < records; i++) add_alarm();
+
+    HostLvStats_t before = hostLv;
+    lv_obj_t* screen = lv_obj_create(NULL);
+    lv_obj_t* list = alarm_list_create(screen, BENCH_VIEW_W, BENCH_VIEW_H);
+    alarm_list_set_view(v);
+    c.rows = alarm_list_row_count();
+    c.objects = hostLv.objects - before.objects;
+
+    int32_t maxY = (int32_t)c.rows * ALARM_LIST_ROW_H - BENCH_VIEW_H;
+    c.scrollNs = c.updateNs = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        uint32_t writes = hostLv.writes;
+        double t = now_ns();
+        for (uint32_t i = 0; i < n; i++) {
+            lv_obj_scroll_to_y(list, maxY > 0 ? (int32_t)(xorshift() % (uint32_t)maxY) : 0, LV_ANIM_OFF);
+        }
+        double ns = (now_ns() - t) / n;
+        if (ns < c.scrollNs) c.scrollNs = ns;
+        c.scrollCalls = (double)(hostLv.writes - writes) / n;
+
+        // New alarms at the top, list scrolled to the top
+        lv_obj_scroll_to_y(list, 0, LV_ANIM_OFF);
+        writes = hostLv.writes;
+        double tu = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            add_alarm();
+            t = now_ns();
+            alarm_list_refresh();
+            tu += now_ns() - t;
+        }
+        if (tu / n < c.updateNs) c.updateNs = tu / n;
+        c.updateCalls = (double)(hostLv.writes - writes) / n;
+    }
+    lv_obj_del(screen);
+    return c;
+}
+
+int main(int argc, char** argv) {
+    uint32_t n = 2000;
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-n") == 0) n = (uint32_t)atol(argv[a + 1]);
+    }
+    if (n < 1) n = 1;
+
+    static const uint32_t lengths[] = {10, 1000, 10000};
+    static const AlarmView_t views[] = {ALARM_VIEW_ALL, ALARM_VIEW_ERRORS};
+    const int count = sizeof(lengths) / sizeof(lengths[0]);
+
+    for (size_t vi = 0; vi < sizeof(views) / sizeof(views[0]); vi++) {
+        Cost_t cost[count];
+        printf("%s view, %d px:\n", alarm_list_view_name(views[vi]), BENCH_VIEW_H);
+        for (int i = 0; i < count; i++) {
+            cost[i] = measure(lengths[i], views[vi], n);
+            printf("  %5lu records: %5lu rows, %3lu widgets | scroll %6.0f ns, %5.1f calls"
+                   " | update %6.0f ns, %5.1f calls\n",
+                   (unsigned long)lengths[i], (unsigned long)cost[i].rows, (unsigned long)cost[i].objects,
+                   cost[i].scrollNs, cost[i].scrollCalls, cost[i].updateNs, cost[i].updateCalls);
+        }
+
+        const Cost_t* small = &cost[0];
+        const Cost_t* large = &cost[count - 1];
+        char what[112];
+        if (large->objects != small->objects) {
+            snprintf(what, sizeof(what), "%s: %lu widgets at 10k records, %lu at 10",
+                     alarm_list_view_name(views[vi]), (unsigned long)large->objects,
+                     (unsigned long)small->objects);
+            fail(what);
+        }
+        // A 10-record list has nothing to scroll: a scroll over 10k records
+        // is held to that list's full rebind (an update), and to 1k records
+        const Cost_t* mid = &cost[count - 2];
+        struct { const char* name; const char* vs; double base, large; } ratios[] = {
+            {"update calls", "10 records", small->updateCalls, large->updateCalls},
+            {"update time",  "10 records", small->updateNs,    large->updateNs},
+            {"scroll calls", "10 records updated", small->updateCalls, large->scrollCalls},
+            {"scroll time",  "10 records updated", small->updateNs,    large->scrollNs},
+            {"scroll calls", "1k records", mid->scrollCalls, large->scrollCalls},
+            {"scroll time",  "1k records", mid->scrollNs,    large->scrollNs},
+        };
+        for (size_t k = 0; k < sizeof(ratios) / sizeof(ratios[0]); k++) {
+            if (ratios[k].large > BENCH_MAX_RATIO * ratios[k].base) {
+                snprintf(what, sizeof(what), "%s: %s %.1fx at 10k records vs %s", alarm_list_view_name(views[vi]),
+                         ratios[k].name, ratios[k].large / ratios[k].base, ratios[k].vs);
+                fail(what);
+            }
+        }
+    }
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
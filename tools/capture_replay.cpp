@@ -0,0 +1,187 @@
+// SIGNALTAP Capture Replayer (host)
+// Maps a stream capture (src/storage/capture.h) and feeds it through the
+// simulation's replay path - history, alarms, RUL trend and the anomaly
+// model - as fast as the host runs. Can also record captures from the
+// simulation for a given demo and length.
+//
+// -c records, then replays the capture from the start and from a seek to
+// its middle, and deletes it; exit 1 unless every tick comes back, no byte is skipped as
+// damaged, and the replay ends on the live run's sensors, AI state and
+// alarm count.
+//
+// Build: make -C tools capture_replay (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage:
+//   capture_replay <capture.bin> [from-tick] [print-every]
+//   capture_replay -r <capture.bin> <demo> <seconds>
+//   capture_replay -c <capture.bin> <demo> <seconds>
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/data/simulation_engine.h"
+
+static double wall_s(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static bool file_sink(const uint8_t* data, uint32_t len, void* ctx) {
+    return fwrite(data, 1, len, (FILE*)ctx) == len;
+}
+
+static int record(const char* path, int demo, uint32_t seconds) {
+    FILE* fp = fopen(path, "wb");
+    if (!fp) {
+        perror(path);
+        return 1;
+    }
+    sim_init();
+    sim_set_demo((uint8_t)demo);
+    if (!sim_capture_start(file_sink, fp)) {
+        fprintf(stderr, "capture start failed\n");
+        return 1;
+    }
+    sim_step(SIM_TICK_MS, seconds);
+    fclose(fp);
+
+    const CaptureStats_t* st = sim_get_capture_stats();
+    printf("%s: demo %d, %lu ticks, %lu keyframes, %lu bytes (%.1f B/tick)\n", path, demo,
+           (unsigned long)st->records, (unsigned long)st->keyframes, (unsigned long)st->bytes,
+           st->records ? (double)st->bytes / st->records : 0.0);
+    return 0;
+}
+
+static int play(const char* path, uint32_t from, uint32_t every) {
+    CaptureFile_t file;
+    if (!capture_file_open(&file, path)) {
+        fprintf(stderr, "%s: cannot map\n", path);
+        return 1;
+    }
+    sim_init();
+    if (!sim_replay_start(file.data, file.len) || (from && !sim_replay_seek(from))) {
+        fprintf(stderr, "%s: not a capture, or tick %lu not in it\n", path, (unsigned long)from);
+        return 1;
+    }
+
+    const CaptureReader_t* rd = sim_get_replay();
+    double t0 = wall_s();
+    uint32_t ticks = 0;
+    while (sim_replay_active()) {
+        uint32_t ran = sim_step(SIM_TICK_MS, every ? every : 4096);
+        ticks += ran;
+        if (!every || ran == 0) continue;
+
+        const DemoProfile_t* demo = sim_get_demo();
+        printf("tick %7lu  %-10s health %3u  risk %5.1f%%  anomaly %5.1f (%u)  alarms %u  ttf %s\n",
+               (unsigned long)rd->frame.tick, sim_get_scenario_name(), demo->ai.healthScore,
+               demo->ai.failureProbability, demo->ai.anomalyScore, demo->ai.anomalyCount,
+               sim_get_alarm_count(), sim_get_state()->rulTimeframe);
+    }
+    double wall = wall_s() - t0;
+
+    const NnStats_t* nn = anomaly_get_stats();
+    printf("%s: demo %u, %lu ticks in %.3f s = %.0f ticks/s (%.1f simulated h per s), "
+           "%.1f MB/s, %lu model runs, %lu damaged bytes skipped\n",
+           path, rd->header.demo, (unsigned long)ticks, wall, ticks / wall,
+           ticks * (rd->header.tickMs / 1000.0) / 3600.0 / wall, file.len / wall / 1e6,
+           (unsigned long)nn->inferences, (unsigned long)rd->skipped);
+    capture_file_close(&file);
+    return 0;
+}
+
+// ============ Check ============
+typedef struct {
+    float sensors[3];
+    AIState_t ai;
+    uint8_t alarms;
+} EndState_t;
+
+static void end_state(EndState_t* e) {
+    const DemoProfile_t* demo = sim_get_demo();
+    memset(e, 0, sizeof(*e));
+    for (int i = 0; i < 3; i++) e->sensors[i] = demo->sensors[i].value;
+    e->ai.healthScore = demo->ai.healthScore;
+    e->ai.anomalyScore = demo->ai.anomalyScore;
+    e->ai.anomalyCount = demo->ai.anomalyCount;
+    e->ai.failureProbability = demo->ai.failureProbability;
+    e->alarms = sim_get_alarm_count();
+}
+
+static bool replay_to_end(const CaptureFile_t* file, uint32_t from, uint32_t* ticks, EndState_t* e) {
+    sim_init();
+    if (!sim_replay_start(file->data, file->len) || (from && !sim_replay_seek(from))) return false;
+    *ticks = 0;
+    while (sim_replay_active()) *ticks += sim_step(SIM_TICK_MS, 4096);
+    end_state(e);
+    return sim_get_replay()->skipped == 0;
+}
+
+static bool same_end(const EndState_t* a, const EndState_t* b) {
+    return memcmp(a->sensors, b->sensors, sizeof(a->sensors)) == 0 &&
+           a->ai.healthScore == b->ai.healthScore && a->ai.anomalyScore == b->ai.anomalyScore &&
+           a->ai.anomalyCount == b->ai.anomalyCount &&
+           a->ai.failureProbability == b->ai.failureProbability && a->alarms == b->alarms;
+}
+
+static int check(const char* path, int demo, uint32_t seconds) {
+    if (record(path, demo, seconds) != 0) return 1;
+    EndState_t live, replayed, sought;
+    end_state(&live);
+    uint32_t records = sim_get_capture_stats()->records;
+
+    CaptureFile_t file;
+    if (!capture_file_open(&file, path)) {
+        fprintf(stderr, "%s: cannot map\n", path);
+        return 1;
+    }
+    uint32_t failures = 0, ticks = 0, seekTicks = 0;
+    if (!replay_to_end(&file, 0, &ticks, &replayed)) {
+        printf("  FAILED: replay did not start, or skipped damaged bytes\n");
+        failures++;
+    } else if (ticks != records) {
+        printf("  FAILED: %lu ticks replayed of %lu recorded\n", (unsigned long)ticks, (unsigned long)records);
+        failures++;
+    } else if (!same_end(&live, &replayed)) {
+        printf("  FAILED: replay ends on health %u risk %.2f anomaly %.2f (%u), %u alarms; "
+               "live run on %u %.2f %.2f (%u), %u\n",
+               replayed.ai.healthScore, replayed.ai.failureProbability, replayed.ai.anomalyScore,
+               replayed.ai.anomalyCount, replayed.alarms, live.ai.healthScore, live.ai.failureProbability,
+               live.ai.anomalyScore, live.ai.anomalyCount, live.alarms);
+        failures++;
+    }
+    uint32_t from = records / 2;
+    if (!replay_to_end(&file, from, &seekTicks, &sought) ||
+        seekTicks + from != records ||
+        memcmp(sought.sensors, live.sensors, sizeof(live.sensors)) != 0) {
+        printf("  FAILED: replay from tick %lu does not reach the recorded end\n", (unsigned long)from);
+        failures++;
+    }
+    capture_file_close(&file);
+    remove(path);
+    printf("replayed %lu of %lu ticks, from tick %lu: %lu; end state %s the live run's\n",
+           (unsigned long)ticks, (unsigned long)records, (unsigned long)from, (unsigned long)seekTicks,
+           same_end(&live, &replayed) ? "matches" : "differs from");
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 5 && strcmp(argv[1], "-r") == 0) {
+        return record(argv[2], atoi(argv[3]), (uint32_t)strtoul(argv[4], NULL, 0));
+    }
+    if (argc >= 5 && strcmp(argv[1], "-c") == 0) {
+        return check(argv[2], atoi(argv[3]), (uint32_t)strtoul(argv[4], NULL, 0));
+    }
+    if (argc >= 2 && argv[1][0] != '-') {
+        uint32_t from = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : 0;
+        uint32_t every = argc > 3 ? (uint32_t)strtoul(argv[3], NULL, 0) : 0;
+        return play(argv[1], from, every);
+    }
+    fprintf(stderr, "usage: %s <capture.bin> [from-tick] [print-every]\n"
+                    "       %s -r <capture.bin> <demo> <seconds>\n"
+                    "       %s -c <capture.bin> <demo> <seconds>\n", argv[0], argv[0], argv[0]);
+    return 2;
+}
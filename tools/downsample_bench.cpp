@@ -0,0 +1,217 @@
+// SIGNALTAP Trend Downsampling Bench (host)
+// Times and checks the chart reducers (src/data/downsample) from 10k to
+// 1M samples, and the Sensors screen's sparkline refresh as it runs on
+// the device: the last 10 minutes decoded from a day of compressed history
+// (src/data/history_block), then LTTB per sensor.
+//  - Input: a drifting sensor with noise, a slow cycle and one isolated
+//    spike; output 320 points (the widest chart)
+//  - LTTB: points kept, time per call and per input sample, and the shape
+//    error (mean distance of the line from the samples, % of the range)
+//  - Envelope (ds_minmax_points, one column per 2 px) for comparison
+//  - Checks, exit 1 on a failure: at most 320 points, first and last kept,
+//    x strictly increasing, every point an input sample, the spike kept by
+//    both; the envelope also holds the exact minimum and maximum
+//
+// Build: make -C tools downsample_bench (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage: downsample_bench [-n largest input (1000000)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "../src/data/downsample.h"
+#include "../src/data/history_block.h"
+
+#define BENCH_POINTS    320
+#define SPARK_SPAN_S    600         // As SPARKLINE_SPAN_S in ui_manager.cpp
+#define HISTORY_S       86400
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t rng = 0x2545F491;
+
+static uint32_t xorshift(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static float noise(void) {
+    return ((xorshift() & 0xFFFF) / 65535.0f - 0.5f);
+}
+
+// ============ Input ============
+static void make_signal(float* data, uint32_t n, uint32_t spikeAt) {
+    float drift = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        drift += 0.002f * noise();
+        data[i] = 50.0f + 5.0f * sinf(i * 6.2831853f / (n / 7.0f + 1)) + drift + 0.8f * noise();
+        if (i == spikeAt) data[i] += 40.0f;
+    }
+}
+
+// ============ Checks ============
+static uint32_t failures = 0;
+
+static void fail(const char* what, uint32_t n) {
+    if (failures < 10) printf("  FAILED at %lu samples: %s\n", (unsigned long)n, what);
+    failures++;
+}
+
+static void check_lttb(const float* data, uint32_t n, const DsPoint_t* p, uint32_t count, uint32_t spikeAt) {
+    if (count > BENCH_POINTS || (n > BENCH_POINTS && count != BENCH_POINTS)) fail("lttb point count", n);
+    if (p[0].x != 0 || p[count - 1].x != (float)(n - 1)) fail("lttb first/last", n);
+    bool spike = false;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t x = (uint32_t)p[i].x;
+        if ((float)x != p[i].x || x >= n || p[i].y != data[x]) {
+            fail("lttb point is not an input sample", n);
+            break;
+        }
+        if (i > 0 && p[i].x <= p[i - 1].x) {
+            fail("lttb x not increasing", n);
+            break;
+        }
+        if (x == spikeAt) spike = true;
+    }
+    if (!spike) fail("lttb lost the spike", n);
+}
+
+static void check_envelope(const float* data, uint32_t n, const DsPoint_t* p, uint32_t count) {
+    float lo = data[0], hi = data[0];
+    for (uint32_t i = 1; i < n; i++) {
+        if (data[i] < lo) lo = data[i];
+        if (data[i] > hi) hi = data[i];
+    }
+    bool haveLo = false, haveHi = false;
+    for (uint32_t i = 0; i < count; i++) {
+        if (p[i].y == lo) haveLo = true;
+        if (p[i].y == hi) haveHi = true;
+        if (i > 0 && p[i].x < p[i - 1].x) {
+            fail("envelope x decreasing", n);
+            break;
+        }
+    }
+    if (!haveLo || !haveHi) fail("envelope lost the minimum or maximum", n);
+}
+
+// Mean distance of the reduced line from every sample, % of the range
+static float shape_error(const float* data, uint32_t n, const DsPoint_t* p, uint32_t count) {
+    float lo = data[0], hi = data[0];
+    double sum = 0;
+    uint32_t seg = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        if (data[i] < lo) lo = data[i];
+        if (data[i] > hi) hi = data[i];
+        while (seg + 2 < count && p[seg + 1].x < (float)i) seg++;
+        float x0 = p[seg].x, x1 = p[seg + 1].x;
+        float y = p[seg].y + (p[seg + 1].y - p[seg].y) * ((float)i - x0) / (x1 - x0);
+        sum += fabsf(y - data[i]);
+    }
+    return hi > lo ? (float)(sum / n / (hi - lo) * 100.0) : 0.0f;
+}
+
+// ============ Reducers ============
+static void reduce(uint32_t n) {
+    float* data = (float*)calloc(n, sizeof(float));
+    if (!data) {
+        fail("out of memory", n);
+        return;
+    }
+    DsPoint_t out[BENCH_POINTS];
+    DsColumn_t cols[BENCH_POINTS / 2];
+    uint32_t spikeAt = n / 3 + 17;
+    make_signal(data, n, spikeAt);
+
+    DsSeries_t s;
+    ds_series_array(&s, data, n);
+    int rounds = n >= 1000000 ? 5 : (int)(5000000 / n);
+
+    double t = now_ns();
+    uint32_t count = 0;
+    for (int r = 0; r < rounds; r++) count = ds_lttb(&s, out, BENCH_POINTS);
+    double lttbNs = (now_ns() - t) / rounds;
+    check_lttb(data, n, out, count, spikeAt);
+    float err = shape_error(data, n, out, count);
+
+    t = now_ns();
+    uint32_t envCount = 0;
+    for (int r = 0; r < rounds; r++) envCount = ds_minmax_points(&s, out, cols, BENCH_POINTS / 2, (float)BENCH_POINTS);
+    double envNs = (now_ns() - t) / rounds;
+    check_envelope(data, n, out, envCount);
+
+    printf("  %8lu samples: lttb %4lu points in %8.1f us (%.2f ns/sample, shape error %.2f%%), "
+           "envelope %4lu points in %8.1f us (%.2f ns/sample)\n",
+           (unsigned long)n, (unsigned long)count, lttbNs / 1e3, lttbNs / n, err,
+           (unsigned long)envCount, envNs / 1e3, envNs / n);
+    free(data);
+}
+
+// ============ Sparkline refresh ============
+// hblock_read_last + de-interleave + LTTB per sensor, as load_sparkline_window
+// and update_sparkline do it
+static void sparkline_refresh(void) {
+    static HistoryBlock_t block;
+    if (!hblock_init(&block)) {
+        printf("sparkline refresh: no history block\n");
+        failures++;
+        return;
+    }
+    float drift[HBLOCK_SERIES] = {0};
+    for (uint32_t t = 0; t < HISTORY_S; t++) {
+        float v[HBLOCK_SERIES];
+        for (int ch = 0; ch < HBLOCK_SERIES; ch++) {
+            drift[ch] += 0.01f * noise();
+            v[ch] = roundf((20.0f * (ch + 1) + drift[ch] + noise()) * 10.0f) / 10.0f;
+        }
+        hblock_append(&block, t, v);
+    }
+
+    static float raw[SPARK_SPAN_S * HBLOCK_SERIES];
+    static float window[HBLOCK_SERIES][SPARK_SPAN_S];
+    DsPoint_t out[BENCH_POINTS];
+    const int rounds = 2000;
+    double decodeNs = 0, lttbNs = 0;
+    uint32_t n = 0;
+    for (int r = 0; r < rounds; r++) {
+        double t = now_ns();
+        n = hblock_read_last(&block, SPARK_SPAN_S, raw);
+        for (uint32_t i = 0; i < n; i++) {
+            for (int ch = 0; ch < HBLOCK_SERIES; ch++) window[ch][i] = raw[i * HBLOCK_SERIES + ch];
+        }
+        double t1 = now_ns();
+        for (int ch = 0; ch < HBLOCK_SERIES; ch++) {
+            DsSeries_t s;
+            ds_series_array(&s, window[ch], n);
+            ds_lttb(&s, out, 250);
+        }
+        decodeNs += t1 - t;
+        lttbNs += now_ns() - t1;
+    }
+    if (n != SPARK_SPAN_S) fail("sparkline window short", n);
+
+    const HBlockStats_t* st = hblock_get_stats(&block);
+    printf("sparkline refresh: last %u s of %u s history (%.2f bytes/sample, %.1fx): decode %.1f us, "
+           "lttb x3 %.1f us\n",
+           SPARK_SPAN_S, HISTORY_S, st->bytesPerSample, st->compressionRatio,
+           decodeNs / rounds / 1e3, lttbNs / rounds / 1e3);
+}
+
+int main(int argc, char** argv) {
+    uint32_t largest = 1000000;
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-n") == 0) largest = (uint32_t)atol(argv[a + 1]);
+    }
+    printf("reduce to %u points (envelope: %u columns):\n", BENCH_POINTS, BENCH_POINTS / 2);
+    for (uint32_t n = 10000; n <= largest; n *= 10) reduce(n);
+    sparkline_refresh();
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,191 @@
+// SIGNALTAP Number Formatting Bench (host)
+// Checks the UI's fixed-point formatter (src/ui/ui_format) against
+// snprintf("%.*f") and times both.
+//  - Exactness: random floats of every magnitude the formatter takes,
+//    a sweep of every 397th float in [0, 16384), and exact ties (multiples
+//    of 1/64), each at 0..6 decimals; the output must match byte for byte
+//  - Time per value for the label formats the UI uses
+//  - Change detection: every demo's sensors from the simulation at one
+//    tick per second, through a FmtCache_t each, as the Sensors screen
+//    refreshes them; reports how many label updates are skipped
+//
+// Build: make -C tools format_bench (tools/Makefile, against tools/host/Arduino.h)
+// Run it from a scratch directory: the simulation's store writes there.
+//
+// Usage: format_bench [-t ticks (3600)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/ui/ui_format.h"
+#include "../src/data/simulation_engine.h"
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t rng = 0x2545F491;
+
+static uint32_t xorshift(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+// ============ Exactness ============
+typedef struct {
+    uint64_t checked;
+    uint64_t wrong;
+} Check_t;
+
+static void check(Check_t* c, float v, uint8_t d) {
+    char a[64], b[64];
+    fmt_fixed(a, sizeof(a), v, d, NULL);
+    snprintf(b, sizeof(b), "%.*f", d, v);
+    c->checked++;
+    if (strcmp(a, b) != 0) {
+        if (c->wrong < 5) printf("  mismatch: %.9g at %u decimals: \"%s\" vs printf \"%s\"\n", v, d, a, b);
+        c->wrong++;
+    }
+}
+
+static float from_bits(uint32_t bits) {
+    float v;
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+static uint64_t exactness(void) {
+    Check_t c = {0, 0};
+    // Random bit patterns, finite and under 2^43
+    for (int i = 0; i < 4000000; i++) {
+        float v = from_bits(xorshift());
+        if (v != v || fabsf(v) >= 8796093022208.0f) continue;
+        check(&c, v, (uint8_t)(xorshift() % (FMT_MAX_DECIMALS + 1)));
+    }
+    uint64_t random = c.checked;
+
+    // Every 397th float from 0 to 16384, at the precisions labels use
+    uint32_t end;
+    float top = 16384.0f;
+    memcpy(&end, &top, sizeof(end));
+    for (uint32_t bits = 0; bits < end; bits += 397) {
+        float v = from_bits(bits);
+        for (uint8_t d = 0; d <= 3; d++) {
+            check(&c, v, d);
+            check(&c, -v, d);
+        }
+    }
+    uint64_t sweep = c.checked - random;
+
+    // Exact ties: k / 64 rounds half to even at 0..5 decimals
+    for (int k = -6400; k <= 6400; k++) {
+        for (uint8_t d = 0; d <= 5; d++) check(&c, k / 64.0f, d);
+    }
+    uint64_t ties = c.checked - random - sweep;
+
+    // NaN, infinities, signed zero
+    const float special[] = {0.0f, -0.0f, 1.0f / 0.0f, -1.0f / 0.0f, 0.0f / 0.0f, 1e-45f, 9.5f, 0.05f};
+    for (size_t i = 0; i < sizeof(special) / sizeof(special[0]); i++) {
+        for (uint8_t d = 0; d <= FMT_MAX_DECIMALS; d++) check(&c, special[i], d);
+    }
+
+    printf("exactness: %llu values (%llu random, %llu sweep, %llu ties, specials), %llu differ from snprintf\n",
+           (unsigned long long)c.checked, (unsigned long long)random, (unsigned long long)sweep,
+           (unsigned long long)ties, (unsigned long long)c.wrong);
+    return c.wrong;
+}
+
+// ============ Timing ============
+// Typical label values and their decimals
+static const struct {
+    float v;
+    uint8_t d;
+} labels[] = {
+    {23.47f, 1}, {1013.25f, 1}, {0.853f, 2}, {1450.0f, 0}, {72.5f, 1},
+    {-12.3f, 1}, {3.14159f, 3}, {98.6f, 1}, {4.7f, 2}, {250.0f, 0},
+};
+#define LABELS (sizeof(labels) / sizeof(labels[0]))
+
+static volatile int sink;
+
+static void timing(void) {
+    const int rounds = 200000;
+    char buf[32];
+    double t = now_ns();
+    for (int r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < LABELS; i++) sink += fmt_fixed(buf, sizeof(buf), labels[i].v + r * 1e-3f, labels[i].d, NULL);
+    }
+    double fmtNs = (now_ns() - t) / (rounds * LABELS);
+    t = now_ns();
+    for (int r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < LABELS; i++) sink += snprintf(buf, sizeof(buf), "%.*f", labels[i].d, labels[i].v + r * 1e-3f);
+    }
+    double printfNs = (now_ns() - t) / (rounds * LABELS);
+    t = now_ns();
+    for (int r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < LABELS; i++) sink += fmt_value_unit(buf, sizeof(buf), labels[i].v + r * 1e-3f, labels[i].d, "kPa");
+    }
+    double unitNs = (now_ns() - t) / (rounds * LABELS);
+    t = now_ns();
+    for (int r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < LABELS; i++) sink += snprintf(buf, sizeof(buf), "%.*f %s", labels[i].d, labels[i].v + r * 1e-3f, "kPa");
+    }
+    double unitPrintfNs = (now_ns() - t) / (rounds * LABELS);
+    // One cache per label: the value stays, so every update after the
+    // first stops at the compare
+    FmtCache_t cache[LABELS];
+    for (size_t i = 0; i < LABELS; i++) fmt_cache_reset(&cache[i]);
+    t = now_ns();
+    for (int r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < LABELS; i++) sink += fmt_cache_update(&cache[i], labels[i].v, labels[i].d, NULL);
+    }
+    double cacheNs = (now_ns() - t) / (rounds * LABELS);
+
+    printf("time per value: fmt_fixed %.1f ns, snprintf \"%%.*f\" %.1f ns (%.1fx)\n", fmtNs, printfNs, printfNs / fmtNs);
+    printf("                fmt_value_unit %.1f ns, snprintf \"%%.*f %%s\" %.1f ns (%.1fx)\n", unitNs, unitPrintfNs,
+           unitPrintfNs / unitNs);
+    printf("                fmt_cache_update, digits unchanged: %.1f ns\n", cacheNs);
+}
+
+// ============ Change detection ============
+static void change_detection(uint32_t ticks) {
+    FmtCache_t cache[DEMO_COUNT][3];
+    uint32_t updates = 0, changed = 0;
+    sim_init();
+    for (uint8_t d = 0; d < DEMO_COUNT; d++) {
+        sim_set_demo(d);
+        for (int i = 0; i < 3; i++) fmt_cache_reset(&cache[d][i]);
+        uint32_t demoChanged = 0;
+        for (uint32_t k = 0; k < ticks; k++) {
+            sim_step(1000, 1);
+            DemoProfile_t* demo = sim_get_demo();
+            for (int i = 0; i < 3; i++) {
+                Sensor_t* s = &demo->sensors[i];
+                updates++;
+                if (fmt_cache_update(&cache[d][i], s->value, s->decimals, NULL)) demoChanged++;
+            }
+        }
+        printf("  %-22s %5.1f%% of sensor label updates change the digits\n", sim_get_demo()->name,
+               demoChanged * 100.0 / (ticks * 3));
+        changed += demoChanged;
+    }
+    printf("change detection: %lu label refreshes over %lu s per demo, %lu skipped (%.1f%%)\n",
+           (unsigned long)updates, (unsigned long)ticks, (unsigned long)(updates - changed),
+           (updates - changed) * 100.0 / updates);
+}
+
+int main(int argc, char** argv) {
+    uint32_t ticks = 3600;
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-t") == 0) ticks = (uint32_t)atol(argv[a + 1]);
+    }
+    uint64_t wrong = exactness();
+    timing();
+    change_detection(ticks);
+    return wrong ? 1 : 0;
+}
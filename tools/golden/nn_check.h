@@ -0,0 +1,331 @@
+// SIGNALTAP int8 runtime check vectors (generated by tools/nn_export.py --check - do not edit)
+// Conv1d 3x3 pad 1 (ReLU) -> conv1d 5x8 stride 2 pad 2 (ReLU) -> dense 32 -> 48,
+// and the default model, on 48 int8 windows; outputs from run_blob_q()
+#ifndef NN_CHECK_H
+#define NN_CHECK_H
+
+#include <Arduino.h>
+
+#define NN_CHECK_WINDOWS     48
+#define NN_CHECK_VALUES      48
+#define NN_CHECK_DEFAULT_CRC 0x953eb4efu   // CRC-32 of the default model these were run on
+
+alignas(4) static const uint8_t nnCheckBlob[2588] = {
+    0x53, 0x54, 0x4e, 0x4e, 0x01, 0x00, 0x03, 0x00, 0x10, 0x00, 0x03, 0x00, 0x81, 0x80, 0x80, 0x3b,
+    0x80, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x0a, 0x00, 0x00, 0x01, 0x01, 0x08, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x6d, 0xd0, 0x6b, 0x3b, 0x80, 0xff, 0xff, 0xff,
+    0xa8, 0x00, 0x00, 0x00, 0x29, 0x38, 0x7f, 0xac, 0x87, 0x5a, 0xd2, 0xdd, 0x57, 0xa2, 0x79, 0xfd,
+    0x81, 0x7c, 0x16, 0x83, 0x64, 0x51, 0x3e, 0x29, 0x7f, 0x82, 0x7a, 0x25, 0xc0, 0x1d, 0xd6, 0x2c,
+    0x3c, 0x07, 0x8a, 0xe0, 0xc6, 0x49, 0x7f, 0x51, 0x08, 0xac, 0x35, 0xc4, 0x7f, 0xac, 0x78, 0x84,
+    0x47, 0xc2, 0x1e, 0xde, 0xb3, 0xe7, 0x7f, 0xc5, 0xc8, 0x71, 0x9c, 0xd4, 0x05, 0x05, 0x99, 0x52,
+    0xfd, 0x81, 0xce, 0x81, 0xd3, 0x91, 0xba, 0x10, 0x36, 0xc7, 0xf6, 0x04, 0xa1, 0x40, 0x00, 0x00,
+    0x87, 0x55, 0x00, 0x00, 0x2c, 0x47, 0x00, 0x00, 0x0f, 0x74, 0x00, 0x00, 0xa4, 0x11, 0x00, 0x00,
+    0xea, 0x19, 0x00, 0x00, 0xb2, 0x69, 0xff, 0xff, 0x7b, 0x28, 0xff, 0xff, 0xdf, 0x64, 0xae, 0x55,
+    0x06, 0x31, 0x5c, 0x50, 0x03, 0xb0, 0x5d, 0x5c, 0x81, 0x3e, 0xd7, 0x50, 0xef, 0x03, 0x3a, 0x5d,
+    0x8d, 0x8b, 0x67, 0x76, 0x6e, 0x0e, 0x97, 0x4c, 0x5e, 0xb1, 0x02, 0x53, 0xf8, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x01, 0x01, 0x04, 0x00,
+    0x08, 0x00, 0x05, 0x00, 0x02, 0x00, 0x02, 0x00, 0x43, 0xa6, 0xec, 0x3a, 0x80, 0xff, 0xff, 0xff,
+    0xd0, 0x00, 0x00, 0x00, 0x8f, 0x4c, 0xcc, 0x1d, 0x99, 0x10, 0xe9, 0xf6, 0x81, 0x65, 0x58, 0x3e,
+    0x1f, 0xba, 0xb1, 0x56, 0xd4, 0xe2, 0x61, 0xd8, 0x7e, 0xaf, 0x5a, 0xcb, 0xa3, 0xf6, 0x53, 0x9a,
+    0x18, 0x5b, 0x88, 0xfe, 0xd0, 0xf8, 0x55, 0xf0, 0xce, 0xb4, 0x51, 0xa7, 0x37, 0x7f, 0x31, 0x67,
+    0xa0, 0x1c, 0x1c, 0x94, 0xef, 0xce, 0xa0, 0xe7, 0x96, 0x6c, 0xaa, 0x0c, 0x36, 0x85, 0x71, 0x6c,
+    0x15, 0x05, 0x5a, 0x1a, 0xb9, 0x6e, 0xb4, 0x0f, 0x0c, 0x44, 0xde, 0x23, 0xb5, 0x32, 0xa9, 0xd9,
+    0x05, 0x3a, 0x69, 0x77, 0xf8, 0x90, 0x19, 0x15, 0x3c, 0x8b, 0x4c, 0xa0, 0x56, 0x7c, 0x0b, 0xf3,
+    0x29, 0xa2, 0x29, 0x5a, 0x70, 0x34, 0x38, 0x78, 0xe2, 0xd6, 0x7f, 0x8f, 0xd8, 0x3f, 0x72, 0x4d,
+    0xaf, 0x4d, 0xb8, 0x07, 0x1d, 0x7d, 0xb8, 0xd9, 0xce, 0xcb, 0xa9, 0xe7, 0xc2, 0xc1, 0x59, 0x98,
+    0xf6, 0x86, 0x8a, 0x5d, 0x4c, 0x72, 0x99, 0x4a, 0xca, 0x4d, 0x12, 0xee, 0x20, 0xc0, 0x09, 0x5b,
+    0x26, 0x44, 0x7c, 0x9c, 0x49, 0x7a, 0x0b, 0xd5, 0x25, 0x98, 0x44, 0x40, 0x82, 0x09, 0xfe, 0x3e,
+    0xec, 0x92, 0x81, 0xc6, 0x7d, 0x30, 0xff, 0xff, 0xee, 0x96, 0x00, 0x00, 0xc5, 0xd6, 0x00, 0x00,
+    0xcd, 0x28, 0x00, 0x00, 0xd4, 0x57, 0xbd, 0x50, 0x66, 0x30, 0x97, 0x50, 0xb1, 0xb6, 0xee, 0x4f,
+    0xc2, 0x47, 0xb4, 0x4d, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0x00, 0x00, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xdd, 0xa7, 0x02, 0x3b, 0xf7, 0xff, 0xff, 0xff, 0x40, 0x08, 0x00, 0x00, 0xab, 0x10, 0xfc, 0x26,
+    0x78, 0xdf, 0x17, 0xfe, 0xa5, 0xf7, 0x7b, 0x3e, 0xb1, 0xd4, 0xb0, 0xe9, 0xf6, 0xa1, 0xee, 0x7f,
+    0xe4, 0x24, 0x7d, 0xe2, 0xd6, 0xef, 0xa7, 0x8f, 0xa2, 0x31, 0x4a, 0x47, 0xa3, 0xc8, 0x6a, 0x3a,
+    0xe3, 0x40, 0xc4, 0x97, 0x6a, 0x5e, 0xfe, 0xeb, 0x6c, 0x0f, 0x7a, 0x81, 0x26, 0xc0, 0x37, 0x6d,
+    0x84, 0x2c, 0x52, 0xfc, 0x9e, 0xff, 0x33, 0x0a, 0x11, 0xd2, 0xd3, 0xbe, 0x3b, 0x81, 0x19, 0x2b,
+    0xf2, 0xec, 0x48, 0x01, 0x8d, 0x3a, 0x7b, 0x7d, 0x5e, 0x89, 0x10, 0xaf, 0x55, 0x9f, 0x00, 0x67,
+    0xb0, 0x43, 0x7c, 0xf0, 0xfe, 0x93, 0x6c, 0xa7, 0x41, 0x39, 0xc4, 0x7d, 0x6f, 0x20, 0xeb, 0xfd,
+    0xf1, 0x2a, 0x7f, 0x97, 0xc7, 0x08, 0x20, 0x33, 0x6d, 0x57, 0xdd, 0xe8, 0x10, 0x70, 0xb7, 0xa3,
+    0xce, 0x37, 0x23, 0xf0, 0xff, 0x2e, 0x5d, 0x87, 0x02, 0x86, 0x46, 0xfe, 0x75, 0x36, 0x4f, 0xfc,
+    0x4c, 0xbb, 0xa3, 0x19, 0xff, 0x0c, 0x56, 0x0d, 0x31, 0x33, 0xeb, 0x53, 0x32, 0x1e, 0x6a, 0x2e,
+    0xf4, 0xba, 0x64, 0x7f, 0xe9, 0x1c, 0x18, 0x41, 0x0a, 0x39, 0x53, 0xbd, 0x36, 0x48, 0x1a, 0x71,
+    0x6c, 0xbe, 0xea, 0x62, 0x5b, 0xb6, 0xb8, 0xa9, 0x7d, 0x8d, 0x4f, 0x3f, 0xfe, 0x8f, 0xf1, 0x76,
+    0x9e, 0xec, 0x44, 0xbf, 0xd9, 0x05, 0xf2, 0x28, 0x76, 0x81, 0x34, 0xe6, 0x9e, 0x2e, 0x38, 0x41,
+    0x11, 0x84, 0xca, 0x42, 0xb2, 0x2c, 0xd2, 0x0f, 0x3c, 0xd5, 0x9e, 0x77, 0xf4, 0x4e, 0xa3, 0x2b,
+    0x4c, 0x11, 0x35, 0x76, 0x81, 0x1a, 0x44, 0x5e, 0x20, 0x26, 0x47, 0xa6, 0xd7, 0x98, 0xc1, 0x92,
+    0xaf, 0x2a, 0xaf, 0xb4, 0x11, 0xd7, 0xa8, 0x9a, 0x66, 0x0a, 0xaf, 0xb9, 0xc8, 0x72, 0x47, 0xd2,
+    0xca, 0x4e, 0xe2, 0xfa, 0xdd, 0xe8, 0x6c, 0x21, 0x77, 0xe8, 0x7f, 0x37, 0x55, 0xf1, 0xbd, 0x5c,
+    0xa1, 0x13, 0xfe, 0x7f, 0x3b, 0x40, 0x90, 0xdb, 0x2d, 0x6c, 0x49, 0x77, 0x55, 0x08, 0x7a, 0xb5,
+    0x01, 0xbd, 0x65, 0x05, 0xcf, 0x76, 0xbf, 0x6d, 0x17, 0x57, 0x76, 0x01, 0xa2, 0x24, 0x51, 0xa8,
+    0xa0, 0x9d, 0xef, 0x48, 0x6c, 0xa7, 0xfd, 0x07, 0x5f, 0x81, 0x86, 0xcd, 0xa7, 0xe3, 0xb0, 0x79,
+    0xaf, 0x66, 0xcd, 0x9b, 0xd0, 0x66, 0x7d, 0x12, 0x36, 0x1f, 0x2e, 0x6c, 0x28, 0x6a, 0xe1, 0x22,
+    0xf6, 0x0a, 0xa9, 0x4c, 0x0d, 0x4a, 0x38, 0xe7, 0x83, 0x7f, 0x16, 0xa6, 0x15, 0xd1, 0xbb, 0xb8,
+    0x1f, 0xad, 0x26, 0xb9, 0x90, 0x50, 0x87, 0xfb, 0x9e, 0xf6, 0x66, 0x0d, 0x64, 0x1d, 0xb7, 0x9e,
+    0x5c, 0x4c, 0x81, 0x75, 0x32, 0x6a, 0xe6, 0x52, 0xea, 0x23, 0x0f, 0x18, 0x0c, 0x98, 0xff, 0xb4,
+    0x88, 0xda, 0xae, 0xec, 0x5a, 0x89, 0xad, 0x7e, 0x67, 0x71, 0x42, 0x07, 0xed, 0x9e, 0x39, 0x12,
+    0x1a, 0xef, 0x46, 0x49, 0x1d, 0x0a, 0xe1, 0x23, 0x77, 0xb6, 0xd0, 0x57, 0xbe, 0xfe, 0x7f, 0xd9,
+    0xab, 0x48, 0x16, 0x2f, 0x68, 0xe8, 0xf1, 0x52, 0x8d, 0xf4, 0xce, 0x3d, 0xeb, 0x95, 0x0c, 0x7d,
+    0x9f, 0x8f, 0xa2, 0x51, 0x81, 0xf5, 0x43, 0xf8, 0x87, 0x53, 0xa0, 0x10, 0xf5, 0x20, 0x0c, 0x6d,
+    0x52, 0x77, 0x86, 0x77, 0xbf, 0x3d, 0x82, 0x49, 0x5d, 0x5f, 0x63, 0x9d, 0x47, 0x32, 0x13, 0xbb,
+    0x42, 0x03, 0xff, 0xbf, 0xfb, 0x96, 0x5e, 0xff, 0x08, 0x35, 0x82, 0x6f, 0x81, 0xbc, 0x41, 0xdc,
+    0x3f, 0x1c, 0x78, 0x8f, 0xaa, 0x57, 0xa1, 0x4d, 0xce, 0x61, 0x2c, 0x9f, 0x91, 0x9c, 0x7f, 0xd4,
+    0xb0, 0xb9, 0xce, 0x49, 0x69, 0x23, 0x44, 0x52, 0x9b, 0xe5, 0x75, 0x2e, 0x0f, 0x4c, 0x2e, 0x66,
+    0x95, 0x58, 0x03, 0x1c, 0xa5, 0x31, 0x51, 0x3f, 0xfe, 0xbc, 0x41, 0x7e, 0x89, 0x50, 0x4f, 0x81,
+    0x8d, 0x08, 0x30, 0xc2, 0xcc, 0x73, 0x29, 0x59, 0xe0, 0x64, 0x1c, 0x4f, 0x42, 0x7d, 0xdc, 0x5a,
+    0x0e, 0xfc, 0xed, 0x15, 0xda, 0x9b, 0xf6, 0xf2, 0xba, 0x7f, 0x71, 0xe9, 0x23, 0x76, 0xd1, 0xda,
+    0x78, 0xe6, 0x45, 0x00, 0xf7, 0x44, 0x92, 0xf9, 0x81, 0xd7, 0xd7, 0x1c, 0xb8, 0x39, 0x36, 0xd8,
+    0x8d, 0x0f, 0x87, 0x4d, 0x27, 0x8f, 0x09, 0x50, 0x9e, 0xbd, 0x21, 0x2c, 0xeb, 0x60, 0xde, 0xb0,
+    0xa2, 0xd9, 0x59, 0xd3, 0x6f, 0x1b, 0x7d, 0x26, 0xec, 0xe5, 0x79, 0x3e, 0x59, 0xf5, 0x3d, 0x7f,
+    0x31, 0xa8, 0xa5, 0xf2, 0x6f, 0x90, 0xac, 0x00, 0xa2, 0x1d, 0x68, 0x40, 0x97, 0xf5, 0x50, 0xf5,
+    0xcb, 0x49, 0x5f, 0x6c, 0x54, 0x77, 0xaf, 0xf7, 0x41, 0x5a, 0x71, 0xe9, 0xa9, 0xa3, 0x24, 0x6a,
+    0xaf, 0xa2, 0xbc, 0xd9, 0x81, 0x02, 0x73, 0xe7, 0x7e, 0x1e, 0xcd, 0x34, 0x92, 0x9a, 0x86, 0x64,
+    0xf3, 0x01, 0x7f, 0xb3, 0x66, 0x86, 0xda, 0x67, 0x8d, 0xe2, 0x3b, 0x62, 0x6a, 0xc8, 0x9f, 0x95,
+    0x60, 0x7d, 0xb8, 0xdd, 0xa1, 0x32, 0xa8, 0xf6, 0x1d, 0x5d, 0x6b, 0x70, 0xea, 0x1e, 0xf3, 0x5e,
+    0xea, 0xd2, 0xe3, 0xe3, 0x45, 0xc5, 0xbe, 0xd3, 0x84, 0x66, 0x24, 0x7f, 0x46, 0xa6, 0x6e, 0x0e,
+    0x36, 0x5e, 0xe4, 0x4c, 0x81, 0x41, 0x66, 0xa3, 0xf9, 0x0d, 0x65, 0x4d, 0xb9, 0xd2, 0xd0, 0x9d,
+    0xa0, 0xa5, 0x13, 0x29, 0x7f, 0x22, 0x97, 0xba, 0x4d, 0xcd, 0x55, 0x78, 0x54, 0x13, 0xe9, 0x1d,
+    0x7c, 0xc3, 0x2f, 0x35, 0xf3, 0xef, 0x88, 0x7d, 0xdd, 0x43, 0xbf, 0xf2, 0x98, 0x50, 0x7a, 0x70,
+    0x0a, 0xfa, 0xf0, 0x2e, 0xab, 0x1c, 0xd8, 0xd5, 0x3d, 0x74, 0xe4, 0xc8, 0x32, 0x3b, 0xca, 0xeb,
+    0x32, 0x23, 0x62, 0xf8, 0xc3, 0x81, 0xec, 0x45, 0x56, 0x39, 0x83, 0xbf, 0xeb, 0xfc, 0x20, 0xc7,
+    0x7a, 0x2c, 0x59, 0xac, 0x9b, 0x81, 0x48, 0x55, 0x3c, 0xfa, 0xff, 0xcc, 0x4d, 0x41, 0x2a, 0x14,
+    0x5a, 0x97, 0xa6, 0x60, 0x9d, 0x37, 0x90, 0x96, 0xdc, 0x83, 0xd4, 0xd1, 0x3f, 0x7a, 0x1c, 0x52,
+    0x5c, 0x24, 0xde, 0x74, 0x41, 0xcb, 0x67, 0x93, 0xb1, 0x82, 0xca, 0x18, 0x22, 0x76, 0x31, 0x1c,
+    0xf4, 0x78, 0x88, 0x26, 0xca, 0x00, 0x7f, 0x75, 0xb6, 0xab, 0xd0, 0xbd, 0x88, 0xaf, 0x5a, 0x03,
+    0xcb, 0xef, 0xed, 0xa2, 0xaf, 0x6e, 0x6b, 0xcb, 0xde, 0xd1, 0x8a, 0xea, 0xe5, 0x81, 0xb7, 0x90,
+    0x62, 0xb8, 0x17, 0x25, 0x15, 0x25, 0xa4, 0xe5, 0x86, 0x0d, 0x02, 0xa8, 0x76, 0x5c, 0xe2, 0x09,
+    0xfd, 0x3c, 0x21, 0x29, 0x2c, 0x8c, 0xc2, 0x01, 0x63, 0xf7, 0x58, 0x07, 0xac, 0x17, 0xb1, 0xd3,
+    0xee, 0x40, 0xd4, 0xde, 0x7d, 0xa5, 0xf0, 0x07, 0x7f, 0x8f, 0x8f, 0x33, 0xa6, 0xdc, 0x37, 0x38,
+    0xbb, 0xeb, 0x3e, 0x3f, 0xef, 0x33, 0x9a, 0xe3, 0x83, 0xa3, 0x81, 0x8f, 0x45, 0x30, 0xc8, 0x78,
+    0xd4, 0x59, 0xa9, 0x83, 0x36, 0x14, 0x5c, 0xe3, 0x3b, 0x32, 0x16, 0xd3, 0x63, 0x5f, 0xe4, 0xe0,
+    0xff, 0x19, 0x62, 0x7a, 0x7f, 0x94, 0x0d, 0x1c, 0x72, 0xfe, 0x08, 0x49, 0x7c, 0x88, 0x9b, 0x86,
+    0xc9, 0xee, 0xd9, 0x1f, 0x91, 0x8d, 0x6f, 0x17, 0x1b, 0xfd, 0x57, 0x46, 0x93, 0x6b, 0xeb, 0x38,
+    0xd0, 0x41, 0x79, 0xff, 0xa1, 0x1b, 0x06, 0x26, 0x13, 0x14, 0xd7, 0x05, 0x67, 0x95, 0x81, 0x21,
+    0xbe, 0xa6, 0x41, 0x29, 0x4f, 0xe5, 0x85, 0xec, 0xd4, 0x0e, 0x21, 0x31, 0x32, 0x28, 0x42, 0x9f,
+    0x0a, 0x89, 0xc9, 0xe5, 0xea, 0xdb, 0x38, 0xee, 0x54, 0x91, 0x7e, 0x4c, 0x83, 0xfa, 0x61, 0xbc,
+    0x40, 0x19, 0x23, 0x4a, 0x58, 0xb9, 0x7f, 0x01, 0x2b, 0x49, 0x56, 0xc2, 0x06, 0xa3, 0xbe, 0xea,
+    0x5d, 0x95, 0xab, 0x43, 0x46, 0xf2, 0x10, 0x98, 0x5c, 0x6d, 0x75, 0xe8, 0x98, 0xe9, 0x23, 0xa4,
+    0xb2, 0xc6, 0xf5, 0xf8, 0x7f, 0x55, 0x51, 0x19, 0x09, 0x1a, 0xf8, 0xaa, 0x7c, 0xe5, 0xd1, 0x2e,
+    0xe4, 0x77, 0x5e, 0x7f, 0xe9, 0xa0, 0x78, 0xf7, 0xdc, 0x3a, 0x66, 0x87, 0x8e, 0x6c, 0x9b, 0xc3,
+    0x50, 0xd3, 0x59, 0xbe, 0x55, 0x55, 0x7e, 0x4f, 0x95, 0xba, 0x9a, 0x14, 0xaf, 0x21, 0x52, 0xaf,
+    0x57, 0x40, 0x81, 0x56, 0x33, 0x34, 0x27, 0x72, 0x25, 0xcf, 0x83, 0x2f, 0xcb, 0x28, 0x4d, 0xef,
+    0xfa, 0xb0, 0xcf, 0xc1, 0x24, 0x85, 0xdc, 0x92, 0x2f, 0x51, 0xa5, 0xb4, 0x2d, 0xff, 0x63, 0x1b,
+    0x62, 0xd0, 0x1b, 0x0b, 0x55, 0x76, 0x87, 0x5c, 0xab, 0xcb, 0x3a, 0xc4, 0x52, 0x1e, 0x6c, 0x24,
+    0x5c, 0xe0, 0xde, 0x7f, 0x55, 0x96, 0x14, 0x20, 0xac, 0x34, 0xdd, 0xfe, 0x81, 0x88, 0xf1, 0x68,
+    0x3b, 0x46, 0x81, 0xc9, 0x26, 0xe7, 0x58, 0x9d, 0xf7, 0xb9, 0x57, 0x94, 0xe2, 0xbb, 0x82, 0x7e,
+    0x16, 0x06, 0x77, 0x44, 0x7f, 0x43, 0xe1, 0xea, 0x18, 0x29, 0xfa, 0xcb, 0xf4, 0x48, 0x1a, 0x01,
+    0xba, 0x43, 0x6d, 0x44, 0x35, 0x5d, 0x4a, 0x56, 0x36, 0x8c, 0x7f, 0x7c, 0xc0, 0xb0, 0xa5, 0xc6,
+    0xf4, 0x92, 0xed, 0xb7, 0x1f, 0x66, 0x47, 0x8d, 0xfe, 0xf1, 0x71, 0xbc, 0x3f, 0xb0, 0xa7, 0x68,
+    0x9d, 0xa0, 0xb1, 0x97, 0x17, 0xa0, 0x6b, 0xec, 0x5d, 0x05, 0x83, 0x3f, 0x27, 0xf6, 0xb4, 0x01,
+    0x1a, 0x6a, 0x3d, 0x90, 0x7f, 0x86, 0xa1, 0x91, 0x4d, 0x46, 0x1a, 0xf1, 0xa2, 0x36, 0x34, 0x43,
+    0x4d, 0xca, 0x91, 0x84, 0x93, 0xb6, 0xaf, 0x2a, 0xb9, 0x35, 0x1c, 0x0a, 0x28, 0x05, 0xdb, 0x6b,
+    0x74, 0xf0, 0x6e, 0x59, 0xe6, 0xc8, 0xae, 0xbe, 0x68, 0x09, 0x7f, 0x4a, 0xf6, 0xe3, 0xe0, 0xd8,
+    0x8f, 0x14, 0x83, 0xc8, 0xc7, 0x05, 0x45, 0x15, 0x9a, 0x0b, 0x1c, 0xc1, 0xf3, 0xf0, 0xef, 0xef,
+    0x7d, 0xd8, 0xf9, 0x22, 0x2b, 0xee, 0xf3, 0x86, 0xb5, 0x30, 0x24, 0x81, 0xa9, 0xba, 0xce, 0x16,
+    0xb7, 0x61, 0x77, 0x7f, 0x3c, 0x54, 0x8e, 0x63, 0xe8, 0x92, 0xe3, 0x8c, 0xc8, 0x68, 0x9a, 0xbf,
+    0xcc, 0xf9, 0x69, 0xc7, 0x7d, 0xe8, 0xab, 0xdf, 0xe6, 0x93, 0xa0, 0x35, 0x1e, 0xb4, 0x9b, 0x75,
+    0xd5, 0x5e, 0x3e, 0x8b, 0xb4, 0x65, 0xb3, 0x7c, 0x43, 0x11, 0xda, 0x96, 0x56, 0xfd, 0xd9, 0xae,
+    0x09, 0x5a, 0x9a, 0x43, 0x3a, 0x7f, 0xb0, 0xd2, 0x6a, 0x50, 0x0d, 0xeb, 0x02, 0x49, 0x8e, 0xf0,
+    0x9b, 0xad, 0xde, 0x81, 0x9d, 0x58, 0xba, 0xc9, 0xf1, 0x0e, 0xf1, 0x4b, 0x95, 0x0d, 0xd5, 0xcf,
+    0xb2, 0x83, 0xbd, 0x54, 0x52, 0xfd, 0x24, 0x34, 0x28, 0x20, 0x83, 0x60, 0x48, 0xda, 0x6a, 0x75,
+    0xff, 0x77, 0x55, 0x23, 0x4c, 0x1a, 0x8d, 0x27, 0xc3, 0xbe, 0x4a, 0xcc, 0x1f, 0x13, 0x08, 0x5a,
+    0x8e, 0x81, 0x18, 0x12, 0x78, 0x15, 0xfa, 0x19, 0x4e, 0xbd, 0xa1, 0xf7, 0x30, 0x5a, 0x15, 0x4f,
+    0xbe, 0x0b, 0x15, 0x3b, 0xea, 0x7f, 0x1d, 0x97, 0xaa, 0x8c, 0x33, 0x85, 0x9b, 0x20, 0xb5, 0x63,
+    0x33, 0xee, 0xd1, 0x96, 0x48, 0x3c, 0xdb, 0x4f, 0xb0, 0x48, 0x74, 0x01, 0x18, 0xef, 0x47, 0x71,
+    0x90, 0x4f, 0x38, 0x35, 0x30, 0x81, 0xaf, 0xf0, 0xca, 0x3b, 0x1f, 0x10, 0x0d, 0x30, 0x53, 0xc4,
+    0x5e, 0x70, 0x0b, 0x32, 0xa2, 0x99, 0x83, 0x46, 0xb1, 0xb1, 0xa7, 0xb3, 0x34, 0xd0, 0xac, 0xe4,
+    0x81, 0x36, 0x02, 0x62, 0x32, 0x25, 0x07, 0x01, 0x48, 0xe0, 0xd5, 0x3d, 0x77, 0xcd, 0xcc, 0x59,
+    0x64, 0xb0, 0x79, 0x41, 0x6e, 0x64, 0x90, 0xd6, 0x25, 0xf5, 0xfb, 0x1e, 0xae, 0x47, 0xff, 0xff,
+    0x7a, 0xeb, 0xff, 0xff, 0xc3, 0x8c, 0x00, 0x00, 0xd4, 0x2d, 0x00, 0x00, 0x39, 0x18, 0x02, 0x00,
+    0x11, 0xf8, 0x00, 0x00, 0xe7, 0xb8, 0x00, 0x00, 0x3c, 0x73, 0xff, 0xff, 0xfe, 0x10, 0x02, 0x00,
+    0x05, 0x59, 0xff, 0xff, 0xbe, 0x04, 0xff, 0xff, 0x47, 0x01, 0x00, 0x00, 0xde, 0x70, 0x00, 0x00,
+    0x6c, 0x4b, 0x00, 0x00, 0x15, 0xc7, 0xff, 0xff, 0x43, 0xc2, 0x00, 0x00, 0x8e, 0xb0, 0x00, 0x00,
+    0xc3, 0xed, 0xff, 0xff, 0xd2, 0xd2, 0x00, 0x00, 0x88, 0xc9, 0x00, 0x00, 0xd1, 0xb0, 0xff, 0xff,
+    0x92, 0x0c, 0x01, 0x00, 0x17, 0x01, 0x00, 0x00, 0x4f, 0x46, 0x00, 0x00, 0x57, 0xe8, 0xfe, 0xff,
+    0x76, 0xd9, 0x00, 0x00, 0xbf, 0xe3, 0xfd, 0xff, 0x45, 0xb0, 0xff, 0xff, 0xc7, 0xec, 0xfe, 0xff,
+    0x08, 0x86, 0x00, 0x00, 0x05, 0xb4, 0xff, 0xff, 0x1a, 0x8c, 0x00, 0x00, 0x1e, 0x46, 0x00, 0x00,
+    0xd3, 0x37, 0x01, 0x00, 0x90, 0x32, 0xff, 0xff, 0x41, 0xcc, 0x01, 0x00, 0x93, 0x2c, 0x00, 0x00,
+    0x83, 0x16, 0x01, 0x00, 0x51, 0x51, 0xff, 0xff, 0xfd, 0xdb, 0xff, 0xff, 0xf4, 0x0a, 0xff, 0xff,
+    0x29, 0xeb, 0xfe, 0xff, 0x34, 0x9a, 0x00, 0x00, 0x0a, 0xed, 0xfe, 0xff, 0x08, 0x48, 0x01, 0x00,
+    0x95, 0xb7, 0x00, 0x00, 0x2b, 0x5f, 0x00, 0x00, 0x65, 0x64, 0x01, 0x00, 0x72, 0xf8, 0x16, 0x50,
+    0xb5, 0xa3, 0xe3, 0x50, 0x3b, 0xe9, 0xab, 0x50, 0x86, 0x34, 0x77, 0x50, 0xb0, 0xb9, 0xee, 0x4a,
+    0xa8, 0xe1, 0x01, 0x52, 0x4d, 0xbc, 0xff, 0x51, 0x97, 0xf7, 0x0d, 0x51, 0x63, 0x40, 0x12, 0x51,
+    0x9e, 0x33, 0xbd, 0x50, 0xc2, 0xe8, 0x41, 0x51, 0xe0, 0xd3, 0xe5, 0x4a, 0xa5, 0x17, 0xd5, 0x50,
+    0xef, 0x19, 0x54, 0x51, 0xba, 0xf2, 0x2b, 0x52, 0xc1, 0xb1, 0x7e, 0x52, 0x90, 0x63, 0x53, 0x4c,
+    0xd4, 0x1c, 0x09, 0x4f, 0x18, 0x19, 0x09, 0x51, 0x13, 0xdc, 0xcb, 0x51, 0xbb, 0xb9, 0xc7, 0x4c,
+    0x88, 0xc3, 0xd4, 0x51, 0x5a, 0xba, 0xec, 0x51, 0xf6, 0x91, 0xdd, 0x51, 0xf3, 0x4f, 0xbd, 0x51,
+    0xa6, 0xc2, 0x69, 0x4f, 0xf6, 0x10, 0xbe, 0x4e, 0x51, 0xc5, 0xb7, 0x51, 0x7c, 0x8b, 0xe8, 0x51,
+    0x7c, 0xa9, 0xaa, 0x49, 0x9c, 0xee, 0x29, 0x50, 0xbf, 0x7e, 0xf8, 0x51, 0x0b, 0x78, 0x1a, 0x52,
+    0x3b, 0xe5, 0x92, 0x51, 0xf4, 0x3a, 0x89, 0x50, 0xaa, 0x01, 0x7e, 0x52, 0x52, 0x10, 0x2d, 0x4f,
+    0x62, 0x10, 0x49, 0x52, 0xbe, 0xf5, 0x8b, 0x52, 0x31, 0x64, 0xa0, 0x51, 0x69, 0x8c, 0x3d, 0x52,
+    0xf3, 0xfc, 0x3b, 0x4f, 0x20, 0xd0, 0xc8, 0x4f, 0xdc, 0x37, 0xa8, 0x4f, 0x89, 0x4f, 0xb6, 0x4f,
+    0x3b, 0x13, 0xfe, 0x50, 0x97, 0x57, 0x04, 0x4f, 0x8c, 0xbb, 0x74, 0x50, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+};
+
+static const int8_t nnCheckInput[NN_CHECK_WINDOWS][NN_CHECK_VALUES] = {
+    {14, -34, 113, -110, 93, 24, -39, 60, -19, -52, -34, 10, -57, 19, -94, 17, -69, 82, 119, -62, 60, -122, -21, -7, 101, -57, -99, 12, 17, 68, -52, -43, 73, 80, -79, -24, -60, 108, 84, 64, 70, 50, -15, -111, -55, 57, 57, -107},
+    {87, -91, -53, -4, -48, -45, 112, 62, 9, -118, -26, 121, -82, 66, 58, 6, -104, 4, 102, -48, 76, -4, -106, 13, -32, -50, -34, 26, -5, 7, -43, 98, -34, -8, -99, -93, -89, -59, -42, 45, -38, -40, -42, -83, 105, -115, -106, 89},
+    {48, 89, 89, -99, -108, -99, 14, 53, -59, 100, -115, 55, 122, -104, 88, 20, 31, 18, -46, 86, 101, -100, 80, -24, -66, -93, 82, -16, 8, -117, 114, -55, 107, -103, -92, 8, -119, -84, -114, 84, 13, -78, 56, -104, -81, 95, 101, 71},
+    {102, -71, -102, 55, 14, 18, -22, 21, -47, -4, 26, 1, 67, 74, 65, 60, -90, 125, 118, -85, -110, -127, 83, -41, 4, -71, 69, 54, -85, -7, -115, -71, -2, -82, -124, 60, -19, -14, 90, -52, 92, -43, -88, -102, 10, 1, 40, 99},
+    {58, -16, 113, 124, 50, 51, 26, -93, 96, -60, 32, -49, -39, 81, 57, -31, 32, -3, -77, 10, 7, -40, -46, -44, -38, 18, -104, -52, 25, -31, 76, -108, -81, -11, 55, 25, -48, -60, 92, -91, -41, 93, -43, -86, 77, 91, 78, -28},
+    {-107, 95, 12, -10, -111, 74, -112, -57, -98, -23, -9, -32, 96, -85, 62, -96, -64, 82, 43, 126, 52, -58, -74, 109, 94, 37, 18, -109, -8, 127, -34, -111, 60, 61, 115, -30, -6, -126, -42, -15, 98, 17, -34, -42, -15, 51, -15, 23},
+    {64, 21, -18, -54, -59, 54, 119, 55, -1, -109, -23, 42, -85, 27, -22, 33, -114, -120, -18, -32, -99, 67, 122, -100, -73, 47, 115, -99, -66, -43, 15, 37, 54, 77, 63, 48, -17, 87, -96, -81, 92, 41, 71, 34, -16, -74, 82, 77},
+    {-60, -102, -87, -58, -48, -52, -105, 65, 11, 20, 17, -21, 88, 91, -55, 122, 65, 1, 80, 73, -92, 111, 112, -88, 107, 71, -32, 34, 29, 14, -6, -94, -105, 42, 38, -12, -95, 110, -85, 108, 125, -1, -21, -9, -80, 110, -68, 76},
+    {111, 56, 110, -116, 27, 92, 61, 54, 73, -83, -102, -126, 79, 39, 80, 103, 70, -70, 89, -67, 73, -44, -37, 51, 57, -102, 76, 5, -58, -104, 81, 64, 91, 126, 108, 95, 28, 65, -117, -70, -81, 71, -62, -9, -1, 59, 26, 5},
+    {-19, -6, 63, 8, 17, -124, 44, -49, 6, -32, -75, 107, -60, -14, -98, -36, -111, -78, 33, 33, -91, 58, 79, -10, 75, -115, 36, 108, -99, 9, -51, -10, 114, -30, -122, 24, 12, -118, 108, -85, -21, -18, 13, -5, -32, 5, 27, 116},
+    {95, -93, 96, -101, -120, -5, 24, -14, -30, -115, 19, 71, 0, 26, 126, -108, 20, 111, -65, -78, -52, 64, -110, 108, 30, -99, -12, -79, 59, 12, -1, 81, -113, 82, -38, 56, -22, -25, -6, -35, -73, -9, 115, 103, -121, 90, 34, 122},
+    {39, 107, -110, -27, 37, -68, 78, 23, -68, -12, 78, 57, -107, 22, -9, 121, 68, 51, -84, 70, 3, -3, 1, 90, 13, -18, 42, 38, 55, 112, -6, 124, -69, -121, -123, -117, -26, -22, -22, -52, -9, 120, -54, 5, 85, -71, -44, -11},
+    {72, 56, 20, 20, -47, -42, -59, 111, 36, -41, 115, -12, -120, 91, 49, -68, -77, 68, -65, -125, -122, 20, -4, -86, 104, -67, 92, 16, 102, -16, 11, -79, -9, 35, -80, 2, 85, -37, 35, 72, -20, -61, -78, 78, -50, 22, -110, -37},
+    {44, -1, 29, 126, -2, -25, 61, -9, 14, 111, 71, 2, 83, -33, 8, -74, -16, -125, 118, 57, -85, -119, -11, -71, 120, 40, 103, -9, -8, -48, 7, 114, 54, 19, 90, -82, 32, -105, 79, -33, 10, 114, 55, -55, 92, 90, -89, -73},
+    {-39, -68, 25, -21, -126, -57, -52, 27, -126, 63, 123, -124, 10, 71, 82, 116, -54, -79, 83, 4, -44, -44, -87, -55, 75, 20, -17, -45, -121, -110, -10, -3, 49, -103, 72, 23, -128, -10, 82, -74, 77, 55, -126, -46, 115, 99, 92, 4},
+    {37, -8, -122, -77, 71, 93, -19, 61, 97, -36, -18, -124, 10, -109, 107, -76, 59, -113, 31, 113, -118, 10, -57, -18, -111, 92, 18, 123, 18, -18, -96, 100, -15, 46, -64, -56, 71, -123, -98, 80, -22, -35, 12, 79, -46, 99, 50, -19},
+    {119, 23, 56, -32, -49, -115, -112, 86, -49, -50, 101, 102, -5, -103, 113, -50, -28, -30, -127, -69, -18, 9, -112, -79, -41, -63, -9, -6, -29, 118, -30, 113, 26, 61, 16, -94, 33, 50, -17, 32, 105, 121, -12, -122, -60, 22, -26, -60},
+    {84, 14, -34, -26, -67, -41, -10, -68, -36, -25, 99, -76, -66, 17, 120, 86, 92, 35, -72, -9, 9, 79, 68, 100, -13, -67, 123, -21, 114, 33, -81, 17, -101, 106, 29, -114, -116, 93, 111, 88, -37, -104, -86, 123, 117, 121, 119, 7},
+    {-102, -122, 97, 96, -20, -31, -124, 109, -104, 66, -84, 114, 31, -23, -61, -38, 108, -35, 114, -69, -125, 0, 31, -8, -46, -89, 59, -3, -83, -118, 48, 39, -109, 5, 104, 85, 5, -19, 116, 34, 100, 65, -38, 107, 30, 52, 100, 111},
+    {119, 116, -96, 17, 100, -104, -31, 93, 96, -126, -35, 44, 99, 70, 100, -108, -14, -32, -85, -31, 12, -98, -27, -41, -93, 60, -44, -117, 45, -105, -90, -31, 119, 0, 120, 15, 26, -19, 80, -53, 47, -19, 88, 15, 50, 123, -58, -19},
+    {-45, 109, 101, -102, -60, -37, 123, 73, -59, -77, 58, 51, -44, 69, -93, -98, -5, -21, -75, 42, -57, 99, -115, -127, 51, -92, 27, -51, -81, 14, 99, -7, -37, -108, 94, -77, -123, 40, -28, 27, 66, -44, 121, 90, -20, 71, -6, -106},
+    {108, -51, 127, 19, -95, 38, 38, -61, 110, -75, 65, 69, 54, -18, -111, 102, 87, 121, -57, 30, -8, -113, 10, -95, 70, 91, -98, 79, 110, -105, 88, -89, 48, 114, -85, 89, 120, 124, -96, 21, -32, 96, 88, -107, 33, -112, 105, 115},
+    {33, 4, -73, -16, -111, 97, -83, -121, 10, 3, -23, -59, -117, -8, -115, -105, 72, -83, -21, 79, -123, 91, 45, -126, -47, -30, 121, -86, -99, 104, -114, 39, 86, 5, -121, -78, -128, 117, 65, 122, 90, 1, -69, -115, -87, -6, -57, -8},
+    {111, -17, -59, 17, 34, -38, 49, -67, 21, 55, 5, 42, 48, 32, -118, -16, -5, -28, -48, -60, -43, 50, 127, 5, 33, -10, 67, 52, 80, -20, -44, -31, 11, -77, 101, -21, -31, -9, 108, -49, 18, -115, -90, 106, -60, 93, -116, -104},
+    {47, -115, -127, -78, -112, 17, -110, -12, 52, -50, -18, -1, -1, 28, 73, -101, -112, -48, 57, 32, -69, -76, -13, -13, -53, 103, -31, 53, -29, -103, 94, 70, -3, 44, -78, 37, 76, -52, 31, -87, -43, -107, -86, 110, 88, -45, 47, -84},
+    {126, -111, -86, -27, -56, -10, 65, 98, 35, -64, 73, -26, 10, 37, 10, 38, 109, -98, -97, -55, 73, -5, -106, -103, -4, 48, -37, -107, 102, 41, -42, 58, 49, -18, 120, 96, -99, -9, 78, 53, 57, -126, -17, -110, 127, -25, 64, -16},
+    {-23, 126, 41, 41, 102, 51, 125, 1, -47, -6, -29, -58, -70, 0, -87, -72, 41, 51, -17, -7, -69, 60, 43, -3, 57, 97, -40, 77, -2, 81, -40, -42, -68, -42, -53, -32, 63, -42, -95, -21, 31, -63, 85, 103, 19, 78, -16, -44},
+    {-66, 82, -104, 55, 14, -47, -3, 22, -57, -92, 34, 89, -91, -54, -5, 78, 88, 86, -54, -47, -28, 32, -22, -92, 67, 93, 10, 125, 110, 16, -105, 18, 52, 39, -1, -98, 44, 119, 59, -97, 74, 47, -63, -6, 89, -28, -59, 54},
+    {-50, 95, 26, -118, 67, 111, -86, -39, -22, 2, -32, -22, 64, -53, 60, -42, -87, 87, 65, 97, 82, 90, -20, -35, 72, -33, 51, 15, -9, -97, 4, 90, -91, -19, 75, 11, 84, -71, 48, 2, 39, -95, 107, -92, -18, 121, 83, 102},
+    {-88, 59, 48, -113, 3, 61, -108, 84, 26, 62, 99, 112, 111, 96, -103, 27, 47, -117, 36, -110, 20, 78, 37, -118, 121, 115, 70, 113, 22, 49, 36, 9, 43, -60, 95, 23, 93, 67, -106, -15, 126, -121, 116, 114, -30, -44, 88, 110},
+    {-80, 50, -110, 104, 16, -57, -59, 113, -91, 8, 124, -37, 116, 102, 65, -25, -85, -125, 28, 34, -88, 110, -31, 104, -41, -119, 102, 116, -49, -104, -46, -75, -29, -21, -13, 119, -122, 22, 10, -66, -8, -13, 53, 86, 73, 53, -54, -125},
+    {104, -66, -32, 66, 24, -7, 104, -47, 58, -83, -13, 59, 46, -48, 69, 85, 69, -9, 43, -121, 55, 46, 49, 38, 41, 28, -53, -45, 13, 110, 31, 100, 107, -111, 102, -86, 49, 101, 74, -22, -82, -37, -12, 63, -29, -105, 61, -44},
+    {-34, 10, -126, -94, -23, 90, 60, -93, 125, -119, 85, 81, 60, 87, 76, -127, 114, -42, 23, -124, 114, -76, 47, 14, -19, 9, 111, -74, -53, -116, 82, 45, -17, -111, 59, 72, -17, -101, 77, 67, -22, -106, -120, 1, -71, 97, 93, -40},
+    {-30, 72, -50, -50, -120, 116, 25, 50, 119, 78, -120, -72, -8, -8, 80, 91, -73, 2, 45, -58, 101, -96, 49, -124, -36, 71, -38, 30, 82, -30, 10, 38, -72, 35, 84, 116, 28, 89, 124, 70, 0, -97, -3, 94, -23, -127, 122, -50},
+    {-40, -32, 38, -118, 4, -76, -57, 114, 103, -8, -111, -106, 41, -74, 106, -128, -73, 96, -26, 37, 8, 30, -78, 49, -8, 123, -29, 41, -10, 81, 25, -46, -123, 83, 22, -93, 61, 121, -26, -97, 18, 115, -101, -124, -90, -127, -86, -95},
+    {-85, -7, 119, 59, -118, -114, 113, 119, -71, -81, 126, -58, -123, 117, 123, -124, 14, 113, -123, -64, -48, 79, 1, -96, 75, -85, 60, -83, -37, 49, -82, 96, -40, -101, 122, 45, 60, 47, -74, 41, -117, -22, 110, -65, 38, -72, -62, -38},
+    {-116, -51, -97, -97, -98, -26, -76, 94, -10, 116, -91, 99, 5, 12, -81, 65, 117, -61, -56, 34, 70, 34, -65, -26, 24, 116, -95, 64, -45, 0, -92, 106, 58, -82, 43, 118, 39, 113, 49, -21, 122, 74, 96, 107, 38, -12, 20, 5},
+    {19, -84, 1, -101, -125, 122, 42, 125, 24, 4, -62, -92, 89, -77, -50, -64, 96, -69, -98, -105, 55, -88, -48, -5, 19, 48, -70, -77, 123, 6, 79, -121, 0, 18, 42, 17, 66, 5, -57, 110, -77, -60, 112, -72, 42, -11, -46, -124},
+    {-34, -121, -112, -12, 89, -65, 94, 108, 35, -15, 115, 100, -111, 95, 117, 11, -96, -82, 92, -91, 91, 87, -47, -66, 10, 69, 79, -109, 49, 80, -13, -60, 98, 40, 73, 64, -28, -9, 72, -112, -23, 11, 88, 91, 73, -2, 117, 28},
+    {32, -7, -61, 23, -86, -4, 89, 77, -10, -43, 23, -26, 1, 52, 68, 41, 1, 22, -42, -12, 74, 110, 86, 75, 126, 59, 16, -53, 66, 88, -102, -118, -75, -76, 19, 71, -74, 29, 126, 4, -52, 66, 5, -50, -104, 12, 23, 118},
+    {-71, -62, -37, -13, -61, 109, 85, -21, -19, -55, 72, -45, -61, -32, -25, -114, 80, -6, -93, -80, 87, 33, -62, -38, 10, -9, 101, -61, -26, -122, 17, 5, -88, 14, -65, 85, -43, -25, 60, -93, -112, 91, 121, 63, -47, 65, 3, 69},
+    {-39, -11, -40, 30, -31, 87, -113, -15, -27, -97, 37, 55, 76, -74, 127, -52, 127, -23, 101, 90, -47, 85, -4, 110, 22, 111, -10, -8, -111, -121, 94, 80, 1, 97, -58, -127, 105, 59, 56, -85, -16, 78, -28, -76, -61, -68, 23, 100},
+    {-92, -50, -29, -41, -84, 102, 35, 118, 72, 77, 76, -93, 40, -5, 47, 63, -83, 42, -80, 75, 20, 72, 108, -59, -82, 76, -4, -97, -60, 27, 118, -25, -117, -49, 115, -113, 109, -120, -5, -92, -66, 81, -110, -99, 8, 119, 47, 39},
+    {73, 54, -22, -111, 51, -30, -116, 41, -69, -67, 62, -90, -96, -25, -47, 3, 103, 78, 126, -35, -15, 55, 70, 0, -24, 70, -109, 12, 127, -14, 62, 33, 18, 13, 62, -52, 91, 34, -111, 39, -16, 35, 71, -44, 42, -46, 62, 125},
+    {-127, 67, -126, -111, 34, -65, 124, 31, 0, 4, 81, 11, -68, 70, -86, 116, -46, -96, 103, 22, 41, -5, 105, -36, 104, 6, 65, -89, 89, 114, 66, 14, -18, -77, -74, 80, 96, -27, -25, -43, 11, 1, -60, -14, -98, 27, -15, -48},
+    {-8, 120, 70, 90, 37, -8, -93, 23, 62, 87, -123, 1, 67, -77, 72, 14, -33, -98, -6, 27, 113, -11, -103, -1, -114, -55, -63, -21, 39, 76, 1, -76, -69, -13, -68, -32, -109, 44, 85, -124, -99, 20, 6, 5, 121, 78, 15, 54},
+    {-128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128},
+    {127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127},
+};
+
+static const int8_t nnCheckConvOut[NN_CHECK_WINDOWS][NN_CHECK_VALUES] = {
+    {-38, -17, 19, -34, 60, 47, 45, -19, 57, -34, -83, -65, 24, 13, -29, 45, 17, 29, 12, 39, -27, 51, -16, -9, -86, 19, -50, -84, -65, 8, -18, 30, 8, 54, -93, 78, 2, 60, -68, -36, -31, -64, -29, -25, 54, 42, 45, 13},
+    {-7, -41, 34, -32, 57, 44, 27, -19, 42, -18, -79, -57, 18, 15, -22, 54, 23, 26, 44, 31, -23, 49, -21, -48, -63, 6, -69, -84, -73, 8, -10, 12, -8, 46, -73, 56, -8, 62, -47, -31, -24, -58, -38, -29, 37, 27, 22, 43},
+    {-31, -13, 12, -57, 56, 61, 8, -43, 59, -58, -57, -40, 0, 24, -37, 64, 19, 8, 60, 35, -19, 44, -6, -41, -61, 9, -76, -67, -101, -10, -31, 33, 28, 58, -74, 61, 21, 80, -53, -30, 1, -73, -39, -38, 46, 45, 42, 27},
+    {-28, -20, 27, -14, 45, 47, 21, 1, 59, -25, -68, -56, 7, 0, -31, 52, 15, 25, 25, 35, -7, 55, -35, -40, -84, 4, -79, -77, -65, 15, -22, 22, 11, 71, -104, 59, -2, 70, -61, -33, -21, -52, -18, -41, 40, 42, 29, 17},
+    {-14, -35, 49, -21, 48, 40, 12, -40, 48, -31, -76, -64, 4, -4, -15, 50, 30, 4, 57, 48, -9, 42, -25, -40, -78, 13, -77, -77, -75, 19, -18, 28, 20, 95, -84, 39, -1, 99, -40, -65, -20, -67, -45, -36, 32, 43, 15, 25},
+    {-12, 2, 38, -30, 63, 51, 14, -24, 48, -54, -80, -81, -2, 10, -32, 37, 14, 1, 35, 41, -40, 63, -34, -37, -60, 11, -67, -91, -77, -14, -23, 32, 17, 59, -80, 62, 35, 73, -47, -27, 7, -75, -30, -42, 52, 35, 31, 35},
+    {-24, -11, 47, -31, 82, 56, 34, 2, 69, -18, -98, -65, 20, 10, -42, 84, 22, 21, 34, 68, -44, 91, -37, -51, -77, 11, -105, -94, -72, 7, -42, 51, 18, 46, -78, 82, -9, 70, -82, -19, -22, -84, -46, -38, 52, 13, 16, 30},
+    {-27, -27, 27, -47, 63, 51, 41, -27, 77, -22, -76, -52, 18, 25, -31, 56, 19, 15, 22, 55, -18, 64, -12, -26, -91, 9, -83, -85, -63, 10, -21, 23, 19, 62, -82, 74, 4, 69, -68, -35, -25, -62, -28, -35, 52, 39, 33, 35},
+    {-16, -26, 42, -31, 48, 46, 27, -17, 48, -13, -73, -62, 11, -1, -46, 54, 18, 16, 19, 50, -20, 58, -31, -27, -82, -6, -72, -79, -58, 13, -15, 21, 3, 56, -76, 73, 3, 69, -58, -20, -20, -48, -30, -33, 52, 37, 23, 27},
+    {-43, -31, 3, -32, 47, 46, 36, -1, 54, -31, -66, -44, 6, 6, -28, 33, 7, 30, 9, 24, -28, 42, -16, -29, -92, 13, -56, -78, -68, 7, -27, 18, 20, 52, -80, 53, -1, 59, -50, -43, -16, -56, -29, -14, 32, 37, 26, 23},
+    {-16, -22, 38, -11, 48, 26, 4, -25, 32, -31, -77, -89, 13, 4, -17, 49, 14, 11, 37, 28, -26, 32, -42, -34, -44, 18, -63, -83, -68, -18, -24, 4, 0, 84, -80, 53, -5, 61, -47, -53, -23, -50, -22, -35, 49, 38, 32, 20},
+    {-22, 9, 43, -30, 71, 55, 7, -21, 76, -33, -65, -63, 19, 9, -25, 103, 35, 6, 58, 64, -31, 64, -27, -22, -92, 21, -108, -78, -84, -2, -42, 31, 27, 95, -99, 68, 1, 62, -67, -39, -34, -72, -61, -63, 48, 46, 45, 14},
+    {-1, -43, 39, -8, 37, 31, -3, -62, 48, -38, -55, -67, 20, 11, -11, 35, 19, 9, 44, 52, -2, 31, -38, -17, -48, -5, -63, -68, -69, 20, 11, -30, -5, 90, -69, 49, -26, 78, -36, -65, -37, -23, -19, -58, 54, 25, 54, 39},
+    {-21, -2, 31, -49, 59, 63, 23, -24, 41, -39, -78, -73, 1, 15, -30, 35, -3, 5, 23, 34, -58, 42, -16, -23, -75, 27, -70, -80, -70, -20, -30, 16, 25, 70, -80, 54, 36, 44, -43, -40, -6, -66, -49, -27, 49, 38, 33, 39},
+    {-10, -24, 59, -36, 80, 47, 63, -2, 68, -7, -80, -55, 12, 13, -27, 55, 17, 10, 8, 39, -35, 62, -30, -23, -118, 20, -81, -102, -59, 23, -19, 37, 17, 82, -90, 64, 25, 60, -53, -27, -19, -65, -41, -30, 37, 41, 4, 40},
+    {5, -8, 53, -53, 70, 56, 29, -48, 39, -23, -80, -69, 22, 35, -29, 69, 29, 5, 47, 41, -43, 39, -15, -17, -51, 13, -68, -88, -64, -13, -5, 5, -20, 47, -67, 81, 16, 47, -54, -19, -23, -56, -41, -58, 64, 38, 46, 50},
+    {-7, -6, 55, -28, 62, 42, 38, -36, 46, -27, -83, -76, 18, 23, -21, 46, 26, 10, 24, 46, -34, 38, -28, -6, -78, 14, -62, -93, -51, -1, -8, 16, 0, 76, -90, 76, 15, 60, -57, -42, -24, -51, -24, -50, 57, 48, 40, 28},
+    {-11, -13, 48, -26, 73, 46, 13, 3, 85, -12, -64, -62, 23, 29, -24, 112, 26, 15, 57, 46, -16, 68, -38, -48, -86, 28, -119, -88, -78, -5, -41, 26, 19, 100, -118, 57, -2, 51, -73, -34, -43, -70, -41, -58, 36, 58, 26, 23},
+    {-15, -10, 50, -24, 67, 48, 42, 5, 54, -13, -67, -46, -2, 11, -33, 54, 18, 19, 19, 43, -31, 51, -53, -31, -104, 20, -75, -103, -48, 10, -31, 34, 22, 71, -87, 68, 18, 69, -57, -30, -17, -72, -25, -40, 38, 61, -7, 9},
+    {-20, -9, 53, -29, 77, 55, 24, -61, 63, -62, -104, -94, 40, -9, -35, 76, 28, 12, 47, 61, -45, 55, -4, -24, -43, 13, -84, -74, -100, -2, -20, 47, 8, 80, -77, 90, -4, 88, -88, -41, -28, -48, -59, -49, 77, 8, 62, 42},
+    {-25, -8, 53, -33, 73, 55, 45, -37, 41, -18, -95, -71, 20, 10, -21, 52, 11, -6, 11, 54, -52, 35, -22, 3, -80, 21, -66, -73, -69, 11, -19, 23, 12, 79, -64, 62, 16, 63, -47, -46, -32, -57, -47, -37, 62, 17, 35, 40},
+    {-19, -34, 13, -21, 36, 54, -10, -21, 67, -45, -36, -53, -14, 13, -56, 57, 27, 16, 67, 63, -1, 69, -22, -49, -67, -14, -89, -64, -87, 20, -7, 9, 32, 77, -113, 41, 7, 84, -57, -26, -15, -65, -37, -39, 33, 55, 26, 34},
+    {-23, -16, 41, -49, 81, 38, 36, -18, 71, -35, -74, -39, 22, 40, -29, 73, 27, 23, 45, 46, -39, 52, -15, -32, -90, 34, -85, -94, -83, 10, -29, 39, 29, 80, -94, 73, 10, 54, -76, -53, -19, -77, -39, -40, 32, 44, 30, 32},
+    {-35, -4, 44, -41, 64, 70, 25, -8, 70, -40, -95, -65, 18, -15, -23, 55, -5, 6, 8, 47, -45, 60, -8, -18, -101, 10, -94, -66, -86, -4, -42, 42, 28, 68, -83, 55, 10, 52, -52, -34, -29, -59, -56, -23, 50, 9, 36, 36},
+    {-19, -47, 35, -35, 56, 52, 27, -10, 54, -6, -81, -48, 23, 15, -42, 78, 25, 38, 59, 52, -13, 63, -22, -61, -76, 23, -91, -79, -69, 30, -18, 24, 3, 62, -91, 61, -19, 76, -71, -43, -37, -67, -47, -29, 37, 42, 15, 33},
+    {-5, -17, 42, -33, 90, 59, 32, -37, 97, -39, -67, -88, 27, 4, -9, 80, 6, -10, 34, 40, -33, 73, -6, -49, -65, 5, -80, -101, -105, -7, -26, 42, 23, 92, -99, 67, 19, 85, -82, -29, -20, -55, -51, -59, 51, 27, 33, 72},
+    {-12, -11, 38, -25, 54, 42, 16, -36, 36, -40, -70, -71, 6, 16, -20, 51, 14, -2, 25, 29, -23, 47, -33, -18, -61, 0, -59, -72, -86, -10, -16, 10, 4, 63, -80, 49, 17, 57, -33, -24, -15, -62, -26, -34, 44, 21, 39, 30},
+    {3, 3, 72, 2, 74, 43, 27, -16, 66, -29, -68, -84, 13, 3, -29, 82, 35, 4, 30, 64, -35, 77, -50, -14, -92, -5, -91, -91, -77, 14, -10, 20, 11, 98, -120, 62, 8, 58, -63, -17, -34, -62, -45, -55, 44, 28, 28, 30},
+    {-18, -5, 17, -46, 64, 61, 29, -27, 52, -37, -83, -71, 25, 19, -12, 44, 19, 18, 25, 39, -46, 46, -18, -14, -60, 9, -54, -86, -63, -21, -15, 10, -14, 31, -64, 76, 5, 49, -57, -20, -24, -60, -39, -44, 70, 34, 58, 32},
+    {-11, -9, 50, -24, 74, 83, 59, -28, 73, -25, -78, -74, 28, -7, -42, 61, 7, 20, -5, 70, -53, 61, -28, -3, -98, 13, -68, -89, -51, 12, -12, 26, 9, 61, -83, 84, 9, 82, -83, -23, -49, -38, -51, -51, 76, 41, 24, 40},
+    {-20, -25, 47, -17, 49, 57, 35, -32, 61, -13, -89, -93, 28, -6, -28, 50, -6, 11, 3, 57, -27, 55, -35, -26, -79, 29, -81, -78, -49, 8, -13, -4, 1, 102, -94, 55, 0, 78, -71, -59, -47, -33, -30, -35, 72, 36, 33, 43},
+    {-29, -6, 42, -33, 68, 54, 20, 8, 80, -45, -82, -61, 30, -14, -27, 59, -5, 22, 11, 30, -37, 60, -11, -26, -94, 3, -87, -76, -96, 2, -34, 47, 25, 73, -105, 72, 8, 38, -70, -27, -28, -48, -42, -33, 44, 16, 44, 33},
+    {-26, -31, 30, -44, 60, 45, 7, -38, 63, -41, -70, -56, 24, 3, -14, 55, 20, 14, 54, 49, -29, 35, -4, -29, -70, 20, -63, -78, -90, 17, -21, 42, 27, 87, -85, 57, -3, 83, -71, -70, -26, -65, -59, -44, 40, 47, 42, 28},
+    {-25, -19, 30, -51, 78, 75, 33, -9, 98, -21, -75, -50, 26, 10, -32, 96, 11, 14, 42, 49, -25, 87, -12, -59, -99, 12, -110, -85, -86, 0, -44, 51, 28, 64, -93, 74, 3, 77, -79, -17, -25, -73, -55, -45, 46, 38, 23, 44},
+    {-9, -11, 49, -35, 67, 56, 42, -28, 43, -14, -87, -69, 15, 16, -26, 68, 26, 7, 27, 43, -33, 60, -31, -25, -82, 13, -74, -87, -61, 0, -24, 30, -1, 52, -70, 69, 11, 70, -48, -20, -18, -68, -44, -44, 50, 31, 27, 28},
+    {26, -17, 74, -2, 71, 14, -13, -67, 44, -61, -56, -78, 19, 1, 7, 48, 23, -18, 53, 26, -31, 29, -47, -24, -39, -21, -56, -87, -112, -7, 9, -3, 5, 106, -69, 49, 10, 66, -24, -43, -12, -35, -29, -60, 44, 3, 38, 58},
+    {-22, 1, 57, -37, 110, 78, 78, -15, 89, -40, -76, -57, 15, 1, -39, 94, 10, -2, -2, 39, -66, 63, -12, -13, -115, 22, -91, -90, -105, 9, -36, 66, 38, 92, -92, 69, 44, 72, -77, -6, -22, -61, -73, -34, 52, 19, 11, 55},
+    {-29, -23, 13, -45, 42, 52, 0, -46, 53, -65, -54, -51, 0, 5, -40, 42, 3, 2, 33, 28, -19, 43, -11, -32, -57, -4, -66, -58, -102, -11, -27, 20, 27, 59, -60, 54, 16, 78, -40, -33, 4, -49, -31, -30, 45, 26, 46, 35},
+    {0, -7, 66, -12, 74, 52, 27, -28, 63, -18, -88, -96, 33, -10, -20, 74, 13, 10, 33, 56, -35, 70, -42, -43, -71, 14, -75, -102, -66, 3, -19, 26, 0, 76, -89, 73, -4, 85, -71, -42, -37, -52, -41, -51, 63, 29, 23, 40},
+    {-11, -17, 47, -34, 74, 44, 18, -37, 90, -51, -70, -57, 28, -2, 11, 58, 12, -7, 25, 27, -16, 56, -16, -31, -89, -3, -78, -89, -102, -3, -31, 46, 29, 82, -77, 55, 3, 80, -48, -47, -15, -57, -37, -53, 34, 18, 40, 37},
+    {-26, -24, 32, -29, 45, 37, 10, -32, 29, -32, -69, -66, 4, 4, -21, 46, 9, 6, 33, 30, -32, 24, -30, -25, -66, 28, -61, -69, -78, -1, -24, 8, 16, 95, -77, 38, 10, 64, -41, -62, -18, -58, -42, -26, 39, 39, 29, 23},
+    {-16, -26, 42, -6, 51, 26, 21, -16, 37, -32, -72, -67, 14, 12, -43, 50, 28, 28, 41, 38, -25, 30, -43, -36, -49, 18, -61, -84, -65, 12, -4, 9, -8, 81, -88, 67, 0, 75, -68, -47, -21, -39, -11, -45, 51, 49, 29, 29},
+    {-23, -10, 31, -52, 52, 53, -4, -38, 65, -47, -78, -48, 17, 24, -36, 68, 24, 13, 58, 63, -13, 75, -29, -43, -64, 7, -100, -73, -77, -13, -39, 26, 15, 41, -57, 78, -9, 75, -55, -34, -11, -78, -27, -49, 53, 31, 49, 16},
+    {5, -15, 50, -13, 59, 49, 12, -40, 55, -43, -68, -82, 28, 9, -30, 55, 23, 14, 39, 51, -31, 48, -41, -18, -46, -1, -68, -85, -69, -5, -7, 11, -6, 62, -73, 80, -8, 72, -59, -28, -31, -37, -27, -71, 61, 38, 49, 32},
+    {-27, -5, 16, -58, 61, 76, 2, -32, 74, -38, -68, -55, 32, -3, -15, 60, -3, 14, 36, 53, -40, 55, -14, -24, -75, 18, -79, -75, -77, -8, -41, 25, 21, 51, -54, 79, -8, 64, -62, -46, -31, -54, -60, -62, 65, 34, 60, 23},
+    {-26, -23, 38, -39, 43, 69, 20, -7, 64, -4, -85, -66, 31, -4, -29, 71, -1, 23, 22, 52, -19, 68, -21, -33, -105, 27, -98, -66, -56, 7, -36, 17, 10, 71, -95, 55, -11, 56, -58, -47, -49, -55, -52, -33, 46, 40, 35, 23},
+    {-36, -35, -7, -49, 23, 43, 16, -18, 25, -32, -65, -48, -4, 19, -36, 6, -7, 23, 3, 18, -30, 26, -10, -21, -64, 2, -51, -60, -59, -18, -19, -19, 6, 35, -55, 51, 10, 32, -29, -35, -6, -40, -13, -5, 43, 29, 39, 34},
+    {2, 4, 84, -23, 99, 72, 26, -34, 87, -39, -88, -83, 35, -7, -24, 112, 35, 5, 75, 66, -30, 83, -33, -48, -81, 19, -99, -100, -102, 22, -24, 78, 18, 95, -113, 78, 8, 107, -84, -28, -33, -85, -76, -70, 57, 40, 27, 29},
+};
+
+static const int8_t nnCheckDefaultOut[NN_CHECK_WINDOWS][NN_CHECK_VALUES] = {
+    {-31, 0, 22, -32, 0, 21, -34, 0, 20, -30, -1, 19, -26, -3, 19, -20, -5, 19, -15, -5, 17, -9, -4, 13, -1, -6, 9, 5, -6, 7, 15, -8, 4, 23, -9, 1, 28, -8, -1, 29, -9, -3, 31, -10, -2, 28, -11, -3},
+    {15, -28, 16, 19, -27, 18, 21, -27, 18, 18, -27, 18, 13, -31, 17, 9, -33, 15, 2, -36, 13, -5, -39, 10, -13, -42, 8, -21, -46, 5, -30, -48, 2, -36, -50, 0, -38, -51, -1, -38, -51, -1, -38, -50, -2, -33, -48, 0},
+    {7, 0, 26, 12, 2, 26, 11, 2, 26, 10, 0, 25, 11, -6, 22, 10, -10, 21, 8, -14, 16, 6, -17, 7, 4, -21, 1, 1, -26, -5, 1, -31, -12, 1, -33, -18, 4, -35, -22, 6, -35, -23, 8, -35, -23, 9, -34, -22},
+    {48, -3, -18, 50, -3, -16, 53, -3, -14, 45, -4, -11, 35, -6, -7, 26, -9, -4, 15, -16, 2, 5, -23, 10, -7, -29, 18, -21, -35, 22, -37, -37, 27, -49, -39, 32, -54, -41, 35, -53, -40, 37, -56, -37, 35, -47, -34, 35},
+    {4, 9, 21, 7, 10, 22, 8, 10, 22, 5, 9, 22, 3, 6, 22, 0, 3, 22, -4, 0, 21, -8, -4, 19, -12, -7, 17, -17, -11, 15, -21, -13, 14, -24, -15, 12, -24, -16, 10, -23, -16, 10, -23, -15, 10, -20, -14, 10},
+    {-38, -19, 34, -39, -20, 33, -40, -20, 33, -37, -20, 31, -33, -19, 31, -29, -18, 30, -24, -16, 29, -20, -14, 27, -14, -13, 24, -8, -11, 24, -1, -10, 22, 4, -10, 21, 6, -9, 20, 6, -9, 19, 7, -11, 20, 4, -12, 19},
+    {-6, -17, -16, -11, -18, -16, -10, -18, -17, -7, -14, -18, -7, -4, -18, -7, 5, -20, -5, 15, -18, -5, 22, -12, -6, 32, -8, -3, 42, -3, -5, 50, 2, -7, 55, 7, -15, 58, 12, -19, 58, 13, -22, 58, 14, -24, 55, 14},
+    {18, 15, -39, 15, 15, -39, 14, 15, -40, 17, 16, -40, 19, 19, -40, 22, 22, -41, 25, 26, -41, 29, 30, -40, 33, 34, -39, 37, 37, -38, 42, 40, -37, 44, 42, -35, 44, 43, -34, 43, 43, -34, 42, 42, -34, 39, 41, -34},
+    {26, -2, 39, 27, -1, 39, 27, -1, 38, 28, -1, 37, 29, 0, 35, 29, 1, 33, 29, 2, 29, 28, 4, 26, 27, 5, 22, 27, 6, 20, 26, 7, 17, 26, 7, 15, 25, 7, 13, 24, 7, 13, 25, 7, 13, 25, 6, 14},
+    {13, -28, -33, 9, -30, -33, 10, -31, -32, 8, -31, -28, 4, -30, -22, 2, -31, -16, 1, -35, -7, 2, -37, 5, 3, -41, 16, 2, -42, 24, 0, -43, 33, -1, -43, 40, -1, -41, 45, -1, -42, 47, -2, -42, 46, -1, -40, 43},
+    {-39, -44, 56, -39, -45, 55, -41, -44, 54, -34, -42, 49, -26, -39, 45, -19, -34, 39, -11, -26, 32, -6, -18, 23, 2, -11, 13, 13, -4, 9, 24, -1, 2, 32, 1, -3, 33, 4, -5, 30, 3, -7, 33, 1, -6, 26, -3, -4},
+    {18, 65, -25, 20, 66, -25, 22, 65, -23, 14, 62, -18, 6, 55, -13, -1, 46, -7, -10, 34, 0, -15, 23, 7, -22, 12, 16, -33, 1, 18, -44, -5, 23, -51, -9, 26, -48, -12, 27, -44, -11, 29, -46, -9, 27, -38, -5, 26},
+    {-26, 35, -2, -24, 36, -4, -27, 35, -3, -27, 31, -2, -23, 21, -1, -18, 12, 3, -15, 2, 4, -8, -4, -2, 0, -14, -4, 3, -23, -7, 14, -32, -11, 23, -36, -16, 35, -38, -20, 39, -38, -22, 43, -39, -22, 42, -38, -23},
+    {62, 13, -28, 61, 13, -27, 63, 12, -27, 59, 12, -24, 54, 12, -20, 50, 10, -17, 45, 7, -11, 43, 3, -3, 38, 0, 5, 33, -3, 9, 26, -3, 15, 21, -4, 20, 19, -4, 23, 20, -4, 24, 18, -3, 24, 22, -1, 22},
+    {31, -18, -61, 26, -20, -60, 30, -21, -59, 25, -18, -55, 16, -10, -50, 9, -6, -46, 2, -4, -37, -3, -4, -19, -11, -1, -5, -19, 2, 6, -32, 8, 19, -43, 11, 30, -53, 12, 39, -55, 13, 43, -60, 15, 41, -56, 16, 39},
+    {-27, 23, -12, -27, 23, -13, -30, 23, -14, -26, 21, -15, -20, 18, -16, -14, 16, -17, -8, 15, -19, -1, 17, -26, 8, 15, -31, 15, 14, -34, 27, 11, -39, 36, 11, -43, 43, 11, -46, 44, 10, -48, 47, 9, -47, 43, 7, -47},
+    {-37, -5, 5, -39, -6, 3, -41, -6, 3, -37, -7, 3, -33, -7, 3, -29, -8, 3, -23, -8, 3, -17, -6, 1, -10, -6, 0, -3, -6, 0, 6, -6, -1, 13, -6, -2, 17, -5, -3, 17, -6, -4, 19, -7, -4, 15, -8, -5},
+    {1, 9, 5, -2, 8, 5, -2, 8, 4, 0, 11, 4, 1, 17, 3, 2, 22, 2, 4, 28, 3, 5, 33, 6, 6, 39, 7, 9, 45, 10, 9, 50, 13, 9, 53, 16, 5, 55, 18, 3, 55, 19, 1, 54, 19, -1, 53, 19},
+    {2, -35, -21, -6, -38, -22, -6, -38, -22, -1, -33, -22, -1, -20, -20, 1, -10, -20, 6, 1, -15, 9, 10, -3, 13, 21, 4, 20, 33, 13, 21, 44, 22, 21, 49, 31, 13, 54, 38, 8, 53, 40, 5, 52, 40, 1, 50, 39},
+    {-31, 65, -14, -31, 65, -15, -33, 64, -15, -34, 60, -11, -34, 53, -7, -33, 46, -1, -32, 36, 4, -27, 29, 6, -22, 20, 11, -22, 11, 13, -17, 5, 15, -12, 1, 15, -4, 0, 15, 0, 0, 14, 2, 0, 14, 2, 2, 11},
+    {-31, 27, -16, -30, 28, -17, -32, 28, -17, -30, 26, -18, -26, 23, -19, -22, 20, -20, -18, 19, -22, -14, 18, -29, -8, 17, -33, -4, 14, -37, 5, 11, -41, 11, 10, -45, 16, 10, -49, 18, 10, -50, 20, 9, -50, 18, 8, -49},
+    {18, -20, 35, 16, -21, 35, 15, -21, 34, 20, -18, 31, 23, -14, 29, 27, -8, 25, 32, -1, 22, 34, 5, 19, 37, 12, 15, 43, 19, 15, 48, 23, 13, 51, 26, 12, 49, 28, 12, 46, 27, 11, 47, 26, 12, 43, 24, 13},
+    {-34, -25, -43, -38, -26, -43, -38, -27, -43, -37, -26, -41, -39, -21, -38, -38, -19, -35, -37, -17, -29, -34, -16, -21, -31, -14, -13, -29, -11, -7, -28, -8, 0, -28, -6, 6, -30, -4, 10, -31, -5, 11, -32, -5, 11, -34, -5, 9},
+    {43, 1, -22, 45, 2, -21, 48, 2, -21, 44, 4, -21, 39, 6, -22, 33, 9, -25, 27, 11, -26, 19, 11, -24, 8, 14, -24, 0, 15, -24, -12, 18, -23, -21, 19, -22, -28, 18, -21, -29, 19, -20, -32, 21, -20, -28, 21, -19},
+    {-39, -58, -11, -44, -60, -12, -44, -60, -12, -38, -55, -15, -34, -45, -17, -29, -36, -21, -22, -23, -24, -19, -13, -23, -14, -1, -25, -5, 11, -23, 1, 19, -22, 4, 24, -20, -2, 28, -17, -6, 27, -17, -7, 26, -16, -13, 22, -16},
+    {12, 12, -29, 9, 11, -29, 12, 10, -28, 9, 12, -26, 3, 16, -23, -1, 18, -20, -5, 19, -15, -8, 19, -4, -13, 20, 4, -17, 22, 10, -25, 25, 18, -32, 27, 25, -37, 28, 30, -38, 28, 32, -41, 29, 31, -39, 30, 30},
+    {7, 50, -12, 9, 51, -12, 8, 51, -12, 7, 48, -12, 9, 41, -12, 11, 35, -11, 11, 28, -12, 14, 23, -18, 17, 17, -21, 16, 10, -25, 21, 4, -29, 25, 1, -33, 32, -1, -37, 36, -1, -39, 38, -1, -39, 38, 0, -39},
+    {-7, 20, -23, -11, 18, -24, -11, 18, -24, -11, 19, -22, -12, 23, -18, -13, 26, -15, -12, 27, -9, -9, 28, 1, -8, 30, 8, -6, 32, 15, -6, 35, 22, -7, 37, 29, -9, 39, 33, -10, 39, 34, -12, 39, 34, -12, 39, 32},
+    {-28, 4, 44, -28, 4, 42, -32, 4, 41, -25, 3, 38, -16, 2, 35, -7, 2, 32, 2, 4, 26, 11, 8, 16, 22, 10, 7, 33, 12, 2, 49, 11, -6, 61, 11, -12, 67, 12, -16, 67, 11, -19, 71, 8, -17, 65, 6, -17},
+    {-5, 36, 19, -7, 36, 18, -9, 37, 17, -4, 38, 14, 3, 42, 11, 8, 46, 7, 15, 53, 3, 20, 60, -2, 27, 66, -8, 35, 72, -10, 44, 76, -14, 50, 78, -16, 51, 80, -17, 49, 80, -19, 50, 78, -17, 45, 75, -16},
+    {31, 54, -59, 32, 55, -59, 33, 54, -57, 25, 49, -51, 19, 42, -45, 14, 32, -36, 8, 19, -26, 7, 7, -18, 4, -5, -6, -5, -17, -2, -10, -25, 5, -14, -29, 9, -9, -32, 11, -4, -31, 12, -4, -30, 11, 2, -25, 8},
+    {51, -29, 36, 53, -28, 38, 57, -27, 38, 56, -21, 34, 52, -13, 29, 46, -4, 21, 40, 7, 14, 29, 13, 13, 15, 25, 8, 8, 34, 6, -6, 43, 4, -18, 47, 4, -32, 47, 5, -36, 48, 7, -40, 50, 7, -37, 47, 10},
+    {-41, 18, 49, -37, 19, 49, -39, 20, 49, -37, 18, 46, -33, 13, 42, -31, 11, 38, -29, 10, 31, -28, 10, 20, -26, 9, 10, -24, 6, 3, -20, 3, -6, -16, 2, -13, -12, 0, -18, -11, 0, -20, -8, 0, -20, -9, -1, -18},
+    {1, -44, 38, -1, -44, 38, 0, -43, 37, 6, -36, 31, 9, -24, 24, 11, -10, 15, 15, 9, 6, 12, 22, 1, 9, 40, -8, 14, 56, -9, 13, 68, -13, 10, 75, -14, -1, 78, -12, -8, 78, -12, -10, 77, -11, -15, 72, -7},
+    {-43, -27, 33, -41, -27, 32, -42, -26, 32, -38, -25, 28, -34, -24, 23, -31, -21, 17, -27, -16, 9, -27, -12, 0, -26, -7, -10, -22, -3, -16, -18, -1, -24, -15, -1, -30, -15, 0, -33, -17, -1, -35, -15, -1, -34, -18, -3, -31},
+    {-36, 41, 1, -35, 41, 0, -37, 41, 0, -37, 37, 2, -35, 29, 3, -33, 21, 6, -32, 13, 8, -28, 7, 4, -23, -2, 3, -22, -10, 1, -16, -17, -2, -11, -21, -5, -2, -22, -8, 2, -22, -9, 5, -23, -10, 5, -21, -11},
+    {-17, -18, -24, -26, -21, -25, -26, -21, -26, -21, -16, -25, -20, -2, -22, -17, 9, -22, -10, 21, -16, -5, 32, -2, 1, 43, 7, 10, 57, 17, 13, 68, 28, 14, 75, 38, 7, 80, 46, 2, 79, 48, -1, 78, 49, -7, 75, 46},
+    {-31, -23, 4, -31, -23, 2, -35, -23, 2, -29, -24, 0, -23, -25, -2, -15, -26, -3, -8, -25, -7, 0, -22, -13, 10, -22, -19, 19, -21, -23, 32, -22, -28, 41, -23, -32, 48, -22, -34, 48, -22, -37, 51, -25, -36, 45, -26, -36},
+    {10, 27, 3, 7, 25, 3, 8, 25, 3, 7, 25, 6, 3, 26, 10, 1, 26, 14, 0, 24, 21, 0, 22, 30, -1, 20, 38, -2, 19, 44, -5, 20, 51, -7, 20, 56, -8, 21, 60, -8, 21, 62, -9, 21, 61, -8, 22, 59},
+    {35, 26, 2, 36, 26, 3, 38, 25, 4, 33, 24, 7, 26, 22, 11, 20, 19, 15, 13, 13, 20, 8, 7, 27, 0, 1, 34, -8, -4, 37, -19, -6, 42, -26, -7, 46, -28, -9, 48, -26, -8, 50, -28, -7, 49, -22, -4, 48},
+    {-34, -11, -3, -37, -12, -4, -38, -13, -4, -37, -14, -3, -35, -15, 0, -31, -17, 4, -28, -19, 8, -22, -20, 11, -15, -23, 15, -10, -24, 18, -3, -26, 20, 3, -26, 22, 7, -25, 23, 8, -26, 23, 9, -27, 23, 7, -27, 21},
+    {-10, -1, 26, -10, -1, 25, -11, -1, 25, -8, -1, 23, -4, 0, 21, -1, 2, 18, 3, 5, 15, 5, 9, 11, 9, 11, 6, 14, 14, 4, 19, 15, 0, 23, 16, -2, 24, 17, -3, 23, 17, -5, 24, 16, -4, 21, 14, -3},
+    {2, 17, 20, 6, 19, 20, 6, 19, 20, 4, 18, 19, 5, 12, 17, 4, 9, 16, 2, 5, 12, -1, 2, 5, -3, -1, 0, -6, -5, -5, -7, -9, -11, -7, -11, -15, -5, -13, -19, -3, -13, -20, -2, -13, -20, 0, -12, -19},
+    {-31, 44, -37, -37, 42, -39, -40, 41, -39, -36, 40, -37, -31, 41, -33, -24, 40, -29, -16, 39, -23, -4, 41, -17, 9, 40, -11, 20, 40, -6, 34, 40, -2, 44, 41, 2, 51, 43, 4, 51, 42, 3, 53, 40, 4, 47, 39, 1},
+    {8, 57, -42, 7, 57, -42, 7, 57, -42, 3, 53, -38, 1, 47, -33, 0, 40, -27, -2, 30, -21, 0, 23, -16, 2, 13, -9, -1, 5, -7, -1, -1, -3, 0, -4, -1, 6, -6, -1, 10, -6, 0, 11, -6, -1, 13, -3, -3},
+    {18, -8, 19, 20, -7, 20, 22, -7, 21, 18, -7, 22, 13, -10, 23, 8, -12, 23, 1, -16, 24, -5, -21, 26, -13, -24, 27, -20, -28, 27, -30, -29, 28, -36, -31, 28, -38, -32, 29, -38, -32, 30, -39, -31, 29, -34, -28, 29},
+    {-18, -47, -81, -18, -47, -80, -19, -47, -80, -19, -47, -80, -19, -47, -80, -19, -47, -80, -19, -47, -80, -18, -47, -80, -18, -47, -81, -19, -47, -81, -19, -47, -81, -19, -47, -81, -19, -47, -81, -18, -47, -81, -19, -47, -81, -19, -47, -80},
+    {28, 55, 85, 28, 55, 84, 28, 55, 84, 28, 55, 84, 29, 55, 84, 29, 55, 84, 29, 55, 84, 28, 54, 84, 28, 54, 84, 29, 54, 85, 29, 54, 84, 29, 54, 84, 29, 54, 84, 28, 54, 84, 29, 54, 84, 29, 54, 84},
+};
+
+#endif // NN_CHECK_H
@@ -0,0 +1,205 @@
+// SIGNALTAP History Block Report (host)
+// What the compressed history block (src/data/history_block) holds and
+// what reading it back costs.
+//  - Machines: each demo's simulation runs for -h hours at 1 Hz into its
+//    own block (sim_get_history_block, as the UI and /history/raw read
+//    it); reports samples, span, chunks in use, bytes per sample, the
+//    ratio against raw (u32 time + 3 floats) and how many hours the block
+//    holds at that rate
+//  - Seeks: hblock_seek_time to random times and hblock_seek_last, time to
+//    the first sample (decoding from the chunk's restart point), and the
+//    whole-block read rate
+//  - Round trip, exit 1 on a failure: 4 days of synthetic samples (noise,
+//    steps, repeats, negative zero, extremes) written to a block and read
+//    back bit-exact; every seek lands on the first sample at or after its
+//    time, seek_last on the n-th newest; the oldest chunks are recycled
+//    once the block is full
+//
+// Build: make -C tools history_report (tools/Makefile, against tools/host/Arduino.h)
+// Run it from a scratch directory: the simulation's store writes there.
+//
+// Usage: history_report [-h hours (24)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include "../src/data/simulation_engine.h"
+
+#define SEEKS           2000
+#define ROUND_TRIP_S    (4 * 86400)     // Over one block at this entropy: recycles
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t rng = 0x2545F491;
+
+static uint32_t xorshift(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint32_t failures = 0;
+
+static void fail(const char* what, uint32_t at) {
+    if (failures < 10) printf("  FAILED: %s (t %lu)\n", what, (unsigned long)at);
+    failures++;
+}
+
+// ============ Seeks ============
+static void seek_timing(HistoryBlock_t* b, uint32_t oldest, uint32_t newest) {
+    HBlockIter_t it;
+    uint32_t t;
+    float v[HBLOCK_SERIES];
+    double start = now_ns();
+    for (int i = 0; i < SEEKS; i++) {
+        uint32_t at = oldest + xorshift() % (newest - oldest + 1);
+        if (hblock_seek_time(b, &it, at)) hblock_next(&it, &t, v);
+    }
+    double timeUs = (now_ns() - start) / SEEKS / 1e3;
+
+    start = now_ns();
+    for (int i = 0; i < SEEKS; i++) {
+        if (hblock_seek_last(b, &it, 1 + xorshift() % 3600)) hblock_next(&it, &t, v);
+    }
+    double lastUs = (now_ns() - start) / SEEKS / 1e3;
+
+    start = now_ns();
+    uint32_t n = 0;
+    if (hblock_seek_time(b, &it, 0)) {
+        while (hblock_next(&it, &t, v)) n++;
+    }
+    double readS = (now_ns() - start) / 1e9;
+    printf("    seek_time %.2f us, seek_last (<= 1 h back) %.2f us to the first sample; "
+           "whole block %.1f M samples/s\n",
+           timeUs, lastUs, readS > 0 ? n / readS / 1e6 : 0.0);
+}
+
+// ============ Machines ============
+static void machines(uint32_t hours) {
+    sim_init();
+    printf("machines, %lu h at 1 Hz:\n", (unsigned long)hours);
+    for (uint8_t d = 0; d < DEMO_COUNT; d++) {
+        sim_set_demo(d);
+        for (uint32_t h = 0; h < hours; h++) sim_step(SIM_TICK_MS, 3600);
+
+        HistoryBlock_t* b = sim_get_history_block();
+        const HBlockStats_t* st = hblock_get_stats(b);
+        uint32_t oldest = 0, newest = 0;
+        if (!hblock_time_range(b, &oldest, &newest)) {
+            printf("  %-22s no history block\n", sim_get_demo()->name);
+            failures++;
+            continue;
+        }
+        float holdsH = st->bytesPerSample > 0 ?
+            (float)HBLOCK_CHUNKS * HBLOCK_CHUNK_BYTES / st->bytesPerSample / 3600.0f : 0.0f;
+        printf("  %-22s %lu samples over %.1f h in %u/%u chunks: %.2f bytes/sample, %.1fx, "
+               "block holds %.0f h\n",
+               sim_get_demo()->name, (unsigned long)st->samples, st->spanS / 3600.0f, b->count,
+               HBLOCK_CHUNKS, st->bytesPerSample, st->compressionRatio, holdsH);
+        seek_timing(b, oldest, newest);
+    }
+}
+
+// ============ Round trip ============
+typedef struct {
+    uint32_t t;
+    float v[HBLOCK_SERIES];
+} Sample_t;
+
+static float synthetic(uint32_t k, int ch, float last) {
+    switch ((k / 997 + ch) % 5) {
+        case 0:  return last;                                           // Repeats
+        case 1:  return roundf((20.0f + ch * 30.0f + (xorshift() % 200) / 10.0f) * 10.0f) / 10.0f;
+        case 2:  return (xorshift() & 1) ? -0.0f : 0.0f;
+        case 3:  return (xorshift() % 64 == 0) ? 3.4e38f : -1.0e-30f;  // Extremes and steps
+        default: {
+            uint32_t bits = xorshift() & 0x7F7FFFFF;                    // Finite noise
+            float f;
+            memcpy(&f, &bits, sizeof(f));
+            return f;
+        }
+    }
+}
+
+static bool same(const float* a, const float* b) {
+    return memcmp(a, b, HBLOCK_SERIES * sizeof(float)) == 0;
+}
+
+static void round_trip(void) {
+    static HistoryBlock_t block;
+    if (!hblock_init(&block)) {
+        printf("round trip: no block\n");
+        failures++;
+        return;
+    }
+    std::vector<Sample_t> ref;
+    ref.reserve(ROUND_TRIP_S);
+    Sample_t s = {0, {0, 0, 0}};
+    for (uint32_t k = 0; k < ROUND_TRIP_S; k++) {
+        s.t = 1000 + k + (k / 3000) * 60;   // A minute's gap now and then
+        for (int ch = 0; ch < HBLOCK_SERIES; ch++) s.v[ch] = synthetic(k, ch, s.v[ch]);
+        hblock_append(&block, s.t, s.v);
+        ref.push_back(s);
+    }
+
+    // What is still held: the newest block.samples of them
+    const HBlockStats_t* st = hblock_get_stats(&block);
+    uint32_t held = st->samples;
+    if (held == 0 || held >= ref.size()) fail("no chunk recycled", held);
+    if (held == 0) return;
+    size_t first = ref.size() - held;
+    HBlockIter_t it;
+    uint32_t t;
+    float v[HBLOCK_SERIES];
+    uint32_t n = 0;
+    if (!hblock_seek_time(&block, &it, 0)) fail("seek to the start", 0);
+    while (hblock_next(&it, &t, v)) {
+        if (first + n >= ref.size() || t != ref[first + n].t || !same(v, ref[first + n].v)) {
+            fail("read back differs", t);
+            break;
+        }
+        n++;
+    }
+    if (n != held) fail("read back short", n);
+
+    for (int i = 0; i < SEEKS; i++) {
+        size_t k = first + xorshift() % held;
+        uint32_t at = ref[k].t - (xorshift() % 2) * (uint32_t)(xorshift() % 90);
+        while (k > first && ref[k - 1].t >= at) k--;
+        if (!hblock_seek_time(&block, &it, at) || !hblock_next(&it, &t, v) || t != ref[k].t ||
+            !same(v, ref[k].v)) {
+            fail("seek_time lands wrong", at);
+            break;
+        }
+    }
+    for (int i = 0; i < SEEKS; i++) {
+        uint32_t back = 1 + xorshift() % held;
+        const Sample_t* r = &ref[ref.size() - back];
+        if (!hblock_seek_last(&block, &it, back) || !hblock_next(&it, &t, v) || t != r->t ||
+            !same(v, r->v)) {
+            fail("seek_last lands wrong", back);
+            break;
+        }
+    }
+    printf("round trip: %lu samples written, %lu held (%.2f bytes/sample), %lu read back, "
+           "%d seeks each way\n",
+           (unsigned long)ref.size(), (unsigned long)held, st->bytesPerSample, (unsigned long)n, SEEKS);
+}
+
+int main(int argc, char** argv) {
+    uint32_t hours = 24;
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-h") == 0) hours = (uint32_t)atol(argv[a + 1]);
+    }
+    machines(hours);
+    round_trip();
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,84 @@
+// SIGNALTAP Arduino Host Shim
+// The few Arduino core calls the modules under src/ make, on a POSIX host,
+// so the tools in tools/ can build them without the ESP32 core:
+// millis/micros from CLOCK_MONOTONIC since start, random, delay, ps_malloc
+// (plain malloc), and a Serial that writes to stdout. Device-only code
+// stays behind #if defined(ARDUINO), which this shim does not define.
+#ifndef SIGNALTAP_HOST_ARDUINO_H
+#define SIGNALTAP_HOST_ARDUINO_H
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static inline uint64_t host_clock_us(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000ULL + t.tv_nsec / 1000;
+}
+
+// Counted from the first call (process start, as the device counts from
+// boot); one base for every translation unit
+inline uint64_t host_clock_base(void) {
+    static const uint64_t base = host_clock_us();
+    return base;
+}
+
+static inline unsigned long millis(void) {
+    return (unsigned long)((host_clock_us() - host_clock_base()) / 1000);
+}
+
+static inline unsigned long micros(void) {
+    return (unsigned long)(host_clock_us() - host_clock_base());
+}
+
+// [lo, hi) as on the device
+static inline long random(long lo, long hi) {
+    return hi > lo ? lo + rand() % (hi - lo) : lo;
+}
+
+static inline long random(long hi) {
+    return hi > 0 ? rand() % hi : 0;
+}
+
+static inline void delay(unsigned long ms) {
+    struct timespec t = { (time_t)(ms / 1000), (long)(ms % 1000) * 1000000L };
+    nanosleep(&t, NULL);
+}
+
+static inline void* ps_malloc(size_t n) {
+    return malloc(n);
+}
+
+struct HostSerial {
+    void begin(unsigned long) {}
+    size_t write(const uint8_t* data, size_t len) { return fwrite(data, 1, len, stdout); }
+    template <class T> void print(T v) { print_one(v); }
+    template <class T> void println(T v) {
+        print_one(v);
+        fputc('\n', stdout);
+    }
+    void printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        va_list ap;
+        va_start(ap, fmt);
+        vfprintf(stdout, fmt, ap);
+        va_end(ap);
+    }
+
+private:
+    void print_one(const char* s) { fputs(s, stdout); }
+    void print_one(long v) { fprintf(stdout, "%ld", v); }
+    void print_one(unsigned long v) { fprintf(stdout, "%lu", v); }
+    void print_one(int v) { fprintf(stdout, "%d", v); }
+    void print_one(unsigned v) { fprintf(stdout, "%u", v); }
+    void print_one(double v) { fprintf(stdout, "%.2f", v); }
+};
+
+static HostSerial Serial __attribute__((unused));
+
+#endif // SIGNALTAP_HOST_ARDUINO_H
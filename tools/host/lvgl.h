@@ -0,0 +1,180 @@
+// SIGNALTAP LVGL Host Shim
+// The LVGL 8 calls the UI list modules under src/ui/ make, on a POSIX host,
+// so the tools in tools/ can build them without the display stack: objects
+// are plain records (position, size, scroll, flags, label text, event
+// callbacks) that draw nothing. Every call that would change a widget is
+// counted in hostLv, as is every object created, so a bench can tell how
+// much widget work an update asked for; lv_obj_scroll_to_y() sends
+// LV_EVENT_SCROLL to the object's callbacks as LVGL does.
+#ifndef SIGNALTAP_HOST_LVGL_H
+#define SIGNALTAP_HOST_LVGL_H
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HOST_LV_TEXT_MAX    64
+#define HOST_LV_EVENT_CBS   2
+
+typedef struct {
+    uint32_t objects;       // Created
+    uint32_t writes;        // Style, layout, flag and text calls
+} HostLvStats_t;
+
+inline HostLvStats_t hostLv = {};
+
+typedef struct { uint32_t full; } lv_color_t;
+typedef struct { int unused; } lv_font_t;
+typedef uint8_t lv_opa_t;
+typedef uint32_t lv_style_selector_t;
+
+typedef enum { LV_EVENT_CLICKED = 7, LV_EVENT_SCROLL = 11 } lv_event_code_t;
+typedef enum { LV_ALIGN_LEFT_MID = 7, LV_ALIGN_RIGHT_MID = 8, LV_ALIGN_CENTER = 9 } lv_align_t;
+typedef enum { LV_DIR_VER = 12 } lv_dir_t;
+typedef enum { LV_ANIM_OFF = 0, LV_ANIM_ON } lv_anim_enable_t;
+typedef enum { LV_LABEL_LONG_DOT = 1 } lv_label_long_mode_t;
+typedef enum { LV_BORDER_SIDE_BOTTOM = 1 } lv_border_side_t;
+
+#define LV_OBJ_FLAG_HIDDEN      (1u << 0)
+#define LV_OBJ_FLAG_CLICKABLE   (1u << 1)
+#define LV_OBJ_FLAG_SCROLLABLE  (1u << 4)
+#define LV_OPA_TRANSP           0
+#define LV_OPA_50               127
+#define LV_OPA_COVER            255
+
+typedef struct _lv_obj_t lv_obj_t;
+
+typedef struct {
+    lv_obj_t* target;
+    lv_event_code_t code;
+    void* user_data;
+} lv_event_t;
+
+typedef void (*lv_event_cb_t)(lv_event_t* e);
+
+struct _lv_obj_t {
+    lv_obj_t* parent;
+    lv_obj_t* child;        // First child, then each one's next
+    lv_obj_t* next;
+    int32_t x, y, w, h;
+    int32_t scrollY;
+    uint32_t flags;
+    char text[HOST_LV_TEXT_MAX];
+    lv_event_cb_t cb[HOST_LV_EVENT_CBS];
+    lv_event_code_t cbCode[HOST_LV_EVENT_CBS];
+    void* cbData[HOST_LV_EVENT_CBS];
+};
+
+static const lv_font_t lv_font_montserrat_12 __attribute__((unused)) = {0};
+
+static inline lv_color_t lv_color_hex(uint32_t c) {
+    lv_color_t color = {c};
+    return color;
+}
+
+// ============ Objects ============
+static inline lv_obj_t* lv_obj_create(lv_obj_t* parent) {
+    lv_obj_t* o = (lv_obj_t*)calloc(1, sizeof(lv_obj_t));
+    if (!o) return NULL;
+    o->parent = parent;
+    if (parent) {
+        o->next = parent->child;
+        parent->child = o;
+    }
+    hostLv.objects++;
+    return o;
+}
+
+// With its children, as LVGL deletes a screen
+static inline void lv_obj_del(lv_obj_t* o) {
+    if (!o) return;
+    while (o->child) {
+        lv_obj_t* c = o->child;
+        o->child = c->next;
+        c->parent = NULL;
+        lv_obj_del(c);
+    }
+    if (o->parent) {
+        lv_obj_t** p = &o->parent->child;
+        while (*p != o) p = &(*p)->next;
+        *p = o->next;
+    }
+    free(o);
+}
+
+static inline lv_obj_t* lv_label_create(lv_obj_t* parent) { return lv_obj_create(parent); }
+static inline lv_obj_t* lv_btn_create(lv_obj_t* parent) { return lv_obj_create(parent); }
+
+static inline void lv_obj_add_event_cb(lv_obj_t* o, lv_event_cb_t cb, lv_event_code_t code, void* data) {
+    for (int i = 0; i < HOST_LV_EVENT_CBS; i++) {
+        if (!o->cb[i]) {
+            o->cb[i] = cb;
+            o->cbCode[i] = code;
+            o->cbData[i] = data;
+            return;
+        }
+    }
+}
+
+static inline void* lv_event_get_user_data(lv_event_t* e) { return e->user_data; }
+
+static inline void host_lv_send(lv_obj_t* o, lv_event_code_t code) {
+    for (int i = 0; i < HOST_LV_EVENT_CBS; i++) {
+        if (o->cb[i] && o->cbCode[i] == code) {
+            lv_event_t e = {o, code, o->cbData[i]};
+            o->cb[i](&e);
+        }
+    }
+}
+
+// ============ Layout and flags ============
+static inline void lv_obj_set_pos(lv_obj_t* o, int32_t x, int32_t y) { o->x = x; o->y = y; hostLv.writes++; }
+static inline void lv_obj_set_y(lv_obj_t* o, int32_t y) { o->y = y; hostLv.writes++; }
+static inline void lv_obj_set_size(lv_obj_t* o, int32_t w, int32_t h) { o->w = w; o->h = h; hostLv.writes++; }
+static inline void lv_obj_set_width(lv_obj_t* o, int32_t w) { o->w = w; hostLv.writes++; }
+static inline void lv_obj_set_height(lv_obj_t* o, int32_t h) { o->h = h; hostLv.writes++; }
+static inline void lv_obj_align(lv_obj_t* o, lv_align_t, int32_t x, int32_t y) { o->x = x; o->y = y; hostLv.writes++; }
+static inline void lv_obj_center(lv_obj_t*) { hostLv.writes++; }
+static inline void lv_obj_add_flag(lv_obj_t* o, uint32_t f) { o->flags |= f; hostLv.writes++; }
+static inline void lv_obj_clear_flag(lv_obj_t* o, uint32_t f) { o->flags &= ~f; hostLv.writes++; }
+static inline void lv_obj_set_scroll_dir(lv_obj_t*, lv_dir_t) { hostLv.writes++; }
+static inline int32_t lv_obj_get_scroll_y(const lv_obj_t* o) { return o->scrollY; }
+
+static inline void lv_obj_scroll_to_y(lv_obj_t* o, int32_t y, lv_anim_enable_t) {
+    o->scrollY = y;
+    host_lv_send(o, LV_EVENT_SCROLL);
+}
+
+// ============ Styles ============
+static inline void lv_obj_set_style_bg_color(lv_obj_t*, lv_color_t, lv_style_selector_t) { hostLv.writes++; }
+static inline void lv_obj_set_style_bg_opa(lv_obj_t*, lv_opa_t, lv_style_selector_t) { hostLv.writes++; }
+static inline void lv_obj_set_style_opa(lv_obj_t*, lv_opa_t, lv_style_selector_t) { hostLv.writes++; }
+static inline void lv_obj_set_style_border_color(lv_obj_t*, lv_color_t, lv_style_selector_t) { hostLv.writes++; }
+static inline void lv_obj_set_style_border_width(lv_obj_t*, int32_t, lv_style_selector_t) { hostLv.writes++; }
+static inline void lv_obj_set_style_border_side(lv_obj_t*, lv_border_side_t, lv_style_selector_t) { hostLv.writes++; }
+static inline void lv_obj_set_style_radius(lv_obj_t*, int32_t, lv_style_selector_t) { hostLv.writes++; }
+static inline void lv_obj_set_style_pad_all(lv_obj_t*, int32_t, lv_style_selector_t) { hostLv.writes++; }
+static inline void lv_obj_set_style_shadow_width(lv_obj_t*, int32_t, lv_style_selector_t) { hostLv.writes++; }
+static inline void lv_obj_set_style_text_color(lv_obj_t*, lv_color_t, lv_style_selector_t) { hostLv.writes++; }
+static inline void lv_obj_set_style_text_font(lv_obj_t*, const lv_font_t*, lv_style_selector_t) { hostLv.writes++; }
+
+// ============ Labels ============
+static inline void lv_label_set_long_mode(lv_obj_t*, lv_label_long_mode_t) { hostLv.writes++; }
+
+static inline void lv_label_set_text(lv_obj_t* o, const char* text) {
+    snprintf(o->text, sizeof(o->text), "%s", text ? text : "");
+    hostLv.writes++;
+}
+
+static inline void lv_label_set_text_fmt(lv_obj_t* o, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+static inline void lv_label_set_text_fmt(lv_obj_t* o, const char* fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(o->text, sizeof(o->text), fmt, ap);
+    va_end(ap);
+    hostLv.writes++;
+}
+
+#endif // SIGNALTAP_HOST_LVGL_H
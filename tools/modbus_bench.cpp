@@ -0,0 +1,128 @@
+// SIGNALTAP Modbus Bench (host)
+// Polls a Modbus TCP server or an RTU slave (serial port or pty) through
+// the master in src/fieldbus and reports throughput in tags per second.
+// The default tag set is synthetic: 32-bit tags in runs of 8 with small
+// gaps between runs, spread over units and polled as fast as possible. The
+// slave is expected to answer every register with its own address, which
+// the bench checks. -m polls the real tag map (modbus_tags.h) at its
+// configured rates and prints the values instead. tools/modbus_slave.cpp
+// is such a slave, over TCP or a pty.
+//
+// Build: make -C tools modbus_bench (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage:
+//   modbus_bench [options] tcp <host> <port>
+//   modbus_bench [options] rtu <device> <baud> [parity]
+// Options: -n tags (100), -u units (1), -j in flight (4), -g coalesce gap (8),
+//          -s seconds (5), -m tag map
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <poll.h>
+#include "../src/fieldbus/modbus_master.h"
+#include "../src/fieldbus/modbus_tags.h"
+
+static MbLink_t link;
+static MbMaster_t master;
+static MbTagDef_t synthTags[MB_MAX_TAGS];
+static uint32_t wrongValues;
+
+static void check_value(uint16_t tag, const MbTagDef_t* def, float value, void* ctx) {
+    (void)tag;
+    (void)ctx;
+    uint32_t raw = ((uint32_t)def->addr << 16) | (uint16_t)(def->addr + 1);
+    if (value != (float)raw) wrongValues++;
+}
+
+static void print_value(uint16_t tag, const MbTagDef_t* def, float value, void* ctx) {
+    (void)ctx;
+    printf("%8.3f s  tag %2u  unit %u  %u:%-5u  machine %u sensor %u  = %.3f\n",
+           micros() / 1e6, tag, def->unit, def->fn, def->addr, def->machine, def->sensor, value);
+}
+
+static uint16_t make_synth(uint16_t n, uint8_t units) {
+    if (n > MB_MAX_TAGS) n = MB_MAX_TAGS;
+    for (uint16_t i = 0; i < n; i++) {
+        uint16_t j = i / units;                 // Index within the unit
+        MbTagDef_t* t = &synthTags[i];
+        t->unit = (uint8_t)(1 + i % units);
+        t->fn = MB_FC_READ_HOLDING;
+        t->addr = (uint16_t)(j * 2 + (j / 8) * 3);
+        t->type = MB_U32;
+        t->scale = 1.0f;
+        t->offset = 0.0f;
+        t->periodMs = 0;
+    }
+    return n;
+}
+
+int main(int argc, char** argv) {
+    int n = 100, units = 1, inflight = MB_TCP_INFLIGHT, gap = MB_COALESCE_GAP, seconds = 5;
+    bool tagMap = false;
+    int a = 1;
+    for (; a < argc && argv[a][0] == '-'; a++) {
+        char opt = argv[a][1];
+        if (opt == 'm') {
+            tagMap = true;
+            continue;
+        }
+        if (a + 1 >= argc) break;
+        int v = atoi(argv[++a]);
+        if (opt == 'n') n = v;
+        else if (opt == 'u') units = v < 1 ? 1 : v;
+        else if (opt == 'j') inflight = v;
+        else if (opt == 'g') gap = v;
+        else if (opt == 's') seconds = v;
+    }
+    if (argc - a < 3) {
+        fprintf(stderr, "usage: %s [-n tags] [-u units] [-j inflight] [-g gap] [-s seconds] [-m]\n"
+                        "          tcp <host> <port> | rtu <device> <baud> [parity]\n", argv[0]);
+        return 2;
+    }
+
+    bool ok;
+    if (strcmp(argv[a], "rtu") == 0) {
+        char parity = argc - a > 3 ? argv[a + 3][0] : 'N';
+        ok = mb_link_rtu(&link, argv[a + 1], (uint32_t)atol(argv[a + 2]), parity);
+    } else {
+        ok = mb_link_tcp(&link, argv[a + 1], (uint16_t)atoi(argv[a + 2]));
+    }
+    if (!ok) {
+        fprintf(stderr, "%s %s: cannot open\n", argv[a], argv[a + 1]);
+        return 1;
+    }
+
+    if (tagMap) {
+        mb_master_init(&master, &link, modbusTags, MODBUS_TAG_COUNT, print_value, NULL);
+    } else {
+        uint16_t count = make_synth((uint16_t)n, (uint8_t)units);
+        mb_master_init(&master, &link, synthTags, count, check_value, NULL);
+    }
+    master.maxInflight = (uint8_t)inflight;
+    master.coalesceGap = (uint16_t)gap;
+
+    uint32_t t0 = micros();
+    uint32_t runUs = (uint32_t)seconds * 1000000UL;
+    while ((uint32_t)(micros() - t0) < runUs) {
+        mb_master_poll(&master, micros());
+        // Nothing to send: sleep until the link has bytes (or briefly)
+        struct pollfd p = {link.fd, POLLIN, 0};
+        if (link.open) poll(&p, 1, 1);
+    }
+    double wall = (uint32_t)(micros() - t0) / 1e6;
+
+    const MbStats_t* st = mb_master_stats(&master);
+    printf("%s %s: %u tags over %d unit(s), %d in flight, gap %d\n", argv[a], argv[a + 1],
+           master.count, tagMap ? 4 : units, link.type == MB_LINK_RTU ? 1 : inflight, gap);
+    printf("  %.0f tags/s, %.0f requests/s, %.1f tags/request, %.1f registers/request\n",
+           st->tagReads / wall, st->responses / wall,
+           st->responses ? (double)st->tagReads / st->responses : 0.0,
+           st->responses ? (double)st->regsRead / st->responses : 0.0);
+    printf("  latency %.0f us, %u in flight max, %lu timeouts, %lu exceptions, %lu bad frames, "
+           "%lu reconnects, %lu wrong values\n",
+           st->avgLatencyUs, st->maxInflight, (unsigned long)st->timeouts,
+           (unsigned long)st->exceptions, (unsigned long)st->badFrames,
+           (unsigned long)st->reconnects, (unsigned long)(tagMap ? 0 : wrongValues));
+    mb_link_close(&link);
+    return 0;
+}
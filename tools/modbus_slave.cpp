@@ -0,0 +1,311 @@
+// SIGNALTAP Modbus Loopback Slave (host)
+// The slave modbus_bench polls: every holding / input register reads as
+// its own address, on every unit, so the bench can check each value.
+//  - TCP: listens on 127.0.0.1; each reply is held -d us (a PLC scan) plus
+//    up to -j us of jitter, and the held replies go out as they come due,
+//    so pipelined requests can be answered out of order. -x drops that
+//    many replies per thousand
+//  - RTU: opens a pty and prints its name for modbus_bench rtu; replies
+//    after -t us turnaround, and -c / -k corrupt a data byte in / cut the
+//    CRC off that many replies per thousand. The pty adds no wire time.
+//    After 2 s without a request it prints the frames served and the
+//    shortest gap between a reply and the next request against t3.5, and
+//    exits once it has served any
+//  - Unit MB_SLAVE_BAD_UNIT answers with an exception (illegal address)
+//  - -s stops either one after that many seconds
+//
+// Build: make -C tools modbus_slave (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage:
+//   modbus_slave [-d hold us (2000)] [-j jitter us (0)] [-x drop/1000] [-s s] tcp <port>
+//   modbus_slave [-t turnaround us (0)] [-c corrupt/1000] [-k truncate/1000] [-s s] rtu <baud>
+//
+// The numbers in the modbus_bench notes came from, with each bench run
+// modbus_bench -n 128 -u 4 -j 1|2|4 [-g 0] tcp 127.0.0.1 5020 (or rtu <pty>):
+//   modbus_slave tcp 5020                     2 ms held replies
+//   modbus_slave -j 3000 -x 5 tcp 5020        out of order, 0.5% dropped
+//   modbus_slave rtu 115200 / rtu 9600        pty loopback
+//   modbus_slave -c 10 -k 10 rtu 115200       1% corrupt, 1% truncated
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pty.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#define MB_SLAVE_BAD_UNIT       99
+#define MB_SLAVE_CLIENTS        8
+#define MB_SLAVE_HELD           4096
+#define MB_SLAVE_IDLE_MS        2000
+
+static uint64_t now_us(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000ull + t.tv_nsec / 1000;
+}
+
+static uint32_t rng = 0x2545F491;
+
+static uint32_t xorshift(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static bool per_mille(int rate) {
+    return rate > 0 && (int)(xorshift() % 1000) < rate;
+}
+
+// ============ PDU ============
+// Function, byte count / exception code, registers; returns the PDU length
+static int build_pdu(uint8_t unit, uint8_t fn, uint16_t start, uint16_t count, uint8_t* out) {
+    if (unit == MB_SLAVE_BAD_UNIT || (fn != 3 && fn != 4) || count < 1 || count > 125) {
+        out[0] = fn | 0x80;
+        out[1] = 2;
+        return 2;
+    }
+    out[0] = fn;
+    out[1] = (uint8_t)(count * 2);
+    for (uint16_t i = 0; i < count; i++) {
+        uint16_t v = (uint16_t)(start + i);
+        out[2 + 2 * i] = v >> 8;
+        out[3 + 2 * i] = v & 0xFF;
+    }
+    return 2 + count * 2;
+}
+
+// ============ TCP ============
+typedef struct {
+    int fd;
+    uint64_t dueUs;
+    uint16_t len;
+    uint8_t buf[7 + 2 + 250];
+} Held_t;
+
+typedef struct {
+    int fd;
+    uint16_t len;
+    uint8_t rx[600];
+} Client_t;
+
+static Held_t held[MB_SLAVE_HELD];
+static int heldCount = 0;
+
+static void drop_client(Client_t* clients, int* count, int i) {
+    close(clients[i].fd);
+    for (int h = 0; h < heldCount; h++) {
+        if (held[h].fd == clients[i].fd) held[h--] = held[--heldCount];
+    }
+    clients[i] = clients[--(*count)];
+}
+
+// Whole MBAP frames off the front of the client's buffer, each one held
+static void take_requests(Client_t* c, int holdUs, int jitterUs, int drop, uint32_t* dropped) {
+    while (c->len >= 12) {
+        const uint8_t* r = c->rx;
+        uint16_t frame = (uint16_t)(6 + ((r[4] << 8) | r[5]));
+        if (frame > sizeof(c->rx)) {
+            c->len = 0;
+            return;
+        }
+        if (c->len < frame) return;
+        if (per_mille(drop)) {
+            (*dropped)++;
+        } else if (heldCount < MB_SLAVE_HELD) {
+            Held_t* h = &held[heldCount++];
+            h->fd = c->fd;
+            h->dueUs = now_us() + holdUs + (jitterUs > 0 ? xorshift() % jitterUs : 0);
+            int pdu = build_pdu(r[6], r[7], (uint16_t)((r[8] << 8) | r[9]), (uint16_t)((r[10] << 8) | r[11]),
+                                h->buf + 7);
+            memcpy(h->buf, r, 4);       // Transaction and protocol id
+            h->buf[4] = (uint8_t)((pdu + 1) >> 8);
+            h->buf[5] = (uint8_t)((pdu + 1) & 0xFF);
+            h->buf[6] = r[6];
+            h->len = (uint16_t)(7 + pdu);
+        }
+        memmove(c->rx, c->rx + frame, c->len - frame);
+        c->len -= frame;
+    }
+}
+
+static int run_tcp(uint16_t port, int holdUs, int jitterUs, int drop, int seconds) {
+    int ls = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(ls, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (ls < 0 || bind(ls, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(ls, 4) != 0) {
+        perror("modbus_slave tcp");
+        return 1;
+    }
+    printf("tcp 127.0.0.1:%u, replies held %d us + up to %d us, %d/1000 dropped\n", port, holdUs, jitterUs,
+           drop);
+    fflush(stdout);
+
+    Client_t clients[MB_SLAVE_CLIENTS];
+    int clientCount = 0;
+    uint32_t served = 0, dropped = 0;
+    uint64_t endUs = seconds > 0 ? now_us() + (uint64_t)seconds * 1000000ull : 0;
+    while (!endUs || now_us() < endUs) {
+        struct pollfd pf[1 + MB_SLAVE_CLIENTS];
+        pf[0] = {ls, POLLIN, 0};
+        for (int i = 0; i < clientCount; i++) pf[1 + i] = {clients[i].fd, POLLIN, 0};
+
+        // Wake for the first held reply to come due
+        int timeoutMs = 100;
+        uint64_t now = now_us();
+        for (int h = 0; h < heldCount; h++) {
+            int ms = held[h].dueUs > now ? (int)((held[h].dueUs - now) / 1000) : 0;
+            if (ms < timeoutMs) timeoutMs = ms;
+        }
+        poll(pf, 1 + clientCount, timeoutMs);
+
+        int polled = clientCount;
+        for (int i = polled - 1; i >= 0; i--) {
+            if (!(pf[1 + i].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+            Client_t* c = &clients[i];
+            ssize_t n = read(c->fd, c->rx + c->len, sizeof(c->rx) - c->len);
+            if (n <= 0) {
+                drop_client(clients, &clientCount, i);
+                continue;
+            }
+            c->len += (uint16_t)n;
+            take_requests(c, holdUs, jitterUs, drop, &dropped);
+        }
+        if ((pf[0].revents & POLLIN) && clientCount < MB_SLAVE_CLIENTS) {
+            int fd = accept(ls, NULL, NULL);
+            if (fd >= 0) {
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                fcntl(fd, F_SETFL, O_NONBLOCK);
+                clients[clientCount].fd = fd;
+                clients[clientCount].len = 0;
+                clientCount++;
+            }
+        }
+
+        // A hold under a millisecond is spun out rather than slept
+        now = now_us();
+        for (int h = 0; h < heldCount; h++) {
+            if (held[h].dueUs > now) continue;
+            if (write(held[h].fd, held[h].buf, held[h].len) > 0) served++;
+            held[h--] = held[--heldCount];
+        }
+    }
+    printf("tcp: %lu replies, %lu dropped\n", (unsigned long)served, (unsigned long)dropped);
+    for (int i = 0; i < clientCount; i++) close(clients[i].fd);
+    close(ls);
+    return 0;
+}
+
+// ============ RTU ============
+static uint16_t crc16(const uint8_t* p, int len) {
+    uint16_t crc = 0xFFFF;
+    while (len--) {
+        crc ^= *p++;
+        for (int b = 0; b < 8; b++) crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+    }
+    return crc;
+}
+
+static int run_rtu(uint32_t baud, int turnaroundUs, int corrupt, int truncate, int seconds) {
+    // The master's t3.5: fixed above 19200 baud, 3.5 characters of 11 bits below
+    uint32_t t35Us = baud > 19200 ? 1750 : 38500000u / baud;
+    int master, slave;
+    char name[64];
+    struct termios tio = {};
+    cfmakeraw(&tio);
+    if (openpty(&master, &slave, name, &tio, NULL) != 0) {
+        perror("modbus_slave rtu");
+        return 1;
+    }
+    printf("%s\n", name);
+    fflush(stdout);
+
+    uint8_t rx[512];
+    int len = 0;
+    uint64_t lastReplyUs = 0;
+    uint32_t frames = 0, badRequests = 0, shortGaps = 0;
+    long minGapUs = -1;
+    uint64_t endUs = seconds > 0 ? now_us() + (uint64_t)seconds * 1000000ull : 0;
+    while (!endUs || now_us() < endUs) {
+        struct pollfd pf = {master, POLLIN, 0};
+        if (poll(&pf, 1, MB_SLAVE_IDLE_MS) <= 0) {
+            if (frames) break;
+            continue;
+        }
+        ssize_t n = read(master, rx + len, sizeof(rx) - len);
+        if (n <= 0) continue;
+        if (len == 0 && lastReplyUs) {
+            long gap = (long)(now_us() - lastReplyUs);
+            if (minGapUs < 0 || gap < minGapUs) minGapUs = gap;
+            if (gap < (long)t35Us) shortGaps++;
+        }
+        len += (int)n;
+        if (len < 8) continue;      // Read requests are 8 bytes
+        len = 0;
+        if (crc16(rx, 6) != (uint16_t)(rx[6] | rx[7] << 8)) {
+            badRequests++;
+            continue;
+        }
+
+        uint8_t out[1 + 2 + 250 + 2];
+        out[0] = rx[0];
+        uint16_t start = (uint16_t)(rx[2] << 8 | rx[3]);
+        uint16_t count = (uint16_t)(rx[4] << 8 | rx[5]);
+        int outLen = 1 + build_pdu(rx[0], rx[1], start, count, out + 1);
+        uint16_t crc = crc16(out, outLen);
+        out[outLen++] = crc & 0xFF;
+        out[outLen++] = crc >> 8;
+        if (per_mille(corrupt)) out[3] ^= 0x40;
+        if (per_mille(truncate)) outLen -= 3;
+
+        uint64_t t = now_us();
+        while (now_us() - t < (uint64_t)turnaroundUs) {
+        }
+        if (write(master, out, outLen) < 0) break;
+        lastReplyUs = now_us();
+        frames++;
+    }
+    printf("rtu %lu baud: %lu frames, %lu bad requests, min gap %ld us (t3.5 %lu us), %lu gaps under t3.5\n",
+           (unsigned long)baud, (unsigned long)frames, (unsigned long)badRequests, minGapUs,
+           (unsigned long)t35Us, (unsigned long)shortGaps);
+    close(slave);
+    close(master);
+    return shortGaps ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    int holdUs = 2000, jitterUs = 0, drop = 0, turnaroundUs = 0, corrupt = 0, truncate = 0, seconds = 0;
+    int a = 1;
+    for (; a + 1 < argc && argv[a][0] == '-'; a += 2) {
+        int v = atoi(argv[a + 1]);
+        char opt = argv[a][1];
+        if (opt == 'd') holdUs = v;
+        else if (opt == 'j') jitterUs = v;
+        else if (opt == 'x') drop = v;
+        else if (opt == 't') turnaroundUs = v;
+        else if (opt == 'c') corrupt = v;
+        else if (opt == 'k') truncate = v;
+        else if (opt == 's') seconds = v;
+    }
+    if (argc - a < 2) {
+        fprintf(stderr, "usage: %s [-d hold us] [-j jitter us] [-x drop/1000] [-s seconds] tcp <port>\n"
+                        "       %s [-t turnaround us] [-c corrupt/1000] [-k truncate/1000] [-s seconds]"
+                        " rtu <baud>\n", argv[0], argv[0]);
+        return 2;
+    }
+    if (strcmp(argv[a], "rtu") == 0) {
+        return run_rtu((uint32_t)atol(argv[a + 1]), turnaroundUs, corrupt, truncate, seconds);
+    }
+    return run_tcp((uint16_t)atoi(argv[a + 1]), holdUs, jitterUs, drop, seconds);
+}
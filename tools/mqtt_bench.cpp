@@ -0,0 +1,141 @@
+// SIGNALTAP MQTT Bench (host)
+// Runs the simulation headless and publishes it through the telemetry
+// publisher in src/net to a broker (mosquitto on localhost will do), one
+// telemetry tick per simulated second, as fast as the host allows. Reports
+// messages per second, CPU per message (telemetry + client only, the
+// simulation is not counted), bytes per message and how many topic checks
+// were suppressed as unchanged. -r skips the simulation and publishes a
+// fixed payload instead, to measure the client alone; -b 1 publishes
+// sensors and vision as binary frames (telemetry_codec) instead of JSON.
+//
+// Build: make -C tools mqtt_bench (tools/Makefile, against tools/host/Arduino.h)
+// Run it from a scratch directory: the simulation's store writes there.
+//
+// Usage:
+//   mqtt_bench [options] <host> [port]
+// Options: -s seconds (5), -d demo (0..3, default all in turn),
+//          -r payload bytes (raw publish mode), -b 1 (binary frames)
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <poll.h>
+#include "../config.h"
+#include "../src/net/mqtt_client.h"
+#include "../src/net/telemetry.h"
+#include "../src/data/simulation_engine.h"
+
+#define BENCH_DEMO_TICKS 600    // Simulated seconds per demo when cycling
+
+static MqttClient_t mqtt;
+static Telemetry_t telem;
+
+static double cpu_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// Session up, or give up after a few seconds
+static bool wait_connected(void) {
+    uint32_t t0 = millis();
+    while ((uint32_t)(millis() - t0) < 3000) {
+        mqtt_poll(&mqtt, millis());
+        if (mqtt_connected(&mqtt)) return true;
+        struct pollfd p = {mqtt.fd, POLLIN, 0};
+        poll(&p, mqtt.open ? 1 : 0, 10);
+    }
+    return false;
+}
+
+// Let the socket take what is queued before the next publish
+static void wait_writable(void) {
+    struct pollfd p = {mqtt.fd, POLLOUT, 0};
+    poll(&p, 1, 10);
+    mqtt_poll(&mqtt, millis());
+}
+
+int main(int argc, char** argv) {
+    int seconds = 5, demo = -1, raw = 0, binary = 0;
+    int a = 1;
+    for (; a + 1 < argc && argv[a][0] == '-'; a += 2) {
+        int v = atoi(argv[a + 1]);
+        if (argv[a][1] == 's') seconds = v;
+        else if (argv[a][1] == 'd') demo = v;
+        else if (argv[a][1] == 'r') raw = v;
+        else if (argv[a][1] == 'b') binary = v;
+    }
+    if (a >= argc) {
+        fprintf(stderr, "usage: %s [-s seconds] [-d demo] [-r payload bytes] [-b 1] <host> [port]\n", argv[0]);
+        return 2;
+    }
+    uint16_t port = a + 1 < argc ? (uint16_t)atoi(argv[a + 1]) : 1883;
+
+    mqtt_init(&mqtt, argv[a], port, "mqtt-bench", NULL, NULL);
+    telem_init(&telem, &mqtt, MQTT_TOPIC_ROOT, DEVICE_ID);
+    telem_set_binary(&telem, binary != 0);
+    if (!wait_connected()) {
+        fprintf(stderr, "%s:%u: no session (refusal %u)\n", argv[a], port, mqtt.stats.lastRefusal);
+        return 1;
+    }
+
+    // Raw payloads go to their own topic, away from the dashboard's
+    char rawTopic[MQTT_TOPIC_LEN];
+    snprintf(rawTopic, sizeof(rawTopic), "%s/%s/bench", MQTT_TOPIC_ROOT, DEVICE_ID);
+    if (raw > TELEM_PAYLOAD_MAX) raw = TELEM_PAYLOAD_MAX;
+    if (raw) memset(telem.payload, 'x', raw);
+    sim_init();
+    if (demo >= 0) sim_set_demo((uint8_t)demo);
+
+    uint32_t runUs = (uint32_t)seconds * 1000000UL;
+    uint32_t simS = 0, msgs = 0;
+    double cpu = 0.0;
+    uint32_t t0 = micros();
+    while ((uint32_t)(micros() - t0) < runUs && mqtt_connected(&mqtt)) {
+        if (raw) {
+            double c0 = cpu_us();
+            if (mqtt_publish(&mqtt, rawTopic, telem.payload, (uint16_t)raw, false)) {
+                msgs++;
+            }
+            mqtt_poll(&mqtt, millis());
+            cpu += cpu_us() - c0;
+            if (mqtt_queued(&mqtt) > MQTT_QUEUE_BYTES / 2) wait_writable();
+            continue;
+        }
+
+        if (demo < 0 && simS % BENCH_DEMO_TICKS == 0) {
+            sim_set_demo((uint8_t)(simS / BENCH_DEMO_TICKS % DEMO_COUNT));
+        }
+        sim_step(1000, 1);
+        simS++;
+
+        double c0 = cpu_us();
+        msgs += telem_tick(&telem, true, simS * 1000UL);
+        mqtt_poll(&mqtt, millis());
+        cpu += cpu_us() - c0;
+        if (mqtt_queued(&mqtt) > MQTT_QUEUE_BYTES / 2) wait_writable();
+    }
+    while (mqtt_queued(&mqtt) && mqtt_connected(&mqtt)) wait_writable();
+    double wall = (uint32_t)(micros() - t0) / 1e6;
+
+    const MqttStats_t* ms = mqtt_get_stats(&mqtt);
+    const TelemStats_t* ts = telem_get_stats(&telem);
+    uint32_t bytes = raw ? msgs * (uint32_t)raw : ts->bytes;
+    printf("%s:%u: %s, %.1f s\n", argv[a], port,
+           raw ? "raw publish" : binary ? "telemetry, binary frames" : "telemetry", wall);
+    if (!raw) {
+        printf("  %lu simulated s, %lu topic checks, %.1f%% unchanged, %lu refused\n",
+               (unsigned long)simS, (unsigned long)(ts->published + ts->unchanged + ts->failed),
+               100.0 * ts->unchanged / (ts->published + ts->unchanged + ts->failed + 1e-9),
+               (unsigned long)ts->failed);
+    }
+    printf("  %lu msgs, %.0f msgs/s, %.2f us CPU/msg, %.0f payload B/msg, %.1f msgs/write\n",
+           (unsigned long)msgs, msgs / wall, msgs ? cpu / msgs : 0.0,
+           msgs ? (double)bytes / msgs : 0.0,
+           ms->writes ? (double)ms->published / ms->writes : 0.0);
+    printf("  %lu bytes out, queue high %lu B, %lu refused by client, %s\n",
+           (unsigned long)ms->bytesOut, (unsigned long)ms->queueHigh, (unsigned long)ms->dropped,
+           mqtt_connected(&mqtt) ? "session up" : "session lost");
+    mqtt_disconnect(&mqtt);
+    return 0;
+}
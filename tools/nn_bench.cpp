@@ -0,0 +1,103 @@
+// SIGNALTAP Int8 Runtime Check (host)
+// The int8 runtime (src/ai/nn_int8) against the Python reference forward
+// in tools/nn_export.py (run_blob_q), output for output.
+//  - Conv model: conv1d 3x3 with padding 1 (ReLU), conv1d 5x8 stride 2
+//    with padding 2 (ReLU), dense 32 -> 48; every edge tap of both convs
+//    reads the padding, the interior ones the contiguous path
+//  - Default model: the built-in autoencoder (src/ai/default_autoencoder.h),
+//    first checked to be the blob the reference vectors were made from
+//  - Windows: quantized sensor-like windows, full-range random ones and
+//    the two saturated ones, from tools/golden/nn_check.h
+//    (python3 tools/nn_export.py --check); exit 1 on any differing value
+//  - Timing: ns per window and windows per second for each model
+//
+// Build: make -C tools nn_bench (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage: nn_bench [-r timing repeats per window (2000)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/ai/nn_int8.h"
+#include "../src/ai/default_autoencoder.h"
+#include "golden/nn_check.h"
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t failures = 0;
+
+static void fail(const char* what) {
+    if (failures < 10) printf("  FAILED: %s\n", what);
+    failures++;
+}
+
+static uint32_t crc32(const uint8_t* p, uint32_t len) {
+    uint32_t crc = ~0u;
+    while (len--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+// ============ Check ============
+static void check_model(const char* name, const uint8_t* blob, size_t len,
+                        const int8_t want[NN_CHECK_WINDOWS][NN_CHECK_VALUES], uint32_t repeats) {
+    NnModel_t model;
+    if (!nn_load(&model, blob, len)) {
+        fail("model does not load");
+        return;
+    }
+    if (model.outSize != NN_CHECK_VALUES) fail("output size");
+
+    uint32_t windows = 0, values = 0;
+    int8_t out[NN_CHECK_VALUES];
+    for (int w = 0; w < NN_CHECK_WINDOWS; w++) {
+        nn_run(&model, nnCheckInput[w], out);
+        uint32_t differ = 0;
+        for (int i = 0; i < NN_CHECK_VALUES; i++) {
+            if (out[i] != want[w][i]) differ++;
+        }
+        if (differ) {
+            if (windows == 0) {
+                char what[96];
+                snprintf(what, sizeof(what), "%s window %d: %lu values differ from run_blob_q", name, w,
+                         (unsigned long)differ);
+                fail(what);
+            }
+            windows++;
+            values += differ;
+        }
+    }
+
+    double t = now_ns();
+    for (uint32_t r = 0; r < repeats; r++) {
+        for (int w = 0; w < NN_CHECK_WINDOWS; w++) nn_run(&model, nnCheckInput[w], out);
+    }
+    double ns = (now_ns() - t) / ((double)repeats * NN_CHECK_WINDOWS);
+    printf("%-8s %u layers: %d windows, %lu differ (%lu values), %7.0f ns/window, %8.0f windows/s\n",
+           name, model.layerCount, NN_CHECK_WINDOWS, (unsigned long)windows, (unsigned long)values,
+           ns, 1e9 / ns);
+}
+
+int main(int argc, char** argv) {
+    uint32_t repeats = 2000;
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-r") == 0) repeats = (uint32_t)atol(argv[a + 1]);
+    }
+
+    check_model("conv", nnCheckBlob, sizeof(nnCheckBlob), nnCheckConvOut, repeats);
+    if (crc32(defaultAutoencoderBlob, sizeof(defaultAutoencoderBlob)) != NN_CHECK_DEFAULT_CRC) {
+        fail("default model changed since the check vectors; rerun nn_export.py --check");
+    } else {
+        check_model("default", defaultAutoencoderBlob, sizeof(defaultAutoencoderBlob), nnCheckDefaultOut,
+                    repeats);
+    }
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,390 @@
+#!/usr/bin/env python3
+"""SIGNALTAP int8 model exporter.
+
+Packs float dense / conv1d layers into the STNN blob consumed by
+src/ai/nn_int8.cpp and writes it as a C header that lives in flash.
+Quantization is symmetric per output channel for weights and asymmetric
+per tensor for activations, with TFLite-style Q31 multipliers.
+
+Without arguments it rebuilds src/ai/default_autoencoder.h: a linear
+(PCA) autoencoder fitted to normal-operation windows of the four demo
+profiles. Pure Python, no numpy required.
+
+--check writes the reference vectors tools/nn_bench.cpp holds the C
+runtime to: a conv1d/dense test model (padding on both ends, a strided
+layer), int8 input windows, and run_blob_q()'s outputs for it and for the
+default model.
+
+Usage:
+    python3 tools/nn_export.py [output.h]
+    python3 tools/nn_export.py --check [tools/golden/nn_check.h]
+"""
+import math
+import random
+import struct
+import sys
+import zlib
+
+NN_MAGIC = 0x4E4E5453
+NN_VERSION = 1
+DENSE, CONV1D, RELU = 0, 1, 2
+FUSED_RELU = 0x01
+
+WINDOW = 16
+CHANNELS = 3
+
+
+# ============ Quantization ============
+def quantize_multiplier(real):
+    """TFLite QuantizeMultiplier: real = mult * 2^(shift - 31)."""
+    if real == 0.0:
+        return 0, 0
+    q, shift = math.frexp(real)
+    q_fixed = int(round(q * (1 << 31)))
+    if q_fixed == (1 << 31):
+        q_fixed //= 2
+        shift += 1
+    return q_fixed, shift
+
+
+def act_params(lo, hi):
+    """Asymmetric int8 (scale, zero) covering [lo, hi] (always includes 0)."""
+    lo, hi = min(lo, 0.0), max(hi, 0.0)
+    scale = (hi - lo) / 255.0 or 1.0
+    zero = int(round(-128 - lo / scale))
+    return scale, max(-128, min(127, zero))
+
+
+class Layer:
+    def __init__(self, kind, weights, bias, out_range, relu=False,
+                 kernel=1, stride=1, padding=0):
+        # weights: [oc][k*ic] flattened per output channel in [k][ic] order
+        self.kind, self.weights, self.bias = kind, weights, bias
+        self.out_range, self.relu = out_range, relu
+        self.kernel, self.stride, self.padding = kernel, stride, padding
+
+
+def pack_layer(layer, in_ch, in_scale, in_zero):
+    out_scale, out_zero = act_params(*layer.out_range)
+    oc = len(layer.weights)
+    qweights, bias, mults, shifts = [], [], [], []
+    for c in range(oc):
+        row = layer.weights[c]
+        w_scale = (max(abs(v) for v in row) / 127.0) or 1.0
+        qrow = [max(-127, min(127, int(round(v / w_scale)))) for v in row]
+        qweights.extend(qrow)
+        # Fold the input zero point so the kernel is a pure dot product
+        b = int(round(layer.bias[c] / (in_scale * w_scale))) - in_zero * sum(qrow)
+        m, s = quantize_multiplier(in_scale * w_scale / out_scale)
+        bias.append(b)
+        mults.append(m)
+        shifts.append(s)
+
+    wbytes = struct.pack("<%db" % len(qweights), *qweights)
+    wbytes += b"\0" * (-len(wbytes) % 4)
+    payload = wbytes + struct.pack("<%di" % oc, *bias)
+    payload += struct.pack("<%di" % oc, *mults) + struct.pack("<%di" % oc, *shifts)
+
+    in_channels = len(layer.weights[0]) if layer.kind == DENSE else in_ch
+    header = struct.pack("<BBHHHHHfiI", layer.kind, FUSED_RELU if layer.relu else 0,
+                         oc, in_channels, layer.kernel, layer.stride, layer.padding,
+                         out_scale, out_zero, len(payload))
+    return header + payload, out_scale, out_zero
+
+
+def pack_model(layers, in_len, in_ch, in_range, err_threshold):
+    in_scale, in_zero = act_params(*in_range)
+    body, scale, zero, ch = b"", in_scale, in_zero, in_ch
+    for layer in layers:
+        blob, scale, zero = pack_layer(layer, ch, scale, zero)
+        body += blob
+        ch = len(layer.weights)
+    total = 28 + len(body)
+    header = struct.pack("<IHHHHfifI", NN_MAGIC, NN_VERSION, len(layers),
+                         in_len, in_ch, in_scale, in_zero, err_threshold, total)
+    return header + body
+
+
+# ============ Reference Int8 Forward (matches nn_int8.cpp bit for bit) ============
+def srdhm(a, b):
+    if a == b == -(1 << 31):
+        return (1 << 31) - 1
+    ab = a * b
+    nudge = (1 << 30) if ab >= 0 else 1 - (1 << 30)
+    # C integer division truncates toward zero
+    q = abs(ab + nudge) >> 31
+    return q if ab + nudge >= 0 else -q
+
+
+def rdbpot(x, e):
+    mask = (1 << e) - 1
+    rem = x & mask
+    thr = (mask >> 1) + (1 if x < 0 else 0)
+    return (x >> e) + (1 if rem > thr else 0)
+
+
+def requant(acc, m, s):
+    left, right = max(s, 0), max(-s, 0)
+    return rdbpot(srdhm(acc * (1 << left), m), right)
+
+
+def run_blob_q(blob, q):
+    """Int8 input window -> int8 output, layer by layer as nn_run()."""
+    nl, in_len, in_ch = struct.unpack_from("<HHH", blob, 6)
+    in_zero = struct.unpack_from("<i", blob, 16)[0]
+    length, ch, zero = in_len, in_ch, in_zero
+    off = 28
+    for _ in range(nl):
+        kind, flags, oc, ic, k, stride, pad, o_scale, o_zero, pb = struct.unpack_from("<BBHHHHHfiI", blob, off)
+        off += 24
+        if kind == RELU:
+            q = [max(v, zero) for v in q]
+            off += pb
+            continue
+        nw = oc * (ic if kind == DENSE else k * ic)
+        w = struct.unpack_from("<%db" % nw, blob, off)
+        base = off + nw + (-nw % 4)
+        bias = struct.unpack_from("<%di" % oc, blob, base)
+        mult = struct.unpack_from("<%di" % oc, blob, base + 4 * oc)
+        shift = struct.unpack_from("<%di" % oc, blob, base + 8 * oc)
+        lo = o_zero if flags & FUSED_RELU else -128
+
+        def out_value(c, acc):
+            v = o_zero + requant(acc, mult[c], shift[c])
+            return max(-128, min(127, max(v, lo)))
+
+        if kind == DENSE:
+            q = [out_value(c, bias[c] + sum(q[i] * w[c * ic + i] for i in range(ic))) for c in range(oc)]
+            length = 1
+        else:
+            # [len][ch] rows; taps off either end read the input zero point
+            out_len = (length + 2 * pad - k) // stride + 1
+            out = []
+            for t in range(out_len):
+                start = t * stride - pad
+                taps = [q[(start + j) * ic:(start + j + 1) * ic] if 0 <= start + j < length else [zero] * ic
+                        for j in range(k)]
+                field = [v for tap in taps for v in tap]
+                for c in range(oc):
+                    out.append(out_value(c, bias[c] + sum(a * b for a, b in zip(field, w[c * k * ic:(c + 1) * k * ic]))))
+            q, length = out, out_len
+        ch, zero = oc, o_zero
+        off += pb
+    return q
+
+
+def run_blob(blob, x):
+    in_scale, in_zero = struct.unpack_from("<fi", blob, 12)
+    q = [max(-128, min(127, int(round(v / in_scale)) + in_zero)) for v in x]
+    q = run_blob_q(blob, q)
+    off = 28
+    for _ in range(struct.unpack_from("<H", blob, 6)[0]):
+        o_scale, o_zero, pb = struct.unpack_from("<fiI", blob, off + 12)
+        off += 24 + pb
+    return [o_scale * (v - o_zero) for v in q]
+
+
+# ============ Default Model: PCA autoencoder over normal operation ============
+# (normal target, noise amplitude, min, max) per sensor, from simulation_engine.cpp
+NORMAL_PROFILES = [
+    [(55.0, 3.0, 0, 100), (13.0, 0.5, 0, 20), (4500.0, 100.0, 0, 8000)],
+    [(26.0, 1.0, 0, 50), (2.0, 0.3, -10, 20), (7.5, 0.3, -5, 25)],
+    [(8.0, 0.3, 0, 12), (75.0, 2.0, 20, 120), (32.0, 1.5, 0, 60)],
+    [(85.0, 1.5, 20, 200), (500.0, 15.0, 0, 1013), (5.0, 0.2, 0, 10)],
+]
+
+
+def normal_windows(count, rng):
+    windows = []
+    for _ in range(count):
+        prof = rng.choice(NORMAL_PROFILES)
+        vals = [p[0] for p in prof]
+        for _ in range(rng.randint(10, 40)):  # settle
+            vals = [v + (p[0] + rng.uniform(-1, 1) * p[1] - v) * 0.15 for v, p in zip(vals, prof)]
+        win = []
+        for _ in range(WINDOW):
+            vals = [v + (p[0] + rng.uniform(-1, 1) * p[1] - v) * 0.15 for v, p in zip(vals, prof)]
+            win.extend((v - p[2]) / (p[3] - p[2]) for v, p in zip(vals, prof))
+        windows.append(win)
+    return windows
+
+
+def top_components(data, k, rng):
+    n = len(data[0])
+    mean = [sum(r[i] for r in data) / len(data) for i in range(n)]
+    cov = [[0.0] * n for _ in range(n)]
+    for r in data:
+        d = [r[i] - mean[i] for i in range(n)]
+        for i in range(n):
+            di = d[i]
+            row = cov[i]
+            for j in range(n):
+                row[j] += di * d[j]
+    comps = []
+    for _ in range(k):
+        v = [rng.uniform(-1, 1) for _ in range(n)]
+        for _ in range(200):
+            w = [sum(cov[i][j] * v[j] for j in range(n)) for i in range(n)]
+            for c in comps:
+                dot = sum(a * b for a, b in zip(w, c))
+                w = [a - dot * b for a, b in zip(w, c)]
+            norm = math.sqrt(sum(a * a for a in w)) or 1.0
+            v = [a / norm for a in w]
+        comps.append(v)
+    return mean, comps
+
+
+def build_default():
+    rng = random.Random(1234)
+    data = normal_windows(600, rng)
+    mean, comps = top_components(data, 6, rng)
+    n = len(mean)
+
+    # Encoder emits +/- projections so ReLU keeps the linear code intact
+    enc_w, enc_b = [], []
+    for sign in (1.0, -1.0):
+        for c in comps:
+            enc_w.append([sign * a for a in c])
+            enc_b.append(-sign * sum(a * m for a, m in zip(c, mean)))
+    proj = [abs(sum(w * x for w, x in zip(row, r)) + b) for r in data for row, b in zip(enc_w, enc_b)]
+    hid_hi = 2.0 * max(proj)
+
+    dec_w = [[comps[k][j] for k in range(len(comps))] + [-comps[k][j] for k in range(len(comps))]
+             for j in range(n)]
+    layers = [
+        Layer(DENSE, enc_w, enc_b, (0.0, hid_hi), relu=True),
+        Layer(DENSE, dec_w, mean, (0.0, 1.0)),
+    ]
+
+    blob = pack_model(layers, WINDOW, CHANNELS, (0.0, 1.0), 0.0)
+    errs = []
+    for r in data[:200]:
+        out = run_blob(blob, r)
+        per = [0.0] * CHANNELS
+        for i, (a, b) in enumerate(zip(out, r)):
+            per[i % CHANNELS] += (a - b) ** 2 / WINDOW
+        errs.extend(per)
+    errs.sort()
+    threshold = 4.0 * errs[int(0.99 * (len(errs) - 1))]
+    return pack_model(layers, WINDOW, CHANNELS, (0.0, 1.0), threshold), threshold
+
+
+# ============ Check Vectors: conv1d/dense model vs run_blob_q ============
+def forward_float(layers, x, length, ch):
+    for layer in layers:
+        oc = len(layer.weights)
+        if layer.kind == DENSE:
+            x = [b + sum(a * v for a, v in zip(row, x)) for row, b in zip(layer.weights, layer.bias)]
+            length = 1
+        else:
+            k, stride, pad = layer.kernel, layer.stride, layer.padding
+            out_len = (length + 2 * pad - k) // stride + 1
+            out = []
+            for t in range(out_len):
+                start = t * stride - pad
+                field = []
+                for j in range(k):
+                    pos = start + j
+                    field += x[pos * ch:(pos + 1) * ch] if 0 <= pos < length else [0.0] * ch
+                out += [b + sum(a * v for a, v in zip(row, field)) for row, b in zip(layer.weights, layer.bias)]
+            x, length = out, out_len
+        if layer.relu:
+            x = [max(v, 0.0) for v in x]
+        ch = oc
+    return x
+
+
+def build_check():
+    rng = random.Random(27)
+
+    def layer(kind, oc, fan_in, relu, **kw):
+        w = [[rng.uniform(-1, 1) / math.sqrt(fan_in) for _ in range(fan_in)] for _ in range(oc)]
+        return Layer(kind, w, [rng.uniform(-0.1, 0.1) for _ in range(oc)], None, relu=relu, **kw)
+
+    layers = [
+        layer(CONV1D, 8, 3 * CHANNELS, True, kernel=3, stride=1, padding=1),    # 16x3 -> 16x8
+        layer(CONV1D, 4, 5 * 8, True, kernel=5, stride=2, padding=2),           # -> 8x4
+        layer(DENSE, WINDOW * CHANNELS, 8 * 4, False),                          # -> 48
+    ]
+    windows = [[rng.random() for _ in range(WINDOW * CHANNELS)] for _ in range(200)]
+    for i in range(len(layers)):
+        outs = [v for x in windows for v in forward_float(layers[:i + 1], x, WINDOW, CHANNELS)]
+        layers[i].out_range = (min(outs), max(outs))
+    return pack_model(layers, WINDOW, CHANNELS, (0.0, 1.0), 0.0), windows
+
+
+def check_inputs(blob, windows, rng):
+    in_scale, in_zero = struct.unpack_from("<fi", blob, 12)
+    n = WINDOW * CHANNELS
+    inputs = [[max(-128, min(127, int(round(v / in_scale)) + in_zero)) for v in x] for x in windows[:40]]
+    inputs += [[rng.randint(-128, 127) for _ in range(n)] for _ in range(6)]
+    return inputs + [[-128] * n, [127] * n]
+
+
+def c_bytes(values):
+    return ["    " + ", ".join("0x%02x" % (b & 0xFF) for b in values[i:i + 16]) + ","
+            for i in range(0, len(values), 16)]
+
+
+def c_rows(rows):
+    return ["    {" + ", ".join("%d" % v for v in row) + "}," for row in rows]
+
+
+def write_check(path):
+    blob, windows = build_check()
+    default, _ = build_default()
+    inputs = check_inputs(blob, windows, random.Random(28))
+    conv_out = [run_blob_q(blob, q) for q in inputs]
+    default_out = [run_blob_q(default, q) for q in inputs]
+    n = WINDOW * CHANNELS
+    lines = ["// SIGNALTAP int8 runtime check vectors (generated by tools/nn_export.py --check - do not edit)",
+             "// Conv1d 3x3 pad 1 (ReLU) -> conv1d 5x8 stride 2 pad 2 (ReLU) -> dense 32 -> 48,",
+             "// and the default model, on %d int8 windows; outputs from run_blob_q()" % len(inputs),
+             "#ifndef NN_CHECK_H",
+             "#define NN_CHECK_H",
+             "",
+             "#include <Arduino.h>",
+             "",
+             "#define NN_CHECK_WINDOWS     %d" % len(inputs),
+             "#define NN_CHECK_VALUES      %d" % n,
+             "#define NN_CHECK_DEFAULT_CRC 0x%08xu   // CRC-32 of the default model these were run on"
+             % (zlib.crc32(default) & 0xFFFFFFFF),
+             "",
+             "alignas(4) static const uint8_t nnCheckBlob[%d] = {" % len(blob)]
+    lines += c_bytes(blob) + ["};", ""]
+    for name, rows in (("nnCheckInput", inputs), ("nnCheckConvOut", conv_out),
+                       ("nnCheckDefaultOut", default_out)):
+        lines.append("static const int8_t %s[NN_CHECK_WINDOWS][NN_CHECK_VALUES] = {" % name)
+        lines += c_rows(rows) + ["};", ""]
+    lines += ["#endif // NN_CHECK_H", ""]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+    print("wrote %s (%d windows, %d byte test model)" % (path, len(inputs), len(blob)))
+
+
+def write_header(path, name, blob, note):
+    lines = ["// SIGNALTAP default anomaly model (generated by tools/nn_export.py - do not edit)",
+             "// " + note,
+             "#ifndef DEFAULT_AUTOENCODER_H",
+             "#define DEFAULT_AUTOENCODER_H",
+             "",
+             "#include <Arduino.h>",
+             "",
+             "alignas(4) static const uint8_t %s[%d] = {" % (name, len(blob))]
+    for i in range(0, len(blob), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in blob[i:i + 16]) + ",")
+    lines += ["};", "", "#endif // DEFAULT_AUTOENCODER_H", ""]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) > 1 and sys.argv[1] == "--check":
+        write_check(sys.argv[2] if len(sys.argv) > 2 else "tools/golden/nn_check.h")
+        sys.exit(0)
+    out = sys.argv[1] if len(sys.argv) > 1 else "src/ai/default_autoencoder.h"
+    blob, thr = build_default()
+    write_header(out, "defaultAutoencoderBlob", blob,
+                 "Dense %dx%d -> 12 (ReLU) -> %d PCA autoencoder, channel MSE threshold %.6f"
+                 % (WINDOW, CHANNELS, WINDOW * CHANNELS, thr))
+    print("wrote %s (%d bytes)" % (out, len(blob)))
@@ -0,0 +1,574 @@
+// SIGNALTAP OTA Bench (host)
+// make: builds a delta patch (src/ota/delta_patch.h) from the firmware
+// image the devices run and the new one, then decodes it back in odd-sized
+// pieces as a check. Greedy encoder: at each position the longest copy
+// that pays for itself, from the old image (first where the last copy
+// left off, then anywhere by an 8-byte hash) or from the last 8 KB of the
+// new image; anything else goes out as literals.
+//
+// run: the whole update on file-backed A/B partition images. The patch is
+// served over loopback HTTP by a thread of its own, optionally at a fixed
+// link rate, and the three OTA stages (src/ota/ota_update) run one thread
+// each, as the device's tasks do (-1: all on one thread, in turn, as a
+// host loop would run them). -f makes each 4 KB flash sector take that
+// long, as erase + program do on the device. Reports end-to-end time,
+// time in each stage and the update's RAM.
+//
+// check: make and run on a synthetic image pair (edits, an insertion, a
+// deletion and a relocated region), on three stage threads and on one;
+// the B partition must then hold the new image byte for byte. A patch
+// for another running image must be refused as such, and a patch with
+// one byte flipped must fail; neither may set the new image to boot.
+//
+// Build: make -C tools ota_bench (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage:
+//   ota_bench make <old.bin> <new.bin> <patch.bin>
+//   ota_bench run <old.bin> <patch.bin> [-r link KB/s (0 = unlimited)]
+//                 [-f ms per sector (0)] [-p partition KB (3072)] [-1] [port (8090)]
+//   ota_bench check [port (8090)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <thread>
+#include <vector>
+#include "../src/ota/ota_update.h"
+
+#define ENC_SRC_HASH_BITS   22
+#define ENC_TGT_HASH_BITS   16
+#define ENC_SRC_CHAIN       32
+#define ENC_TGT_CHAIN       16
+#define ENC_MIN_MATCH       4
+#define ENC_MIN_GAIN        2       // A match also splits the literal run around it
+
+typedef std::vector<uint8_t> Bytes_t;
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static bool load(const char* path, Bytes_t* out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    out->resize(ftell(f));
+    rewind(f);
+    bool ok = fread(out->data(), 1, out->size(), f) == out->size();
+    fclose(f);
+    return ok;
+}
+
+static bool save(const char* path, const uint8_t* data, size_t len) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(data, 1, len, f) == len;
+    fclose(f);
+    return ok;
+}
+
+// ============ Encoder ============
+typedef struct {
+    const Bytes_t* src;
+    const Bytes_t* dst;
+    Bytes_t out;
+    uint32_t srcPos;            // Decoder's: end of the last SRC copy
+    uint32_t srcDstEnd;         // Where in the image that copy ended
+    std::vector<int32_t> srcHead, srcPrev;
+    std::vector<int32_t> tgtHead, tgtPrev;
+    uint32_t ops[3];            // LIT, SRC, TGT
+    uint64_t bytes[3];
+} Enc_t;
+
+static uint32_t vlen(uint32_t v) {
+    uint32_t n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        n++;
+    }
+    return n;
+}
+
+static void put_varint(Bytes_t* out, uint32_t v) {
+    while (v >= 0x80) {
+        out->push_back((uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    out->push_back((uint8_t)v);
+}
+
+static void put_op(Enc_t* e, uint8_t kind, uint32_t len) {
+    e->out.push_back((uint8_t)(kind | (len <= DP_SHORT_MAX ? len : 0)));
+    if (len > DP_SHORT_MAX) put_varint(&e->out, len);
+    e->ops[kind >> 6]++;
+    e->bytes[kind >> 6] += len;
+}
+
+static uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static uint32_t hash8(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return (uint32_t)((v * 0x9E3779B97F4A7C15ull) >> (64 - ENC_SRC_HASH_BITS));
+}
+
+static uint32_t hash4(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return (v * 2654435761u) >> (32 - ENC_TGT_HASH_BITS);
+}
+
+static uint32_t match_len(const uint8_t* a, const uint8_t* b, uint32_t max) {
+    uint32_t n = 0;
+    while (n < max && a[n] == b[n]) n++;
+    return n;
+}
+
+static void flush_literals(Enc_t* e, uint32_t from, uint32_t to) {
+    if (to == from) return;
+    put_op(e, DP_OP_LIT, to - from);
+    e->out.insert(e->out.end(), e->dst->begin() + from, e->dst->begin() + to);
+}
+
+static void tgt_insert(Enc_t* e, uint32_t i) {
+    if (i + 4 > e->dst->size()) return;
+    uint32_t h = hash4(e->dst->data() + i);
+    e->tgtPrev[i] = e->tgtHead[h];
+    e->tgtHead[h] = (int32_t)i;
+}
+
+static Bytes_t encode(const Bytes_t& src, const Bytes_t& dst, Enc_t* e) {
+    e->src = &src;
+    e->dst = &dst;
+    e->srcPos = e->srcDstEnd = 0;
+    memset(e->ops, 0, sizeof(e->ops));
+    memset(e->bytes, 0, sizeof(e->bytes));
+    e->srcHead.assign(1u << ENC_SRC_HASH_BITS, -1);
+    e->srcPrev.assign(src.size(), -1);
+    e->tgtHead.assign(1u << ENC_TGT_HASH_BITS, -1);
+    e->tgtPrev.assign(dst.size(), -1);
+    for (uint32_t i = 0; i + 8 <= src.size(); i++) {
+        uint32_t h = hash8(src.data() + i);
+        e->srcPrev[i] = e->srcHead[h];
+        e->srcHead[h] = (int32_t)i;
+    }
+
+    DpHeader_t h;
+    h.magic = DP_MAGIC;
+    h.version = DP_VERSION;
+    h.windowBits = DP_WINDOW_BITS;
+    h.srcSize = (uint32_t)src.size();
+    h.dstSize = (uint32_t)dst.size();
+    Sha256_t sha;
+    sha256_init(&sha);
+    sha256_update(&sha, src.data(), (uint32_t)src.size());
+    sha256_final(&sha, h.srcSha);
+    sha256_init(&sha);
+    sha256_update(&sha, dst.data(), (uint32_t)dst.size());
+    sha256_final(&sha, h.dstSha);
+    e->out.resize(DP_HEADER_BYTES);
+    dp_write_header(&h, e->out.data());
+
+    const uint8_t* d = dst.data();
+    uint32_t n = (uint32_t)dst.size(), lit = 0;
+    for (uint32_t i = 0; i < n; ) {
+        uint32_t bestLen = 0, bestArg = 0;
+        int32_t bestGain = 0;
+        uint8_t bestKind = DP_OP_LIT;
+
+        // Source: where the last copy left off, the same distance on
+        // (code that only moved, with a few changed bytes between), then
+        // the hash chain
+        uint32_t cands[2 + ENC_SRC_CHAIN];
+        uint32_t nc = 0;
+        cands[nc++] = e->srcPos;
+        cands[nc++] = e->srcPos + (i - e->srcDstEnd);
+        if (i + 8 <= n) {
+            int32_t c = e->srcHead[hash8(d + i)];
+            for (int k = 0; c >= 0 && k < ENC_SRC_CHAIN; k++, c = e->srcPrev[c]) cands[nc++] = (uint32_t)c;
+        }
+        for (uint32_t k = 0; k < nc; k++) {
+            uint32_t c = cands[k];
+            if (c >= src.size()) continue;
+            uint32_t max = n - i < src.size() - c ? n - i : (uint32_t)src.size() - c;
+            uint32_t len = match_len(d + i, src.data() + c, max);
+            if (len < ENC_MIN_MATCH) continue;
+            int32_t cost = 1 + (len > DP_SHORT_MAX ? vlen(len) : 0) + vlen(zigzag((int32_t)(c - e->srcPos)));
+            if ((int32_t)len - cost > bestGain) {
+                bestGain = (int32_t)len - cost;
+                bestLen = len;
+                bestArg = c;
+                bestKind = DP_OP_SRC;
+            }
+        }
+
+        // The image so far, within the window
+        if (i + 4 <= n) {
+            int32_t c = e->tgtHead[hash4(d + i)];
+            for (int k = 0; c >= 0 && k < ENC_TGT_CHAIN && i - (uint32_t)c <= DP_WINDOW_BYTES; k++, c = e->tgtPrev[c]) {
+                uint32_t len = match_len(d + i, d + c, n - i);
+                if (len < ENC_MIN_MATCH) continue;
+                uint32_t dist = i - (uint32_t)c;
+                int32_t cost = 1 + (len > DP_SHORT_MAX ? vlen(len) : 0) + vlen(dist);
+                if ((int32_t)len - cost > bestGain) {
+                    bestGain = (int32_t)len - cost;
+                    bestLen = len;
+                    bestArg = dist;
+                    bestKind = DP_OP_TGT;
+                }
+            }
+        }
+
+        if (bestGain < ENC_MIN_GAIN) {
+            tgt_insert(e, i++);
+            continue;
+        }
+        flush_literals(e, lit, i);
+        put_op(e, bestKind, bestLen);
+        if (bestKind == DP_OP_SRC) {
+            put_varint(&e->out, zigzag((int32_t)(bestArg - e->srcPos)));
+            e->srcPos = bestArg + bestLen;
+            e->srcDstEnd = i + bestLen;
+        } else {
+            put_varint(&e->out, bestArg);
+        }
+        for (uint32_t k = 0; k < bestLen; k++) tgt_insert(e, i + k);
+        i += bestLen;
+        lit = i;
+    }
+    flush_literals(e, lit, n);
+    e->out.push_back(DP_OP_END);
+    return e->out;
+}
+
+// ============ Decode check ============
+static bool check_read(void* ctx, uint32_t offset, void* buf, uint32_t len) {
+    const Bytes_t* src = (const Bytes_t*)ctx;
+    if (offset + len > src->size()) return false;
+    memcpy(buf, src->data() + offset, len);
+    return true;
+}
+
+// In pieces of odd sizes, as the network and the sector buffers cut it
+static bool decode_check(const Bytes_t& src, const Bytes_t& patch, const Bytes_t& dst, double* us) {
+    static DpDecoder_t dec;
+    dp_init(&dec, check_read, (void*)&src);
+    Bytes_t out(dst.size() + 1);
+    uint32_t ip = 0, op = 0, step = 0;
+    double t0 = now_us();
+    for (;;) {
+        static const uint32_t inSizes[] = {1, 1460, 97, 4096, 13};
+        static const uint32_t outSizes[] = {4096, 3, 1000, 65536, 511};
+        uint32_t inLen = inSizes[step % 5], outCap = outSizes[(step / 5) % 5];
+        step++;
+        if (inLen > patch.size() - ip) inLen = (uint32_t)(patch.size() - ip);
+        if (outCap > out.size() - op) outCap = (uint32_t)(out.size() - op);
+        uint32_t used, made;
+        DpResult_t r = dp_decode(&dec, patch.data() + ip, inLen, &used, out.data() + op, outCap, &made);
+        ip += used;
+        op += made;
+        if (r == DP_ERROR) return false;
+        if (r == DP_DONE) break;
+        if (r == DP_MORE && used == 0 && made == 0 && ip == patch.size()) return false;
+    }
+    *us = now_us() - t0;
+    return op == dst.size() && memcmp(out.data(), dst.data(), op) == 0;
+}
+
+static int make(const char* oldPath, const char* newPath, const char* patchPath) {
+    Bytes_t src, dst;
+    if (!load(oldPath, &src) || !load(newPath, &dst)) {
+        fprintf(stderr, "cannot read %s / %s\n", oldPath, newPath);
+        return 1;
+    }
+    static Enc_t enc;
+    double t0 = now_us();
+    Bytes_t patch = encode(src, dst, &enc);
+    double encUs = now_us() - t0;
+
+    // The same image without a source: what compression alone gives
+    static Enc_t solo;
+    Bytes_t none;
+    Bytes_t full = encode(none, dst, &solo);
+
+    double decUs;
+    if (!decode_check(src, patch, dst, &decUs)) {
+        fprintf(stderr, "patch does not decode back to %s\n", newPath);
+        return 1;
+    }
+    if (!save(patchPath, patch.data(), patch.size())) {
+        fprintf(stderr, "cannot write %s\n", patchPath);
+        return 1;
+    }
+    printf("%s: %zu -> %zu bytes, patch %zu bytes (%.1f%% of the image; %zu compressed alone)\n",
+           patchPath, src.size(), dst.size(), patch.size(), 100.0 * patch.size() / dst.size(), full.size());
+    printf("  ops: %u literal (%llu B), %u source copies (%llu B), %u window copies (%llu B)\n",
+           enc.ops[0], (unsigned long long)enc.bytes[0], enc.ops[1], (unsigned long long)enc.bytes[1],
+           enc.ops[2], (unsigned long long)enc.bytes[2]);
+    printf("  encode %.0f ms, decode check %.1f ms (%.0f MB/s)\n",
+           encUs / 1000, decUs / 1000, dst.size() / decUs);
+    return 0;
+}
+
+// ============ Patch server ============
+typedef struct {
+    int listenFd;
+    const Bytes_t* patch;
+    uint32_t rateKBs;
+} Server_t;
+
+static void serve_patch(Server_t* s) {
+    int fd = accept(s->listenFd, NULL, NULL);
+    if (fd < 0) return;
+    char req[1024];
+    size_t got = 0;
+    while (got < sizeof(req) - 1) {
+        ssize_t n = recv(fd, req + got, sizeof(req) - 1 - got, 0);
+        if (n <= 0) break;
+        got += n;
+        req[got] = '\0';
+        if (strstr(req, "\r\n\r\n")) break;
+    }
+    char head[128];
+    int hn = snprintf(head, sizeof(head), "HTTP/1.1 200 OK\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+                      s->patch->size());
+    send(fd, head, hn, MSG_NOSIGNAL);
+    // The link, not this socket, holds what is in flight: a small send
+    // buffer, so a full receive window stops the pacing too
+    int small = 4096;
+    setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &small, sizeof(small));
+    double due = now_us();
+    for (size_t off = 0; off < s->patch->size(); ) {
+        size_t n = s->patch->size() - off < 1460 ? s->patch->size() - off : 1460;
+        if (s->rateKBs) {
+            double wait = due - now_us();
+            if (wait > 0) usleep((useconds_t)wait);
+        }
+        ssize_t w = send(fd, s->patch->data() + off, n, MSG_NOSIGNAL);
+        if (w <= 0) break;
+        off += w;
+        // Time lost to a full window is not made up in a burst
+        if (s->rateKBs) due = (due > now_us() ? due : now_us()) + w * 1e6 / (s->rateKBs * 1024.0);
+    }
+    close(fd);
+}
+
+// ============ Update run ============
+static OtaUpdate_t ota;
+
+static void run_stage(bool (*stage)(OtaUpdate_t*)) {
+    while (ota_busy(&ota)) {
+        if (!stage(&ota)) usleep(100);
+    }
+    stage(&ota);
+}
+
+// The update of img by patch; quiet: no report, the caller reads ota_error()
+static int update(const Bytes_t& img, const Bytes_t& patch, uint32_t rateKBs, uint32_t sectorMs,
+                  uint32_t partKB, bool serial, uint16_t port, bool quiet) {
+    // Running partition: the image, then erased flash
+    Bytes_t part((size_t)partKB * 1024, 0xFF);
+    if (img.size() > part.size()) {
+        fprintf(stderr, "image larger than the partition\n");
+        return 1;
+    }
+    memcpy(part.data(), img.data(), img.size());
+    if (!save("ota_a.bin", part.data(), part.size())) return 1;
+
+    Server_t srv;
+    srv.patch = &patch;
+    srv.rateKBs = rateKBs;
+    srv.listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(srv.listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in a;
+    memset(&a, 0, sizeof(a));
+    a.sin_family = AF_INET;
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    a.sin_port = htons(port);
+    if (bind(srv.listenFd, (struct sockaddr*)&a, sizeof(a)) != 0 || listen(srv.listenFd, 1) != 0) {
+        fprintf(stderr, "cannot listen on %u\n", port);
+        return 1;
+    }
+    std::thread server(serve_patch, &srv);
+
+    char url[64];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%u/signaltap.patch", port);
+    ota_init(&ota, "ota_a.bin", "ota_b.bin");
+    ota.next.sectorUs = sectorMs * 1000;
+    double t0 = now_us();
+    if (!ota_start(&ota, url)) {
+        fprintf(stderr, "start failed: %s\n", ota_error_text(ota_error(&ota)));
+        close(srv.listenFd);
+        server.join();
+        return 1;
+    }
+    if (serial) {
+        while (ota_busy(&ota)) {
+            if (!ota_service(&ota)) usleep(100);
+        }
+        ota_service(&ota);
+    } else {
+        std::thread fetch(run_stage, ota_fetch_service);
+        std::thread decode(run_stage, ota_decode_service);
+        std::thread write(run_stage, ota_write_service);
+        fetch.join();
+        decode.join();
+        write.join();
+    }
+    double wallMs = (now_us() - t0) / 1000;
+    server.join();
+    close(srv.listenFd);
+
+    const OtaStats_t* st = ota_get_stats(&ota);
+    bool ok = ota_state(&ota) == OTA_DONE && ota.next.activated;
+    if (quiet) return ok ? 0 : 1;
+    printf("%s in %.0f ms (%s): patch %u B -> image %u B, %s link, %u ms/sector flash\n",
+           ok ? "updated" : "FAILED", wallMs, serial ? "one thread" : "3 stage threads",
+           st->patchBytes, st->imageBytes, rateKBs ? "paced" : "unpaced", sectorMs);
+    if (!ok && ota_state(&ota) == OTA_DONE) printf("  error: done, but the new image was not activated\n");
+    else if (!ok) printf("  error: %s\n", ota_error_text(ota_error(&ota)));
+    if (rateKBs) {
+        printf("  link %u KB/s: patch alone takes %.0f ms, the full image would take %.0f ms\n",
+               rateKBs, st->patchBytes * 1000.0 / (rateKBs * 1024.0), st->imageBytes * 1000.0 / (rateKBs * 1024.0));
+    }
+    printf("  stage time: check %.1f ms, fetch %.1f ms, decode %.1f ms, write %.1f ms (sum %.0f ms)\n",
+           st->checkUs / 1000.0, st->fetchUs / 1000.0, st->decodeUs / 1000.0, st->writeUs / 1000.0,
+           (st->checkUs + st->fetchUs + st->decodeUs + st->writeUs) / 1000.0);
+    printf("  ram: %zu B update state (buffers %zu B, decoder %zu B)",
+           sizeof(OtaUpdate_t), sizeof(ota.in) + sizeof(ota.out), sizeof(DpDecoder_t));
+    printf(serial ? "\n" : " + 3 task stacks of %u B on the device\n", OTA_TASK_STACK);
+    return ok ? 0 : 1;
+}
+
+static int run(const char* oldPath, const char* patchPath, uint32_t rateKBs, uint32_t sectorMs,
+               uint32_t partKB, bool serial, uint16_t port) {
+    Bytes_t img, patch;
+    if (!load(oldPath, &img) || !load(patchPath, &patch)) {
+        fprintf(stderr, "cannot read %s / %s\n", oldPath, patchPath);
+        return 1;
+    }
+    return update(img, patch, rateKBs, sectorMs, partKB, serial, port, false);
+}
+
+// ============ Check ============
+#define CHECK_IMAGE_BYTES   (768 * 1024)
+
+static uint32_t rngState = 0x2545F491;
+
+static uint32_t rng(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+// Code-like old image (words mostly from a small set), and the new one:
+// scattered edits, 4 KB inserted, 2 KB deleted, a region relocated by 0x100
+static void synth_images(Bytes_t* oldImg, Bytes_t* newImg) {
+    uint32_t words[64];
+    for (int i = 0; i < 64; i++) words[i] = rng();
+    oldImg->resize(CHECK_IMAGE_BYTES);
+    for (size_t i = 0; i < CHECK_IMAGE_BYTES; i += 4) {
+        uint32_t w = rng() % 10 < 7 ? words[rng() % 64] : rng();
+        memcpy(oldImg->data() + i, &w, 4);
+    }
+
+    Bytes_t n(oldImg->begin(), oldImg->end());
+    for (int e = 0; e < 20; e++) {
+        size_t at = rng() % (n.size() - 64), len = 1 + rng() % 64;
+        for (size_t i = 0; i < len; i++) n[at + i] = (uint8_t)rng();
+    }
+    for (size_t i = 256 * 1024; i < 320 * 1024; i += 64) {
+        uint32_t w;
+        memcpy(&w, n.data() + i, 4);
+        w += 0x100;
+        memcpy(n.data() + i, &w, 4);
+    }
+    n.erase(n.begin() + 2 * CHECK_IMAGE_BYTES / 3, n.begin() + 2 * CHECK_IMAGE_BYTES / 3 + 2048);
+    Bytes_t ins(4096);
+    for (size_t i = 0; i < ins.size(); i++) ins[i] = (uint8_t)rng();
+    n.insert(n.begin() + CHECK_IMAGE_BYTES / 3, ins.begin(), ins.end());
+    *newImg = n;
+}
+
+static int check(uint16_t port) {
+    Bytes_t src, dst;
+    synth_images(&src, &dst);
+    static Enc_t enc;
+    Bytes_t patch = encode(src, dst, &enc);
+    double decUs;
+    uint32_t failures = 0;
+    if (!decode_check(src, patch, dst, &decUs)) {
+        printf("  FAILED: patch does not decode back to the new image\n");
+        failures++;
+    }
+    printf("images %zu -> %zu bytes, patch %zu bytes (%.1f%%)\n",
+           src.size(), dst.size(), patch.size(), 100.0 * patch.size() / dst.size());
+
+    for (int serial = 0; serial < 2; serial++) {
+        Bytes_t part;
+        if (update(src, patch, 0, 0, 3072, serial, port, false) != 0) {
+            failures++;
+        } else if (!load("ota_b.bin", &part) || part.size() < dst.size() ||
+                   memcmp(part.data(), dst.data(), dst.size()) != 0) {
+            printf("  FAILED: B partition does not hold the new image\n");
+            failures++;
+        }
+    }
+
+    Bytes_t other(src);
+    other[CHECK_IMAGE_BYTES / 2] ^= 0x01;
+    if (update(other, patch, 0, 0, 3072, false, port, true) == 0 || ota.next.activated ||
+        ota_error(&ota) != OTA_ERR_BASE) {
+        printf("  FAILED: patch for another image: %s, %s\n", ota_error_text(ota_error(&ota)),
+               ota.next.activated ? "activated" : "not activated");
+        failures++;
+    } else {
+        printf("patch for another image: %s\n", ota_error_text(ota_error(&ota)));
+    }
+
+    Bytes_t bad(patch);
+    bad[bad.size() / 2] ^= 0x20;
+    if (update(src, bad, 0, 0, 3072, false, port, true) == 0 || ota.next.activated) {
+        printf("  FAILED: damaged patch set to boot\n");
+        failures++;
+    } else {
+        printf("patch with a flipped byte: %s\n", ota_error_text(ota_error(&ota)));
+    }
+
+    remove("ota_a.bin");
+    remove("ota_b.bin");
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc == 5 && strcmp(argv[1], "make") == 0) return make(argv[2], argv[3], argv[4]);
+    if (argc >= 4 && strcmp(argv[1], "run") == 0) {
+        uint32_t rate = 0, sectorMs = 0, partKB = 3072;
+        bool serial = false;
+        uint16_t port = 8090;
+        for (int i = 4; i < argc; i++) {
+            if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) rate = atoi(argv[++i]);
+            else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) sectorMs = atoi(argv[++i]);
+            else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) partKB = atoi(argv[++i]);
+            else if (strcmp(argv[i], "-1") == 0) serial = true;
+            else port = (uint16_t)atoi(argv[i]);
+        }
+        return run(argv[2], argv[3], rate, sectorMs, partKB, serial, port);
+    }
+    if (argc >= 2 && strcmp(argv[1], "check") == 0) return check(argc > 2 ? (uint16_t)atoi(argv[2]) : 8090);
+    fprintf(stderr, "usage: ota_bench make <old.bin> <new.bin> <patch.bin>\n"
+                    "       ota_bench run <old.bin> <patch.bin> [-r KB/s] [-f ms/sector] [-p KB] [-1] [port]\n"
+                    "       ota_bench check [port]\n");
+    return 2;
+}
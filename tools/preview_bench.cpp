@@ -0,0 +1,231 @@
+// SIGNALTAP Camera Preview Bench (host)
+// Runs the Vision screen's live preview (src/vision/cam_preview) the way
+// the device does, with a clip file standing in for the camera: a camera
+// thread grabs 1280x720 YUYV frames at 30 fps through camera_grab() (the
+// clip is mapped, frames are lent out in place) and pushes them; a UI
+// thread runs at LVGL's refresh period, polls preview_take() on the UI
+// timer's schedule and, for each new frame, redraws just the image area
+// into a full-screen RGB565 draw buffer, which is what LVGL's software
+// renderer does for an unscaled opaque RGB565 image.
+//
+// Checks every frame shown: the top and bottom rows come from the same
+// clip frame (no tearing), it matches a reference conversion to within
+// one RGB565 step, and it is untouched until the next one replaces it.
+// Reports the conversion cost on the camera side (a C loop here; the PPA
+// on the device) and the UI-side cost per shown frame against the UI
+// frame time.
+//
+// Build: make -C tools preview_bench (tools/Makefile, against tools/host/Arduino.h)
+// (SAN=thread checks the buffer hand-over)
+//
+// Usage: preview_bench [-s seconds (5)] [clip.yuyv]
+//   Without a clip, writes preview_clip.yuyv (16 frames) and uses that.
+#include <Arduino.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "../src/vision/cam_preview.h"
+#include "../src/vision/camera.h"
+
+#define FRAME_W         1280
+#define FRAME_H         720
+#define FPS             30
+#define CLIP_FRAMES     16
+#define STRIPE_ROWS     16          // Frame number, top and bottom
+#define SCREEN_W        1024        // config.h DISPLAY_WIDTH / HEIGHT
+#define SCREEN_H        600
+#define UI_PERIOD_MS    16          // lv_conf.h LV_DEF_REFR_PERIOD
+#define IMG_X           185         // Where the camera card puts the image
+#define IMG_Y           473
+
+static double now_us(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+static uint8_t clamp8(int v) {
+    return (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+// ============ Clip ============
+// Grey gradient, a red box moving across, and the frame number as the
+// brightness of the top and bottom stripes
+static uint8_t stripe_y(int k) {
+    return (uint8_t)(40 + 12 * k);
+}
+
+static bool write_clip(const char* path) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    std::vector<uint8_t> frame((size_t)FRAME_W * FRAME_H * 2);
+    for (int k = 0; k < CLIP_FRAMES; k++) {
+        int bx = 100 + 60 * k;
+        for (int y = 0; y < FRAME_H; y++) {
+            uint8_t* p = &frame[(size_t)y * FRAME_W * 2];
+            bool stripe = y < STRIPE_ROWS || y >= FRAME_H - STRIPE_ROWS;
+            for (int x = 0; x < FRAME_W; x += 2, p += 4) {
+                bool box = x >= bx && x < bx + 200 && y >= 250 && y < 450;
+                uint8_t luma = stripe ? stripe_y(k) : box ? 82 : (uint8_t)(50 + x / 8);
+                p[0] = p[2] = luma;
+                p[1] = box && !stripe ? 90 : 128;
+                p[3] = box && !stripe ? 240 : 128;
+            }
+        }
+        if (fwrite(frame.data(), 1, frame.size(), f) != frame.size()) {
+            fclose(f);
+            return false;
+        }
+    }
+    return fclose(f) == 0;
+}
+
+// ============ Checks ============
+// Clip frame a preview row comes from, by its stripe brightness
+static int frame_of(const uint16_t* row) {
+    int g = (row[0] >> 5) & 0x3F;
+    return (int)lround((g * 4 + 2 - 40) / 12.0);
+}
+
+// Reference: same sample point, floating-point BT.601 full range
+static int max_error(const uint16_t* img, const uint8_t* src, int w, int h) {
+    int worst = 0;
+    for (int y = 0; y < h; y++) {
+        const uint8_t* line = src + (size_t)((2 * y + 1) * FRAME_H / (2 * h)) * FRAME_W * 2;
+        for (int x = 0; x < w; x++) {
+            int sx = (2 * x + 1) * FRAME_W / (2 * w);
+            const uint8_t* pair = line + (sx & ~1) * 2;
+            double yy = pair[(sx & 1) * 2], d = pair[1] - 128.0, e = pair[3] - 128.0;
+            int r = clamp8((int)lround(yy + 1.402 * e)) >> 3;
+            int g = clamp8((int)lround(yy - 0.344136 * d - 0.714136 * e)) >> 2;
+            int b = clamp8((int)lround(yy + 1.772 * d)) >> 3;
+            uint16_t px = img[y * w + x];
+            int err = abs(((px >> 11) & 0x1F) - r);
+            if (abs(((px >> 5) & 0x3F) - g) > err) err = abs(((px >> 5) & 0x3F) - g);
+            if (abs((px & 0x1F) - b) > err) err = abs((px & 0x1F) - b);
+            if (err > worst) worst = err;
+        }
+    }
+    return worst;
+}
+
+static uint32_t checksum(const uint16_t* p, size_t n) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < n; i++) h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+int main(int argc, char** argv) {
+    double seconds = 5;
+    const char* clipPath = NULL;
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "-s") == 0 && a + 1 < argc) seconds = atof(argv[++a]);
+        else clipPath = argv[a];
+    }
+    if (!clipPath) {
+        clipPath = "preview_clip.yuyv";
+        if (!write_clip(clipPath)) {
+            fprintf(stderr, "%s: cannot write\n", clipPath);
+            return 1;
+        }
+    }
+
+    static Camera_t camera;
+    if (!camera_open(&camera, clipPath, FRAME_W, FRAME_H, FPS)) {
+        fprintf(stderr, "%s: not a %dx%d YUYV clip\n", clipPath, FRAME_W, FRAME_H);
+        return 1;
+    }
+    static CamPreview_t preview;
+    if (!preview_init(&preview, PREVIEW_WIDTH, PREVIEW_HEIGHT, PREVIEW_FPS)) {
+        fprintf(stderr, "preview buffers: out of memory\n");
+        return 1;
+    }
+    const int w = preview.width, h = preview.height;
+
+    std::atomic<bool> stop(false);
+    std::thread cam([&] {
+        while (!stop.load()) {
+            const uint8_t* frame = camera_grab(&camera, 100);
+            if (!frame) continue;
+            preview_push(&preview, frame, camera.width, camera.height, camera.stride, camera.frameMs);
+            camera_release(&camera);
+        }
+    });
+
+    // UI thread: LVGL's refresh loop with the preview timer in it
+    std::vector<uint16_t> screen((size_t)SCREEN_W * SCREEN_H);
+    const uint16_t* shown = NULL;
+    uint32_t shownSum = 0;
+    uint32_t uiFrames = 0, redraws = 0, torn = 0, overwritten = 0;
+    int worstErr = 0;
+    double uiUs = 0, uiMaxUs = 0;
+    double t0 = now_us(), nextTimer = t0;
+    const double timerUs = 1000000.0 / (2 * PREVIEW_FPS);
+    while (now_us() - t0 < seconds * 1e6) {
+        double frameStart = now_us();
+        uiFrames++;
+        if (frameStart >= nextTimer) {
+            nextTimer += timerUs;
+            if (shown && checksum(shown, (size_t)w * h) != shownSum) overwritten++;
+
+            double a = now_us();
+            const uint16_t* buf = preview_take(&preview);
+            if (buf) {
+                for (int y = 0; y < h; y++) {
+                    memcpy(&screen[(size_t)(IMG_Y + y) * SCREEN_W + IMG_X], buf + y * w, w * 2);
+                }
+                double us = now_us() - a;
+                uiUs += us;
+                if (us > uiMaxUs) uiMaxUs = us;
+                redraws++;
+
+                int top = frame_of(buf), bottom = frame_of(buf + (h - 1) * w);
+                if (top != bottom || top < 0 || top >= CLIP_FRAMES) {
+                    torn++;
+                } else {
+                    int err = max_error(buf, camera.clip + (size_t)top * FRAME_W * FRAME_H * 2, w, h);
+                    if (err > worstErr) worstErr = err;
+                }
+                shown = buf;
+                shownSum = checksum(buf, (size_t)w * h);
+            }
+        }
+        double left = UI_PERIOD_MS * 1000.0 - (now_us() - frameStart);
+        if (left > 0) usleep((useconds_t)left);
+    }
+    stop.store(true);
+    cam.join();
+
+    // Full-screen redraw, for scale
+    double a = now_us();
+    for (int k = 0; k < 100; k++) {
+        for (int y = 0; y < SCREEN_H; y++) {
+            memcpy(&screen[(size_t)y * SCREEN_W], &screen[(size_t)((y + 1) % SCREEN_H) * SCREEN_W], SCREEN_W * 2);
+        }
+    }
+    double fullUs = (now_us() - a) / 100;
+
+    const PreviewStats_t* ps = preview_get_stats(&preview);
+    const CameraStats_t* cs = camera_get_stats(&camera);
+    double perRedraw = redraws ? uiUs / redraws : 0;
+    printf("%.0f s: camera %lu frames (%lu dropped), preview %dx%d at %d fps\n", seconds,
+           (unsigned long)cs->frames, (unsigned long)cs->dropped, w, h, PREVIEW_FPS);
+    printf("camera side: %lu converted, %lu skipped (UI had not taken the last), "
+           "%.0f us/frame avg, %lu max, load %.2f%% of the preview interval\n",
+           (unsigned long)ps->frames, (unsigned long)ps->skipped, ps->avgUs,
+           (unsigned long)ps->maxUs, ps->loadPct);
+    printf("UI side: %lu of %lu UI frames redraw the image (%.1f fps), %.1f us each (max %.0f): "
+           "%.3f%% of a %d ms UI frame; a full-screen redraw is %.0f us\n",
+           (unsigned long)redraws, (unsigned long)uiFrames, redraws / seconds, perRedraw, uiMaxUs,
+           perRedraw * 100.0 / (UI_PERIOD_MS * 1000.0), UI_PERIOD_MS, fullUs);
+    printf("checks: %lu torn, %lu overwritten while shown, max error %d RGB565 steps\n",
+           (unsigned long)torn, (unsigned long)overwritten, worstErr);
+    camera_close(&camera);
+    return (torn || overwritten || worstErr > 1 || redraws == 0) ? 1 : 0;
+}
@@ -0,0 +1,199 @@
+// SIGNALTAP Remaining-Useful-Life Check (host)
+// The RLS estimator (src/ai/rul_estimator) on degradation with a known
+// trend, fed as the simulation feeds it (100 - health score, rounded to
+// whole points, failure at 50), once per second unless noted.
+//  - Linear: D(t) = 5 + 0.25 t, crossing at 180 s
+//  - Slow: D(t) = 5 + 0.03 t every 10 s, crossing at 1500 s, past two
+//    time-origin shifts (RUL_RECENTER_S)
+//  - Exponential: D(t) = 5 exp(0.015 t), crossing at 153.5 s
+//  - Noise: uniform +-amplitude on top of the trend before rounding
+//  - Checks, exit 1 on a failure, until BENCH_LAST samples before the
+//    crossing: from BENCH_SETTLE samples in, a degrading prediction and
+//    the trend's own model's slope within BENCH_SLOPE_TOL of the true
+//    one; from halfway to the crossing (the two models are hard to tell
+//    apart on a short early stretch), the prediction on that model and
+//    its time-to-threshold within BENCH_TTT_TOL of the true one. A flat
+//    trend is not degrading and carries almost no failure risk. The
+//    tolerances hold for the default noise; with ~20 samples of memory,
+//    much more noise than rounding already has moves the estimate further
+//  - Timing: ns per rul_update + rul_predict
+//
+// Build: make -C tools rul_bench (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage: rul_bench [-n noise amplitude (0.5)] [-r runs per trend (20)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "../src/ai/rul_estimator.h"
+
+#define BENCH_THRESHOLD     50.0f
+#define BENCH_HORIZON_S     60.0f
+#define BENCH_SETTLE        40      // Samples before the slope checks start
+#define BENCH_CONVERGED     0.5f    // ... the prediction ones: this far to the crossing
+#define BENCH_LAST          10      // Samples before the crossing the checks stop
+#define BENCH_SLOPE_TOL     0.15f   // Relative
+#define BENCH_TTT_TOL       0.20f   // Relative, or 2 samples, whichever is larger
+#define BENCH_FLAT_S        300
+#define BENCH_FLAT_RISK     5.0f    // Percent
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t rng = 0x2545F491;
+
+static float rand_unit(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return (rng >> 8) * (1.0f / 16777216.0f);
+}
+
+static uint32_t failures = 0;
+
+static void fail(const char* what) {
+    if (failures < 10) printf("  FAILED: %s\n", what);
+    failures++;
+}
+
+// ============ Trends ============
+typedef struct {
+    const char* name;
+    RulModel_t model;
+    float a, b;         // D = a + b t, or a exp(b t)
+    int step;           // Seconds between samples
+} Trend_t;
+
+static const Trend_t trends[] = {
+    {"linear",      RUL_MODEL_LINEAR,      5.0f, 0.25f,  1},
+    {"slow",        RUL_MODEL_LINEAR,      5.0f, 0.03f,  10},
+    {"exponential", RUL_MODEL_EXPONENTIAL, 5.0f, 0.015f, 1},
+};
+
+static float trend_value(const Trend_t* tr, float t) {
+    return tr->model == RUL_MODEL_LINEAR ? tr->a + tr->b * t : tr->a * expf(tr->b * t);
+}
+
+static float trend_crossing(const Trend_t* tr) {
+    return tr->model == RUL_MODEL_LINEAR ? (BENCH_THRESHOLD - tr->a) / tr->b
+                                         : logf(BENCH_THRESHOLD / tr->a) / tr->b;
+}
+
+static float sample(float d, float noise) {
+    return roundf(d + noise * (2.0f * rand_unit() - 1.0f));
+}
+
+// ============ Checks ============
+typedef struct {
+    uint32_t checked;
+    float slopeErr;     // Worst relative error
+    float tttErr;
+    float tttWorstAt;   // True time-to-threshold at the worst one
+    uint32_t wrongModel;
+    uint32_t updates;
+    double ns;
+} Result_t;
+
+static void run_trend(const Trend_t* tr, float noise, Result_t* res) {
+    RulEstimator_t est;
+    RulPrediction_t p;
+    rul_init(&est, BENCH_THRESHOLD);
+    int samples = (int)(trend_crossing(tr) / tr->step);
+    for (int n = 1; n < samples; n++) {
+        int t = n * tr->step;
+        float d = sample(trend_value(tr, (float)t), noise);
+        double t0 = now_ns();
+        rul_update(&est, (float)t, d);
+        bool valid = rul_predict(&est, BENCH_HORIZON_S, &p);
+        res->ns += now_ns() - t0;
+        res->updates++;
+        if (n < BENCH_SETTLE || n > samples - BENCH_LAST) continue;
+
+        char what[128];
+        if (!valid || !p.degrading) {
+            snprintf(what, sizeof(what), "%s at %d s: no degrading prediction", tr->name, t);
+            fail(what);
+            continue;
+        }
+        const RulRls_t* own = tr->model == RUL_MODEL_LINEAR ? &est.linear : &est.expo;
+        float slope = own->theta[1];
+        float slopeErr = fabsf(slope - tr->b) / tr->b;
+        if (slopeErr > res->slopeErr) res->slopeErr = slopeErr;
+        if (slopeErr > BENCH_SLOPE_TOL) {
+            snprintf(what, sizeof(what), "%s at %d s: slope %.4f, true %.4f", tr->name, t, slope, tr->b);
+            fail(what);
+        }
+        if (n < BENCH_CONVERGED * samples) continue;
+
+        // The prediction, from the model the estimator picked
+        float trueTtt = trend_crossing(tr) - (float)t;
+        float tttErr = fabsf(p.ttt - trueTtt) / trueTtt;
+        res->checked++;
+        if (tttErr > res->tttErr) {
+            res->tttErr = tttErr;
+            res->tttWorstAt = trueTtt;
+        }
+        if (fabsf(p.ttt - trueTtt) > fmaxf(BENCH_TTT_TOL * trueTtt, 2.0f * tr->step)) {
+            snprintf(what, sizeof(what), "%s at %d s: time-to-threshold %.1f s, true %.1f s", tr->name, t,
+                     p.ttt, trueTtt);
+            fail(what);
+        }
+        if (p.model != tr->model) {
+            res->wrongModel++;
+            snprintf(what, sizeof(what), "%s at %d s: %s model chosen", tr->name, t,
+                     p.model == RUL_MODEL_LINEAR ? "linear" : "exponential");
+            fail(what);
+        }
+    }
+}
+
+static void run_flat(float noise, float* worstRisk, uint32_t* degrading) {
+    RulEstimator_t est;
+    RulPrediction_t p;
+    rul_init(&est, BENCH_THRESHOLD);
+    for (int t = 1; t <= BENCH_FLAT_S; t++) {
+        rul_update(&est, (float)t, sample(10.0f, noise));
+        if (t < BENCH_SETTLE || !rul_predict(&est, BENCH_HORIZON_S, &p)) continue;
+        if (p.failureProb > *worstRisk) *worstRisk = p.failureProb;
+        if (p.degrading && p.ttt < BENCH_HORIZON_S) (*degrading)++;
+    }
+}
+
+int main(int argc, char** argv) {
+    float noise = 0.5f;
+    int runs = 20;
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-n") == 0) noise = (float)atof(argv[a + 1]);
+        else if (strcmp(argv[a], "-r") == 0) runs = atoi(argv[a + 1]);
+    }
+    if (runs < 1) runs = 1;
+
+    Result_t all = {};
+    for (size_t i = 0; i < sizeof(trends) / sizeof(trends[0]); i++) {
+        Result_t res = {};
+        for (int r = 0; r < runs; r++) run_trend(&trends[i], noise, &res);
+        printf("%-11s slope %.4f/s, crossing %.1f s: %lu checked, worst slope error %.1f%%, "
+               "worst time-to-threshold error %.1f%% (%.0f s out), %lu on the other model\n",
+               trends[i].name, trends[i].b, trend_crossing(&trends[i]), (unsigned long)res.checked,
+               100.0f * res.slopeErr, 100.0f * res.tttErr, res.tttWorstAt, (unsigned long)res.wrongModel);
+        all.updates += res.updates;
+        all.ns += res.ns;
+    }
+
+    float worstRisk = 0.0f;
+    uint32_t degrading = 0;
+    for (int r = 0; r < runs; r++) run_flat(noise, &worstRisk, &degrading);
+    printf("flat        %d s x %d: worst failure risk %.1f%%, %lu predictions inside the horizon\n",
+           BENCH_FLAT_S, runs, worstRisk, (unsigned long)degrading);
+    if (worstRisk > BENCH_FLAT_RISK) fail("flat trend carries failure risk");
+    if (degrading) fail("flat trend predicted to cross within the horizon");
+
+    printf("update + predict: %.0f ns (noise +-%.2f, %d runs per trend)\n", all.ns / all.updates, noise, runs);
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,196 @@
+// SIGNALTAP Rule Engine Bench (host)
+// Times the compiled threshold rules (src/data/rule_engine) and checks
+// every state change against a plain per-rule reference.
+//  - Delays: one rule per on/off delay pair from 0 to 5 ticks; the alarm
+//    must raise on the tick its condition has held for the on delay
+//    (the first tick for 0 or 1) and clear likewise for the off delay
+//  - Load: -r random rules (ABOVE / BELOW, hysteresis, delays 0-10 s) over
+//    200 machines, the sensors random walks across the limits, -t ticks;
+//    every tick's events must match the reference in order
+//  - Time per tick and per rule for rule_eval and for the reference
+//
+// Build: make -C tools rule_bench (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage: rule_bench [-r rules (10000)] [-t ticks (20000)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include "../src/data/rule_engine.h"
+
+#define BENCH_MACHINES  200
+#define BENCH_INPUTS    (BENCH_MACHINES * RULE_SENSORS_PER_MACHINE)
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t rng = 0x2545F491;
+
+static uint32_t xorshift(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static float uniform(float lo, float hi) {
+    return lo + (hi - lo) * ((xorshift() & 0xFFFFFF) / 16777215.0f);
+}
+
+static uint32_t failures = 0;
+
+static void fail(const char* what, uint32_t tick) {
+    if (failures < 10) printf("  FAILED: %s (tick %lu)\n", what, (unsigned long)tick);
+    failures++;
+}
+
+// ============ Reference ============
+// One rule at a time, as the table reads: raise once "above / below the
+// limit" has held for the on delay, clear once back past the hysteresis
+// has held for the off delay
+typedef struct {
+    bool active;
+    uint32_t held;
+} RefRule_t;
+
+typedef struct {
+    uint8_t machine;
+    uint8_t code;
+    uint8_t active;
+} Event_t;
+
+static uint32_t ref_eval(const RuleDef_t* defs, RefRule_t* st, uint32_t n, const float* values,
+                         std::vector<Event_t>* out) {
+    uint32_t changes = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        const RuleDef_t* d = &defs[i];
+        float sign = d->cmp == RULE_BELOW ? -1.0f : 1.0f;
+        float x = values[d->machine * RULE_SENSORS_PER_MACHINE + d->sensor];
+        bool leave = st[i].active ? x * -sign > -(sign * d->limit - d->hysteresis)
+                                  : x * sign > sign * d->limit;
+        st[i].held = leave ? st[i].held + 1 : 0;
+        if (!leave || st[i].held < (st[i].active ? d->offDelayS : d->onDelayS)) continue;
+        st[i].active = !st[i].active;
+        st[i].held = 0;
+        changes++;
+        if (out) out->push_back({d->machine, (uint8_t)d->code, (uint8_t)st[i].active});
+    }
+    return changes;
+}
+
+static void collect(uint8_t machine, AlarmCode_t code, bool active, void* ctx) {
+    ((std::vector<Event_t>*)ctx)->push_back({machine, (uint8_t)code, (uint8_t)active});
+}
+
+// ============ Delays ============
+static void delays(void) {
+    uint32_t checked = 0;
+    for (uint16_t on = 0; on <= 5; on++) {
+        for (uint16_t off = 0; off <= 5; off++) {
+            RuleDef_t def = {0, 0, RULE_ABOVE, 50.0f, 5.0f, on, off, ALARM_CNC_SPINDLE_TREND};
+            RuleSet_t set;
+            if (!rule_compile(&set, &def, 1, 1)) {
+                fail("compile", 0);
+                return;
+            }
+            std::vector<Event_t> ev;
+            float values[RULE_SENSORS_PER_MACHINE] = {0, 0, 0};
+            uint32_t raisedAt = 0, clearedAt = 0;
+            for (uint32_t t = 1; t <= 40; t++) {
+                values[0] = t < 10 ? 40.0f : t < 25 ? 60.0f : 40.0f;
+                ev.clear();
+                rule_eval(&set, values, collect, &ev);
+                for (const Event_t& e : ev) (e.active ? raisedAt : clearedAt) = t;
+            }
+            uint32_t wantRaise = 10 + (on > 1 ? on : 1) - 1;
+            uint32_t wantClear = 25 + (off > 1 ? off : 1) - 1;
+            if (raisedAt != wantRaise) fail("raised on the wrong tick", raisedAt);
+            if (clearedAt != wantClear) fail("cleared on the wrong tick", clearedAt);
+            rule_free(&set);
+            checked++;
+        }
+    }
+    printf("delays: %lu on/off pairs, raise and clear on the tick the delay is reached\n",
+           (unsigned long)checked);
+}
+
+// ============ Load ============
+static void load(uint32_t rules, uint32_t ticks) {
+    std::vector<RuleDef_t> defs(rules);
+    std::vector<float> base(BENCH_INPUTS);
+    for (float& b : base) b = uniform(10.0f, 100.0f);
+    for (uint32_t i = 0; i < rules; i++) {
+        RuleDef_t* d = &defs[i];
+        d->machine = (uint8_t)(xorshift() % BENCH_MACHINES);
+        d->sensor = (uint8_t)(xorshift() % RULE_SENSORS_PER_MACHINE);
+        d->cmp = (xorshift() & 1) ? RULE_BELOW : RULE_ABOVE;
+        d->limit = base[d->machine * RULE_SENSORS_PER_MACHINE + d->sensor] + uniform(-8.0f, 8.0f);
+        d->hysteresis = uniform(0.0f, 3.0f);
+        d->onDelayS = (uint16_t)(xorshift() % 11);
+        d->offDelayS = (uint16_t)(xorshift() % 11);
+        d->code = (AlarmCode_t)(ALARM_NONE + 1 + xorshift() % (ALARM_CODE_COUNT - 1));
+    }
+
+    RuleSet_t set;
+    if (!rule_compile(&set, defs.data(), rules, BENCH_MACHINES)) {
+        fail("compile", 0);
+        return;
+    }
+    std::vector<RefRule_t> ref(rules, RefRule_t{false, 0});
+    std::vector<float> values(base);
+    std::vector<Event_t> got, want;
+    got.reserve(rules);
+    want.reserve(rules);
+
+    double engineNs = 0, refNs = 0;
+    uint64_t events = 0;
+    for (uint32_t t = 0; t < ticks; t++) {
+        for (uint32_t k = 0; k < BENCH_INPUTS; k++) {
+            values[k] += uniform(-1.0f, 1.0f);
+            values[k] += (base[k] - values[k]) * 0.02f;    // Wander about the base
+        }
+        got.clear();
+        want.clear();
+        double t0 = now_ns();
+        rule_eval(&set, values.data(), collect, &got);
+        double t1 = now_ns();
+        ref_eval(defs.data(), ref.data(), rules, values.data(), &want);
+        double t2 = now_ns();
+        engineNs += t1 - t0;
+        refNs += t2 - t1;
+        events += got.size();
+
+        if (got.size() != want.size() ||
+            (got.size() && memcmp(got.data(), want.data(), got.size() * sizeof(Event_t)) != 0)) {
+            fail("events differ from the reference", t);
+            break;
+        }
+    }
+    const RuleStats_t* st = rule_get_stats(&set);
+    printf("load: %lu rules over %u machines, %lu ticks, %llu state changes (%.1f per tick)\n",
+           (unsigned long)rules, BENCH_MACHINES, (unsigned long)ticks, (unsigned long long)events,
+           (double)events / ticks);
+    printf("  rule_eval  %8.2f us/tick, %.2f ns/rule (%.0f M rules/s)\n",
+           engineNs / ticks / 1e3, engineNs / ticks / rules, rules * ticks / engineNs * 1e3);
+    printf("  reference  %8.2f us/tick, %.2f ns/rule\n",
+           refNs / ticks / 1e3, refNs / ticks / rules);
+    if (st->transitions != events) fail("transition count", ticks);
+    rule_free(&set);
+}
+
+int main(int argc, char** argv) {
+    uint32_t rules = 10000, ticks = 20000;
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-r") == 0) rules = (uint32_t)atol(argv[a + 1]);
+        else if (strcmp(argv[a], "-t") == 0) ticks = (uint32_t)atol(argv[a + 1]);
+    }
+    delays();
+    load(rules, ticks);
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
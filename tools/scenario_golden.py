@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""SIGNALTAP scenario golden trace recorder.
+
+Records tools/golden/scenario_switch.digest from the switch-based
+update_<machine>() scenario code, the parent of the commit that added
+src/data/scenario_tables.h. That tree's simulation is built with
+tools/scenario_trace.cpp (SCENARIO_TRACE_SWITCH: one sim_update() per tick
+on a stepped millis(), as the old engine was timed) against the host shim,
+run for the ticks and seed 'make check' uses, and reduced to a digest by
+the current scenario_trace. 'scenario_trace golden' then holds the
+keyframe tables to it.
+
+The old tree selected its demo through a header-static index, so the
+script adds the sim_set_demo()/sim_get_demo() pair the trace calls.
+
+Usage (from the repository root, needs git and g++):
+    python3 tools/scenario_golden.py [ticks per demo (300)] [seed (1)]
+"""
+import glob
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+DEMO_API = """
+// Added by tools/scenario_golden.py for the trace
+void sim_set_demo(uint8_t index) { setDemo(index); }
+DemoProfile_t* sim_get_demo(void) { return getDemo(); }
+"""
+
+
+def git(*args):
+    return subprocess.check_output(["git"] + list(args), text=True).strip()
+
+
+def switch_commit():
+    added = git("log", "--diff-filter=A", "--format=%H", "--", "src/data/scenario_tables.h").split()
+    if not added:
+        sys.exit("no commit adds src/data/scenario_tables.h")
+    return git("rev-parse", added[-1] + "^")
+
+
+def export_tree(commit, dest):
+    archive = subprocess.Popen(["git", "archive", commit, "src", "config.h"], stdout=subprocess.PIPE)
+    subprocess.check_call(["tar", "-x", "-C", dest], stdin=archive.stdout)
+    if archive.wait() != 0:
+        sys.exit("git archive %s failed" % commit)
+
+
+def add_demo_api(dest):
+    header = os.path.join(dest, "src/data/simulation_engine.h")
+    with open(header) as f:
+        text = f.read()
+    if "sim_set_demo" in text:
+        return
+    text = text.replace("void sim_update(void);",
+                        "void sim_update(void);\nvoid sim_set_demo(uint8_t index);\n"
+                        "DemoProfile_t* sim_get_demo(void);", 1)
+    with open(header, "w") as f:
+        f.write(text)
+    with open(os.path.join(dest, "src/data/simulation_engine.cpp"), "a") as f:
+        f.write(DEMO_API)
+
+
+# The shim with millis() stepped by the trace instead of read from the clock
+def stepped_shim(dest):
+    with open("tools/host/Arduino.h") as f:
+        text = f.read()
+    text, n = re.subn(r"static inline unsigned long millis\(void\) \{\n.*?\n\}",
+                      "inline unsigned long hostSteppedMs = 0;\n"
+                      "static inline unsigned long millis(void) {\n    return hostSteppedMs;\n}",
+                      text, count=1, flags=re.S)
+    if n != 1:
+        sys.exit("tools/host/Arduino.h: no millis() to replace")
+    os.makedirs(os.path.join(dest, "host"))
+    with open(os.path.join(dest, "host/Arduino.h"), "w") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    ticks = sys.argv[1] if len(sys.argv) > 1 else "300"
+    seed = sys.argv[2] if len(sys.argv) > 2 else "1"
+    out = "tools/golden/scenario_switch.digest"
+    commit = switch_commit()
+    subprocess.check_call(["make", "-s", "-C", "tools", "scenario_trace"])
+    with tempfile.TemporaryDirectory() as tmp:
+        export_tree(commit, tmp)
+        add_demo_api(tmp)
+        stepped_shim(tmp)
+        os.makedirs(os.path.join(tmp, "tools"))
+        tracer = os.path.join(tmp, "tools/scenario_trace.cpp")
+        with open("tools/scenario_trace.cpp") as f, open(tracer, "w") as g:
+            g.write(f.read())
+        sources = []
+        for d in ("data", "ai", "dsp", "storage"):
+            sources += sorted(glob.glob(os.path.join(tmp, "src", d, "*.cpp")))
+        binary = os.path.join(tmp, "scenario_trace_switch")
+        subprocess.check_call(["g++", "-O2", "-std=gnu++17", "-w", "-I" + os.path.join(tmp, "host"),
+                               "-DSCENARIO_TRACE_SWITCH", "-o", binary, tracer] + sources + ["-pthread"])
+        trace = os.path.join(tmp, "switch.trace")
+        subprocess.check_call([binary, "write", trace, "-t", ticks, "-s", seed], cwd=tmp)
+        os.makedirs(os.path.dirname(out), exist_ok=True)
+        subprocess.check_call(["tools/build/scenario_trace", "digest", trace, out, "-s", seed])
+    print("recorded %s from %s" % (out, commit[:12]))
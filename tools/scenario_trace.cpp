@@ -0,0 +1,424 @@
+// SIGNALTAP Scenario Trace (host)
+// Per-tick trace of what the scenario engine (src/data/scenario_engine,
+// tables in scenario_tables.h) drives: scenario state, sensor targets and
+// values, health and failure risk, every vision field, KPIs, insights and
+// the active alarm codes, for each demo in turn from one seed. Floats are
+// written round-trippable, so equal traces mean bit-identical runs.
+//  - run: the trace twice, each in a fresh process and scratch directory
+//    (the store files and the profiles' live values are state too); exit 1
+//    unless they match line for line, or if a different seed matches too
+//  - write / check: record a trace to a file before a change to the tables
+//    or the engine, compare against it after; the first differing tick is
+//    printed field by field
+//  - digest / golden: a trace reduced to one hash per field and tick, and
+//    the current engine checked against one. tools/golden/scenario_switch.digest
+//    is the switch-based update_<machine>() code the tables replaced,
+//    recorded by tools/scenario_golden.py. Two fields are left out of the
+//    hashes because later changes own them: threshold alarm codes (the
+//    rule table's timing) and the CNC demo's first insight text (the
+//    bearing pipeline's cadence)
+//
+// Build: make -C tools scenario_trace (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage:
+//   scenario_trace run [-t ticks per demo (1100)] [-s seed (1)]
+//   scenario_trace write <file> [-t ticks] [-s seed]
+//   scenario_trace check <file> [-t ticks] [-s seed]
+//   scenario_trace digest <trace> <digest file> [-s seed the trace was written with]
+//   scenario_trace golden <digest file>
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "../src/data/simulation_engine.h"
+#include "../src/data/alarm_rules.h"
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// ============ Trace ============
+static const char* str(const char* s) {
+    return s ? s : "-";
+}
+
+static uint8_t bits(const bool* b, int n) {
+    uint8_t v = 0;
+    for (int i = 0; i < n; i++) v |= (uint8_t)(b[i] ? 1 : 0) << i;
+    return v;
+}
+
+// One line per tick; fields separated by '|' so a diff can name them
+static void trace_tick(FILE* fp, uint8_t d, uint32_t tick) {
+    const DemoProfile_t* demo = sim_get_demo();
+    const SimState_t* sim = sim_get_state();
+    const Vision_t* v = &demo->vision;
+    const CNCLeds_t* l = &v->leds;
+    bool leds[8] = {l->run, l->feed, l->spindle, l->coolant, l->program, l->error, l->fault, l->ready};
+
+    fprintf(fp, "%u %lu|state %d %lu", d, (unsigned long)tick, (int)sim->scenarioState,
+            (unsigned long)sim->stateTimer);
+    fprintf(fp, "|targets %.9g %.9g %.9g", sim->sensorTargets[0], sim->sensorTargets[1],
+            sim->sensorTargets[2]);
+    fprintf(fp, "|sensors %.9g %.9g %.9g", demo->sensors[0].value, demo->sensors[1].value,
+            demo->sensors[2].value);
+    fprintf(fp, "|health %u %.9g", demo->ai.healthScore, demo->ai.failureProbability);
+    fprintf(fp, "|vision %u %s %02x %s %.9g %.9g %s %02x %02x %u", v->partCount, str(v->stackLight),
+            bits(leds, 8), str(v->errorCode), v->pressure, v->oilTemp, str(v->state),
+            bits(v->diA, 8), bits(v->dqA, 8), v->aq0);
+    fprintf(fp, "|kpis");
+    for (int k = 0; k < 4; k++) fprintf(fp, " %s/%d", str(demo->kpis[k].value), demo->kpis[k].good);
+    for (int k = 0; k < 3; k++) {
+        const AIInsight_t* in = &demo->ai.insights[k];
+        fprintf(fp, "|insight%d %d %s: %s", k, (int)in->severity, str(in->title), str(in->description));
+    }
+    fprintf(fp, "|alarms");
+    for (uint8_t a = 0; a < sim_get_alarm_count(); a++) fprintf(fp, " %u", sim_get_alarm(a)->code);
+    fputc('\n', fp);
+}
+
+static void trace_run(FILE* fp, uint32_t ticks, unsigned seed) {
+    srand(seed);
+    sim_init();
+    for (uint8_t d = 0; d < DEMO_COUNT; d++) {
+        sim_set_demo(d);
+        for (uint32_t t = 0; t < ticks; t++) {
+#if defined(SCENARIO_TRACE_SWITCH)
+            // The switch code ran one tick per sim_update(), timed by millis()
+            hostSteppedMs += 1000;
+            sim_update();
+#else
+            sim_step(SIM_TICK_MS, 1);
+#endif
+            trace_tick(fp, d, t);
+        }
+    }
+}
+
+// The trace from a fresh process in a fresh scratch directory, into path
+static bool trace_to_file(const char* path, uint32_t ticks, unsigned seed) {
+    char dir[] = "/tmp/scenario_trace.XXXXXX";
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return false;
+    }
+    char cwd[1024];
+    std::string abs = path;
+    if (path[0] != '/' && getcwd(cwd, sizeof(cwd))) abs = std::string(cwd) + "/" + path;
+    pid_t pid = fork();
+    if (pid == 0) {
+        if (chdir(dir) != 0) _exit(2);
+        FILE* fp = fopen(abs.c_str(), "w");
+        if (!fp) _exit(2);
+        trace_run(fp, ticks, seed);
+        _exit(fclose(fp) == 0 ? 0 : 2);
+    }
+    int status = 0;
+    bool ok = pid > 0 && waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    std::string rm = std::string("rm -rf ") + dir;
+    if (system(rm.c_str()) != 0) ok = false;
+    if (!ok) fprintf(stderr, "trace run failed\n");
+    return ok;
+}
+
+static bool read_lines(const char* path, std::vector<std::string>* lines) {
+    FILE* fp = fopen(path, "r");
+    if (!fp) {
+        perror(path);
+        return false;
+    }
+    char buf[2048];
+    while (fgets(buf, sizeof(buf), fp)) lines->push_back(buf);
+    fclose(fp);
+    return true;
+}
+
+// ============ Compare ============
+static void print_field_diff(const std::string& a, const std::string& b) {
+    size_t pa = 0, pb = 0;
+    while (pa < a.size() || pb < b.size()) {
+        size_t ea = a.find('|', pa), eb = b.find('|', pb);
+        std::string fa = a.substr(pa, ea == std::string::npos ? std::string::npos : ea - pa);
+        std::string fb = b.substr(pb, eb == std::string::npos ? std::string::npos : eb - pb);
+        if (fa != fb) {
+            if (!fa.empty() && fa.back() == '\n') fa.pop_back();
+            if (!fb.empty() && fb.back() == '\n') fb.pop_back();
+            printf("    was: %s\n    now: %s\n", fa.c_str(), fb.c_str());
+        }
+        if (ea == std::string::npos || eb == std::string::npos) break;
+        pa = ea + 1;
+        pb = eb + 1;
+    }
+}
+
+// Number of differing lines; the first one is printed if show
+static uint32_t compare(const std::vector<std::string>& was, const std::vector<std::string>& now,
+                        bool show) {
+    uint32_t diffs = 0;
+    size_t n = was.size() > now.size() ? was.size() : now.size();
+    for (size_t i = 0; i < n; i++) {
+        const std::string& a = i < was.size() ? was[i] : std::string();
+        const std::string& b = i < now.size() ? now[i] : std::string();
+        if (a == b) continue;
+        if (diffs == 0 && show) {
+            printf("  first difference at line %lu (demo tick \"%s\"):\n", (unsigned long)i + 1,
+                   (i < now.size() ? b : a).substr(0, (i < now.size() ? b : a).find('|')).c_str());
+            print_field_diff(a, b);
+        }
+        diffs++;
+    }
+    return diffs;
+}
+
+static uint32_t hash_lines(const std::vector<std::string>& lines) {
+    uint32_t h = 2166136261u;   // FNV-1a
+    for (const std::string& s : lines) {
+        for (unsigned char c : s) h = (h ^ c) * 16777619u;
+    }
+    return h;
+}
+
+// ============ Digest ============
+#define DIGEST_FIELDS   10      // After "demo tick": state .. alarms
+
+static uint32_t fnv(const std::string& s) {
+    uint32_t h = 2166136261u;
+    for (unsigned char c : s) h = (h ^ c) * 16777619u;
+    return h;
+}
+
+static std::vector<std::string> fields(const std::string& line) {
+    std::vector<std::string> f;
+    size_t p = 0;
+    for (;;) {
+        size_t e = line.find('|', p);
+        f.push_back(line.substr(p, e == std::string::npos ? std::string::npos : e - p));
+        if (e == std::string::npos) break;
+        p = e + 1;
+    }
+    if (!f.empty() && !f.back().empty() && f.back().back() == '\n') f.back().pop_back();
+    return f;
+}
+
+static bool rule_code(unsigned code) {
+    for (size_t r = 0; r < ALARM_RULE_COUNT; r++) {
+        if (alarmRules[r].code == code) return true;
+    }
+    return false;
+}
+
+// The fields the scenario tables own: threshold alarm codes and the
+// CNC bearing insight text dropped
+static void mask(std::vector<std::string>* f) {
+    std::string& alarms = f->back();
+    std::string kept = "alarms";
+    const char* p = alarms.c_str() + strlen("alarms");
+    char* end;
+    for (unsigned long c = strtoul(p, &end, 10); end != p; c = strtoul(p, &end, 10)) {
+        if (!rule_code((unsigned)c)) kept += " " + std::to_string(c);
+        p = end;
+    }
+    alarms = kept;
+    if ((*f)[0].compare(0, 2, "0 ") == 0) {
+        std::string& insight = (*f)[7];
+        insight = insight.substr(0, insight.find(':'));
+    }
+}
+
+static std::vector<std::string> split_words(const std::string& s) {
+    std::vector<std::string> w;
+    size_t p = 0;
+    while ((p = s.find_first_not_of(' ', p)) != std::string::npos) {
+        size_t e = s.find(' ', p);
+        w.push_back(s.substr(p, e == std::string::npos ? std::string::npos : e - p));
+        p = e;
+    }
+    return w;
+}
+
+// "demo tick" then one hash per field, or "" for a line that does not parse
+static std::string digest_line(const std::string& line) {
+    std::vector<std::string> f = fields(line);
+    if (f.size() != DIGEST_FIELDS + 1) return "";
+    mask(&f);
+    std::string out = f[0];
+    char h[12];
+    for (size_t i = 1; i < f.size(); i++) {
+        snprintf(h, sizeof(h), " %08lx", (unsigned long)fnv(f[i]));
+        out += h;
+    }
+    return out;
+}
+
+// ============ Modes ============
+static int run(uint32_t ticks, unsigned seed) {
+    const char* paths[3] = {"scenario_trace.a", "scenario_trace.b", "scenario_trace.c"};
+    std::vector<std::string> lines[3];
+    double t = now_ns();
+    bool ok = trace_to_file(paths[0], ticks, seed) && trace_to_file(paths[1], ticks, seed) &&
+              trace_to_file(paths[2], ticks, seed + 1);
+    double runS = (now_ns() - t) / 3 / 1e9;
+    for (int i = 0; ok && i < 3; i++) ok = read_lines(paths[i], &lines[i]);
+    for (int i = 0; i < 3; i++) remove(paths[i]);
+    if (!ok) {
+        printf("checks FAILED\n");
+        return 1;
+    }
+
+    uint32_t failures = 0;
+    printf("trace: %u demos x %lu ticks, seed %u: %lu lines, hash %08lx, %.2f s per run\n",
+           DEMO_COUNT, (unsigned long)ticks, seed, (unsigned long)lines[0].size(),
+           (unsigned long)hash_lines(lines[0]), runS);
+    if (lines[0].size() != (size_t)DEMO_COUNT * ticks) {
+        printf("  FAILED: short trace\n");
+        failures++;
+    }
+    uint32_t diffs = compare(lines[0], lines[1], true);
+    printf("same seed, second process: %lu lines differ\n", (unsigned long)diffs);
+    if (diffs) failures++;
+    uint32_t other = compare(lines[0], lines[2], false) ? 1 : 0;
+    printf("seed %u: %s\n", seed + 1, other ? "differs, as it should" : "identical");
+    if (!other) {
+        printf("  FAILED: the trace does not follow the random stream\n");
+        failures++;
+    }
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
+
+static int check(const char* path, uint32_t ticks, unsigned seed) {
+    std::vector<std::string> was, now;
+    const char* tmp = "scenario_trace.now";
+    bool ok = read_lines(path, &was) && trace_to_file(tmp, ticks, seed) && read_lines(tmp, &now);
+    remove(tmp);
+    if (!ok) return 1;
+    uint32_t diffs = compare(was, now, true);
+    printf("%s: %lu lines, %lu differ\n", path, (unsigned long)was.size(), (unsigned long)diffs);
+    printf("%s\n", diffs ? "checks FAILED" : "all checks passed");
+    return diffs ? 1 : 0;
+}
+
+static int digest(const char* tracePath, const char* path, unsigned seed) {
+    std::vector<std::string> lines;
+    if (!read_lines(tracePath, &lines)) return 1;
+    FILE* fp = fopen(path, "w");
+    if (!fp) {
+        perror(path);
+        return 1;
+    }
+    uint32_t ticks = 0;
+    for (const std::string& l : lines) {
+        if (l.compare(0, 2, "0 ") == 0) ticks++;
+    }
+    fprintf(fp, "# scenario_trace digest: demo, tick, then a hash per field\n");
+    fprintf(fp, "# ticks %lu seed %u\n", (unsigned long)ticks, seed);
+    for (const std::string& l : lines) {
+        std::string d = digest_line(l);
+        if (d.empty()) {
+            fprintf(stderr, "%s: not a trace line: %s", tracePath, l.c_str());
+            fclose(fp);
+            return 1;
+        }
+        fprintf(fp, "%s\n", d.c_str());
+    }
+    if (fclose(fp) != 0) return 1;
+    printf("%s: %lu lines, %lu ticks per demo\n", path, (unsigned long)lines.size(), (unsigned long)ticks);
+    return 0;
+}
+
+static int golden(const char* path) {
+    std::vector<std::string> want, now;
+    if (!read_lines(path, &want)) return 1;
+    unsigned long ticks = 0;
+    unsigned seed = 1;
+    for (const std::string& l : want) {
+        if (sscanf(l.c_str(), "# ticks %lu seed %u", &ticks, &seed) == 2) break;
+    }
+    want.erase(std::remove_if(want.begin(), want.end(),
+                              [](const std::string& l) { return l[0] == '#'; }),
+               want.end());
+    const char* tmp = "scenario_trace.now";
+    bool ok = ticks > 0 && trace_to_file(tmp, (uint32_t)ticks, seed) && read_lines(tmp, &now);
+    remove(tmp);
+    if (!ok) {
+        printf("checks FAILED\n");
+        return 1;
+    }
+
+    uint32_t diffs = 0;
+    size_t n = want.size() > now.size() ? want.size() : now.size();
+    for (size_t i = 0; i < n; i++) {
+        std::string w = i < want.size() ? want[i] : std::string();
+        if (!w.empty() && w.back() == '\n') w.pop_back();
+        std::string d = i < now.size() ? digest_line(now[i]) : std::string();
+        if (w == d) continue;
+        if (diffs == 0) {
+            // Hashes after "demo tick" line up with the trace fields after the first
+            std::vector<std::string> f = i < now.size() ? fields(now[i]) : std::vector<std::string>();
+            std::vector<std::string> wt = split_words(w), dt = split_words(d);
+            size_t k = 2;
+            while (k < wt.size() && k < dt.size() && wt[k] == dt[k]) k++;
+            printf("  first difference at line %lu (demo tick \"%s\"): %s\n", (unsigned long)i + 1,
+                   f.empty() ? "-" : f[0].c_str(), k - 1 < f.size() ? f[k - 1].c_str() : "(missing)");
+        }
+        diffs++;
+    }
+    printf("%s: %lu ticks per demo, seed %u, %lu lines, %lu differ\n", path, ticks, seed,
+           (unsigned long)want.size(), (unsigned long)diffs);
+    printf("%s\n", diffs ? "checks FAILED" : "all checks passed");
+    return diffs ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: scenario_trace run|write <file>|check <file> [-t ticks] [-s seed]\n"
+                        "       scenario_trace digest <trace> <digest file>|golden <digest file>\n");
+        return 2;
+    }
+    const char* mode = argv[1];
+    const char* path = NULL;
+    int a = 2;
+    if (strcmp(mode, "run") != 0) {
+        if (argc < 3) {
+            fprintf(stderr, "%s needs a file\n", mode);
+            return 2;
+        }
+        path = argv[2];
+        a = 3;
+    }
+    const char* out = NULL;
+    if (strcmp(mode, "digest") == 0) {
+        if (argc < 4) {
+            fprintf(stderr, "digest needs a trace and a digest file\n");
+            return 2;
+        }
+        out = argv[3];
+        a = 4;
+    }
+    uint32_t ticks = 1100;
+    unsigned seed = 1;
+    for (; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-t") == 0) ticks = (uint32_t)atol(argv[a + 1]);
+        else if (strcmp(argv[a], "-s") == 0) seed = (unsigned)atol(argv[a + 1]);
+    }
+
+    if (strcmp(mode, "run") == 0) return run(ticks, seed);
+    if (strcmp(mode, "write") == 0) {
+        if (!trace_to_file(path, ticks, seed)) return 1;
+        printf("%s: %u demos x %lu ticks, seed %u\n", path, DEMO_COUNT, (unsigned long)ticks, seed);
+        return 0;
+    }
+    if (strcmp(mode, "check") == 0) return check(path, ticks, seed);
+    if (strcmp(mode, "digest") == 0) return digest(path, out, seed);
+    if (strcmp(mode, "golden") == 0) return golden(path);
+    fprintf(stderr, "unknown mode %s\n", mode);
+    return 2;
+}
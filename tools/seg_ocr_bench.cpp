@@ -0,0 +1,489 @@
+// SIGNALTAP Seven-Segment OCR Bench (host)
+// Scores the seven-segment reader (src/vision/seg_ocr) on labeled 1280x720
+// frames at 30 fps: the two displays of src/vision/vision_rois.h (a red LED
+// part counter and a green LED error code, both in perspective and
+// slanted) plus an LCD counter, dark segments on a light glass. The
+// counters step every 6-12 frames and the error code every second or so;
+// frames get exposure changes, sensor noise, a slight blur, unlit
+// segments that still show faintly, occasional glare, and the frame at
+// each change shows the old and new digits at once (a change mid-
+// exposure). The frames are rendered in memory, or read from a labeled
+// image set: PPM files plus labels.txt, as written by `write`.
+//
+// Reports per display how often a single frame reads right, and for the
+// voted readings the frames they were wrong or late (more than
+// SEG_VOTE_MIN + 1 frames after a change) and any reading that was never
+// on the display at all; then the per-frame cost of all displays against
+// the 33.3 ms frame interval.
+//
+// Build: make -C tools seg_ocr_bench (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage:
+//   seg_ocr_bench run [-n frames (3000)] [dir]
+//   seg_ocr_bench write <dir> [-n frames (300)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include "../src/vision/seg_ocr.h"
+#include "../src/vision/vision_rois.h"
+
+#define FRAME_W         1280
+#define FRAME_H         720
+#define FPS             30
+#define DISPLAYS        3
+#define LABELS_FILE     "labels.txt"
+
+// The device's two displays and an LCD counter
+static SegDisplayDef_t defs[DISPLAYS];
+
+static void setup_defs(void) {
+    defs[0] = segDisplays[0];
+    defs[1] = segDisplays[1];
+    const SegDisplayDef_t lcd = {{{100, 470}, {380, 462}, {384, 560}, {104, 576}}, 4, 2,
+                                 SEG_PART_COUNT, 1, 0};
+    defs[2] = lcd;
+}
+
+// ============ Helper: Random ============
+static uint32_t rng = 0x9E3779B9;
+
+static uint32_t xorshift(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint8_t clamp8(int v) {
+    return (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+// ============ Labels ============
+// What the displays show in a frame, and whether it is a change frame
+typedef struct {
+    char text[DISPLAYS][SEG_MAX_DIGITS + 1];
+    char prev[DISPLAYS][SEG_MAX_DIGITS + 1];
+    bool mixed[DISPLAYS];
+    bool glare;
+} Scene_t;
+
+static const char* const errorCodes[] = {"E07", "E12", "---", "   ", "A03", "F21", "Er5", "H 4"};
+
+typedef struct {
+    uint16_t count[2];
+    uint8_t hold[2];
+    uint8_t code;
+    uint8_t codeHold;
+} Script_t;
+
+static void script_init(Script_t* s) {
+    s->count[0] = 137;
+    s->count[1] = 9990;
+    s->hold[0] = s->hold[1] = 1;
+    s->code = 0;
+    s->codeHold = 1;
+}
+
+static void script_next(Script_t* s, Scene_t* sc) {
+    for (int i = 0; i < DISPLAYS; i++) {
+        memcpy(sc->prev[i], sc->text[i], sizeof(sc->text[i]));
+        sc->mixed[i] = false;
+    }
+    for (int c = 0; c < 2; c++) {
+        if (--s->hold[c] == 0) {
+            s->count[c] = (uint16_t)((s->count[c] + 1) % 10000);
+            s->hold[c] = (uint8_t)(6 + xorshift() % 7);
+        }
+    }
+    if (--s->codeHold == 0) {
+        s->code = (uint8_t)((s->code + 1 + xorshift() % 3) % (sizeof(errorCodes) / sizeof(errorCodes[0])));
+        s->codeHold = (uint8_t)(20 + xorshift() % 30);
+    }
+    // Part counter without leading zeros, the LCD with
+    snprintf(sc->text[0], sizeof(sc->text[0]), "%4u", s->count[0]);
+    snprintf(sc->text[1], sizeof(sc->text[1]), "%s", errorCodes[s->code]);
+    snprintf(sc->text[2], sizeof(sc->text[2]), "%04u", s->count[1]);
+    for (int i = 0; i < DISPLAYS; i++) {
+        sc->mixed[i] = sc->prev[i][0] && strcmp(sc->prev[i], sc->text[i]) != 0;
+    }
+    sc->glare = xorshift() % 100 < 4;
+}
+
+// The reading a label should give
+static void expected(int display, const char* label, char* out) {
+    if (defs[display].target == SEG_PART_COUNT) {
+        strcpy(out, label);
+        return;
+    }
+    while (*label == ' ') label++;
+    strcpy(out, label);
+    size_t n = strlen(out);
+    while (n && out[n - 1] == ' ') out[--n] = '\0';
+    if (n == 0) strcpy(out, "---");
+}
+
+// ============ Rendering ============
+typedef struct {
+    float m[9];     // Unit square -> image
+    float inv[9];   // Image -> unit square
+} Warp_t;
+
+static void warp_init(const SegDisplayDef_t* def, Warp_t* w) {
+    float x0 = def->quad[0][0], y0 = def->quad[0][1], x1 = def->quad[1][0], y1 = def->quad[1][1];
+    float x2 = def->quad[2][0], y2 = def->quad[2][1], x3 = def->quad[3][0], y3 = def->quad[3][1];
+    float dx1 = x1 - x2, dx2 = x3 - x2, dx3 = x0 - x1 + x2 - x3;
+    float dy1 = y1 - y2, dy2 = y3 - y2, dy3 = y0 - y1 + y2 - y3;
+    float det = dx1 * dy2 - dx2 * dy1;
+    float g = (dx3 * dy2 - dx2 * dy3) / det, h = (dx1 * dy3 - dx3 * dy1) / det;
+    float* m = w->m;
+    m[0] = x1 - x0 + g * x1; m[1] = x3 - x0 + h * x3; m[2] = x0;
+    m[3] = y1 - y0 + g * y1; m[4] = y3 - y0 + h * y3; m[5] = y0;
+    m[6] = g;                m[7] = h;                m[8] = 1.0f;
+    float* v = w->inv;
+    v[0] = m[4] * m[8] - m[5] * m[7]; v[1] = m[2] * m[7] - m[1] * m[8]; v[2] = m[1] * m[5] - m[2] * m[4];
+    v[3] = m[5] * m[6] - m[3] * m[8]; v[4] = m[0] * m[8] - m[2] * m[6]; v[5] = m[2] * m[3] - m[0] * m[5];
+    v[6] = m[3] * m[7] - m[4] * m[6]; v[7] = m[1] * m[6] - m[0] * m[7]; v[8] = m[0] * m[4] - m[1] * m[3];
+}
+
+// Segment bars in a digit cell, as the renderer draws them
+static const float bars[7][4] = {
+    {0.24f, 0.03f, 0.76f, 0.13f},   // a: x0, y0, x1, y1
+    {0.76f, 0.10f, 0.88f, 0.47f},   // b
+    {0.76f, 0.53f, 0.88f, 0.90f},   // c
+    {0.24f, 0.87f, 0.76f, 0.97f},   // d
+    {0.12f, 0.53f, 0.24f, 0.90f},   // e
+    {0.12f, 0.10f, 0.24f, 0.47f},   // f
+    {0.24f, 0.45f, 0.76f, 0.55f},   // g
+};
+
+// Which segment (0-6) a point of the display is on, -1 for none
+static int segment_at(const SegDisplayDef_t* def, float u, float v, int* digit) {
+    float cell = u * def->digits;
+    int k = (int)cell;
+    if (k < 0 || k >= def->digits || v < 0.0f || v > 1.0f) return -1;
+    float x = cell - k - def->slantPct * 0.01f * (0.5f - v);
+    *digit = k;
+    for (int s = 0; s < 7; s++) {
+        if (x >= bars[s][0] && x <= bars[s][2] && v >= bars[s][1] && v <= bars[s][3]) return s;
+    }
+    return -1;
+}
+
+static void render_display(uint8_t* rgb, int i, const Warp_t* w, const Scene_t* sc, int gain) {
+    const SegDisplayDef_t* def = &defs[i];
+    static const int ledOn[2][3] = {{255, 40, 30}, {40, 255, 90}};
+    int bg[3], on[3], off[3];
+    if (def->dark) {
+        int b[3] = {168, 178, 156}, o[3] = {38, 44, 40}, f[3] = {150, 160, 140};
+        memcpy(bg, b, sizeof(bg)); memcpy(on, o, sizeof(on)); memcpy(off, f, sizeof(off));
+    } else {
+        const int* c = ledOn[i == 1];
+        for (int k = 0; k < 3; k++) {
+            bg[k] = 22;
+            on[k] = c[k];
+            off[k] = 22 + c[k] / 7;
+        }
+    }
+    uint8_t masks[SEG_MAX_DIGITS];
+    for (int k = 0; k < def->digits; k++) {
+        masks[k] = seg_encode(sc->text[i][k]);
+        if (sc->mixed[i]) masks[k] |= seg_encode(sc->prev[i][k]);
+    }
+
+    int x0 = FRAME_W, y0 = FRAME_H, x1 = 0, y1 = 0;
+    for (int c = 0; c < 4; c++) {
+        if (def->quad[c][0] < x0) x0 = def->quad[c][0];
+        if (def->quad[c][0] > x1) x1 = def->quad[c][0];
+        if (def->quad[c][1] < y0) y0 = def->quad[c][1];
+        if (def->quad[c][1] > y1) y1 = def->quad[c][1];
+    }
+    const float* v = w->inv;
+    for (int y = y0 - 8; y <= y1 + 8; y++) {
+        for (int x = x0 - 8; x <= x1 + 8; x++) {
+            float z = v[6] * x + v[7] * y + v[8];
+            float u = (v[0] * x + v[1] * y + v[2]) / z, t = (v[3] * x + v[4] * y + v[5]) / z;
+            uint8_t* p = rgb + 3 * (y * FRAME_W + x);
+            if (u < -0.02f || u > 1.02f || t < -0.06f || t > 1.06f) continue;
+            int digit, s = segment_at(def, u, t, &digit);
+            const int* c = s < 0 ? bg : (masks[digit] >> s) & 1 ? on : off;
+            for (int k = 0; k < 3; k++) p[k] = clamp8(c[k] * gain / 100);
+        }
+    }
+
+    // Slight blur: the lens is never quite in focus
+    for (int y = y0 - 6; y <= y1 + 6; y++) {
+        for (int x = x0 - 6; x <= x1 + 6; x++) {
+            uint8_t* p = rgb + 3 * (y * FRAME_W + x);
+            for (int k = 0; k < 3; k++) p[k] = (uint8_t)((p[k] * 2 + p[k + 3] + p[k + 3 * FRAME_W]) / 4);
+        }
+    }
+
+    if (sc->glare) {
+        int gx = x0 + (int)(xorshift() % (uint32_t)(x1 - x0)), gy = y0 + (int)(xorshift() % (uint32_t)(y1 - y0));
+        for (int y = gy - 24; y <= gy + 24; y++) {
+            for (int x = gx - 24; x <= gx + 24; x++) {
+                int d2 = (x - gx) * (x - gx) + (y - gy) * (y - gy);
+                if (d2 > 576 || x < 0 || y < 0 || x >= FRAME_W || y >= FRAME_H) continue;
+                uint8_t* p = rgb + 3 * (y * FRAME_W + x);
+                for (int k = 0; k < 3; k++) p[k] = clamp8(p[k] + 140 * (576 - d2) / 576);
+            }
+        }
+    }
+}
+
+static void render_frame(uint8_t* rgb, const Warp_t* warps, const Scene_t* sc) {
+    for (int y = 0; y < FRAME_H; y++) {
+        uint8_t* p = rgb + 3 * y * FRAME_W;
+        for (int x = 0; x < FRAME_W; x++, p += 3) p[0] = p[1] = p[2] = (uint8_t)(60 + 50 * y / FRAME_H);
+    }
+    int gain = 80 + (int)(xorshift() % 31);
+    for (int i = 0; i < DISPLAYS; i++) render_display(rgb, i, &warps[i], sc, gain);
+    for (int i = 0; i < FRAME_W * FRAME_H * 3; i++) {
+        if ((i & 7) == 0) rgb[i] = clamp8(rgb[i] + (int)(xorshift() % 25) - 12);
+    }
+}
+
+// BT.601 full range, chroma of each pixel pair averaged
+static void rgb_to_yuyv(const uint8_t* rgb, uint8_t* yuyv, int w, int h) {
+    for (int i = 0; i < w * h; i += 2, rgb += 6, yuyv += 4) {
+        int r = rgb[0] + rgb[3], g = rgb[1] + rgb[4], b = rgb[2] + rgb[5];
+        yuyv[0] = clamp8((77 * rgb[0] + 150 * rgb[1] + 29 * rgb[2]) >> 8);
+        yuyv[2] = clamp8((77 * rgb[3] + 150 * rgb[4] + 29 * rgb[5]) >> 8);
+        yuyv[1] = clamp8(((-43 * r - 85 * g + 128 * b) >> 9) + 128);
+        yuyv[3] = clamp8(((128 * r - 107 * g - 21 * b) >> 9) + 128);
+    }
+}
+
+// ============ PPM files ============
+static bool write_ppm(const char* path, const uint8_t* rgb) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P6\n%d %d\n255\n", FRAME_W, FRAME_H);
+    bool ok = fwrite(rgb, 3, (size_t)FRAME_W * FRAME_H, f) == (size_t)FRAME_W * FRAME_H;
+    return fclose(f) == 0 && ok;
+}
+
+static bool read_ppm(const char* path, uint8_t* rgb) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    int w = 0, h = 0, max = 0;
+    bool ok = fscanf(f, "P6 %d %d %d", &w, &h, &max) == 3 && fgetc(f) != EOF &&
+              w == FRAME_W && h == FRAME_H && max == 255 &&
+              fread(rgb, 3, (size_t)w * h, f) == (size_t)w * h;
+    fclose(f);
+    return ok;
+}
+
+// ============ Modes ============
+static int cmd_write(const char* dir, int frames) {
+    Warp_t warps[DISPLAYS];
+    for (int i = 0; i < DISPLAYS; i++) warp_init(&defs[i], &warps[i]);
+    std::vector<uint8_t> rgb(FRAME_W * FRAME_H * 3);
+    std::string labelsPath = std::string(dir) + "/" + LABELS_FILE;
+    FILE* labels = fopen(labelsPath.c_str(), "w");
+    if (!labels) {
+        fprintf(stderr, "%s: cannot write\n", labelsPath.c_str());
+        return 1;
+    }
+    Script_t script;
+    Scene_t sc;
+    memset(&sc, 0, sizeof(sc));
+    script_init(&script);
+    for (int f = 0; f < frames; f++) {
+        script_next(&script, &sc);
+        render_frame(rgb.data(), warps, &sc);
+        char name[64], path[512];
+        snprintf(name, sizeof(name), "frame_%05d.ppm", f);
+        snprintf(path, sizeof(path), "%s/%s", dir, name);
+        if (!write_ppm(path, rgb.data())) {
+            fprintf(stderr, "%s: cannot write\n", path);
+            fclose(labels);
+            return 1;
+        }
+        fprintf(labels, "%s|%s|%s|%s\n", name, sc.text[0], sc.text[1], sc.text[2]);
+    }
+    fclose(labels);
+    printf("%d labeled frames written to %s\n", frames, dir);
+    return 0;
+}
+
+typedef struct {
+    uint32_t rawRight;          // Single frames read right
+    uint32_t settled;           // Frames at least SEG_VOTE_MIN + 1 after a change
+    uint32_t settledWrong;      // ... with the reading not yet (or not) the label
+    uint32_t readings;
+    uint32_t falseReadings;     // Readings that were never on the display
+    uint32_t latencyFrames;     // Change -> reading, summed
+    uint32_t changes;
+} Score_t;
+
+static int cmd_run(const char* dir, int frames) {
+    Warp_t warps[DISPLAYS];
+    for (int i = 0; i < DISPLAYS; i++) warp_init(&defs[i], &warps[i]);
+    std::vector<uint8_t> rgb(FRAME_W * FRAME_H * 3), yuyv(FRAME_W * FRAME_H * 2);
+
+    std::vector<std::string> files;
+    std::vector<Scene_t> scenes;
+    if (dir) {
+        std::string labelsPath = std::string(dir) + "/" + LABELS_FILE;
+        FILE* labels = fopen(labelsPath.c_str(), "r");
+        if (!labels) {
+            fprintf(stderr, "%s: cannot open\n", labelsPath.c_str());
+            return 1;
+        }
+        char line[256];
+        while (fgets(line, sizeof(line), labels)) {
+            line[strcspn(line, "\r\n")] = '\0';
+            char* field[DISPLAYS + 1];
+            int n = 0;
+            for (char* p = line; n <= DISPLAYS; n++) {
+                field[n] = p;
+                p = strchr(p, '|');
+                if (!p) {
+                    n++;
+                    break;
+                }
+                *p++ = '\0';
+            }
+            if (n != DISPLAYS + 1) continue;
+            Scene_t sc;
+            memset(&sc, 0, sizeof(sc));
+            for (int i = 0; i < DISPLAYS; i++) snprintf(sc.text[i], sizeof(sc.text[i]), "%s", field[i + 1]);
+            files.push_back(std::string(dir) + "/" + field[0]);
+            scenes.push_back(sc);
+        }
+        fclose(labels);
+        frames = (int)files.size();
+        if (frames == 0) {
+            fprintf(stderr, "%s: no labeled frames\n", labelsPath.c_str());
+            return 1;
+        }
+    }
+
+    static SegOcr_t ocr;
+    seg_ocr_init(&ocr, defs, DISPLAYS, FRAME_W, FRAME_H, FRAME_W * 2, FPS);
+    Script_t script;
+    Scene_t sc;
+    memset(&sc, 0, sizeof(sc));
+    script_init(&script);
+
+    Score_t score[DISPLAYS];
+    memset(score, 0, sizeof(score));
+    char shown[DISPLAYS][SEG_VOTE_FRAMES + 8][SEG_MAX_DIGITS + 4];    // Recent expected readings
+    int since[DISPLAYS];
+    char lastText[DISPLAYS][SEG_MAX_DIGITS + 4];
+    memset(shown, 0, sizeof(shown));
+    memset(lastText, 0, sizeof(lastText));
+    for (int i = 0; i < DISPLAYS; i++) since[i] = 0;
+    double totalUs = 0, maxUs = 0, displayUs[DISPLAYS] = {0};
+
+    for (int f = 0; f < frames; f++) {
+        if (dir) {
+            if (!read_ppm(files[f].c_str(), rgb.data())) {
+                fprintf(stderr, "%s: not a %dx%d P6 frame\n", files[f].c_str(), FRAME_W, FRAME_H);
+                return 1;
+            }
+            for (int i = 0; i < DISPLAYS; i++) memcpy(sc.prev[i], sc.text[i], sizeof(sc.text[i]));
+            for (int i = 0; i < DISPLAYS; i++) memcpy(sc.text[i], scenes[f].text[i], sizeof(sc.text[i]));
+        } else {
+            script_next(&script, &sc);
+            render_frame(rgb.data(), warps, &sc);
+        }
+        rgb_to_yuyv(rgb.data(), yuyv.data(), FRAME_W, FRAME_H);
+
+        seg_ocr_process(&ocr, yuyv.data(), (uint32_t)(f * 1000 / FPS));
+        const SegStats_t* st = seg_ocr_get_stats(&ocr);
+        totalUs += st->lastUs;
+        if (st->lastUs > maxUs) maxUs = st->lastUs;
+
+        for (int i = 0; i < DISPLAYS; i++) {
+            Score_t* s = &score[i];
+            char want[SEG_MAX_DIGITS + 4];
+            expected(i, sc.text[i], want);
+            if (strcmp(want, shown[i][0]) != 0) {
+                memmove(shown[i][1], shown[i][0], sizeof(shown[i]) - sizeof(shown[i][0]));
+                strcpy(shown[i][0], want);
+                if (f > 0) s->changes++;
+                since[i] = 0;
+            } else {
+                since[i]++;
+            }
+            if (strcmp(seg_ocr_raw(&ocr, (uint8_t)i), sc.text[i]) == 0) s->rawRight++;
+
+            const char* reading = seg_ocr_text(&ocr, (uint8_t)i);
+            if (strcmp(reading, lastText[i]) != 0) {
+                s->readings++;
+                bool seen = false;
+                for (int k = 0; k < SEG_VOTE_FRAMES + 8; k++) seen |= strcmp(shown[i][k], reading) == 0;
+                if (!seen) s->falseReadings++;
+                if (strcmp(reading, want) == 0 && f > 0) s->latencyFrames += since[i];
+                strcpy(lastText[i], reading);
+            }
+            if (since[i] > SEG_VOTE_MIN) {
+                s->settled++;
+                if (strcmp(reading, want) != 0) s->settledWrong++;
+            }
+        }
+    }
+
+    // Cost of one display alone, on the last frame
+    for (int i = 0; i < DISPLAYS; i++) {
+        static SegOcr_t one;
+        seg_ocr_init(&one, &defs[i], 1, FRAME_W, FRAME_H, FRAME_W * 2, FPS);
+        struct timespec a, b;
+        clock_gettime(CLOCK_MONOTONIC, &a);
+        for (int k = 0; k < 1000; k++) seg_ocr_process(&one, yuyv.data(), (uint32_t)k);
+        clock_gettime(CLOCK_MONOTONIC, &b);
+        displayUs[i] = ((b.tv_sec - a.tv_sec) * 1e6 + (b.tv_nsec - a.tv_nsec) / 1e3) / 1000.0;
+    }
+
+    static const char* names[DISPLAYS] = {"part counter (red LED)", "error code (green LED)", "counter (LCD)"};
+    printf("%d frames %dx%d%s, %d displays\n", frames, FRAME_W, FRAME_H, dir ? " from files" : " rendered", DISPLAYS);
+    int bad = 0;
+    for (int i = 0; i < DISPLAYS; i++) {
+        const Score_t* s = &score[i];
+        printf("  %-24s single frame %5.1f%% right | %lu readings, %lu never shown, "
+               "settled frames wrong %lu/%lu, latency %.1f frames | %.2f us/frame\n",
+               names[i], s->rawRight * 100.0 / frames, (unsigned long)s->readings,
+               (unsigned long)s->falseReadings, (unsigned long)s->settledWrong,
+               (unsigned long)s->settled, s->changes ? (double)s->latencyFrames / s->changes : 0.0,
+               displayUs[i]);
+        bad += (int)(s->falseReadings + s->settledWrong);
+    }
+    const SegStats_t* st = seg_ocr_get_stats(&ocr);
+    printf("all displays: %.2f us/frame avg, %.0f max (%.3f%% of the %.1f ms frame interval), "
+           "%lu display-frames rejected\n", totalUs / frames, maxUs, totalUs / frames * 100.0 / (1e6 / FPS),
+           1000.0 / FPS, (unsigned long)st->rejected);
+    return bad ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s run [-n frames] [dir] | write <dir> [-n frames]\n", argv[0]);
+        return 2;
+    }
+    setup_defs();
+    bool write = strcmp(argv[1], "write") == 0;
+    int frames = write ? 300 : 3000;
+    const char* dir = NULL;
+    for (int a = 2; a < argc; a++) {
+        if (strcmp(argv[a], "-n") == 0 && a + 1 < argc) frames = atoi(argv[++a]);
+        else dir = argv[a];
+    }
+    if (write) {
+        if (!dir) {
+            fprintf(stderr, "write: no directory\n");
+            return 2;
+        }
+        return cmd_write(dir, frames);
+    }
+    if (strcmp(argv[1], "run") != 0) {
+        fprintf(stderr, "unknown command %s\n", argv[1]);
+        return 2;
+    }
+    return cmd_run(dir, frames);
+}
@@ -0,0 +1,111 @@
+// SIGNALTAP Simulated Time Bench (host)
+// Headless fast-forward through sim_step() (src/data/simulation_engine), no
+// wall clock involved.
+//  - Steps: sub-tick steps carry their remainder (3 x 400 ms is one tick,
+//    the rest waits for the next call), a batch runs n x dt worth of ticks
+//    and the clock follows
+//  - Field values: a sensor fed through sim_set_field_value is held for
+//    SIM_FIELD_STALE_S simulated seconds inside one batch, then falls back to
+//    the physics with ALARM_SYS_FIELDBUS_LOST raised; a fresh value clears it
+//  - Fast-forward: -h simulated hours per demo in batches of one hour; us
+//    per tick and simulated hours per wall-clock second
+//
+// Build: make -C tools sim_bench (tools/Makefile, against tools/host/Arduino.h)
+// Run it from a scratch directory: the simulation's store writes there.
+//
+// Usage: sim_bench [-h simulated hours per demo (6)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/data/simulation_engine.h"
+
+#define FIELD_VALUE     12.5f   // Inside the CNC spindle load range
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t failures = 0;
+
+static void fail(const char* what) {
+    if (failures < 10) printf("  FAILED: %s (clock %lu s)\n", what, (unsigned long)sim_get_clock());
+    failures++;
+}
+
+static bool field_lost(void) {
+    return alarm_is_active(sim_get_alarm_table(), ALARM_SYS_FIELDBUS_LOST);
+}
+
+// ============ Steps ============
+static void steps(void) {
+    sim_init();
+    sim_set_demo(0);
+    uint32_t c0 = sim_get_clock();
+    uint32_t ran = sim_step(400, 3);
+    if (ran != 1 || sim_get_clock() != c0 + 1) fail("3 x 400 ms is not one tick");
+    ran = sim_step(400, 1);
+    if (ran != 0) fail("a sub-tick remainder ran a tick");
+    ran = sim_step(400, 1);
+    if (ran != 1 || sim_get_clock() != c0 + 2) fail("the remainder was not carried");
+    ran = sim_step(SIM_TICK_MS, 3600);
+    if (ran != 3600 || sim_get_clock() != c0 + 3602) fail("an hour batch");
+    printf("steps: remainders carried, a %lu-tick batch moves the clock %lu s\n",
+           (unsigned long)ran, (unsigned long)(sim_get_clock() - c0 - 2));
+}
+
+// ============ Field values ============
+static void field(void) {
+    sim_init();
+    sim_set_demo(0);
+    const DemoProfile_t* demo = sim_get_demo();
+    sim_set_field_value(0, 0, FIELD_VALUE);
+    sim_step(SIM_TICK_MS, SIM_FIELD_STALE_S);
+    if (demo->sensors[0].value != FIELD_VALUE) fail("fresh field value not applied");
+    if (field_lost()) fail("fieldbus lost while fresh");
+    sim_step(SIM_TICK_MS, 1);
+    if (!field_lost()) fail("field value not stale after SIM_FIELD_STALE_S inside one batch");
+    sim_step(SIM_TICK_MS, 10);
+    if (demo->sensors[0].value == FIELD_VALUE) fail("stale field value still held");
+    sim_set_field_value(0, 0, FIELD_VALUE);
+    sim_step(SIM_TICK_MS, 1);
+    if (field_lost() || demo->sensors[0].value != FIELD_VALUE) fail("fresh field value not taken back");
+    printf("field: held %u simulated s in one batch, then lost and back\n", SIM_FIELD_STALE_S);
+}
+
+// ============ Fast-forward ============
+static void fast_forward(uint32_t hours) {
+    sim_init();
+    double worst = 0;
+    for (uint8_t d = 0; d < DEMO_COUNT; d++) {
+        sim_set_demo(d);
+        uint32_t c0 = sim_get_clock();
+        double t = now_ns();
+        uint32_t ticks = 0;
+        for (uint32_t h = 0; h < hours; h++) ticks += sim_step(SIM_TICK_MS, 3600);
+        double ns = now_ns() - t;
+        if (ticks != hours * 3600 || sim_get_clock() - c0 != hours * 3600) fail("fast-forward ticks");
+        double perTick = ns / ticks;
+        if (perTick > worst) worst = perTick;
+        printf("  %-24s %lu h: %6.1f us/tick, %6.1f simulated h per wall s (%.0fx)\n",
+               sim_get_demo()->name, (unsigned long)hours, perTick / 1e3,
+               hours / (ns / 1e9), SIM_TICK_MS * 1e6 / perTick);
+    }
+    printf("fast-forward: slowest demo %.1f simulated h per wall s\n", 1e9 / worst / 3600);
+}
+
+int main(int argc, char** argv) {
+    uint32_t hours = 6;
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-h") == 0) hours = (uint32_t)atol(argv[a + 1]);
+    }
+    steps();
+    field();
+    printf("fast-forward, %lu simulated h per demo in 1 h batches:\n", (unsigned long)hours);
+    fast_forward(hours);
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,335 @@
+// SIGNALTAP Spool Bench (host)
+// Runs the headless simulation through the telemetry publisher with a
+// spool attached, cuts the uplink for hours of simulated time and reports
+// how the spool held up and how fast the backlog drained afterwards. Time
+// is simulated: every sim second is 100 loop passes of 10 ms, each pass
+// doing what the device loop does (spool service - the background task on
+// the device -, MQTT poll, backlog drain), so the drain time in loop
+// passes is what the device would see, while the wall time shows what the
+// host and broker can carry. The spool file is a plain file in the working
+// directory (the host flash image), recreated each run.
+//
+// check needs no broker: numbered records, one per simulated second, go
+// straight into the spool through an outage long enough to wrap the ring,
+// with the writer stalled for CHECK_STALL_S in the middle; then one bit
+// of a page in the backlog is flipped in the file, and the backlog is
+// drained over a link that drops one batch in CHECK_DROP_ONE_IN. Exit 1
+// unless every record drained is intact and in order, drained equals
+// pushed less the records lost to the wrap and in the corrupt page, the
+// records missing are exactly those, and a reopened spool has nothing
+// left to send.
+//
+// Build: make -C tools spool_bench (tools/Makefile, against tools/host/Arduino.h)
+// Run it from a scratch directory: the simulation's store writes there.
+//
+// Usage:
+//   spool_bench [-o outage hours (3)] [-l live minutes (5)] [-d demo (0)] <host> [port]
+//   spool_bench check [-o outage hours (6)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <poll.h>
+#include "../config.h"
+#include "../src/net/mqtt_client.h"
+#include "../src/net/telemetry.h"
+#include "../src/storage/telemetry_spool.h"
+#include "../src/data/simulation_engine.h"
+
+#define BENCH_SPOOL_FILE    "/spool_bench.dat"
+#define BENCH_PASSES        100     // Loop passes per simulated second
+#define BENCH_PASS_MS       10
+#define CHECK_STALL_S       120     // Writer stalled this long mid-outage: both stage pages fill
+#define CHECK_DROP_ONE_IN   8       // Drain batches lost to the link
+
+static MqttClient_t mqtt;
+static Telemetry_t telem;
+static Spool_t spool;
+static uint32_t simS;
+
+// One device loop pass at simulated time nowMs
+static void loop_pass(uint32_t nowMs, bool linkUp) {
+    spool_service(&spool);
+    if (!linkUp) return;
+    mqtt_poll(&mqtt, nowMs);
+    telem_drain(&telem);
+    // Give the broker the CPU while the socket is backed up
+    if (mqtt.open && mqtt_queued(&mqtt) > MQTT_QUEUE_BYTES / 4) {
+        struct pollfd p = {mqtt.fd, POLLOUT, 0};
+        poll(&p, 1, 1);
+    }
+}
+
+// One simulated second: tick, then the loop passes until the next
+static void sim_second(bool linkUp) {
+    sim_step(1000, 1);
+    simS++;
+    telem_tick(&telem, true, simS * 1000UL);
+    for (int i = 0; i < (linkUp ? BENCH_PASSES : 1); i++) {
+        loop_pass(simS * 1000UL + i * BENCH_PASS_MS, linkUp);
+    }
+}
+
+// ============ Check (no broker) ============
+static uint32_t failures = 0;
+
+static void fail(const char* what) {
+    if (failures < 10) printf("  FAILED: %s\n", what);
+    failures++;
+}
+
+static uint32_t rngState = 0x2545F491;
+
+static uint32_t rng(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+// Record seq: its number, then bytes that follow from it (sensors-message sized)
+static uint16_t make_record(uint32_t seq, uint8_t* out) {
+    uint16_t len = (uint16_t)(64 + seq % 180);
+    memcpy(out, &seq, 4);
+    for (uint16_t i = 4; i < len; i++) out[i] = (uint8_t)(seq * 31 + i);
+    return len;
+}
+
+static bool record_ok(const uint8_t* rec, uint16_t len, uint32_t count, uint32_t* seq) {
+    uint8_t want[256];
+    if (len < 4) return false;
+    memcpy(seq, rec, 4);
+    return *seq < count && make_record(*seq, want) == len && memcmp(want, rec, len) == 0;
+}
+
+static int check(float outageH) {
+    uint32_t count = (uint32_t)(outageH * 3600.0f);
+    uint8_t* state = (uint8_t*)calloc(count, 1);    // 1 accepted, 2 also drained
+    ts_flash_remove(BENCH_SPOOL_FILE);
+    if (!state || !spool_open(&spool, BENCH_SPOOL_FILE)) {
+        fprintf(stderr, "%s: cannot open\n", BENCH_SPOOL_FILE);
+        return 1;
+    }
+    const SpoolStats_t* st = spool_get_stats(&spool);
+
+    // Outage: the producer pushes, the writer keeps up except for one stall
+    uint8_t rec[256];
+    uint32_t stallAt = count / 2;
+    for (uint32_t s = 0; s < count; s++) {
+        uint16_t len = make_record(s, rec);
+        if (spool_push(&spool, rec, len, s * 1000UL)) state[s] = 1;
+        if (s < stallAt || s >= stallAt + CHECK_STALL_S) spool_service(&spool);
+    }
+    spool_seal(&spool);
+    spool_service(&spool);
+    uint32_t backlog = spool_pending(&spool);
+
+    // One bit flipped in the records of a page halfway through the backlog
+    uint32_t victim = spool.headSeq + (spool.nextSeq - spool.headSeq) / 2;
+    uint32_t base = (victim % SPOOL_PAGES) * SPOOL_PAGE_BYTES;
+    SpoolPageHeader_t h;
+    uint32_t victimFirst = 0;
+    uint8_t b = 0;
+    ts_flash_read(&spool.flash, base, &h, sizeof(h));
+    ts_flash_read(&spool.flash, base + SPOOL_HEADER_BYTES + 2, &victimFirst, sizeof(victimFirst));
+    ts_flash_read(&spool.flash, base + SPOOL_HEADER_BYTES + h.used / 2, &b, 1);
+    b ^= 0x10;
+    ts_flash_write(&spool.flash, base + SPOOL_HEADER_BYTES + h.used / 2, &b, 1);
+    ts_flash_sync(&spool.flash);
+    uint32_t corruptRecords = h.records;
+
+    // Reconnect: one page per batch, some batches lost on the link and resent
+    uint32_t passes = 0, batches = 0, rewinds = 0, bad = 0, order = 0;
+    uint32_t batch[SPOOL_DATA_BYTES / 6];
+    int64_t last = -1;
+    uint32_t t0 = micros();
+    while (spool_pending(&spool) > 0 && passes < 4 * SPOOL_PAGES * CHECK_DROP_ONE_IN) {
+        spool_service(&spool);
+        passes++;
+        const uint8_t* r;
+        uint16_t len;
+        uint32_t n = 0;
+        while (spool_next(&spool, &r, &len)) {
+            if (!record_ok(r, len, count, &batch[n])) bad++;
+            else n++;
+        }
+        if (n == 0) continue;
+        batches++;
+        if (rng() % CHECK_DROP_ONE_IN == 0) {
+            spool_rewind(&spool);
+            rewinds++;
+            continue;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            if ((int64_t)batch[i] <= last || state[batch[i]] != 1) order++;
+            else state[batch[i]] = 2;
+            last = batch[i];
+        }
+        spool_commit(&spool);
+    }
+    double drainMs = (uint32_t)(micros() - t0) / 1e3;
+
+    // What is missing: one run of old records lost to the wrap (the page
+    // loaded for draining when the ring wrapped still goes out first), and
+    // the corrupt page's records
+    uint32_t missingOld = 0, missingVictim = 0, oldRuns = 0, victimSeen = 0;
+    bool inRun = false;
+    for (uint32_t s = 0; s < count; s++) {
+        if (state[s] == 0) continue;
+        bool inVictim = s >= victimFirst && victimSeen < corruptRecords;
+        if (inVictim) {
+            victimSeen++;
+            if (state[s] == 1) missingVictim++;
+            continue;
+        }
+        if (state[s] == 1 && !inRun) oldRuns++;
+        inRun = state[s] == 1;
+        if (inRun) missingOld++;
+    }
+
+    if (bad) fail("records drained with wrong contents");
+    if (order) fail("records drained twice or out of order");
+    if (st->pushed + st->dropped != count) fail("pushed + dropped != records offered");
+    if (st->dropped == 0) fail("no records dropped while the writer stalled");
+    if (st->pagesLost == 0) fail("outage too short to wrap the ring (-o)");
+    if (st->pagesCorrupt != 1) fail("corrupt page not stepped over exactly once");
+    if (st->drainedRecords != st->pushed - st->recordsLost - corruptRecords) {
+        fail("drained != pushed - lost - corrupt");
+    }
+    if (missingOld != st->recordsLost || oldRuns != 1) fail("records missing != one run lost to the wrap");
+    if (missingVictim != corruptRecords) fail("corrupt page's records came through");
+
+    // As after a reboot: the drained marks are on flash
+    SpoolStats_t end = *st;
+    st = &end;
+    spool_close(&spool);
+    if (!spool_open(&spool, BENCH_SPOOL_FILE) || spool_pending(&spool) != 0) {
+        fail("reopened spool has pages left to send");
+    }
+
+    printf("outage %.1f h: %lu records, %lu pushed, %lu dropped (writer stalled %u s), "
+           "%lu pages written, %lu lost to wrap (%lu records)\n",
+           outageH, (unsigned long)count, (unsigned long)st->pushed, (unsigned long)st->dropped,
+           CHECK_STALL_S, (unsigned long)st->pagesWritten, (unsigned long)st->pagesLost,
+           (unsigned long)st->recordsLost);
+    printf("drain: %lu pages, page %lu corrupt (%lu records), %lu batches, %lu resent, "
+           "%lu passes, %.1f ms\n",
+           (unsigned long)backlog, (unsigned long)victim, (unsigned long)corruptRecords,
+           (unsigned long)batches, (unsigned long)rewinds, (unsigned long)passes, drainMs);
+    printf("drained %lu = pushed %lu - lost %lu - corrupt %lu\n",
+           (unsigned long)st->drainedRecords, (unsigned long)st->pushed,
+           (unsigned long)st->recordsLost, (unsigned long)corruptRecords);
+
+    spool_close(&spool);
+    ts_flash_remove(BENCH_SPOOL_FILE);
+    free(state);
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && strcmp(argv[1], "check") == 0) {
+        float hours = 6.0f;
+        for (int a = 2; a + 1 < argc; a += 2) {
+            if (strcmp(argv[a], "-o") == 0) hours = (float)atof(argv[a + 1]);
+        }
+        return check(hours);
+    }
+
+    float outageH = 3.0f;
+    int liveMin = 5, demo = 0;
+    int a = 1;
+    for (; a + 1 < argc && argv[a][0] == '-'; a += 2) {
+        if (argv[a][1] == 'o') outageH = (float)atof(argv[a + 1]);
+        else if (argv[a][1] == 'l') liveMin = atoi(argv[a + 1]);
+        else if (argv[a][1] == 'd') demo = atoi(argv[a + 1]);
+    }
+    if (a >= argc) {
+        fprintf(stderr, "usage: %s [-o outage hours] [-l live minutes] [-d demo] <host> [port]\n", argv[0]);
+        return 2;
+    }
+    uint16_t port = a + 1 < argc ? (uint16_t)atoi(argv[a + 1]) : 1883;
+
+    ts_flash_remove(BENCH_SPOOL_FILE);
+    if (!spool_open(&spool, BENCH_SPOOL_FILE)) {
+        fprintf(stderr, "%s: cannot open\n", BENCH_SPOOL_FILE);
+        return 1;
+    }
+    sim_init();
+    sim_set_demo((uint8_t)demo);
+    mqtt_init(&mqtt, argv[a], port, "spool-bench", NULL, NULL);
+    mqtt.stateMs = 0;       // The client runs on simulated time: connect at once
+    telem_init(&telem, &mqtt, MQTT_TOPIC_ROOT, DEVICE_ID);
+    telem_set_spool(&telem, &spool);
+
+    // Live
+    for (int s = 0; s < liveMin * 60; s++) sim_second(true);
+    if (!mqtt_connected(&mqtt)) {
+        fprintf(stderr, "%s:%u: no session\n", argv[a], port);
+        return 1;
+    }
+    uint32_t liveFailed = telem.stats.failed;
+
+    // Outage: the loop keeps ticking, the spool task keeps writing
+    mqtt_disconnect(&mqtt);
+    uint32_t outageS = (uint32_t)(outageH * 3600.0f);
+    uint32_t maxTickUs = 0;
+    uint32_t t0 = micros();
+    for (uint32_t s = 0; s < outageS; s++) {
+        sim_step(1000, 1);
+        simS++;
+        uint32_t u0 = micros();
+        telem_tick(&telem, true, simS * 1000UL);
+        uint32_t us = (uint32_t)(micros() - u0);
+        if (us > maxTickUs) maxTickUs = us;
+        spool_service(&spool);
+    }
+    double outageWall = (uint32_t)(micros() - t0) / 1e6;
+    const SpoolStats_t* sp = spool_get_stats(&spool);
+    uint32_t spooled = telem.stats.spooled;
+    uint32_t pagesAfterOutage = spool_pending(&spool);
+
+    // Reconnect and drain, live ticks carrying on
+    uint32_t drainStartRecords = sp->drainedRecords;
+    uint32_t drainStartBytes = sp->drainedBytes;
+    uint32_t passes = 0, liveTicks = 0;
+    uint32_t published0 = telem.stats.published;
+    t0 = micros();
+    while (spool_pending(&spool) > 0 && liveTicks < outageS) {
+        sim_step(1000, 1);
+        simS++;
+        liveTicks++;
+        telem_tick(&telem, true, simS * 1000UL);
+        for (int i = 0; i < BENCH_PASSES && spool_pending(&spool) > 0; i++, passes++) {
+            loop_pass(simS * 1000UL + i * BENCH_PASS_MS, true);
+        }
+    }
+    while (mqtt_queued(&mqtt) && mqtt_connected(&mqtt)) loop_pass(simS * 1000UL, true);
+    double drainWall = (uint32_t)(micros() - t0) / 1e6;
+    uint32_t records = sp->drainedRecords - drainStartRecords;
+    uint32_t bytes = sp->drainedBytes - drainStartBytes;
+
+    printf("outage %.1f h (%.1f s wall): %lu records spooled, %lu dropped, %lu pages written "
+           "(%lu lost to wrap)\n",
+           outageH, outageWall, (unsigned long)spooled, (unsigned long)sp->dropped,
+           (unsigned long)sp->pagesWritten, (unsigned long)sp->pagesLost);
+    printf("  page write avg %.0f us, max %lu us (spool task); tick incl. spool push max %lu us\n",
+           sp->pagesWritten ? (double)sp->writeUs / sp->pagesWritten : 0.0,
+           (unsigned long)sp->maxWriteUs, (unsigned long)maxTickUs);
+    printf("drain: %lu pages, %lu records, %.0f KB in %lu loop passes (%.1f s device time), "
+           "%lu batches\n",
+           (unsigned long)pagesAfterOutage, (unsigned long)records, bytes / 1024.0,
+           (unsigned long)passes, passes * BENCH_PASS_MS / 1000.0,
+           (unsigned long)telem.stats.backlogBatches);
+    printf("  %.2f s wall: %.0f records/s, %.0f KB/s; %lu corrupt pages; live: %lu ticks, "
+           "%lu msgs published, %lu refused\n",
+           drainWall, records / drainWall, bytes / 1024.0 / drainWall,
+           (unsigned long)sp->pagesCorrupt, (unsigned long)liveTicks,
+           (unsigned long)(telem.stats.published - published0),
+           (unsigned long)(telem.stats.failed - liveFailed));
+
+    mqtt_disconnect(&mqtt);
+    spool_close(&spool);
+    ts_flash_remove(BENCH_SPOOL_FILE);
+    return 0;
+}
@@ -0,0 +1,129 @@
+// SIGNALTAP Dashboard Telemetry Decoder Check (node)
+// The dashboard's binary telemetry decoder (index.html) against the
+// firmware's (src/net/telemetry_codec), on frames from telemetry_codec_bench.
+//  - Decode: every record decodeTelemetryFrame() returns, in order, matches
+//    the bench's decoded record for the same frame (machine, schema, values)
+//  - Mapping: handleTelemetryFrame() on the same frames leaves machine 0's
+//    last record in the cnc demo: sensors, scenario, part count, and the
+//    health score and failure risk in demo.ai
+//
+// Build: nothing; plain node, no packages. make -C tools check runs it after
+// telemetry_codec_bench -o frames.bin -e records.txt when node is installed.
+//
+// Usage: node tools/tc_decode_check.js <frames.bin> <records.txt> [index.html]
+'use strict';
+const fs = require('fs');
+const path = require('path');
+const vm = require('vm');
+
+let failures = 0;
+
+function fail(what) {
+  if (failures < 10) console.log(`  FAILED: ${what}`);
+  failures++;
+}
+
+// ============ Dashboard code ============
+// DEMOS and the telemetry block, evaluated on their own with the state the
+// block touches stubbed; a fresh copy for each pass
+function loadDashboard(html) {
+  const start = html.indexOf('const DEMOS = {');
+  let depth = 0, end = start + 'const DEMOS = '.length;
+  do {
+    if (html[end] === '{') depth++;
+    else if (html[end] === '}') depth--;
+    end++;
+  } while (depth > 0 && end < html.length);
+  const block = html.slice(html.indexOf('// Binary telemetry frames'), html.indexOf('function updateConnectionUI'));
+  if (start < 0 || depth !== 0 || block.length === 0) throw new Error('index.html: no DEMOS or telemetry block');
+
+  const source = [
+    'const scenarioState = { cnc: 0, chiller: 0, compressor: 0, custom: 0 };',
+    'function render() {}',
+    html.slice(start, end) + ';',
+    block,
+    '({ DEMOS, scenarioState, decodeTelemetryFrame, handleTelemetryFrame });'
+  ].join('\n');
+  return vm.runInNewContext(source, {});
+}
+
+function readFrames(file) {
+  const buf = fs.readFileSync(file);
+  const frames = [];
+  for (let pos = 0; pos + 2 <= buf.length;) {
+    const len = buf[pos] | (buf[pos + 1] << 8);
+    frames.push(buf.subarray(pos + 2, pos + 2 + len));
+    pos += 2 + len;
+  }
+  return frames;
+}
+
+// "tick machine schema key v0 v1 ..." -> records by tick
+function readRecords(file) {
+  const byTick = [];
+  fs.readFileSync(file, 'utf8').split('\n').filter((l) => l).forEach((line) => {
+    const [tick, machine, schema, key, ...v] = line.split(' ').map(Number);
+    (byTick[tick] = byTick[tick] || []).push({ machine, schema, key, v });
+  });
+  return byTick;
+}
+
+// ============ Checks ============
+function checkDecode(html, frames, expected) {
+  const dash = loadDashboard(html);
+  let records = 0, mismatches = 0;
+  frames.forEach((frame, tick) => {
+    const got = dash.decodeTelemetryFrame(new Uint8Array(frame)) || [];
+    const want = expected[tick] || [];
+    if (got.length !== want.length) {
+      fail(`frame ${tick}: ${got.length} records, firmware decoder ${want.length}`);
+      mismatches++;
+      return;
+    }
+    got.forEach((r, i) => {
+      const w = want[i];
+      records++;
+      if (r.machine !== w.machine || r.schema !== w.schema || r.v.join(' ') !== w.v.join(' ')) {
+        fail(`frame ${tick} record ${i}: machine ${r.machine} [${r.v}], firmware machine ${w.machine} [${w.v}]`);
+        mismatches++;
+      }
+    });
+  });
+  console.log(`decode:  ${frames.length} frames, ${records} records, ${mismatches} mismatches`);
+}
+
+function checkMapping(html, frames, expected) {
+  const dash = loadDashboard(html);
+  let last = null;
+  frames.forEach((frame, tick) => {
+    dash.handleTelemetryFrame(frame.buffer.slice(frame.byteOffset, frame.byteOffset + frame.length));
+    (expected[tick] || []).forEach((r) => { if (r.machine === 0) last = r; });
+  });
+  if (!last || last.schema !== 0) {
+    fail('no cnc record for machine 0');
+    return;
+  }
+  const cnc = dash.DEMOS.cnc;
+  const v = last.v;
+  const near = (a, b) => Math.abs(a - b) < 1e-9;
+  if (!near(cnc.sensors[0].value, v[0] / 10) || !near(cnc.sensors[1].value, v[1] / 10) ||
+      !near(cnc.sensors[2].value, v[2])) fail(`sensors [${cnc.sensors.map((s) => s.value)}], frame [${v.slice(0, 3)}]`);
+  if (cnc.ai.healthScore !== v[3]) fail(`ai.healthScore ${cnc.ai.healthScore}, frame ${v[3]}`);
+  if (!near(cnc.ai.failureProbability, v[4] / 10)) fail(`ai.failureProbability ${cnc.ai.failureProbability}, frame ${v[4] / 10}`);
+  if (dash.scenarioState.cnc !== v[5]) fail(`scenario ${dash.scenarioState.cnc}, frame ${v[5]}`);
+  if (cnc.vision.partCount !== v[6]) fail(`partCount ${cnc.vision.partCount}, frame ${v[6]}`);
+  console.log(`mapping: cnc health ${cnc.ai.healthScore}, risk ${cnc.ai.failureProbability}%, scenario ${dash.scenarioState.cnc}`);
+}
+
+const [framesPath, recordsPath, htmlPath] = process.argv.slice(2);
+if (!framesPath || !recordsPath) {
+  console.log('Usage: node tools/tc_decode_check.js <frames.bin> <records.txt> [index.html]');
+  process.exit(2);
+}
+const html = fs.readFileSync(htmlPath || path.join(__dirname, '..', 'index.html'), 'utf8');
+const frames = readFrames(framesPath);
+const expected = readRecords(recordsPath);
+checkDecode(html, frames, expected);
+checkMapping(html, frames, expected);
+console.log(failures ? 'checks FAILED' : 'all checks passed');
+process.exit(failures ? 1 : 0);
@@ -0,0 +1,241 @@
+// SIGNALTAP Telemetry Codec Bench (host)
+// Compares the binary telemetry codec (src/net/telemetry_codec) with the
+// JSON payloads the publisher sends today, for a small and a large fleet.
+// Machine traces are recorded from the headless simulation (each demo in
+// turn); machine m of the fleet replays demo m % 4 at its own time offset.
+// Every tick the whole fleet is encoded both ways: JSON as one message per
+// machine (sensors, vision and status fields, formatted as telemetry.cpp
+// does), binary as one frame. Reports encode ns per machine-sample, bytes
+// per tick and decode cost, and checks that every frame decodes back to
+// the samples that went in, every keyframe as a keyframe.
+//
+// Build: make -C tools telemetry_codec_bench (tools/Makefile, against tools/host/Arduino.h)
+// Run it from a scratch directory: the simulation's store writes there.
+//
+// Usage:
+//   telemetry_codec_bench [-t ticks] [-k key every] [-o frames.bin] [-e records.txt] [machines ...]
+// Defaults: 600 ticks, TC_KEY_EVERY, fleets of 4 and 200. -o writes the
+// first fleet's frames, each prefixed with a u16 length, and -e what this
+// decoder read from them, one record per line ("tick machine schema key
+// v0 v1 ..."): the reference for the dashboard's decoder
+// (node tools/tc_decode_check.js, run by make check).
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../src/net/telemetry_codec.h"
+#include "../src/data/simulation_engine.h"
+
+#define BENCH_MAX_MACHINES  1000
+#define BENCH_FRAME_BYTES   65535
+#define BENCH_JSON_BYTES    512
+
+static const char* const cncLedKeys[8] = {"PR", "PS", "PF", "PF0", "V5", "NF", "SF", "CB"};
+
+static TcSample_t* trace[DEMO_COUNT];
+static TcStream_t encStreams[BENCH_MAX_MACHINES];
+static TcStream_t decStreams[BENCH_MAX_MACHINES];
+static uint8_t frame[BENCH_FRAME_BYTES];
+static char json[BENCH_JSON_BYTES];
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static const TcSample_t* fleet_sample(uint16_t m, uint32_t tick, uint32_t ticks) {
+    return &trace[m % DEMO_COUNT][(m * 97UL + tick) % ticks];
+}
+
+// ============ JSON baseline ============
+static int put_text(char* p, int cap, const char* key, int32_t code) {
+    const char* s = tc_text(code);
+    return s ? snprintf(p, cap, ",\"%s\":\"%s\"", key, s) : 0;
+}
+
+static int put_bits(char* p, int cap, const char* key, int32_t v) {
+    return snprintf(p, cap, ",\"%s\":[%d,%d,%d,%d,%d,%d,%d,%d]", key, (int)(v & 1), (int)(v >> 1 & 1),
+                    (int)(v >> 2 & 1), (int)(v >> 3 & 1), (int)(v >> 4 & 1), (int)(v >> 5 & 1),
+                    (int)(v >> 6 & 1), (int)(v >> 7 & 1));
+}
+
+// One machine's tick as the JSON topics carry it
+static int format_json(char* p, int cap, uint16_t m, uint32_t clock, const TcSample_t* s) {
+    const TcSchema_t* sch = tc_schema(s->schema);
+    int n = snprintf(p, cap, "{\"m\":%u,\"t\":%lu,\"sensors\":[", m, (unsigned long)clock);
+    for (uint8_t i = 0; i < 3; i++) {
+        n += snprintf(p + n, cap - n, "%s{\"value\":%.*f}", i ? "," : "",
+                      sch->fields[i].decimals, tc_value(s, i));
+    }
+    n += snprintf(p + n, cap - n, "],\"health\":%ld,\"risk\":%.1f,\"scenario\":%ld,\"vision\":{\"v\":%u",
+                  (long)s->v[3], tc_value(s, 4), (long)s->v[5], s->schema);
+    switch (s->schema) {
+        case VISION_CNC:
+            n += snprintf(p + n, cap - n, ",\"partCount\":%ld", (long)s->v[6]);
+            n += put_text(p + n, cap - n, "stackLight", s->v[8]);
+            n += snprintf(p + n, cap - n, ",\"leds\":{");
+            for (int i = 0; i < 8; i++) {
+                n += snprintf(p + n, cap - n, "%s\"%s\":%s", i ? "," : "", cncLedKeys[i],
+                              (s->v[7] >> i & 1) ? "true" : "false");
+            }
+            n += snprintf(p + n, cap - n, "}");
+            break;
+        case VISION_CHILLER:
+            n += put_text(p + n, cap - n, "errorCode", s->v[6]);
+            break;
+        case VISION_COMPRESSOR:
+            n += snprintf(p + n, cap - n, ",\"pressure\":%.1f,\"oilTemp\":%.0f",
+                          tc_value(s, 6), tc_value(s, 7));
+            n += put_text(p + n, cap - n, "state", s->v[8]);
+            break;
+        default:
+            n += put_bits(p + n, cap - n, "diA", s->v[6]);
+            n += put_bits(p + n, cap - n, "dqA", s->v[7]);
+            n += snprintf(p + n, cap - n, ",\"aq0\":%ld", (long)s->v[8]);
+            break;
+    }
+    n += snprintf(p + n, cap - n, "}}");
+    return n;
+}
+
+// ============ Round trip check ============
+typedef struct {
+    uint32_t tick;
+    uint32_t ticks;
+    uint32_t mismatches;
+    uint32_t records;
+    uint32_t keyframes;
+    FILE* expect;
+} Check_t;
+
+static void check_record(uint16_t machine, const TcSample_t* s, bool key, void* ctx) {
+    Check_t* c = (Check_t*)ctx;
+    const TcSample_t* want = fleet_sample(machine, c->tick, c->ticks);
+    const TcSchema_t* sch = tc_schema(want->schema);
+    if (s->schema != want->schema || memcmp(s->v, want->v, sch->count * sizeof(int32_t)) != 0) {
+        c->mismatches++;
+    }
+    c->records++;
+    if (key) c->keyframes++;
+    if (c->expect) {
+        fprintf(c->expect, "%lu %u %u %d", (unsigned long)c->tick, machine, s->schema, key ? 1 : 0);
+        for (uint8_t i = 0; i < sch->count; i++) fprintf(c->expect, " %ld", (long)s->v[i]);
+        fputc('\n', c->expect);
+    }
+}
+
+static uint32_t run_fleet(uint16_t machines, uint32_t ticks, uint8_t keyEvery, FILE* out, FILE* expect) {
+    TcEncoder_t enc;
+    TcDecoder_t dec;
+
+    // JSON: one message per machine per tick
+    double jsonBytes = 0;
+    double t0 = now_ns();
+    for (uint32_t k = 0; k < ticks; k++) {
+        for (uint16_t m = 0; m < machines; m++) {
+            jsonBytes += format_json(json, sizeof(json), m, k, fleet_sample(m, k, ticks));
+        }
+    }
+    double jsonNs = now_ns() - t0;
+
+    // Binary: one frame per tick
+    tc_encoder_init(&enc, encStreams, machines, keyEvery);
+    double binBytes = 0;
+    uint32_t unfit = 0;
+    t0 = now_ns();
+    for (uint32_t k = 0; k < ticks; k++) {
+        TcFrame_t f;
+        tc_frame_begin(&enc, &f, frame, sizeof(frame), k);
+        for (uint16_t m = 0; m < machines; m++) {
+            if (!tc_frame_put(&enc, &f, m, fleet_sample(m, k, ticks))) unfit++;
+        }
+        binBytes += tc_frame_end(&enc, &f);
+    }
+    double binNs = now_ns() - t0;
+
+    // Encode again, decoding each frame against the trace
+    tc_encoder_init(&enc, encStreams, machines, keyEvery);
+    tc_decoder_init(&dec, decStreams, machines);
+    Check_t check = {0, ticks, 0, 0, 0, expect};
+    double decNs = 0;
+    for (uint32_t k = 0; k < ticks; k++) {
+        TcFrame_t f;
+        tc_frame_begin(&enc, &f, frame, sizeof(frame), k);
+        for (uint16_t m = 0; m < machines; m++) tc_frame_put(&enc, &f, m, fleet_sample(m, k, ticks));
+        uint16_t len = tc_frame_end(&enc, &f);
+        if (!len) continue;
+        if (out) {
+            uint8_t hdr[2] = {(uint8_t)len, (uint8_t)(len >> 8)};
+            fwrite(hdr, 1, 2, out);
+            fwrite(frame, 1, len, out);
+        }
+        check.tick = k;
+        t0 = now_ns();
+        if (tc_decode(&dec, frame, len, check_record, &check) < 0) check.mismatches++;
+        decNs += now_ns() - t0;
+    }
+    // Every keyframe sent came back as one
+    if (check.keyframes != enc.stats.keyframes) check.mismatches++;
+
+    double samples = (double)machines * ticks;
+    const TcStats_t* st = &enc.stats;
+    printf("%u machines, %lu ticks\n", machines, (unsigned long)ticks);
+    printf("  json:   %7.0f ns/sample, %9.0f B/tick (%.0f B/machine)\n",
+           jsonNs / samples, jsonBytes / ticks, jsonBytes / samples);
+    printf("  binary: %7.0f ns/sample, %9.0f B/tick (%.1f B/machine), %.1fx smaller, %.1fx faster\n",
+           binNs / samples, binBytes / ticks, binBytes / samples, jsonBytes / binBytes, jsonNs / binNs);
+    printf("          %lu records (%.0f%% keyframes), %.1f fields/record, decode %.0f ns/record\n",
+           (unsigned long)st->records, 100.0 * st->keyframes / (st->records + 1e-9),
+           (double)st->fields / (st->records + 1e-9), decNs / (check.records + 1e-9));
+    printf("          round trip: %lu records (%lu keyframes) checked, %lu mismatches, %lu unfit, "
+           "%lu decoder gaps\n",
+           (unsigned long)check.records, (unsigned long)check.keyframes, (unsigned long)check.mismatches,
+           (unsigned long)unfit, (unsigned long)dec.gaps);
+    return check.mismatches;
+}
+
+int main(int argc, char** argv) {
+    uint32_t ticks = 600;
+    uint8_t keyEvery = TC_KEY_EVERY;
+    const char* outPath = NULL;
+    const char* expectPath = NULL;
+    int a = 1;
+    for (; a + 1 < argc && argv[a][0] == '-'; a += 2) {
+        if (argv[a][1] == 't') ticks = (uint32_t)atol(argv[a + 1]);
+        else if (argv[a][1] == 'k') keyEvery = (uint8_t)atoi(argv[a + 1]);
+        else if (argv[a][1] == 'o') outPath = argv[a + 1];
+        else if (argv[a][1] == 'e') expectPath = argv[a + 1];
+    }
+    if (ticks == 0) ticks = 1;
+
+    // Record every demo's trace from the simulation
+    sim_init();
+    for (uint8_t d = 0; d < DEMO_COUNT; d++) {
+        trace[d] = (TcSample_t*)malloc(ticks * sizeof(TcSample_t));
+        sim_set_demo(d);
+        for (uint32_t k = 0; k < ticks; k++) {
+            sim_step(1000, 1);
+            tc_sample(sim_get_demo(), (uint8_t)sim_get_scenario(), &trace[d][k]);
+        }
+    }
+
+    FILE* out = outPath ? fopen(outPath, "wb") : NULL;
+    FILE* expect = expectPath ? fopen(expectPath, "w") : NULL;
+    uint32_t bad = 0;
+    if (a >= argc) {
+        bad += run_fleet(4, ticks, keyEvery, out, expect);
+        bad += run_fleet(200, ticks, keyEvery, NULL, NULL);
+    }
+    for (; a < argc; a++) {
+        int n = atoi(argv[a]);
+        if (n < 1 || n > BENCH_MAX_MACHINES) continue;
+        bad += run_fleet((uint16_t)n, ticks, keyEvery, out, expect);
+        if (out) fclose(out);
+        if (expect) fclose(expect);
+        out = expect = NULL;
+    }
+    if (out) fclose(out);
+    if (expect) fclose(expect);
+    return bad ? 1 : 0;
+}
@@ -0,0 +1,383 @@
+// SIGNALTAP Time-Series Store Bench (host)
+// The persistent store (src/storage/ts_store) against a file image, as the
+// FAT partition holds it, and what appending costs the tick now that the
+// file writes sit behind the write queue.
+//  - Image: -n samples (3 series, 1 Hz, bit patterns a reference can
+//    recompute) through ts_append + ts_service, by default enough to wrap
+//    the segment ring; then the file is read raw: every slot has a valid
+//    header, seqs are unique, all but the newest segment carry a valid
+//    seal agreeing with its chunks. Reopened, the retained window must come back
+//    bit-exact and gapless up to the last sample, and min/max over ranges
+//    cutting segments must match the reference
+//  - Torn tail: the last chunk's payload damaged in the image; reopening
+//    recovers everything before it and appending carries on
+//  - Unsealed: RECOVER_SEGMENTS segments with their seals wiped, more than
+//    the write queue holds; reopening seals all but the newest, and the
+//    image and the samples check out as above
+//  - Queue: appends with the writer stalled fill TS_WRITE_JOBS and are then
+//    dropped (counted, never blocking); once serviced, the accepted samples
+//    read back in order
+//  - Timing: ts_append alone (the tick's share), ts_service per write and
+//    both inline as before, average and worst per sample
+//
+// Build: make -C tools ts_store_bench (tools/Makefile, against tools/host/Arduino.h)
+// Run it from a scratch directory: the image is written there (and removed).
+//
+// Usage: ts_store_bench [-n samples (300000)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <vector>
+#include "../src/storage/ts_store.h"
+
+#define IMAGE_PATH      "/ts_store_bench.dat"
+#define IMAGE_FILE      "ts_store_bench.dat"    // Where the host backend puts it
+#define T0              1000000u
+#define RECOVER_SEGMENTS (TS_WRITE_JOBS * 2 + 2)
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t failures = 0;
+
+static void fail(const char* what) {
+    if (failures < 10) printf("  FAILED: %s\n", what);
+    failures++;
+}
+
+// ============ Reference ============
+// Slow drifts with a little noise, a step now and then, as the sensors
+// give; recomputed from t alone
+static void sample(uint32_t t, float* v) {
+    uint32_t h = t * 2654435761u;
+    h ^= h >> 15;
+    float noise = (h & 0xFFFF) / 65535.0f - 0.5f;
+    v[0] = 60.0f + 15.0f * sinf(t * 0.001f) + noise;
+    v[1] = 12.0f + ((t / 900) % 3) * 0.5f + noise * 0.1f;
+    v[2] = (t / 600) % 5 == 0 ? 0.0f : 4200.0f + noise * 4.0f;
+}
+
+static bool same(const float* a, const float* b) {
+    return memcmp(a, b, TS_SERIES * sizeof(float)) == 0;
+}
+
+typedef struct {
+    uint32_t next;          // Expected next t
+    uint32_t first;
+    uint32_t count;
+    bool gap;
+    bool mismatch;
+} ReadBack_t;
+
+static void read_cb(uint32_t t, const float* values, void* ctx) {
+    ReadBack_t* rb = (ReadBack_t*)ctx;
+    if (rb->count == 0) rb->first = t;
+    else if (t != rb->next) rb->gap = true;
+    float want[TS_SERIES];
+    sample(t, want);
+    if (!same(values, want)) rb->mismatch = true;
+    rb->next = t + 1;
+    rb->count++;
+}
+
+static ReadBack_t read_all(TsStore_t* st) {
+    ReadBack_t rb;
+    memset(&rb, 0, sizeof(rb));
+    ts_query(st, 0, UINT32_MAX, read_cb, &rb);
+    return rb;
+}
+
+static TsStore_t store;
+
+static uint32_t append_range(TsStore_t* st, uint32_t t0, uint32_t n, bool service) {
+    uint32_t ok = 0;
+    float v[TS_SERIES];
+    for (uint32_t t = t0; t < t0 + n; t++) {
+        sample(t, v);
+        if (ts_append(st, t, v)) ok++;
+        if (service) ts_service(st);
+    }
+    return ok;
+}
+
+// ============ Image ============
+static uint32_t crc32(const void* data, uint32_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    uint32_t crc = ~0u;
+    while (len--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+// Raw walk of the file: headers, seals, and the seal agreeing with the RAM
+// index the reopened store rebuilt
+static void check_image(const TsStore_t* st, bool wrapped) {
+    FILE* fp = fopen(IMAGE_FILE, "rb");
+    if (!fp) {
+        fail("image missing");
+        return;
+    }
+    std::vector<uint8_t> img;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) img.insert(img.end(), buf, buf + n);
+    fclose(fp);
+
+    if (img.size() % TS_SEGMENT_BYTES != 0 ||
+        (wrapped && img.size() != (size_t)TS_SEGMENT_COUNT * TS_SEGMENT_BYTES)) {
+        fail("image size");
+    }
+    uint32_t sealed = 0, open = 0, maxSeq = 0;
+    std::vector<uint32_t> seqs;
+    for (int i = 0; i < TS_SEGMENT_COUNT && (size_t)(i + 1) * TS_SEGMENT_BYTES <= img.size(); i++) {
+        const uint8_t* seg = &img[(size_t)i * TS_SEGMENT_BYTES];
+        TsSegHeader_t h;
+        memcpy(&h, seg, sizeof(h));
+        if (h.magic != TS_SEG_MAGIC || h.crc != crc32(&h, offsetof(TsSegHeader_t, crc))) {
+            fail("segment header");
+            continue;
+        }
+        for (uint32_t s : seqs) {
+            if (s == h.seq) fail("duplicate segment seq");
+        }
+        seqs.push_back(h.seq);
+        if (h.seq > maxSeq) maxSeq = h.seq;
+
+        TsSeal_t seal;
+        memcpy(&seal, seg + TS_DATA_END, sizeof(seal));
+        bool valid = seal.magic == TS_SEAL_MAGIC && seal.seq == h.seq &&
+                     seal.crc == crc32(&seal, offsetof(TsSeal_t, crc));
+        if (!valid) {
+            open++;
+            continue;
+        }
+        sealed++;
+        const TsSegInfo_t* s = &st->seg[i];
+        if (seal.count != s->count || seal.startTime != s->startTime || seal.endTime != s->endTime ||
+            seal.endTime - seal.startTime + 1 != seal.count) {
+            fail("seal disagrees with its chunks");
+        }
+    }
+    if (open != 1) fail("not exactly one unsealed segment");
+    const TsSegInfo_t* active = st->active >= 0 ? &st->seg[st->active] : NULL;
+    if (!active || active->seq != maxSeq) fail("the unsealed segment is not the newest");
+    printf("  image: %lu KB, %lu sealed segments + 1 open, seqs up to %lu\n",
+           (unsigned long)(img.size() / 1024), (unsigned long)sealed, (unsigned long)maxSeq);
+}
+
+static void check_minmax(TsStore_t* st, uint32_t first, uint32_t last) {
+    uint32_t span = last - first;
+    uint32_t ranges[4][2] = {{first, last}, {first + span / 7, first + span / 3},
+                             {first + span / 2 - 17, first + span / 2 + 2000}, {last - 5, last}};
+    for (int r = 0; r < 4; r++) {
+        for (uint8_t k = 0; k < TS_SERIES; k++) {
+            float lo = INFINITY, hi = -INFINITY, v[TS_SERIES];
+            for (uint32_t t = ranges[r][0]; t <= ranges[r][1]; t++) {
+                sample(t, v);
+                if (v[k] < lo) lo = v[k];
+                if (v[k] > hi) hi = v[k];
+            }
+            float gotLo, gotHi;
+            if (!ts_range_minmax(st, ranges[r][0], ranges[r][1], k, &gotLo, &gotHi) ||
+                gotLo != lo || gotHi != hi) {
+                fail("range min/max");
+            }
+        }
+    }
+}
+
+static void image(uint32_t n) {
+    ts_flash_remove(IMAGE_PATH);
+    if (!ts_open(&store, IMAGE_PATH)) {
+        fail("open");
+        return;
+    }
+    uint32_t ok = append_range(&store, T0, n, true);
+    if (ok != n) fail("appends refused with the writer keeping up");
+    ts_close(&store);
+
+    if (!ts_open(&store, IMAGE_PATH)) {
+        fail("reopen");
+        return;
+    }
+    ReadBack_t rb = read_all(&store);
+    uint32_t last = T0 + n - 1;
+    printf("image: %lu samples appended, %lu retained (%lu..%lu)\n", (unsigned long)n,
+           (unsigned long)rb.count, (unsigned long)rb.first, (unsigned long)(rb.next - 1));
+    if (rb.mismatch) fail("retained samples differ from the reference");
+    if (rb.gap) fail("gap in the retained samples");
+    if (rb.count == 0 || rb.next - 1 != last) fail("newest sample not retained");
+    if (ts_latest_time(&store) != last) fail("latest time");
+    check_image(&store, rb.count < n);
+    if (rb.count > 2) check_minmax(&store, rb.first, last);
+    ts_close(&store);
+}
+
+// ============ Torn tail ============
+static void torn_tail(void) {
+    ts_flash_remove(IMAGE_PATH);
+    ts_open(&store, IMAGE_PATH);
+    append_range(&store, T0, 5 * TS_FLUSH_SAMPLES, true);
+    int seg = store.active;
+    uint32_t lastChunk = 0, off = 0;
+    while (off < store.dataOff) {
+        TsChunkHeader_t h;
+        FILE* fp = fopen(IMAGE_FILE, "rb");
+        fseek(fp, (long)(seg * TS_SEGMENT_BYTES + TS_DATA_START + off), SEEK_SET);
+        size_t got = fread(&h, sizeof(h), 1, fp);
+        fclose(fp);
+        if (got != 1) break;
+        lastChunk = off;
+        off += sizeof(h) + h.payloadBytes;
+    }
+    ts_close(&store);
+
+    // Flip a byte in the middle of the last chunk's payload
+    FILE* fp = fopen(IMAGE_FILE, "r+b");
+    long at = (long)(seg * TS_SEGMENT_BYTES + TS_DATA_START + lastChunk + sizeof(TsChunkHeader_t) + 10);
+    fseek(fp, at, SEEK_SET);
+    int c = fgetc(fp);
+    fseek(fp, at, SEEK_SET);
+    fputc(c ^ 0x5A, fp);
+    fclose(fp);
+
+    ts_open(&store, IMAGE_PATH);
+    ReadBack_t rb = read_all(&store);
+    uint32_t keep = 4 * TS_FLUSH_SAMPLES;
+    if (rb.count != keep || rb.mismatch || rb.gap) fail("torn tail recovery");
+    uint32_t more = append_range(&store, T0 + 5 * TS_FLUSH_SAMPLES, 2 * TS_FLUSH_SAMPLES, true);
+    ts_close(&store);
+    ts_open(&store, IMAGE_PATH);
+    ReadBack_t after = read_all(&store);
+    if (more != 2 * TS_FLUSH_SAMPLES || after.count != keep + more || after.mismatch) {
+        fail("appending after a torn tail");
+    }
+    printf("torn tail: %lu of %u samples recovered, %lu more appended after\n",
+           (unsigned long)rb.count, 5 * TS_FLUSH_SAMPLES, (unsigned long)more);
+    ts_close(&store);
+}
+
+// ============ Unsealed segments ============
+static void unsealed(void) {
+    ts_flash_remove(IMAGE_PATH);
+    ts_open(&store, IMAGE_PATH);
+    uint32_t n = 0;
+    float v[TS_SERIES];
+    for (;;) {
+        int used = 0;
+        for (int i = 0; i < TS_SEGMENT_COUNT; i++) used += store.seg[i].state != TS_SEG_FREE;
+        if (used == RECOVER_SEGMENTS && store.seg[store.active].count > 0) break;
+        sample(T0 + n, v);
+        ts_append(&store, T0 + n, v);
+        ts_service(&store);
+        n++;
+    }
+    ts_close(&store);
+
+    // As if power went every time between a segment's last chunk and its seal
+    FILE* fp = fopen(IMAGE_FILE, "r+b");
+    uint8_t erased[TS_SEAL_BYTES];
+    memset(erased, 0xFF, sizeof(erased));
+    for (int i = 0; i < RECOVER_SEGMENTS; i++) {
+        fseek(fp, (long)(i * TS_SEGMENT_BYTES + TS_DATA_END), SEEK_SET);
+        fwrite(erased, 1, sizeof(erased), fp);
+    }
+    fclose(fp);
+
+    if (!ts_open(&store, IMAGE_PATH)) {
+        fail("open with unsealed segments");
+        return;
+    }
+    uint32_t sealed = store.stats.jobsWritten;
+    if (ts_pending(&store) != 0) fail("seals left queued after the open");
+    if (sealed != RECOVER_SEGMENTS - 1) fail("not every older unsealed segment sealed");
+    check_image(&store, false);
+    ReadBack_t rb = read_all(&store);
+    if (rb.count != n || rb.mismatch || rb.gap) fail("samples of unsealed segments");
+    ts_close(&store);
+    ts_open(&store, IMAGE_PATH);
+    ReadBack_t again = read_all(&store);
+    if (again.count != n || again.mismatch) fail("samples after the recovery seals");
+    printf("unsealed: %d segments without a seal, %lu sealed on open, %lu samples back\n",
+           RECOVER_SEGMENTS, (unsigned long)sealed, (unsigned long)again.count);
+    ts_close(&store);
+}
+
+// ============ Queue ============
+static void queue(void) {
+    ts_flash_remove(IMAGE_PATH);
+    ts_open(&store, IMAGE_PATH);
+    uint32_t tries = (TS_WRITE_JOBS + 4) * TS_FLUSH_SAMPLES;
+    uint32_t ok = append_range(&store, T0, tries, false);
+    uint8_t pending = ts_pending(&store);
+    if (pending != TS_WRITE_JOBS) fail("queue not full with the writer stalled");
+    if (store.stats.dropped == 0 || ok + store.stats.dropped != tries) fail("drops not counted");
+    uint32_t dropped = store.stats.dropped;
+    uint32_t written = ts_service(&store);
+    if (ts_pending(&store) != 0) fail("queue not drained");
+    uint32_t more = append_range(&store, T0 + tries, TS_FLUSH_SAMPLES, true);
+    ts_close(&store);
+    ts_open(&store, IMAGE_PATH);
+    ReadBack_t rb = read_all(&store);
+    if (rb.mismatch || rb.count != ok + more) fail("accepted samples not read back");
+    printf("queue: writer stalled, %lu of %lu samples accepted, %lu dropped, %lu writes when it "
+           "came back\n", (unsigned long)ok, (unsigned long)tries, (unsigned long)dropped,
+           (unsigned long)written);
+    ts_close(&store);
+}
+
+// ============ Timing ============
+static void timing(uint32_t n) {
+    ts_flash_remove(IMAGE_PATH);
+    ts_open(&store, IMAGE_PATH);
+    double appendNs = 0, appendMax = 0, serviceNs = 0, serviceMax = 0, inlineMax = 0;
+    uint32_t writes = 0;
+    float v[TS_SERIES];
+    for (uint32_t t = T0; t < T0 + n; t++) {
+        sample(t, v);
+        double t0 = now_ns();
+        ts_append(&store, t, v);
+        double t1 = now_ns();
+        uint32_t w = ts_service(&store);
+        double t2 = now_ns();
+        appendNs += t1 - t0;
+        if (t1 - t0 > appendMax) appendMax = t1 - t0;
+        if (w) {
+            serviceNs += t2 - t1;
+            writes += w;
+            if (t2 - t1 > serviceMax) serviceMax = t2 - t1;
+        }
+        if (t2 - t0 > inlineMax) inlineMax = t2 - t0;
+    }
+    const TsStats_t* st = ts_get_stats(&store);
+    printf("timing, %lu samples, %.2f B/sample:\n", (unsigned long)n, st->bytesPerSample);
+    printf("  ts_append   avg %6.2f us, worst %7.1f us (the tick's share)\n",
+           appendNs / n / 1e3, appendMax / 1e3);
+    printf("  ts_service  avg %6.1f us per write, worst %7.1f us (%lu writes, the writer's)\n",
+           writes ? serviceNs / writes / 1e3 : 0.0, serviceMax / 1e3, (unsigned long)writes);
+    printf("  both inline worst %5.1f us per sample\n", inlineMax / 1e3);
+    ts_close(&store);
+    ts_flash_remove(IMAGE_PATH);
+}
+
+int main(int argc, char** argv) {
+    uint32_t n = 300000;
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-n") == 0) n = (uint32_t)atol(argv[a + 1]);
+    }
+    image(n);
+    torn_tail();
+    unsealed();
+    queue();
+    timing(n);
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,518 @@
+// SIGNALTAP LVGL Heap Bench (host)
+// Soaks the UI heap (src/ui/ui_mem) with a synthetic model of the UI's
+// allocation pattern, at one refresh per simulated second. The model is
+// not driven by ui_manager.cpp (that needs LVGL and a display); object
+// counts and update rates are estimates read off the screen code:
+//  - every screen is built once per demo; ui_refresh() touches only the
+//    visible one, rewriting the value labels whose text changed, and
+//    rebuilds its alarm rows (Home) or rebinds them (Alarms) when the
+//    alarm table changes
+//  - each object is LVGL v9's pattern on a 32-bit target: the instance,
+//    spec attributes for parents, a children array and a local-style array
+//    grown by realloc one entry at a time, a style and its property array
+//    per selector, label text
+//  - what changed is then redrawn: draw tasks and descriptors per object,
+//    freed at the end of the frame; a screen just shown (or rebuilt)
+//    redraws whole, with a 24 KB layer buffer (LV_DRAW_LAYER_SIMPLE_BUF_SIZE)
+//    where it has opacity or arcs; the Vision screen redraws its preview
+//    image 15 more times a second
+//  - another screen every 5 minutes, another demo every hour
+// Object counts per screen are estimates from the create_*_layout functions.
+//
+// Every block is filled on allocation and checked on free, and both pools
+// are walked (ui_mem_check) every 10 minutes. Reports, per heap layout:
+// peak use, the smallest largest-free-block and worst fragmentation seen,
+// failures and spills, allocations per refresh by screen, and steady
+// refreshes over UI_MEM_STEADY_ALLOCS (rebuilds). Then times the first
+// simulated hour's allocator calls, replayed, against each backend.
+//
+// Build: make -C tools ui_mem_bench (tools/Makefile, against tools/host/Arduino.h)
+//
+// Usage: ui_mem_bench [-h hours (24)] [-p pool KB (192)] [-a arena KB (512)]
+//                     [-s single pool KB (128, lv_conf.h LV_MEM_SIZE)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include "../src/ui/ui_mem.h"
+
+#define LARGE_MIN       4096
+#define LAYER_BYTES     (24 * 1024)
+#define VIEW_TICKS      300         // Screen change
+#define DEMO_TICKS      3600        // Demo change
+#define CHECK_TICKS     600
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t rng = 0x9E3779B9;
+
+static uint32_t xorshift(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint32_t between(uint32_t lo, uint32_t hi) {
+    return lo + xorshift() % (hi - lo + 1);
+}
+
+// ============ Heap Under Test ============
+// Slots stand for the pointers LVGL keeps; every call can be recorded for
+// the timing replay
+typedef struct {
+    void* p;
+    uint32_t size;
+} Slot_t;
+
+typedef struct {
+    uint8_t op;             // 0 alloc, 1 realloc, 2 free
+    uint32_t slot;
+    uint32_t size;
+} TraceOp_t;
+
+enum { OP_ALLOC, OP_REALLOC, OP_FREE };
+
+static std::vector<Slot_t> slots;
+static std::vector<uint32_t> freeSlots;
+static std::vector<TraceOp_t> trace;
+static bool recording = false;
+static uint64_t ops = 0, corrupt = 0;
+
+static uint8_t fill_byte(uint32_t slot) {
+    return (uint8_t)(slot * 131 + 7);
+}
+
+// First and last 16 bytes carry the slot's pattern
+static void fill(uint32_t slot) {
+    Slot_t* s = &slots[slot];
+    uint32_t n = s->size < 16 ? s->size : 16;
+    memset(s->p, fill_byte(slot), n);
+    memset((char*)s->p + s->size - n, fill_byte(slot), n);
+}
+
+static void verify(uint32_t slot) {
+    Slot_t* s = &slots[slot];
+    uint32_t n = s->size < 16 ? s->size : 16;
+    const uint8_t* a = (const uint8_t*)s->p;
+    const uint8_t* b = a + s->size - n;
+    for (uint32_t i = 0; i < n; i++) {
+        if (a[i] != fill_byte(slot) || b[i] != fill_byte(slot)) {
+            corrupt++;
+            return;
+        }
+    }
+}
+
+static uint32_t h_alloc(uint32_t size) {
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = (uint32_t)slots.size();
+        slots.push_back({NULL, 0});
+    }
+    if (recording) trace.push_back({OP_ALLOC, slot, size});
+    ops++;
+    slots[slot].p = ui_mem_alloc(size);
+    slots[slot].size = size;
+    if (slots[slot].p) fill(slot);
+    return slot;
+}
+
+static void h_realloc(uint32_t slot, uint32_t size) {
+    if (recording) trace.push_back({OP_REALLOC, slot, size});
+    ops++;
+    Slot_t* s = &slots[slot];
+    if (s->p) verify(slot);
+    void* p = ui_mem_realloc(s->p, size);
+    if (!p) return;             // LVGL keeps the old block on failure
+    s->p = p;
+    s->size = size;
+    fill(slot);
+}
+
+static void h_free(uint32_t slot) {
+    if (recording) trace.push_back({OP_FREE, slot, 0});
+    ops++;
+    Slot_t* s = &slots[slot];
+    if (s->p) verify(slot);
+    ui_mem_free(s->p);
+    s->p = NULL;
+    freeSlots.push_back(slot);
+}
+
+// ============ UI Model ============
+typedef struct {
+    uint32_t instance;
+    int32_t spec;           // -1: none
+    int32_t children;
+    uint32_t childCount;
+    int32_t styles;
+    uint32_t styleCount;
+    int32_t style[2];
+    int32_t props[2];
+    uint32_t propCount[2];
+    int32_t text;
+} Obj_t;
+
+enum { K_CONTAINER, K_LABEL, K_BAR, K_LINE, K_BUTTON, K_ARC };
+
+// 32-bit instance sizes of the widget classes the UI uses
+static const uint32_t instanceSize[] = {68, 104, 116, 84, 68, 100};
+
+static void set_style(Obj_t* o, int selector) {
+    if (o->style[selector] < 0) {
+        o->styleCount++;
+        if (o->styles < 0) o->styles = (int32_t)h_alloc(8 * o->styleCount);
+        else h_realloc((uint32_t)o->styles, 8 * o->styleCount);
+        o->style[selector] = (int32_t)h_alloc(12);
+    }
+    // One value + prop id more per property set
+    o->propCount[selector]++;
+    if (o->props[selector] < 0) o->props[selector] = (int32_t)h_alloc(5 * o->propCount[selector]);
+    else h_realloc((uint32_t)o->props[selector], 5 * o->propCount[selector]);
+}
+
+static void set_text(Obj_t* o, uint32_t len) {
+    if (o->text < 0) o->text = (int32_t)h_alloc(len + 1);
+    else h_realloc((uint32_t)o->text, len + 1);
+}
+
+static void add_child(Obj_t* parent) {
+    if (parent->spec < 0) parent->spec = (int32_t)h_alloc(52);
+    parent->childCount++;
+    if (parent->children < 0) parent->children = (int32_t)h_alloc(4 * parent->childCount);
+    else h_realloc((uint32_t)parent->children, 4 * parent->childCount);
+}
+
+static Obj_t obj_create(Obj_t* parent, int kind) {
+    Obj_t o;
+    memset(&o, 0xFF, sizeof(o));
+    o.childCount = o.styleCount = o.propCount[0] = o.propCount[1] = 0;
+    o.instance = h_alloc(instanceSize[kind]);
+    if (parent) add_child(parent);
+    switch (kind) {
+        case K_CONTAINER:
+            for (int i = 0; i < 6; i++) set_style(&o, 0);
+            break;
+        case K_LABEL:
+            set_text(&o, between(4, 36));
+            for (int i = 0, n = between(1, 3); i < n; i++) set_style(&o, 0);
+            break;
+        case K_BAR:
+            for (int i = 0; i < 3; i++) set_style(&o, 0);
+            for (int i = 0; i < 2; i++) set_style(&o, 1);
+            break;
+        case K_LINE:
+            for (int i = 0; i < 4; i++) set_style(&o, 0);
+            break;
+        case K_BUTTON:
+            for (int i = 0; i < 4; i++) set_style(&o, 0);
+            break;
+        case K_ARC:
+            for (int i = 0; i < 3; i++) set_style(&o, 0);
+            for (int i = 0; i < 3; i++) set_style(&o, 1);
+            break;
+    }
+    return o;
+}
+
+static void obj_delete(Obj_t* o) {
+    if (o->text >= 0) h_free((uint32_t)o->text);
+    for (int i = 0; i < 2; i++) {
+        if (o->props[i] >= 0) h_free((uint32_t)o->props[i]);
+        if (o->style[i] >= 0) h_free((uint32_t)o->style[i]);
+    }
+    if (o->styles >= 0) h_free((uint32_t)o->styles);
+    if (o->children >= 0) h_free((uint32_t)o->children);
+    if (o->spec >= 0) h_free((uint32_t)o->spec);
+    h_free(o->instance);
+}
+
+typedef struct {
+    const char* name;
+    uint8_t cards;
+    uint8_t kids;           // Per card
+    uint8_t layers;         // 24 KB layers per full redraw
+    uint8_t live;           // Value labels that can change, one per card
+    uint8_t livePct;        // Chance each one changes in a refresh
+    uint8_t alarmRows;      // Rows rebuilt when the alarm table changes
+    std::vector<Obj_t> objs;
+    std::vector<Obj_t> rows;
+    Obj_t root;
+    uint64_t refreshes;     // Intervals this screen was up for
+    uint64_t allocs;
+} Screen_t;
+
+static Screen_t screens[] = {
+    {"Setup", 5, 6, 0, 0, 0, 0, {}, {}, {}, 0, 0},
+    {"Home", 14, 7, 1, 5, 83, 6, {}, {}, {}, 0, 0},
+    {"Sensors", 3, 9, 0, 3, 83, 0, {}, {}, {}, 0, 0},
+    {"Alarms", 12, 4, 0, 0, 0, 0, {}, {}, {}, 0, 0},
+    {"Vision", 9, 7, 1, 2, 30, 0, {}, {}, {}, 0, 0},
+    {"AI", 14, 8, 2, 6, 60, 0, {}, {}, {}, 0, 0},
+    {"Remote", 5, 8, 0, 0, 0, 0, {}, {}, {}, 0, 0},
+    {"Settings", 14, 8, 0, 5, 83, 0, {}, {}, {}, 0, 0},
+};
+#define SCREEN_COUNT    (sizeof(screens) / sizeof(screens[0]))
+#define SCREEN_ALARMS   3
+#define SCREEN_VISION   4
+
+static void rows_clean(Screen_t* s) {
+    for (size_t i = s->rows.size(); i-- > 0;) obj_delete(&s->rows[i]);
+    s->rows.clear();
+}
+
+static void rows_build(Screen_t* s) {
+    for (int r = 0; r < s->alarmRows; r++) s->rows.push_back(obj_create(&s->root, K_LABEL));
+}
+
+static void screen_clean(Screen_t* s) {
+    rows_clean(s);
+    for (size_t i = s->objs.size(); i-- > 0;) obj_delete(&s->objs[i]);
+    s->objs.clear();
+    if (s->root.children >= 0) h_free((uint32_t)s->root.children);
+    if (s->root.spec >= 0) h_free((uint32_t)s->root.spec);
+    s->root.children = s->root.spec = -1;
+    s->root.childCount = 0;
+}
+
+static const int kidKinds[] = {K_LABEL, K_LABEL, K_LABEL, K_BAR, K_LABEL, K_LINE, K_BUTTON, K_ARC, K_LABEL};
+
+static void screen_build(Screen_t* s) {
+    for (int c = 0; c < s->cards; c++) {
+        s->objs.push_back(obj_create(&s->root, K_CONTAINER));
+        size_t card = s->objs.size() - 1;
+        for (int k = 0; k < s->kids; k++) {
+            Obj_t child = obj_create(&s->objs[card], kidKinds[(c + k) % 9]);
+            s->objs.push_back(child);
+        }
+    }
+    rows_build(s);
+}
+
+// First label of card c: the value label the refresh rewrites
+static Obj_t* card_label(Screen_t* s, int c) {
+    int k = 0;
+    while (kidKinds[(c + k) % 9] != K_LABEL) k++;
+    return &s->objs[(size_t)c * (s->kids + 1) + 1 + k];
+}
+
+// One frame of the visible screen: the draw tasks live until the frame
+// is done
+static void render(Screen_t* s, uint32_t objects) {
+    std::vector<uint32_t> frame;
+    frame.reserve(objects * 4 + 4);
+    for (uint32_t i = 0; i < objects; i++) {
+        frame.push_back(h_alloc(88));
+        frame.push_back(h_alloc(between(48, 140)));
+        if (i % 3 == 0) {
+            frame.push_back(h_alloc(88));
+            frame.push_back(h_alloc(between(48, 140)));
+        }
+    }
+    for (int l = 0; s && l < s->layers; l++) frame.push_back(h_alloc(LAYER_BYTES));
+    for (size_t i = 0; i < frame.size(); i++) h_free(frame[i]);
+}
+
+static uint8_t visible = 1;
+static uint8_t demo = 0;
+static bool shown = false;      // The visible screen has been drawn whole
+
+static void refresh(void) {
+    ui_mem_tick(((uint32_t)demo << 8) | visible);
+    Screen_t* s = &screens[visible];
+
+    // Value labels whose text changed
+    uint32_t dirty = 0;
+    for (int c = 0; c < s->live && c < s->cards; c++) {
+        if (xorshift() % 100 < s->livePct) {
+            set_text(card_label(s, c), between(3, 12));
+            dirty++;
+        }
+    }
+    // Alarm table changed: Home rebuilds its rows, Alarms rebinds its list
+    if (xorshift() % 10 == 0) {
+        if (s->alarmRows) {
+            rows_clean(s);
+            rows_build(s);
+            dirty += s->alarmRows;
+        } else if (visible == SCREEN_ALARMS) {
+            for (size_t i = 1; i < s->objs.size(); i += s->kids + 1) {
+                set_text(&s->objs[i], between(12, 48));
+                dirty++;
+            }
+        }
+    }
+
+    if (!shown) {
+        render(s, (uint32_t)(s->objs.size() + s->rows.size()));
+        shown = true;
+    } else if (dirty) {
+        render(NULL, dirty);
+    }
+    if (visible == SCREEN_VISION) {
+        for (int f = 0; f < 15; f++) render(NULL, 1);
+    }
+}
+
+static void demo_change(void) {
+    for (size_t i = 0; i < SCREEN_COUNT; i++) {
+        screen_clean(&screens[i]);
+        screen_build(&screens[i]);
+    }
+    shown = false;
+}
+
+static void model_reset(void) {
+    for (size_t i = 0; i < SCREEN_COUNT; i++) {
+        screens[i].objs.clear();
+        screens[i].rows.clear();
+        memset(&screens[i].root, 0xFF, sizeof(Obj_t));
+        screens[i].root.childCount = 0;
+        screens[i].refreshes = screens[i].allocs = 0;
+    }
+    slots.clear();
+    freeSlots.clear();
+    ops = corrupt = 0;
+    rng = 0x9E3779B9;
+    visible = 1;
+    demo = 0;
+    shown = false;
+}
+
+// ============ Soak ============
+typedef struct {
+    uint32_t hours;
+    size_t poolKb;
+    size_t arenaKb;
+    size_t singleKb;
+} Layout_t;
+
+// False when the heap broke or a block was overwritten; running out of
+// room is a finding, not a failure
+static bool soak(const char* title, const Layout_t* l, bool record) {
+    model_reset();
+    if (!ui_mem_init(UI_MEM_TLSF, l->poolKb * 1024, l->arenaKb * 1024, LARGE_MIN)) {
+        printf("%s: no pool\n", title);
+        return false;
+    }
+    size_t minLargest = (size_t)-1;
+    uint8_t maxFrag = 0;
+    bool sound = true;
+    uint32_t ticks = l->hours * 3600;
+    double t0 = now_ns();
+
+    demo_change();
+    recording = record;
+    for (uint32_t k = 0; k < ticks; k++) {
+        if (k > 0 && k % DEMO_TICKS == 0) {
+            demo = (uint8_t)((demo + 1) % 4);
+            demo_change();
+        }
+        if (k > 0 && k % VIEW_TICKS == 0) {
+            uint8_t next;
+            do next = (uint8_t)between(1, SCREEN_COUNT - 1); while (next == visible);
+            visible = next;
+            shown = false;
+        }
+        uint8_t up = visible;
+        refresh();
+        if (record && k + 1 == 3600) recording = false;
+
+        // What the last interval cost, for the screen that was up in it
+        const UiMemStats_t* st = ui_mem_get_stats();
+        if (k > 0) {
+            screens[up].refreshes++;
+            screens[up].allocs += st->tickAllocs;
+        }
+        if (st->pool.largest < minLargest) minLargest = st->pool.largest;
+        if (st->pool.fragPct > maxFrag) maxFrag = st->pool.fragPct;
+        if (k % CHECK_TICKS == 0 && !ui_mem_check()) sound = false;
+    }
+    recording = false;
+    for (size_t i = 0; i < SCREEN_COUNT; i++) screen_clean(&screens[i]);
+    if (!ui_mem_check()) sound = false;
+    double secs = (now_ns() - t0) / 1e9;
+
+    const UiMemStats_t* st = ui_mem_get_stats();
+    printf("%s\n", title);
+    printf("  %lu h in %.1f s: %llu calls, %lu failed, %lu spills, %llu blocks corrupted, heap %s, "
+           "%lu blocks left\n",
+           (unsigned long)l->hours, secs, (unsigned long long)ops, (unsigned long)st->failures,
+           (unsigned long)st->spills, (unsigned long long)corrupt, sound ? "sound" : "BROKEN",
+           (unsigned long)(st->pool.blocks + st->arena.blocks));
+    printf("  pool: %zu KB, peak %.1f KB used, largest free never under %.1f KB, frag up to %u%%\n",
+           st->pool.size / 1024, st->pool.usedMax / 1024.0, minLargest / 1024.0, maxFrag);
+    if (st->arena.size) {
+        printf("  arena: %zu KB, peak %.1f KB used\n", st->arena.size / 1024, st->arena.usedMax / 1024.0);
+    }
+    printf("  per refresh: %.0f allocations avg, %lu max; %lu of %lu steady refreshes over %d\n",
+           st->avgTickAllocs, (unsigned long)st->maxTickAllocs, (unsigned long)st->steadyOverTicks,
+           (unsigned long)st->steadyTicks, UI_MEM_STEADY_ALLOCS);
+    printf("  allocations per refresh by screen up:");
+    for (size_t i = 1; i < SCREEN_COUNT; i++) {
+        if (screens[i].refreshes) printf(" %s %.0f", screens[i].name, (double)screens[i].allocs / screens[i].refreshes);
+    }
+    printf("\n");
+    ui_mem_deinit();
+    return sound && corrupt == 0;
+}
+
+// ============ Timing ============
+static double replay(uint8_t backend, const Layout_t* l) {
+    ui_mem_init(backend, l->poolKb * 1024, l->arenaKb * 1024, LARGE_MIN);
+    std::vector<void*> ptr(slots.size() + 1, NULL);
+    double t = now_ns();
+    for (size_t i = 0; i < trace.size(); i++) {
+        const TraceOp_t* o = &trace[i];
+        if (o->op == OP_ALLOC) ptr[o->slot] = ui_mem_alloc(o->size);
+        else if (o->op == OP_REALLOC) {
+            void* p = ui_mem_realloc(ptr[o->slot], o->size);
+            if (p) ptr[o->slot] = p;
+        } else {
+            ui_mem_free(ptr[o->slot]);
+            ptr[o->slot] = NULL;
+        }
+    }
+    double ns = (now_ns() - t) / trace.size();
+    for (size_t i = 0; i < ptr.size(); i++) ui_mem_free(ptr[i]);
+    ui_mem_deinit();
+    return ns;
+}
+
+int main(int argc, char** argv) {
+    Layout_t l = {24, 192, 512, 128};
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-h") == 0) l.hours = (uint32_t)atol(argv[a + 1]);
+        else if (strcmp(argv[a], "-p") == 0) l.poolKb = (size_t)atol(argv[a + 1]);
+        else if (strcmp(argv[a], "-a") == 0) l.arenaKb = (size_t)atol(argv[a + 1]);
+        else if (strcmp(argv[a], "-s") == 0) l.singleKb = (size_t)atol(argv[a + 1]);
+    }
+    printf("workload: one refresh per simulated second, another screen every %d s, another demo every %d s\n",
+           VIEW_TICKS, DEMO_TICKS);
+
+    Layout_t single = l;
+    single.poolKb = l.singleKb;
+    single.arenaKb = 0;
+    char title[96];
+    snprintf(title, sizeof(title), "one %zu KB pool (what LV_STDLIB_BUILTIN with LV_MEM_SIZE gives):", single.poolKb);
+    bool ok = soak(title, &single, false);
+    snprintf(title, sizeof(title), "%zu KB internal pool + %zu KB PSRAM arena from %d B:", l.poolKb, l.arenaKb,
+             LARGE_MIN);
+    ok = soak(title, &l, true) && ok;
+
+    double tlsfNs = replay(UI_MEM_TLSF, &l);
+    double clibNs = replay(UI_MEM_CLIB, &l);
+    printf("time per call, first hour replayed (%zu calls): TLSF %.1f ns, system malloc %.1f ns\n",
+           trace.size(), tlsfNs, clibNs);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+// SIGNALTAP Spindle Vibration Bench (host)
+// Synthetic accelerometer signals through the bearing pipeline
+// (src/dsp/vibration_analysis), and what the CNC acquisition costs the
+// simulation tick.
+//  - Signals: one second at 20 kHz from vib_synth per case (spindle speed
+//    over the CNC profile's 0-8000 rpm, defect, severity) into a fresh
+//    analyzer, as the simulation runs it
+//  - Checks, exit 1 on a failure: a healthy bearing reads clean, every
+//    defect at full severity is named with its band at the frequency
+//    vib_bearing_frequencies gives for the speed, a stopped spindle reads
+//    stopped
+//  - Time per simulated second of signal and the pipeline load it implies,
+//    and the last spectrum's cost as VibStats_t reports it on the device
+//  - Tick: the CNC demo stepped one tick at a time with no vibration task
+//    (as on the host), so the acquisition runs inline once per
+//    SIM_VIB_INLINE_S; average and worst tick against the ticks between
+//
+// Build: make -C tools vib_bench (tools/Makefile, against tools/host/Arduino.h)
+// Run it from a scratch directory: the simulation's store writes there.
+//
+// Usage: vib_bench [-t ticks (600)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "../src/data/simulation_engine.h"
+
+#define SIGNAL_RATE_HZ  SIM_VIB_RATE_HZ
+#define SIGNAL_BLOCK    SIM_VIB_BLOCK
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t failures = 0;
+
+static void fail(const char* what, float rpm, VibDefect_t defect) {
+    if (failures < 10) printf("  FAILED: %s (%.0f rpm, %s)\n", what, rpm, vib_defect_name(defect));
+    failures++;
+}
+
+// ============ Signals ============
+static VibAnalyzer_t va;
+static VibSynth_t vs;
+
+// One second of signal through a fresh analyzer; returns the ns it took
+static double run_signal(float rpm, VibDefect_t defect, float severity) {
+    int16_t block[SIGNAL_BLOCK];
+    vib_init(&va, SIGNAL_RATE_HZ, NULL);
+    vib_synth_init(&vs, 0x5EED);
+    vib_set_rpm(&va, rpm);
+    double t = now_ns();
+    for (int done = 0; done < SIGNAL_RATE_HZ; done += SIGNAL_BLOCK) {
+        vib_synth(&vs, block, SIGNAL_BLOCK, SIGNAL_RATE_HZ, rpm, defect, severity, NULL);
+        vib_process(&va, block, SIGNAL_BLOCK);
+    }
+    return now_ns() - t;
+}
+
+static void check_case(float rpm, VibDefect_t defect, float severity) {
+    const VibResult_t* r = &va.result;
+    if (!r->valid) {
+        fail("no envelope result", rpm, defect);
+        return;
+    }
+    if (rpm < VIB_MIN_RPM) {
+        if (r->rpm >= VIB_MIN_RPM || r->defect != VIB_DEFECT_NONE) fail("not read as stopped", rpm, defect);
+        return;
+    }
+    VibDefect_t want = severity > 0 ? defect : VIB_DEFECT_NONE;
+    if (r->defect != want) {
+        fail(want == VIB_DEFECT_NONE ? "defect on a healthy bearing" : "wrong defect", rpm, defect);
+        return;
+    }
+    float freqs[VIB_DEFECT_BANDS];
+    vib_bearing_frequencies(&va.bearing, rpm, freqs);
+    for (int b = 0; b < VIB_DEFECT_BANDS; b++) {
+        if (fabsf(r->freqHz[b] - freqs[b]) > 0.01f * freqs[b]) fail("band frequency", rpm, defect);
+    }
+}
+
+static void signals(void) {
+    static const float speeds[] = {0.0f, 1500.0f, 4200.0f, 8000.0f};   // The CNC spindle range
+    printf("signals, 1 s at %u Hz each:\n", SIGNAL_RATE_HZ);
+    double worstNs = 0;
+    for (size_t s = 0; s < sizeof(speeds) / sizeof(speeds[0]); s++) {
+        for (int d = VIB_DEFECT_NONE; d <= VIB_DEFECT_BANDS; d++) {
+            VibDefect_t defect = d == VIB_DEFECT_NONE ? VIB_DEFECT_OUTER : (VibDefect_t)d;
+            float severity = d == VIB_DEFECT_NONE ? 0.0f : 1.0f;
+            double ns = run_signal(speeds[s], defect, severity);
+            if (ns > worstNs) worstNs = ns;
+            check_case(speeds[s], defect, severity);
+            const VibResult_t* r = &va.result;
+            printf("  %6.0f rpm %-6s sev %.1f: %-6s %+5.1f dB (BPFO %+5.1f BPFI %+5.1f BSF %+5.1f), "
+                   "rms %.2f g, %.2f ms\n",
+                   speeds[s], severity > 0 ? vib_defect_band(defect) : "-", severity,
+                   r->defect != VIB_DEFECT_NONE ? vib_defect_band(r->defect) : "clean", r->defectDb,
+                   r->levelDb[0], r->levelDb[1], r->levelDb[2], r->rmsG, ns / 1e6);
+        }
+    }
+    printf("  worst %.2f ms per simulated second (load %.2f%% of real time), spectrum %lu us (%s)\n",
+           worstNs / 1e6, worstNs / 1e9 * 100.0, (unsigned long)va.stats.spectrumUs, vib_fft_kernel());
+}
+
+// ============ Tick ============
+static void ticks(uint32_t n) {
+    sim_init();
+    sim_set_demo(0);
+    double sum = 0, worst = 0, quiet = 0;
+    uint32_t quietTicks = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t vibBefore = sim_get_vibration_stats()->samples;
+        double t = now_ns();
+        sim_step(SIM_TICK_MS, 1);
+        double ns = now_ns() - t;
+        sum += ns;
+        if (ns > worst) worst = ns;
+        if (sim_get_vibration_stats()->samples == vibBefore) {
+            quiet += ns;
+            quietTicks++;
+        }
+    }
+    const VibStats_t* vib = sim_get_vibration_stats();
+    uint32_t acquisitions = vib->samples / SIM_VIB_RATE_HZ;
+    printf("tick, %s, %lu ticks: %lu acquisitions inline (1 per %u s), avg %.1f us/tick, worst %.1f us, "
+           "%.1f us without one\n",
+           sim_get_demo()->name, (unsigned long)n, (unsigned long)acquisitions, SIM_VIB_INLINE_S,
+           sum / n / 1e3, worst / 1e3, quietTicks ? quiet / quietTicks / 1e3 : 0.0);
+    uint32_t expect = (n + SIM_VIB_INLINE_S - 1) / SIM_VIB_INLINE_S;
+    if (acquisitions != expect) {
+        printf("  FAILED: %lu acquisitions, expected %lu\n", (unsigned long)acquisitions,
+               (unsigned long)expect);
+        failures++;
+    }
+    if (!sim_get_vibration()->valid) {
+        printf("  FAILED: no diagnosis reached the simulation\n");
+        failures++;
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32_t n = 600;
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-t") == 0) n = (uint32_t)atol(argv[a + 1]);
+    }
+    signals();
+    ticks(n);
+    printf("%s\n", failures ? "checks FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,422 @@
+// SIGNALTAP Vision Bench (host)
+// Runs the ROI vision engine (src/vision/roi_engine) over a 1280x720 frame
+// sequence at 30 fps and checks what it reads against a script: the CNC
+// table of src/vision/vision_rois.h, with lamps switching on and off,
+// blinking at 0.5 to 2 Hz and going from blinking to steady, under sensor
+// noise and +-8% exposure flicker. The frames are rendered in memory, or
+// read from PPM files (P6): the same script written out by `write` (-c to
+// check them too), or a real camera's frames, which are only timed.
+//
+// Reports the engine's time per frame against the 33.3 ms frame interval,
+// the plain reference kernel over the same ROIs, and both over the whole
+// frame (every pixel an ROI, the upper bound), after checking the two
+// kernels agree on every ROI of every frame. The check counts the frames a
+// lamp reads wrong outside the settling time each change is allowed:
+// VISION_DEBOUNCE_FRAMES for a steady change, 3 periods to recognise a
+// blink, 1.5 periods for one to stop.
+//
+// Build: make -C tools vision_bench (tools/Makefile, against tools/host/Arduino.h)
+// vision_bench_portable is the same bench built with -U__SSE2__, on the
+// portable kernel the device runs
+//
+// Usage:
+//   vision_bench run [-s seconds (10)] [-c] [dir of .ppm frames]
+//   vision_bench write <dir> [-s seconds (4)]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "../src/vision/roi_engine.h"
+#include "../src/vision/vision_rois.h"
+
+#define FRAME_W         1280
+#define FRAME_H         720
+#define FRAME_MS        (1000.0 / VISION_FPS)
+#define SETTLE_MS       ((VISION_DEBOUNCE_FRAMES + 1) * 1000 / VISION_FPS)
+
+// ============ Script ============
+typedef enum { OFF = 0, ON, BLINK } Mode_t;
+
+typedef struct {
+    uint32_t fromMs;
+    uint8_t mode;
+    uint16_t periodMs;
+} Segment_t;
+
+#define MAX_SEGMENTS 4
+
+// Per lamp of visionRoisCnc, segments in time order
+static const Segment_t script[VISION_ROI_COUNT_CNC][MAX_SEGMENTS] = {
+    {{0, OFF, 0}, {4000, ON, 0}, {6000, OFF, 0}},                   // Stack red
+    {{0, OFF, 0}, {2000, BLINK, 800}, {7000, OFF, 0}},              // Stack yellow
+    {{0, ON, 0}, {4000, OFF, 0}, {6000, ON, 0}},                    // Stack green
+    {{0, ON, 0}},                                                   // Run
+    {{0, OFF, 0}, {3000, ON, 0}},                                   // Feed
+    {{0, OFF, 0}, {1000, ON, 0}, {8000, OFF, 0}},                   // Spindle
+    {{0, BLINK, 500}},                                              // Coolant
+    {{0, ON, 0}},                                                   // Program
+    {{0, OFF, 0}, {4000, ON, 0}, {6000, OFF, 0}},                   // Error
+    {{0, OFF, 0}},                                                  // Fault
+    {{0, BLINK, 1000}, {5000, ON, 0}},                              // Ready
+};
+
+static const Segment_t* segment_at(uint8_t lamp, uint32_t t, const Segment_t** prev) {
+    const Segment_t* s = &script[lamp][0];
+    *prev = NULL;
+    for (int i = 1; i < MAX_SEGMENTS; i++) {
+        const Segment_t* n = &script[lamp][i];
+        if (n->fromMs == 0 || n->fromMs > t) break;
+        *prev = s;
+        s = n;
+    }
+    return s;
+}
+
+// Lamp physically lit at t
+static bool lamp_lit(uint8_t lamp, uint32_t t) {
+    const Segment_t* prev;
+    const Segment_t* s = segment_at(lamp, t, &prev);
+    if (s->mode == BLINK) return (t - s->fromMs) % s->periodMs < s->periodMs / 2u;
+    return s->mode == ON;
+}
+
+// What the engine should say at t; false while the change is settling
+static bool lamp_expected(uint8_t lamp, uint32_t t, bool* on) {
+    const Segment_t* prev;
+    const Segment_t* s = segment_at(lamp, t, &prev);
+    *on = s->mode != OFF;
+    uint32_t settle = SETTLE_MS;
+    if (s->mode == BLINK) settle += 3u * s->periodMs;
+    else if (prev && prev->mode == BLINK) settle += prev->periodMs * 3u / 2u;
+    if (!prev && s->mode != BLINK) return t >= settle;
+    return t - s->fromMs >= settle;
+}
+
+// ============ Rendering ============
+static uint32_t rng = 0x2545F491;
+
+static uint32_t xorshift(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint8_t clamp8(int v) {
+    return (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+static void lamp_rgb(uint8_t color, int rgb[3]) {
+    switch (color) {
+    case ROI_COLOR_RED:    rgb[0] = 255; rgb[1] = 30;  rgb[2] = 20;  break;
+    case ROI_COLOR_YELLOW: rgb[0] = 255; rgb[1] = 190; rgb[2] = 0;   break;
+    case ROI_COLOR_GREEN:  rgb[0] = 30;  rgb[1] = 230; rgb[2] = 60;  break;
+    case ROI_COLOR_BLUE:   rgb[0] = 30;  rgb[1] = 80;  rgb[2] = 255; break;
+    default:               rgb[0] = 240; rgb[1] = 240; rgb[2] = 230; break;
+    }
+}
+
+// Cabinet background: grey gradient, a darker panel under the LED row and
+// a bright window the ROIs must not care about
+static void render_background(uint8_t* rgb) {
+    for (int y = 0; y < FRAME_H; y++) {
+        for (int x = 0; x < FRAME_W; x++) {
+            int g = 50 + 60 * x / FRAME_W;
+            if (y > 520 && y < 620 && x > 440 && x < 1100) g = 35;
+            if (y < 200 && x > 1000) g = 235;
+            uint8_t* p = rgb + 3 * (y * FRAME_W + x);
+            p[0] = (uint8_t)g;
+            p[1] = (uint8_t)g;
+            p[2] = (uint8_t)(g + 6 > 255 ? 255 : g + 6);
+        }
+    }
+}
+
+// Lamps as discs a little larger than their ROI: white-hot centre fading
+// to the lamp colour when lit, dim tinted glass when off
+static void render_frame(uint8_t* rgb, const uint8_t* background, uint32_t t) {
+    memcpy(rgb, background, FRAME_W * FRAME_H * 3);
+    int gain = 92 + (int)(xorshift() % 17);   // Exposure flicker, percent
+    for (uint8_t i = 0; i < VISION_ROI_COUNT_CNC; i++) {
+        const RoiDef_t* r = &visionRoisCnc[i];
+        bool lit = lamp_lit(i, t);
+        int col[3];
+        lamp_rgb(r->color, col);
+        int cx = r->x + r->w / 2, cy = r->y + r->h / 2;
+        int rad = (r->w > r->h ? r->w : r->h) * 6 / 10;
+        for (int y = cy - rad; y <= cy + rad; y++) {
+            for (int x = cx - rad; x <= cx + rad; x++) {
+                int d2 = (x - cx) * (x - cx) + (y - cy) * (y - cy);
+                if (d2 > rad * rad) continue;
+                uint8_t* p = rgb + 3 * (y * FRAME_W + x);
+                for (int c = 0; c < 3; c++) {
+                    int v;
+                    if (lit) {
+                        // Centre third burnt out to white, then the colour
+                        int hot = 255 - 255 * d2 * 9 / (rad * rad * 4);
+                        v = hot > col[c] ? hot : col[c];
+                    } else {
+                        v = 18 + col[c] / 5;
+                    }
+                    v = v * gain / 100 + (int)(xorshift() % 21) - 10;
+                    p[c] = clamp8(v);
+                }
+            }
+        }
+    }
+}
+
+// BT.601 full range, chroma of each pixel pair averaged
+static void rgb_to_yuyv(const uint8_t* rgb, uint8_t* yuyv, int w, int h) {
+    for (int i = 0; i < w * h; i += 2, rgb += 6, yuyv += 4) {
+        int r = rgb[0] + rgb[3], g = rgb[1] + rgb[4], b = rgb[2] + rgb[5];
+        yuyv[0] = clamp8((77 * rgb[0] + 150 * rgb[1] + 29 * rgb[2]) >> 8);
+        yuyv[2] = clamp8((77 * rgb[3] + 150 * rgb[4] + 29 * rgb[5]) >> 8);
+        yuyv[1] = clamp8(((-43 * r - 85 * g + 128 * b) >> 9) + 128);
+        yuyv[3] = clamp8(((128 * r - 107 * g - 21 * b) >> 9) + 128);
+    }
+}
+
+// ============ PPM files ============
+static bool write_ppm(const char* path, const uint8_t* rgb, int w, int h) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P6\n%d %d\n255\n", w, h);
+    bool ok = fwrite(rgb, 3, (size_t)w * h, f) == (size_t)w * h;
+    return fclose(f) == 0 && ok;
+}
+
+static int ppm_int(FILE* f) {
+    int c = fgetc(f);
+    while (c == '#' || c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+        if (c == '#') while (c != '\n' && c != EOF) c = fgetc(f);
+        c = fgetc(f);
+    }
+    int v = 0;
+    for (; c >= '0' && c <= '9'; c = fgetc(f)) v = v * 10 + (c - '0');
+    return v;
+}
+
+static bool read_ppm(const char* path, std::vector<uint8_t>* rgb, int* w, int* h) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    bool ok = fgetc(f) == 'P' && fgetc(f) == '6';
+    if (ok) {
+        *w = ppm_int(f);
+        *h = ppm_int(f);
+        ok = ppm_int(f) == 255 && *w > 0 && *h > 0 && (*w & 1) == 0;
+    }
+    if (ok) {
+        rgb->resize((size_t)*w * *h * 3);
+        ok = fread(rgb->data(), 1, rgb->size(), f) == rgb->size();
+    }
+    fclose(f);
+    return ok;
+}
+
+static std::vector<std::string> list_ppm(const char* dir) {
+    std::vector<std::string> files;
+    DIR* d = opendir(dir);
+    if (!d) return files;
+    while (struct dirent* e = readdir(d)) {
+        size_t n = strlen(e->d_name);
+        if (n > 4 && strcmp(e->d_name + n - 4, ".ppm") == 0) files.push_back(std::string(dir) + "/" + e->d_name);
+    }
+    closedir(d);
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+// ============ Helper: Timing ============
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static double time_kernel(bool ref, const uint8_t* frame, const RoiDef_t* rois, int n, int reps) {
+    RoiStats_t s;
+    uint32_t sink = 0;
+    double t0 = now_us();
+    for (int k = 0; k < reps; k++) {
+        for (int i = 0; i < n; i++) {
+            const RoiDef_t* r = &rois[i];
+            if (ref) roi_stats_ref(frame, FRAME_W * 2, r->x, r->y, r->w, r->h, VISION_THR_Y, &s);
+            else roi_stats(frame, FRAME_W * 2, r->x, r->y, r->w, r->h, VISION_THR_Y, &s);
+            sink += s.bright;
+        }
+    }
+    double us = (now_us() - t0) / reps;
+    if (sink == 0xFFFFFFFF) printf(" ");
+    return us;
+}
+
+// ============ Modes ============
+static int cmd_write(const char* dir, float seconds) {
+    std::vector<uint8_t> background(FRAME_W * FRAME_H * 3), rgb(FRAME_W * FRAME_H * 3);
+    render_background(background.data());
+    int frames = (int)(seconds * VISION_FPS);
+    for (int f = 0; f < frames; f++) {
+        render_frame(rgb.data(), background.data(), (uint32_t)(f * FRAME_MS));
+        char path[512];
+        snprintf(path, sizeof(path), "%s/frame_%05d.ppm", dir, f);
+        if (!write_ppm(path, rgb.data(), FRAME_W, FRAME_H)) {
+            fprintf(stderr, "%s: cannot write\n", path);
+            return 1;
+        }
+    }
+    printf("%d frames (%.1f s) written to %s\n", frames, seconds, dir);
+    return 0;
+}
+
+static int cmd_run(const char* dir, float seconds, bool scripted) {
+    std::vector<std::string> files;
+    int frames = (int)(seconds * VISION_FPS);
+    if (dir) {
+        files = list_ppm(dir);
+        if (files.empty()) {
+            fprintf(stderr, "%s: no .ppm frames\n", dir);
+            return 1;
+        }
+        frames = (int)files.size();
+    }
+
+    std::vector<uint8_t> background(FRAME_W * FRAME_H * 3), rgb;
+    std::vector<uint8_t> yuyv(FRAME_W * FRAME_H * 2);
+    render_background(background.data());
+    rgb.resize(FRAME_W * FRAME_H * 3);
+
+    static RoiEngine_t eng;
+    vision_init(&eng, visionRoisCnc, VISION_ROI_COUNT_CNC);
+    const int n = VISION_ROI_COUNT_CNC;
+    const RoiDef_t whole = {0, 0, FRAME_W, FRAME_H, ROI_LED, 0, ROI_COLOR_ANY};
+
+    uint32_t wrong[VISION_ROI_COUNT_CNC] = {0}, checked = 0, mismatches = 0, kernelDiffs = 0;
+    float blinkHz[VISION_ROI_COUNT_CNC] = {0};
+    double engineUs = 0, engineMax = 0, refUs = 0, wholeUs = 0, wholeRefUs = 0;
+
+    for (int f = 0; f < frames; f++) {
+        uint32_t t = (uint32_t)(f * FRAME_MS);
+        if (dir) {
+            int w, h;
+            if (!read_ppm(files[f].c_str(), &rgb, &w, &h) || w != FRAME_W || h != FRAME_H) {
+                fprintf(stderr, "%s: not a %dx%d P6 frame\n", files[f].c_str(), FRAME_W, FRAME_H);
+                return 1;
+            }
+        } else {
+            render_frame(rgb.data(), background.data(), t);
+        }
+        rgb_to_yuyv(rgb.data(), yuyv.data(), FRAME_W, FRAME_H);
+
+        // Kernels must agree bit for bit
+        for (int i = 0; i < n; i++) {
+            const RoiDef_t* r = &eng.rois[i];
+            RoiStats_t a, b;
+            roi_stats(yuyv.data(), FRAME_W * 2, r->x, r->y, r->w, r->h, VISION_THR_Y, &a);
+            roi_stats_ref(yuyv.data(), FRAME_W * 2, r->x, r->y, r->w, r->h, VISION_THR_Y, &b);
+            if (memcmp(&a, &b, sizeof(a)) != 0) kernelDiffs++;
+        }
+
+        double t0 = now_us();
+        vision_process(&eng, yuyv.data(), FRAME_W, FRAME_H, FRAME_W * 2, t);
+        double us = now_us() - t0;
+        engineUs += us;
+        if (us > engineMax) engineMax = us;
+        refUs += time_kernel(true, yuyv.data(), eng.rois, n, 1);
+        if (f % 30 == 0) {
+            wholeUs += time_kernel(false, yuyv.data(), &whole, 1, 1);
+            wholeRefUs += time_kernel(true, yuyv.data(), &whole, 1, 1);
+        }
+
+        for (int i = 0; i < n; i++) {
+            bool on = vision_lamp_on(&eng, (uint8_t)i), expect;
+            if (vision_lamp(&eng, (uint8_t)i)->blinking) blinkHz[i] = vision_lamp(&eng, (uint8_t)i)->blinkHz;
+            if (!lamp_expected((uint8_t)i, t, &expect)) continue;
+            checked++;
+            if (on != expect) {
+                wrong[i]++;
+                mismatches++;
+            }
+        }
+    }
+
+    int wholeRuns = (frames + 29) / 30;
+    const VisionStats_t* vs = vision_get_stats(&eng);
+    printf("%d frames %dx%d%s, %d ROIs, %lu ROI pixels/frame (%.1f%% of the frame)\n",
+           frames, FRAME_W, FRAME_H, dir ? " from files" : " rendered", n,
+           (unsigned long)vs->pixels, vs->pixels * 100.0 / (FRAME_W * FRAME_H));
+    printf("kernel (%s) vs reference: %lu differing ROI results\n",
+#if defined(__SSE2__)
+           "SSE2",
+#else
+           "portable",
+#endif
+           (unsigned long)kernelDiffs);
+    printf("engine: %.1f us/frame avg, %.1f max = %.2f%% of the %.1f ms frame interval "
+           "(engine stats: load %.2f%%, headroom %.2f%%)\n",
+           engineUs / frames, engineMax, engineUs / frames * 100.0 / VISION_FRAME_US,
+           VISION_FRAME_US / 1000.0, vs->loadPct, vs->headroomPct);
+    printf("reference kernel, same ROIs: %.1f us/frame\n", refUs / frames);
+    printf("whole frame as one ROI: kernel %.0f us, reference %.0f us (%.1f%% / %.1f%% of 33.3 ms)\n",
+           wholeUs / wholeRuns, wholeRefUs / wholeRuns, wholeUs / wholeRuns * 100.0 / VISION_FRAME_US,
+           wholeRefUs / wholeRuns * 100.0 / VISION_FRAME_US);
+    if (!scripted) {
+        printf("recognition not checked (-c for frames written by write)\n");
+        return 0;
+    }
+    printf("recognition: %lu lamp-frames checked, %lu wrong, %lu debounced changes\n",
+           (unsigned long)checked, (unsigned long)mismatches, (unsigned long)vs->changes);
+    static const char* names[VISION_ROI_COUNT_CNC] = {
+        "stack red", "stack yellow", "stack green", "run", "feed", "spindle",
+        "coolant", "program", "error", "fault", "ready",
+    };
+    for (int i = 0; i < n; i++) {
+        const RoiState_t* st = vision_lamp(&eng, (uint8_t)i);
+        printf("  %-12s %3lu wrong  last colour %-6s bright %3u%%", names[i], (unsigned long)wrong[i],
+               vision_color_name((RoiColor_t)st->color), st->brightPct);
+        if (blinkHz[i] > 0) printf("  blink %.2f Hz", blinkHz[i]);
+        printf("\n");
+    }
+
+    Vision_t v;
+    memset(&v, 0, sizeof(v));
+    v.stackLight = "";
+    vision_apply(&eng, &v, (uint32_t)((frames - 1) * FRAME_MS));
+    printf("Vision_t at the end: stackLight \"%s\", leds run %d feed %d spindle %d coolant %d "
+           "program %d error %d fault %d ready %d\n", v.stackLight, v.leds.run, v.leds.feed,
+           v.leds.spindle, v.leds.coolant, v.leds.program, v.leds.error, v.leds.fault, v.leds.ready);
+    return mismatches || kernelDiffs ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s run [-s seconds] [-c] [dir] | write <dir> [-s seconds]\n", argv[0]);
+        return 2;
+    }
+    bool write = strcmp(argv[1], "write") == 0;
+    float seconds = write ? 4.0f : 10.0f;
+    const char* dir = NULL;
+    bool check = false;
+    for (int a = 2; a < argc; a++) {
+        if (strcmp(argv[a], "-s") == 0 && a + 1 < argc) seconds = (float)atof(argv[++a]);
+        else if (strcmp(argv[a], "-c") == 0) check = true;
+        else dir = argv[a];
+    }
+    if (write) {
+        if (!dir) {
+            fprintf(stderr, "write: no directory\n");
+            return 2;
+        }
+        return cmd_write(dir, seconds);
+    }
+    if (strcmp(argv[1], "run") != 0) {
+        fprintf(stderr, "unknown command %s\n", argv[1]);
+        return 2;
+    }
+    return cmd_run(dir, seconds, !dir || check);
+}
@@ -0,0 +1,386 @@
+// SIGNALTAP Web Bench (host)
+// Runs the headless simulation with the web server (src/net/web_server) on
+// a loopback port and loads it with socket clients from the same process.
+// Each client fetches the page and the history, checks them, upgrades to a
+// WebSocket and reads the live stream; stalled clients (-z) upgrade and
+// then never read, with a small receive buffer, to show that one slow
+// reader costs the others nothing and memory stays bounded. One snapshot
+// is published per simulated second, followed by -p server / client poll
+// passes, as fast as the host allows. Reports server CPU per tick, message
+// latency from publish to a client's read, and the pool and skip counts.
+// Connections past WEB_MAX_CLIENTS are refused (503) by design.
+// Exit 1 if a client failed, a client is unaccounted for (not streaming,
+// stalled or refused), or a streaming client missed more than
+// BENCH_LATE_S of the run's snapshots (read or knowingly skipped).
+//
+// -s serves in real time instead, to open the dashboard in a browser
+// (http://localhost:<port>/) or load it with an outside client.
+//
+// Build: make -C tools web_bench (tools/Makefile, against tools/host/Arduino.h)
+// Run it from a scratch directory: the simulation's store writes there.
+//
+// Usage:
+//   web_bench [-c clients (4)] [-z stalled clients (0)] [-t sim seconds (600)]
+//             [-p passes per tick (10)] [-d demo (0)] [port (8080)]
+//   web_bench -s 1 [-d demo] [port]
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include "../src/net/live_state.h"
+#include "../src/net/web_server.h"
+#include "../src/net/web_index.h"
+#include "../src/data/simulation_engine.h"
+
+#define BENCH_MAX_CLIENTS   64
+#define BENCH_RX_BYTES      65536
+#define BENCH_SEQ_RING      4096
+#define BENCH_LATE_S        5       // Snapshots a streaming client may miss (connect, last tick)
+#define BENCH_WS_KEY        "dGhlIHNhbXBsZSBub25jZQ=="      // RFC 6455 sample
+#define BENCH_WS_ACCEPT     "s3pPLMBiTxaQ9kYGzzhZRbK+xOo="
+
+typedef enum {
+    CLIENT_PAGE = 0,
+    CLIENT_HISTORY,
+    CLIENT_UPGRADE,
+    CLIENT_STREAM,
+    CLIENT_STALLED,
+    CLIENT_REFUSED,
+    CLIENT_FAILED
+} ClientPhase_t;
+
+typedef struct {
+    int fd;
+    uint8_t phase;
+    bool stall;
+    const char* request;        // Still to send once connected
+    uint8_t rx[BENCH_RX_BYTES];
+    uint32_t rxLen;
+    double phaseUs;             // Request sent
+    double pageUs;
+    double historyUs;
+    uint32_t historyPoints;
+    uint32_t messages;
+    uint32_t fulls;
+    uint32_t lastSeq;
+    uint32_t gaps;              // Snapshots skipped between two messages
+    double latencySum;
+    double latencyMax;
+    uint64_t bytes;
+} Client_t;
+
+static LiveState_t live;
+static WebServer_t web;
+static Client_t clients[BENCH_MAX_CLIENTS];
+static double publishUs[BENCH_SEQ_RING];
+static uint16_t port = 8080;
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static double cpu_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// ============ Client side ============
+// Non-blocking connect: past the server's listen backlog a blocking one
+// would wait for an accept that this same loop has to make
+static bool client_connect(Client_t* c, const char* request) {
+    c->fd = socket(AF_INET, SOCK_STREAM, 0);
+    fcntl(c->fd, F_SETFL, fcntl(c->fd, F_GETFL) | O_NONBLOCK);
+    if (c->stall && c->phase == CLIENT_UPGRADE) {
+        int small = 4096;
+        setsockopt(c->fd, SOL_SOCKET, SO_RCVBUF, &small, sizeof(small));
+    }
+    struct sockaddr_in a;
+    memset(&a, 0, sizeof(a));
+    a.sin_family = AF_INET;
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    a.sin_port = htons(port);
+    if (connect(c->fd, (struct sockaddr*)&a, sizeof(a)) != 0 && errno != EINPROGRESS) return false;
+    c->rxLen = 0;
+    c->request = request;
+    c->phaseUs = now_us();
+    return true;
+}
+
+// Connected yet? Then send the request; false if the connect failed
+static bool client_send(Client_t* c) {
+    struct pollfd p = {c->fd, POLLOUT, 0};
+    if (poll(&p, 1, 0) <= 0) return true;
+    int err = 0;
+    socklen_t len = sizeof(err);
+    getsockopt(c->fd, SOL_SOCKET, SO_ERROR, &err, &len);
+    size_t n = strlen(c->request);
+    if (err || send(c->fd, c->request, n, MSG_NOSIGNAL) != (ssize_t)n) return false;
+    c->request = NULL;
+    return true;
+}
+
+static void client_next(Client_t* c) {
+    static const char* const requests[] = {
+        "GET / HTTP/1.1\r\nHost: bench\r\nAccept-Encoding: gzip\r\n\r\n",
+        "GET /history?span=120 HTTP/1.1\r\nHost: bench\r\n\r\n",
+        "GET /ws HTTP/1.1\r\nHost: bench\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+        "Sec-WebSocket-Key: " BENCH_WS_KEY "\r\nSec-WebSocket-Version: 13\r\n\r\n",
+    };
+    if (c->phase <= CLIENT_UPGRADE && !client_connect(c, requests[c->phase])) c->phase = CLIENT_FAILED;
+}
+
+// Whole reply in rx (server closed): check it, move on
+static void client_reply(Client_t* c) {
+    close(c->fd);
+    c->rx[c->rxLen < BENCH_RX_BYTES ? c->rxLen : BENCH_RX_BYTES - 1] = '\0';
+    const char* body = strstr((const char*)c->rx, "\r\n\r\n");
+    if (strncmp((const char*)c->rx, "HTTP/1.1 503", 12) == 0) {
+        c->phase = CLIENT_REFUSED;
+        return;
+    }
+    if (!body || strncmp((const char*)c->rx, "HTTP/1.1 200", 12) != 0) {
+        c->phase = CLIENT_FAILED;
+        return;
+    }
+    body += 4;
+    uint32_t bodyLen = c->rxLen - (uint32_t)(body - (const char*)c->rx);
+    double us = now_us() - c->phaseUs;
+    if (c->phase == CLIENT_PAGE) {
+        if (bodyLen != sizeof(webIndexGz) || memcmp(body, webIndexGz, bodyLen) != 0) {
+            c->phase = CLIENT_FAILED;
+            return;
+        }
+        c->pageUs = us;
+    } else {
+        if (strncmp(body, "{\"t\":", 5) != 0 || strcmp(body + bodyLen - 2, "]}") != 0) {
+            c->phase = CLIENT_FAILED;
+            return;
+        }
+        for (const char* p = strstr(body, "\"sensors\":["); p && *p; p++) {
+            if (*p == ',' || *p == '[') c->historyPoints++;
+        }
+        c->historyPoints = (c->historyPoints - 1) / 3;
+        c->historyUs = us;
+    }
+    c->phase++;
+    client_next(c);
+}
+
+// Server frames in rx: count, check order, time from publish
+static void client_frames(Client_t* c) {
+    uint32_t pos = 0;
+    while (c->rxLen - pos >= 2) {
+        const uint8_t* f = c->rx + pos;
+        uint32_t len = f[1] & 0x7F, hdr = 2;
+        if (len == 126) {
+            if (c->rxLen - pos < 4) break;
+            len = (uint32_t)f[2] << 8 | f[3];
+            hdr = 4;
+        }
+        if (c->rxLen - pos < hdr + len) break;
+        char msg[WEB_BUF_BYTES + 1];
+        memcpy(msg, f + hdr, len);
+        msg[len] = '\0';
+        const char* s = strstr(msg, "\"seq\":");
+        if ((f[0] & 0x0F) == 0x1 && s) {
+            uint32_t seq = strtoul(s + 6, NULL, 10);
+            if (c->lastSeq && seq != c->lastSeq + 1) c->gaps += seq - c->lastSeq - 1;
+            c->lastSeq = seq;
+            double lat = now_us() - publishUs[seq % BENCH_SEQ_RING];
+            c->latencySum += lat;
+            if (lat > c->latencyMax) c->latencyMax = lat;
+            c->messages++;
+            if (strstr(msg, "\"status\"") && strstr(msg, "\"alarms\"")) c->fulls++;
+        }
+        pos += hdr + len;
+    }
+    memmove(c->rx, c->rx + pos, c->rxLen - pos);
+    c->rxLen -= pos;
+}
+
+static void client_poll(Client_t* c) {
+    if (c->phase >= CLIENT_STALLED) return;
+    if (c->request) {
+        if (!client_send(c)) c->phase = CLIENT_FAILED;
+        return;
+    }
+    for (;;) {
+        ssize_t n = recv(c->fd, c->rx + c->rxLen, BENCH_RX_BYTES - 1 - c->rxLen, 0);
+        if (n > 0) {
+            c->rxLen += n;
+            c->bytes += n;
+            if (c->phase == CLIENT_STREAM) client_frames(c);
+            if (c->rxLen < BENCH_RX_BYTES - 1) continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        if (n == 0 && (c->phase == CLIENT_PAGE || c->phase == CLIENT_HISTORY)) {
+            client_reply(c);
+            return;
+        }
+        if (n <= 0) {
+            // A refused connection is closed with the request unread, which
+            // may reset it before the 503 is read
+            bool refused = (n < 0 && errno == ECONNRESET && c->phase != CLIENT_STREAM) ||
+                           strncmp((const char*)c->rx, "HTTP/1.1 503", 12) == 0;
+            c->phase = refused ? CLIENT_REFUSED : CLIENT_FAILED;
+            close(c->fd);
+            return;
+        }
+    }
+    if (c->phase == CLIENT_UPGRADE) {
+        c->rx[c->rxLen] = '\0';
+        char* end = strstr((char*)c->rx, "\r\n\r\n");
+        if (!end) {
+            if (strncmp((const char*)c->rx, "HTTP/1.1 503", 12) == 0) c->phase = CLIENT_REFUSED;
+            return;
+        }
+        bool ok = strncmp((const char*)c->rx, "HTTP/1.1 101", 12) == 0 && strstr((char*)c->rx, BENCH_WS_ACCEPT);
+        uint32_t head = (uint32_t)(end + 4 - (char*)c->rx);
+        memmove(c->rx, c->rx + head, c->rxLen - head);
+        c->rxLen -= head;
+        c->phase = !ok ? CLIENT_FAILED : c->stall ? CLIENT_STALLED : CLIENT_STREAM;
+        if (c->phase == CLIENT_STREAM) client_frames(c);
+    }
+}
+
+// ============ Serve mode ============
+static int serve(void) {
+    printf("serving http://localhost:%u/ (Ctrl-C to stop)\n", port);
+    uint32_t t0 = millis(), ticks = 0;
+    for (;;) {
+        uint32_t now = (uint32_t)(millis() - t0);
+        if (now / 1000 > ticks) {
+            ticks++;
+            sim_step(1000, 1);
+            live_publish(&live, true);
+            if (ticks % 10 == 0) {
+                const WebStats_t* st = web_get_stats(&web);
+                printf("%lu s: %u sockets, %lu requests, %lu messages (%lu full), %lu skipped, "
+                       "pool high %u/%u, build %.0f us\n",
+                       (unsigned long)ticks, web_sockets(&web), (unsigned long)st->requests,
+                       (unsigned long)st->messages, (unsigned long)st->fullMessages,
+                       (unsigned long)st->skipped, st->poolHigh, WEB_POOL_BUFFERS, st->avgBuildUs);
+                fflush(stdout);
+            }
+        }
+        web_poll(&web, now);
+        usleep(10000);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    int nClients = 4, nStalled = 0, passes = 10, demo = 0;
+    uint32_t seconds = 600;
+    bool serveMode = false;
+    int a = 1;
+    for (; a + 1 < argc && argv[a][0] == '-'; a += 2) {
+        if (argv[a][1] == 'c') nClients = atoi(argv[a + 1]);
+        else if (argv[a][1] == 'z') nStalled = atoi(argv[a + 1]);
+        else if (argv[a][1] == 't') seconds = (uint32_t)atol(argv[a + 1]);
+        else if (argv[a][1] == 'p') passes = atoi(argv[a + 1]);
+        else if (argv[a][1] == 'd') demo = atoi(argv[a + 1]);
+        else if (argv[a][1] == 's') serveMode = atoi(argv[a + 1]) != 0;
+    }
+    if (a < argc) port = (uint16_t)atoi(argv[a]);
+    if (nClients + nStalled > BENCH_MAX_CLIENTS) nClients = BENCH_MAX_CLIENTS - nStalled;
+
+    sim_init();
+    sim_set_demo((uint8_t)demo);
+    live_init(&live);
+    if (!web_begin(&web, port, &live, "STAP-BENCH")) {
+        fprintf(stderr, "port %u: cannot listen\n", port);
+        return 1;
+    }
+    sim_step(1000, 1);
+    live_publish(&live, true);
+    if (serveMode) return serve();
+
+    // Stalled clients first, so they hold slots for the whole run
+    int total = nClients + nStalled;
+    for (int i = 0; i < total; i++) {
+        clients[i].stall = i < nStalled;
+        clients[i].phase = clients[i].stall ? CLIENT_UPGRADE : CLIENT_PAGE;
+        client_next(&clients[i]);
+    }
+
+    double serverUs = 0;
+    double wall0 = now_us();
+    for (uint32_t s = 0; s < seconds; s++) {
+        sim_step(1000, 1);
+        double c0 = cpu_us();
+        live_publish(&live, true);
+        serverUs += cpu_us() - c0;
+        publishUs[live_latest(&live)->seq % BENCH_SEQ_RING] = now_us();
+        for (int p = 0; p < passes; p++) {
+            c0 = cpu_us();
+            web_poll(&web, s * 1000UL + p);
+            serverUs += cpu_us() - c0;
+            for (int i = 0; i < total; i++) client_poll(&clients[i]);
+        }
+    }
+    double wall = (now_us() - wall0) / 1e6;
+
+    const WebStats_t* st = web_get_stats(&web);
+    uint32_t streaming = 0, stalled = 0, refused = 0, failed = 0, messages = 0, fulls = 0, gaps = 0;
+    uint32_t behind = 0;
+    double latSum = 0, latMax = 0, pageMs = 0, historyMs = 0;
+    uint32_t pages = 0, histories = 0, points = 0;
+    for (int i = 0; i < total; i++) {
+        Client_t* c = &clients[i];
+        if (c->phase == CLIENT_STREAM) streaming++;
+        if (c->phase == CLIENT_STREAM && c->messages + c->gaps + BENCH_LATE_S < seconds) behind++;
+        if (c->phase == CLIENT_STALLED) stalled++;
+        if (c->phase == CLIENT_REFUSED) refused++;
+        if (c->phase == CLIENT_FAILED) failed++;
+        if (c->pageUs > 0) pageMs += c->pageUs / 1000, pages++;
+        if (c->historyUs > 0) historyMs += c->historyUs / 1000, histories++, points = c->historyPoints;
+        messages += c->messages;
+        fulls += c->fulls;
+        gaps += c->gaps;
+        latSum += c->latencySum;
+        if (c->latencyMax > latMax) latMax = c->latencyMax;
+    }
+
+    printf("%lu sim s, %d clients + %d stalled (%u slots), %.2f s wall\n",
+           (unsigned long)seconds, nClients, nStalled, WEB_MAX_CLIENTS, wall);
+    printf("  clients: %lu streaming, %lu refused (503), %lu failed; page %.2f ms avg (%lu B gzip), "
+           "history %.2f ms avg (%lu points/sensor)\n",
+           (unsigned long)streaming, (unsigned long)refused, (unsigned long)failed,
+           pages ? pageMs / pages : 0.0, (unsigned long)sizeof(webIndexGz),
+           histories ? historyMs / histories : 0.0, (unsigned long)points);
+    printf("  server: %.1f us CPU per tick, message build %.1f us avg, %lu messages formatted "
+           "(%lu full), %lu frames queued, %.1f KB out\n",
+           serverUs / seconds, st->avgBuildUs, (unsigned long)st->messages,
+           (unsigned long)st->fullMessages, (unsigned long)st->frames, st->bytesOut / 1024.0);
+    printf("  delivery: %lu messages read (%lu full), %lu snapshots skipped by readers, "
+           "latency %.0f us avg, %.0f us max\n",
+           (unsigned long)messages, (unsigned long)fulls, (unsigned long)gaps,
+           messages ? latSum / messages : 0.0, latMax);
+    printf("  memory: pool high %u of %u x %u B, %lu skipped for full queues, %lu pool exhausted\n",
+           st->poolHigh, WEB_POOL_BUFFERS, WEB_BUF_BYTES, (unsigned long)st->skipped,
+           (unsigned long)st->poolExhausted);
+
+    for (int i = 0; i < total; i++) {
+        if (clients[i].phase <= CLIENT_STALLED) close(clients[i].fd);
+    }
+    web_stop(&web);
+    bool ok = failed == 0 && behind == 0 && streaming + stalled + refused == (uint32_t)total;
+    if (!ok) {
+        printf("  FAILED: %lu failed, %lu streaming clients behind, %lu of %d clients unaccounted for\n",
+               (unsigned long)failed, (unsigned long)behind,
+               (unsigned long)(total - streaming - stalled - refused), total);
+    }
+    return ok ? 0 : 1;
+}
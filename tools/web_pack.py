@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+"""SIGNALTAP dashboard packer.
+
+Gzips index.html and writes it as a C header that lives in flash, for the
+device's web server (src/net/web_server.cpp) to send as is with
+Content-Encoding: gzip. The ETag is the CRC-32 of the compressed page, so
+browsers revalidate with a 304 until the page changes. Rerun after every
+edit of index.html. The gzip timestamp is zeroed: the same page always
+gives the same header.
+
+Usage:
+    python3 tools/web_pack.py [index.html] [output.h]
+"""
+import gzip
+import sys
+import zlib
+
+
+def write_header(path, name, blob, etag, note):
+    lines = ["// SIGNALTAP dashboard page (generated by tools/web_pack.py - do not edit)",
+             "// " + note,
+             "#ifndef WEB_INDEX_H",
+             "#define WEB_INDEX_H",
+             "",
+             "#include <Arduino.h>",
+             "",
+             "#define WEB_INDEX_ETAG \"\\\"%s\\\"\"" % etag,
+             "",
+             "static const uint8_t %s[%d] = {" % (name, len(blob))]
+    for i in range(0, len(blob), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in blob[i:i + 16]) + ",")
+    lines += ["};", "", "#endif // WEB_INDEX_H", ""]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    src = sys.argv[1] if len(sys.argv) > 1 else "index.html"
+    out = sys.argv[2] if len(sys.argv) > 2 else "src/net/web_index.h"
+    with open(src, "rb") as f:
+        page = f.read()
+    blob = gzip.compress(page, compresslevel=9, mtime=0)
+    etag = "%08x" % (zlib.crc32(blob) & 0xFFFFFFFF)
+    write_header(out, "webIndexGz", blob, etag,
+                 "%s: %d bytes, %d gzipped (%.1fx)" % (src, len(page), len(blob), len(page) / len(blob)))
+    print("wrote %s (%d -> %d bytes)" % (out, len(page), len(blob)))